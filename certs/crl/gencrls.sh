@@ -48,6 +48,15 @@ echo "Step 1"
 openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crldays 1000 -out crl2.pem -keyfile ../client-key.pem -cert ../client-cert.pem
 check_result $?
 
+# caCrlOld, before server-revoked-cert.pem is revoked, thisUpdate older than
+# caCrlNew of the same CA
+echo "Step 1b"
+openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crl_lastupdate 220101000000Z -crl_nextupdate 491231000000Z -out caCrlOld.pem -keyfile ../ca-key.pem -cert ../ca-cert.pem
+check_result $?
+openssl crl -in caCrlOld.pem -text > tmp
+check_result $?
+mv tmp caCrlOld.pem
+
 echo "Step 2"
 openssl ca -config ../renewcerts/wolfssl.cnf -revoke ../server-revoked-cert.pem -keyfile ../ca-key.pem -cert ../ca-cert.pem
 check_result $?
@@ -56,6 +65,14 @@ echo "Step 3"
 openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crldays 1000 -out crl.pem -keyfile ../ca-key.pem -cert ../ca-cert.pem
 check_result $?
 
+# caCrlNew, server-revoked-cert.pem revoked
+echo "Step 3b"
+openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crl_lastupdate 220201000000Z -crl_nextupdate 491231000000Z -out caCrlNew.pem -keyfile ../ca-key.pem -cert ../ca-cert.pem
+check_result $?
+openssl crl -in caCrlNew.pem -text > tmp
+check_result $?
+mv tmp caCrlNew.pem
+
 # metadata
 echo "Step 4"
 openssl crl -in crl.pem -text > tmp
@@ -141,6 +158,14 @@ mv tmp cliCrl.pem
 # install (only needed if working outside wolfssl)
 #cp cliCrl.pem ~/wolfssl/certs/crl/cliCrl.pem
 
+# crlDist, for the self-signed client-crl-dist.pem
+echo "Step 16b"
+openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crl_lastupdate 220301000000Z -crl_nextupdate 491231000000Z -out crlDist.pem -keyfile ../client-key.pem -cert ../client-crl-dist.pem
+check_result $?
+openssl crl -in crlDist.pem -text > tmp
+check_result $?
+mv tmp crlDist.pem
+
 # eccCliCRL
 echo "Step 17"
 openssl ca -config ../renewcerts/wolfssl.cnf -gencrl -crldays 1000 -out eccCliCRL.pem -keyfile ../ecc-client-key.pem -cert ../client-ecc-cert.pem
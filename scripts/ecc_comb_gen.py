@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+
+# ecc_comb_gen.py
+#
+# Copyright (C) 2006-2021 wolfSSL Inc.
+#
+# Generates wolfcrypt/src/ecc_comb.i, the signed comb tables of the NIST curve
+# base points used by ecc.c.
+#
+# usage: ./scripts/ecc_comb_gen.py > wolfcrypt/src/ecc_comb.i
+#        ./scripts/ecc_comb_gen.py --check wolfcrypt/src/ecc_comb.i
+
+import sys
+
+# Must match ECC_COMB_TEETH in ecc.c.
+TEETH = 6
+
+# (gate, name, curve id, prime, a, order, Gx, Gy, size in bytes)
+CURVES = [
+    ("ECC224", "secp224r1", "ECC_SECP224R1",
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001,
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFE,
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3D,
+     0xB70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21,
+     0xBD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34, 28),
+    ("ECC256", "secp256r1", "ECC_SECP256R1",
+     0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF,
+     0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC,
+     0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551,
+     0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+     0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5, 32),
+    ("ECC384", "secp384r1", "ECC_SECP384R1",
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF,
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFC,
+     0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52973,
+     0xAA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7,
+     0x3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F, 48),
+    ("ECC521", "secp521r1", "ECC_SECP521R1",
+     0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF,
+     0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC,
+     0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386409,
+     0xC6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66,
+     0x11839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650, 66),
+]
+
+HEADER = """\
+/* ecc_comb.i
+ *
+ * Copyright (C) 2006-2021 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+/* Signed comb tables of the NIST curve base points, included by ecc.c.
+ * Generated by scripts/ecc_comb_gen.py - regenerate rather than edit.
+ * Spacing is the order bits divided by ECC_COMB_TEETH, rounded up.
+ * Entry m is 2^(5*spacing)*G plus, for j = 0..4, 2^(j*spacing)*G when bit j
+ * of m is set and minus it when not. Each entry is affine x then y,
+ * big-endian, in Montgomery form for R = 2^(64 * ceil(prime bits / 64)).
+ * A table is only used when the math library's Montgomery R matches.
+ */
+
+"""
+
+
+def point_add(P, Q, p, a):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    (x1, y1), (x2, y2) = P, Q
+    if x1 == x2:
+        if (y1 + y2) % p == 0:
+            return None
+        l = (3 * x1 * x1 + a) * pow(2 * y1, -1, p) % p
+    else:
+        l = (y2 - y1) * pow(x2 - x1, -1, p) % p
+    x3 = (l * l - x1 - x2) % p
+    return (x3, (l * (x1 - x3) - y1) % p)
+
+
+def point_mul(k, P, p, a):
+    R = None
+    while k:
+        if k & 1:
+            R = point_add(R, P, p, a)
+        P = point_add(P, P, p, a)
+        k >>= 1
+    return R
+
+
+def comb_table(p, a, n, gx, gy):
+    spacing = (n.bit_length() + TEETH - 1) // TEETH
+    teeth = [point_mul(1 << (j * spacing), (gx, gy), p, a)
+             for j in range(TEETH)]
+    entries = []
+    for m in range(1 << (TEETH - 1)):
+        P = teeth[TEETH - 1]
+        for j in range(TEETH - 1):
+            Q = teeth[j]
+            if not (m >> j) & 1:
+                Q = (Q[0], (-Q[1]) % p)
+            P = point_add(P, Q, p, a)
+        entries.append(P)
+    return spacing, entries
+
+
+def generate():
+    out = [HEADER]
+    bases = []
+    for (gate, name, cid, p, a, n, gx, gy, sz) in CURVES:
+        spacing, entries = comb_table(p, a, n, gx, gy)
+        montBits = 64 * ((p.bit_length() + 63) // 64)
+        R = 1 << montBits
+        out.append("#ifdef %s\n" % gate)
+        out.append("/* %s: spacing %d, Montgomery R = 2^%d */\n" %
+                   (name.upper(), spacing, montBits))
+        out.append("static const byte ecc_comb_%s[ECC_COMB_ENTRIES * 2 * %d]"
+                   " = {\n" % (name, sz))
+        for i, (x, y) in enumerate(entries):
+            out.append("    /* %d */\n" % i)
+            b = ((x * R) % p).to_bytes(sz, "big") + \
+                ((y * R) % p).to_bytes(sz, "big")
+            for o in range(0, len(b), 12):
+                out.append("    " + " ".join("0x%02x," % c
+                                             for c in b[o:o + 12]) + "\n")
+        out.append("};\n#endif /* %s */\n\n" % gate)
+        bases.append((gate, cid, montBits, name))
+
+    out.append("/* Base point tables by curve id */\n")
+    out.append("static const struct {\n")
+    out.append("    int         id;         /* curve id */\n")
+    out.append("    word32      montBits;   /* bits of the Montgomery R of the"
+               " entries */\n")
+    out.append("    const byte* table;\n")
+    out.append("} ecc_comb_bases[] = {\n")
+    for (gate, cid, montBits, name) in bases:
+        out.append("#ifdef %s\n" % gate)
+        out.append("    { %s, %d, ecc_comb_%s },\n" % (cid, montBits, name))
+        out.append("#endif\n")
+    out.append("    { ECC_CURVE_INVALID, 0, NULL }\n")
+    out.append("};\n")
+    return "".join(out)
+
+
+def main():
+    text = generate()
+    if len(sys.argv) == 3 and sys.argv[1] == "--check":
+        with open(sys.argv[2]) as f:
+            if f.read() != text:
+                sys.stderr.write("%s does not match the generated tables\n" %
+                                 sys.argv[2])
+                return 1
+        return 0
+    if len(sys.argv) != 1:
+        sys.stderr.write("usage: %s [--check ecc_comb.i]\n" % sys.argv[0])
+        return 2
+    sys.stdout.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -29,4 +29,1111 @@
 #include <wolfssl/wolfcrypt/settings.h>
 
 #ifndef WOLFCRYPT_ONLY
+#ifdef HAVE_CRL
+
+#include <wolfssl/internal.h>
+#include <wolfssl/error-ssl.h>
+
+#ifndef WOLFSSL_LINUXKM
+    #include <string.h>
+#endif
+
+#ifdef HAVE_CRL_MONITOR
+    #if (defined(__MACH__) || defined(__FreeBSD__) || defined(__linux__))
+        static int StopMonitor(int mfd);
+    #else
+        #error "CRL monitor only currently supported on linux or mach"
+    #endif
+#endif /* HAVE_CRL_MONITOR */
+
+
+/* Initialize CRL members */
+int InitCRL(WOLFSSL_CRL* crl, WOLFSSL_CERT_MANAGER* cm)
+{
+    WOLFSSL_ENTER("InitCRL");
+    if (cm != NULL)
+        crl->heap = cm->heap;
+    else
+        crl->heap = NULL;
+    crl->cm = cm;
+    crl->crlList = NULL;
+    crl->monitors[0].path = NULL;
+    crl->monitors[1].path = NULL;
+#ifdef HAVE_CRL_IO
+    crl->crlIOCb = NULL;
+#endif
+#ifdef HAVE_CRL_MONITOR
+    crl->tid   =  0;
+    crl->mfd   = -1;    /* mfd for bsd is kqueue fd, eventfd for linux */
+    crl->setup = 0;     /* thread setup done predicate */
+    if (pthread_cond_init(&crl->cond, 0) != 0) {
+        WOLFSSL_MSG("Pthread condition init failed");
+        return BAD_COND_E;
+    }
+#endif
+    if (wc_InitMutex(&crl->crlLock) != 0) {
+        WOLFSSL_MSG("Init Mutex failed");
+        return BAD_MUTEX_E;
+    }
+
+    return 0;
+}
+
+
+/* Order revoked serials by length then value. Leading zeros are removed so
+ * this is numeric order. */
+static WC_INLINE int CompareSerial(const RevokedCert* rc, const byte* serial,
+                                   int serialSz)
+{
+    if (rc->serialSz != serialSz)
+        return (int)rc->serialSz - serialSz;
+    return XMEMCMP(rc->serialNumber, serial, serialSz);
+}
+
+
+/* Restore heap order from node i down, for the first n entries */
+static void SiftRevoked(RevokedCert* rc, int i, int n)
+{
+    RevokedCert tmp;
+    int         child;
+
+    for (; (child = 2 * i + 1) < n; i = child) {
+        if (child + 1 < n && CompareSerial(&rc[child],
+                rc[child + 1].serialNumber, rc[child + 1].serialSz) < 0) {
+            child++;
+        }
+        if (CompareSerial(&rc[i], rc[child].serialNumber,
+                                                    rc[child].serialSz) >= 0) {
+            break;
+        }
+        tmp = rc[i];
+        rc[i] = rc[child];
+        rc[child] = tmp;
+    }
+}
+
+
+/* Sort revoked serials for binary search. CAs usually issue them in order so
+ * only heap sort, in place, when out of order. */
+static void SortRevoked(RevokedCert* rc, int n)
+{
+    RevokedCert tmp;
+    int         i;
+
+    for (i = 1; i < n; i++) {
+        if (CompareSerial(&rc[i - 1], rc[i].serialNumber, rc[i].serialSz) > 0)
+            break;
+    }
+    if (i >= n)
+        return;
+
+    WOLFSSL_MSG("Sorting CRL revoked serials");
+    for (i = n / 2 - 1; i >= 0; i--)
+        SiftRevoked(rc, i, n);
+    for (i = n - 1; i > 0; i--) {
+        tmp = rc[0];
+        rc[0] = rc[i];
+        rc[i] = tmp;
+        SiftRevoked(rc, 0, i);
+    }
+}
+
+
+/* Binary search of the sorted revoked serials, 1 if revoked */
+static int FindRevoked(const CRL_Entry* crle, const byte* serial, int serialSz)
+{
+    int lo = 0;
+    int hi = crle->totalCerts - 1;
+
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        int cmp = CompareSerial(&crle->certs[mid], serial, serialSz);
+
+        if (cmp == 0)
+            return 1;
+        if (cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+
+    return 0;
+}
+
+
+/* Create a CRL Entry, takes over the revoked list of the decoded CRL */
+static CRL_Entry* NewCRL_Entry(DecodedCRL* dcrl, void* heap)
+{
+    CRL_Entry* crle;
+
+    crle = (CRL_Entry*)XMALLOC(sizeof(CRL_Entry), heap, DYNAMIC_TYPE_CRL_ENTRY);
+    if (crle == NULL) {
+        WOLFSSL_MSG("alloc CRL Entry failed");
+        return NULL;
+    }
+    XMEMSET(crle, 0, sizeof(CRL_Entry));
+
+    XMEMCPY(crle->issuerHash, dcrl->issuerHash, CRL_DIGEST_SIZE);
+    XMEMCPY(crle->lastDate, dcrl->lastDate, MAX_DATE_SIZE);
+    XMEMCPY(crle->nextDate, dcrl->nextDate, MAX_DATE_SIZE);
+    crle->lastDateFormat = dcrl->lastDateFormat;
+    crle->nextDateFormat = dcrl->nextDateFormat;
+
+    SortRevoked(dcrl->certs, dcrl->totalCerts);
+    crle->certs      = dcrl->certs;
+    crle->totalCerts = dcrl->totalCerts;
+    dcrl->certs      = NULL;
+    dcrl->totalCerts = 0;
+
+    return crle;
+}
+
+
+/* Free a CRL Entry */
+static void FreeCRL_Entry(CRL_Entry* crle, void* heap)
+{
+    XFREE(crle->certs, heap, DYNAMIC_TYPE_REVOKED);
+    XFREE(crle, heap, DYNAMIC_TYPE_CRL_ENTRY);
+    (void)heap;
+}
+
+
+/* Free a list of CRL Entries */
+static void FreeCRL_List(CRL_Entry* list, void* heap)
+{
+    while (list) {
+        CRL_Entry* next = list->next;
+        FreeCRL_Entry(list, heap);
+        list = next;
+    }
+}
+
+
+/* Free all CRL resources */
+void FreeCRL(WOLFSSL_CRL* crl, int dynamic)
+{
+    WOLFSSL_ENTER("FreeCRL");
+
+#ifdef HAVE_CRL_MONITOR
+    /* stop the thread first, it reads the monitor paths */
+    if (crl->tid != 0) {
+        WOLFSSL_MSG("stopping monitor thread");
+        if (StopMonitor(crl->mfd) == 0)
+            pthread_join(crl->tid, NULL);
+        else {
+            WOLFSSL_MSG("stop monitor failed");
+        }
+    }
+    pthread_cond_destroy(&crl->cond);
+#endif
+    XFREE(crl->monitors[0].path, crl->heap, DYNAMIC_TYPE_CRL_MONITOR);
+    XFREE(crl->monitors[1].path, crl->heap, DYNAMIC_TYPE_CRL_MONITOR);
+
+    FreeCRL_List(crl->crlList, crl->heap);
+    wc_FreeMutex(&crl->crlLock);
+    if (dynamic)   /* free self */
+        XFREE(crl, crl->heap, DYNAMIC_TYPE_CRL);
+}
+
+
+/* Look up the cert in the CRL list, sets foundEntry when the issuer's CRL is
+ * loaded. The lock is only held for the issuer match and binary search. */
+static int CheckCertCRLList(WOLFSSL_CRL* crl, DecodedCert* cert,
+                            int* foundEntry)
+{
+    CRL_Entry*  crle;
+    const byte* serial = cert->serial;
+    int         serialSz = cert->serialSz;
+    int         ret = 0;
+
+    /* revoked serials are stored without the leading zero */
+    if (serialSz > 1 && serial[0] == 0x00) {
+        serial++;
+        serialSz--;
+    }
+
+    if (wc_LockMutex(&crl->crlLock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex failed");
+        return BAD_MUTEX_E;
+    }
+
+    for (crle = crl->crlList; crle != NULL; crle = crle->next) {
+        if (XMEMCMP(crle->issuerHash, cert->issuerHash, CRL_DIGEST_SIZE) == 0) {
+            WOLFSSL_MSG("Found CRL Entry on list");
+            *foundEntry = 1;
+
+            if (FindRevoked(crle, serial, serialSz)) {
+                WOLFSSL_MSG("Cert revoked");
+                ret = CRL_CERT_REVOKED;
+            }
+        #ifndef NO_ASN_TIME
+            else if (crle->nextDateFormat != ASN_OTHER_TYPE &&
+                    !XVALIDATE_DATE(crle->nextDate, crle->nextDateFormat,
+                                                                      AFTER)) {
+                WOLFSSL_MSG("CRL next date is no longer valid");
+                ret = CRL_CERT_DATE_ERR;
+            }
+        #endif
+            break;
+        }
+    }
+
+    wc_UnLockMutex(&crl->crlLock);
+
+    return ret;
+}
+
+
+/* Is the cert ok with CRL, return 0 on success */
+int CheckCertCRL(WOLFSSL_CRL* crl, DecodedCert* cert)
+{
+    int foundEntry = 0;
+    int ret = 0;
+
+    WOLFSSL_ENTER("CheckCertCRL");
+
+    if (crl == NULL || cert == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = CheckCertCRLList(crl, cert, &foundEntry);
+
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    /* distribution point is only wanted when the CRL isn't loaded */
+    if (foundEntry == 0) {
+        int decRet = DecodeCertDeferred(cert, CRL_DIST_OID);
+        if (decRet != 0)
+            return decRet;
+    }
+#endif
+
+#ifdef HAVE_CRL_IO
+    if (foundEntry == 0) {
+        /* perform embedded lookup */
+        if (crl->crlIOCb) {
+            ret = crl->crlIOCb(crl, (const char*)cert->extCrlInfo,
+                                                        cert->extCrlInfoSz);
+            if (ret == WOLFSSL_CBIO_ERR_WANT_READ) {
+                ret = WANT_READ;
+            }
+            else if (ret >= 0) {
+                /* try again */
+                ret = CheckCertCRLList(crl, cert, &foundEntry);
+            }
+        }
+    }
+#endif
+
+    if (foundEntry == 0) {
+        WOLFSSL_MSG("Couldn't find CRL for status check");
+        if (ret != WANT_READ) {
+            ret = CRL_MISSING;
+        }
+
+        if (crl->cm->cbMissingCRL) {
+            char url[256];
+
+            WOLFSSL_MSG("Issuing missing CRL callback");
+            url[0] = '\0';
+            if (cert->extCrlInfo) {
+                if (cert->extCrlInfoSz < (int)sizeof(url) -1 ) {
+                    XMEMCPY(url, cert->extCrlInfo, cert->extCrlInfoSz);
+                    url[cert->extCrlInfoSz] = '\0';
+                }
+                else  {
+                    WOLFSSL_MSG("CRL url too long");
+                }
+            }
+
+            crl->cm->cbMissingCRL(url);
+        }
+    }
+
+    return ret;
+}
+
+
+/* Length of a date as YYYYMMDDHHMMSS */
+#define CRL_DATE_KEY_SZ 14
+
+/* Date of format as YYYYMMDDHHMMSS so dates compare with XMEMCMP.
+ * return 0 on success, -1 for an unknown format */
+static int CRL_DateKey(const byte* date, byte format, byte* key)
+{
+    if (format == ASN_UTC_TIME) {
+        /* two digit years of 50 and up are 19xx, RFC 5280 4.1.2.5.1 */
+        key[0] = (date[0] >= '5') ? '1' : '2';
+        key[1] = (date[0] >= '5') ? '9' : '0';
+        XMEMCPY(key + 2, date, CRL_DATE_KEY_SZ - 2);
+    }
+    else if (format == ASN_GENERALIZED_TIME) {
+        XMEMCPY(key, date, CRL_DATE_KEY_SZ);
+    }
+    else {
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* 1 if CRL a was issued before b, thisUpdate compared. Dates that can't be
+ * compared are not older so the last loaded CRL is used. */
+static int CRL_IsOlder(const CRL_Entry* a, const CRL_Entry* b)
+{
+    byte aKey[CRL_DATE_KEY_SZ];
+    byte bKey[CRL_DATE_KEY_SZ];
+
+    if (CRL_DateKey(a->lastDate, a->lastDateFormat, aKey) != 0 ||
+            CRL_DateKey(b->lastDate, b->lastDateFormat, bKey) != 0) {
+        return 0;
+    }
+
+    return XMEMCMP(aKey, bKey, CRL_DATE_KEY_SZ) < 0;
+}
+
+
+/* Add Decoded CRL, 0 on success. A CRL from the same issuer is replaced
+ * unless it was issued later than the new one, so an old file seen after a
+ * newer one doesn't bring back a superseded list; the entry is built and
+ * sorted before the lock is taken. */
+static int AddCRL(WOLFSSL_CRL* crl, DecodedCRL* dcrl)
+{
+    CRL_Entry*  crle;
+    CRL_Entry*  old = NULL;
+    CRL_Entry** prev;
+
+    WOLFSSL_ENTER("AddCRL");
+
+    crle = NewCRL_Entry(dcrl, crl->heap);
+    if (crle == NULL)
+        return MEMORY_E;
+
+    if (wc_LockMutex(&crl->crlLock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex failed");
+        FreeCRL_Entry(crle, crl->heap);
+        return BAD_MUTEX_E;
+    }
+    for (prev = &crl->crlList; *prev != NULL; prev = &(*prev)->next) {
+        if (XMEMCMP((*prev)->issuerHash, crle->issuerHash,
+                                                       CRL_DIGEST_SIZE) == 0) {
+            old = *prev;
+            break;
+        }
+    }
+    if (old != NULL && CRL_IsOlder(crle, old)) {
+        WOLFSSL_MSG("Kept newer CRL of same issuer");
+        old = crle; /* the new entry is freed instead */
+    }
+    else if (old != NULL) {
+        crle->next = old->next;
+        *prev = crle;
+        WOLFSSL_MSG("Replaced CRL of same issuer");
+    }
+    else {
+        crle->next = crl->crlList;
+        crl->crlList = crle;
+    }
+    wc_UnLockMutex(&crl->crlLock);
+
+    if (old != NULL) {
+        FreeCRL_Entry(old, crl->heap);
+    }
+
+    return 0;
+}
+
+
+/* Load CRL File of type, WOLFSSL_SUCCESS on ok */
+int BufferLoadCRL(WOLFSSL_CRL* crl, const byte* buff, long sz, int type,
+                  int verify)
+{
+    int          ret = WOLFSSL_SUCCESS;
+    const byte*  myBuffer = buff;    /* if DER ok, otherwise switch */
+    DerBuffer*   der = NULL;
+#ifdef WOLFSSL_SMALL_STACK
+    DecodedCRL*  dcrl;
+#else
+    DecodedCRL   dcrl[1];
+#endif
+
+    WOLFSSL_ENTER("BufferLoadCRL");
+
+    if (crl == NULL || buff == NULL || sz == 0)
+        return BAD_FUNC_ARG;
+
+    if (type == WOLFSSL_FILETYPE_PEM) {
+    #ifdef WOLFSSL_PEM_TO_DER
+        ret = PemToDer(buff, sz, CRL_TYPE, &der, NULL, NULL, NULL);
+        if (ret == 0) {
+            myBuffer = der->buffer;
+            sz = der->length;
+        }
+        else {
+            WOLFSSL_MSG("Pem to Der failed");
+            FreeDer(&der);
+            return -1;
+        }
+    #else
+        WOLFSSL_MSG("Pem to Der not compiled in");
+        return NOT_COMPILED_IN;
+    #endif
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    dcrl = (DecodedCRL*)XMALLOC(sizeof(DecodedCRL), NULL,
+                                                       DYNAMIC_TYPE_TMP_BUFFER);
+    if (dcrl == NULL) {
+        FreeDer(&der);
+        return MEMORY_E;
+    }
+#endif
+
+    InitDecodedCRL(dcrl, crl->heap);
+    ret = ParseCRL(dcrl, myBuffer, (word32)sz, verify, crl->cm);
+    if (ret != 0) {
+        WOLFSSL_MSG("ParseCRL error");
+    }
+    else {
+        ret = AddCRL(crl, dcrl);
+        if (ret != 0) {
+            WOLFSSL_MSG("AddCRL error");
+        }
+    }
+
+    FreeDecodedCRL(dcrl);
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(dcrl, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    FreeDer(&der);
+
+    return ret ? ret : WOLFSSL_SUCCESS; /* convert 0 to WOLFSSL_SUCCESS */
+}
+
+
+#ifndef NO_FILESYSTEM
+
+/* Read the reload directories into a new list and swap it in. Parsing, signature
+ * checks and sorting happen before the lock is taken, so lookups only wait for
+ * the pointer swap. WOLFSSL_SUCCESS on ok */
+int ReloadCRL(WOLFSSL_CRL* crl)
+{
+    int         ret = WOLFSSL_SUCCESS;
+    CRL_Entry*  newList;
+#ifdef WOLFSSL_SMALL_STACK
+    WOLFSSL_CRL* tmp;
+#else
+    WOLFSSL_CRL tmp[1];
+#endif
+
+    WOLFSSL_ENTER("ReloadCRL");
+
+    if (crl == NULL)
+        return BAD_FUNC_ARG;
+    if (crl->monitors[0].path == NULL && crl->monitors[1].path == NULL) {
+        WOLFSSL_MSG("No CRL directories to reload");
+        return BAD_STATE_E;
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    tmp = (WOLFSSL_CRL*)XMALLOC(sizeof(WOLFSSL_CRL), NULL,
+                                                       DYNAMIC_TYPE_TMP_BUFFER);
+    if (tmp == NULL)
+        return MEMORY_E;
+#endif
+
+    if (InitCRL(tmp, crl->cm) < 0) {
+        WOLFSSL_MSG("Init tmp CRL failed");
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(tmp, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    #endif
+        return -1;
+    }
+
+    if (crl->monitors[0].path) {
+        ret = LoadCRL(tmp, crl->monitors[0].path, WOLFSSL_FILETYPE_PEM, 0);
+        if (ret != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("PEM LoadCRL on dir change failed");
+        }
+    }
+
+    if (ret == WOLFSSL_SUCCESS && crl->monitors[1].path) {
+        ret = LoadCRL(tmp, crl->monitors[1].path, WOLFSSL_FILETYPE_ASN1, 0);
+        if (ret != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("DER LoadCRL on dir change failed");
+        }
+    }
+
+    if (ret == WOLFSSL_SUCCESS) {
+        if (wc_LockMutex(&crl->crlLock) != 0) {
+            WOLFSSL_MSG("wc_LockMutex failed");
+            ret = BAD_MUTEX_E;
+        }
+        else {
+            newList = tmp->crlList;
+
+            /* swap lists */
+            tmp->crlList = crl->crlList;
+            crl->crlList = newList;
+
+            wc_UnLockMutex(&crl->crlLock);
+        }
+    }
+
+    /* frees the old list after the swap */
+    FreeCRL(tmp, 0);
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(tmp, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+
+#endif /* !NO_FILESYSTEM */
+
+
+#ifdef HAVE_CRL_MONITOR
+
+
+/* Signal Monitor thread is setup, save status to setup flag, 0 on success */
+static int SignalSetup(WOLFSSL_CRL* crl, int status)
+{
+    int ret;
+
+    /* signal to calling thread we're setup */
+    if (wc_LockMutex(&crl->crlLock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex crlLock failed");
+        return BAD_MUTEX_E;
+    }
+
+        crl->setup = status;
+        ret = pthread_cond_signal(&crl->cond);
+
+    wc_UnLockMutex(&crl->crlLock);
+
+    if (ret != 0)
+        return BAD_COND_E;
+
+    return 0;
+}
+
+
+#if (defined(__MACH__) || defined(__FreeBSD__))
+
+#include <sys/types.h>
+#include <sys/event.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __MACH__
+    #define XEVENT_MODE O_EVTONLY
+#elif defined(__FreeBSD__)
+    #define XEVENT_MODE EVFILT_VNODE
+#endif
+
+
+/* we need a unique kqueue user filter fd for crl in case user is doing custom
+ * events too */
+#ifndef CRL_CUSTOM_FD
+    #define CRL_CUSTOM_FD 123456
+#endif
+
+
+/* shutdown monitor thread, 0 on success */
+static int StopMonitor(int mfd)
+{
+    struct kevent change;
+
+    /* trigger custom shutdown */
+    EV_SET(&change, CRL_CUSTOM_FD, EVFILT_USER, 0, NOTE_TRIGGER, 0, NULL);
+    if (kevent(mfd, &change, 1, NULL, 0, NULL) < 0) {
+        WOLFSSL_MSG("kevent trigger customer event failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* OS X  monitoring */
+static void* DoMonitor(void* arg)
+{
+    int fPEM, fDER;
+    int nChanges = 0;
+    struct kevent change[2];
+
+    WOLFSSL_CRL* crl = (WOLFSSL_CRL*)arg;
+
+    WOLFSSL_ENTER("DoMonitor");
+
+    crl->mfd = kqueue();
+    if (crl->mfd == -1) {
+        WOLFSSL_MSG("kqueue failed");
+        SignalSetup(crl, MONITOR_SETUP_E);
+        return NULL;
+    }
+
+    /* listen for custom shutdown event */
+    EV_SET(&change[0], CRL_CUSTOM_FD, EVFILT_USER, EV_ADD, 0, 0, NULL);
+    if (kevent(crl->mfd, &change[0], 1, NULL, 0, NULL) < 0) {
+        WOLFSSL_MSG("kevent monitor customer event failed");
+        SignalSetup(crl, MONITOR_SETUP_E);
+        close(crl->mfd);
+        return NULL;
+    }
+
+    fPEM = -1;
+    fDER = -1;
+
+    if (crl->monitors[0].path) {
+        fPEM = open(crl->monitors[0].path, XEVENT_MODE);
+        if (fPEM == -1) {
+            WOLFSSL_MSG("PEM event dir open failed");
+            SignalSetup(crl, MONITOR_SETUP_E);
+            close(crl->mfd);
+            return NULL;
+        }
+    }
+
+    if (crl->monitors[1].path) {
+        fDER = open(crl->monitors[1].path, XEVENT_MODE);
+        if (fDER == -1) {
+            WOLFSSL_MSG("DER event dir open failed");
+            if (fPEM != -1)
+                close(fPEM);
+            close(crl->mfd);
+            SignalSetup(crl, MONITOR_SETUP_E);
+            return NULL;
+        }
+    }
+
+    if (fPEM != -1)
+        EV_SET(&change[nChanges++], fPEM, EVFILT_VNODE,
+                EV_ADD | EV_ENABLE | EV_CLEAR,
+                NOTE_DELETE | NOTE_EXTEND | NOTE_WRITE | NOTE_ATTRIB, 0, 0);
+
+    if (fDER != -1)
+        EV_SET(&change[nChanges++], fDER, EVFILT_VNODE,
+                EV_ADD | EV_ENABLE | EV_CLEAR,
+                NOTE_DELETE | NOTE_EXTEND | NOTE_WRITE | NOTE_ATTRIB, 0, 0);
+
+    if (nChanges > 0 &&
+            kevent(crl->mfd, change, nChanges, NULL, 0, NULL) < 0) {
+        WOLFSSL_MSG("kevent monitor dir event failed");
+        if (fPEM != -1)
+            close(fPEM);
+        if (fDER != -1)
+            close(fDER);
+        close(crl->mfd);
+        SignalSetup(crl, MONITOR_SETUP_E);
+        return NULL;
+    }
+
+    /* signal to calling thread we're setup */
+    if (SignalSetup(crl, 1) != 0) {
+        if (fPEM != -1)
+            close(fPEM);
+        if (fDER != -1)
+            close(fDER);
+        close(crl->mfd);
+        return NULL;
+    }
+
+    for (;;) {
+        struct kevent event;
+        int           numEvents = kevent(crl->mfd, NULL, 0, &event, 1, NULL);
+
+        WOLFSSL_MSG("Got kevent");
+
+        if (numEvents == -1) {
+            WOLFSSL_MSG("kevent problem, continue");
+            continue;
+        }
+
+        if (event.filter == EVFILT_USER) {
+            WOLFSSL_MSG("Got user shutdown event, breaking out");
+            break;
+        }
+
+        if (ReloadCRL(crl) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("ReloadCRL problem, continue");
+        }
+    }
+
+    if (fPEM != -1)
+        close(fPEM);
+    if (fDER != -1)
+        close(fDER);
+
+    close(crl->mfd);
+
+    return NULL;
+}
+
+
+#elif defined(__linux__)
+
+#include <sys/types.h>
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+
+#ifndef max
+static WC_INLINE int max(int a, int b)
+{
+    return a > b ? a : b;
+}
+#endif /* max */
+
+
+/* shutdown monitor thread, 0 on success */
+static int StopMonitor(int mfd)
+{
+    word64 w64 = 1;
+
+    /* write to our custom event */
+    if (write(mfd, &w64, sizeof(w64)) < 0) {
+        WOLFSSL_MSG("StopMonitor write failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* linux monitoring */
+static void* DoMonitor(void* arg)
+{
+    int         notifyFd;
+    int         wd  = -1;
+    WOLFSSL_CRL* crl = (WOLFSSL_CRL*)arg;
+#ifdef WOLFSSL_SMALL_STACK
+    char*       buff;
+#else
+    char        buff[8192];
+#endif
+    /* new files are often written elsewhere and renamed into place */
+    const word32 watchMask = IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_TO;
+
+    WOLFSSL_ENTER("DoMonitor");
+
+    crl->mfd = eventfd(0, 0);  /* our custom shutdown event */
+    if (crl->mfd < 0) {
+        WOLFSSL_MSG("eventfd failed");
+        SignalSetup(crl, MONITOR_SETUP_E);
+        return NULL;
+    }
+
+    notifyFd = inotify_init();
+    if (notifyFd < 0) {
+        WOLFSSL_MSG("inotify failed");
+        close(crl->mfd);
+        SignalSetup(crl, MONITOR_SETUP_E);
+        return NULL;
+    }
+
+    if (crl->monitors[0].path) {
+        wd = inotify_add_watch(notifyFd, crl->monitors[0].path, watchMask);
+        if (wd < 0) {
+            WOLFSSL_MSG("PEM notify add watch failed");
+            close(crl->mfd);
+            close(notifyFd);
+            SignalSetup(crl, MONITOR_SETUP_E);
+            return NULL;
+        }
+    }
+
+    if (crl->monitors[1].path) {
+        wd = inotify_add_watch(notifyFd, crl->monitors[1].path, watchMask);
+        if (wd < 0) {
+            WOLFSSL_MSG("DER notify add watch failed");
+            close(crl->mfd);
+            close(notifyFd);
+            SignalSetup(crl, MONITOR_SETUP_E);
+            return NULL;
+        }
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    buff = (char*)XMALLOC(8192, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if (buff == NULL) {
+        close(crl->mfd);
+        close(notifyFd);
+        SignalSetup(crl, MONITOR_SETUP_E);
+        return NULL;
+    }
+#endif
+
+    /* signal to calling thread we're setup */
+    if (SignalSetup(crl, 1) != 0) {
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(buff, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    #endif
+
+        if (wd > 0)
+            inotify_rm_watch(notifyFd, wd);
+        close(crl->mfd);
+        close(notifyFd);
+        return NULL;
+    }
+
+    for (;;) {
+        fd_set readfds;
+        int    result;
+        int    length;
+
+        FD_ZERO(&readfds);
+        FD_SET(notifyFd, &readfds);
+        FD_SET(crl->mfd, &readfds);
+
+        result = select(max(notifyFd, crl->mfd) + 1, &readfds, NULL, NULL,NULL);
+
+        WOLFSSL_MSG("Got notify event");
+
+        if (result < 0) {
+            WOLFSSL_MSG("select problem, continue");
+            continue;
+        }
+
+        if (FD_ISSET(crl->mfd, &readfds)) {
+            WOLFSSL_MSG("got custom shutdown event, breaking out");
+            break;
+        }
+
+        length = (int) read(notifyFd, buff, 8192);
+        if (length < 0) {
+            WOLFSSL_MSG("notify read problem, continue");
+            continue;
+        }
+
+        if (ReloadCRL(crl) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("ReloadCRL problem, continue");
+        }
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(buff, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    if (wd > 0)
+        inotify_rm_watch(notifyFd, wd);
+    close(crl->mfd);
+    close(notifyFd);
+
+    return NULL;
+}
+
+#endif /* MACH or linux */
+
+
+/* Start Monitoring the CRL path(s) in a thread */
+static int StartMonitorCRL(WOLFSSL_CRL* crl)
+{
+    int ret = WOLFSSL_SUCCESS;
+
+    WOLFSSL_ENTER("StartMonitorCRL");
+
+    if (crl == NULL)
+        return BAD_FUNC_ARG;
+
+    if (crl->tid != 0) {
+        WOLFSSL_MSG("Monitor thread already running");
+        return ret;  /* that's ok, someone already started */
+    }
+
+    if (pthread_create(&crl->tid, NULL, DoMonitor, crl) != 0) {
+        WOLFSSL_MSG("Thread creation error");
+        return THREAD_CREATE_E;
+    }
+
+    /* wait for setup to complete */
+    if (wc_LockMutex(&crl->crlLock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex crlLock error");
+        return BAD_MUTEX_E;
+    }
+
+        while (crl->setup == 0) {
+            if (pthread_cond_wait(&crl->cond, &crl->crlLock) != 0) {
+                ret = BAD_COND_E;
+                break;
+            }
+        }
+
+        if (crl->setup < 0)
+            ret = crl->setup;  /* store setup error */
+
+    wc_UnLockMutex(&crl->crlLock);
+
+    if (ret < 0) {
+        WOLFSSL_MSG("DoMonitor setup failure");
+        pthread_join(crl->tid, NULL);
+        crl->tid = 0;  /* thread already done */
+    }
+
+    return ret;
+}
+
+
+#else /* HAVE_CRL_MONITOR */
+
+#ifndef NO_FILESYSTEM
+
+static int StartMonitorCRL(WOLFSSL_CRL* crl)
+{
+    (void)crl;
+
+    WOLFSSL_ENTER("StartMonitorCRL");
+    WOLFSSL_MSG("Not compiled in");
+
+    return NOT_COMPILED_IN;
+}
+
+#endif /* NO_FILESYSTEM */
+
+#endif  /* HAVE_CRL_MONITOR */
+
+#if !defined(NO_FILESYSTEM) && !defined(NO_WOLFSSL_DIR)
+
+/* Load CRL path files of type, WOLFSSL_SUCCESS on ok.
+ * path is a directory, or a single file. Load failures of files in a
+ * directory are not reported so one bad file doesn't stop a directory
+ * (re)load; a single file returns its parse or verify error and a missing
+ * path BAD_PATH_ERROR. monitor flags keep the directory for ReloadCRL and can
+ * start the monitor thread. */
+int LoadCRL(WOLFSSL_CRL* crl, const char* path, int type, int monitor)
+{
+    int         ret = WOLFSSL_SUCCESS;
+    int         isDir = 0;
+    char*       name = NULL;
+#ifdef WOLFSSL_SMALL_STACK
+    ReadDirCtx* readCtx = NULL;
+#else
+    ReadDirCtx  readCtx[1];
+#endif
+
+    WOLFSSL_ENTER("LoadCRL");
+    if (crl == NULL || path == NULL)
+        return BAD_FUNC_ARG;
+
+#ifdef WOLFSSL_SMALL_STACK
+    readCtx = (ReadDirCtx*)XMALLOC(sizeof(ReadDirCtx), crl->heap,
+                                                       DYNAMIC_TYPE_TMP_BUFFER);
+    if (readCtx == NULL)
+        return MEMORY_E;
+#endif
+
+    /* try to load each regular file in path */
+    ret = wc_ReadDirFirst(readCtx, path, &name);
+    if (ret == BAD_PATH_ERROR && wc_FileExists(path) == 0) {
+        ret = ProcessFile(NULL, path, type, CRL_TYPE, NULL, 0, crl, VERIFY);
+        if (ret != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("CRL file load failed");
+        }
+        monitor = 0; /* only directories are reloaded */
+    }
+    else if (ret == BAD_PATH_ERROR) {
+        WOLFSSL_MSG("CRL path not found");
+    }
+    else {
+        isDir = 1;
+    }
+    while (isDir && ret == 0 && name) {
+        int skip = 0;
+        if (type == WOLFSSL_FILETYPE_PEM) {
+            if (XSTRSTR(name, ".pem") == NULL) {
+                WOLFSSL_MSG("not .pem file, skipping");
+                skip = 1;
+            }
+        }
+        else {
+            if (XSTRSTR(name, ".der") == NULL &&
+                XSTRSTR(name, ".crl") == NULL)
+            {
+                WOLFSSL_MSG("not .der or .crl file, skipping");
+                skip = 1;
+            }
+        }
+
+        if (!skip && ProcessFile(NULL, name, type, CRL_TYPE, NULL, 0, crl,
+                                                     VERIFY) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("CRL file load failed, continuing");
+        }
+
+        ret = wc_ReadDirNext(readCtx, path, &name);
+    }
+    wc_ReadDirClose(readCtx);
+    if (isDir) {
+        ret = WOLFSSL_SUCCESS; /* file failures in a dir not reported */
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(readCtx, crl->heap, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    if (ret != WOLFSSL_SUCCESS) {
+        return ret;
+    }
+
+    if (monitor & WOLFSSL_CRL_MONITOR) {
+        word32 pathLen;
+        char* pathBuf;
+
+        WOLFSSL_MSG("monitor path requested");
+
+        pathLen = (word32)XSTRLEN(path);
+        pathBuf = (char*)XMALLOC(pathLen+1, crl->heap,DYNAMIC_TYPE_CRL_MONITOR);
+        if (pathBuf) {
+            XSTRNCPY(pathBuf, path, pathLen+1);
+
+            if (type == WOLFSSL_FILETYPE_PEM) {
+                /* free old path before setting a new one */
+                if (crl->monitors[0].path) {
+                    XFREE(crl->monitors[0].path, crl->heap,
+                            DYNAMIC_TYPE_CRL_MONITOR);
+                }
+                crl->monitors[0].path = pathBuf;
+                crl->monitors[0].type = WOLFSSL_FILETYPE_PEM;
+            } else {
+                /* free old path before setting a new one */
+                if (crl->monitors[1].path) {
+                    XFREE(crl->monitors[1].path, crl->heap,
+                            DYNAMIC_TYPE_CRL_MONITOR);
+                }
+                crl->monitors[1].path = pathBuf;
+                crl->monitors[1].type = WOLFSSL_FILETYPE_ASN1;
+            }
+
+            if (monitor & WOLFSSL_CRL_START_MON) {
+                WOLFSSL_MSG("start monitoring requested");
+
+                ret = StartMonitorCRL(crl);
+            }
+        }
+        else {
+            ret = MEMORY_E;
+        }
+    }
+
+    return ret;
+}
+
+#else
+int LoadCRL(WOLFSSL_CRL* crl, const char* path, int type, int monitor)
+{
+    (void)crl;
+    (void)path;
+    (void)type;
+    (void)monitor;
+
+    /* stub for scenario where file system is not supported */
+    return NOT_COMPILED_IN;
+}
+#endif /* !NO_FILESYSTEM && !NO_WOLFSSL_DIR */
+
+#endif /* HAVE_CRL */
 #endif /* !WOLFCRYPT_ONLY */
@@ -283,6 +283,9 @@ void SSL_CtxResourceFree(WOLFSSL_CTX* ctx)
 {
     void* heapAtCTXInit = ctx->heap;
 
+#ifdef WOLFSSL_EPH_KEY_POOL
+    FreeEphKeyPool(ctx);
+#endif
 
 
     XFREE(ctx->method, heapAtCTXInit, DYNAMIC_TYPE_METHOD);
@@ -913,27 +916,103 @@ int RsaEnc(WOLFSSL* ssl, const byte* in, word32 inSz, byte* out, word32* outSz,
 
 
 
-int EccSign(WOLFSSL* ssl, const byte* in, word32 inSz, byte* out,
-    word32* outSz, ecc_key* key, DerBuffer* keyBufInfo)
+#ifdef WC_ECC_NONBLOCK
+/* Allocate the non-blocking state on first use */
+static int NonBlockInit(WOLFSSL* ssl)
 {
-    int ret;
+    if (ssl->nonblock == NULL) {
+        ssl->nonblock = (struct WOLFSSL_NONBLOCK*)XMALLOC(
+            sizeof(struct WOLFSSL_NONBLOCK), ssl->heap, DYNAMIC_TYPE_ASYNC);
+        if (ssl->nonblock == NULL) {
+            return MEMORY_E;
+        }
+        XMEMSET(ssl->nonblock, 0, sizeof(struct WOLFSSL_NONBLOCK));
+    }
+
+    return 0;
+}
+
+/* Attach the non-blocking context to key when time slicing is enabled and no
+ * operation on the key is pending */
+static int EccNonBlockStart(WOLFSSL* ssl, ecc_key* key)
+{
+    int ret = 0;
+
+    if (ssl->eccNbSteps != 0 && key->nb_ctx == NULL) {
+        ret = NonBlockInit(ssl);
+        if (ret == 0) {
+            ret = wc_ecc_set_nonblock(key, &ssl->nonblock->eccNb);
+        }
+        if (ret == 0) {
+            ssl->nonblock->eccNb.maxSteps = ssl->eccNbSteps;
+        }
+    }
+
+    return ret;
+}
 
+/* Report a sliced ECC operation that needs more calls as WC_PENDING_E,
+ * otherwise detach the non-blocking context as the operation is done */
+static int EccNonBlockDone(WOLFSSL* ssl, ecc_key* key, int ret)
+{
     (void)ssl;
-    (void)keyBufInfo;
 
-    WOLFSSL_ENTER("EccSign");
+    if (ret == FP_WOULDBLOCK) {
+        return WC_PENDING_E;
+    }
+    if (key->nb_ctx != NULL) {
+        wc_ecc_set_nonblock(key, NULL);
+    }
 
+    return ret;
+}
 
-    {
-        ret = wc_ecc_sign_hash(in, inSz, out, outSz, ssl->rng, key);
+/* Save the arguments of a handshake message whose ECC operation is pending.
+ * The next call for the message picks them up with RestoreNonBlockArgs().
+ * Returns WC_PENDING_E on success. */
+static int SaveNonBlockArgs(WOLFSSL* ssl, const void* args, word32 argsSz,
+                            FreeArgsCb freeArgs)
+{
+    int ret;
+
+    ret = NonBlockInit(ssl);
+    if (ret != 0) {
+        return ret;
     }
 
-    /* Handle async pending response */
+    XMEMCPY(ssl->nonblock->args, args, argsSz);
+    ssl->nonblock->freeArgs = freeArgs;
 
-    WOLFSSL_LEAVE("EccSign", ret);
+    return WC_PENDING_E;
+}
 
-    return ret;
+/* Restore the saved arguments for the message processed by freeArgs' owner.
+ * Returns 1 when the message is being resumed, 0 otherwise. */
+static int RestoreNonBlockArgs(WOLFSSL* ssl, void* args, word32 argsSz,
+                               FreeArgsCb freeArgs)
+{
+    if (ssl->nonblock == NULL || ssl->nonblock->freeArgs != freeArgs) {
+        return 0;
+    }
+
+    XMEMCPY(args, ssl->nonblock->args, argsSz);
+    ssl->nonblock->freeArgs = NULL;
+
+    return 1;
+}
+
+/* Free saved message arguments and the non-blocking state */
+static void FreeNonBlock(WOLFSSL* ssl)
+{
+    if (ssl->nonblock != NULL) {
+        if (ssl->nonblock->freeArgs != NULL) {
+            ssl->nonblock->freeArgs(ssl, ssl->nonblock->args);
+        }
+        XFREE(ssl->nonblock, ssl->heap, DYNAMIC_TYPE_ASYNC);
+        ssl->nonblock = NULL;
+    }
 }
+#endif /* WC_ECC_NONBLOCK */
 
 int EccVerify(WOLFSSL* ssl, const byte* in, word32 inSz, const byte* out,
     word32 outSz, ecc_key* key, buffer* keyBufInfo)
@@ -945,12 +1024,22 @@ int EccVerify(WOLFSSL* ssl, const byte* in, word32 inSz, const byte* out,
 
     WOLFSSL_ENTER("EccVerify");
 
+#ifdef WC_ECC_NONBLOCK
+    ret = EccNonBlockStart(ssl, key);
+    if (ret != 0) {
+        return ret;
+    }
+#endif
 
     {
         ret = wc_ecc_verify_hash(in, inSz, out, outSz, &ssl->eccVerifyRes, key);
     }
 
     /* Handle async pending response */
+#ifdef WC_ECC_NONBLOCK
+    ret = EccNonBlockDone(ssl, key, ret);
+    if (ret != WC_PENDING_E)
+#endif
     {
         ret = (ret != 0 || ssl->eccVerifyRes == 0) ? VERIFY_SIGN_ERROR : 0;
     }
@@ -973,6 +1062,12 @@ int EccSharedSecret(WOLFSSL* ssl, ecc_key* priv_key, ecc_key* pub_key,
 
     WOLFSSL_ENTER("EccSharedSecret");
 
+#ifdef WC_ECC_NONBLOCK
+    ret = EccNonBlockStart(ssl, priv_key);
+    if (ret != 0) {
+        return ret;
+    }
+#endif
 
     {
         {
@@ -983,17 +1078,449 @@ int EccSharedSecret(WOLFSSL* ssl, ecc_key* priv_key, ecc_key* pub_key,
     }
 
     /* Handle async pending response */
+#ifdef WC_ECC_NONBLOCK
+    ret = EccNonBlockDone(ssl, priv_key, ret);
+#endif
 
     WOLFSSL_LEAVE("EccSharedSecret", ret);
 
     return ret;
 }
 
+#ifdef WOLFSSL_EPH_KEY_POOL
+static int CheckCurveId(int tlsCurveId);
+
+/* Ephemeral key pool.
+ *
+ * A thread per WOLFSSL_CTX keeps up to depth ECDHE key pairs ready for each
+ * curve the client offers. EccMakeKey(), X25519MakeKey() and X448MakeKey()
+ * take a pair out of the pool instead of generating one, so each key is used
+ * for one handshake only. A curve the server picks that isn't pooled yet is
+ * added on first use. When a curve runs dry the key is made inline as
+ * before.
+ *
+ * The CTX holds a reference to its pool and each take holds another while it
+ * runs, so replacing or stopping the pool never frees it under a handshake.
+ * The pool records the process id it was made in; a child process after
+ * fork() zeroizes the inherited keys and makes its own. */
+
+/* Make a key pair on the curve and export it into out */
+static int EphKeyMake(word32 oid, WC_RNG* rng, void* heap, EphKey* out)
+{
+    int    ret;
+    word32 privSz = sizeof(out->priv);
+    word32 pubSz = sizeof(out->pub);
+
+#ifdef HAVE_CURVE25519
+    if (oid == ECC_X25519_OID) {
+        curve25519_key key;
+
+        ret = wc_curve25519_init_ex(&key, heap, INVALID_DEVID);
+        if (ret != 0)
+            return ret;
+        ret = wc_curve25519_make_key(rng, CURVE25519_KEYSIZE, &key);
+        if (ret == 0)
+            ret = wc_curve25519_export_private_raw_ex(&key, out->priv, &privSz,
+                                                      EC25519_BIG_ENDIAN);
+        if (ret == 0)
+            ret = wc_curve25519_export_public_ex(&key, out->pub, &pubSz,
+                                                 EC25519_BIG_ENDIAN);
+        wc_curve25519_free(&key);
+    }
+    else
+#endif
+#ifdef HAVE_CURVE448
+    if (oid == ECC_X448_OID) {
+        curve448_key key;
+
+        ret = wc_curve448_init(&key);
+        if (ret != 0)
+            return ret;
+        ret = wc_curve448_make_key(rng, CURVE448_KEY_SIZE, &key);
+        if (ret == 0)
+            ret = wc_curve448_export_private_raw_ex(&key, out->priv, &privSz,
+                                                    EC448_BIG_ENDIAN);
+        if (ret == 0)
+            ret = wc_curve448_export_public_ex(&key, out->pub, &pubSz,
+                                               EC448_BIG_ENDIAN);
+        wc_curve448_free(&key);
+    }
+    else
+#endif
+    {
+        ecc_key key;
+        int     curveId = wc_ecc_get_oid(oid, NULL, NULL);
+
+        if (curveId < 0)
+            return curveId;
+        ret = wc_ecc_init_ex(&key, heap, INVALID_DEVID);
+        if (ret != 0)
+            return ret;
+        ret = wc_ecc_make_key_ex(rng, wc_ecc_get_curve_size_from_id(curveId),
+                                 &key, curveId);
+        if (ret == 0)
+            ret = wc_ecc_export_private_only(&key, out->priv, &privSz);
+        if (ret == 0)
+            ret = wc_ecc_export_x963(&key, out->pub, &pubSz);
+        wc_ecc_free(&key);
+    }
+
+    if (ret == 0) {
+        out->privSz = (word16)privSz;
+        out->pubSz = (word16)pubSz;
+    }
+
+    return ret;
+}
+
+/* Find the pooled curve, call with the pool lock held */
+static EphKeyCurve* EphKeyPoolFind(EphKeyPool* pool, word32 oid)
+{
+    int i;
+
+    for (i = 0; i < pool->curveCount; i++) {
+        if (pool->curves[i].oid == oid)
+            return &pool->curves[i];
+    }
+
+    return NULL;
+}
+
+/* Start pooling keys for the curve, call with the pool lock held */
+static EphKeyCurve* EphKeyPoolAdd(EphKeyPool* pool, word32 oid)
+{
+    EphKeyCurve* curve;
+
+    if (pool->curveCount == EPH_KEY_POOL_MAX_CURVES)
+        return NULL;
+
+    curve = &pool->curves[pool->curveCount];
+    curve->keys = (EphKey*)XMALLOC(sizeof(EphKey) * pool->depth, pool->heap,
+                                   DYNAMIC_TYPE_PRIVATE_KEY);
+    if (curve->keys == NULL)
+        return NULL;
+    curve->oid = oid;
+    curve->count = 0;
+    pool->curveCount++;
+
+    return curve;
+}
+
+/* Generator thread, refills the curve with the fewest keys until stopped */
+static void* EphKeyPoolWorker(void* arg)
+{
+    EphKeyPool*  pool = (EphKeyPool*)arg;
+    EphKeyCurve* curve;
+    EphKey       key;
+    WC_RNG       rng;
+    word32       oid;
+    int          ret;
+    int          i;
+
+    if (wc_InitRng_ex(&rng, pool->heap, INVALID_DEVID) != 0) {
+        WOLFSSL_MSG("Ephemeral key pool RNG init failed");
+        return NULL;
+    }
+    if (wc_LockMutex(&pool->lock) != 0) {
+        wc_FreeRng(&rng);
+        return NULL;
+    }
+
+    while (!pool->stop) {
+        curve = NULL;
+        for (i = 0; i < pool->curveCount; i++) {
+            if (pool->curves[i].count < pool->depth &&
+                    (curve == NULL || pool->curves[i].count < curve->count)) {
+                curve = &pool->curves[i];
+            }
+        }
+        if (curve == NULL) {
+            if (pthread_cond_wait(&pool->cond, &pool->lock) != 0)
+                break;
+            continue;
+        }
+        oid = curve->oid;
+
+        wc_UnLockMutex(&pool->lock);
+        ret = EphKeyMake(oid, &rng, pool->heap, &key);
+        if (wc_LockMutex(&pool->lock) != 0) {
+            ForceZero(&key, sizeof(key));
+            wc_FreeRng(&rng);
+            return NULL;
+        }
+        if (ret != 0) {
+            /* handshakes make their keys inline from now on */
+            WOLFSSL_MSG("Ephemeral key pool generation failed, stopping");
+            break;
+        }
+
+        curve = EphKeyPoolFind(pool, oid);
+        if (curve != NULL && curve->count < pool->depth) {
+            XMEMCPY(&curve->keys[curve->count], &key, sizeof(key));
+            curve->count++;
+        }
+    }
+
+    wc_UnLockMutex(&pool->lock);
+    ForceZero(&key, sizeof(key));
+    wc_FreeRng(&rng);
+
+    return NULL;
+}
+
+/* Stop the generator thread and wait for it to exit. A pool inherited from a
+ * parent process has no thread in this one. */
+static void EphKeyPoolStop(EphKeyPool* pool)
+{
+    if (pool->tid == 0 || pool->pid != getpid())
+        return;
+
+    if (wc_LockMutex(&pool->lock) == 0) {
+        pool->stop = 1;
+        pthread_cond_signal(&pool->cond);
+        wc_UnLockMutex(&pool->lock);
+    }
+    pthread_join(pool->tid, NULL);
+    pool->tid = 0;
+}
+
+/* Get the CTX pool with a reference held so that a restart or stop of the
+ * pool can't free it while in use. Release with EphKeyPoolRelease(). */
+static EphKeyPool* EphKeyPoolGet(WOLFSSL_CTX* ctx)
+{
+    EphKeyPool* pool = NULL;
+
+    if (ctx->ephKeyPool == NULL || wc_LockMutex(&ctx->countMutex) != 0)
+        return NULL;
+    pool = ctx->ephKeyPool;
+    if (pool != NULL) {
+        if (wc_LockMutex(&pool->lock) == 0) {
+            pool->refCount++;
+            wc_UnLockMutex(&pool->lock);
+        }
+        else {
+            pool = NULL;
+        }
+    }
+    wc_UnLockMutex(&ctx->countMutex);
+
+    return pool;
+}
+
+/* Drop a reference to the pool, the last one zeroizes the keys and frees it */
+static void EphKeyPoolRelease(EphKeyPool* pool)
+{
+    int refCount = 1;
+    int i;
+
+    if (wc_LockMutex(&pool->lock) == 0) {
+        refCount = --pool->refCount;
+        wc_UnLockMutex(&pool->lock);
+    }
+    if (refCount > 0)
+        return;
+
+    for (i = 0; i < pool->curveCount; i++) {
+        ForceZero(pool->curves[i].keys, sizeof(EphKey) * pool->depth);
+        XFREE(pool->curves[i].keys, pool->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+    }
+    pthread_cond_destroy(&pool->cond);
+    wc_FreeMutex(&pool->lock);
+    XFREE(pool, pool->heap, DYNAMIC_TYPE_EPH_KEY_POOL);
+}
+
+/* Zeroize the keys of a pool inherited from a parent process: they were made
+ * for the parent and its generator thread doesn't exist in this process.
+ * Call with the pool lock held. */
+static void EphKeyPoolDrainForked(EphKeyPool* pool)
+{
+    int i;
+
+    for (i = 0; i < pool->curveCount; i++) {
+        ForceZero(pool->curves[i].keys, sizeof(EphKey) * pool->depth);
+        pool->curves[i].count = 0;
+    }
+    pool->stop = 1;
+}
+
+/* Take a key pair for the curve out of the CTX pool. The generator is woken to
+ * replace it, and to start on the curve if it isn't pooled yet.
+ * Returns 1 when a key was taken, 0 when the caller makes its own. */
+static int EphKeyPoolTake(WOLFSSL* ssl, word32 oid, EphKey* key)
+{
+    EphKeyPool*  pool;
+    EphKeyCurve* curve = NULL;
+    int          taken = 0;
+
+    pool = EphKeyPoolGet(ssl->ctx);
+    if (pool == NULL)
+        return 0;
+    if (wc_LockMutex(&pool->lock) != 0) {
+        EphKeyPoolRelease(pool);
+        return 0;
+    }
+
+    /* keys are never shared with a child process */
+    if (pool->pid != getpid())
+        EphKeyPoolDrainForked(pool);
+
+    if (!pool->stop) {
+        curve = EphKeyPoolFind(pool, oid);
+        if (curve == NULL) {
+            curve = EphKeyPoolAdd(pool, oid);
+        }
+        else if (curve->count > 0) {
+            curve->count--;
+            XMEMCPY(key, &curve->keys[curve->count], sizeof(EphKey));
+            ForceZero(&curve->keys[curve->count], sizeof(EphKey));
+            curve->taken++;
+            taken = 1;
+        }
+    }
+    if (curve != NULL)
+        pthread_cond_signal(&pool->cond);
+
+    wc_UnLockMutex(&pool->lock);
+    EphKeyPoolRelease(pool);
+
+    return taken;
+}
+
+/* Get the number of keys ready and taken for a TLS group in the CTX pool.
+ * Returns 0 when the group is pooled, BAD_FUNC_ARG otherwise. */
+int EphKeyPoolStats(WOLFSSL_CTX* ctx, int group, word32* ready, word32* taken)
+{
+    EphKeyPool*  pool;
+    EphKeyCurve* curve = NULL;
+    int          oid = CheckCurveId(group);
+
+    if (oid <= 0)
+        return BAD_FUNC_ARG;
+    pool = EphKeyPoolGet(ctx);
+    if (pool == NULL)
+        return BAD_FUNC_ARG;
+    if (wc_LockMutex(&pool->lock) != 0) {
+        EphKeyPoolRelease(pool);
+        return BAD_MUTEX_E;
+    }
+
+    if (pool->pid != getpid())
+        EphKeyPoolDrainForked(pool);
+    curve = EphKeyPoolFind(pool, (word32)oid);
+    if (curve != NULL) {
+        *ready = curve->count;
+        *taken = curve->taken;
+    }
+
+    wc_UnLockMutex(&pool->lock);
+    EphKeyPoolRelease(pool);
+
+    return (curve != NULL) ? 0 : BAD_FUNC_ARG;
+}
+
+/* Start pooling depth keys for each curve offered by the client: those set
+ * with wolfSSL_CTX_UseSupportedCurve() or else the default groups. Replaces
+ * any pool the CTX already has. */
+int InitEphKeyPool(WOLFSSL_CTX* ctx, word32 depth)
+{
+    EphKeyPool* pool;
+    EphKeyPool* old;
+    TLSX*       ext;
+
+    if (depth == 0 || depth > EPH_KEY_POOL_MAX_DEPTH)
+        return BAD_FUNC_ARG;
+
+    pool = (EphKeyPool*)XMALLOC(sizeof(EphKeyPool), ctx->heap,
+                                DYNAMIC_TYPE_EPH_KEY_POOL);
+    if (pool == NULL)
+        return MEMORY_E;
+    XMEMSET(pool, 0, sizeof(EphKeyPool));
+    pool->depth = depth;
+    pool->refCount = 1;
+    pool->pid = getpid();
+    pool->heap = ctx->heap;
+
+    if (wc_InitMutex(&pool->lock) != 0) {
+        XFREE(pool, ctx->heap, DYNAMIC_TYPE_EPH_KEY_POOL);
+        return BAD_MUTEX_E;
+    }
+    if (pthread_cond_init(&pool->cond, NULL) != 0) {
+        wc_FreeMutex(&pool->lock);
+        XFREE(pool, ctx->heap, DYNAMIC_TYPE_EPH_KEY_POOL);
+        return BAD_COND_E;
+    }
+
+    ext = TLSX_Find(ctx->extensions, TLSX_SUPPORTED_GROUPS);
+    if (ext != NULL) {
+        SupportedCurve* sc;
+
+        for (sc = (SupportedCurve*)ext->data; sc != NULL; sc = sc->next) {
+            int oid = CheckCurveId(sc->name);
+            if (oid > 0 && EphKeyPoolFind(pool, (word32)oid) == NULL)
+                EphKeyPoolAdd(pool, (word32)oid);
+        }
+    }
+    else {
+    #ifdef HAVE_CURVE25519
+        EphKeyPoolAdd(pool, ECC_X25519_OID);
+    #endif
+        EphKeyPoolAdd(pool, ECC_SECP256R1_OID);
+    #ifdef HAVE_CURVE448
+        EphKeyPoolAdd(pool, ECC_X448_OID);
+    #endif
+    }
+
+    if (pthread_create(&pool->tid, NULL, EphKeyPoolWorker, pool) != 0) {
+        WOLFSSL_MSG("Ephemeral key pool thread creation error");
+        EphKeyPoolRelease(pool);
+        return THREAD_CREATE_E;
+    }
+
+    /* install, retiring the previous pool */
+    if (wc_LockMutex(&ctx->countMutex) != 0) {
+        EphKeyPoolStop(pool);
+        EphKeyPoolRelease(pool);
+        return BAD_MUTEX_E;
+    }
+    old = ctx->ephKeyPool;
+    ctx->ephKeyPool = pool;
+    wc_UnLockMutex(&ctx->countMutex);
+
+    if (old != NULL) {
+        EphKeyPoolStop(old);
+        EphKeyPoolRelease(old);
+    }
+
+    return 0;
+}
+
+/* Stop the generator and drop the CTX reference to the pool. Handshakes that
+ * are taking a key keep it alive until they are done. */
+void FreeEphKeyPool(WOLFSSL_CTX* ctx)
+{
+    EphKeyPool* pool;
+
+    if (ctx->ephKeyPool == NULL || wc_LockMutex(&ctx->countMutex) != 0)
+        return;
+    pool = ctx->ephKeyPool;
+    ctx->ephKeyPool = NULL;
+    wc_UnLockMutex(&ctx->countMutex);
+
+    if (pool != NULL) {
+        EphKeyPoolStop(pool);
+        EphKeyPoolRelease(pool);
+    }
+}
+#endif /* WOLFSSL_EPH_KEY_POOL */
+
 int EccMakeKey(WOLFSSL* ssl, ecc_key* key, ecc_key* peer)
 {
     int ret = 0;
     int keySz = 0;
     int ecc_curve = ECC_CURVE_DEF;
+#ifdef WOLFSSL_EPH_KEY_POOL
+    EphKey pooled;
+#endif
 
     WOLFSSL_ENTER("EccMakeKey");
 
@@ -1011,7 +1538,25 @@ int EccMakeKey(WOLFSSL* ssl, ecc_key* key, ecc_key* peer)
         ecc_curve = peer->dp->id;
     }
 
+#ifdef WOLFSSL_EPH_KEY_POOL
+    if (peer != NULL && peer->dp != NULL &&
+    #ifdef WC_ECC_NONBLOCK
+            key->nb_ctx == NULL &&  /* not resuming a sliced key generation */
+    #endif
+            EphKeyPoolTake(ssl, peer->dp->oidSum, &pooled)) {
+        ret = wc_ecc_import_private_key_ex(pooled.priv, pooled.privSz,
+                                pooled.pub, pooled.pubSz, key, ecc_curve);
+        ForceZero(&pooled, sizeof(pooled));
+    }
+    else
+#endif
     {
+#ifdef WC_ECC_NONBLOCK
+        ret = EccNonBlockStart(ssl, key);
+        if (ret != 0) {
+            return ret;
+        }
+#endif
         ret = wc_ecc_make_key_ex(ssl->rng, keySz, key, ecc_curve);
     }
 
@@ -1022,12 +1567,129 @@ int EccMakeKey(WOLFSSL* ssl, ecc_key* key, ecc_key* peer)
     }
 
     /* Handle async pending response */
+#ifdef WC_ECC_NONBLOCK
+    ret = EccNonBlockDone(ssl, key, ret);
+#endif
 
     WOLFSSL_LEAVE("EccMakeKey", ret);
 
     return ret;
 }
 
+#ifdef HAVE_CURVE25519
+int X25519SharedSecret(WOLFSSL* ssl, curve25519_key* priv_key,
+        curve25519_key* pub_key, byte* pubKeyDer, word32* pubKeySz,
+        byte* out, word32* outlen, int side)
+{
+    int ret;
+
+    (void)ssl;
+    (void)pubKeyDer;
+    (void)pubKeySz;
+    (void)side;
+
+    WOLFSSL_ENTER("X25519SharedSecret");
+
+    ret = wc_curve25519_shared_secret_ex(priv_key, pub_key, out, outlen,
+                                         EC25519_LITTLE_ENDIAN);
+
+    WOLFSSL_LEAVE("X25519SharedSecret", ret);
+
+    return ret;
+}
+
+int X25519MakeKey(WOLFSSL* ssl, curve25519_key* key, curve25519_key* peer)
+{
+    int ret;
+#ifdef WOLFSSL_EPH_KEY_POOL
+    EphKey pooled;
+#endif
+
+    (void)peer;
+
+    WOLFSSL_ENTER("X25519MakeKey");
+
+#ifdef WOLFSSL_EPH_KEY_POOL
+    if (EphKeyPoolTake(ssl, ECC_X25519_OID, &pooled)) {
+        ret = wc_curve25519_import_private_raw_ex(pooled.priv, pooled.privSz,
+                        pooled.pub, pooled.pubSz, key, EC25519_BIG_ENDIAN);
+        ForceZero(&pooled, sizeof(pooled));
+    }
+    else
+#endif
+    {
+        ret = wc_curve25519_make_key(ssl->rng, CURVE25519_KEYSIZE, key);
+    }
+
+    /* make sure the curve is set for TLS */
+    if (ret == 0) {
+        ssl->ecdhCurveOID = ECC_X25519_OID;
+        ssl->namedGroup = 0;
+    }
+
+    WOLFSSL_LEAVE("X25519MakeKey", ret);
+
+    return ret;
+}
+#endif /* HAVE_CURVE25519 */
+
+#ifdef HAVE_CURVE448
+int X448SharedSecret(WOLFSSL* ssl, curve448_key* priv_key,
+        curve448_key* pub_key, byte* pubKeyDer, word32* pubKeySz,
+        byte* out, word32* outlen, int side)
+{
+    int ret;
+
+    (void)ssl;
+    (void)pubKeyDer;
+    (void)pubKeySz;
+    (void)side;
+
+    WOLFSSL_ENTER("X448SharedSecret");
+
+    ret = wc_curve448_shared_secret_ex(priv_key, pub_key, out, outlen,
+                                       EC448_LITTLE_ENDIAN);
+
+    WOLFSSL_LEAVE("X448SharedSecret", ret);
+
+    return ret;
+}
+
+int X448MakeKey(WOLFSSL* ssl, curve448_key* key, curve448_key* peer)
+{
+    int ret;
+#ifdef WOLFSSL_EPH_KEY_POOL
+    EphKey pooled;
+#endif
+
+    (void)peer;
+
+    WOLFSSL_ENTER("X448MakeKey");
+
+#ifdef WOLFSSL_EPH_KEY_POOL
+    if (EphKeyPoolTake(ssl, ECC_X448_OID, &pooled)) {
+        ret = wc_curve448_import_private_raw_ex(pooled.priv, pooled.privSz,
+                        pooled.pub, pooled.pubSz, key, EC448_BIG_ENDIAN);
+        ForceZero(&pooled, sizeof(pooled));
+    }
+    else
+#endif
+    {
+        ret = wc_curve448_make_key(ssl->rng, CURVE448_KEY_SIZE, key);
+    }
+
+    /* make sure the curve is set for TLS */
+    if (ret == 0) {
+        ssl->ecdhCurveOID = ECC_X448_OID;
+        ssl->namedGroup = 0;
+    }
+
+    WOLFSSL_LEAVE("X448MakeKey", ret);
+
+    return ret;
+}
+#endif /* HAVE_CURVE448 */
+
 
 
 
@@ -1234,6 +1896,9 @@ int SetSSL_CTX(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
         ssl->version = ctx->method->version;
 
     ssl->eccTempKeySz = ctx->eccTempKeySz;
+#ifdef WC_ECC_NONBLOCK
+    ssl->eccNbSteps = ctx->eccNbSteps;
+#endif
     ssl->ecdhCurveOID = ctx->ecdhCurveOID;
     ssl->pkCurveOID = ctx->pkCurveOID;
 
@@ -1573,6 +2238,16 @@ void FreeKey(WOLFSSL* ssl, int type, void** pKey)
             case DYNAMIC_TYPE_DH:
                 wc_FreeDhKey((DhKey*)*pKey);
                 break;
+        #ifdef HAVE_CURVE25519
+            case DYNAMIC_TYPE_CURVE25519:
+                wc_curve25519_free((curve25519_key*)*pKey);
+                break;
+        #endif
+        #ifdef HAVE_CURVE448
+            case DYNAMIC_TYPE_CURVE448:
+                wc_curve448_free((curve448_key*)*pKey);
+                break;
+        #endif
             default:
                 break;
         }
@@ -1609,6 +2284,16 @@ int AllocKey(WOLFSSL* ssl, int type, void** pKey)
         case DYNAMIC_TYPE_DH:
             sz = sizeof(DhKey);
             break;
+    #ifdef HAVE_CURVE25519
+        case DYNAMIC_TYPE_CURVE25519:
+            sz = sizeof(curve25519_key);
+            break;
+    #endif
+    #ifdef HAVE_CURVE448
+        case DYNAMIC_TYPE_CURVE448:
+            sz = sizeof(curve448_key);
+            break;
+    #endif
         default:
             return BAD_FUNC_ARG;
     }
@@ -1630,6 +2315,18 @@ int AllocKey(WOLFSSL* ssl, int type, void** pKey)
         case DYNAMIC_TYPE_DH:
             ret = wc_InitDhKey_ex((DhKey*)*pKey, ssl->heap, ssl->devId);
             break;
+    #ifdef HAVE_CURVE25519
+        case DYNAMIC_TYPE_CURVE25519:
+            ret = wc_curve25519_init_ex((curve25519_key*)*pKey, ssl->heap,
+                                        ssl->devId);
+            break;
+    #endif
+    #ifdef HAVE_CURVE448
+        case DYNAMIC_TYPE_CURVE448:
+            ret = wc_curve448_init_ex((curve448_key*)*pKey, ssl->heap,
+                                      ssl->devId);
+            break;
+    #endif
         default:
             return BAD_FUNC_ARG;
     }
@@ -1661,6 +2358,20 @@ static int ReuseKey(WOLFSSL* ssl, int type, void* pKey)
             wc_FreeDhKey((DhKey*)pKey);
             ret = wc_InitDhKey_ex((DhKey*)pKey, ssl->heap, ssl->devId);
             break;
+    #ifdef HAVE_CURVE25519
+        case DYNAMIC_TYPE_CURVE25519:
+            wc_curve25519_free((curve25519_key*)pKey);
+            ret = wc_curve25519_init_ex((curve25519_key*)pKey, ssl->heap,
+                                        ssl->devId);
+            break;
+    #endif
+    #ifdef HAVE_CURVE448
+        case DYNAMIC_TYPE_CURVE448:
+            wc_curve448_free((curve448_key*)pKey);
+            ret = wc_curve448_init_ex((curve448_key*)pKey, ssl->heap,
+                                      ssl->devId);
+            break;
+    #endif
         default:
             return BAD_FUNC_ARG;
     }
@@ -1761,6 +2472,14 @@ void SSL_ResourceFree(WOLFSSL* ssl)
     ssl->peerEccKeyPresent = 0;
     FreeKey(ssl, DYNAMIC_TYPE_ECC, (void**)&ssl->peerEccDsaKey);
     ssl->peerEccDsaKeyPresent = 0;
+#ifdef HAVE_CURVE25519
+    FreeKey(ssl, DYNAMIC_TYPE_CURVE25519, (void**)&ssl->peerX25519Key);
+    ssl->peerX25519KeyPresent = 0;
+#endif
+#ifdef HAVE_CURVE448
+    FreeKey(ssl, DYNAMIC_TYPE_CURVE448, (void**)&ssl->peerX448Key);
+    ssl->peerX448KeyPresent = 0;
+#endif
     {
         int dtype = 0;
         dtype = DYNAMIC_TYPE_ECC;
@@ -1768,6 +2487,10 @@ void SSL_ResourceFree(WOLFSSL* ssl)
         ssl->eccTempKeyPresent = 0;
     }
     TLSX_FreeAll(ssl->extensions, ssl->heap);
+#ifdef WC_ECC_NONBLOCK
+    /* after the keys as they may reference the ECC non-blocking context */
+    FreeNonBlock(ssl);
+#endif
 
 #ifdef HAVE_ALPN
     if (ssl->alpn_client_list != NULL) {
@@ -1839,6 +2562,14 @@ void FreeHandshakeResources(WOLFSSL* ssl)
 
     FreeKey(ssl, DYNAMIC_TYPE_ECC, (void**)&ssl->peerEccKey);
     ssl->peerEccKeyPresent = 0;
+#ifdef HAVE_CURVE25519
+    FreeKey(ssl, DYNAMIC_TYPE_CURVE25519, (void**)&ssl->peerX25519Key);
+    ssl->peerX25519KeyPresent = 0;
+#endif
+#ifdef HAVE_CURVE448
+    FreeKey(ssl, DYNAMIC_TYPE_CURVE448, (void**)&ssl->peerX448Key);
+    ssl->peerX448KeyPresent = 0;
+#endif
     {
         int dtype;
         dtype = DYNAMIC_TYPE_ECC;
@@ -3540,6 +4271,9 @@ static int ProcessPeerCertParse(WOLFSSL* ssl, ProcPeerCertArgs* args,
 
         args->dCertInit = 1;
         args->dCert->sigCtx.devId = ssl->devId;
+    #ifdef WOLFSSL_LAZY_CERT_DECODE
+        args->dCert->decodeLazy = 1;
+    #endif
 
     }
 
@@ -3798,6 +4532,28 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                             "not adding as CA");
                     }
                     else if (ret == 0) {
+                    #ifdef HAVE_OCSP
+                        if (SSL_CM(ssl)->ocspEnabled &&
+                                SSL_CM(ssl)->ocspCheckAll) {
+                            WOLFSSL_MSG("Doing Non Leaf OCSP check");
+                            ret = CheckCertOCSP_ex(SSL_CM(ssl)->ocsp,
+                                                   args->dCert, ssl);
+                            if (ret != 0) {
+                                WOLFSSL_MSG("\tOCSP Lookup not ok");
+                            }
+                        }
+                    #endif /* HAVE_OCSP */
+
+                    #ifdef HAVE_CRL
+                        if (ret == 0 && SSL_CM(ssl)->crlEnabled &&
+                                SSL_CM(ssl)->crlCheckAll) {
+                            WOLFSSL_MSG("Doing Non Leaf CRL check");
+                            ret = CheckCertCRL(SSL_CM(ssl)->crl, args->dCert);
+                            if (ret != 0) {
+                                WOLFSSL_MSG("\tCRL check not ok");
+                            }
+                        }
+                    #endif /* HAVE_CRL */
 
                         if (alreadySigner) {
                             WOLFSSL_MSG("Verified CA from chain and already had it");
@@ -3948,9 +4704,62 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         case TLS_ASYNC_VERIFY:
         {
             if (args->count > 0) {
+            #if defined(HAVE_OCSP) || defined(HAVE_CRL)
+                if (args->fatal == 0) {
+                    int doLookup = 1;
+
+                #ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+                    if (ssl->status_request) {
+                        /* status comes in CertificateStatus, checked there */
+                        args->fatal = (TLSX_CSR_InitRequest(ssl->extensions,
+                                                args->dCert, ssl->heap) != 0);
+                        doLookup = 0;
+                        WOLFSSL_MSG("\tHave status request");
+                    }
+                    else if (SSL_CM(ssl)->ocspMustStaple) {
+                        WOLFSSL_MSG("\tServer didn't agree to staple");
+                        ret = BAD_CERTIFICATE_STATUS_ERROR;
+                        doLookup = 0;
+                    }
+                #endif /* HAVE_CERTIFICATE_STATUS_REQUEST */
+
+                #ifdef HAVE_OCSP
+                    if (doLookup && SSL_CM(ssl)->ocspEnabled) {
+                        WOLFSSL_MSG("Doing Leaf OCSP check");
+                        ret = CheckCertOCSP_ex(SSL_CM(ssl)->ocsp, args->dCert,
+                                               ssl);
+                        /* a CRL may still know the cert */
+                        doLookup = (ret == OCSP_CERT_UNKNOWN);
+                        if (ret != 0) {
+                            WOLFSSL_MSG("\tOCSP Lookup not ok");
+                            args->fatal = 0;
+                        }
+                    }
+                #endif /* HAVE_OCSP */
 
+                #ifdef HAVE_CRL
+                    if (doLookup && SSL_CM(ssl)->crlEnabled) {
+                        WOLFSSL_MSG("Doing Leaf CRL check");
+                        ret = CheckCertCRL(SSL_CM(ssl)->crl, args->dCert);
+                        if (ret != 0) {
+                            WOLFSSL_MSG("\tCRL check not ok");
+                            args->fatal = 0;
+                        }
+                    }
+                #endif /* HAVE_CRL */
+                    (void)doLookup;
+                }
+            #endif /* HAVE_OCSP || HAVE_CRL */
 
             #ifndef IGNORE_KEY_EXTENSIONS
+            #ifdef WOLFSSL_LAZY_CERT_DECODE
+                {
+                    int decRet = DecodeCertDeferred(args->dCert,
+                                                    EXT_KEY_USAGE_OID);
+                    if (decRet != 0)
+                        ret = decRet;
+                }
+            #endif
                 if (args->dCert->extKeyUsageSet) {
                     if ((ssl->specs.kea == rsa_kea) &&
                         (ssl->options.side == WOLFSSL_CLIENT_END) &&
@@ -4004,6 +4813,11 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
 
 
                 if (!ssl->options.verifyNone && ssl->buffers.domainName.buffer) {
+                #ifdef WOLFSSL_LAZY_CERT_DECODE
+                    int decRet = DecodeCertDeferred(args->dCert, ALT_NAMES_OID);
+                    if (decRet != 0)
+                        ret = decRet;
+                #endif
                 #ifndef WOLFSSL_ALLOW_NO_CN_IN_SAN
                     /* Per RFC 5280 section 4.2.1.6, "Whenever such identities
                      * are to be bound into a certificate, the subject
@@ -4259,6 +5073,30 @@ static int DoCertificate(WOLFSSL* ssl, byte* input, word32* inOutIdx,
     return ret;
 }
 
+#ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+/* Check the stapled OCSPResponse against the request made from the server's
+ * certificate. A response seen before is answered from the OCSP cache. */
+static int ProcessCSR(WOLFSSL* ssl, const byte* input, word32 length)
+{
+    OcspRequest* request;
+    int          ret;
+
+    request = (OcspRequest*)TLSX_CSR_GetRequest(ssl->extensions);
+    if (!ssl->status_request || request == NULL || request->serial == NULL ||
+                                                     SSL_CM(ssl)->ocsp == NULL)
+        return BAD_CERTIFICATE_STATUS_ERROR;
+
+    if (length == 0)
+        return BUFFER_ERROR;
+
+    ret = CheckOcspResponse(SSL_CM(ssl)->ocsp, input, (int)length, request);
+    if (ret != 0 && ret != OCSP_CERT_REVOKED)
+        ret = BAD_CERTIFICATE_STATUS_ERROR;
+
+    return ret;
+}
+#endif /* HAVE_CERTIFICATE_STATUS_REQUEST */
+
 /* handle processing of certificate_status (22) */
 static int DoCertificateStatus(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                                                                     word32 size)
@@ -4283,7 +5121,12 @@ static int DoCertificateStatus(WOLFSSL* ssl, byte* input, word32* inOutIdx,
 
     switch (status_type) {
 
-
+    #ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+        case WOLFSSL_CSR_OCSP:
+            ret = ProcessCSR(ssl, input + *inOutIdx, status_length);
+            *inOutIdx += status_length;
+            break;
+    #endif
 
         default:
             ret = BUFFER_ERROR;
@@ -4509,6 +5352,15 @@ static int SanityCheckMsgReceived(WOLFSSL* ssl, byte type)
                 return OUT_OF_ORDER_E;
             }
             if (ssl->msgsReceived.got_certificate_status == 0) {
+            #ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+                if (ssl->status_request) {
+                    int ret;
+
+                    WOLFSSL_MSG("No CertificateStatus before ServerKeyExchange");
+                    if ((ret = TLSX_CSR_ForceRequest(ssl)) != 0)
+                        return ret;
+                }
+            #endif
             }
 
             break;
@@ -4551,6 +5403,17 @@ static int SanityCheckMsgReceived(WOLFSSL* ssl, byte type)
                     WOLFSSL_MSG("No ServerKeyExchange before ServerDone");
                     return OUT_OF_ORDER_E;
                 }
+
+            #ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+                if (ssl->msgsReceived.got_certificate_status == 0 &&
+                                                        ssl->status_request) {
+                    int ret;
+
+                    WOLFSSL_MSG("No CertificateStatus before ServerDone");
+                    if ((ret = TLSX_CSR_ForceRequest(ssl)) != 0)
+                        return ret;
+                }
+            #endif
             }
             break;
 
@@ -4667,6 +5530,10 @@ static int DoHandShakeMsgType(WOLFSSL* ssl, byte* input, word32* inOutIdx,
     /* Also, skip hashing the client_hello message here for DTLS. It will be
      * hashed later if the DTLS cookie is correct. */
     if (type != hello_request
+    #ifdef WC_ECC_NONBLOCK
+            /* already hashed when the message was first processed */
+            && ssl->error != WC_PENDING_E
+    #endif
     ) {
         ret = HashInput(ssl, input + *inOutIdx, size);
         if (ret != 0) {
@@ -4785,7 +5652,16 @@ static int DoHandShakeMsgType(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         }
     }
 
-
+#ifdef WC_ECC_NONBLOCK
+    /* if pending, offset index so this msg will be processed again */
+    if (ret == WC_PENDING_E && *inOutIdx >= HANDSHAKE_HEADER_SZ) {
+        *inOutIdx -= HANDSHAKE_HEADER_SZ;
+    }
+    /* make sure pending error is cleared */
+    if (ret == 0 && ssl->error == WC_PENDING_E) {
+        ssl->error = 0;
+    }
+#endif
 
     WOLFSSL_LEAVE("DoHandShakeMsgType()", ret);
     return ret;
@@ -4875,6 +5751,14 @@ static int DoHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                                      &idx, ssl->arrays->pendingMsgType,
                                      ssl->arrays->pendingMsgSz - idx,
                                      ssl->arrays->pendingMsgSz);
+        #ifdef WC_ECC_NONBLOCK
+            if (ret == WC_PENDING_E) {
+                /* setup to process fragment again */
+                ssl->arrays->pendingMsgOffset -= inputLength;
+                *inOutIdx -= inputLength;
+            }
+            else
+        #endif
             {
                 XFREE(ssl->arrays->pendingMsg, ssl->heap, DYNAMIC_TYPE_ARRAYS);
                 ssl->arrays->pendingMsg = NULL;
@@ -5874,6 +6758,9 @@ int ProcessReplyEx(WOLFSSL* ssl, int allowSocketErr)
 
 
     if (ssl->error != 0 && ssl->error != WANT_READ && ssl->error != WANT_WRITE
+    #ifdef WC_ECC_NONBLOCK
+        && ssl->error != WC_PENDING_E
+    #endif
         && (allowSocketErr != 1 || ssl->error != SOCKET_ERROR_E)
     ) {
         WOLFSSL_MSG("ProcessReply retry in error state, not allowed");
@@ -9017,9 +9904,15 @@ exit_dpk:
     #if ECC_MIN_KEY_SZ <= 256
             case WOLFSSL_ECC_SECP256R1: return ECC_SECP256R1_OID;
     #endif
+    #if defined(HAVE_CURVE25519) && ECC_MIN_KEY_SZ <= 256
+            case WOLFSSL_ECC_X25519: return ECC_X25519_OID;
+    #endif
     #if ECC_MIN_KEY_SZ <= 384
             case WOLFSSL_ECC_SECP384R1: return ECC_SECP384R1_OID;
     #endif
+    #if defined(HAVE_CURVE448) && ECC_MIN_KEY_SZ <= 448
+            case WOLFSSL_ECC_X448: return ECC_X448_OID;
+    #endif
     #if ECC_MIN_KEY_SZ <= 521
             case WOLFSSL_ECC_SECP521R1: return ECC_SECP521R1_OID;
     #endif
@@ -9308,6 +10201,13 @@ static int DoServerKeyExchange(WOLFSSL* ssl, const byte* input,
     WOLFSSL_START(WC_FUNC_SERVER_KEY_EXCHANGE_DO);
     WOLFSSL_ENTER("DoServerKeyExchange");
 
+#ifdef WC_ECC_NONBLOCK
+    WOLFSSL_ASSERT_SIZEOF_GE(ssl->nonblock->args, DskeArgs);
+    if (RestoreNonBlockArgs(ssl, args, sizeof(DskeArgs), FreeDskeArgs)) {
+        /* resume pending signature verify at saved state */
+    }
+    else
+#endif
     {
         /* Reset state */
         ret = 0;
@@ -9363,6 +10263,83 @@ static int DoServerKeyExchange(WOLFSSL* ssl, const byte* input,
                         ERROR_OUT(BUFFER_ERROR, exit_dske);
                     }
 
+                #ifdef HAVE_CURVE25519
+                    if (ssl->ecdhCurveOID == ECC_X25519_OID) {
+                        if (ssl->peerX25519Key == NULL) {
+                            ret = AllocKey(ssl, DYNAMIC_TYPE_CURVE25519,
+                                           (void**)&ssl->peerX25519Key);
+                            if (ret != 0) {
+                                goto exit_dske;
+                            }
+                        } else if (ssl->peerX25519KeyPresent) {
+                            ret = ReuseKey(ssl, DYNAMIC_TYPE_CURVE25519,
+                                           ssl->peerX25519Key);
+                            ssl->peerX25519KeyPresent = 0;
+                            if (ret != 0) {
+                                goto exit_dske;
+                            }
+                        }
+
+                        if ((ret = wc_curve25519_check_public(
+                                input + args->idx, length,
+                                EC25519_LITTLE_ENDIAN)) != 0) {
+                            if (ret == BUFFER_E)
+                                SendAlert(ssl, alert_fatal, decode_error);
+                            else
+                                SendAlert(ssl, alert_fatal, illegal_parameter);
+                            ERROR_OUT(ECC_PEERKEY_ERROR, exit_dske);
+                        }
+
+                        if (wc_curve25519_import_public_ex(input + args->idx,
+                                length, ssl->peerX25519Key,
+                                EC25519_LITTLE_ENDIAN) != 0) {
+                            ERROR_OUT(ECC_PEERKEY_ERROR, exit_dske);
+                        }
+
+                        args->idx += length;
+                        ssl->peerX25519KeyPresent = 1;
+                        break;
+                    }
+                #endif
+                #ifdef HAVE_CURVE448
+                    if (ssl->ecdhCurveOID == ECC_X448_OID) {
+                        if (ssl->peerX448Key == NULL) {
+                            ret = AllocKey(ssl, DYNAMIC_TYPE_CURVE448,
+                                           (void**)&ssl->peerX448Key);
+                            if (ret != 0) {
+                                goto exit_dske;
+                            }
+                        } else if (ssl->peerX448KeyPresent) {
+                            ret = ReuseKey(ssl, DYNAMIC_TYPE_CURVE448,
+                                           ssl->peerX448Key);
+                            ssl->peerX448KeyPresent = 0;
+                            if (ret != 0) {
+                                goto exit_dske;
+                            }
+                        }
+
+                        if ((ret = wc_curve448_check_public(
+                                input + args->idx, length,
+                                EC448_LITTLE_ENDIAN)) != 0) {
+                            if (ret == BUFFER_E)
+                                SendAlert(ssl, alert_fatal, decode_error);
+                            else
+                                SendAlert(ssl, alert_fatal, illegal_parameter);
+                            ERROR_OUT(ECC_PEERKEY_ERROR, exit_dske);
+                        }
+
+                        if (wc_curve448_import_public_ex(input + args->idx,
+                                length, ssl->peerX448Key,
+                                EC448_LITTLE_ENDIAN) != 0) {
+                            ERROR_OUT(ECC_PEERKEY_ERROR, exit_dske);
+                        }
+
+                        args->idx += length;
+                        ssl->peerX448KeyPresent = 1;
+                        break;
+                    }
+                #endif
+
                     if (ssl->peerEccKey == NULL) {
                         ret = AllocKey(ssl, DYNAMIC_TYPE_ECC,
                                        (void**)&ssl->peerEccKey);
@@ -9621,6 +10598,9 @@ static int DoServerKeyExchange(WOLFSSL* ssl, const byte* input,
                                 NULL
                             );
 
+                        #ifdef WC_ECC_NONBLOCK
+                            if (ret != WC_PENDING_E)
+                        #endif
                             {
                                 /* peerEccDsaKey */
                                 FreeKey(ssl, DYNAMIC_TYPE_ECC,
@@ -9769,6 +10749,18 @@ exit_dske:
     WOLFSSL_LEAVE("DoServerKeyExchange", ret);
     WOLFSSL_END(WC_FUNC_SERVER_KEY_EXCHANGE_DO);
 
+#ifdef WC_ECC_NONBLOCK
+    /* Handle pending operation */
+    if (ret == WC_PENDING_E) {
+        ret = SaveNonBlockArgs(ssl, args, sizeof(DskeArgs), FreeDskeArgs);
+        if (ret == WC_PENDING_E) {
+            /* Mark message as not received so it can process again */
+            ssl->msgsReceived.got_server_key_exchange = 0;
+
+            return ret;
+        }
+    }
+#endif
 
     /* Final cleanup */
     FreeDskeArgs(ssl, args);
@@ -9812,7 +10804,13 @@ int SendClientKeyExchange(WOLFSSL* ssl)
     WOLFSSL_START(WC_FUNC_CLIENT_KEY_EXCHANGE_SEND);
     WOLFSSL_ENTER("SendClientKeyExchange");
 
-
+#ifdef WC_ECC_NONBLOCK
+    WOLFSSL_ASSERT_SIZEOF_GE(ssl->nonblock->args, SckeArgs);
+    if (RestoreNonBlockArgs(ssl, args, sizeof(SckeArgs), FreeSckeArgs)) {
+        /* resume pending key generation or agreement at saved state */
+    }
+    else
+#endif
     {
         /* Reset state */
         ret = 0;
@@ -9842,6 +10840,42 @@ int SendClientKeyExchange(WOLFSSL* ssl)
                 {
                     ecc_key* peerKey;
 
+                #ifdef HAVE_CURVE25519
+                    if (ssl->peerX25519KeyPresent) {
+                        if (!ssl->peerX25519Key) {
+                            ERROR_OUT(NO_PEER_KEY, exit_scke);
+                        }
+
+                        /* create ephemeral private key */
+                        ssl->hsType = DYNAMIC_TYPE_CURVE25519;
+                        ret = AllocKey(ssl, ssl->hsType, &ssl->hsKey);
+                        if (ret != 0) {
+                            goto exit_scke;
+                        }
+
+                        ret = X25519MakeKey(ssl, (curve25519_key*)ssl->hsKey,
+                                            ssl->peerX25519Key);
+                        break;
+                    }
+                #endif
+                #ifdef HAVE_CURVE448
+                    if (ssl->peerX448KeyPresent) {
+                        if (!ssl->peerX448Key) {
+                            ERROR_OUT(NO_PEER_KEY, exit_scke);
+                        }
+
+                        /* create ephemeral private key */
+                        ssl->hsType = DYNAMIC_TYPE_CURVE448;
+                        ret = AllocKey(ssl, ssl->hsType, &ssl->hsKey);
+                        if (ret != 0) {
+                            goto exit_scke;
+                        }
+
+                        ret = X448MakeKey(ssl, (curve448_key*)ssl->hsKey,
+                                          ssl->peerX448Key);
+                        break;
+                    }
+                #endif
 
                     if (ssl->specs.static_ecdh) {
                         /* Note: EccDsa is really fixed Ecc key here */
@@ -9862,9 +10896,15 @@ int SendClientKeyExchange(WOLFSSL* ssl)
 
                     /* create ephemeral private key */
                     ssl->hsType = DYNAMIC_TYPE_ECC;
-                    ret = AllocKey(ssl, ssl->hsType, &ssl->hsKey);
-                    if (ret != 0) {
-                        goto exit_scke;
+                #ifdef WC_ECC_NONBLOCK
+                    /* key is already allocated when resuming key generation */
+                    if (ssl->hsKey == NULL)
+                #endif
+                    {
+                        ret = AllocKey(ssl, ssl->hsType, &ssl->hsKey);
+                        if (ret != 0) {
+                            goto exit_scke;
+                        }
                     }
 
                     ret = EccMakeKey(ssl, (ecc_key*)ssl->hsKey, peerKey);
@@ -9990,6 +11030,30 @@ int SendClientKeyExchange(WOLFSSL* ssl)
                 {
                     ssl->arrays->preMasterSz = ENCRYPT_LEN;
 
+                #ifdef HAVE_CURVE25519
+                    if (ssl->ecdhCurveOID == ECC_X25519_OID) {
+                        ret = wc_curve25519_export_public_ex(
+                                (curve25519_key*)ssl->hsKey,
+                                args->encSecret + OPAQUE8_LEN, &args->encSz,
+                                EC25519_LITTLE_ENDIAN);
+                        if (ret != 0) {
+                            ERROR_OUT(ECC_EXPORT_ERROR, exit_scke);
+                        }
+                        break;
+                    }
+                #endif
+                #ifdef HAVE_CURVE448
+                    if (ssl->ecdhCurveOID == ECC_X448_OID) {
+                        ret = wc_curve448_export_public_ex(
+                                (curve448_key*)ssl->hsKey,
+                                args->encSecret + OPAQUE8_LEN, &args->encSz,
+                                EC448_LITTLE_ENDIAN);
+                        if (ret != 0) {
+                            ERROR_OUT(ECC_EXPORT_ERROR, exit_scke);
+                        }
+                        break;
+                    }
+                #endif
 
                     /* Place ECC key in buffer, leaving room for size */
                     PRIVATE_KEY_UNLOCK();
@@ -10047,6 +11111,41 @@ int SendClientKeyExchange(WOLFSSL* ssl)
                 {
                     ecc_key* peerKey;
 
+                #ifdef HAVE_CURVE25519
+                    if (ssl->peerX25519KeyPresent) {
+                        ret = X25519SharedSecret(ssl,
+                            (curve25519_key*)ssl->hsKey, ssl->peerX25519Key,
+                            args->encSecret + OPAQUE8_LEN, &args->encSz,
+                            ssl->arrays->preMasterSecret,
+                            &ssl->arrays->preMasterSz,
+                            WOLFSSL_CLIENT_END
+                        );
+                        if (!ssl->options.keepResources) {
+                            FreeKey(ssl, DYNAMIC_TYPE_CURVE25519,
+                                                   (void**)&ssl->peerX25519Key);
+                            ssl->peerX25519KeyPresent = 0;
+                        }
+                        break;
+                    }
+                #endif
+                #ifdef HAVE_CURVE448
+                    if (ssl->peerX448KeyPresent) {
+                        ret = X448SharedSecret(ssl,
+                            (curve448_key*)ssl->hsKey, ssl->peerX448Key,
+                            args->encSecret + OPAQUE8_LEN, &args->encSz,
+                            ssl->arrays->preMasterSecret,
+                            &ssl->arrays->preMasterSz,
+                            WOLFSSL_CLIENT_END
+                        );
+                        if (!ssl->options.keepResources) {
+                            FreeKey(ssl, DYNAMIC_TYPE_CURVE448,
+                                                     (void**)&ssl->peerX448Key);
+                            ssl->peerX448KeyPresent = 0;
+                        }
+                        break;
+                    }
+                #endif
+
                     peerKey = (ssl->specs.static_ecdh) ?
                               ssl->peerEccDsaKey : ssl->peerEccKey;
 
@@ -10074,6 +11173,12 @@ int SendClientKeyExchange(WOLFSSL* ssl)
                         WOLFSSL_CLIENT_END
                     );
 
+                #ifdef WC_ECC_NONBLOCK
+                    if (ret == WC_PENDING_E) {
+                        break;
+                    }
+                #endif
+
                     fabio_print("PRE-MASTER SECRET",
                         ssl->arrays->preMasterSecret,
                         ssl->arrays->preMasterSz);
@@ -10243,6 +11348,15 @@ exit_scke:
     WOLFSSL_LEAVE("SendClientKeyExchange", ret);
     WOLFSSL_END(WC_FUNC_CLIENT_KEY_EXCHANGE_SEND);
 
+#ifdef WC_ECC_NONBLOCK
+    /* Handle pending operation, keeping the pre-master secret and keys */
+    if (ret == WC_PENDING_E) {
+        ret = SaveNonBlockArgs(ssl, args, sizeof(SckeArgs), FreeSckeArgs);
+        if (ret == WC_PENDING_E) {
+            return ret;
+        }
+    }
+#endif
 
     // Fabio
     fabio_print("PRE-MASTER SECRET", ssl->arrays->preMasterSecret, ssl->arrays->preMasterSz);
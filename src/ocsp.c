@@ -29,8 +29,477 @@
 #include <wolfssl/wolfcrypt/settings.h>
 
 #ifndef WOLFCRYPT_ONLY
+#ifdef HAVE_OCSP
 
+#include <wolfssl/internal.h>
+#include <wolfssl/error-ssl.h>
+#include <wolfssl/ocsp.h>
 
 
+/* Initialize OCSP members */
+int InitOCSP(WOLFSSL_OCSP* ocsp, WOLFSSL_CERT_MANAGER* cm)
+{
+    WOLFSSL_ENTER("InitOCSP");
 
+    ocsp->cm = cm;
+    ocsp->ocspList = NULL;
+    if (wc_InitMutex(&ocsp->ocspLock) != 0) {
+        WOLFSSL_MSG("Init Mutex failed");
+        return BAD_MUTEX_E;
+    }
+
+    return 0;
+}
+
+
+/* Free an issuer entry and all of its cached statuses */
+static void FreeOcspEntry(OcspEntry* entry, void* heap)
+{
+    CertStatus* status;
+    CertStatus* next;
+
+    WOLFSSL_ENTER("FreeOcspEntry");
+
+    for (status = entry->status; status != NULL; status = next) {
+        next = status->next;
+        XFREE(status, heap, DYNAMIC_TYPE_OCSP_STATUS);
+    }
+
+    XFREE(entry, heap, DYNAMIC_TYPE_OCSP_ENTRY);
+    (void)heap;
+}
+
+
+void FreeOCSP(WOLFSSL_OCSP* ocsp, int dynamic)
+{
+    OcspEntry* entry;
+    OcspEntry* next;
+    void*      heap = ocsp->cm != NULL ? ocsp->cm->heap : NULL;
+
+    WOLFSSL_ENTER("FreeOCSP");
+
+    for (entry = ocsp->ocspList; entry != NULL; entry = next) {
+        next = entry->next;
+        FreeOcspEntry(entry, heap);
+    }
+
+    wc_FreeMutex(&ocsp->ocspLock);
+
+    if (dynamic)   /* free self */
+        XFREE(ocsp, heap, DYNAMIC_TYPE_OCSP);
+}
+
+
+/* map a cert status to the error returned for the certificate */
+static int xstat2err(int st)
+{
+    switch (st) {
+        case CERT_GOOD:
+            return 0;
+        case CERT_REVOKED:
+            return OCSP_CERT_REVOKED;
+        default:
+            return OCSP_CERT_UNKNOWN;
+    }
+}
+
+
+/* A cached status is used until its nextUpdate. Without a clock it can't be
+ * known when the status goes stale, so the responder is always asked. */
+static int OcspStatusCurrent(CertStatus* status)
+{
+#ifndef NO_ASN_TIME
+    return XVALIDATE_DATE(status->thisDate, status->thisDateFormat, BEFORE) &&
+           XVALIDATE_DATE(status->nextDate, status->nextDateFormat, AFTER);
+#else
+    (void)status;
+    return 0;
+#endif
+}
+
+
+/* Find, or add, the issuer entry of the request. Entries stay on the list
+ * until the OCSP controller is freed so the pointer is valid without lock. */
+static int GetOcspEntry(WOLFSSL_OCSP* ocsp, OcspRequest* request,
+                        OcspEntry** entry)
+{
+    OcspEntry* e;
+
+    WOLFSSL_ENTER("GetOcspEntry");
+
+    *entry = NULL;
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0) {
+        WOLFSSL_LEAVE("GetOcspEntry", BAD_MUTEX_E);
+        return BAD_MUTEX_E;
+    }
+
+    for (e = ocsp->ocspList; e != NULL; e = e->next) {
+        if (XMEMCMP(e->issuerHash, request->issuerHash,
+                                                     OCSP_DIGEST_SIZE) == 0 &&
+            XMEMCMP(e->issuerKeyHash, request->issuerKeyHash,
+                                                     OCSP_DIGEST_SIZE) == 0) {
+            break;
+        }
+    }
+
+    if (e == NULL) {
+        e = (OcspEntry*)XMALLOC(sizeof(OcspEntry), ocsp->cm->heap,
+                                DYNAMIC_TYPE_OCSP_ENTRY);
+        if (e != NULL) {
+            XMEMSET(e, 0, sizeof(OcspEntry));
+            e->hashAlgoOID = SHAh;
+            XMEMCPY(e->issuerHash, request->issuerHash, OCSP_DIGEST_SIZE);
+            XMEMCPY(e->issuerKeyHash, request->issuerKeyHash,
+                                                            OCSP_DIGEST_SIZE);
+            e->next = ocsp->ocspList;
+            ocsp->ocspList = e;
+        }
+    }
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    *entry = e;
+
+    return e == NULL ? MEMORY_E : 0;
+}
+
+
+/* status of the serial in entry, call with ocspLock held */
+static CertStatus* FindOcspStatus(OcspEntry* entry, OcspRequest* request)
+{
+    CertStatus* status;
+
+    for (status = entry->status; status != NULL; status = status->next) {
+        if (status->serialSz == request->serialSz &&
+                XMEMCMP(status->serial, request->serial,
+                                                 request->serialSz) == 0) {
+            break;
+        }
+    }
+
+    return status;
+}
+
+
+/* Cached result for the request, OCSP_INVALID_STATUS when the responder has
+ * to be asked */
+static int GetOcspStatus(WOLFSSL_OCSP* ocsp, OcspRequest* request,
+                         OcspEntry* entry)
+{
+    CertStatus* status;
+    int         ret = OCSP_INVALID_STATUS;
+
+    WOLFSSL_ENTER("GetOcspStatus");
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0) {
+        WOLFSSL_LEAVE("GetOcspStatus", BAD_MUTEX_E);
+        return BAD_MUTEX_E;
+    }
+
+    status = FindOcspStatus(entry, request);
+    if (status != NULL && OcspStatusCurrent(status))
+        ret = xstat2err(status->status);
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    WOLFSSL_LEAVE("GetOcspStatus", ret);
+
+    return ret;
+}
+
+
+#ifndef NO_SHA256
+/* Result of an identical response already verified for the request's cert,
+ * OCSP_INVALID_STATUS when the response has to be verified */
+static int GetOcspStatusByResponse(WOLFSSL_OCSP* ocsp, OcspRequest* request,
+                                   OcspEntry* entry, const byte* respHash)
+{
+    CertStatus* status;
+    int         ret = OCSP_INVALID_STATUS;
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0)
+        return BAD_MUTEX_E;
+
+    status = FindOcspStatus(entry, request);
+    if (status != NULL && status->respHashSet &&
+            XMEMCMP(status->respHash, respHash, OCSP_RESP_HASH_SIZE) == 0 &&
+            OcspStatusCurrent(status)) {
+        ret = xstat2err(status->status);
+    }
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    return ret;
+}
+#endif
+
+
+/* Keep the verified status for the request's cert. Statuses gone stale are
+ * dropped here so the list stays as long as the certs in use. */
+static int UpdateOcspStatus(WOLFSSL_OCSP* ocsp, OcspRequest* request,
+                            OcspEntry* entry, CertStatus* newStatus,
+                            const byte* respHash)
+{
+    CertStatus*  status;
+    CertStatus** prev;
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0)
+        return BAD_MUTEX_E;
+
+    status = FindOcspStatus(entry, request);
+    if (status == NULL) {
+        status = (CertStatus*)XMALLOC(sizeof(CertStatus), ocsp->cm->heap,
+                                      DYNAMIC_TYPE_OCSP_STATUS);
+        if (status == NULL) {
+            wc_UnLockMutex(&ocsp->ocspLock);
+            return MEMORY_E;
+        }
+        status->next = entry->status;
+        entry->status = status;
+        entry->totalStatus++;
+    }
+
+    XMEMCPY(status->serial, request->serial, request->serialSz);
+    status->serialSz       = request->serialSz;
+    status->status         = newStatus->status;
+    XMEMCPY(status->thisDate, newStatus->thisDate, MAX_DATE_SIZE);
+    XMEMCPY(status->nextDate, newStatus->nextDate, MAX_DATE_SIZE);
+    status->thisDateFormat = newStatus->thisDateFormat;
+    status->nextDateFormat = newStatus->nextDateFormat;
+    status->respHashSet    = 0;
+    if (respHash != NULL) {
+        XMEMCPY(status->respHash, respHash, OCSP_RESP_HASH_SIZE);
+        status->respHashSet = 1;
+    }
+
+    for (prev = &entry->status; *prev != NULL; ) {
+        CertStatus* cur = *prev;
+        if (cur != status && !OcspStatusCurrent(cur)) {
+            *prev = cur->next;
+            XFREE(cur, ocsp->cm->heap, DYNAMIC_TYPE_OCSP_STATUS);
+            entry->totalStatus--;
+        }
+        else {
+            prev = &cur->next;
+        }
+    }
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    return 0;
+}
+
+
+/* Check an OCSP response, fetched or stapled, for the request.
+ * 0 for a good status, OCSP_CERT_REVOKED or OCSP_CERT_UNKNOWN, another error
+ * when the response is bad or doesn't answer the request.
+ * A response byte for byte the same as the one giving the cached status is
+ * trusted without parsing it again, unless a nonce was sent. */
+int CheckOcspResponse(WOLFSSL_OCSP* ocsp, const byte* response, int responseSz,
+                      OcspRequest* ocspRequest)
+{
+#ifdef WOLFSSL_SMALL_STACK
+    OcspResponse* ocspResponse;
+#else
+    OcspResponse  ocspResponse[1];
+#endif
+    OcspEntry*    entry = NULL;
+    CertStatus*   status;
+    const byte*   respHash = NULL;
+#ifndef NO_SHA256
+    byte          hash[OCSP_RESP_HASH_SIZE];
+#endif
+    int           ret;
+
+    WOLFSSL_ENTER("CheckOcspResponse");
+
+    if (ocsp == NULL || response == NULL || responseSz <= 0 ||
+                                                        ocspRequest == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = GetOcspEntry(ocsp, ocspRequest, &entry);
+    if (ret != 0)
+        return ret;
+
+#ifndef NO_SHA256
+    if (wc_Sha256Hash(response, (word32)responseSz, hash) == 0) {
+        respHash = hash;
+        if (ocspRequest->nonceSz == 0) {
+            ret = GetOcspStatusByResponse(ocsp, ocspRequest, entry, hash);
+            if (ret != OCSP_INVALID_STATUS) {
+                WOLFSSL_MSG("\tresponse already verified");
+                WOLFSSL_LEAVE("CheckOcspResponse", ret);
+                return ret;
+            }
+        }
+    }
+#endif
+
+#ifdef WOLFSSL_SMALL_STACK
+    ocspResponse = (OcspResponse*)XMALLOC(sizeof(OcspResponse),
+                                    ocsp->cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (ocspResponse == NULL)
+        return MEMORY_E;
+#endif
+
+    InitOcspResponse(ocspResponse, response, (word32)responseSz,
+                     ocsp->cm->heap);
+
+    ret = OcspResponseDecode(ocspResponse, ocsp->cm, 0);
+    if (ret != 0) {
+        WOLFSSL_MSG("\tOcspResponseDecode failed");
+        ret = OCSP_LOOKUP_FAIL;
+    }
+    else if (ocspResponse->responseStatus != OCSP_SUCCESSFUL) {
+        WOLFSSL_MSG("\tOcspResponse status bad");
+        ret = OCSP_LOOKUP_FAIL;
+    }
+    else if (CompareOcspReqResp(ocspRequest, ocspResponse) != 0) {
+        WOLFSSL_MSG("\tOcspResponse doesn't match request");
+        ret = OCSP_LOOKUP_FAIL;
+    }
+    else {
+        status = ocspResponse->single->status;
+        ret = xstat2err(status->status);
+
+        /* without a nextUpdate newer information is always available */
+        if (status->nextDateFormat != ASN_OTHER_TYPE) {
+            int err = UpdateOcspStatus(ocsp, ocspRequest, entry, status,
+                                       respHash);
+            if (err != 0)
+                ret = err;
+        }
+    }
+
+    FreeOcspResponse(ocspResponse);
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(ocspResponse, ocsp->cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    WOLFSSL_LEAVE("CheckOcspResponse", ret);
+
+    return ret;
+}
+
+
+/* Status of the certificate in the request, from the cache or else asked of
+ * the responder through the I/O callback */
+int CheckOcspRequest(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest)
+{
+    WOLFSSL_CERT_MANAGER* cm;
+    OcspEntry*  entry = NULL;
+    const char* url;
+    int         urlSz;
+    byte*       request;
+    int         requestSz;
+    byte*       response = NULL;
+    int         ret;
+
+    WOLFSSL_ENTER("CheckOcspRequest");
+
+    if (ocsp == NULL || ocspRequest == NULL)
+        return BAD_FUNC_ARG;
+    cm = ocsp->cm;
+
+    ret = GetOcspEntry(ocsp, ocspRequest, &entry);
+    if (ret != 0)
+        return ret;
+
+    ret = GetOcspStatus(ocsp, ocspRequest, entry);
+    if (ret != OCSP_INVALID_STATUS)
+        return ret;
+
+    if (cm->ocspUseOverrideURL) {
+        url = cm->ocspOverrideURL;
+        if (url == NULL || url[0] == '\0')
+            return OCSP_NEED_URL;
+        urlSz = (int)XSTRLEN(url);
+    }
+    else if (ocspRequest->url != NULL && ocspRequest->urlSz != 0) {
+        url   = (const char*)ocspRequest->url;
+        urlSz = ocspRequest->urlSz;
+    }
+    else {
+        /* cert doesn't have extAuthInfo, assuming CERT_GOOD */
+        WOLFSSL_MSG("Cert has no OCSP URL, assuming CERT_GOOD");
+        return 0;
+    }
+
+    if (cm->ocspIOCb == NULL) {
+        WOLFSSL_MSG("\tno OCSP I/O callback");
+        return OCSP_LOOKUP_FAIL;
+    }
+
+    requestSz = EncodeOcspRequest(ocspRequest, NULL, 0);
+    if (requestSz < 0)
+        return requestSz;
+    request = (byte*)XMALLOC(requestSz, cm->heap, DYNAMIC_TYPE_OCSP);
+    if (request == NULL) {
+        WOLFSSL_LEAVE("CheckOcspRequest", MEMORY_E);
+        return MEMORY_E;
+    }
+
+    requestSz = EncodeOcspRequest(ocspRequest, request, requestSz);
+    if (requestSz > 0) {
+        ret = cm->ocspIOCb(cm->ocspIOCtx, url, urlSz, request, requestSz,
+                           &response);
+        if (ret == WOLFSSL_CBIO_ERR_WANT_READ) {
+            ret = OCSP_WANT_READ;
+        }
+        else if (ret > 0 && response != NULL) {
+            ret = CheckOcspResponse(ocsp, response, ret, ocspRequest);
+        }
+        else {
+            WOLFSSL_MSG("\tOCSP I/O callback failed");
+            ret = OCSP_LOOKUP_FAIL;
+        }
+    }
+    else {
+        ret = requestSz < 0 ? requestSz : OCSP_LOOKUP_FAIL;
+    }
+
+    XFREE(request, cm->heap, DYNAMIC_TYPE_OCSP);
+
+    if (response != NULL && cm->ocspRespFreeCb)
+        cm->ocspRespFreeCb(cm->ocspIOCtx, response);
+
+    WOLFSSL_LEAVE("CheckOcspRequest", ret);
+
+    return ret;
+}
+
+
+int CheckCertOCSP_ex(WOLFSSL_OCSP* ocsp, DecodedCert* cert, WOLFSSL* ssl)
+{
+    OcspRequest ocspRequest[1];
+    int         ret;
+
+    WOLFSSL_ENTER("CheckCertOCSP");
+
+    ret = InitOcspRequest(ocspRequest, cert, ocsp->cm->ocspSendNonce,
+                          ocsp->cm->heap);
+    if (ret == 0) {
+        ocspRequest->ssl = ssl;
+        ret = CheckOcspRequest(ocsp, ocspRequest);
+    }
+    else {
+        WOLFSSL_MSG("\tcouldn't init OCSP request");
+    }
+
+    FreeOcspRequest(ocspRequest);
+
+    WOLFSSL_LEAVE("CheckCertOCSP", ret);
+
+    return ret;
+}
+
+
+/* 0 if the cert is good, < 0 on error or when the status isn't good */
+int CheckCertOCSP(WOLFSSL_OCSP* ocsp, DecodedCert* cert)
+{
+    return CheckCertOCSP_ex(ocsp, cert, NULL);
+}
+
+#endif /* HAVE_OCSP */
 #endif /* WOLFCRYPT_ONLY */
@@ -87,6 +87,16 @@
 #include <wolfssl/wolfcrypt/port/Renesas/renesas_cmn.h>
 #endif
 
+#if defined(WOLFSSL_HAVE_MMAP) && (defined(WOLFSSL_CERT_CACHE_MMAP) || \
+    defined(WOLFSSL_PARALLEL_CA_LOAD))
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+#endif
+#if defined(WOLFSSL_CERT_CACHE_MMAP) || defined(WOLFSSL_PARALLEL_CA_LOAD)
+    #include <unistd.h>
+#endif
+
 
 
 void fabio_print(char const* msg, void const* buf, word32 len);
@@ -1261,6 +1271,45 @@ WOLFSSL_API int wolfSSL_UseTrustedCA(WOLFSSL* ssl, byte type,
 #endif /* HAVE_TRUSTED_CA */
 
 
+#ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+
+/* The stapled response is checked by the certificate manager's OCSP checker,
+ * which is turned on with the request */
+int wolfSSL_UseOCSPStapling(WOLFSSL* ssl, byte status_type, byte options)
+{
+    int ret;
+
+    if (ssl == NULL || ssl->options.side != WOLFSSL_CLIENT_END)
+        return BAD_FUNC_ARG;
+
+    ret = wolfSSL_CertManagerEnableOCSPStapling(SSL_CM(ssl));
+    if (ret != WOLFSSL_SUCCESS)
+        return ret;
+
+    return TLSX_UseCertificateStatusRequest(&ssl->extensions, status_type,
+                                            options, ssl, ssl->heap);
+}
+
+
+int wolfSSL_CTX_UseOCSPStapling(WOLFSSL_CTX* ctx, byte status_type,
+                                                                   byte options)
+{
+    int ret;
+
+    if (ctx == NULL || ctx->method->side != WOLFSSL_CLIENT_END)
+        return BAD_FUNC_ARG;
+
+    ret = wolfSSL_CertManagerEnableOCSPStapling(ctx->cm);
+    if (ret != WOLFSSL_SUCCESS)
+        return ret;
+
+    return TLSX_UseCertificateStatusRequest(&ctx->extensions, status_type,
+                                            options, NULL, ctx->heap);
+}
+
+#endif /* HAVE_CERTIFICATE_STATUS_REQUEST */
+
+
 
 
 
@@ -1929,6 +1978,11 @@ const byte* wolfSSL_GetMacSecret(WOLFSSL* ssl, int verify)
 
 
 
+static void FreeCATable(WOLFSSL_CERT_MANAGER* cm);
+#ifdef WOLFSSL_CA_HASH_DIR
+static void FreeCAHashDirs(WOLFSSL_CERT_MANAGER* cm);
+#endif
+
 WOLFSSL_CERT_MANAGER* wolfSSL_CTX_GetCertManager(WOLFSSL_CTX* ctx)
 {
     WOLFSSL_CERT_MANAGER* cm = NULL;
@@ -1967,6 +2021,13 @@ WOLFSSL_CERT_MANAGER* wolfSSL_CertManagerNew_ex(void* heap)
             return NULL;
         }
         #endif
+        #ifdef WOLFSSL_CERT_VERIFY_CACHE
+        if (wc_InitMutex(&cm->verifyCacheLock) != 0) {
+            WOLFSSL_MSG("Bad mutex init");
+            wolfSSL_CertManagerFree(cm);
+            return NULL;
+        }
+        #endif
 
         /* set default minimum key size allowed */
             cm->minRsaKeySz = MIN_RSAKEY_SZ;
@@ -1999,13 +2060,29 @@ void wolfSSL_CertManagerFree(WOLFSSL_CERT_MANAGER* cm)
             doFree = 1;
         wc_UnLockMutex(&cm->refMutex);
         if (doFree) {
-            FreeSignerTable(cm->caTable, CA_TABLE_SIZE, cm->heap);
+            #ifdef HAVE_CRL
+                if (cm->crl)
+                    FreeCRL(cm->crl, 1);
+            #endif
+            #ifdef HAVE_OCSP
+                if (cm->ocsp)
+                    FreeOCSP(cm->ocsp, 1);
+                XFREE(cm->ocspOverrideURL, cm->heap, DYNAMIC_TYPE_URL);
+            #endif
+            FreeCATable(cm);
+            #ifdef WOLFSSL_CA_HASH_DIR
+            FreeCAHashDirs(cm);
+            #endif
             wc_FreeMutex(&cm->caLock);
 
             #ifdef WOLFSSL_TRUST_PEER_CERT
             FreeTrustedPeerTable(cm->tpTable, TP_TABLE_SIZE, cm->heap);
             wc_FreeMutex(&cm->tpLock);
             #endif
+            #ifdef WOLFSSL_CERT_VERIFY_CACHE
+            XFREE(cm->verifyCache, cm->heap, DYNAMIC_TYPE_CERT_VERIFY_CACHE);
+            wc_FreeMutex(&cm->verifyCacheLock);
+            #endif
             if (wc_FreeMutex(&cm->refMutex) != 0) {
                 WOLFSSL_MSG("Couldn't free refMutex mutex");
             }
@@ -2032,7 +2109,9 @@ int wolfSSL_CertManager_up_ref(WOLFSSL_CERT_MANAGER* cm)
 }
 
 
-/* Unload the CA signer list */
+/* Unload the CA signer list.
+ * Lookups take no lock, so must not be called while certificates are being
+ * verified with this certificate manager. */
 int wolfSSL_CertManagerUnloadCAs(WOLFSSL_CERT_MANAGER* cm)
 {
     WOLFSSL_ENTER("wolfSSL_CertManagerUnloadCAs");
@@ -2043,10 +2122,18 @@ int wolfSSL_CertManagerUnloadCAs(WOLFSSL_CERT_MANAGER* cm)
     if (wc_LockMutex(&cm->caLock) != 0)
         return BAD_MUTEX_E;
 
-    FreeSignerTable(cm->caTable, CA_TABLE_SIZE, cm->heap);
+    FreeCATable(cm);
+#ifdef WOLFSSL_CA_HASH_DIR
+    /* no more CAs loaded on demand either */
+    FreeCAHashDirs(cm);
+#endif
 
     wc_UnLockMutex(&cm->caLock);
 
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+    /* verified certificates may chain to a CA no longer trusted */
+    FlushCertVerifyCache(cm);
+#endif
 
     return WOLFSSL_SUCCESS;
 }
@@ -2321,37 +2408,256 @@ static WC_INLINE word32 HashSigner(const byte* hash)
 }
 
 
+/* offset of hash in Signer that CA table is keyed by */
+#ifndef NO_SKID
+    #define SIGNER_KEY_OFFSET   OFFSETOF(Signer, subjectKeyIdHash)
+#else
+    #define SIGNER_KEY_OFFSET   OFFSETOF(Signer, subjectNameHash)
+#endif
+#define SIGNER_NAME_OFFSET      OFFSETOF(Signer, subjectNameHash)
+
+/* hash the signer is looked up by in table */
+static WC_INLINE const byte* SignerKey(const SignerTable* table,
+                                       const Signer* signer)
+{
+    return (const byte*)signer + table->keyOffset;
+}
+
+
+/* hash the signer is looked up by in CA table */
+static WC_INLINE const byte* SignerHash(const Signer* signer)
+{
+    return (const byte*)signer + SIGNER_KEY_OFFSET;
+}
+
+
+/* Find signer in table by hash, safe without lock when table and slots
+ * are loaded atomically */
+static Signer* FindSigner(SignerTable* table, const byte* hash)
+{
+    Signer* signer;
+    word32  mask;
+    word32  i;
+
+    if (table == NULL)
+        return NULL;
+
+    mask = table->size - 1;
+    i = MakeWordFromHash(hash) & mask;
+    /* table is never full, an empty slot ends the probe */
+    while ((signer = WOLFSSL_ATOMIC_LOAD_PTR(table->slot[i])) != NULL) {
+        if (XMEMCMP(hash, SignerKey(table, signer), SIGNER_DIGEST_SIZE) == 0)
+            return signer;
+        i = (i + 1) & mask;
+    }
+
+    return NULL;
+}
+
+
+/* Allocate an empty signer table with size slots */
+static SignerTable* NewSignerTable(word32 size, word32 keyOffset, void* heap)
+{
+    SignerTable* table;
+    word32       sz = (word32)sizeof(SignerTable) +
+                      (size - 1) * (word32)sizeof(Signer*);
+
+    table = (SignerTable*)XMALLOC(sz, heap, DYNAMIC_TYPE_SIGNER);
+    if (table != NULL) {
+        XMEMSET(table, 0, sz);
+        table->size = size;
+        table->keyOffset = keyOffset;
+    }
+    (void)heap;
+
+    return table;
+}
+
+
+/* Put signer in first empty slot of probe sequence, have lock */
+static void PutSigner(SignerTable* table, Signer* signer)
+{
+    word32 mask = table->size - 1;
+    word32 i = MakeWordFromHash(SignerKey(table, signer)) & mask;
+
+    while (table->slot[i] != NULL)
+        i = (i + 1) & mask;
+
+    /* publish signer after all its fields are set */
+    WOLFSSL_ATOMIC_STORE_PTR(table->slot[i], signer);
+    table->used++;
+}
+
+
+/* Make room in table for count more signers, have lock.
+ * The table is kept at most half full. When full, a copy at least twice the
+ * size is filled and then published. The old table is retired, not freed, as
+ * lookups may still be walking it. */
+static int GrowSignerTable(SignerTable** pTable, word32 count, word32 keyOffset,
+                           void* heap)
+{
+    SignerTable* table = *pTable;
+    SignerTable* grown;
+    word32       used = (table == NULL) ? 0 : table->used;
+    word32       size = (table == NULL) ? CA_TABLE_MIN_SLOTS : table->size;
+    word32       i;
+
+    if (table != NULL && (used + count) * 2 <= size)
+        return 0;
+
+    if (table != NULL)
+        size *= 2;
+    while ((used + count) * 2 > size) {
+        if (size > (0xFFFFFFFFUL / 2) / sizeof(Signer*))
+            return MEMORY_E;
+        size *= 2;
+    }
+
+    grown = NewSignerTable(size, keyOffset, heap);
+    if (grown == NULL)
+        return MEMORY_E;
+
+    if (table != NULL) {
+        for (i = 0; i < table->size; i++) {
+            if (table->slot[i] != NULL)
+                PutSigner(grown, table->slot[i]);
+        }
+        grown->retired = table;
+    }
+
+    WOLFSSL_ATOMIC_STORE_PTR(*pTable, grown);
+
+    return 0;
+}
+
+
+/* Make room in the CA tables for count more signers, have lock */
+static int GrowCATable(WOLFSSL_CERT_MANAGER* cm, word32 count)
+{
+    int ret;
+
+    ret = GrowSignerTable(&cm->caTable, count, SIGNER_KEY_OFFSET, cm->heap);
+#ifndef NO_SKID
+    if (ret == 0)
+        ret = GrowSignerTable(&cm->caNameTable, count, SIGNER_NAME_OFFSET,
+                              cm->heap);
+#endif
+
+    return ret;
+}
+
+
+/* Add signer to CA table taking ownership and index it by subject name,
+ * have lock. On error the signer is in neither table. */
+static int AddSignerToTable(WOLFSSL_CERT_MANAGER* cm, Signer* signer)
+{
+    int ret;
+
+    ret = GrowCATable(cm, 1);
+    if (ret == 0) {
+        PutSigner(cm->caTable, signer);
+    #ifndef NO_SKID
+        PutSigner(cm->caNameTable, signer);
+    #endif
+    }
+
+    return ret;
+}
+
+
+/* Free signer table and the retired tables, optionally with the signers */
+static void FreeSignerTables(SignerTable* table, int freeSigners, void* heap)
+{
+    SignerTable* retired;
+    word32       i;
+
+    if (table != NULL && freeSigners) {
+        for (i = 0; i < table->size; i++) {
+            /* signers restored from a cert cache are freed with the store */
+            if (table->slot[i] != NULL && !table->slot[i]->inStore)
+                FreeSigner(table->slot[i], heap);
+        }
+    }
+    while (table != NULL) {
+        retired = table->retired;
+        XFREE(table, heap, DYNAMIC_TYPE_SIGNER);
+        table = retired;
+    }
+    (void)heap;
+}
+
+
+#ifdef PERSIST_CERT_CACHE
+/* Free cert cache stores, their signers and release the images */
+static void FreeCertCacheStores(CertCacheStore* store, void* heap)
+{
+    CertCacheStore* next;
+    word32          i;
+
+    while (store != NULL) {
+        next = store->next;
+        for (i = 0; i < store->count; i++) {
+        #ifndef IGNORE_NAME_CONSTRAINTS
+            FreeNameSubtrees(store->signers[i].permittedNames, heap);
+            FreeNameSubtrees(store->signers[i].excludedNames, heap);
+        #endif
+        #ifdef WOLFSSL_SIGNER_KEY_CACHE
+            FreeSignerPubKey(&store->signers[i], heap);
+        #endif
+        }
+        XFREE(store->signers, heap, DYNAMIC_TYPE_SIGNER);
+        if (store->imageType == CERT_CACHE_IMAGE_HEAP) {
+            XFREE((void*)store->image, heap, DYNAMIC_TYPE_CERT_CACHE);
+        }
+    #ifdef WOLFSSL_CERT_CACHE_MMAP
+        else if (store->imageType == CERT_CACHE_IMAGE_MMAP) {
+            munmap((void*)store->image, store->imageSz);
+        }
+    #endif
+        XFREE(store, heap, DYNAMIC_TYPE_CERT_CACHE);
+        store = next;
+    }
+    (void)heap;
+}
+#endif /* PERSIST_CERT_CACHE */
+
+
+/* Free CA tables, the retired tables and all signers, have lock */
+static void FreeCATable(WOLFSSL_CERT_MANAGER* cm)
+{
+    SignerTable* table = cm->caTable;
+#ifndef NO_SKID
+    SignerTable* nameTable = cm->caNameTable;
+
+    WOLFSSL_ATOMIC_STORE_PTR(cm->caNameTable, (SignerTable*)NULL);
+#endif
+    WOLFSSL_ATOMIC_STORE_PTR(cm->caTable, (SignerTable*)NULL);
+
+#ifndef NO_SKID
+    FreeSignerTables(nameTable, 0, cm->heap);
+#endif
+    FreeSignerTables(table, 1, cm->heap);
+#ifdef PERSIST_CERT_CACHE
+    FreeCertCacheStores(cm->caStore, cm->heap);
+    cm->caStore = NULL;
+#endif
+}
+
+
 /* does CA already exist on signer list */
 int AlreadySigner(WOLFSSL_CERT_MANAGER* cm, byte* hash)
 {
-    Signer* signers;
     int     ret = 0;
-    word32  row;
 
     if (cm == NULL || hash == NULL) {
         return ret;
     }
 
-    row = HashSigner(hash);
-
     if (wc_LockMutex(&cm->caLock) != 0) {
         return ret;
     }
-    signers = cm->caTable[row];
-    while (signers) {
-        byte* subjectHash;
-
-    #ifndef NO_SKID
-        subjectHash = signers->subjectKeyIdHash;
-    #else
-        subjectHash = signers->subjectNameHash;
-    #endif
-
-        if (XMEMCMP(hash, subjectHash, SIGNER_DIGEST_SIZE) == 0) {
-            ret = 1; /* success */
-            break;
-        }
-        signers = signers->next;
+    if (FindSigner(cm->caTable, hash) != NULL) {
+        ret = 1; /* success */
     }
     wc_UnLockMutex(&cm->caLock);
 
@@ -2462,125 +2768,457 @@ int MatchTrustedPeer(TrustedPeerCert* tp, DecodedCert* cert)
 #endif /* WOLFSSL_TRUST_PEER_CERT */
 
 
-/* return CA if found, otherwise NULL */
-Signer* GetCA(void* vp, byte* hash)
+/* Find signer in CA table by hash. No lock is taken when the table can be
+ * read atomically. */
+static Signer* FindCA(WOLFSSL_CERT_MANAGER* cm, SignerTable** table,
+                      const byte* hash)
 {
-    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
     Signer* ret = NULL;
-    Signer* signers;
-    word32  row = 0;
 
-    if (cm == NULL || hash == NULL)
-        return NULL;
-
-    row = HashSigner(hash);
+    (void)cm;
 
+#ifdef WOLFSSL_NO_ATOMIC_PTR
     if (wc_LockMutex(&cm->caLock) != 0)
         return ret;
+#endif
 
-    signers = cm->caTable[row];
-    while (signers) {
-        byte* subjectHash;
-        #ifndef NO_SKID
-            subjectHash = signers->subjectKeyIdHash;
-        #else
-            subjectHash = signers->subjectNameHash;
-        #endif
-        if (XMEMCMP(hash, subjectHash, SIGNER_DIGEST_SIZE) == 0) {
-            ret = signers;
-            break;
-        }
-        signers = signers->next;
-    }
+    ret = FindSigner(WOLFSSL_ATOMIC_LOAD_PTR(*table), hash);
+
+#ifdef WOLFSSL_NO_ATOMIC_PTR
     wc_UnLockMutex(&cm->caLock);
+#endif
 
     return ret;
 }
 
 
-#ifndef NO_SKID
-/* return CA if found, otherwise NULL. Walk through hash table. */
-Signer* GetCAByName(void* vp, byte* hash)
+#ifdef WOLFSSL_CA_HASH_DIR
+
+/* on demand CA loads in progress on this thread. Adding a CA looks up its
+ * issuer, that lookup does not load again so issuer loops end. */
+static THREAD_LS_T int caHashDirDepth = 0;
+
+
+/* Add the CA in a hashed directory file, PEM or DER.
+ * Returns BAD_PATH_ERROR when there is no file. */
+static int AddHashDirFile(WOLFSSL_CERT_MANAGER* cm, const char* fname,
+                          int verify)
 {
-    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
-    Signer* ret = NULL;
-    Signer* signers;
-    word32  row;
+    int        ret;
+    byte*      buf = NULL;
+    size_t     sz = 0;
+    DerBuffer* der = NULL;
+
+    ret = wc_FileLoad(fname, &buf, &sz, cm->heap);
+    if (ret == 0 && sz > 0 && buf[0] == (ASN_SEQUENCE | ASN_CONSTRUCTED)) {
+        ret = AllocDer(&der, (word32)sz, CA_TYPE, cm->heap);
+        if (ret == 0)
+            XMEMCPY(der->buffer, buf, sz);
+    }
+    else if (ret == 0) {
+        ret = PemToDer(buf, (long)sz, CA_TYPE, &der, cm->heap, NULL, NULL);
+    }
+    if (ret == 0)
+        ret = AddCA(cm, &der, WOLFSSL_USER_CA, verify);
+
+    XFREE(buf, cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return ret;
+}
 
-    if (cm == NULL)
-        return NULL;
+
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+/* 1 if the file name hash was not found in the directories recently */
+static int HashDirMissed(WOLFSSL_CERT_MANAGER* cm, word32 hash)
+{
+    word32 now = LowResTimer();
+    int    found = 0;
+    int    i;
 
     if (wc_LockMutex(&cm->caLock) != 0)
-        return ret;
+        return 0;
+    for (i = 0; i < CA_HASH_DIR_MISS_SZ; i++) {
+        CAHashDirMiss* miss = &cm->caHashDirMiss[i];
 
-    for (row = 0; row < CA_TABLE_SIZE && ret == NULL; row++) {
-        signers = cm->caTable[row];
-        while (signers && ret == NULL) {
-            if (XMEMCMP(hash, signers->subjectNameHash,
-                        SIGNER_DIGEST_SIZE) == 0) {
-                ret = signers;
-            }
-            signers = signers->next;
+        if (miss->time != 0 && miss->hash == hash) {
+            if (now - miss->time < CA_HASH_DIR_MISS_TIMEOUT)
+                found = 1;
+            else
+                miss->time = 0; /* expired, search again */
+            break;
         }
     }
     wc_UnLockMutex(&cm->caLock);
 
-    return ret;
+    return found;
 }
-#endif
 
 
-#ifdef WOLFSSL_TRUST_PEER_CERT
-/* add a trusted peer cert to linked list */
-int AddTrustedPeer(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int verify)
+/* Remember a file name hash not found, replacing the oldest miss */
+static void HashDirAddMiss(WOLFSSL_CERT_MANAGER* cm, word32 hash)
 {
-    int ret, row;
-    TrustedPeerCert* peerCert;
-    DecodedCert* cert;
-    DerBuffer*   der = *pDer;
+    CAHashDirMiss* miss;
 
-    WOLFSSL_MSG("Adding a Trusted Peer Cert");
+    if (wc_LockMutex(&cm->caLock) != 0)
+        return;
+    miss = &cm->caHashDirMiss[cm->caHashDirMissIdx];
+    miss->hash = hash;
+    miss->time = LowResTimer();
+    cm->caHashDirMissIdx = (cm->caHashDirMissIdx + 1) % CA_HASH_DIR_MISS_SZ;
+    wc_UnLockMutex(&cm->caLock);
+}
+#endif /* WOLFSSL_CA_HASH_DIR_MISS */
 
-    cert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), cm->heap,
-                                 DYNAMIC_TYPE_DCERT);
-    if (cert == NULL) {
-        FreeDer(&der);
-        return MEMORY_E;
-    }
 
-    InitDecodedCert(cert, der->buffer, der->length, cm->heap);
-    if ((ret = ParseCert(cert, TRUSTED_PEER_TYPE, verify, cm)) != 0) {
-        FreeDecodedCert(cert);
-        XFREE(cert, NULL, DYNAMIC_TYPE_DCERT);
-        FreeDer(&der);
-        return ret;
-    }
-    WOLFSSL_MSG("\tParsed new trusted peer cert");
+/* Load the CAs with subject name hash from the hashed directories.
+ * Files are named by the first four bytes of the hash in hex with a suffix
+ * for colliding names: 1a2b3c4d.0, 1a2b3c4d.1, ...
+ * Return the number of files loaded. */
+static int LoadHashDirCA(WOLFSSL_CERT_MANAGER* cm, const byte* hash)
+{
+    CAHashDir* dir;
+    char       fname[MAX_FILENAME_SZ];
+    word32     nameHash = MakeWordFromHash(hash);
+    int        loaded = 0;
+    int        i;
 
-    peerCert = (TrustedPeerCert*)XMALLOC(sizeof(TrustedPeerCert), cm->heap,
-                                                             DYNAMIC_TYPE_CERT);
-    if (peerCert == NULL) {
-        FreeDecodedCert(cert);
-        XFREE(cert, cm->heap, DYNAMIC_TYPE_DCERT);
-        FreeDer(&der);
-        return MEMORY_E;
-    }
-    XMEMSET(peerCert, 0, sizeof(TrustedPeerCert));
+    if (caHashDirDepth > 0)
+        return 0;
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    if (HashDirMissed(cm, nameHash))
+        return 0;
+#endif
+    caHashDirDepth++;
 
-    #ifndef IGNORE_NAME_CONSTRAINTS
-        if (peerCert->permittedNames)
-            FreeNameSubtrees(peerCert->permittedNames, cm->heap);
-        if (peerCert->excludedNames)
-            FreeNameSubtrees(peerCert->excludedNames, cm->heap);
-    #endif
+    for (dir = WOLFSSL_ATOMIC_LOAD_PTR(cm->caHashDirs); dir != NULL;
+                                    dir = WOLFSSL_ATOMIC_LOAD_PTR(dir->next)) {
+        for (i = 0; i < CA_HASH_DIR_MAX_SUFFIX; i++) {
+            int ret;
 
-    if (AlreadyTrustedPeer(cm, cert)) {
-        WOLFSSL_MSG("\tAlready have this CA, not adding again");
-        FreeTrustedPeer(peerCert, cm->heap);
-        (void)ret;
+            if (XSNPRINTF(fname, sizeof(fname), "%s/%08x.%d", dir->path,
+                          (unsigned int)nameHash, i) >= (int)sizeof(fname)) {
+                break;
+            }
+            ret = AddHashDirFile(cm, fname, dir->verify);
+            if (ret == BAD_PATH_ERROR)
+                break; /* no more files for hash */
+            if (ret == WOLFSSL_SUCCESS)
+                loaded++;
+            else
+                WOLFSSL_MSG("Hashed directory CA load failed, skipping");
+        }
     }
-    else {
-        /* add trusted peer signature */
+
+    caHashDirDepth--;
+
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    if (loaded == 0)
+        HashDirAddMiss(cm, nameHash);
+#endif
+
+    return loaded;
+}
+
+
+/* Add hashed directory to load CAs from when looked up by subject name */
+static int AddCAHashDir(WOLFSSL_CERT_MANAGER* cm, const char* path,
+                        int verify)
+{
+    CAHashDir*  dir;
+    CAHashDir** last;
+    word32      pathSz;
+
+    if (cm == NULL || path == NULL)
+        return BAD_FUNC_ARG;
+
+    pathSz = (word32)XSTRLEN(path);
+    /* room for "/12345678.N" in file name */
+    if (pathSz == 0 || pathSz >= MAX_FILENAME_SZ - 16)
+        return BAD_PATH_ERROR;
+
+    dir = (CAHashDir*)XMALLOC(sizeof(CAHashDir) + pathSz, cm->heap,
+                              DYNAMIC_TYPE_DIRCTX);
+    if (dir == NULL)
+        return MEMORY_E;
+    dir->next = NULL;
+    dir->verify = verify;
+    XMEMCPY(dir->path, path, pathSz + 1);
+
+    if (wc_LockMutex(&cm->caLock) != 0) {
+        XFREE(dir, cm->heap, DYNAMIC_TYPE_DIRCTX);
+        return BAD_MUTEX_E;
+    }
+    /* directories are searched in the order added */
+    for (last = &cm->caHashDirs; *last != NULL; last = &(*last)->next)
+        ;
+    WOLFSSL_ATOMIC_STORE_PTR(*last, dir);
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    /* the new directory may have them */
+    XMEMSET(cm->caHashDirMiss, 0, sizeof(cm->caHashDirMiss));
+#endif
+    wc_UnLockMutex(&cm->caLock);
+
+    return WOLFSSL_SUCCESS;
+}
+
+
+/* Free hashed directory list, have lock */
+static void FreeCAHashDirs(WOLFSSL_CERT_MANAGER* cm)
+{
+    CAHashDir* dir = cm->caHashDirs;
+    CAHashDir* next;
+
+    WOLFSSL_ATOMIC_STORE_PTR(cm->caHashDirs, (CAHashDir*)NULL);
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    XMEMSET(cm->caHashDirMiss, 0, sizeof(cm->caHashDirMiss));
+#endif
+    while (dir != NULL) {
+        next = dir->next;
+        XFREE(dir, cm->heap, DYNAMIC_TYPE_DIRCTX);
+        dir = next;
+    }
+}
+
+
+/* Add directory of CA files named by subject name hash. CAs are loaded from
+ * it the first time they are needed. */
+int wolfSSL_CertManagerLoadCAHashDir(WOLFSSL_CERT_MANAGER* cm,
+                                     const char* path, word32 flags)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCAHashDir");
+
+    return AddCAHashDir(cm, path,
+                 (flags & WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) ? VERIFY_SKIP_DATE
+                                                           : VERIFY);
+}
+
+
+/* Get name of CA in hashed directory without suffix, name is at least
+ * 9 bytes */
+int wolfSSL_CertHashDirName(const unsigned char* der, int derSz, char* name,
+                            int nameSz)
+{
+    int         ret;
+    DecodedCert cert[1];
+
+    if (der == NULL || derSz <= 0 || name == NULL || nameSz < 9)
+        return BAD_FUNC_ARG;
+
+    InitDecodedCert(cert, der, (word32)derSz, NULL);
+    ret = ParseCert(cert, CERT_TYPE, NO_VERIFY, NULL);
+    if (ret == 0) {
+        ret = XSNPRINTF(name, nameSz, "%08x",
+                        (unsigned int)MakeWordFromHash(cert->subjectHash));
+        ret = (ret == 8) ? WOLFSSL_SUCCESS : BUFFER_E;
+    }
+    FreeDecodedCert(cert);
+
+    return ret;
+}
+
+#endif /* WOLFSSL_CA_HASH_DIR */
+
+
+/* return CA if found, otherwise NULL. No lock is taken when the table can be
+ * read atomically. */
+Signer* GetCA(void* vp, byte* hash)
+{
+    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
+    Signer* ret = NULL;
+
+    if (cm == NULL || hash == NULL)
+        return NULL;
+
+    ret = FindCA(cm, &cm->caTable, hash);
+
+#if defined(NO_SKID) && defined(WOLFSSL_CA_HASH_DIR)
+    /* CA table is by subject name, try loading from hashed directory */
+    if (ret == NULL && cm->caHashDirs != NULL && LoadHashDirCA(cm, hash) > 0)
+        ret = FindCA(cm, &cm->caTable, hash);
+#endif
+
+    return ret;
+}
+
+
+#ifndef NO_SKID
+/* return CA if found by subject name hash, otherwise NULL. No lock is taken
+ * when the table can be read atomically. */
+Signer* GetCAByName(void* vp, byte* hash)
+{
+    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
+    Signer* ret = NULL;
+
+    if (cm == NULL || hash == NULL)
+        return NULL;
+
+    ret = FindCA(cm, &cm->caNameTable, hash);
+
+#ifdef WOLFSSL_CA_HASH_DIR
+    if (ret == NULL && cm->caHashDirs != NULL && LoadHashDirCA(cm, hash) > 0)
+        ret = FindCA(cm, &cm->caNameTable, hash);
+#endif
+
+    return ret;
+}
+#endif
+
+
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+/* row in verified certificate cache for certificate id */
+static WC_INLINE word32 CertVerifyCacheRowIdx(const byte* certId)
+{
+    return (((word32)certId[0] << 8) | certId[1]) %
+                                                WOLFSSL_CERT_VERIFY_CACHE_ROWS;
+}
+
+
+/* return 1 if the certificate with certId had its signature verified with the
+ * issuer key issuerId, otherwise 0 */
+int CheckCertVerifyCache(void* vp, const byte* certId, const byte* issuerId)
+{
+    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
+    CertVerifyCacheRow* row;
+    int found = 0;
+    int i;
+
+    if (cm == NULL || certId == NULL || issuerId == NULL)
+        return 0;
+
+    if (wc_LockMutex(&cm->verifyCacheLock) != 0)
+        return 0;
+
+    if (cm->verifyCache != NULL) {
+        row = &cm->verifyCache[CertVerifyCacheRowIdx(certId)];
+        for (i = 0; i < row->used; i++) {
+            if (XMEMCMP(row->entry[i].certId, certId,
+                                                    CERT_VERIFY_ID_SZ) == 0 &&
+                XMEMCMP(row->entry[i].issuerId, issuerId,
+                                                    CERT_VERIFY_ID_SZ) == 0) {
+                found = 1;
+                break;
+            }
+        }
+    }
+
+    wc_UnLockMutex(&cm->verifyCacheLock);
+
+    return found;
+}
+
+
+/* remember that the certificate with certId has a signature verified with the
+ * issuer key issuerId, replacing the oldest entry in the row when full */
+void AddCertVerifyCache(void* vp, const byte* certId, const byte* issuerId)
+{
+    WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
+    CertVerifyCacheRow* row;
+    CertVerifyCacheEntry* entry;
+
+    if (cm == NULL || certId == NULL || issuerId == NULL)
+        return;
+
+    if (wc_LockMutex(&cm->verifyCacheLock) != 0)
+        return;
+
+    if (cm->verifyCache == NULL) {
+        cm->verifyCache = (CertVerifyCacheRow*)XMALLOC(
+            sizeof(CertVerifyCacheRow) * WOLFSSL_CERT_VERIFY_CACHE_ROWS,
+            cm->heap, DYNAMIC_TYPE_CERT_VERIFY_CACHE);
+        if (cm->verifyCache != NULL) {
+            XMEMSET(cm->verifyCache, 0,
+                sizeof(CertVerifyCacheRow) * WOLFSSL_CERT_VERIFY_CACHE_ROWS);
+        }
+    }
+
+    if (cm->verifyCache != NULL) {
+        row = &cm->verifyCache[CertVerifyCacheRowIdx(certId)];
+        if (row->used < WOLFSSL_CERT_VERIFY_CACHE_WAYS) {
+            entry = &row->entry[row->used++];
+        }
+        else {
+            entry = &row->entry[row->next];
+            row->next = (byte)((row->next + 1) %
+                                               WOLFSSL_CERT_VERIFY_CACHE_WAYS);
+        }
+        XMEMCPY(entry->certId, certId, CERT_VERIFY_ID_SZ);
+        XMEMCPY(entry->issuerId, issuerId, CERT_VERIFY_ID_SZ);
+    }
+
+    wc_UnLockMutex(&cm->verifyCacheLock);
+}
+
+
+/* drop all verified certificates, e.g. when the trusted CAs change */
+void FlushCertVerifyCache(WOLFSSL_CERT_MANAGER* cm)
+{
+    if (cm == NULL)
+        return;
+
+    if (wc_LockMutex(&cm->verifyCacheLock) != 0)
+        return;
+
+    if (cm->verifyCache != NULL) {
+        XMEMSET(cm->verifyCache, 0,
+                sizeof(CertVerifyCacheRow) * WOLFSSL_CERT_VERIFY_CACHE_ROWS);
+    }
+
+    wc_UnLockMutex(&cm->verifyCacheLock);
+}
+#endif /* WOLFSSL_CERT_VERIFY_CACHE */
+
+
+#ifdef WOLFSSL_TRUST_PEER_CERT
+/* add a trusted peer cert to linked list */
+int AddTrustedPeer(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int verify)
+{
+    int ret, row;
+    TrustedPeerCert* peerCert;
+    DecodedCert* cert;
+    DerBuffer*   der = *pDer;
+
+    WOLFSSL_MSG("Adding a Trusted Peer Cert");
+
+    cert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), cm->heap,
+                                 DYNAMIC_TYPE_DCERT);
+    if (cert == NULL) {
+        FreeDer(&der);
+        return MEMORY_E;
+    }
+
+    InitDecodedCert(cert, der->buffer, der->length, cm->heap);
+    if ((ret = ParseCert(cert, TRUSTED_PEER_TYPE, verify, cm)) != 0) {
+        FreeDecodedCert(cert);
+        XFREE(cert, NULL, DYNAMIC_TYPE_DCERT);
+        FreeDer(&der);
+        return ret;
+    }
+    WOLFSSL_MSG("\tParsed new trusted peer cert");
+
+    peerCert = (TrustedPeerCert*)XMALLOC(sizeof(TrustedPeerCert), cm->heap,
+                                                             DYNAMIC_TYPE_CERT);
+    if (peerCert == NULL) {
+        FreeDecodedCert(cert);
+        XFREE(cert, cm->heap, DYNAMIC_TYPE_DCERT);
+        FreeDer(&der);
+        return MEMORY_E;
+    }
+    XMEMSET(peerCert, 0, sizeof(TrustedPeerCert));
+
+    #ifndef IGNORE_NAME_CONSTRAINTS
+        if (peerCert->permittedNames)
+            FreeNameSubtrees(peerCert->permittedNames, cm->heap);
+        if (peerCert->excludedNames)
+            FreeNameSubtrees(peerCert->excludedNames, cm->heap);
+    #endif
+
+    if (AlreadyTrustedPeer(cm, cert)) {
+        WOLFSSL_MSG("\tAlready have this CA, not adding again");
+        FreeTrustedPeer(peerCert, cm->heap);
+        (void)ret;
+    }
+    else {
+        /* add trusted peer signature */
         peerCert->sigLen = cert->sigLength;
         peerCert->sig = (byte *)XMALLOC(cert->sigLength, cm->heap,
                                                         DYNAMIC_TYPE_SIGNATURE);
@@ -2648,24 +3286,17 @@ int AddTrustedPeer(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int verify)
 /* owns der, internal now uses too */
 /* type flag ids from user or from chain received during verify
    don't allow chain ones to be added w/o isCA extension */
-int AddCA(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int type, int verify)
+/* Parse CA and make its signer, *pSigner is left NULL if the CA is already
+ * loaded. Safe to call from several threads on the same cm. */
+static int ParseCASigner(WOLFSSL_CERT_MANAGER* cm, DecodedCert* cert,
+                         DerBuffer* der, int type, int verify, Signer** pSigner)
 {
     int         ret;
     Signer*     signer = NULL;
-    word32      row;
     byte*       subjectHash;
-    DecodedCert  cert[1];
-    DerBuffer*   der = *pDer;
-
-    WOLFSSL_MSG("Adding a CA");
-
-    if (cm == NULL) {
-        FreeDer(pDer);
-        return BAD_FUNC_ARG;
-    }
 
+    *pSigner = NULL;
 
-    InitDecodedCert(cert, der->buffer, der->length, cm->heap);
     ret = ParseCert(cert, CA_TYPE, verify, cm);
     WOLFSSL_MSG("\tParsed new CA");
 
@@ -2752,6 +3383,10 @@ int AddCA(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int type, int verify)
     #endif
         XMEMCPY(signer->subjectNameHash, cert->subjectHash,
                 SIGNER_DIGEST_SIZE);
+    #ifdef HAVE_OCSP
+        XMEMCPY(signer->subjectKeyHash, cert->subjectKeyHash,
+                KEYID_SIZE);
+    #endif
         signer->keyUsage = cert->extKeyUsageSet ? cert->extKeyUsage
                                                 : 0xFFFF;
         signer->next    = NULL; /* If Key Usage not set, all uses valid. */
@@ -2761,26 +3396,77 @@ int AddCA(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int type, int verify)
         cert->permittedNames = NULL;
         cert->excludedNames = NULL;
     #endif
+    }
+    if (ret != 0 && signer != NULL) {
+        FreeSigner(signer, cm->heap);
+        signer = NULL;
+    }
+    (void)der;
+
+    *pSigner = signer;
+    return ret;
+}
 
-    #ifndef NO_SKID
-        row = HashSigner(signer->subjectKeyIdHash);
-    #else
-        row = HashSigner(signer->subjectNameHash);
-    #endif
 
-        if (wc_LockMutex(&cm->caLock) == 0) {
-            signer->next = cm->caTable[row];
-            cm->caTable[row] = signer;   /* takes ownership */
-            wc_UnLockMutex(&cm->caLock);
-            if (cm->caCacheCallback)
-                cm->caCacheCallback(der->buffer, (int)der->length, type);
+/* Add parsed CA signer to the CA table, takes ownership of signer.
+ * *pSigner is set to NULL if the signer was freed instead. */
+static int StoreCASigner(WOLFSSL_CERT_MANAGER* cm, Signer** pSigner,
+                         DerBuffer* der, int type)
+{
+    int     ret;
+    int     added = 0;
+    Signer* signer = *pSigner;
+
+    if (wc_LockMutex(&cm->caLock) == 0) {
+        /* may have been added since it was parsed */
+        if (FindSigner(cm->caTable, SignerHash(signer)) != NULL) {
+            WOLFSSL_MSG("\tAlready have this CA, not adding again");
+            ret = 0;
         }
         else {
-            WOLFSSL_MSG("\tCA Mutex Lock failed");
-            ret = BAD_MUTEX_E;
+            ret = AddSignerToTable(cm, signer);   /* takes ownership */
+            added = (ret == 0);
+        }
+        wc_UnLockMutex(&cm->caLock);
+        if (!added) {
+            if (ret != 0)
+                WOLFSSL_MSG("\tCA table add failed");
             FreeSigner(signer, cm->heap);
+            *pSigner = NULL;
         }
+        else if (cm->caCacheCallback)
+            cm->caCacheCallback(der->buffer, (int)der->length, type);
+    }
+    else {
+        WOLFSSL_MSG("\tCA Mutex Lock failed");
+        ret = BAD_MUTEX_E;
+        FreeSigner(signer, cm->heap);
+        *pSigner = NULL;
+    }
+
+    return ret;
+}
+
+
+int AddCA(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int type, int verify)
+{
+    int         ret;
+    Signer*     signer = NULL;
+    DecodedCert  cert[1];
+    DerBuffer*   der = *pDer;
+
+    WOLFSSL_MSG("Adding a CA");
+
+    if (cm == NULL) {
+        FreeDer(pDer);
+        return BAD_FUNC_ARG;
     }
+
+
+    InitDecodedCert(cert, der->buffer, der->length, cm->heap);
+    ret = ParseCASigner(cm, cert, der, type, verify, &signer);
+    if (ret == 0 && signer != NULL)
+        ret = StoreCASigner(cm, &signer, der, type);
 #if defined(WOLFSSL_RENESAS_TSIP_TLS) || defined(WOLFSSL_RENESAS_SCEPROTECT)
     /* Verify CA by TSIP so that generated tsip key is going to be able to */
     /* be used for peer's cert verification                                */
@@ -2788,6 +3474,7 @@ int AddCA(WOLFSSL_CERT_MANAGER* cm, DerBuffer** pDer, int type, int verify)
     /* Therefore, it doesn't need to call TSIP again if there is already   */
     /* verified CA.                                                        */
     if ( ret == 0 && signer != NULL ) {
+        word32 row = HashSigner(SignerHash(signer));
         signer->cm_idx = row;
         if (type == WOLFSSL_USER_CA) {
             if ((ret = wc_Renesas_cmn_RootCertVerify(cert->source, cert->maxIdx,
@@ -3647,7 +4334,27 @@ int wolfSSL_CertManagerEnableCRL(WOLFSSL_CERT_MANAGER* cm, int options)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+    #ifdef HAVE_CRL
+        if (cm->crl == NULL) {
+            cm->crl = (WOLFSSL_CRL*)XMALLOC(sizeof(WOLFSSL_CRL), cm->heap,
+                                            DYNAMIC_TYPE_CRL);
+            if (cm->crl == NULL)
+                return MEMORY_E;
+
+            if (InitCRL(cm->crl, cm) != 0) {
+                WOLFSSL_MSG("Init CRL failed");
+                FreeCRL(cm->crl, 1);
+                cm->crl = NULL;
+                return WOLFSSL_FAILURE;
+            }
+        }
+
+        cm->crlEnabled = 1;
+        if (options & WOLFSSL_CRL_CHECKALL)
+            cm->crlCheckAll = 1;
+    #else
         ret = NOT_COMPILED_IN;
+    #endif
 
     return ret;
 }
@@ -3664,23 +4371,319 @@ int wolfSSL_CertManagerDisableCRL(WOLFSSL_CERT_MANAGER* cm)
     return WOLFSSL_SUCCESS;
 }
 
-#ifndef NO_WOLFSSL_CM_VERIFY
-void wolfSSL_CertManagerSetVerify(WOLFSSL_CERT_MANAGER* cm, VerifyCallback vc)
-{
-    WOLFSSL_ENTER("wolfSSL_CertManagerSetVerify");
-    if (cm == NULL)
-        return;
-
-    cm->verifyCallback = vc;
-}
-#endif /* NO_WOLFSSL_CM_VERIFY */
+#ifdef HAVE_CRL
 
-/* Verify the certificate, WOLFSSL_SUCCESS for ok, < 0 for error */
-int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
-                                    long sz, int format, int err_val)
+/* check CRL if enabled, WOLFSSL_SUCCESS  */
+int wolfSSL_CertManagerCheckCRL(WOLFSSL_CERT_MANAGER* cm, byte* der, int sz)
 {
     int ret = 0;
-    DerBuffer* der = NULL;
+#ifdef WOLFSSL_SMALL_STACK
+    DecodedCert* cert = NULL;
+#else
+    DecodedCert  cert[1];
+#endif
+
+    WOLFSSL_ENTER("wolfSSL_CertManagerCheckCRL");
+
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    if (cm->crlEnabled == 0)
+        return WOLFSSL_SUCCESS;
+
+#ifdef WOLFSSL_SMALL_STACK
+    cert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), NULL, DYNAMIC_TYPE_DCERT);
+    if (cert == NULL)
+        return MEMORY_E;
+#endif
+
+    InitDecodedCert(cert, der, sz, NULL);
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    /* CheckCertCRL() decodes the distribution point if it needs it */
+    cert->decodeLazy = 1;
+#endif
+
+    if ((ret = ParseCertRelative(cert, CERT_TYPE, NO_VERIFY, cm)) != 0) {
+        WOLFSSL_MSG("ParseCert failed");
+    }
+    else if ((ret = CheckCertCRL(cm->crl, cert)) != 0) {
+        WOLFSSL_MSG("CheckCertCRL failed");
+    }
+
+    FreeDecodedCert(cert);
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(cert, NULL, DYNAMIC_TYPE_DCERT);
+#endif
+
+    return ret == 0 ? WOLFSSL_SUCCESS : ret;
+}
+
+
+int wolfSSL_CertManagerSetCRL_Cb(WOLFSSL_CERT_MANAGER* cm, CbMissingCRL cb)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetCRL_Cb");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    cm->cbMissingCRL = cb;
+
+    return WOLFSSL_SUCCESS;
+}
+
+#ifdef HAVE_CRL_IO
+int wolfSSL_CertManagerSetCRL_IOCb(WOLFSSL_CERT_MANAGER* cm, CbCrlIO cb)
+{
+    if (cm == NULL || cm->crl == NULL)
+        return BAD_FUNC_ARG;
+
+    cm->crl->crlIOCb = cb;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif
+
+#ifndef NO_FILESYSTEM
+int wolfSSL_CertManagerLoadCRL(WOLFSSL_CERT_MANAGER* cm, const char* path,
+                              int type, int monitor)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCRL");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    if (cm->crl == NULL) {
+        if (wolfSSL_CertManagerEnableCRL(cm, 0) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("Enable CRL failed");
+            return WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    return LoadCRL(cm->crl, path, type, monitor);
+}
+
+int wolfSSL_CertManagerLoadCRLFile(WOLFSSL_CERT_MANAGER* cm, const char* file,
+                                   int type)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCRLFile");
+    if (cm == NULL || file == NULL)
+        return BAD_FUNC_ARG;
+
+    if (cm->crl == NULL) {
+        if (wolfSSL_CertManagerEnableCRL(cm, 0) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("Enable CRL failed");
+            return WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    return ProcessFile(NULL, file, type, CRL_TYPE, NULL, 0, cm->crl,
+                       VERIFY);
+}
+
+/* Re-read the directories loaded with WOLFSSL_CRL_MONITOR and swap in the
+ * new CRLs, WOLFSSL_SUCCESS on ok */
+int wolfSSL_CertManagerReloadCRL(WOLFSSL_CERT_MANAGER* cm)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerReloadCRL");
+    if (cm == NULL || cm->crl == NULL)
+        return BAD_FUNC_ARG;
+
+    return ReloadCRL(cm->crl);
+}
+#endif /* !NO_FILESYSTEM */
+
+int wolfSSL_CertManagerLoadCRLBuffer(WOLFSSL_CERT_MANAGER* cm,
+                                     const unsigned char* buff, long sz,
+                                     int type)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCRLBuffer");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    if (cm->crl == NULL) {
+        if (wolfSSL_CertManagerEnableCRL(cm, 0) != WOLFSSL_SUCCESS) {
+            WOLFSSL_MSG("Enable CRL failed");
+            return WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    return BufferLoadCRL(cm->crl, buff, sz, type, VERIFY);
+}
+
+int wolfSSL_CertManagerFreeCRL(WOLFSSL_CERT_MANAGER* cm)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerFreeCRL");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+    if (cm->crl != NULL) {
+        FreeCRL(cm->crl, 1);
+        cm->crl = NULL;
+    }
+    cm->crlEnabled = 0;
+    return WOLFSSL_SUCCESS;
+}
+
+
+int wolfSSL_EnableCRL(WOLFSSL* ssl, int options)
+{
+    WOLFSSL_ENTER("wolfSSL_EnableCRL");
+    if (ssl)
+        return wolfSSL_CertManagerEnableCRL(SSL_CM(ssl), options);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_DisableCRL(WOLFSSL* ssl)
+{
+    WOLFSSL_ENTER("wolfSSL_DisableCRL");
+    if (ssl)
+        return wolfSSL_CertManagerDisableCRL(SSL_CM(ssl));
+    else
+        return BAD_FUNC_ARG;
+}
+
+#ifndef NO_FILESYSTEM
+int wolfSSL_LoadCRL(WOLFSSL* ssl, const char* path, int type, int monitor)
+{
+    WOLFSSL_ENTER("wolfSSL_LoadCRL");
+    if (ssl)
+        return wolfSSL_CertManagerLoadCRL(SSL_CM(ssl), path, type, monitor);
+    else
+        return BAD_FUNC_ARG;
+}
+
+int wolfSSL_LoadCRLFile(WOLFSSL* ssl, const char* file, int type)
+{
+    WOLFSSL_ENTER("wolfSSL_LoadCRLFile");
+    if (ssl)
+        return wolfSSL_CertManagerLoadCRLFile(SSL_CM(ssl), file, type);
+    else
+        return BAD_FUNC_ARG;
+}
+#endif
+
+int wolfSSL_LoadCRLBuffer(WOLFSSL* ssl, const unsigned char* buff,
+                          long sz, int type)
+{
+    WOLFSSL_ENTER("wolfSSL_LoadCRLBuffer");
+    if (ssl)
+        return wolfSSL_CertManagerLoadCRLBuffer(SSL_CM(ssl), buff, sz, type);
+    else
+        return BAD_FUNC_ARG;
+}
+
+int wolfSSL_SetCRL_Cb(WOLFSSL* ssl, CbMissingCRL cb)
+{
+    WOLFSSL_ENTER("wolfSSL_SetCRL_Cb");
+    if (ssl)
+        return wolfSSL_CertManagerSetCRL_Cb(SSL_CM(ssl), cb);
+    else
+        return BAD_FUNC_ARG;
+}
+
+#ifdef HAVE_CRL_IO
+int wolfSSL_SetCRL_IOCb(WOLFSSL* ssl, CbCrlIO cb)
+{
+    WOLFSSL_ENTER("wolfSSL_SetCRL_IOCb");
+    if (ssl)
+        return wolfSSL_CertManagerSetCRL_IOCb(SSL_CM(ssl), cb);
+    else
+        return BAD_FUNC_ARG;
+}
+#endif
+
+int wolfSSL_CTX_EnableCRL(WOLFSSL_CTX* ctx, int options)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_EnableCRL");
+    if (ctx)
+        return wolfSSL_CertManagerEnableCRL(ctx->cm, options);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_DisableCRL(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_DisableCRL");
+    if (ctx)
+        return wolfSSL_CertManagerDisableCRL(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+#ifndef NO_FILESYSTEM
+int wolfSSL_CTX_LoadCRL(WOLFSSL_CTX* ctx, const char* path,
+                        int type, int monitor)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_LoadCRL");
+    if (ctx)
+        return wolfSSL_CertManagerLoadCRL(ctx->cm, path, type, monitor);
+    else
+        return BAD_FUNC_ARG;
+}
+
+int wolfSSL_CTX_LoadCRLFile(WOLFSSL_CTX* ctx, const char* file,
+                        int type)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_LoadCRLFile");
+    if (ctx)
+        return wolfSSL_CertManagerLoadCRLFile(ctx->cm, file, type);
+    else
+        return BAD_FUNC_ARG;
+}
+#endif
+
+
+int wolfSSL_CTX_LoadCRLBuffer(WOLFSSL_CTX* ctx, const unsigned char* buff,
+                              long sz, int type)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_LoadCRLBuffer");
+    if (ctx)
+        return wolfSSL_CertManagerLoadCRLBuffer(ctx->cm, buff, sz, type);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_SetCRL_Cb(WOLFSSL_CTX* ctx, CbMissingCRL cb)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetCRL_Cb");
+    if (ctx)
+        return wolfSSL_CertManagerSetCRL_Cb(ctx->cm, cb);
+    else
+        return BAD_FUNC_ARG;
+}
+
+#ifdef HAVE_CRL_IO
+int wolfSSL_CTX_SetCRL_IOCb(WOLFSSL_CTX* ctx, CbCrlIO cb)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetCRL_IOCb");
+    if (ctx)
+        return wolfSSL_CertManagerSetCRL_IOCb(ctx->cm, cb);
+    else
+        return BAD_FUNC_ARG;
+}
+#endif
+
+#endif /* HAVE_CRL */
+
+#ifndef NO_WOLFSSL_CM_VERIFY
+void wolfSSL_CertManagerSetVerify(WOLFSSL_CERT_MANAGER* cm, VerifyCallback vc)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetVerify");
+    if (cm == NULL)
+        return;
+
+    cm->verifyCallback = vc;
+}
+#endif /* NO_WOLFSSL_CM_VERIFY */
+
+/* Verify the certificate, WOLFSSL_SUCCESS for ok, < 0 for error */
+int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
+                                    long sz, int format, int err_val)
+{
+    int ret = 0;
+    DerBuffer* der = NULL;
     DecodedCert  cert[1];
 
     WOLFSSL_ENTER("wolfSSL_CertManagerVerifyBuffer");
@@ -3705,7 +4708,10 @@ int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
     if (ret == 0)
         ret = ParseCertRelative(cert, CERT_TYPE, 1, cm);
 
-
+#ifdef HAVE_CRL
+    if (ret == 0 && cm->crlEnabled)
+        ret = CheckCertCRL(cm->crl, cert);
+#endif
 
 #ifndef NO_WOLFSSL_CM_VERIFY
     /* if verify callback has been set */
@@ -3744,6 +4750,28 @@ int wolfSSL_CertManagerVerifyBuffer(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
     return CM_VerifyBuffer_ex(cm, buff, sz, format, 0);
 }
 
+#ifdef HAVE_OCSP
+/* create the OCSP checker of cm when first needed */
+static int CM_InitOCSP(WOLFSSL_CERT_MANAGER* cm)
+{
+    if (cm->ocsp == NULL) {
+        cm->ocsp = (WOLFSSL_OCSP*)XMALLOC(sizeof(WOLFSSL_OCSP), cm->heap,
+                                          DYNAMIC_TYPE_OCSP);
+        if (cm->ocsp == NULL)
+            return MEMORY_E;
+
+        if (InitOCSP(cm->ocsp, cm) != 0) {
+            WOLFSSL_MSG("Init OCSP failed");
+            FreeOCSP(cm->ocsp, 1);
+            cm->ocsp = NULL;
+            return WOLFSSL_FAILURE;
+        }
+    }
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* HAVE_OCSP */
+
 /* turn on OCSP if off and compiled in, set options */
 int wolfSSL_CertManagerEnableOCSP(WOLFSSL_CERT_MANAGER* cm, int options)
 {
@@ -3755,7 +4783,20 @@ int wolfSSL_CertManagerEnableOCSP(WOLFSSL_CERT_MANAGER* cm, int options)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+    #ifdef HAVE_OCSP
+        ret = CM_InitOCSP(cm);
+        if (ret != WOLFSSL_SUCCESS)
+            return ret;
+
+        cm->ocspEnabled = 1;
+        if (options & WOLFSSL_OCSP_URL_OVERRIDE)
+            cm->ocspUseOverrideURL = 1;
+        cm->ocspSendNonce = (options & WOLFSSL_OCSP_NO_NONCE) ? 0 : 1;
+        if (options & WOLFSSL_OCSP_CHECKALL)
+            cm->ocspCheckAll = 1;
+    #else
         ret = NOT_COMPILED_IN;
+    #endif
 
     return ret;
 }
@@ -3782,7 +4823,14 @@ int wolfSSL_CertManagerEnableOCSPStapling(WOLFSSL_CERT_MANAGER* cm)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+#if defined(HAVE_OCSP) && defined(HAVE_CERTIFICATE_STATUS_REQUEST)
+    /* stapled responses are verified and cached by the OCSP checker */
+    ret = CM_InitOCSP(cm);
+    if (ret == WOLFSSL_SUCCESS)
+        cm->ocspStaplingEnabled = 1;
+#else
     ret = NOT_COMPILED_IN;
+#endif
 
     return ret;
 }
@@ -3796,7 +4844,11 @@ int wolfSSL_CertManagerDisableOCSPStapling(WOLFSSL_CERT_MANAGER* cm)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+#if defined(HAVE_OCSP) && defined(HAVE_CERTIFICATE_STATUS_REQUEST)
+    cm->ocspStaplingEnabled = 0;
+#else
     ret = NOT_COMPILED_IN;
+#endif
     return ret;
 }
 
@@ -3810,7 +4862,12 @@ int wolfSSL_CertManagerEnableOCSPMustStaple(WOLFSSL_CERT_MANAGER* cm)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+#if defined(HAVE_OCSP) && defined(HAVE_CERTIFICATE_STATUS_REQUEST)
+    cm->ocspMustStaple = 1;
+    ret = WOLFSSL_SUCCESS;
+#else
     ret = NOT_COMPILED_IN;
+#endif
 
     return ret;
 }
@@ -3824,10 +4881,242 @@ int wolfSSL_CertManagerDisableOCSPMustStaple(WOLFSSL_CERT_MANAGER* cm)
     if (cm == NULL)
         return BAD_FUNC_ARG;
 
+#if defined(HAVE_OCSP) && defined(HAVE_CERTIFICATE_STATUS_REQUEST)
+    cm->ocspMustStaple = 0;
+    ret = WOLFSSL_SUCCESS;
+#else
     ret = NOT_COMPILED_IN;
+#endif
     return ret;
 }
 
+#ifdef HAVE_OCSP
+
+/* check OCSP if enabled, WOLFSSL_SUCCESS for a good status */
+int wolfSSL_CertManagerCheckOCSP(WOLFSSL_CERT_MANAGER* cm, byte* der, int sz)
+{
+    int ret;
+#ifdef WOLFSSL_SMALL_STACK
+    DecodedCert* cert = NULL;
+#else
+    DecodedCert  cert[1];
+#endif
+
+    WOLFSSL_ENTER("wolfSSL_CertManagerCheckOCSP");
+
+    if (cm == NULL || der == NULL || sz <= 0)
+        return BAD_FUNC_ARG;
+
+    if (cm->ocspEnabled == 0)
+        return WOLFSSL_SUCCESS;
+
+#ifdef WOLFSSL_SMALL_STACK
+    cert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), cm->heap,
+                                 DYNAMIC_TYPE_DCERT);
+    if (cert == NULL)
+        return MEMORY_E;
+#endif
+
+    InitDecodedCert(cert, der, sz, NULL);
+
+    if ((ret = ParseCertRelative(cert, CERT_TYPE, VERIFY_OCSP, cm)) != 0) {
+        WOLFSSL_MSG("ParseCert failed");
+    }
+    else if ((ret = CheckCertOCSP(cm->ocsp, cert)) != 0) {
+        WOLFSSL_MSG("CheckCertOCSP failed");
+    }
+
+    FreeDecodedCert(cert);
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(cert, cm->heap, DYNAMIC_TYPE_DCERT);
+#endif
+
+    return ret == 0 ? WOLFSSL_SUCCESS : ret;
+}
+
+
+int wolfSSL_CertManagerSetOCSPOverrideURL(WOLFSSL_CERT_MANAGER* cm,
+                                          const char* url)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetOCSPOverrideURL");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    XFREE(cm->ocspOverrideURL, cm->heap, DYNAMIC_TYPE_URL);
+    cm->ocspOverrideURL = NULL;
+    if (url != NULL) {
+        int urlSz = (int)XSTRLEN(url) + 1;
+        cm->ocspOverrideURL = (char*)XMALLOC(urlSz, cm->heap,
+                                             DYNAMIC_TYPE_URL);
+        if (cm->ocspOverrideURL == NULL)
+            return MEMORY_E;
+        XMEMCPY(cm->ocspOverrideURL, url, urlSz);
+    }
+
+    return WOLFSSL_SUCCESS;
+}
+
+
+int wolfSSL_CertManagerSetOCSP_Cb(WOLFSSL_CERT_MANAGER* cm, CbOCSPIO ioCb,
+                                  CbOCSPRespFree respFreeCb, void* ioCbCtx)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetOCSP_Cb");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    cm->ocspIOCb = ioCb;
+    cm->ocspRespFreeCb = respFreeCb;
+    cm->ocspIOCtx = ioCbCtx;
+
+    return WOLFSSL_SUCCESS;
+}
+
+
+int wolfSSL_EnableOCSP(WOLFSSL* ssl, int options)
+{
+    WOLFSSL_ENTER("wolfSSL_EnableOCSP");
+    if (ssl)
+        return wolfSSL_CertManagerEnableOCSP(SSL_CM(ssl), options);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_DisableOCSP(WOLFSSL* ssl)
+{
+    WOLFSSL_ENTER("wolfSSL_DisableOCSP");
+    if (ssl)
+        return wolfSSL_CertManagerDisableOCSP(SSL_CM(ssl));
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_SetOCSP_OverrideURL(WOLFSSL* ssl, const char* url)
+{
+    WOLFSSL_ENTER("wolfSSL_SetOCSP_OverrideURL");
+    if (ssl)
+        return wolfSSL_CertManagerSetOCSPOverrideURL(SSL_CM(ssl), url);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_SetOCSP_Cb(WOLFSSL* ssl, CbOCSPIO ioCb,
+                       CbOCSPRespFree respFreeCb, void* ioCbCtx)
+{
+    WOLFSSL_ENTER("wolfSSL_SetOCSP_Cb");
+    if (ssl)
+        return wolfSSL_CertManagerSetOCSP_Cb(SSL_CM(ssl), ioCb, respFreeCb,
+                                             ioCbCtx);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_EnableOCSPStapling(WOLFSSL* ssl)
+{
+    WOLFSSL_ENTER("wolfSSL_EnableOCSPStapling");
+    if (ssl)
+        return wolfSSL_CertManagerEnableOCSPStapling(SSL_CM(ssl));
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_DisableOCSPStapling(WOLFSSL* ssl)
+{
+    WOLFSSL_ENTER("wolfSSL_DisableOCSPStapling");
+    if (ssl)
+        return wolfSSL_CertManagerDisableOCSPStapling(SSL_CM(ssl));
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_EnableOCSP(WOLFSSL_CTX* ctx, int options)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_EnableOCSP");
+    if (ctx)
+        return wolfSSL_CertManagerEnableOCSP(ctx->cm, options);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_DisableOCSP(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_DisableOCSP");
+    if (ctx)
+        return wolfSSL_CertManagerDisableOCSP(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_SetOCSP_OverrideURL(WOLFSSL_CTX* ctx, const char* url)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetOCSP_OverrideURL");
+    if (ctx)
+        return wolfSSL_CertManagerSetOCSPOverrideURL(ctx->cm, url);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_SetOCSP_Cb(WOLFSSL_CTX* ctx, CbOCSPIO ioCb,
+                           CbOCSPRespFree respFreeCb, void* ioCbCtx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetOCSP_Cb");
+    if (ctx)
+        return wolfSSL_CertManagerSetOCSP_Cb(ctx->cm, ioCb, respFreeCb,
+                                             ioCbCtx);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_EnableOCSPStapling(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_EnableOCSPStapling");
+    if (ctx)
+        return wolfSSL_CertManagerEnableOCSPStapling(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_DisableOCSPStapling(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_DisableOCSPStapling");
+    if (ctx)
+        return wolfSSL_CertManagerDisableOCSPStapling(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_EnableOCSPMustStaple(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_EnableOCSPMustStaple");
+    if (ctx)
+        return wolfSSL_CertManagerEnableOCSPMustStaple(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+
+int wolfSSL_CTX_DisableOCSPMustStaple(WOLFSSL_CTX* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_DisableOCSPMustStaple");
+    if (ctx)
+        return wolfSSL_CertManagerDisableOCSPMustStaple(ctx->cm);
+    else
+        return BAD_FUNC_ARG;
+}
+
+#endif /* HAVE_OCSP */
+
 
 /* macro to get verify settings for AddCA */
 #define GET_VERIFY_SETTING_CTX(ctx) \
@@ -3913,6 +5202,10 @@ int ProcessFile(WOLFSSL_CTX* ctx, const char* fname, int format, int type,
             ret = ProcessChainBuffer(ctx, myBuffer, sz, format, type, ssl,
                                      verify);
         }
+#ifdef HAVE_CRL
+        else if (type == CRL_TYPE)
+            ret = BufferLoadCRL(crl, myBuffer, sz, format, verify);
+#endif
         else
             ret = ProcessBuffer(ctx, myBuffer, sz, format, type, ssl, NULL,
                                 userChain, verify);
@@ -3925,6 +5218,263 @@ int ProcessFile(WOLFSSL_CTX* ctx, const char* fname, int format, int type,
     return ret;
 }
 
+#ifdef WOLFSSL_PARALLEL_CA_LOAD
+/* Certificate of a PEM CA bundle being loaded in parallel */
+typedef struct CALoadItem {
+    const byte* pem;     /* PEM block in file */
+    long        pemSz;
+    DerBuffer*  der;
+    Signer*     signer;  /* parsed signer, NULL if already loaded or error */
+    int         ret;
+} CALoadItem;
+
+/* Certificates shared by the CA load workers */
+typedef struct CALoadWork {
+    WOLFSSL_CERT_MANAGER* cm;
+    CALoadItem*   items;
+    int           count;
+    int           next;  /* first item not taken yet, under lock */
+    int           verify;
+    wolfSSL_Mutex lock;
+} CALoadWork;
+
+
+/* Decode and parse one certificate without changing the CA table */
+static void ParseCALoadItem(CALoadWork* work, CALoadItem* item)
+{
+    WOLFSSL_CERT_MANAGER* cm = work->cm;
+    DecodedCert           cert[1];
+
+    item->ret = PemToDer(item->pem, item->pemSz, CA_TYPE, &item->der,
+                         cm->heap, NULL, NULL);
+    if (item->ret == 0) {
+        InitDecodedCert(cert, item->der->buffer, item->der->length, cm->heap);
+        item->ret = ParseCASigner(cm, cert, item->der, WOLFSSL_USER_CA,
+                                  work->verify, &item->signer);
+        FreeDecodedCert(cert);
+    }
+}
+
+
+/* Take batches of certificates until all have been parsed */
+static void* CALoadWorker(void* arg)
+{
+    CALoadWork* work = (CALoadWork*)arg;
+    int         i;
+    int         end;
+
+    for (;;) {
+        if (wc_LockMutex(&work->lock) != 0)
+            break;
+        i = work->next;
+        end = i + CA_LOAD_BATCH;
+        if (end > work->count)
+            end = work->count;
+        work->next = end;
+        wc_UnLockMutex(&work->lock);
+
+        if (i >= end)
+            break;
+        for (; i < end; i++)
+            ParseCALoadItem(work, &work->items[i]);
+    }
+
+    return NULL;
+}
+
+
+/* Find the next certificate in a PEM bundle as PemToDer() consumes it: from a
+ * header to the first footer after it, or to the end with no footer. A block
+ * missing its footer takes the next certificate with it, as it does when the
+ * bundle is loaded serially. Returns the start of the block or NULL and sets
+ * next past it. */
+static const char* NextCABlock(const char* p, const char* end,
+    const char* header, const char* footer, const char** next)
+{
+    const char* start;
+    const char* f;
+    word32      headerSz = (word32)XSTRLEN(header);
+
+    start = XSTRNSTR(p, header, (word32)(end - p));
+    if (start == NULL)
+        return NULL;
+    f = XSTRNSTR(start + headerSz, footer,
+                 (word32)(end - (start + headerSz)));
+    *next = (f == NULL) ? end : f + XSTRLEN(footer);
+
+    return start;
+}
+
+
+/* Parse the certificates of a PEM bundle on a pool of threads and add them
+ * to the CA table in file order. Only the table insertion is serialized.
+ * A CA whose issuer wasn't in the table yet when it was parsed, like an
+ * intermediate after its root, is added with AddCA once the rest are in. */
+static int ProcessCABufferParallel(WOLFSSL_CTX* ctx, const byte* buff,
+                                   long sz, int verify)
+{
+    WOLFSSL_CERT_MANAGER* cm = ctx->cm;
+    CALoadWork  work[1];
+    CALoadItem* item;
+    pthread_t   tid[CA_LOAD_MAX_THREADS];
+    const char* header = NULL;
+    const char* footer = NULL;
+    const char* p;
+    const char* end = (const char*)buff + sz;
+    long        cpus;
+    int         threads;
+    int         started = 0;
+    int         gotOne = 0;
+    int         ret;
+    int         i;
+
+    ret = wc_PemGetHeaderFooter(CA_TYPE, &header, &footer);
+    if (ret != 0)
+        return ret;
+
+    /* split into the certificates a serial load would see */
+    XMEMSET(work, 0, sizeof(CALoadWork));
+    p = (const char*)buff;
+    while (NextCABlock(p, end, header, footer, &p) != NULL)
+        work->count++;
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = (work->count + CA_LOAD_BATCH - 1) / CA_LOAD_BATCH;
+    if (cpus > 0 && threads > cpus)
+        threads = (int)cpus;
+    if (threads > CA_LOAD_MAX_THREADS)
+        threads = CA_LOAD_MAX_THREADS;
+    if (threads < 2) {
+        /* not worth the threads */
+        return ProcessChainBuffer(ctx, buff, sz, WOLFSSL_FILETYPE_PEM, CA_TYPE,
+                                  NULL, verify);
+    }
+
+    work->items = (CALoadItem*)XMALLOC(sizeof(CALoadItem) * work->count,
+                                       cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (work->items == NULL)
+        return MEMORY_E;
+    XMEMSET(work->items, 0, sizeof(CALoadItem) * work->count);
+    p = (const char*)buff;
+    for (i = 0; i < work->count; i++) {
+        item = &work->items[i];
+        item->pem = (const byte*)NextCABlock(p, end, header, footer, &p);
+        item->pemSz = (long)((const byte*)p - item->pem);
+        item->ret = BAD_MUTEX_E; /* not parsed */
+    }
+    work->cm     = cm;
+    work->verify = verify;
+
+    if (wc_InitMutex(&work->lock) != 0) {
+        XFREE(work->items, cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        return BAD_MUTEX_E;
+    }
+
+    /* calling thread is a worker too, carry on with fewer on failure */
+    while (started < threads - 1 &&
+            pthread_create(&tid[started], NULL, CALoadWorker, work) == 0) {
+        started++;
+    }
+    CALoadWorker(work);
+    for (i = 0; i < started; i++)
+        pthread_join(tid[i], NULL);
+    wc_FreeMutex(&work->lock);
+
+    for (i = 0; i < work->count; i++) {
+        item = &work->items[i];
+        if (item->ret == 0 && item->signer != NULL) {
+            item->ret = StoreCASigner(cm, &item->signer, item->der,
+                                      WOLFSSL_USER_CA);
+        }
+        if (item->ret != ASN_NO_SIGNER_E)
+            FreeDer(&item->der);
+    }
+    for (i = 0; i < work->count; i++) {
+        item = &work->items[i];
+        if (item->ret == ASN_NO_SIGNER_E)
+            item->ret = AddCA(cm, &item->der, WOLFSSL_USER_CA, verify);
+        if (item->ret == 0 || item->ret == WOLFSSL_SUCCESS) {
+            gotOne = 1;
+        }
+        else {
+            WOLFSSL_ERROR(item->ret);
+            WOLFSSL_MSG("CA Parse failed, continuing with other certs");
+            ret = item->ret;
+        }
+    }
+    XFREE(work->items, cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+
+    if (gotOne) {
+        WOLFSSL_MSG("Processed at least one valid CA. Other stuff OK");
+        return WOLFSSL_SUCCESS;
+    }
+    return ret;
+}
+
+
+/* Load PEM CA bundle file with the certificates parsed in parallel. The file
+ * is mapped rather than read when possible. */
+static int ProcessCAFileParallel(WOLFSSL_CTX* ctx, const char* fname,
+                                 int verify)
+{
+    int   ret;
+    long  sz;
+    byte* buff;
+#ifdef WOLFSSL_HAVE_MMAP
+    int         fd;
+    struct stat st;
+    void*       mem;
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0)
+        return WOLFSSL_BAD_FILE;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+            st.st_size > (off_t)MAX_WOLFSSL_FILE_SIZE) {
+        WOLFSSL_MSG("ProcessCAFileParallel file size error");
+        close(fd);
+        return WOLFSSL_BAD_FILE;
+    }
+    sz = (long)st.st_size;
+    mem = mmap(NULL, (size_t)sz, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        WOLFSSL_MSG("CA file mmap failed");
+        return WOLFSSL_BAD_FILE;
+    }
+    buff = (byte*)mem;
+
+    ret = ProcessCABufferParallel(ctx, buff, sz, verify);
+
+    munmap(mem, (size_t)sz);
+#else
+    XFILE file;
+
+    file = XFOPEN(fname, "rb");
+    if (file == XBADFILE)
+        return WOLFSSL_BAD_FILE;
+    if (XFSEEK(file, 0, XSEEK_END) != 0 || (sz = XFTELL(file)) <= 0 ||
+            sz > MAX_WOLFSSL_FILE_SIZE) {
+        WOLFSSL_MSG("ProcessCAFileParallel file size error");
+        XFCLOSE(file);
+        return WOLFSSL_BAD_FILE;
+    }
+    XREWIND(file);
+    buff = (byte*)XMALLOC(sz, ctx->heap, DYNAMIC_TYPE_FILE);
+    if (buff == NULL) {
+        XFCLOSE(file);
+        return WOLFSSL_BAD_FILE;
+    }
+    if ((size_t)XFREAD(buff, 1, sz, file) != (size_t)sz)
+        ret = WOLFSSL_BAD_FILE;
+    else
+        ret = ProcessCABufferParallel(ctx, buff, sz, verify);
+    XFCLOSE(file);
+    XFREE(buff, ctx->heap, DYNAMIC_TYPE_FILE);
+#endif
+
+    return ret;
+}
+#endif /* WOLFSSL_PARALLEL_CA_LOAD */
+
 /* loads file then loads each file in path, no c_rehash */
 int wolfSSL_CTX_load_verify_locations_ex(WOLFSSL_CTX* ctx, const char* file,
                                      const char* path, word32 flags)
@@ -3948,6 +5498,11 @@ int wolfSSL_CTX_load_verify_locations_ex(WOLFSSL_CTX* ctx, const char* file,
         verify = VERIFY_SKIP_DATE;
 
     if (file) {
+#ifdef WOLFSSL_PARALLEL_CA_LOAD
+        if (flags & WOLFSSL_LOAD_FLAG_PARALLEL)
+            ret = ProcessCAFileParallel(ctx, file, verify);
+        else
+#endif
         ret = ProcessFile(ctx, file, WOLFSSL_FILETYPE_PEM, CA_TYPE, NULL, 0,
                           NULL, verify);
 #ifndef NO_WOLFSSL_DIR
@@ -3962,6 +5517,14 @@ int wolfSSL_CTX_load_verify_locations_ex(WOLFSSL_CTX* ctx, const char* file,
 #endif
     }
 
+#ifdef WOLFSSL_CA_HASH_DIR
+    if (ret == WOLFSSL_SUCCESS && path &&
+                                    (flags & WOLFSSL_LOAD_FLAG_HASH_DIR)) {
+        /* CAs in path are loaded when first needed */
+        ret = AddCAHashDir(ctx->cm, path, verify);
+        path = NULL;
+    }
+#endif
     if (ret == WOLFSSL_SUCCESS && path) {
 #ifndef NO_WOLFSSL_DIR
         char* name = NULL;
@@ -4120,14 +5683,14 @@ int wolfSSL_CertManagerVerify(WOLFSSL_CERT_MANAGER* cm, const char* fname,
     return ret;
 }
 
-/* like load verify locations, 1 for success, < 0 for error */
-int wolfSSL_CertManagerLoadCA(WOLFSSL_CERT_MANAGER* cm, const char* file,
-                             const char* path)
+/* like load verify locations ex, 1 for success, < 0 for error */
+int wolfSSL_CertManagerLoadCA_ex(WOLFSSL_CERT_MANAGER* cm, const char* file,
+                                 const char* path, unsigned int flags)
 {
     int ret = WOLFSSL_FATAL_ERROR;
     WOLFSSL_CTX* tmp;
 
-    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCA");
+    WOLFSSL_ENTER("wolfSSL_CertManagerLoadCA_ex");
 
     if (cm == NULL) {
         WOLFSSL_MSG("No CertManager error");
@@ -4144,7 +5707,8 @@ int wolfSSL_CertManagerLoadCA(WOLFSSL_CERT_MANAGER* cm, const char* file,
     wolfSSL_CertManagerFree(tmp->cm);
     tmp->cm = cm;
 
-    ret = wolfSSL_CTX_load_verify_locations(tmp, file, path);
+    ret = wolfSSL_CTX_load_verify_locations_ex(tmp, file, path, flags);
+    ret = WS_RETURN_CODE(ret, WOLFSSL_FAILURE);
 
     /* don't lose our good one */
     tmp->cm = NULL;
@@ -4153,6 +5717,14 @@ int wolfSSL_CertManagerLoadCA(WOLFSSL_CERT_MANAGER* cm, const char* file,
     return ret;
 }
 
+/* like load verify locations, 1 for success, < 0 for error */
+int wolfSSL_CertManagerLoadCA(WOLFSSL_CERT_MANAGER* cm, const char* file,
+                             const char* path)
+{
+    return wolfSSL_CertManagerLoadCA_ex(cm, file, path,
+                                        WOLFSSL_LOAD_VERIFY_DEFAULT_FLAGS);
+}
+
 
 #endif /* NO_FILESYSTEM */
 
@@ -4564,6 +6136,90 @@ int wolfSSL_SetTmpEC_DHE_Sz(WOLFSSL* ssl, word16 sz)
 }
 
 
+#ifdef WC_ECC_NONBLOCK
+/* Enable non-blocking ECC for handshakes on CTX. Each ECC key generation,
+ * shared secret or signature verify runs at most steps ladder steps per call
+ * and wolfSSL_connect() returns with WC_PENDING_E until it completes.
+ * steps of 0 disables non-blocking ECC. */
+int wolfSSL_CTX_UseEccNonBlock(WOLFSSL_CTX* ctx, word32 steps)
+{
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    ctx->eccNbSteps = steps;
+
+    return WOLFSSL_SUCCESS;
+}
+
+
+/* Enable non-blocking ECC for handshakes on SSL, see
+ * wolfSSL_CTX_UseEccNonBlock(). */
+int wolfSSL_UseEccNonBlock(WOLFSSL* ssl, word32 steps)
+{
+    if (ssl == NULL)
+        return BAD_FUNC_ARG;
+
+    ssl->eccNbSteps = steps;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* WC_ECC_NONBLOCK */
+
+
+/* Generate ECDHE keys for handshakes on CTX ahead of time on a background
+ * thread, keeping depth keys ready for each curve offered. Each key is used
+ * for one handshake. Call after setting the supported curves. Calling again
+ * replaces the pool and depth of 0 stops it; handshakes in progress finish
+ * with the pool they started with. Keys are not used after a fork(). */
+int wolfSSL_CTX_UseEphemeralKeyPool(WOLFSSL_CTX* ctx, word32 depth)
+{
+#ifdef WOLFSSL_EPH_KEY_POOL
+    int ret;
+
+    if (ctx == NULL || depth > EPH_KEY_POOL_MAX_DEPTH)
+        return BAD_FUNC_ARG;
+
+    if (depth == 0) {
+        FreeEphKeyPool(ctx);
+        return WOLFSSL_SUCCESS;
+    }
+
+    ret = InitEphKeyPool(ctx, depth);
+    if (ret != 0)
+        return ret;
+
+    return WOLFSSL_SUCCESS;
+#else
+    (void)ctx;
+    (void)depth;
+
+    return NOT_COMPILED_IN;
+#endif
+}
+
+
+/* Get the number of pooled keys ready for the TLS group, e.g.
+ * WOLFSSL_ECC_SECP256R1, and the number taken by handshakes so far. */
+int wolfSSL_CTX_GetEphemeralKeyPoolStats(WOLFSSL_CTX* ctx, word16 group,
+                                         word32* ready, word32* taken)
+{
+#ifdef WOLFSSL_EPH_KEY_POOL
+    if (ctx == NULL || ready == NULL || taken == NULL)
+        return BAD_FUNC_ARG;
+
+    if (EphKeyPoolStats(ctx, group, ready, taken) != 0)
+        return BAD_FUNC_ARG;
+
+    return WOLFSSL_SUCCESS;
+#else
+    (void)ctx;
+    (void)group;
+    (void)ready;
+    (void)taken;
+
+    return NOT_COMPILED_IN;
+#endif
+}
 
 
 typedef struct {
@@ -4698,6 +6354,18 @@ int wolfSSL_CTX_restore_cert_cache(WOLFSSL_CTX* ctx, const char* fname)
     return CM_RestoreCertCache(ctx->cm, fname);
 }
 
+
+/* Restore cert cache by mapping file, used in place until CAs are unloaded */
+int wolfSSL_CTX_map_cert_cache(WOLFSSL_CTX* ctx, const char* fname)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_map_cert_cache");
+
+    if (ctx == NULL || fname == NULL)
+        return BAD_FUNC_ARG;
+
+    return CM_MapCertCache(ctx->cm, fname);
+}
+
 #endif /* NO_FILESYSTEM */
 
 /* Persist cert cache to memory */
@@ -4725,6 +6393,19 @@ int wolfSSL_CTX_memrestore_cert_cache(WOLFSSL_CTX* ctx, const void* mem, int sz)
 }
 
 
+/* Restore cert cache from memory without copying, mem must stay valid until
+ * CAs are unloaded or ctx is freed */
+int wolfSSL_CTX_memmap_cert_cache(WOLFSSL_CTX* ctx, const void* mem, int sz)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_memmap_cert_cache");
+
+    if (ctx == NULL || mem == NULL || sz <= 0)
+        return BAD_FUNC_ARG;
+
+    return CM_MemMapCertCache(ctx->cm, mem, sz);
+}
+
+
 /* get how big the the cert cache save buffer needs to be */
 int wolfSSL_CTX_get_cert_cache_memsize(WOLFSSL_CTX* ctx)
 {
@@ -4764,220 +6445,302 @@ int wolfSSL_library_init(void)
 #if defined(PERSIST_CERT_CACHE)
 
 
-#define WOLFSSL_CACHE_CERT_VERSION 1
-
-typedef struct {
-    int version;                 /* cache cert layout version id */
-    int rows;                    /* hash table rows, CA_TABLE_SIZE */
-    int columns[CA_TABLE_SIZE];  /* columns per row on list */
-    int signerSz;                /* sizeof Signer object */
-} CertCacheHeader;
+#define WOLFSSL_CACHE_CERT_VERSION 2
 
 /* current cert persistence layout is:
 
-   1) CertCacheHeader
-   2) caTable
+   1) header, CERT_CACHE_HDR_SZ bytes:
+        magic, version, signer count, record size, signer digest size,
+        key id size, data size
+   2) one CERT_CACHE_REC_SZ record per signer:
+        key OID, offset and size of key, name and name constraints,
+        key usage, path lengths, flags, subject name hash, subject key id
+        hash, public key hash
+   3) data: public keys, names and name constraints
 
-   update WOLFSSL_CERT_CACHE_VERSION if change layout for the following
+   Integers are big-endian and offsets are from the start of the image so it
+   can be used in place at any address. Restoring copies the records into
+   signers and indexes them, keys and names stay in the image.
+
+   update WOLFSSL_CACHE_CERT_VERSION if change layout for the following
    PERSIST_CERT_CACHE functions
 */
 
+#define CERT_CACHE_MAGIC        "wCAC"
+#define CERT_CACHE_MAGIC_SZ     4
+#define CERT_CACHE_HDR_SZ       24
+#define CERT_CACHE_REC_HASH_IDX 36
+#define CERT_CACHE_REC_SZ       (CERT_CACHE_REC_HASH_IDX + \
+                                 2 * SIGNER_DIGEST_SIZE + KEYID_SIZE)
 
-/* Return memory needed to persist this signer, have lock */
-static WC_INLINE int GetSignerMemory(Signer* signer)
-{
-    int sz = sizeof(signer->pubKeySize) + sizeof(signer->keyOID)
-           + sizeof(signer->nameLen)    + sizeof(signer->subjectNameHash);
-
-#if !defined(NO_SKID)
-        sz += (int)sizeof(signer->subjectKeyIdHash);
-#endif
-
-    /* add dynamic bytes needed */
-    sz += signer->pubKeySize;
-    sz += signer->nameLen;
+/* record flags */
+#define CERT_CACHE_PATH_LEN_SET 0x01
+#define CERT_CACHE_SELF_SIGNED  0x02
+#define CERT_CACHE_KEY_ID_HASH  0x04    /* subject key id hash stored */
+#define CERT_CACHE_KEY_HASH     0x08    /* OCSP public key hash stored */
 
-    return sz;
-}
+/* name constraint entry is list, type, name length and name */
+#define CERT_CACHE_NC_HDR_SZ    (2 + OPAQUE32_LEN)
+#define CERT_CACHE_NC_PERMITTED 0
+#define CERT_CACHE_NC_EXCLUDED  1
 
 
-/* Return memory needed to persist this row, have lock */
-static WC_INLINE int GetCertCacheRowMemory(Signer* row)
+#ifndef IGNORE_NAME_CONSTRAINTS
+/* Return memory needed to persist name constraints list */
+static WC_INLINE word32 GetNameSubtreesMemory(const Base_entry* names)
 {
-    int sz = 0;
+    word32 sz = 0;
 
-    while (row) {
-        sz += GetSignerMemory(row);
-        row = row->next;
-    }
+    for (; names != NULL; names = names->next)
+        sz += CERT_CACHE_NC_HDR_SZ + (word32)names->nameSz;
 
     return sz;
 }
 
 
-/* get the size of persist cert cache, have lock */
-static WC_INLINE int GetCertCacheMemSize(WOLFSSL_CERT_MANAGER* cm)
+/* Store name constraints list into memory, return bytes added */
+static word32 StoreNameSubtrees(const Base_entry* names, byte list,
+                                byte* current)
 {
-    int sz;
-    int i;
+    word32 added = 0;
 
-    sz = sizeof(CertCacheHeader);
-
-    for (i = 0; i < CA_TABLE_SIZE; i++)
-        sz += GetCertCacheRowMemory(cm->caTable[i]);
+    for (; names != NULL; names = names->next) {
+        current[added++] = list;
+        current[added++] = names->type;
+        c32toa((word32)names->nameSz, current + added);
+        added += OPAQUE32_LEN;
+        XMEMCPY(current + added, names->name, names->nameSz);
+        added += (word32)names->nameSz;
+    }
 
-    return sz;
+    return added;
 }
 
 
-/* Store cert cache header columns with number of items per list, have lock */
-static WC_INLINE void SetCertHeaderColumns(WOLFSSL_CERT_MANAGER* cm, int* columns)
+/* Restore name constraints lists of signer, entries are copied as they are
+ * freed as a list */
+static int RestoreNameSubtrees(Signer* signer, const byte* current,
+                               word32 sz, void* heap)
 {
-    int     i;
-    Signer* row;
+    Base_entry** permitted = &signer->permittedNames;
+    Base_entry** excluded  = &signer->excludedNames;
+    Base_entry*** tail;
+    Base_entry*  entry;
+    word32       idx = 0;
+    word32       nameSz;
 
-    for (i = 0; i < CA_TABLE_SIZE; i++) {
-        int count = 0;
-        row = cm->caTable[i];
+    while (idx < sz) {
+        if (sz - idx < CERT_CACHE_NC_HDR_SZ)
+            return BUFFER_E;
+        if (current[idx] == CERT_CACHE_NC_PERMITTED)
+            tail = &permitted;
+        else if (current[idx] == CERT_CACHE_NC_EXCLUDED)
+            tail = &excluded;
+        else
+            return PARSE_ERROR;
+        ato32(current + idx + 2, &nameSz);
+        if (nameSz > sz - idx - CERT_CACHE_NC_HDR_SZ)
+            return BUFFER_E;
 
-        while (row) {
-            ++count;
-            row = row->next;
+        entry = (Base_entry*)XMALLOC(sizeof(Base_entry), heap,
+                                     DYNAMIC_TYPE_ALTNAME);
+        if (entry == NULL)
+            return MEMORY_E;
+        entry->name = (char*)XMALLOC(nameSz + 1, heap, DYNAMIC_TYPE_ALTNAME);
+        if (entry->name == NULL) {
+            XFREE(entry, heap, DYNAMIC_TYPE_ALTNAME);
+            return MEMORY_E;
         }
-        columns[i] = count;
+        entry->type = current[idx + 1];
+        entry->nameSz = (int)nameSz;
+        idx += CERT_CACHE_NC_HDR_SZ;
+        XMEMCPY(entry->name, current + idx, nameSz);
+        entry->name[nameSz] = '\0';
+        idx += nameSz;
+
+        /* keep order of lists */
+        entry->next = NULL;
+        **tail = entry;
+        *tail = &entry->next;
     }
+    (void)heap;
+
+    return 0;
 }
+#endif /* IGNORE_NAME_CONSTRAINTS */
 
 
-/* Restore whole cert row from memory, have lock, return bytes consumed,
-   < 0 on error, have lock */
-static WC_INLINE int RestoreCertRow(WOLFSSL_CERT_MANAGER* cm, byte* current,
-                                 int row, int listSz, const byte* end)
+/* Return data memory needed to persist this signer, have lock */
+static WC_INLINE word32 GetSignerMemory(const Signer* signer)
 {
-    int idx = 0;
+    word32 sz = signer->pubKeySize + (word32)signer->nameLen;
 
-    if (listSz < 0) {
-        WOLFSSL_MSG("Row header corrupted, negative value");
-        return PARSE_ERROR;
-    }
+#ifndef IGNORE_NAME_CONSTRAINTS
+    sz += GetNameSubtreesMemory(signer->permittedNames);
+    sz += GetNameSubtreesMemory(signer->excludedNames);
+#endif
 
-    while (listSz) {
-        Signer* signer;
-        byte*   publicKey;
-        byte*   start = current + idx;  /* for end checks on this signer */
-        int     minSz = sizeof(signer->pubKeySize) + sizeof(signer->keyOID) +
-                      sizeof(signer->nameLen) + sizeof(signer->subjectNameHash);
-        #ifndef NO_SKID
-                minSz += (int)sizeof(signer->subjectKeyIdHash);
-        #endif
+    return sz;
+}
 
-        if (start + minSz > end) {
-            WOLFSSL_MSG("Would overread restore buffer");
-            return BUFFER_E;
-        }
-        signer = MakeSigner(cm->heap);
-        if (signer == NULL)
-            return MEMORY_E;
 
-        /* pubKeySize */
-        XMEMCPY(&signer->pubKeySize, current + idx, sizeof(signer->pubKeySize));
-        idx += (int)sizeof(signer->pubKeySize);
+/* get the size of persist cert cache, have lock */
+static WC_INLINE int GetCertCacheMemSize(WOLFSSL_CERT_MANAGER* cm)
+{
+    word32  sz;
+    word32  i;
+    SignerTable* table = cm->caTable;
 
-        /* keyOID */
-        XMEMCPY(&signer->keyOID, current + idx, sizeof(signer->keyOID));
-        idx += (int)sizeof(signer->keyOID);
+    sz = CERT_CACHE_HDR_SZ;
 
-        /* publicKey */
-        if (start + minSz + signer->pubKeySize > end) {
-            WOLFSSL_MSG("Would overread restore buffer");
-            FreeSigner(signer, cm->heap);
-            return BUFFER_E;
-        }
-        publicKey = (byte*)XMALLOC(signer->pubKeySize, cm->heap,
-                                   DYNAMIC_TYPE_KEY);
-        if (publicKey == NULL) {
-            FreeSigner(signer, cm->heap);
-            return MEMORY_E;
-        }
+    for (i = 0; table != NULL && i < table->size; i++) {
+        if (table->slot[i] != NULL)
+            sz += CERT_CACHE_REC_SZ + GetSignerMemory(table->slot[i]);
+    }
 
-        XMEMCPY(publicKey, current + idx, signer->pubKeySize);
-        signer->publicKey = publicKey;
-        idx += signer->pubKeySize;
+    return (int)sz;
+}
 
-        /* nameLen */
-        XMEMCPY(&signer->nameLen, current + idx, sizeof(signer->nameLen));
-        idx += (int)sizeof(signer->nameLen);
 
-        /* name */
-        if (start + minSz + signer->pubKeySize + signer->nameLen > end) {
-            WOLFSSL_MSG("Would overread restore buffer");
-            FreeSigner(signer, cm->heap);
-            return BUFFER_E;
-        }
-        signer->name = (char*)XMALLOC(signer->nameLen, cm->heap,
-                                      DYNAMIC_TYPE_SUBJECT_CN);
-        if (signer->name == NULL) {
-            FreeSigner(signer, cm->heap);
-            return MEMORY_E;
-        }
+/* Store signer record at current and its data at offset data of image,
+ * have lock, return bytes of data added */
+static word32 StoreCertRecord(const Signer* signer, byte* current,
+                              byte* image, word32 data)
+{
+    word32 added = 0;
+    byte   flags = 0;
 
-        XMEMCPY(signer->name, current + idx, signer->nameLen);
-        idx += signer->nameLen;
+    XMEMSET(current, 0, CERT_CACHE_REC_SZ);
+    c32toa(signer->keyOID, current);
 
-        /* subjectNameHash */
-        XMEMCPY(signer->subjectNameHash, current + idx, SIGNER_DIGEST_SIZE);
-        idx += SIGNER_DIGEST_SIZE;
+    c32toa(data + added, current + 4);
+    c32toa(signer->pubKeySize, current + 8);
+    if (signer->pubKeySize > 0)
+        XMEMCPY(image + data + added, signer->publicKey, signer->pubKeySize);
+    added += signer->pubKeySize;
 
-        #ifndef NO_SKID
-            /* subjectKeyIdHash */
-            XMEMCPY(signer->subjectKeyIdHash, current + idx,SIGNER_DIGEST_SIZE);
-            idx += SIGNER_DIGEST_SIZE;
-        #endif
+    c32toa(data + added, current + 12);
+    c32toa((word32)signer->nameLen, current + 16);
+    if (signer->nameLen > 0)
+        XMEMCPY(image + data + added, signer->name, signer->nameLen);
+    added += (word32)signer->nameLen;
 
-        signer->next = cm->caTable[row];
-        cm->caTable[row] = signer;
+    c32toa(data + added, current + 20);
+#ifndef IGNORE_NAME_CONSTRAINTS
+    {
+        word32 ncSz;
 
-        --listSz;
+        ncSz  = StoreNameSubtrees(signer->permittedNames,
+                    CERT_CACHE_NC_PERMITTED, image + data + added);
+        ncSz += StoreNameSubtrees(signer->excludedNames,
+                    CERT_CACHE_NC_EXCLUDED, image + data + added + ncSz);
+        c32toa(ncSz, current + 24);
+        added += ncSz;
     }
+#endif
 
-    return idx;
+    c16toa(signer->keyUsage, current + 28);
+    current[30] = signer->maxPathLen;
+    current[31] = signer->pathLength;
+
+    XMEMCPY(current + CERT_CACHE_REC_HASH_IDX, signer->subjectNameHash,
+            SIGNER_DIGEST_SIZE);
+#ifndef NO_SKID
+    XMEMCPY(current + CERT_CACHE_REC_HASH_IDX + SIGNER_DIGEST_SIZE,
+            signer->subjectKeyIdHash, SIGNER_DIGEST_SIZE);
+    flags |= CERT_CACHE_KEY_ID_HASH;
+#endif
+#ifdef HAVE_OCSP
+    XMEMCPY(current + CERT_CACHE_REC_HASH_IDX + 2 * SIGNER_DIGEST_SIZE,
+            signer->subjectKeyHash, KEYID_SIZE);
+    flags |= CERT_CACHE_KEY_HASH;
+#endif
+    if (signer->pathLengthSet)
+        flags |= CERT_CACHE_PATH_LEN_SET;
+    if (signer->selfSigned)
+        flags |= CERT_CACHE_SELF_SIGNED;
+    current[32] = flags;
+
+    return added;
 }
 
 
-/* Store whole cert row into memory, have lock, return bytes added */
-static WC_INLINE int StoreCertRow(WOLFSSL_CERT_MANAGER* cm, byte* current, int row)
+/* Is [idx, idx + sz) inside [start, end) */
+static WC_INLINE int CertCacheInRange(word32 idx, word32 sz, word32 start,
+                                      word32 end)
 {
-    int     added  = 0;
-    Signer* list   = cm->caTable[row];
-
-    while (list) {
-        XMEMCPY(current + added, &list->pubKeySize, sizeof(list->pubKeySize));
-        added += (int)sizeof(list->pubKeySize);
+    return idx >= start && idx <= end && sz <= end - idx;
+}
 
-        XMEMCPY(current + added, &list->keyOID,     sizeof(list->keyOID));
-        added += (int)sizeof(list->keyOID);
 
-        XMEMCPY(current + added, list->publicKey, list->pubKeySize);
-        added += list->pubKeySize;
+/* Restore signer from record at current, key and name are left in image,
+ * data of image is [start, end) */
+static int RestoreCertRecord(Signer* signer, const byte* current,
+                             const byte* image, word32 start, word32 end,
+                             void* heap)
+{
+    word32 keyIdx, keySz, nameIdx, nameSz, ncIdx, ncSz;
+    byte   flags = current[32];
 
-        XMEMCPY(current + added, &list->nameLen, sizeof(list->nameLen));
-        added += (int)sizeof(list->nameLen);
+    ato32(current,      &signer->keyOID);
+    ato32(current + 4,  &keyIdx);
+    ato32(current + 8,  &keySz);
+    ato32(current + 12, &nameIdx);
+    ato32(current + 16, &nameSz);
+    ato32(current + 20, &ncIdx);
+    ato32(current + 24, &ncSz);
 
-        XMEMCPY(current + added, list->name, list->nameLen);
-        added += list->nameLen;
+    if (!CertCacheInRange(keyIdx, keySz, start, end) ||
+        !CertCacheInRange(nameIdx, nameSz, start, end) ||
+        !CertCacheInRange(ncIdx, ncSz, start, end)) {
+        WOLFSSL_MSG("Would overread restore buffer");
+        return BUFFER_E;
+    }
 
-        XMEMCPY(current + added, list->subjectNameHash, SIGNER_DIGEST_SIZE);
-        added += SIGNER_DIGEST_SIZE;
+    signer->inStore    = 1;
+    signer->publicKey  = image + keyIdx;
+    signer->pubKeySize = keySz;
+    if (nameSz > 0) {
+        signer->name    = (char*)(image + nameIdx);
+        signer->nameLen = (int)nameSz;
+    }
 
-        #ifndef NO_SKID
-            XMEMCPY(current + added, list->subjectKeyIdHash,SIGNER_DIGEST_SIZE);
-            added += SIGNER_DIGEST_SIZE;
-        #endif
+    ato16(current + 28, &signer->keyUsage);
+    signer->maxPathLen    = current[30];
+    signer->pathLength    = current[31];
+    signer->pathLengthSet = (flags & CERT_CACHE_PATH_LEN_SET) != 0;
+    signer->selfSigned    = (flags & CERT_CACHE_SELF_SIGNED) != 0;
 
-        list = list->next;
+    XMEMCPY(signer->subjectNameHash, current + CERT_CACHE_REC_HASH_IDX,
+            SIGNER_DIGEST_SIZE);
+#ifndef NO_SKID
+    if ((flags & CERT_CACHE_KEY_ID_HASH) == 0) {
+        WOLFSSL_MSG("Cert cache saved without subject key id");
+        return CACHE_MATCH_ERROR;
+    }
+    XMEMCPY(signer->subjectKeyIdHash,
+            current + CERT_CACHE_REC_HASH_IDX + SIGNER_DIGEST_SIZE,
+            SIGNER_DIGEST_SIZE);
+#endif
+#ifdef HAVE_OCSP
+    if (flags & CERT_CACHE_KEY_HASH) {
+        XMEMCPY(signer->subjectKeyHash,
+                current + CERT_CACHE_REC_HASH_IDX + 2 * SIGNER_DIGEST_SIZE,
+                KEYID_SIZE);
+    }
+    else if (CalcKeyHashId(signer->publicKey, signer->pubKeySize,
+                           signer->keyOID, signer->subjectKeyHash) != 0) {
+        return PARSE_ERROR;
     }
+#endif
 
-    return added;
+#ifndef IGNORE_NAME_CONSTRAINTS
+    if (ncSz > 0)
+        return RestoreNameSubtrees(signer, image + ncIdx, ncSz, heap);
+#endif
+    (void)heap;
+
+    return 0;
 }
 
 
@@ -4987,7 +6750,6 @@ static WC_INLINE int DoMemSaveCertCache(WOLFSSL_CERT_MANAGER* cm,
 {
     int realSz;
     int ret = WOLFSSL_SUCCESS;
-    int i;
 
     WOLFSSL_ENTER("DoMemSaveCertCache");
 
@@ -4997,21 +6759,142 @@ static WC_INLINE int DoMemSaveCertCache(WOLFSSL_CERT_MANAGER* cm,
         ret = BUFFER_E;
     }
     else {
-        byte*           current;
-        CertCacheHeader hdr;
+        byte*        image = (byte*)mem;
+        byte*        current = image + CERT_CACHE_HDR_SZ;
+        SignerTable* table = cm->caTable;
+        word32       count = (table == NULL) ? 0 : table->used;
+        word32       start = CERT_CACHE_HDR_SZ + count * CERT_CACHE_REC_SZ;
+        word32       data = start;
+        word32       i;
+
+        XMEMCPY(image, CERT_CACHE_MAGIC, CERT_CACHE_MAGIC_SZ);
+        c32toa(WOLFSSL_CACHE_CERT_VERSION, image + 4);
+        c32toa(count, image + 8);
+        c32toa(CERT_CACHE_REC_SZ, image + 12);
+        c16toa(SIGNER_DIGEST_SIZE, image + 16);
+        c16toa(KEYID_SIZE, image + 18);
+
+        for (i = 0; table != NULL && i < table->size; i++) {
+            if (table->slot[i] != NULL) {
+                data += StoreCertRecord(table->slot[i], current, image, data);
+                current += CERT_CACHE_REC_SZ;
+            }
+        }
+
+        c32toa(data - start, image + 20);
+    }
+
+    return ret;
+}
+
+
+/* Restore signers from cert cache image replacing the CA table. The image is
+ * used in place, on success the cert manager takes ownership of it as
+ * imageType says. */
+static int LoadCertCacheImage(WOLFSSL_CERT_MANAGER* cm, const byte* image,
+                              word32 sz, byte imageType)
+{
+    int             ret = WOLFSSL_SUCCESS;
+    CertCacheStore* store;
+    word32          version, count, recSz, dataSz, start, i;
+    word16          digestSz, keyIdSz;
+
+    if (sz < CERT_CACHE_HDR_SZ) {
+        WOLFSSL_MSG("Cert Cache Memory buffer too small");
+        return BUFFER_E;
+    }
+
+    ato32(image + 4,  &version);
+    ato32(image + 8,  &count);
+    ato32(image + 12, &recSz);
+    ato16(image + 16, &digestSz);
+    ato16(image + 18, &keyIdSz);
+    ato32(image + 20, &dataSz);
+
+    if (XMEMCMP(image, CERT_CACHE_MAGIC, CERT_CACHE_MAGIC_SZ) != 0 ||
+        version  != WOLFSSL_CACHE_CERT_VERSION ||
+        recSz    != CERT_CACHE_REC_SZ ||
+        digestSz != SIGNER_DIGEST_SIZE ||
+        keyIdSz  != KEYID_SIZE) {
+
+        WOLFSSL_MSG("Cert Cache Memory header mismatch");
+        return CACHE_MATCH_ERROR;
+    }
+
+    if (count > (sz - CERT_CACHE_HDR_SZ) / CERT_CACHE_REC_SZ) {
+        WOLFSSL_MSG("Cert Cache Memory buffer too small");
+        return BUFFER_E;
+    }
+    start = CERT_CACHE_HDR_SZ + count * CERT_CACHE_REC_SZ;
+    if (dataSz > sz - start) {
+        WOLFSSL_MSG("Cert Cache Memory buffer too small");
+        return BUFFER_E;
+    }
+
+    store = (CertCacheStore*)XMALLOC(sizeof(CertCacheStore), cm->heap,
+                                     DYNAMIC_TYPE_CERT_CACHE);
+    if (store == NULL)
+        return MEMORY_E;
+    XMEMSET(store, 0, sizeof(CertCacheStore));
+    store->image     = image;
+    store->imageSz   = sz;
+    store->imageType = CERT_CACHE_IMAGE_USER; /* not owned until success */
+
+    if (count > 0) {
+        store->signers = (Signer*)XMALLOC(count * sizeof(Signer), cm->heap,
+                                          DYNAMIC_TYPE_SIGNER);
+        if (store->signers == NULL)
+            ret = MEMORY_E;
+        else
+            XMEMSET(store->signers, 0, count * sizeof(Signer));
+    }
+    for (i = 0; ret == WOLFSSL_SUCCESS && i < count; i++) {
+        ret = RestoreCertRecord(&store->signers[i],
+                                image + CERT_CACHE_HDR_SZ +
+                                i * CERT_CACHE_REC_SZ,
+                                image, start, start + dataSz, cm->heap);
+        store->count = i + 1;
+        if (ret != 0)
+            WOLFSSL_MSG("RestoreCertRecord error");
+        else
+            ret = WOLFSSL_SUCCESS;
+    }
+
+    if (ret == WOLFSSL_SUCCESS && wc_LockMutex(&cm->caLock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex on caLock failed");
+        ret = BAD_MUTEX_E;
+    }
+    if (ret == WOLFSSL_SUCCESS) {
+        FreeCATable(cm);
 
-        hdr.version  = WOLFSSL_CACHE_CERT_VERSION;
-        hdr.rows     = CA_TABLE_SIZE;
-        SetCertHeaderColumns(cm, hdr.columns);
-        hdr.signerSz = (int)sizeof(Signer);
+        ret = GrowCATable(cm, count);
+        if (ret == 0) {
+            for (i = 0; i < count; i++) {
+                Signer* signer = &store->signers[i];
+
+                if (FindSigner(cm->caTable, SignerHash(signer)) != NULL)
+                    continue;
+                PutSigner(cm->caTable, signer);
+            #ifndef NO_SKID
+                PutSigner(cm->caNameTable, signer);
+            #endif
+            }
+            store->imageType = imageType;
+            store->next = cm->caStore;
+            cm->caStore = store;
+            store = NULL;
+            ret = WOLFSSL_SUCCESS;
+        }
 
-        XMEMCPY(mem, &hdr, sizeof(CertCacheHeader));
-        current = (byte*)mem + sizeof(CertCacheHeader);
+        wc_UnLockMutex(&cm->caLock);
 
-        for (i = 0; i < CA_TABLE_SIZE; ++i)
-            current += StoreCertRow(cm, current, i);
+    #ifdef WOLFSSL_CERT_VERIFY_CACHE
+        FlushCertVerifyCache(cm);
+    #endif
     }
 
+    FreeCertCacheStores(store, cm->heap);
+
     return ret;
 }
 
@@ -5064,7 +6947,7 @@ int CM_SaveCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname)
 }
 
 
-/* Restore cert cache from file */
+/* Restore cert cache from file, the file is read once and used in place */
 int CM_RestoreCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname)
 {
     XFILE file;
@@ -5094,7 +6977,7 @@ int CM_RestoreCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname)
         return WOLFSSL_BAD_FILE;
     }
 
-    mem = (byte*)XMALLOC(memSz, cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    mem = (byte*)XMALLOC(memSz, cm->heap, DYNAMIC_TYPE_CERT_CACHE);
     if (mem == NULL) {
         WOLFSSL_MSG("Alloc for tmp buffer failed");
         XFCLOSE(file);
@@ -5106,18 +6989,66 @@ int CM_RestoreCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname)
         WOLFSSL_MSG("Cert file read error");
         rc = FREAD_ERROR;
     } else {
-        rc = CM_MemRestoreCertCache(cm, mem, memSz);
+        rc = LoadCertCacheImage(cm, mem, (word32)memSz,
+                                CERT_CACHE_IMAGE_HEAP);
         if (rc != WOLFSSL_SUCCESS) {
             WOLFSSL_MSG("Mem restore cert cache failed");
         }
     }
 
-    XFREE(mem, cm->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (rc != WOLFSSL_SUCCESS)
+        XFREE(mem, cm->heap, DYNAMIC_TYPE_CERT_CACHE);
     XFCLOSE(file);
 
     return rc;
 }
 
+
+/* Map cert cache file and use it in place. The file must not be truncated
+ * or rewritten while the CA table is in use. Without mmap the file is
+ * read as in CM_RestoreCertCache. */
+int CM_MapCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname)
+{
+#ifdef WOLFSSL_CERT_CACHE_MMAP
+    int         fd;
+    int         rc;
+    struct stat st;
+    void*       mem;
+
+    WOLFSSL_ENTER("CM_MapCertCache");
+
+    fd = open(fname, O_RDONLY);
+    if (fd < 0) {
+        WOLFSSL_MSG("Couldn't open cert cache save file");
+        return WOLFSSL_BAD_FILE;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+            (unsigned long)st.st_size > 0x7FFFFFFFUL) {
+        WOLFSSL_MSG("CM_MapCertCache file size error");
+        close(fd);
+        return WOLFSSL_BAD_FILE;
+    }
+
+    mem = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        WOLFSSL_MSG("Cert cache mmap failed");
+        return WOLFSSL_BAD_FILE;
+    }
+
+    rc = LoadCertCacheImage(cm, (const byte*)mem, (word32)st.st_size,
+                            CERT_CACHE_IMAGE_MMAP);
+    if (rc != WOLFSSL_SUCCESS) {
+        WOLFSSL_MSG("Mapped cert cache restore failed");
+        munmap(mem, (size_t)st.st_size);
+    }
+
+    return rc;
+#else
+    return CM_RestoreCertCache(cm, fname);
+#endif
+}
+
 #endif /* NO_FILESYSTEM */
 
 
@@ -5143,50 +7074,43 @@ int CM_MemSaveCertCache(WOLFSSL_CERT_MANAGER* cm, void* mem, int sz, int* used)
 }
 
 
-/* Restore cert cache from memory */
+/* Restore cert cache from memory, mem is copied and may be freed after */
 int CM_MemRestoreCertCache(WOLFSSL_CERT_MANAGER* cm, const void* mem, int sz)
 {
-    int ret = WOLFSSL_SUCCESS;
-    int i;
-    CertCacheHeader* hdr = (CertCacheHeader*)mem;
-    byte*            current = (byte*)mem + sizeof(CertCacheHeader);
-    byte*            end     = (byte*)mem + sz;  /* don't go over */
+    int   ret;
+    byte* image;
 
     WOLFSSL_ENTER("CM_MemRestoreCertCache");
 
-    if (current > end) {
+    if (sz < CERT_CACHE_HDR_SZ) {
         WOLFSSL_MSG("Cert Cache Memory buffer too small");
         return BUFFER_E;
     }
 
-    if (hdr->version  != WOLFSSL_CACHE_CERT_VERSION ||
-        hdr->rows     != CA_TABLE_SIZE ||
-        hdr->signerSz != (int)sizeof(Signer)) {
+    image = (byte*)XMALLOC(sz, cm->heap, DYNAMIC_TYPE_CERT_CACHE);
+    if (image == NULL)
+        return MEMORY_E;
+    XMEMCPY(image, mem, sz);
 
-        WOLFSSL_MSG("Cert Cache Memory header mismatch");
-        return CACHE_MATCH_ERROR;
-    }
+    ret = LoadCertCacheImage(cm, image, (word32)sz, CERT_CACHE_IMAGE_HEAP);
+    if (ret != WOLFSSL_SUCCESS)
+        XFREE(image, cm->heap, DYNAMIC_TYPE_CERT_CACHE);
 
-    if (wc_LockMutex(&cm->caLock) != 0) {
-        WOLFSSL_MSG("wc_LockMutex on caLock failed");
-        return BAD_MUTEX_E;
-    }
+    return ret;
+}
 
-    FreeSignerTable(cm->caTable, CA_TABLE_SIZE, cm->heap);
 
-    for (i = 0; i < CA_TABLE_SIZE; ++i) {
-        int added = RestoreCertRow(cm, current, i, hdr->columns[i], end);
-        if (added < 0) {
-            WOLFSSL_MSG("RestoreCertRow error");
-            ret = added;
-            break;
-        }
-        current += added;
-    }
+/* Restore cert cache from memory used in place, mem must stay valid and
+ * unchanged until the CA table is freed */
+int CM_MemMapCertCache(WOLFSSL_CERT_MANAGER* cm, const void* mem, int sz)
+{
+    WOLFSSL_ENTER("CM_MemMapCertCache");
 
-    wc_UnLockMutex(&cm->caLock);
+    if (sz <= 0)
+        return BUFFER_E;
 
-    return ret;
+    return LoadCertCacheImage(cm, (const byte*)mem, (word32)sz,
+                              CERT_CACHE_IMAGE_USER);
 }
 
 
@@ -5452,6 +7376,11 @@ void wolfSSL_dtls_set_using_nonblock(WOLFSSL* ssl, int nonblock)
 
 
         if (ssl->buffers.outputBuffer.length > 0
+        #ifdef WC_ECC_NONBLOCK
+            /* do not send buffered or advance state if last error was an
+                non-blocking ECC operation pending */
+            && ssl->error != WC_PENDING_E
+        #endif
         ) {
             if ( (ssl->error = SendBuffered(ssl)) == 0) {
                 /* fragOffset is non-zero when sending fragments. On the last
@@ -6707,7 +8636,16 @@ const char* wolfSSL_get_curve_name(WOLFSSL* ssl)
         cName = wolfssl_ffdhe_name(ssl->namedGroup);
     }
 
-
+#ifdef HAVE_CURVE25519
+    if (ssl->ecdhCurveOID == ECC_X25519_OID && cName == NULL) {
+        cName = "X25519";
+    }
+#endif
+#ifdef HAVE_CURVE448
+    if (ssl->ecdhCurveOID == ECC_X448_OID && cName == NULL) {
+        cName = "X448";
+    }
+#endif
 
     if (ssl->ecdhCurveOID != 0 && cName == NULL) {
         cName = wc_ecc_get_name(wc_ecc_get_oid(ssl->ecdhCurveOID, NULL,
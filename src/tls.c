@@ -1932,12 +1932,241 @@ int TLSX_UseTrustedCA(TLSX** extensions, byte type,
 /* Certificate Status Request                                                 */
 /******************************************************************************/
 
+#ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+
+static void TLSX_CSR_Free(CertificateStatusRequest* csr, void* heap)
+{
+    switch (csr->status_type) {
+        case WOLFSSL_CSR_OCSP:
+            FreeOcspRequest(&csr->request.ocsp);
+        break;
+    }
+
+    XFREE(csr, heap, DYNAMIC_TYPE_TLSX);
+    (void)heap;
+}
+
+static word16 TLSX_CSR_GetSize(CertificateStatusRequest* csr, byte isRequest)
+{
+    word16 size = 0;
+
+    /* the server side isn't supported, nothing is sent in the response */
+    if (isRequest) {
+        switch (csr->status_type) {
+            case WOLFSSL_CSR_OCSP:
+                size += ENUM_LEN + 2 * OPAQUE16_LEN;
+
+                if (csr->request.ocsp.nonceSz)
+                    size += (word16)EncodeOcspRequestExtensions(
+                                                 &csr->request.ocsp, NULL, 0);
+            break;
+        }
+    }
+
+    return size;
+}
+
+static word16 TLSX_CSR_Write(CertificateStatusRequest* csr, byte* output,
+                                                                 byte isRequest)
+{
+    word16 offset = 0;
+    word16 length = 0;
+
+    if (isRequest) {
+        /* type */
+        output[offset++] = csr->status_type;
+
+        switch (csr->status_type) {
+            case WOLFSSL_CSR_OCSP:
+                /* responder id list - empty, any responder */
+                c16toa(0, output + offset);
+                offset += OPAQUE16_LEN;
+
+                /* request extensions */
+                if (csr->request.ocsp.nonceSz)
+                    length = (word16)EncodeOcspRequestExtensions(
+                                &csr->request.ocsp,
+                                output + offset + OPAQUE16_LEN,
+                                OCSP_NONCE_EXT_SZ);
+
+                c16toa(length, output + offset);
+                offset += OPAQUE16_LEN + length;
+            break;
+        }
+    }
+
+    return offset;
+}
+
+static int TLSX_CSR_Parse(WOLFSSL* ssl, const byte* input, word16 length,
+                                                                 byte isRequest)
+{
+    int ret;
+    TLSX* extension;
+    CertificateStatusRequest* csr;
+
+    (void)input;
+
+    /* only the client side is supported, a request is ignored */
+    if (isRequest)
+        return 0;
+
+    extension = TLSX_Find(ssl->extensions, TLSX_STATUS_REQUEST);
+    csr = extension ? (CertificateStatusRequest*)extension->data : NULL;
+
+    if (!csr) {
+        /* look at context level */
+        extension = TLSX_Find(ssl->ctx->extensions, TLSX_STATUS_REQUEST);
+        csr = extension ? (CertificateStatusRequest*)extension->data : NULL;
+
+        if (!csr)
+            return BUFFER_ERROR; /* unexpected extension */
+
+        /* the request is filled in from the server's certificate, enable
+         * the extension at ssl level so the context stays untouched. The
+         * ClientHello had no nonce, don't make one up now. */
+        ret = TLSX_UseCertificateStatusRequest(&ssl->extensions,
+                                  csr->status_type,
+                                  csr->options & ~WOLFSSL_CSR_OCSP_USE_NONCE,
+                                  ssl, ssl->heap);
+        if (ret != WOLFSSL_SUCCESS)
+            return ret;
+    }
+
+    ssl->status_request = 1;
+
+    return length ? BUFFER_ERROR : 0; /* extension_data MUST be empty. */
+}
+
+int TLSX_CSR_InitRequest(TLSX* extensions, DecodedCert* cert, void* heap)
+{
+    TLSX* extension = TLSX_Find(extensions, TLSX_STATUS_REQUEST);
+    CertificateStatusRequest* csr = extension ?
+        (CertificateStatusRequest*)extension->data : NULL;
+    int ret = 0;
+
+    if (csr) {
+        switch (csr->status_type) {
+            case WOLFSSL_CSR_OCSP: {
+                byte nonce[MAX_OCSP_NONCE_SZ];
+                int  nonceSz = csr->request.ocsp.nonceSz;
+
+                /* preserve nonce */
+                XMEMCPY(nonce, csr->request.ocsp.nonce, nonceSz);
+
+                FreeOcspRequest(&csr->request.ocsp);
+                if ((ret = InitOcspRequest(&csr->request.ocsp, cert, 0, heap))
+                                                                         != 0)
+                    return ret;
+
+                /* restore nonce */
+                XMEMCPY(csr->request.ocsp.nonce, nonce, nonceSz);
+                csr->request.ocsp.nonceSz = nonceSz;
+                csr->request.ocsp.ssl = csr->ssl;
+            }
+            break;
+        }
+    }
+
+    return ret;
+}
+
+void* TLSX_CSR_GetRequest(TLSX* extensions)
+{
+    TLSX* extension = TLSX_Find(extensions, TLSX_STATUS_REQUEST);
+    CertificateStatusRequest* csr = extension ?
+        (CertificateStatusRequest*)extension->data : NULL;
+
+    if (csr) {
+        switch (csr->status_type) {
+            case WOLFSSL_CSR_OCSP:
+                return &csr->request.ocsp;
+        }
+    }
+
+    return NULL;
+}
+
+/* The server acked the extension but sent no CertificateStatus, ask the
+ * responder instead unless a staple is required */
+int TLSX_CSR_ForceRequest(WOLFSSL* ssl)
+{
+    TLSX* extension = TLSX_Find(ssl->extensions, TLSX_STATUS_REQUEST);
+    CertificateStatusRequest* csr = extension ?
+        (CertificateStatusRequest*)extension->data : NULL;
+
+    if (csr) {
+        switch (csr->status_type) {
+            case WOLFSSL_CSR_OCSP:
+                if (SSL_CM(ssl)->ocspMustStaple)
+                    return BAD_CERTIFICATE_STATUS_ERROR;
+                if (SSL_CM(ssl)->ocspEnabled)
+                    return CheckOcspRequest(SSL_CM(ssl)->ocsp,
+                                            &csr->request.ocsp);
+                else
+                    return OCSP_LOOKUP_FAIL;
+        }
+    }
+
+    return 0;
+}
+
+int TLSX_UseCertificateStatusRequest(TLSX** extensions, byte status_type,
+                                           byte options, WOLFSSL* ssl, void* heap)
+{
+    CertificateStatusRequest* csr = NULL;
+    int ret = 0;
+
+    if (!extensions || status_type != WOLFSSL_CSR_OCSP)
+        return BAD_FUNC_ARG;
+
+    csr = (CertificateStatusRequest*)
+             XMALLOC(sizeof(CertificateStatusRequest), heap, DYNAMIC_TYPE_TLSX);
+    if (!csr)
+        return MEMORY_E;
+
+    ForceZero(csr, sizeof(CertificateStatusRequest));
+
+    csr->status_type = status_type;
+    csr->options     = options;
+    csr->ssl         = ssl;
+
+    switch (csr->status_type) {
+        case WOLFSSL_CSR_OCSP:
+            /* a context has no rng, its connections send no nonce */
+            if (options & WOLFSSL_CSR_OCSP_USE_NONCE && ssl != NULL) {
+                ret = wc_RNG_GenerateBlock(ssl->rng, csr->request.ocsp.nonce,
+                                                            MAX_OCSP_NONCE_SZ);
+                if (ret == 0)
+                    csr->request.ocsp.nonceSz = MAX_OCSP_NONCE_SZ;
+            }
+        break;
+    }
+
+    if (ret == 0)
+        ret = TLSX_Push(extensions, TLSX_STATUS_REQUEST, csr, heap);
+    if (ret != 0) {
+        XFREE(csr, heap, DYNAMIC_TYPE_TLSX);
+        return ret;
+    }
+
+    return WOLFSSL_SUCCESS;
+}
+
+#define CSR_FREE_ALL TLSX_CSR_Free
+#define CSR_GET_SIZE TLSX_CSR_GetSize
+#define CSR_WRITE    TLSX_CSR_Write
+#define CSR_PARSE    TLSX_CSR_Parse
+
+#else
 
 #define CSR_FREE_ALL(data, heap)
 #define CSR_GET_SIZE(a, b)    0
 #define CSR_WRITE(a, b, c)    0
 #define CSR_PARSE(a, b, c, d) 0
 
+#endif /* HAVE_CERTIFICATE_STATUS_REQUEST */
+
 
 /******************************************************************************/
 /* Certificate Status Request v2                                              */
@@ -3246,11 +3475,21 @@ static int TLSX_PopulateSupportedGroups(WOLFSSL* ssl, TLSX** extensions)
 //        #endif
 
 
+        #if defined(HAVE_CURVE25519) && ECC_MIN_KEY_SZ <= 256
+                ret = TLSX_UseSupportedCurve(extensions,
+                                                   WOLFSSL_ECC_X25519, ssl->heap);
+                if (ret != WOLFSSL_SUCCESS) return ret;
+        #endif
         #if ECC_MIN_KEY_SZ <= 256
                 ret = TLSX_UseSupportedCurve(extensions,
                                               WOLFSSL_ECC_SECP256R1, ssl->heap);
                 if (ret != WOLFSSL_SUCCESS) return ret;
         #endif
+        #if defined(HAVE_CURVE448) && ECC_MIN_KEY_SZ <= 448
+                ret = TLSX_UseSupportedCurve(extensions,
+                                                     WOLFSSL_ECC_X448, ssl->heap);
+                if (ret != WOLFSSL_SUCCESS) return ret;
+        #endif
 
 
 //        #if ECC_MIN_KEY_SZ <= 224
@@ -1092,6 +1092,69 @@ static void test_wolfSSL_CTX_load_verify_locations(void)
 #endif
 }
 
+static void test_wolfSSL_CTX_memmap_cert_cache(void)
+{
+#if defined(PERSIST_CERT_CACHE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && !defined(NO_RSA)
+    WOLFSSL_CTX* ctx;
+    WOLFSSL_CTX* mapCtx;
+    WOLFSSL_CERT_MANAGER* cm;
+    byte* cache;
+    int   cacheSz;
+    int   used;
+
+    printf(testingFmt, "wolfSSL_CTX_memmap_cert_cache()");
+
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfSSLv23_client_method()));
+    AssertNotNull(mapCtx = wolfSSL_CTX_new(wolfSSLv23_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(ctx, caCertFile, NULL),
+                WOLFSSL_SUCCESS);
+
+    AssertIntGT(cacheSz = wolfSSL_CTX_get_cert_cache_memsize(ctx), 0);
+    AssertNotNull(cache = (byte*)XMALLOC(cacheSz, NULL,
+                                         DYNAMIC_TYPE_TMP_BUFFER));
+    AssertIntEQ(wolfSSL_CTX_memsave_cert_cache(ctx, cache, cacheSz, &used),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(used, cacheSz);
+
+    AssertIntEQ(wolfSSL_CTX_memmap_cert_cache(NULL, cache, cacheSz),
+                BAD_FUNC_ARG);
+    AssertNotNull(cm = wolfSSL_CTX_GetCertManager(mapCtx));
+    AssertIntNE(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    /* signers are used in place from the image */
+    AssertIntEQ(wolfSSL_CTX_memmap_cert_cache(mapCtx, cache, cacheSz),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_get_cert_cache_memsize(mapCtx), cacheSz);
+
+    /* a bad image leaves the CA table as it was */
+    cache[0] ^= 0x01;
+    AssertIntEQ(wolfSSL_CTX_memrestore_cert_cache(mapCtx, cache, cacheSz),
+                CACHE_MATCH_ERROR);
+    cache[0] ^= 0x01;
+    AssertIntEQ(wolfSSL_CTX_memrestore_cert_cache(mapCtx, cache, cacheSz - 1),
+                BUFFER_E);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    /* restoring copies the image */
+    AssertIntEQ(wolfSSL_CTX_memrestore_cert_cache(mapCtx, cache, cacheSz),
+                WOLFSSL_SUCCESS);
+    XMEMSET(cache, 0, cacheSz);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    XFREE(cache, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wolfSSL_CTX_free(mapCtx);
+    wolfSSL_CTX_free(ctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
 #if !defined(NO_FILESYSTEM) && !defined(NO_CERTS)
 static int test_cm_load_ca_buffer(const byte* cert_buf, size_t cert_sz, int file_type)
 {
@@ -1474,6 +1537,40 @@ static int test_wolfSSL_CertManagerSetVerify(void)
     return ret;
 }
 
+static void test_wolfSSL_CertManagerVerifyCache(void)
+{
+#if defined(WOLFSSL_CERT_VERIFY_CACHE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_RSA)
+    WOLFSSL_CERT_MANAGER* cm;
+    const char* ca_cert = "./certs/ca-cert.pem";
+    const char* server_cert = "./certs/server-cert.pem";
+
+    printf(testingFmt, "wolfSSL_CertManagerVerifyCache()");
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, ca_cert, NULL), WOLFSSL_SUCCESS);
+
+    /* first verify fills cache, second is served from it */
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, server_cert,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, server_cert,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    /* cached result must not outlive the CA */
+    AssertIntEQ(wolfSSL_CertManagerUnloadCAs(cm), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, server_cert,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+
+    AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, ca_cert, NULL), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, server_cert,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    wolfSSL_CertManagerFree(cm);
+
+    printf(resultFmt, passed);
+#endif
+}
+
 #if !defined(NO_FILESYSTEM) && defined(OPENSSL_EXTRA) && \
     defined(DEBUG_UNIT_TEST_CERTS)
 /* Used when debugging name constraint tests. Not static to allow use in
@@ -2268,9 +2365,23 @@ static void test_wolfSSL_CertManagerCRL(void)
     const char* ca_cert = "./certs/ca-cert.pem";
     const char* crl1     = "./certs/crl/crl.pem";
     const char* crl2     = "./certs/crl/crl2.pem";
+    const char* crlDir   = "./certs/crl";
+    const char* crlOld   = "./certs/crl/caCrlOld.pem";
+    const char* crlNew   = "./certs/crl/caCrlNew.pem";
+    const char* cliCrl   = "./certs/crl/cliCrl.pem";
+    const char* revoked  = "./certs/server-revoked-cert.pem";
+    byte*  pem = NULL;
+    size_t pemSz = 0;
+    byte   der[4096];
+    int    derSz;
 
     WOLFSSL_CERT_MANAGER* cm = NULL;
 
+    AssertIntEQ(load_file(revoked, &pem, &pemSz), 0);
+    AssertIntGT(derSz = wc_CertPemToDer(pem, (int)pemSz, der, (int)sizeof(der),
+                                        CERT_TYPE), 0);
+    free(pem);
+
     AssertNotNull(cm = wolfSSL_CertManagerNew());
     AssertIntEQ(WOLFSSL_SUCCESS,
         wolfSSL_CertManagerLoadCA(cm, ca_cert, NULL));
@@ -2278,14 +2389,837 @@ static void test_wolfSSL_CertManagerCRL(void)
         wolfSSL_CertManagerLoadCRL(cm, crl1, WOLFSSL_FILETYPE_PEM, 0));
     AssertIntEQ(WOLFSSL_SUCCESS,
         wolfSSL_CertManagerLoadCRL(cm, crl2, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntEQ(CRL_CERT_REVOKED,
+        wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    wolfSSL_CertManagerFreeCRL(cm);
+
+    /* nothing to reload until a directory is monitored */
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerEnableCRL(cm, 0));
+    AssertIntEQ(CRL_MISSING, wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    AssertIntNE(WOLFSSL_SUCCESS, wolfSSL_CertManagerReloadCRL(cm));
+    AssertIntEQ(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, crlDir, WOLFSSL_FILETYPE_PEM,
+                                   WOLFSSL_CRL_MONITOR));
+    AssertIntEQ(CRL_CERT_REVOKED,
+        wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerReloadCRL(cm));
+    AssertIntEQ(CRL_CERT_REVOKED,
+        wolfSSL_CertManagerCheckCRL(cm, der, derSz));
     wolfSSL_CertManagerFreeCRL(cm);
 
     AssertIntEQ(WOLFSSL_SUCCESS,
         wolfSSL_CertManagerLoadCRL(cm, crl1, WOLFSSL_FILETYPE_PEM, 0));
     AssertIntEQ(WOLFSSL_SUCCESS,
         wolfSSL_CertManagerLoadCA(cm, ca_cert, NULL));
+    wolfSSL_CertManagerFreeCRL(cm);
+
+    /* a single file reports its error: missing, not a CRL, no signer */
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerEnableCRL(cm, 0));
+    AssertIntEQ(BAD_PATH_ERROR, wolfSSL_CertManagerLoadCRL(cm,
+                        "./certs/crl/missing.pem", WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntNE(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, ca_cert, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntNE(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, cliCrl, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntEQ(CRL_MISSING, wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+
+    /* of two CRLs from one CA the later thisUpdate is kept, whatever the
+     * load order; only the newer one revokes the cert */
+    AssertIntEQ(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, crlOld, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    AssertIntEQ(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, crlNew, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntEQ(CRL_CERT_REVOKED,
+        wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    AssertIntEQ(WOLFSSL_SUCCESS,
+        wolfSSL_CertManagerLoadCRL(cm, crlOld, WOLFSSL_FILETYPE_PEM, 0));
+    AssertIntEQ(CRL_CERT_REVOKED,
+        wolfSSL_CertManagerCheckCRL(cm, der, derSz));
+    wolfSSL_CertManagerFree(cm);
+
+#endif
+}
+
+#if defined(WOLFSSL_LAZY_CERT_DECODE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && defined(HAVE_CRL) && !defined(NO_RSA) && \
+    !defined(NO_WOLFSSL_CLIENT)
+static char test_crl_missing_url[256];
+
+static void test_crl_missing_cb(const char* url)
+{
+    XSTRNCPY(test_crl_missing_url, url, sizeof(test_crl_missing_url) - 1);
+}
+#endif
+
+/* wolfSSL_CertManagerCheckCRL() parses the certificate lazily and decodes the
+ * distribution point only when no CRL is loaded for the issuer. */
+static void test_wolfSSL_CertManagerCheckCRL_lazy(void)
+{
+#if defined(WOLFSSL_LAZY_CERT_DECODE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && defined(HAVE_CRL) && !defined(NO_RSA) && \
+    !defined(NO_WOLFSSL_CLIENT)
+    const char* crlDist = "./certs/client-crl-dist.der";
+    const char* ca      = "./certs/client-crl-dist.pem";
+    const char* crl     = "./certs/crl/crlDist.pem";
+    /* id-ce-cRLDistributionPoints */
+    static const byte dpOid[] = { 0x06, 0x03, 0x55, 0x1d, 0x1f };
+    byte*  der = NULL;
+    size_t derSz = 0;
+    size_t i;
+
+    WOLFSSL_CTX* ctx = NULL;
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManagerCheckCRL() lazy decode");
+
+    AssertIntEQ(load_file(crlDist, &der, &derSz), 0);
+    /* the self-signed certificate is its own CA, and has expired */
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfSSLv23_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations_ex(ctx, ca, NULL,
+                  WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY), WOLFSSL_SUCCESS);
+    AssertNotNull(cm = wolfSSL_CTX_GetCertManager(ctx));
+    AssertIntEQ(wolfSSL_CertManagerEnableCRL(cm, 0), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerSetCRL_Cb(cm, test_crl_missing_cb),
+                                                              WOLFSSL_SUCCESS);
+
+    /* the missing CRL callback gets the deferred distribution point */
+    XMEMSET(test_crl_missing_url, 0, sizeof(test_crl_missing_url));
+    AssertIntEQ(wolfSSL_CertManagerCheckCRL(cm, der, (int)derSz),
+                                                                  CRL_MISSING);
+    AssertStrEQ(test_crl_missing_url, "http://www.wolfssl.com/crl.pem");
+
+    /* break the distribution point: an OCTET STRING wrapping a SEQUENCE */
+    for (i = 0; i + sizeof(dpOid) + 2 < derSz; i++) {
+        if (XMEMCMP(der + i, dpOid, sizeof(dpOid)) == 0)
+            break;
+    }
+    AssertIntLT(i + sizeof(dpOid) + 2, derSz);
+    AssertIntEQ(der[i + sizeof(dpOid)], ASN_OCTET_STRING);
+    AssertIntEQ(der[i + sizeof(dpOid) + 2], ASN_SEQUENCE | ASN_CONSTRUCTED);
+    der[i + sizeof(dpOid) + 2] = ASN_OCTET_STRING;
+
+    /* only decoded, and so only failing, when the CRL is missing */
+    AssertIntLT(wolfSSL_CertManagerCheckCRL(cm, der, (int)derSz), 0);
+    AssertIntNE(wolfSSL_CertManagerCheckCRL(cm, der, (int)derSz),
+                                                                  CRL_MISSING);
+    AssertIntEQ(wolfSSL_CertManagerLoadCRL(cm, crl, WOLFSSL_FILETYPE_PEM, 0),
+                                                              WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerCheckCRL(cm, der, (int)derSz),
+                                                              WOLFSSL_SUCCESS);
+
+    wolfSSL_CTX_free(ctx);
+    free(der);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && defined(HAVE_OCSP) && \
+    !defined(NO_RSA)
+/* Good status for certs/ocsp/server1-cert.pem (serial 05) signed directly by
+ * intermediate1-ca, no nonce, nextUpdate in 2051. */
+static const byte ocspServer1Resp[] = {
+    0x30, 0x82, 0x02, 0x54, 0x0a, 0x01, 0x00, 0xa0, 0x82, 0x02, 0x4d, 0x30,
+    0x82, 0x02, 0x49, 0x06, 0x09, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30,
+    0x01, 0x01, 0x04, 0x82, 0x02, 0x3a, 0x30, 0x82, 0x02, 0x36, 0x30, 0x82,
+    0x01, 0x1e, 0xa1, 0x81, 0xa4, 0x30, 0x81, 0xa1, 0x31, 0x0b, 0x30, 0x09,
+    0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30,
+    0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x0c, 0x0a, 0x57, 0x61, 0x73, 0x68,
+    0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x31, 0x10, 0x30, 0x0e, 0x06, 0x03,
+    0x55, 0x04, 0x07, 0x0c, 0x07, 0x53, 0x65, 0x61, 0x74, 0x74, 0x6c, 0x65,
+    0x31, 0x10, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x07, 0x77,
+    0x6f, 0x6c, 0x66, 0x53, 0x53, 0x4c, 0x31, 0x14, 0x30, 0x12, 0x06, 0x03,
+    0x55, 0x04, 0x0b, 0x0c, 0x0b, 0x45, 0x6e, 0x67, 0x69, 0x6e, 0x65, 0x65,
+    0x72, 0x69, 0x6e, 0x67, 0x31, 0x22, 0x30, 0x20, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x19, 0x77, 0x6f, 0x6c, 0x66, 0x53, 0x53, 0x4c, 0x20, 0x69,
+    0x6e, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20,
+    0x43, 0x41, 0x20, 0x31, 0x31, 0x1f, 0x30, 0x1d, 0x06, 0x09, 0x2a, 0x86,
+    0x48, 0x86, 0xf7, 0x0d, 0x01, 0x09, 0x01, 0x16, 0x10, 0x69, 0x6e, 0x66,
+    0x6f, 0x40, 0x77, 0x6f, 0x6c, 0x66, 0x73, 0x73, 0x6c, 0x2e, 0x63, 0x6f,
+    0x6d, 0x18, 0x0f, 0x32, 0x30, 0x32, 0x33, 0x31, 0x31, 0x31, 0x34, 0x32,
+    0x32, 0x31, 0x33, 0x32, 0x30, 0x5a, 0x30, 0x64, 0x30, 0x62, 0x30, 0x3a,
+    0x30, 0x09, 0x06, 0x05, 0x2b, 0x0e, 0x03, 0x02, 0x1a, 0x05, 0x00, 0x04,
+    0x14, 0x71, 0x4d, 0x82, 0x23, 0x40, 0x59, 0xc0, 0x96, 0xa1, 0x37, 0x43,
+    0xfa, 0x31, 0xdb, 0xba, 0xb1, 0x43, 0x18, 0xda, 0x04, 0x04, 0x14, 0x83,
+    0xc6, 0x3a, 0x89, 0x2c, 0x81, 0xf4, 0x02, 0xd7, 0x9d, 0x4c, 0xe2, 0x2a,
+    0xc0, 0x71, 0x82, 0x64, 0x44, 0xda, 0x0e, 0x02, 0x01, 0x05, 0x80, 0x00,
+    0x18, 0x0f, 0x32, 0x30, 0x32, 0x33, 0x31, 0x31, 0x31, 0x34, 0x32, 0x32,
+    0x31, 0x33, 0x32, 0x30, 0x5a, 0xa0, 0x11, 0x18, 0x0f, 0x32, 0x30, 0x35,
+    0x31, 0x30, 0x33, 0x33, 0x31, 0x32, 0x32, 0x31, 0x33, 0x32, 0x30, 0x5a,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+    0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x03, 0xce, 0x4d, 0xba,
+    0x75, 0x81, 0x4a, 0xf9, 0xb9, 0x0b, 0x24, 0x8d, 0x63, 0x88, 0xa7, 0x7e,
+    0xef, 0x49, 0xca, 0x22, 0xeb, 0xd6, 0x12, 0x08, 0x99, 0x31, 0xda, 0x12,
+    0x75, 0x12, 0x20, 0x0e, 0x2d, 0xab, 0x22, 0x77, 0x9e, 0x48, 0xe6, 0x14,
+    0x10, 0x61, 0x42, 0xc5, 0x60, 0xa2, 0xcd, 0x64, 0xec, 0x0c, 0x45, 0xdd,
+    0xed, 0xdc, 0xc4, 0x67, 0x5c, 0x87, 0xd8, 0x14, 0xab, 0xfa, 0xf9, 0xbb,
+    0x8e, 0x05, 0x2d, 0xe7, 0xbb, 0xd1, 0xde, 0x7b, 0xd7, 0xbb, 0x09, 0x74,
+    0x20, 0xe2, 0x6c, 0x9f, 0x7c, 0xe1, 0xd7, 0xb5, 0xb3, 0x46, 0xaf, 0x67,
+    0x1e, 0x36, 0x1e, 0x33, 0x12, 0xd7, 0x2b, 0x1d, 0x9a, 0x69, 0x2b, 0xab,
+    0x29, 0x6a, 0x08, 0x20, 0x69, 0xe0, 0x2f, 0x4d, 0x25, 0xed, 0xa8, 0x30,
+    0x9e, 0xe1, 0xea, 0xb9, 0x84, 0xaa, 0x2f, 0x63, 0x3c, 0xbf, 0x52, 0x59,
+    0xe7, 0x2c, 0x0d, 0xbc, 0xc0, 0x09, 0x31, 0x65, 0xad, 0x07, 0x26, 0xe7,
+    0x74, 0x6f, 0xfd, 0x03, 0xf0, 0x85, 0xc8, 0xe0, 0x33, 0x98, 0xab, 0x39,
+    0xd3, 0x82, 0x77, 0xdd, 0x66, 0xd0, 0x98, 0xed, 0x34, 0xfd, 0x4c, 0x8c,
+    0xc2, 0x57, 0x11, 0x22, 0x8a, 0x71, 0x51, 0xe1, 0xb4, 0xf9, 0x91, 0x09,
+    0xac, 0xf3, 0xea, 0x38, 0x51, 0x52, 0x4a, 0xee, 0x59, 0xb3, 0x89, 0xfb,
+    0x23, 0xd0, 0x08, 0x40, 0x67, 0x4b, 0x60, 0x93, 0xb6, 0xf9, 0xed, 0xaf,
+    0x06, 0x5f, 0xc2, 0x77, 0x21, 0x23, 0xed, 0x36, 0x89, 0x44, 0xee, 0xdc,
+    0xdc, 0xe4, 0x9e, 0x29, 0x10, 0x24, 0x78, 0x98, 0x66, 0x9f, 0xd6, 0x38,
+    0xbf, 0x1b, 0x22, 0xfc, 0x9c, 0x46, 0xb1, 0x3e, 0x9f, 0xf5, 0x32, 0xed,
+    0xec, 0x72, 0xe1, 0x9f, 0xb9, 0x33, 0x52, 0xea, 0xc4, 0xf5, 0xae, 0x03,
+    0xd7, 0xab, 0x97, 0x3a, 0x18, 0x8a, 0x5b, 0x29, 0xdf, 0x0a, 0xa6, 0xd5
+};
+
+typedef struct OcspIOCtx {
+    int calls;
+    int fail;
+} OcspIOCtx;
+
+static int OcspIOCb(void* ctx, const char* url, int urlSz,
+                    unsigned char* req, int reqSz, unsigned char** resp)
+{
+    OcspIOCtx* io = (OcspIOCtx*)ctx;
+
+    (void)url;
+    (void)urlSz;
+
+    io->calls++;
+    if (req == NULL || reqSz <= 0 || req[0] != 0x30)
+        return -1;
+    if (io->fail)
+        return -1;
+
+    *resp = (unsigned char*)ocspServer1Resp;
+    return (int)sizeof(ocspServer1Resp);
+}
+
+static void OcspRespFreeCb(void* ctx, unsigned char* resp)
+{
+    (void)ctx;
+    (void)resp;
+}
+#endif
+
+static void test_wolfSSL_CertManagerOCSP(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && defined(HAVE_OCSP) && \
+    !defined(NO_RSA)
+    const char* root_ca = "./certs/ocsp/root-ca-cert.pem";
+    const char* int1_ca = "./certs/ocsp/intermediate1-ca-cert.pem";
+    const char* server1 = "./certs/ocsp/server1-cert.pem";
+    byte*  pem = NULL;
+    size_t pemSz = 0;
+    byte   der[4096];
+    int    derSz;
+    OcspIOCtx io;
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManagerCheckOCSP()");
+
+    XMEMSET(&io, 0, sizeof(io));
+
+    AssertIntEQ(load_file(server1, &pem, &pemSz), 0);
+    AssertIntGT(derSz = wc_CertPemToDer(pem, (int)pemSz, der, (int)sizeof(der),
+                                        CERT_TYPE), 0);
+    free(pem);
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerLoadCA(cm, root_ca, NULL));
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerLoadCA(cm, int1_ca, NULL));
+
+    /* not enabled: nothing to check */
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerEnableOCSP(cm,
+                    WOLFSSL_OCSP_URL_OVERRIDE | WOLFSSL_OCSP_NO_NONCE));
+    AssertIntEQ(OCSP_NEED_URL, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerSetOCSPOverrideURL(cm,
+                    "http://127.0.0.1:22221"));
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerSetOCSP_Cb(cm, OcspIOCb,
+                    OcspRespFreeCb, &io));
+
+    /* lookup failures are not cached */
+    io.fail = 1;
+    AssertIntEQ(OCSP_LOOKUP_FAIL, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+    AssertIntEQ(OCSP_LOOKUP_FAIL, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+    AssertIntEQ(io.calls, 2);
+
+    /* a good status is cached until nextUpdate */
+    io.fail = 0;
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+    AssertIntEQ(io.calls, 3);
+    AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CertManagerCheckOCSP(cm, der, derSz));
+    AssertIntEQ(io.calls, 3);
+
+    wolfSSL_CertManagerFree(cm);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+static void test_wolfSSL_CertManagerLoadCAHashDir(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_WOLFSSL_DIR) && \
+    !defined(NO_WOLFSSL_CA_HASH_DIR) && !defined(NO_CERTS) && !defined(NO_RSA)
+    byte*  der = NULL;
+    size_t derSz = 0;
+    char   name[16];
+    char   fname[32];
+    XFILE  fp;
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManagerLoadCAHashDir()");
+
+    /* hashed directory with the CA named by its subject */
+    AssertIntEQ(load_file("./certs/ca-cert.der", &der, &derSz), 0);
+    AssertIntEQ(wolfSSL_CertHashDirName(der, (int)derSz, name, 8),
+                BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CertHashDirName(der, (int)derSz, name, sizeof(name)),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(XSTRLEN(name), 8);
+    XSNPRINTF(fname, sizeof(fname), "./%s.0", name);
+    AssertTrue((fp = XFOPEN(fname, "wb")) != XBADFILE);
+    AssertIntEQ(XFWRITE(der, 1, derSz, fp), derSz);
+    XFCLOSE(fp);
+    free(der);
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertIntEQ(wolfSSL_CertManagerLoadCAHashDir(NULL, ".", 0), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+    AssertIntEQ(wolfSSL_CertManagerLoadCAHashDir(cm, ".", 0), WOLFSSL_SUCCESS);
+
+    /* CA is read on first use and then kept */
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(remove(fname), 0);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    /* unloading drops the directory too */
+    AssertIntEQ(wolfSSL_CertManagerUnloadCAs(cm), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    /* a name not found isn't searched for again until the miss times out or
+     * a directory is added */
+    AssertIntEQ(wolfSSL_CertManagerLoadCAHashDir(cm, ".", 0), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+    AssertTrue((fp = XFOPEN(fname, "wb")) != XBADFILE);
+    AssertIntEQ(load_file("./certs/ca-cert.der", &der, &derSz), 0);
+    AssertIntEQ(XFWRITE(der, 1, derSz, fp), derSz);
+    XFCLOSE(fp);
+    free(der);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+    AssertIntEQ(wolfSSL_CertManagerLoadCAHashDir(cm, "./certs", 0),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(remove(fname), 0);
+#endif
+
+    wolfSSL_CertManagerFree(cm);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+static void test_wolfSSL_CertManagerLoadCA_parallel(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA) && \
+    defined(HAVE_ECC)
+    const char* bundle = "./test-ca-bundle.pem";
+    byte*  rsaCa = NULL;
+    byte*  eccCa = NULL;
+    size_t rsaCaSz = 0;
+    size_t eccCaSz = 0;
+    XFILE  fp;
+    int    i;
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManagerLoadCA_ex() parallel");
+
+    /* enough certificates for the workers, with duplicates */
+    AssertIntEQ(load_file(caCertFile, &rsaCa, &rsaCaSz), 0);
+    AssertIntEQ(load_file(caEccCertFile, &eccCa, &eccCaSz), 0);
+    AssertTrue((fp = XFOPEN(bundle, "wb")) != XBADFILE);
+    for (i = 0; i < 64; i++) {
+        AssertIntEQ(XFWRITE(rsaCa, 1, rsaCaSz, fp), rsaCaSz);
+        AssertIntEQ(XFWRITE(eccCa, 1, eccCaSz, fp), eccCaSz);
+    }
+    XFCLOSE(fp);
+    free(rsaCa);
+    free(eccCa);
+
+    AssertIntNE(wolfSSL_CertManagerLoadCA_ex(NULL, bundle, NULL,
+                WOLFSSL_LOAD_FLAG_PARALLEL), WOLFSSL_SUCCESS);
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertIntEQ(wolfSSL_CertManagerLoadCA_ex(cm, bundle, NULL,
+                WOLFSSL_LOAD_FLAG_PARALLEL), WOLFSSL_SUCCESS);
+    AssertIntEQ(remove(bundle), 0);
+
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, eccCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    wolfSSL_CertManagerFree(cm);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA) && \
+    defined(HAVE_ECC)
+/* Load bundle serially and in parallel, the return code and CAs loaded must
+ * be the same */
+static void test_cm_load_ca_bundle_cmp(const char* bundle)
+{
+    WOLFSSL_CERT_MANAGER* cm;
+    int    ret;
+    word32 used;
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    ret = wolfSSL_CertManagerLoadCA(cm, bundle, NULL);
+    used = (cm->caTable == NULL) ? 0 : cm->caTable->used;
+    wolfSSL_CertManagerFree(cm);
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertIntEQ(wolfSSL_CertManagerLoadCA_ex(cm, bundle, NULL,
+                WOLFSSL_LOAD_FLAG_PARALLEL), ret);
+    AssertIntEQ((cm->caTable == NULL) ? 0 : cm->caTable->used, used);
+    wolfSSL_CertManagerFree(cm);
+}
+#endif
+
+static void test_wolfSSL_CertManagerLoadCA_parallel_bad(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA) && \
+    defined(HAVE_ECC)
+    const char* bundle = "./test-ca-bundle-bad.pem";
+    const char* after[] = {
+        "./certs/ca-ecc384-cert.pem",
+        "./certs/intermediate/ca-int-cert.pem",
+        "./certs/intermediate/ca-int2-cert.pem",
+    };
+    /* a block that doesn't decode, one that isn't a certificate and one
+     * without a footer */
+    const char* bad[] = {
+        "-----BEGIN CERTIFICATE-----\n"
+        "MIIC*jCCAfCgAwIBAgIUHwp7c0FJWpS/7!hJkZ5MNvdsOXAwCgYIKoZIzj0EAwIw\n"
+        "-----END CERTIFICATE-----\n",
+        "-----BEGIN CERTIFICATE-----\n"
+        "d29sZlNTTCBub3QgYSBjZXJ0aWZpY2F0ZQ==\n"
+        "-----END CERTIFICATE-----\n",
+        "-----BEGIN CERTIFICATE-----\n"
+        "MIICjjCCAfCgAwIBAgIUHwp7c0FJWpS/7JhJkZ5MNvdsOXAwCgYIKoZIzj0EAwIw\n",
+    };
+    byte*  rsaCa = NULL;
+    byte*  eccCa = NULL;
+    byte*  buf = NULL;
+    size_t rsaCaSz = 0;
+    size_t eccCaSz = 0;
+    size_t sz = 0;
+    XFILE  fp;
+    int    i, j;
+
+    printf(testingFmt, "wolfSSL_CertManagerLoadCA_ex() parallel bad block");
+
+    AssertIntEQ(load_file(caCertFile, &rsaCa, &rsaCaSz), 0);
+    AssertIntEQ(load_file(caEccCertFile, &eccCa, &eccCaSz), 0);
+    for (j = 0; j < (int)(sizeof(bad) / sizeof(*bad)); j++) {
+        /* enough certificates for the workers, bad block in the middle */
+        AssertTrue((fp = XFOPEN(bundle, "wb")) != XBADFILE);
+        for (i = 0; i < 32; i++) {
+            AssertIntEQ(XFWRITE(rsaCa, 1, rsaCaSz, fp), rsaCaSz);
+            AssertIntEQ(XFWRITE(eccCa, 1, eccCaSz, fp), eccCaSz);
+        }
+        AssertIntEQ(XFWRITE(bad[j], 1, XSTRLEN(bad[j]), fp), XSTRLEN(bad[j]));
+        for (i = 0; i < (int)(sizeof(after) / sizeof(*after)); i++) {
+            AssertIntEQ(load_file(after[i], &buf, &sz), 0);
+            AssertIntEQ(XFWRITE(buf, 1, sz, fp), sz);
+            free(buf);
+        }
+        XFCLOSE(fp);
+
+        test_cm_load_ca_bundle_cmp(bundle);
+        AssertIntEQ(remove(bundle), 0);
+    }
+    free(rsaCa);
+    free(eccCa);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA) && \
+    defined(HAVE_ECC)
+/* for the CA tables of WOLFSSL_CERT_MANAGER */
+#include "wolfssl/internal.h"
+#endif
+static void test_wolfSSL_CertManagerCATable(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA) && \
+    defined(HAVE_ECC)
+    /* more CAs than fit in the initial table - each issued by itself or an
+     * earlier entry, some files hold the issuer too */
+    const char* cas[] = {
+        "./certs/ca-cert.pem",
+        "./certs/ca-ecc-cert.pem",
+        "./certs/ca-ecc384-cert.pem",
+        "./certs/intermediate/ca-int-cert.pem",
+        "./certs/intermediate/ca-int2-cert.pem",
+        "./certs/intermediate/ca-int-ecc-cert.pem",
+        "./certs/intermediate/ca-int2-ecc-cert.pem",
+        "./certs/ocsp/root-ca-cert.pem",
+        "./certs/ocsp/intermediate1-ca-cert.pem",
+        "./certs/ocsp/intermediate2-ca-cert.pem",
+        "./certs/ocsp/intermediate3-ca-cert.pem",
+        "./certs/3072/client-cert.pem",
+        "./certs/4096/client-cert.pem",
+        "./certs/client-cert.pem",
+        "./certs/client-ecc-cert.pem",
+        "./certs/wolfssl-website-ca.pem",
+        "./certs/external/DigiCertGlobalRootCA.pem",
+        "./certs/external/ca-globalsign-root.pem",
+    };
+    const int casCnt = (int)(sizeof(cas) / sizeof(*cas));
+    SignerTable* table;
+    SignerTable* t;
+    word32 used;
+    int i;
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManager CA table");
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+    AssertNull(cm->caTable);
+    AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, cas[0], NULL), WOLFSSL_SUCCESS);
+    AssertNotNull(table = cm->caTable);
+    AssertIntEQ(table->size, CA_TABLE_MIN_SLOTS);
+    AssertNull(table->retired);
+
+    /* table is kept at most half full by replacing it with a larger copy */
+    for (i = 1; i < casCnt; i++) {
+        AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, cas[i], NULL),
+                    WOLFSSL_SUCCESS);
+    }
+    used = cm->caTable->used;
+    AssertIntGT(used, CA_TABLE_MIN_SLOTS / 2);
+    AssertPtrNE(cm->caTable, table);
+    AssertIntGE(cm->caTable->size, used * 2);
+#ifndef NO_SKID
+    AssertIntEQ(cm->caNameTable->used, used);
+    AssertIntGE(cm->caNameTable->size, used * 2);
+#endif
+
+    /* replaced table is retired, not freed, as a lookup may still be reading
+     * it */
+    for (t = cm->caTable->retired; t != NULL && t != table; t = t->retired)
+        ;
+    AssertPtrEq(t, table);
+    AssertIntEQ(table->used, CA_TABLE_MIN_SLOTS / 2);
+
+    /* every CA is found in the new table */
+    for (i = 0; i < casCnt; i++) {
+        AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, cas[i], NULL),
+                    WOLFSSL_SUCCESS);
+        AssertIntEQ(wolfSSL_CertManagerVerify(cm, cas[i],
+                    WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    }
+    AssertIntEQ(cm->caTable->used, used);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm,
+                "./certs/intermediate/server-int-cert.pem",
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    /* unloading frees the tables with the retired ones */
+    AssertIntEQ(wolfSSL_CertManagerUnloadCAs(cm), WOLFSSL_SUCCESS);
+    AssertNull(cm->caTable);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), ASN_NO_SIGNER_E);
+    AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, cas[0], NULL), WOLFSSL_SUCCESS);
+    AssertIntEQ(cm->caTable->size, CA_TABLE_MIN_SLOTS);
+    AssertIntEQ(wolfSSL_CertManagerVerify(cm, svrCertFile,
+                WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+
+    wolfSSL_CertManagerFree(cm);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if defined(WOLFSSL_SIGNER_KEY_CACHE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_RSA) && defined(HAVE_ECC)
+/* Signer of the only CA loaded */
+static Signer* test_cm_only_signer(WOLFSSL_CERT_MANAGER* cm)
+{
+    word32 i;
+
+    AssertNotNull(cm->caTable);
+    AssertIntEQ(cm->caTable->used, 1);
+    for (i = 0; i < cm->caTable->size; i++) {
+        if (cm->caTable->slot[i] != NULL)
+            break;
+    }
+    AssertIntLT(i, cm->caTable->size);
+
+    return cm->caTable->slot[i];
+}
+
+/* Certificate signed by the CA and a copy with a broken signature */
+static WOLFSSL_CERT_MANAGER* signerKeyCacheCm = NULL;
+static byte*  signerKeyCacheDer[2];
+static size_t signerKeyCacheDerSz;
+
+static int test_signer_key_cache_verify_one(int bad)
+{
+    return wolfSSL_CertManagerVerifyBuffer(signerKeyCacheCm,
+               signerKeyCacheDer[bad], (long)signerKeyCacheDerSz,
+               WOLFSSL_FILETYPE_ASN1) ==
+           (bad ? ASN_SIG_CONFIRM_E : WOLFSSL_SUCCESS);
+}
+
+#ifndef SINGLE_THREADED
+/* Verify the bad certificate when argc is set, failures in return_code */
+static THREAD_RETURN WOLFSSL_THREAD test_signer_key_cache_verify(void* args)
+{
+    func_args* a = (func_args*)args;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        if (!test_signer_key_cache_verify_one(a->argc))
+            a->return_code++;
+    }
+
+#ifndef WOLFSSL_TIRTOS
+    return 0;
+#endif
+}
+#endif /* !SINGLE_THREADED */
+#endif
+
+static void test_wolfSSL_CertManagerSignerKeyCache(void)
+{
+#if defined(WOLFSSL_SIGNER_KEY_CACHE) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_RSA) && defined(HAVE_ECC)
+    const char* files[][2] = {
+        { caCertFile,    "./certs/server-cert.der" },
+        { caEccCertFile, "./certs/server-ecc.der" },
+    };
+    Signer* signer;
+    void*   key;
+    int     i;
+#ifndef SINGLE_THREADED
+    func_args   args[4];
+    THREAD_TYPE tid[4];
+    int         j;
+#endif
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManager signer key cache");
+
+    for (i = 0; i < (int)(sizeof(files) / sizeof(*files)); i++) {
+        AssertIntEQ(load_file(files[i][1], &signerKeyCacheDer[0],
+                              &signerKeyCacheDerSz), 0);
+        AssertNotNull(signerKeyCacheDer[1] =
+                      (byte*)XMALLOC(signerKeyCacheDerSz, NULL,
+                                     DYNAMIC_TYPE_TMP_BUFFER));
+        XMEMCPY(signerKeyCacheDer[1], signerKeyCacheDer[0],
+                signerKeyCacheDerSz);
+        signerKeyCacheDer[1][signerKeyCacheDerSz - 1] ^= 0x01;
+
+        AssertNotNull(cm = wolfSSL_CertManagerNew());
+        AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, files[i][0], NULL),
+                    WOLFSSL_SUCCESS);
+        signerKeyCacheCm = cm;
+        signer = test_cm_only_signer(cm);
+        AssertNull(signer->pubKeyDecoded);
+
+        /* decoded on first verify and then shared */
+        AssertTrue(test_signer_key_cache_verify_one(0));
+        AssertNotNull(key = signer->pubKeyDecoded);
+        AssertTrue(test_signer_key_cache_verify_one(0));
+        AssertPtrEq(signer->pubKeyDecoded, key);
+
+        /* a failed verify leaves the shared key usable */
+        AssertTrue(test_signer_key_cache_verify_one(1));
+        AssertPtrEq(signer->pubKeyDecoded, key);
+        AssertTrue(test_signer_key_cache_verify_one(0));
+
+        wolfSSL_CertManagerFree(cm);
+
+    #ifndef SINGLE_THREADED
+        /* threads race to decode the key and then verify with it at once */
+        AssertNotNull(cm = wolfSSL_CertManagerNew());
+        AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, files[i][0], NULL),
+                    WOLFSSL_SUCCESS);
+        signerKeyCacheCm = cm;
+        XMEMSET(args, 0, sizeof(args));
+        for (j = 0; j < 4; j++) {
+            args[j].argc = j & 1;
+            start_thread(test_signer_key_cache_verify, &args[j], &tid[j]);
+        }
+        for (j = 0; j < 4; j++) {
+            join_thread(tid[j]);
+            AssertIntEQ(args[j].return_code, 0);
+        }
+        AssertNotNull(test_cm_only_signer(cm)->pubKeyDecoded);
+        wolfSSL_CertManagerFree(cm);
+    #endif
+
+        signerKeyCacheCm = NULL;
+        XFREE(signerKeyCacheDer[1], NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        free(signerKeyCacheDer[0]);
+    }
+
+    printf(resultFmt, passed);
+#endif
+}
+
+static void test_wolfSSL_CertManagerSignerVerifyTable(void)
+{
+#if defined(WOLFSSL_SIGNER_VERIFY_TABLE) && defined(WC_ECC_VERIFY_TABLE) && \
+    !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_RSA)
+    const char* files[][2] = {
+        { caEccCertFile, "./certs/server-ecc.der" },
+        { caCertFile,    "./certs/server-cert.der" },
+    };
+    Signer* signer;
+    int     i;
+    int     j;
+
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+
+    printf(testingFmt, "wolfSSL_CertManager signer verify table");
+
+    for (i = 0; i < (int)(sizeof(files) / sizeof(*files)); i++) {
+        AssertIntEQ(load_file(files[i][1], &signerKeyCacheDer[0],
+                              &signerKeyCacheDerSz), 0);
+        AssertNotNull(signerKeyCacheDer[1] =
+                      (byte*)XMALLOC(signerKeyCacheDerSz, NULL,
+                                     DYNAMIC_TYPE_TMP_BUFFER));
+        XMEMCPY(signerKeyCacheDer[1], signerKeyCacheDer[0],
+                signerKeyCacheDerSz);
+        signerKeyCacheDer[1][signerKeyCacheDerSz - 1] ^= 0x01;
+
+        AssertNotNull(cm = wolfSSL_CertManagerNew());
+        AssertIntEQ(wolfSSL_CertManagerLoadCA(cm, files[i][0], NULL),
+                    WOLFSSL_SUCCESS);
+        signerKeyCacheCm = cm;
+        signer = test_cm_only_signer(cm);
+
+        /* failed verifies aren't cached, each one uses the signer's key */
+        for (j = 1; j < WOLFSSL_SIGNER_VERIFY_TABLE_MIN; j++) {
+            AssertTrue(test_signer_key_cache_verify_one(1));
+            AssertNotNull(signer->pubKeyDecoded);
+            AssertNull(signer->pubKeyTable);
+        }
+        /* the verify that reaches the minimum builds the table and uses it */
+        AssertTrue(test_signer_key_cache_verify_one(0));
+        AssertTrue(test_signer_key_cache_verify_one(1));
+        if (i == 0) {
+            AssertNotNull(signer->pubKeyTable);
+            AssertPtrNE(signer->pubKeyTable, signer->pubKeyDecoded);
+            AssertNotNull(((ecc_key*)signer->pubKeyTable)->verifyTable);
+            AssertNull(((ecc_key*)signer->pubKeyDecoded)->verifyTable);
+        }
+        else {
+            /* RSA keys have no table */
+            AssertNull(signer->pubKeyTable);
+        }
+
+        wolfSSL_CertManagerFree(cm);
+        signerKeyCacheCm = NULL;
+        XFREE(signerKeyCacheDer[1], NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        free(signerKeyCacheDer[0]);
+    }
+
+    printf(resultFmt, passed);
+#endif
+}
+
+static void test_wolfSSL_CertManagerGetCAByName(void)
+{
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && !defined(NO_SKID) && \
+    !defined(NO_RSA) && defined(HAVE_ECC) && \
+    (defined(WOLFSSL_TEST_CERT) || defined(WOLFSSL_PUBLIC_ASN))
+    const char* cas[] = {
+        "./certs/ca-cert.der",
+        "./certs/ca-ecc-cert.der",
+        "./certs/ca-ecc384-cert.der",
+        "./certs/intermediate/ca-int-cert.der",
+        "./certs/intermediate/ca-int-ecc-cert.der",
+    };
+    /* not loaded - subject of a leaf and of a CA issued by a loaded one */
+    const char* others[] = {
+        "./certs/server-cert.der",
+        "./certs/intermediate/ca-int2-cert.der",
+    };
+    byte hashes[sizeof(cas) / sizeof(*cas)][SIGNER_DIGEST_SIZE];
+    byte otherHashes[sizeof(others) / sizeof(*others)][SIGNER_DIGEST_SIZE];
+    WOLFSSL_CERT_MANAGER* cm;
+    DecodedCert cert;
+    Signer* signer;
+    byte*  buf;
+    size_t sz;
+    int    i;
+
+    printf(testingFmt, "GetCAByName()");
+
+    AssertNotNull(cm = wolfSSL_CertManagerNew());
+
+    for (i = 0; i < (int)(sizeof(cas) / sizeof(*cas)); i++) {
+        AssertIntEQ(load_file(cas[i], &buf, &sz), 0);
+        InitDecodedCert(&cert, buf, (word32)sz, NULL);
+        AssertIntEQ(ParseCert(&cert, CA_TYPE, NO_VERIFY, NULL), 0);
+        XMEMCPY(hashes[i], cert.subjectHash, SIGNER_DIGEST_SIZE);
+        FreeDecodedCert(&cert);
+        AssertNull(GetCAByName(cm, hashes[i]));
+        AssertIntEQ(wolfSSL_CertManagerLoadCABuffer(cm, buf, (long)sz,
+                    WOLFSSL_FILETYPE_ASN1), WOLFSSL_SUCCESS);
+        free(buf);
+    }
+    for (i = 0; i < (int)(sizeof(others) / sizeof(*others)); i++) {
+        AssertIntEQ(load_file(others[i], &buf, &sz), 0);
+        InitDecodedCert(&cert, buf, (word32)sz, NULL);
+        AssertIntEQ(ParseCert(&cert, CERT_TYPE, NO_VERIFY, NULL), 0);
+        XMEMCPY(otherHashes[i], cert.subjectHash, SIGNER_DIGEST_SIZE);
+        FreeDecodedCert(&cert);
+        free(buf);
+    }
+
+    /* every loaded CA is found by its subject and no other */
+    for (i = 0; i < (int)(sizeof(cas) / sizeof(*cas)); i++) {
+        AssertNotNull(signer = GetCAByName(cm, hashes[i]));
+        AssertIntEQ(XMEMCMP(signer->subjectNameHash, hashes[i],
+                    SIGNER_DIGEST_SIZE), 0);
+    }
+    for (i = 0; i < (int)(sizeof(others) / sizeof(*others)); i++)
+        AssertNull(GetCAByName(cm, otherHashes[i]));
+
+    AssertNull(GetCAByName(NULL, hashes[0]));
+    AssertNull(GetCAByName(cm, NULL));
+
+    AssertIntEQ(wolfSSL_CertManagerUnloadCAs(cm), WOLFSSL_SUCCESS);
+    for (i = 0; i < (int)(sizeof(cas) / sizeof(*cas)); i++)
+        AssertNull(GetCAByName(cm, hashes[i]));
+
     wolfSSL_CertManagerFree(cm);
 
+    printf(resultFmt, passed);
 #endif
 }
 
@@ -21158,6 +22092,101 @@ static int test_wc_ed25519_sign_msg (void)
 
 } /* END test_wc_ed25519_sign_msg */
 
+/*
+ * Test wc_ed25519_verify_msg_batch()
+ */
+static int test_wc_ed25519_verify_msg_batch (void)
+{
+    int             ret = 0;
+
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_SIGN) && \
+    defined(HAVE_ED25519_VERIFY)
+    WC_RNG          rng;
+    ed25519_key     key;
+    ed25519_key*    keys[3];
+    byte            msg[3][16];
+    byte            sig[3][ED25519_SIG_SIZE];
+    const byte*     msgs[3];
+    const byte*     sigs[3];
+    word32          msgLens[3];
+    word32          sigLens[3];
+    int             res[3];
+    int             i;
+
+    ret = wc_InitRng(&rng);
+    if (ret == 0) {
+        ret = wc_ed25519_init(&key);
+        if (ret == 0) {
+            ret = wc_ed25519_make_key(&rng, ED25519_KEY_SIZE, &key);
+        }
+    }
+    for (i = 0; ret == 0 && i < 3; i++) {
+        XMEMSET(msg[i], 'a' + i, sizeof(msg[i]));
+        sigLens[i] = sizeof(sig[i]);
+        ret = wc_ed25519_sign_msg(msg[i], sizeof(msg[i]), sig[i], &sigLens[i],
+                                  &key);
+        msgs[i] = msg[i];
+        sigs[i] = sig[i];
+        msgLens[i] = sizeof(msg[i]);
+        keys[i] = &key;
+    }
+
+    printf(testingFmt, "wc_ed25519_verify_msg_batch()");
+
+    if (ret == 0) {
+        ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens, keys, 3,
+                                          res, &rng);
+        if (ret == 0 && (res[0] != 1 || res[1] != 1 || res[2] != 1)) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+    /* One bad signature is found. */
+    if (ret == 0) {
+        sig[1][0] ^= 1;
+        ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens, keys, 3,
+                                          res, &rng);
+        if (ret == SIG_VERIFY_E && res[0] == 1 && res[1] == 0 && res[2] == 1) {
+            ret = 0;
+        } else if (ret == 0) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+        sig[1][0] ^= 1;
+    }
+    /* Test bad args. */
+    if (ret == 0) {
+        ret = wc_ed25519_verify_msg_batch(NULL, sigLens, msgs, msgLens, keys, 3,
+                                          res, &rng);
+        if (ret == BAD_FUNC_ARG) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens,
+                                              NULL, 3, res, &rng);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens,
+                                              keys, 3, NULL, &rng);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens,
+                                              keys, 3, res, NULL);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            ret = 0;
+        } else if (ret == 0) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    printf(resultFmt, ret == 0 ? passed : failed);
+
+    if (wc_FreeRng(&rng) && ret == 0) {
+        ret = WOLFSSL_FATAL_ERROR;
+    }
+    wc_ed25519_free(&key);
+
+#endif
+    return ret;
+
+} /* END test_wc_ed25519_verify_msg_batch */
+
 /*
  * Testing wc_ed25519_import_public()
  */
@@ -24406,6 +25435,408 @@ static int test_wc_ecc_signVerify_hash (void)
 
 } /*  END test_wc_ecc_sign_hash */
 
+/*
+ * Testing wc_ecc_make_verify_table()
+ */
+static int test_wc_ecc_make_verify_table (void)
+{
+    int         ret = 0;
+
+#if defined(HAVE_ECC) && defined(HAVE_ECC_SIGN) && \
+    defined(WC_ECC_VERIFY_TABLE) && !defined(WC_NO_RNG)
+    WC_RNG      rng;
+    ecc_key     key;
+    ecc_key     pub;
+    int         verify = 0;
+    int         i;
+    word32      siglen;
+    word32      x963len = ECC_BUFSIZE;
+    byte        sig[ECC_BUFSIZE];
+    byte        x963[ECC_BUFSIZE];
+    byte        digest[] = TEST_STRING;
+    word32      digestlen = (word32)TEST_STRING_SZ;
+
+    printf(testingFmt, "wc_ecc_make_verify_table()");
+
+    AssertIntEQ(wc_InitRng(&rng), 0);
+    AssertIntEQ(wc_ecc_init(&key), 0);
+    AssertIntEQ(wc_ecc_init(&pub), 0);
+    AssertIntEQ(wc_ecc_make_key(&rng, KEY32, &key), 0);
+    PRIVATE_KEY_UNLOCK();
+    AssertIntEQ(wc_ecc_export_x963(&key, x963, &x963len), 0);
+    PRIVATE_KEY_LOCK();
+    AssertIntEQ(wc_ecc_import_x963(x963, x963len, &pub), 0);
+
+    AssertIntEQ(wc_ecc_make_verify_table(NULL), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_make_verify_table(&pub), 0);
+#ifndef WOLFSSL_SP_ECC_256
+    AssertNotNull(pub.verifyTable);
+#endif
+
+    /* table and generic paths agree on good and bad signatures */
+    for (i = 0; i < 8; i++) {
+        siglen = ECC_BUFSIZE;
+        digest[0] = (byte)i;
+        AssertIntEQ(wc_ecc_sign_hash(digest, digestlen, sig, &siglen, &rng,
+                                                                    &key), 0);
+        if (i & 1)
+            sig[siglen - 1] ^= 0x01;
+        AssertIntEQ(wc_ecc_verify_hash(sig, siglen, digest, digestlen, &verify,
+                                                                    &pub), 0);
+        AssertIntEQ(verify, !(i & 1));
+    }
+
+    /* table of a replaced public key is not used */
+    AssertIntEQ(wc_ecc_make_key(&rng, KEY32, &key), 0);
+    x963len = ECC_BUFSIZE;
+    PRIVATE_KEY_UNLOCK();
+    AssertIntEQ(wc_ecc_export_x963(&key, x963, &x963len), 0);
+    PRIVATE_KEY_LOCK();
+    AssertIntEQ(wc_ecc_import_x963(x963, x963len, &pub), 0);
+    siglen = ECC_BUFSIZE;
+    AssertIntEQ(wc_ecc_sign_hash(digest, digestlen, sig, &siglen, &rng, &key),
+                                                                            0);
+    AssertIntEQ(wc_ecc_verify_hash(sig, siglen, digest, digestlen, &verify,
+                                                                    &pub), 0);
+    AssertIntEQ(verify, 1);
+
+    wc_ecc_free(&pub);
+    AssertNull(pub.verifyTable);
+    wc_ecc_free(&key);
+    AssertIntEQ(wc_FreeRng(&rng), 0);
+
+    printf(resultFmt, passed);
+#endif
+    return ret;
+
+} /* END test_wc_ecc_make_verify_table */
+
+/*
+ * Testing wc_ecc_presign_init(), wc_ecc_presign_fill() and signing from the
+ * presignature pool.
+ */
+#if defined(HAVE_ECC) && defined(WC_ECC_PRESIGN)
+static void test_wc_ecc_presign_cb(ecc_key* key, void* ctx)
+{
+    (void)key;
+    (*(int*)ctx)++;
+}
+#endif
+#if defined(HAVE_ECC) && defined(WC_ECC_PRESIGN_PID)
+#include <sys/wait.h>
+
+/* r of a DER encoded signature */
+static void test_wc_ecc_presign_r(const byte* sig, word32 sigSz, byte* r,
+                                  word32* rSz)
+{
+    byte   s[MAX_ECC_BYTES + 1];
+    word32 sSz = (word32)sizeof(s);
+
+    *rSz = MAX_ECC_BYTES + 1;
+    AssertIntEQ(wc_ecc_sig_to_rs(sig, sigSz, r, rSz, s, &sSz), 0);
+}
+#endif
+
+static int test_wc_ecc_presign (void)
+{
+    int         ret = 0;
+
+#if defined(HAVE_ECC) && defined(WC_ECC_PRESIGN)
+    WC_RNG      rng;
+    ecc_key     key;
+    int         verify = 0;
+    int         calls = 0;
+    int         i;
+    word32      siglen;
+    byte        sig[ECC_BUFSIZE];
+    byte        digest[] = TEST_STRING;
+    word32      digestlen = (word32)TEST_STRING_SZ;
+
+    printf(testingFmt, "wc_ecc_presign_fill()");
+
+    AssertIntEQ(wc_InitRng(&rng), 0);
+    AssertIntEQ(wc_ecc_init(&key), 0);
+    AssertIntEQ(wc_ecc_make_key(&rng, KEY32, &key), 0);
+
+    AssertIntEQ(wc_ecc_presign_init(NULL, 0, 0), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_presign_init(&key, 2, 3), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_presign_fill(&key, &rng, 0), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_presign_init(&key, 4, 2), 0);
+    AssertIntEQ(wc_ecc_presign_set_cb(&key, test_wc_ecc_presign_cb, &calls),
+                                                                            0);
+    AssertIntEQ(wc_ecc_presign_fill(NULL, &rng, 0), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_presign_fill(&key, NULL, 0), BAD_FUNC_ARG);
+    AssertIntEQ(wc_ecc_presign_fill(&key, &rng, 1), 1);
+    AssertIntEQ(wc_ecc_presign_fill(&key, &rng, 0), 3);
+    AssertIntEQ(wc_ecc_presign_fill(&key, &rng, 0), 0);
+    AssertIntEQ(wc_ecc_presign_count(&key), 4);
+
+    /* pool is drained and then signing falls back to a fresh nonce */
+    for (i = 0; i < 6; i++) {
+        siglen = ECC_BUFSIZE;
+        digest[0] = (byte)i;
+        AssertIntEQ(wc_ecc_sign_hash(digest, digestlen, sig, &siglen, &rng,
+                                                                    &key), 0);
+        AssertIntEQ(wc_ecc_verify_hash(sig, siglen, digest, digestlen, &verify,
+                                                                    &key), 0);
+        AssertIntEQ(verify, 1);
+        AssertIntEQ(wc_ecc_presign_count(&key), i < 4 ? 3 - i : 0);
+    }
+    /* below the low watermark after the third and each later signature */
+    AssertIntEQ(calls, 4);
+
+#ifdef WC_ECC_PRESIGN_PID
+    /* a child process must not sign with the parent's nonces */
+    {
+        byte   childSig[ECC_BUFSIZE];
+        word32 childSigLen = 0;
+        byte   r[MAX_ECC_BYTES + 1];
+        byte   childR[MAX_ECC_BYTES + 1];
+        word32 rSz;
+        word32 childRSz;
+        int    fds[2];
+        int    status;
+        pid_t  pid;
+
+        AssertIntEQ(wc_ecc_presign_fill(&key, &rng, 0), 4);
+        AssertIntEQ(pipe(fds), 0);
+        pid = fork();
+        AssertIntGE(pid, 0);
+        if (pid == 0) {
+            close(fds[0]);
+            /* fresh RNG state so the fallback nonce differs from the parent */
+            if (wc_ecc_presign_count(&key) != 0 ||
+                    wc_FreeRng(&rng) != 0 || wc_InitRng(&rng) != 0) {
+                _exit(1);
+            }
+            siglen = ECC_BUFSIZE;
+            if (wc_ecc_sign_hash(digest, digestlen, sig, &siglen, &rng,
+                                                                 &key) != 0 ||
+                    write(fds[1], sig, siglen) != (ssize_t)siglen) {
+                _exit(1);
+            }
+            _exit(0);
+        }
+        close(fds[1]);
+        childSigLen = (word32)read(fds[0], childSig, sizeof(childSig));
+        close(fds[0]);
+        AssertIntEQ(waitpid(pid, &status, 0), pid);
+        AssertTrue(WIFEXITED(status));
+        AssertIntEQ(WEXITSTATUS(status), 0);
+
+        /* the parent's pool is untouched and its next nonce is its own */
+        AssertIntEQ(wc_ecc_presign_count(&key), 4);
+        siglen = ECC_BUFSIZE;
+        AssertIntEQ(wc_ecc_sign_hash(digest, digestlen, sig, &siglen, &rng,
+                                                                    &key), 0);
+        AssertIntEQ(wc_ecc_presign_count(&key), 3);
+        test_wc_ecc_presign_r(sig, siglen, r, &rSz);
+        test_wc_ecc_presign_r(childSig, childSigLen, childR, &childRSz);
+        AssertFalse(rSz == childRSz && XMEMCMP(r, childR, rSz) == 0);
+    }
+#endif
+
+    wc_ecc_free(&key);
+    AssertNull(key.presign);
+    AssertIntEQ(wc_FreeRng(&rng), 0);
+
+    printf(resultFmt, passed);
+#endif
+    return ret;
+
+} /* END test_wc_ecc_presign */
+
+/*
+ * Testing the fixed base comb used by wc_ecc_make_pub() against the generic
+ * point multiplication.
+ */
+static int test_wc_ecc_fixed_base (void)
+{
+    int         ret = 0;
+
+#if defined(HAVE_ECC) && defined(WC_ECC_FIXED_BASE) && !defined(WC_NO_RNG) && \
+    !defined(WOLFSSL_VALIDATE_ECC_IMPORT)
+    WC_RNG      rng;
+    ecc_key     key;
+    ecc_key     gen;
+    ecc_key     mod;
+    ecc_point*  expect;
+    int         curves[] = { ECC_SECP256R1,
+    #if ECC_MIN_KEY_SZ <= 384
+                             ECC_SECP384R1,
+    #endif
+                           };
+    byte        small[] = { 0x01, 0x02, 0x03 };
+    int         c;
+    int         i;
+
+    printf(testingFmt, "wc_ecc_make_pub() fixed base");
+
+    AssertIntEQ(wc_InitRng(&rng), 0);
+    AssertNotNull(expect = wc_ecc_new_point());
+
+    for (c = 0; c < (int)(sizeof(curves) / sizeof(curves[0])); c++) {
+        AssertIntEQ(wc_ecc_init(&gen), 0);
+        AssertIntEQ(wc_ecc_init(&mod), 0);
+        AssertIntEQ(wc_ecc_set_curve(&gen, 0, curves[c]), 0);
+        /* base point and a in gen, prime in mod, as in test_wc_ecc_mulmod */
+        AssertIntEQ(wc_ecc_import_raw_ex(&gen, gen.dp->Gx, gen.dp->Gy,
+                                                gen.dp->Af, curves[c]), 0);
+        AssertIntEQ(wc_ecc_import_raw_ex(&mod, gen.dp->Gx, gen.dp->Gy,
+                                                gen.dp->prime, curves[c]), 0);
+
+        /* small scalars then random ones */
+        for (i = 0; i < 8; i++) {
+            AssertIntEQ(wc_ecc_init(&key), 0);
+            if (i < (int)sizeof(small)) {
+                AssertIntEQ(wc_ecc_import_private_key_ex(&small[i], 1, NULL, 0,
+                                                        &key, curves[c]), 0);
+                AssertIntEQ(wc_ecc_make_pub(&key, NULL), 0);
+            }
+            else {
+                AssertIntEQ(wc_ecc_make_key_ex(&rng, 0, &key, curves[c]), 0);
+            }
+            AssertIntEQ(wc_ecc_mulmod(&key.k, &gen.pubkey, expect, &gen.k,
+                                                                &mod.k, 1), 0);
+            AssertIntEQ(wc_ecc_cmp_point(&key.pubkey, expect), MP_EQ);
+            wc_ecc_free(&key);
+        }
+
+        wc_ecc_free(&mod);
+        wc_ecc_free(&gen);
+    }
+
+    wc_ecc_del_point(expect);
+    AssertIntEQ(wc_FreeRng(&rng), 0);
+
+    printf(resultFmt, passed);
+#endif
+    return ret;
+
+} /* END test_wc_ecc_fixed_base */
+
+/*
+ * Testing ecc_map_batch() against mapping each point with ecc_map().
+ */
+static int test_wc_ecc_map_batch (void)
+{
+    int         ret = 0;
+
+#if defined(HAVE_ECC) && defined(WOLFSSL_PUBLIC_ECC_ADD_DBL) && \
+    defined(WOLFSSL_PUBLIC_MP) && !defined(WC_NO_RNG) && \
+    !defined(WOLFSSL_VALIDATE_ECC_IMPORT) && \
+    !defined(FREESCALE_LTC_ECC) && !defined(WOLFSSL_STM32_PKA)
+    #define MAP_BATCH_PTS   6
+    WC_RNG      rng;
+    ecc_key     key;
+    ecc_key     gen;
+    ecc_key     mod;
+    ecc_point*  proj[MAP_BATCH_PTS];
+    ecc_point*  single[MAP_BATCH_PTS];
+    ecc_point*  batch[MAP_BATCH_PTS];
+    mp_digit    mp;
+    int         curves[] = { ECC_SECP256R1,
+    #if ECC_MIN_KEY_SZ <= 384
+                             ECC_SECP384R1,
+    #endif
+                           };
+    int         c;
+    int         mont;
+    int         i;
+
+    printf(testingFmt, "ecc_map_batch()");
+
+    AssertIntEQ(wc_InitRng(&rng), 0);
+    for (i = 0; i < MAP_BATCH_PTS; i++) {
+        AssertNotNull(proj[i] = wc_ecc_new_point());
+        AssertNotNull(single[i] = wc_ecc_new_point());
+        AssertNotNull(batch[i] = wc_ecc_new_point());
+    }
+
+    AssertIntEQ(ecc_map_batch(NULL, 1, NULL, 0, 0, NULL), ECC_BAD_ARG_E);
+    AssertIntEQ(ecc_map_batch(batch, -1, &mod.k, 0, 0, NULL), ECC_BAD_ARG_E);
+
+    for (c = 0; c < (int)(sizeof(curves) / sizeof(curves[0])); c++) {
+        AssertIntEQ(wc_ecc_init(&gen), 0);
+        AssertIntEQ(wc_ecc_init(&mod), 0);
+        AssertIntEQ(wc_ecc_set_curve(&gen, 0, curves[c]), 0);
+        /* base point and a in gen, prime in mod, as in test_wc_ecc_mulmod */
+        AssertIntEQ(wc_ecc_import_raw_ex(&gen, gen.dp->Gx, gen.dp->Gy,
+                                                gen.dp->Af, curves[c]), 0);
+        AssertIntEQ(wc_ecc_import_raw_ex(&mod, gen.dp->Gx, gen.dp->Gy,
+                                                gen.dp->prime, curves[c]), 0);
+        AssertIntEQ(mp_montgomery_setup(&mod.k, &mp), MP_OKAY);
+
+        /* random multiples of the base point left projective, with the
+         * point at infinity among them */
+        for (i = 0; i < MAP_BATCH_PTS; i++) {
+            AssertIntEQ(wc_ecc_init(&key), 0);
+            AssertIntEQ(wc_ecc_make_key_ex(&rng, 0, &key, curves[c]), 0);
+            AssertIntEQ(wc_ecc_mulmod(&key.k, &gen.pubkey, proj[i], &gen.k,
+                                                                &mod.k, 0), 0);
+            AssertFalse(mp_isone(proj[i]->z));
+            wc_ecc_free(&key);
+        }
+        mp_zero(proj[2]->z);
+
+        for (i = 0; i < MAP_BATCH_PTS; i++) {
+            AssertIntEQ(wc_ecc_copy_point(proj[i], single[i]), 0);
+            AssertIntEQ(ecc_map(single[i], &mod.k, mp), MP_OKAY);
+        }
+
+        AssertIntEQ(ecc_map_batch(batch, 0, &mod.k, mp, 0, NULL), MP_OKAY);
+        for (mont = 0; mont <= 1; mont++) {
+            /* one point alone and then all of them */
+            AssertIntEQ(wc_ecc_copy_point(proj[0], batch[0]), 0);
+            AssertIntEQ(ecc_map_batch(batch, 1, &mod.k, mp, mont, NULL),
+                        MP_OKAY);
+            if (mont) {
+                AssertIntEQ(mp_iszero(batch[0]->z), 1);
+                AssertIntEQ(mp_montgomery_reduce(batch[0]->x, &mod.k, mp),
+                            MP_OKAY);
+                AssertIntEQ(mp_montgomery_reduce(batch[0]->y, &mod.k, mp),
+                            MP_OKAY);
+                AssertIntEQ(mp_set(batch[0]->z, 1), MP_OKAY);
+            }
+            AssertIntEQ(wc_ecc_cmp_point(batch[0], single[0]), MP_EQ);
+
+            for (i = 0; i < MAP_BATCH_PTS; i++) {
+                AssertIntEQ(wc_ecc_copy_point(proj[i], batch[i]), 0);
+            }
+            AssertIntEQ(ecc_map_batch(batch, MAP_BATCH_PTS, &mod.k, mp, mont,
+                                                                  NULL), MP_OKAY);
+            for (i = 0; i < MAP_BATCH_PTS; i++) {
+                /* infinity maps to (0, 0, 1) either way */
+                if (mont && (i != 2)) {
+                    AssertIntEQ(mp_iszero(batch[i]->z), 1);
+                    AssertIntEQ(mp_montgomery_reduce(batch[i]->x, &mod.k, mp),
+                                MP_OKAY);
+                    AssertIntEQ(mp_montgomery_reduce(batch[i]->y, &mod.k, mp),
+                                MP_OKAY);
+                    AssertIntEQ(mp_set(batch[i]->z, 1), MP_OKAY);
+                }
+                AssertIntEQ(wc_ecc_cmp_point(batch[i], single[i]), MP_EQ);
+            }
+        }
+
+        wc_ecc_free(&mod);
+        wc_ecc_free(&gen);
+    }
+
+    for (i = 0; i < MAP_BATCH_PTS; i++) {
+        wc_ecc_del_point(batch[i]);
+        wc_ecc_del_point(single[i]);
+        wc_ecc_del_point(proj[i]);
+    }
+    AssertIntEQ(wc_FreeRng(&rng), 0);
+    #undef MAP_BATCH_PTS
+
+    printf(resultFmt, passed);
+#endif
+    return ret;
+
+} /* END test_wc_ecc_map_batch */
+
 
 /*
  * Testing wc_ecc_shared_secret()
@@ -47007,6 +48438,41 @@ static void test_wc_ParseCert(void)
 #endif
 }
 
+static void test_wc_DecodedCert_size(void)
+{
+#if !defined(NO_CERTS) && !defined(NO_RSA)
+    DecodedCert decodedCert;
+    const byte* rawCert = client_cert_der_2048;
+    const int rawCertSize = sizeof_client_cert_der_2048;
+
+    printf(testingFmt, "DecodedCert size");
+
+    /* Name strings are not held inline. */
+    AssertIntEQ(sizeof(decodedCert.issuer), sizeof(char*));
+    AssertIntEQ(sizeof(decodedCert.subject), sizeof(char*));
+
+    wc_InitDecodedCert(&decodedCert, rawCert, rawCertSize, NULL);
+    AssertNull(decodedCert.subject);
+    AssertIntEQ(wc_ParseCert(&decodedCert, CERT_TYPE, NO_VERIFY, NULL), 0);
+    AssertNotNull(decodedCert.subject);
+    AssertNotNull(XSTRSTR(decodedCert.subject, "/CN=www.wolfssl.com"));
+    AssertNotNull(XSTRSTR(decodedCert.issuer, "/CN=www.wolfssl.com"));
+    wc_FreeDecodedCert(&decodedCert);
+
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    /* A lazy parse builds no name strings. */
+    wc_InitDecodedCert(&decodedCert, rawCert, rawCertSize, NULL);
+    decodedCert.decodeLazy = 1;
+    AssertIntEQ(wc_ParseCert(&decodedCert, CERT_TYPE, NO_VERIFY, NULL), 0);
+    AssertNull(decodedCert.subject);
+    AssertNull(decodedCert.issuer);
+    wc_FreeDecodedCert(&decodedCert);
+#endif
+
+    printf(resultFmt, passed);
+#endif
+}
+
 /*----------------------------------------------------------------------------*
  | wolfCrypt ECC
  *----------------------------------------------------------------------------*/
@@ -51703,8 +53169,10 @@ static void test_wolfSSL_CTX_LoadCRL(void)
 #endif
 
     SUCC_T (wolfSSL_CTX_LoadCRL, ctx, validPath, pemType, monitor);
-    SUCC_T (wolfSSL_CTX_LoadCRL, ctx, badPath, pemType, monitor);
-    SUCC_T (wolfSSL_CTX_LoadCRL, ctx, badPath, derType, monitor);
+    AssertIntEQ(wolfSSL_CTX_LoadCRL(ctx, badPath, pemType, monitor),
+                BAD_PATH_ERROR);
+    AssertIntEQ(wolfSSL_CTX_LoadCRL(ctx, badPath, derType, monitor),
+                BAD_PATH_ERROR);
 
     wolfSSL_CTX_free(ctx);
 
@@ -51760,6 +53228,394 @@ static void test_SetTmpEC_DHE_Sz(void)
 #endif
 }
 
+static void test_wolfSSL_UseEccNonBlock(void)
+{
+#if defined(WC_ECC_NONBLOCK) && defined(HAVE_ECC) && \
+    defined(HAVE_SUPPORTED_CURVES) && defined(HAVE_AESGCM) && \
+    !defined(NO_SHA256) && !defined(WOLFSSL_NO_TLS12) && \
+    defined(HAVE_IO_TESTS_DEPENDENCIES)
+    tcp_ready   ready;
+    func_args   server_args;
+    THREAD_TYPE serverThread;
+    callback_functions server_cbf;
+    SOCKET_T     sockfd = 0;
+    WOLFSSL_CTX* ctx;
+    WOLFSSL*     ssl;
+    char msg[] = "hello wolfssl!";
+    char reply[1024];
+    int  ret;
+    int  err;
+    int  pending = 0;
+
+    printf(testingFmt, "wolfSSL_UseEccNonBlock() handshake");
+
+    XMEMSET(&server_args, 0, sizeof(func_args));
+    XMEMSET(&server_cbf, 0, sizeof(callback_functions));
+
+    StartTCP();
+    InitTcpReady(&ready);
+#if defined(USE_WINDOWS_API)
+    /* use RNG to get random port if using windows */
+    ready.port = GetRandomPort();
+#endif
+
+    server_cbf.method = wolfTLSv1_2_server_method;
+    server_args.signal = &ready;
+    server_args.callbacks = &server_cbf;
+    server_args.return_code = TEST_FAIL;
+    start_thread(test_server_nofail, &server_args, &serverThread);
+    wait_tcp_ready(&server_args);
+
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(ctx, caCertFile, 0),
+                                                              WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_use_certificate_file(ctx, cliCertFile,
+                                     WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_use_PrivateKey_file(ctx, cliKeyFile,
+                                     WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_set_cipher_list(ctx,
+                             "ECDHE-RSA-AES128-GCM-SHA256"), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_UseSupportedCurve(ctx, WOLFSSL_ECC_SECP256R1),
+                                                              WOLFSSL_SUCCESS);
+    /* 8 ladder steps per call: key generation and ECDH both yield */
+    AssertIntEQ(wolfSSL_CTX_UseEccNonBlock(ctx, 8), WOLFSSL_SUCCESS);
+    AssertNotNull(ssl = wolfSSL_new(ctx));
+
+    tcp_connect(&sockfd, wolfSSLIP, server_args.signal->port, 0, 0, NULL);
+    AssertIntEQ(wolfSSL_set_fd(ssl, sockfd), WOLFSSL_SUCCESS);
+
+    /* each WC_PENDING_E resumes the handshake where it left off */
+    do {
+        ret = wolfSSL_connect(ssl);
+        err = wolfSSL_get_error(ssl, 0);
+        if (err == WC_PENDING_E)
+            pending++;
+    } while (err == WC_PENDING_E);
+    AssertIntEQ(ret, WOLFSSL_SUCCESS);
+    /* P-256 key generation and ECDH each take 256 / 8 calls */
+    AssertIntEQ(pending, 2 * (256 / 8 - 1));
+
+    AssertIntEQ(wolfSSL_write(ssl, msg, (int)XSTRLEN(msg)), (int)XSTRLEN(msg));
+    AssertIntGT(wolfSSL_read(ssl, reply, sizeof(reply) - 1), 0);
+
+    wolfSSL_free(ssl);
+    wolfSSL_CTX_free(ctx);
+    CloseSocket(sockfd);
+
+    join_thread(serverThread);
+    AssertIntEQ(server_args.return_code, TEST_SUCCESS);
+
+    FreeTcpReady(&ready);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if (defined(HAVE_CURVE25519) || defined(HAVE_CURVE448)) && \
+    defined(HAVE_SUPPORTED_CURVES) && defined(HAVE_AESGCM) && \
+    !defined(NO_SHA256) && !defined(NO_RSA) && !defined(WOLFSSL_NO_TLS12) && \
+    defined(HAVE_IO_TESTS_DEPENDENCIES)
+/* TLS 1.2 ECDHE-RSA handshake with only group offered by the client */
+static void test_ecdhe_group_handshake(word16 group, const char* name)
+{
+    tcp_ready   ready;
+    func_args   server_args;
+    THREAD_TYPE serverThread;
+    callback_functions server_cbf;
+    SOCKET_T sockfd = 0;
+    WOLFSSL_CTX* ctx;
+    WOLFSSL* ssl;
+    char     msg[] = "hello wolfssl!";
+    char     reply[1024];
+
+    XMEMSET(&server_args, 0, sizeof(func_args));
+    XMEMSET(&server_cbf, 0, sizeof(callback_functions));
+
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(ctx, caCertFile, 0),
+                                                              WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_UseSupportedCurve(ctx, group), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_set_cipher_list(ctx,
+                             "ECDHE-RSA-AES128-GCM-SHA256"), WOLFSSL_SUCCESS);
+
+    StartTCP();
+    InitTcpReady(&ready);
+
+    server_cbf.method = wolfTLSv1_2_server_method;
+    server_args.signal = &ready;
+    server_args.callbacks = &server_cbf;
+    server_args.return_code = TEST_FAIL;
+    start_thread(test_server_nofail, &server_args, &serverThread);
+    wait_tcp_ready(&server_args);
+
+    AssertNotNull(ssl = wolfSSL_new(ctx));
+    tcp_connect(&sockfd, wolfSSLIP, server_args.signal->port, 0, 0, NULL);
+    AssertIntEQ(wolfSSL_set_fd(ssl, sockfd), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_connect(ssl), WOLFSSL_SUCCESS);
+    AssertNotNull(wolfSSL_get_curve_name(ssl));
+    AssertStrEQ(wolfSSL_get_curve_name(ssl), name);
+
+    AssertIntEQ(wolfSSL_write(ssl, msg, (int)XSTRLEN(msg)), (int)XSTRLEN(msg));
+    AssertIntGT(wolfSSL_read(ssl, reply, sizeof(reply) - 1), 0);
+
+    wolfSSL_free(ssl);
+    CloseSocket(sockfd);
+    wolfSSL_CTX_free(ctx);
+
+    join_thread(serverThread);
+    AssertIntEQ(server_args.return_code, TEST_SUCCESS);
+
+    FreeTcpReady(&ready);
+}
+#endif
+
+static void test_wolfSSL_X25519_handshake(void)
+{
+#if defined(HAVE_CURVE25519) && defined(HAVE_SUPPORTED_CURVES) && \
+    defined(HAVE_AESGCM) && !defined(NO_SHA256) && !defined(NO_RSA) && \
+    !defined(WOLFSSL_NO_TLS12) && defined(HAVE_IO_TESTS_DEPENDENCIES)
+    printf(testingFmt, "X25519 ECDHE handshake");
+
+    test_ecdhe_group_handshake(WOLFSSL_ECC_X25519, "X25519");
+
+    printf(resultFmt, passed);
+#endif
+}
+
+static void test_wolfSSL_X448_handshake(void)
+{
+#if defined(HAVE_CURVE448) && defined(HAVE_SUPPORTED_CURVES) && \
+    defined(HAVE_AESGCM) && !defined(NO_SHA256) && !defined(NO_RSA) && \
+    !defined(WOLFSSL_NO_TLS12) && defined(HAVE_IO_TESTS_DEPENDENCIES)
+    printf(testingFmt, "X448 ECDHE handshake");
+
+    test_ecdhe_group_handshake(WOLFSSL_ECC_X448, "X448");
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if defined(HAVE_ECC) && !defined(NO_WOLFSSL_CLIENT) && \
+    defined(WOLFSSL_PTHREADS) && !defined(SINGLE_THREADED) && \
+    !defined(USE_WINDOWS_API)
+#include <sys/wait.h>
+
+/* Wait for the pool to have ready keys of group */
+static void test_EphKeyPool_wait_ready(WOLFSSL_CTX* ctx, word16 group,
+                                       word32 ready)
+{
+    word32 r = 0;
+    word32 t = 0;
+    int    i;
+
+    for (i = 0; i < 1000; i++) {
+        AssertIntEQ(wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx, group, &r, &t),
+                                                              WOLFSSL_SUCCESS);
+        if (r == ready)
+            break;
+        XSLEEP_MS(10);
+    }
+    AssertIntEQ(r, ready);
+}
+#endif
+
+static void test_wolfSSL_CTX_UseEphemeralKeyPool(void)
+{
+#if defined(HAVE_ECC) && !defined(NO_WOLFSSL_CLIENT)
+    WOLFSSL_CTX *ctx;
+    int ret;
+
+    ctx = wolfSSL_CTX_new(wolfSSLv23_client_method());
+    AssertNotNull(ctx);
+
+    ret = wolfSSL_CTX_UseEphemeralKeyPool(ctx, 4);
+    if (ret != NOT_COMPILED_IN) {
+    #if defined(WOLFSSL_PTHREADS) && !defined(SINGLE_THREADED) && \
+        !defined(USE_WINDOWS_API)
+        word32 ready;
+        word32 taken;
+        pid_t  pid;
+        int    status;
+    #endif
+
+        printf(testingFmt, "wolfSSL_CTX_UseEphemeralKeyPool()");
+
+        AssertIntEQ(WOLFSSL_SUCCESS, ret);
+        AssertIntEQ(BAD_FUNC_ARG, wolfSSL_CTX_UseEphemeralKeyPool(NULL, 4));
+        AssertIntEQ(BAD_FUNC_ARG, wolfSSL_CTX_UseEphemeralKeyPool(ctx, 65536));
+        /* restarted with another depth, then stopped */
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_UseEphemeralKeyPool(ctx, 2));
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_UseEphemeralKeyPool(ctx, 0));
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_UseEphemeralKeyPool(ctx, 0));
+
+        /* pool of the CTX supported curves, freed with the CTX */
+        AssertIntEQ(WOLFSSL_SUCCESS,
+                      wolfSSL_CTX_UseSupportedCurve(ctx, WOLFSSL_ECC_SECP256R1));
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_UseEphemeralKeyPool(ctx, 4));
+
+    #if defined(WOLFSSL_PTHREADS) && !defined(SINGLE_THREADED) && \
+        !defined(USE_WINDOWS_API)
+        /* only pooled groups have stats */
+        AssertIntEQ(BAD_FUNC_ARG, wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                                    WOLFSSL_ECC_SECP384R1, &ready, &taken));
+        AssertIntEQ(BAD_FUNC_ARG, wolfSSL_CTX_GetEphemeralKeyPoolStats(NULL,
+                                    WOLFSSL_ECC_SECP256R1, &ready, &taken));
+        test_EphKeyPool_wait_ready(ctx, WOLFSSL_ECC_SECP256R1, 4);
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                                    WOLFSSL_ECC_SECP256R1, &ready, &taken));
+        AssertIntEQ(taken, 0);
+
+        /* a child process must not inherit the parent's keys */
+        pid = fork();
+        AssertIntGE(pid, 0);
+        if (pid == 0) {
+            ret = wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                                     WOLFSSL_ECC_SECP256R1, &ready, &taken);
+            _exit((ret == WOLFSSL_SUCCESS && ready == 0) ? 0 : 1);
+        }
+        AssertIntEQ(waitpid(pid, &status, 0), pid);
+        AssertTrue(WIFEXITED(status));
+        AssertIntEQ(WEXITSTATUS(status), 0);
+        /* the parent's pool is untouched */
+        AssertIntEQ(WOLFSSL_SUCCESS, wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                                    WOLFSSL_ECC_SECP256R1, &ready, &taken));
+        AssertIntEQ(ready, 4);
+    #endif
+
+        printf(resultFmt, passed);
+    }
+
+    wolfSSL_CTX_free(ctx);
+#endif
+}
+
+#if defined(HAVE_ECC) && defined(HAVE_SUPPORTED_CURVES) && \
+    defined(HAVE_AESGCM) && !defined(NO_SHA256) && \
+    !defined(WOLFSSL_NO_TLS12) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_PTHREADS) && !defined(USE_WINDOWS_API)
+/* Client ECDHE public key seen in the last ClientKeyExchange */
+static byte   test_EphKeyPool_pub[1 + 2 * MAX_ECC_BYTES];
+static word32 test_EphKeyPool_pubSz;
+
+/* Send callback recording the point in a TLS 1.2 ClientKeyExchange */
+static int test_EphKeyPool_send(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    const byte* b = (const byte*)buf;
+
+    /* record: handshake, TLS 1.2; message: client_key_exchange, point */
+    if (sz > 10 && b[0] == 0x16 && b[5] == 0x10 && b[9] > 0 &&
+            b[9] <= sizeof(test_EphKeyPool_pub) && sz >= 10 + b[9]) {
+        test_EphKeyPool_pubSz = b[9];
+        XMEMCPY(test_EphKeyPool_pub, b + 10, b[9]);
+    }
+
+    return EmbedSend(ssl, buf, sz, ctx);
+}
+
+/* Handshake with a new server, the client's ECDHE public key goes into pub */
+static void test_EphKeyPool_connect(WOLFSSL_CTX* ctx, byte* pub)
+{
+    tcp_ready   ready;
+    func_args   server_args;
+    THREAD_TYPE serverThread;
+    callback_functions server_cbf;
+    SOCKET_T sockfd = 0;
+    WOLFSSL* ssl;
+    char     msg[] = "hello wolfssl!";
+    char     reply[1024];
+
+    XMEMSET(&server_args, 0, sizeof(func_args));
+    XMEMSET(&server_cbf, 0, sizeof(callback_functions));
+
+    StartTCP();
+    InitTcpReady(&ready);
+
+    server_cbf.method = wolfTLSv1_2_server_method;
+    server_args.signal = &ready;
+    server_args.callbacks = &server_cbf;
+    server_args.return_code = TEST_FAIL;
+    start_thread(test_server_nofail, &server_args, &serverThread);
+    wait_tcp_ready(&server_args);
+
+    AssertNotNull(ssl = wolfSSL_new(ctx));
+    wolfSSL_SSLSetIOSend(ssl, test_EphKeyPool_send);
+    tcp_connect(&sockfd, wolfSSLIP, server_args.signal->port, 0, 0, NULL);
+    AssertIntEQ(wolfSSL_set_fd(ssl, sockfd), WOLFSSL_SUCCESS);
+
+    test_EphKeyPool_pubSz = 0;
+    AssertIntEQ(wolfSSL_connect(ssl), WOLFSSL_SUCCESS);
+    AssertIntEQ(test_EphKeyPool_pubSz, 65);
+    XMEMCPY(pub, test_EphKeyPool_pub, test_EphKeyPool_pubSz);
+
+    AssertIntEQ(wolfSSL_write(ssl, msg, (int)XSTRLEN(msg)), (int)XSTRLEN(msg));
+    AssertIntGT(wolfSSL_read(ssl, reply, sizeof(reply) - 1), 0);
+
+    wolfSSL_free(ssl);
+    CloseSocket(sockfd);
+
+    join_thread(serverThread);
+    AssertIntEQ(server_args.return_code, TEST_SUCCESS);
+
+    FreeTcpReady(&ready);
+}
+#endif
+
+static void test_wolfSSL_CTX_UseEphemeralKeyPool_handshake(void)
+{
+#if defined(HAVE_ECC) && defined(HAVE_SUPPORTED_CURVES) && \
+    defined(HAVE_AESGCM) && !defined(NO_SHA256) && \
+    !defined(WOLFSSL_NO_TLS12) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_PTHREADS) && !defined(USE_WINDOWS_API)
+    WOLFSSL_CTX* ctx;
+    byte   pub1[65];
+    byte   pub2[65];
+    word32 ready;
+    word32 taken;
+
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_UseSupportedCurve(ctx, WOLFSSL_ECC_SECP256R1),
+                                                              WOLFSSL_SUCCESS);
+    if (wolfSSL_CTX_UseEphemeralKeyPool(ctx, 2) == NOT_COMPILED_IN) {
+        wolfSSL_CTX_free(ctx);
+        return;
+    }
+
+    printf(testingFmt, "wolfSSL_CTX_UseEphemeralKeyPool() handshake");
+
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(ctx, caCertFile, 0),
+                                                              WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_use_certificate_file(ctx, cliCertFile,
+                                     WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_use_PrivateKey_file(ctx, cliKeyFile,
+                                     WOLFSSL_FILETYPE_PEM), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_set_cipher_list(ctx,
+                             "ECDHE-RSA-AES128-GCM-SHA256"), WOLFSSL_SUCCESS);
+
+    /* each handshake takes a different key out of a full pool */
+    test_EphKeyPool_wait_ready(ctx, WOLFSSL_ECC_SECP256R1, 2);
+    test_EphKeyPool_connect(ctx, pub1);
+    AssertIntEQ(wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                 WOLFSSL_ECC_SECP256R1, &ready, &taken), WOLFSSL_SUCCESS);
+    AssertIntEQ(taken, 1);
+
+    test_EphKeyPool_connect(ctx, pub2);
+    AssertIntEQ(wolfSSL_CTX_GetEphemeralKeyPoolStats(ctx,
+                 WOLFSSL_ECC_SECP256R1, &ready, &taken), WOLFSSL_SUCCESS);
+    AssertIntEQ(taken, 2);
+    AssertIntNE(XMEMCMP(pub1, pub2, sizeof(pub1)), 0);
+
+    /* restarting doesn't disturb a CTX that has made connections */
+    AssertIntEQ(wolfSSL_CTX_UseEphemeralKeyPool(ctx, 1), WOLFSSL_SUCCESS);
+    test_EphKeyPool_wait_ready(ctx, WOLFSSL_ECC_SECP256R1, 1);
+    test_EphKeyPool_connect(ctx, pub1);
+    AssertIntNE(XMEMCMP(pub1, pub2, sizeof(pub1)), 0);
+
+    wolfSSL_CTX_free(ctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
 static void test_wolfSSL_CTX_get0_privatekey(void)
 {
 #ifdef OPENSSL_ALL
@@ -54094,16 +55950,27 @@ void ApiTest(void)
     AssertIntEQ(test_wolfSSL_CTX_use_certificate_buffer(), WOLFSSL_SUCCESS);
     test_wolfSSL_CTX_use_PrivateKey_file();
     test_wolfSSL_CTX_load_verify_locations();
+    test_wolfSSL_CTX_memmap_cert_cache();
     test_wolfSSL_CertManagerCheckOCSPResponse();
     test_wolfSSL_CertManagerLoadCABuffer();
     test_wolfSSL_CertManagerGetCerts();
     test_wolfSSL_CertManagerSetVerify();
+    test_wolfSSL_CertManagerVerifyCache();
     test_wolfSSL_CertManagerNameConstraint();
     test_wolfSSL_CertManagerNameConstraint2();
     test_wolfSSL_CertManagerNameConstraint3();
     test_wolfSSL_CertManagerNameConstraint4();
     test_wolfSSL_CertManagerNameConstraint5();
     test_wolfSSL_CertManagerCRL();
+    test_wolfSSL_CertManagerCheckCRL_lazy();
+    test_wolfSSL_CertManagerOCSP();
+    test_wolfSSL_CertManagerLoadCAHashDir();
+    test_wolfSSL_CertManagerLoadCA_parallel();
+    test_wolfSSL_CertManagerLoadCA_parallel_bad();
+    test_wolfSSL_CertManagerCATable();
+    test_wolfSSL_CertManagerSignerKeyCache();
+    test_wolfSSL_CertManagerSignerVerifyTable();
+    test_wolfSSL_CertManagerGetCAByName();
     test_wolfSSL_CTX_load_verify_locations_ex();
     test_wolfSSL_CTX_load_verify_buffer_ex();
     test_wolfSSL_CTX_load_verify_chain_buffer_format();
@@ -54122,6 +55989,11 @@ void ApiTest(void)
     test_wolfSSL_SetTmpDH_buffer();
     test_wolfSSL_SetMinMaxDhKey_Sz();
     test_SetTmpEC_DHE_Sz();
+    test_wolfSSL_UseEccNonBlock();
+    test_wolfSSL_X25519_handshake();
+    test_wolfSSL_X448_handshake();
+    test_wolfSSL_CTX_UseEphemeralKeyPool();
+    test_wolfSSL_CTX_UseEphemeralKeyPool_handshake();
     test_wolfSSL_CTX_get0_privatekey();
     test_wolfSSL_dtls_set_mtu();
 #if !defined(NO_WOLFSSL_CLIENT) && !defined(NO_WOLFSSL_SERVER) && \
@@ -54570,6 +56442,7 @@ void ApiTest(void)
     test_wc_SetSubject();
     test_CheckCertSignature();
     test_wc_ParseCert();
+    test_wc_DecodedCert_size();
 
     /* wolfCrypt ECC tests */
     test_wc_ecc_get_curve_size_from_name();
@@ -54827,6 +56700,7 @@ void ApiTest(void)
     AssertIntEQ(test_wc_ed25519_make_key(), 0);
     AssertIntEQ(test_wc_ed25519_init(), 0);
     AssertIntEQ(test_wc_ed25519_sign_msg(), 0);
+    AssertIntEQ(test_wc_ed25519_verify_msg_batch(), 0);
     AssertIntEQ(test_wc_ed25519_import_public(), 0);
     AssertIntEQ(test_wc_ed25519_import_private_key(), 0);
     AssertIntEQ(test_wc_ed25519_export(), 0);
@@ -54870,6 +56744,10 @@ void ApiTest(void)
     AssertIntEQ(test_wc_ecc_size(), 0);
     test_wc_ecc_params();
     AssertIntEQ(test_wc_ecc_signVerify_hash(), 0);
+    AssertIntEQ(test_wc_ecc_make_verify_table(), 0);
+    AssertIntEQ(test_wc_ecc_presign(), 0);
+    AssertIntEQ(test_wc_ecc_fixed_base(), 0);
+    AssertIntEQ(test_wc_ecc_map_batch(), 0);
     PRIVATE_KEY_UNLOCK();
     AssertIntEQ(test_wc_ecc_shared_secret(), 0);
     AssertIntEQ(test_wc_ecc_export_x963(), 0);
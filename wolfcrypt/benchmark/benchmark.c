@@ -232,6 +232,19 @@
 #ifdef HAVE_ECC
     #include <wolfssl/wolfcrypt/ecc.h>
 #endif
+/* GetCAByName() is only exported for testing */
+#if !defined(WOLFCRYPT_ONLY) && !defined(NO_CERTS) && !defined(NO_SKID) && \
+    !defined(NO_WOLFSSL_CLIENT) && !defined(NO_RSA) && \
+    !defined(USE_CERT_BUFFERS_3072) && \
+    (defined(WOLFSSL_TEST_CERT) || defined(WOLFSSL_PUBLIC_ASN))
+    #include <wolfssl/internal.h>
+    #define BENCH_CA_LOOKUP_ENABLED
+#endif
+#if defined(WOLFSSL_SP_MATH_ALL) && defined(WOLFSSL_PUBLIC_MP) && \
+    !defined(WC_NO_RNG)
+    #include <wolfssl/wolfcrypt/sp_int.h>
+    #define BENCH_SP_INT_ENABLED
+#endif
 #ifdef HAVE_CURVE25519
     #include <wolfssl/wolfcrypt/curve25519.h>
 #endif
@@ -396,6 +409,7 @@
 #define BENCH_ECC_P256           0x01000000
 #define BENCH_ECC_P384           0x02000000
 #define BENCH_ECC_P521           0x04000000
+#define BENCH_ED25519_BATCH      0x08000000
 #define BENCH_ECCSI_KEYGEN       0x00000020
 #define BENCH_ECCSI_PAIRGEN      0x00000040
 #define BENCH_ECCSI_VALIDATE     0x00000080
@@ -438,6 +452,8 @@
 /* Other */
 #define BENCH_RNG                0x00000001
 #define BENCH_SCRYPT             0x00000002
+#define BENCH_CA_LOOKUP          0x00000004
+#define BENCH_SP_INT             0x00000008
 
 
 /* Benchmark all compiled in algorithms.
@@ -638,6 +654,9 @@ static const bench_alg bench_asym_opt[] = {
 #ifdef HAVE_ED25519
     { "-ed25519-kg",         BENCH_ED25519_KEYGEN    },
     { "-ed25519",            BENCH_ED25519_SIGN      },
+    #ifdef HAVE_ED25519_VERIFY
+    { "-ed25519-batch",      BENCH_ED25519_BATCH     },
+    #endif
 #endif
 #ifdef HAVE_CURVE448
     { "-curve448-kg",        BENCH_CURVE448_KEYGEN   },
@@ -673,6 +692,12 @@ static const bench_alg bench_other_opt[] = {
 #endif
 #ifdef HAVE_SCRYPT
     { "-scrypt",             BENCH_SCRYPT            },
+#endif
+#ifdef BENCH_CA_LOOKUP_ENABLED
+    { "-ca-lookup",          BENCH_CA_LOOKUP         },
+#endif
+#ifdef BENCH_SP_INT_ENABLED
+    { "-sp-int",             BENCH_SP_INT            },
 #endif
     { NULL, 0}
 };
@@ -2077,6 +2102,17 @@ static void* benchmarks_do(void* args)
         bench_scrypt();
 #endif
 
+#ifdef BENCH_CA_LOOKUP_ENABLED
+    /* Loads thousands of CA certificates so only run when requested. */
+    if (bench_other_algs & BENCH_CA_LOOKUP)
+        bench_ca_lookup();
+#endif
+
+#ifdef BENCH_SP_INT_ENABLED
+    if (bench_all || (bench_other_algs & BENCH_SP_INT))
+        bench_sp_int();
+#endif
+
 #ifndef NO_RSA
     #ifdef WOLFSSL_KEY_GEN
         if (bench_all || (bench_asym_algs & BENCH_RSA_KEYGEN)) {
@@ -2208,6 +2244,10 @@ static void* benchmarks_do(void* args)
         bench_ed25519KeyGen();
     if (bench_all || (bench_asym_algs & BENCH_ED25519_SIGN))
         bench_ed25519KeySign();
+    #if defined(HAVE_ED25519_SIGN) && defined(HAVE_ED25519_VERIFY)
+    if (bench_all || (bench_asym_algs & BENCH_ED25519_BATCH))
+        bench_ed25519VerifyBatch();
+    #endif
 #endif
 
 #ifdef HAVE_CURVE448
@@ -4807,6 +4847,200 @@ exit:
 
 #endif /* HAVE_SCRYPT */
 
+#ifdef BENCH_CA_LOOKUP_ENABLED
+
+#ifndef BENCH_CA_LOOKUP_MAX
+    #define BENCH_CA_LOOKUP_MAX     10000
+#endif
+
+/* Replace every occurrence of find in buf with repl of the same length. */
+static void bench_ca_replace(byte* buf, word32 sz, const byte* find,
+    const byte* repl, word32 len)
+{
+    word32 i;
+
+    for (i = 0; i + len <= sz; i++) {
+        if (XMEMCMP(buf + i, find, len) == 0)
+            XMEMCPY(buf + i, repl, len);
+    }
+}
+
+/* Look up CAs by subject name hash with a small and a large number of CAs
+ * loaded. Copies of the test CA certificate are given a unique common name
+ * and key id so each is a separate signer. The lookup cost should not grow
+ * with the number of CAs loaded. */
+void bench_ca_lookup(void)
+{
+    static const int caCnt[] = { 16, BENCH_CA_LOOKUP_MAX };
+    static const char cn[] = "www.wolfssl.com";
+#ifdef USE_CERT_BUFFERS_1024
+    const byte* ca = ca_cert_der_1024;
+    word32      caSz = (word32)sizeof_ca_cert_der_1024;
+#else
+    const byte* ca = ca_cert_der_2048;
+    word32      caSz = (word32)sizeof_ca_cert_der_2048;
+#endif
+    WOLFSSL_CTX* ctx = NULL;
+    WOLFSSL_CERT_MANAGER* cm = NULL;
+    DecodedCert cert;
+    byte*  hashes = NULL;
+    byte*  der = NULL;
+    byte   keyId[KEYID_SIZE];
+    byte   newKeyId[KEYID_SIZE];
+    char   name[sizeof(cn)];
+    int    ret = 0, i, j, n = 0, count = 0, miss;
+    double start = 0;
+
+    ctx = wolfSSL_CTX_new_ex(wolfSSLv23_client_method_ex(HEAP_HINT),
+                             HEAP_HINT);
+    if (ctx != NULL)
+        cm = wolfSSL_CTX_GetCertManager(ctx);
+    hashes = (byte*)XMALLOC(BENCH_CA_LOOKUP_MAX * SIGNER_DIGEST_SIZE,
+                            HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    der = (byte*)XMALLOC(caSz, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (cm == NULL || hashes == NULL || der == NULL) {
+        ret = MEMORY_E;
+        goto exit;
+    }
+
+    /* key id of the test CA is in both its SKID and AKID */
+    wc_InitDecodedCert(&cert, ca, caSz, HEAP_HINT);
+    ret = wc_ParseCert(&cert, CA_TYPE, NO_VERIFY, NULL);
+    if (ret == 0)
+        XMEMCPY(keyId, cert.extSubjKeyId, KEYID_SIZE);
+    wc_FreeDecodedCert(&cert);
+
+    for (i = 0; ret == 0 && i < (int)(sizeof(caCnt) / sizeof(caCnt[0]));
+                                                                        i++) {
+        /* Grow the CA store up to the next size. */
+        for (; ret == 0 && n < caCnt[i]; n++) {
+            XMEMCPY(der, ca, caSz);
+            XSNPRINTF(name, sizeof(name), "www.%07x.com", n);
+            bench_ca_replace(der, caSz, (const byte*)cn, (const byte*)name,
+                             (word32)XSTRLEN(cn));
+            XMEMCPY(newKeyId, keyId, KEYID_SIZE);
+            XMEMCPY(newKeyId, &n, sizeof(n));
+            bench_ca_replace(der, caSz, keyId, newKeyId, KEYID_SIZE);
+
+            /* the test CA may have expired */
+            ret = wolfSSL_CTX_load_verify_buffer_ex(ctx, der, (long)caSz,
+                    WOLFSSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY);
+            ret = (ret == WOLFSSL_SUCCESS) ? 0 : ret;
+            if (ret == 0) {
+                wc_InitDecodedCert(&cert, der, caSz, HEAP_HINT);
+                ret = wc_ParseCert(&cert, CA_TYPE, NO_VERIFY, NULL);
+                if (ret == 0) {
+                    XMEMCPY(hashes + n * SIGNER_DIGEST_SIZE, cert.subjectHash,
+                            SIGNER_DIGEST_SIZE);
+                }
+                wc_FreeDecodedCert(&cert);
+            }
+        }
+        if (ret != 0) {
+            printf("CA lookup setup failed, ret = %d\n", ret);
+            break;
+        }
+
+        /* subjects loaded are found, then with the hashes changed none are */
+        for (miss = 0; ret == 0 && miss <= 1; miss++) {
+            if (miss) {
+                for (j = 0; j < n; j++)
+                    hashes[j * SIGNER_DIGEST_SIZE] ^= 0x80;
+            }
+            bench_stats_start(&count, &start);
+            do {
+                for (j = 0; j < n; j++) {
+                    if ((GetCAByName(cm, hashes + j * SIGNER_DIGEST_SIZE) ==
+                                                                NULL) != miss) {
+                        ret = BAD_STATE_E;
+                    }
+                }
+                count += j;
+            } while (ret == 0 && bench_stats_sym_check(start));
+            bench_stats_asym_finish("CA", n, miss ? "miss" : "hit", 0, count,
+                                    start, ret);
+            if (miss) {
+                for (j = 0; j < n; j++)
+                    hashes[j * SIGNER_DIGEST_SIZE] ^= 0x80;
+            }
+        }
+    }
+
+exit:
+    if (ret == MEMORY_E)
+        printf("CA lookup: allocation failed\n");
+    XFREE(der, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(hashes, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    wolfSSL_CTX_free(ctx);
+}
+
+#endif /* BENCH_CA_LOOKUP_ENABLED */
+
+#ifdef BENCH_SP_INT_ENABLED
+
+/* Multiply and square operands of the sizes used by large RSA and DH keys.
+ * Sizes larger than the configured SP_INT_BITS are skipped. */
+void bench_sp_int(void)
+{
+    static const int bitSz[] = { 4096, 6144, 8192 };
+    static byte buf[8192 / 8];
+    mp_int a, b, r;
+    int    ret = 0, i, j, op, count = 0;
+    double start = 0;
+
+    for (i = 0; i < (int)(sizeof(bitSz) / sizeof(bitSz[0])); i++) {
+        if (bitSz[i] > SP_INT_BITS)
+            break;
+
+        ret = mp_init_multi(&a, &b, &r, NULL, NULL, NULL);
+        if (ret == MP_OKAY)
+            ret = wc_RNG_GenerateBlock(&gRng, buf, bitSz[i] / 8);
+        if (ret == 0) {
+            buf[0] |= 0x80;
+            ret = mp_read_unsigned_bin(&a, buf, bitSz[i] / 8);
+        }
+        if (ret == MP_OKAY)
+            ret = wc_RNG_GenerateBlock(&gRng, buf, bitSz[i] / 8);
+        if (ret == 0) {
+            buf[0] |= 0x80;
+            ret = mp_read_unsigned_bin(&b, buf, bitSz[i] / 8);
+        }
+        if (ret != 0) {
+            printf("SP int setup failed, ret = %d\n", ret);
+            break;
+        }
+
+        /* op 0: multiply, op 1: square */
+        for (op = 0; op < 2; op++) {
+            bench_stats_start(&count, &start);
+            do {
+                for (j = 0; j < agreeTimes; j++) {
+                    if (op == 0)
+                        ret = mp_mul(&a, &b, &r);
+                    else
+                        ret = mp_sqr(&a, &r);
+                    if (ret != MP_OKAY)
+                        goto exit;
+                }
+                count += j;
+            } while (bench_stats_sym_check(start));
+exit:
+            bench_stats_asym_finish("SP INT", bitSz[i], op == 0 ? "mul" : "sqr",
+                                    0, count, start, ret);
+            if (ret != MP_OKAY)
+                break;
+        }
+
+        mp_clear(&r);
+        mp_clear(&b);
+        mp_clear(&a);
+        if (ret != MP_OKAY)
+            break;
+    }
+}
+
+#endif /* BENCH_SP_INT_ENABLED */
+
 #ifndef NO_HMAC
 
 static void bench_hmac(int useDeviceID, int type, int digestSz,
@@ -6389,6 +6623,71 @@ exit_ed_verify:
 
     wc_ed25519_free(&genKey);
 }
+
+#if defined(HAVE_ED25519_SIGN) && defined(HAVE_ED25519_VERIFY)
+#define BENCH_ED25519_BATCH_SZ  64
+
+void bench_ed25519VerifyBatch(void)
+{
+    int    ret;
+    double start;
+    int    i, count;
+    ed25519_key  genKey;
+    ed25519_key* keys[BENCH_ED25519_BATCH_SZ];
+    byte   sig[BENCH_ED25519_BATCH_SZ][ED25519_SIG_SIZE];
+    byte   msg[BENCH_ED25519_BATCH_SZ][64];
+    const byte* sigs[BENCH_ED25519_BATCH_SZ];
+    const byte* msgs[BENCH_ED25519_BATCH_SZ];
+    word32 sigLens[BENCH_ED25519_BATCH_SZ];
+    word32 msgLens[BENCH_ED25519_BATCH_SZ];
+    int    res[BENCH_ED25519_BATCH_SZ];
+    const char**desc = bench_desc_words[lng_index];
+
+    wc_ed25519_init(&genKey);
+
+    ret = wc_ed25519_make_key(&gRng, ED25519_KEY_SIZE, &genKey);
+    if (ret != 0) {
+        printf("ed25519_make_key failed\n");
+        return;
+    }
+
+    /* make dummy msgs, each signed */
+    for (i = 0; i < BENCH_ED25519_BATCH_SZ && ret == 0; i++) {
+        XMEMSET(msg[i], (byte)i, sizeof(msg[i]));
+        sigLens[i] = sizeof(sig[i]);
+        ret = wc_ed25519_sign_msg(msg[i], sizeof(msg[i]), sig[i], &sigLens[i],
+                                  &genKey);
+        keys[i] = &genKey;
+        sigs[i] = sig[i];
+        msgs[i] = msg[i];
+        msgLens[i] = sizeof(msg[i]);
+    }
+    if (ret != 0) {
+        printf("ed25519_sign_msg failed\n");
+        goto exit_ed_batch;
+    }
+
+    /* count is the number of signatures verified */
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < agreeTimes; i++) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLens, msgs, msgLens,
+                                              keys, BENCH_ED25519_BATCH_SZ, res,
+                                              &gRng);
+            if (ret != 0) {
+                printf("ed25519_verify_msg_batch failed\n");
+                goto exit_ed_batch_verify;
+            }
+            count += BENCH_ED25519_BATCH_SZ;
+        }
+    } while (bench_stats_sym_check(start));
+exit_ed_batch_verify:
+    bench_stats_asym_finish("ED-BAT", 25519, desc[5], 0, count, start, ret);
+
+exit_ed_batch:
+    wc_ed25519_free(&genKey);
+}
+#endif /* HAVE_ED25519_SIGN && HAVE_ED25519_VERIFY */
 #endif /* HAVE_ED25519 */
 
 #ifdef HAVE_CURVE448
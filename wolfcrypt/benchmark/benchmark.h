@@ -69,6 +69,8 @@ void bench_sha3_512(int useDeviceID);
 int  bench_ripemd(void);
 void bench_cmac(void);
 void bench_scrypt(void);
+void bench_ca_lookup(void);
+void bench_sp_int(void);
 void bench_hmac_md5(int useDeviceID);
 void bench_hmac_sha(int useDeviceID);
 void bench_hmac_sha224(int useDeviceID);
@@ -89,6 +91,7 @@ void bench_curve25519KeyGen(void);
 void bench_curve25519KeyAgree(void);
 void bench_ed25519KeyGen(void);
 void bench_ed25519KeySign(void);
+void bench_ed25519VerifyBatch(void);
 void bench_curve448KeyGen(void);
 void bench_curve448KeyAgree(void);
 void bench_ed448KeyGen(void);
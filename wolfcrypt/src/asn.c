@@ -106,8 +106,18 @@ ASN Options:
     #include <wolfssl/wolfcrypt/sha256.h>
 
     #include <wolfssl/wolfcrypt/ecc.h>
-
-
+#ifdef HAVE_ED25519
+    #include <wolfssl/wolfcrypt/ed25519.h>
+#endif
+#ifdef HAVE_CURVE25519
+    #include <wolfssl/wolfcrypt/curve25519.h>
+#endif
+#ifdef HAVE_ED448
+    #include <wolfssl/wolfcrypt/ed448.h>
+#endif
+#ifdef HAVE_CURVE448
+    #include <wolfssl/wolfcrypt/curve448.h>
+#endif
 
 
 
@@ -2481,7 +2491,8 @@ const char* GetSigName(int oid) {
 }
 
 
-#if !defined(WOLFSSL_ASN_TEMPLATE) || defined(HAVE_PKCS7)
+#if !defined(WOLFSSL_ASN_TEMPLATE) || defined(HAVE_PKCS7) || \
+    defined(HAVE_OCSP)
 /* Set the DER/BER encoding of the ASN.1 INTEGER header.
  *
  * When output is NULL, calculate the header length only.
@@ -3559,6 +3570,18 @@ static word32 SetBitString16Bit(word16 val, byte* output)
     static const byte keyRsaOid[] = {42, 134, 72, 134, 247, 13, 1, 1, 1};
     static const byte keyEcdsaOid[] = {42, 134, 72, 206, 61, 2, 1};
     static const byte keyDhOid[] = {42, 134, 72, 134, 247, 13, 1, 3, 1};
+    #ifdef HAVE_ED25519
+    static const byte keyEd25519Oid[] = {43, 101, 112};
+    #endif /* HAVE_ED25519 */
+    #ifdef HAVE_CURVE25519
+    static const byte keyCurve25519Oid[] = {43, 101, 110};
+    #endif
+    #ifdef HAVE_ED448
+    static const byte keyEd448Oid[] = {43, 101, 113};
+    #endif /* HAVE_ED448 */
+    #ifdef HAVE_CURVE448
+    static const byte keyCurve448Oid[] = {43, 101, 111};
+    #endif
 
 /* curveType */
     /* See "ecc_sets" table in ecc.c */
@@ -3608,6 +3631,10 @@ static const byte wrapPwriKekOid[] = {42, 134, 72, 134, 247, 13, 1, 9, 16, 3,9};
     static const byte dhSinglePass_stdDH_sha512kdf_Oid[] = {43, 129, 4, 1, 11, 3};
 
 /* ocspType */
+#ifdef HAVE_OCSP
+    static const byte ocspBasicOid[]    = {43, 6, 1, 5, 5, 7, 48, 1, 1};
+    static const byte ocspNonceOid[]    = {43, 6, 1, 5, 5, 7, 48, 1, 2};
+#endif /* HAVE_OCSP */
 
 /* certExtType */
 static const byte extBasicCaOid[] = {85, 29, 19};
@@ -3892,6 +3919,30 @@ const byte* OidFromId(word32 id, word32 type, word32* oidSz)
                     oid = keyDhOid;
                     *oidSz = sizeof(keyDhOid);
                     break;
+            #ifdef HAVE_ED25519
+                case ED25519k:
+                    oid = keyEd25519Oid;
+                    *oidSz = sizeof(keyEd25519Oid);
+                    break;
+            #endif /* HAVE_ED25519 */
+            #ifdef HAVE_CURVE25519
+                case X25519k:
+                    oid = keyCurve25519Oid;
+                    *oidSz = sizeof(keyCurve25519Oid);
+                    break;
+            #endif /* HAVE_CURVE25519 */
+            #ifdef HAVE_ED448
+                case ED448k:
+                    oid = keyEd448Oid;
+                    *oidSz = sizeof(keyEd448Oid);
+                    break;
+            #endif /* HAVE_ED448 */
+            #ifdef HAVE_CURVE448
+                case X448k:
+                    oid = keyCurve448Oid;
+                    *oidSz = sizeof(keyCurve448Oid);
+                    break;
+            #endif /* HAVE_CURVE448 */
                 default:
                     break;
             }
@@ -3947,6 +3998,23 @@ const byte* OidFromId(word32 id, word32 type, word32* oidSz)
             break;
 
 
+        case oidOcspType:
+            switch (id) {
+            #ifdef HAVE_OCSP
+                case OCSP_BASIC_OID:
+                    oid = ocspBasicOid;
+                    *oidSz = sizeof(ocspBasicOid);
+                    break;
+                case OCSP_NONCE_OID:
+                    oid = ocspNonceOid;
+                    *oidSz = sizeof(ocspNonceOid);
+                    break;
+            #endif /* HAVE_OCSP */
+                default:
+                    break;
+            }
+            break;
+
         case oidCertExtType:
             switch (id) {
                 case BASIC_CA_OID:
@@ -7701,8 +7769,6 @@ void InitDecodedCert(DecodedCert* cert,
         XMEMSET(cert, 0, sizeof(DecodedCert));
 
         cert->subjectCNEnc    = CTC_UTF8;
-        cert->issuer[0]       = '\0';
-        cert->subject[0]      = '\0';
         cert->source          = source;  /* don't own */
         cert->maxIdx          = inSz;    /* can't go over this index */
         cert->heap            = heap;
@@ -7805,6 +7871,12 @@ void FreeDecodedCert(DecodedCert* cert)
     if (cert->subjectCNStored == 1) {
         XFREE(cert->subjectCN, cert->heap, DYNAMIC_TYPE_SUBJECT_CN);
     }
+    if (cert->issuer != NULL) {
+        /* subject shares the allocation */
+        XFREE(cert->issuer, cert->heap, DYNAMIC_TYPE_DCERT);
+        cert->issuer = NULL;
+        cert->subject = NULL;
+    }
     if (cert->pubKeyStored == 1) {
         XFREE((void*)cert->publicKey, cert->heap, DYNAMIC_TYPE_PUBLIC_KEY);
     }
@@ -8177,6 +8249,38 @@ int CalcHashId(const byte* data, word32 len, byte* hash)
     return ret;
 }
 
+#ifdef HAVE_OCSP
+/* Calculate the hash of a public key as used in an OCSP CertID.
+ *
+ * The hash is over the value of the subjectPublicKey BIT STRING. RSA keys are
+ * stored as that value already, ECC keys as the whole SubjectPublicKeyInfo.
+ *
+ * @param [in]  key     Public key as stored in a certificate or signer.
+ * @param [in]  keySz   Length of public key in bytes.
+ * @param [in]  keyOID  Key type.
+ * @param [out] hash    Buffer to hold hash.
+ * @return  0 on success.
+ * @return  ASN_PARSE_E when the ECC key encoding is invalid.
+ */
+int CalcKeyHashId(const byte* key, word32 keySz, word32 keyOID, byte* hash)
+{
+    word32 idx = 0;
+    int    len;
+
+    if (keyOID == ECDSAk) {
+        if (GetSequence(key, &idx, &len, keySz) < 0 ||
+                GetSequence(key, &idx, &len, keySz) < 0)
+            return ASN_PARSE_E;
+        idx += len;
+        if (CheckBitString(key, &idx, &len, keySz, 1, NULL) != 0)
+            return ASN_PARSE_E;
+        keySz = (word32)len;
+    }
+
+    return CalcHashId(key + idx, keySz, hash);
+}
+#endif /* HAVE_OCSP */
+
 /* Get the hash of the id using the SHA-1 or SHA-256.
  *
  * If the id is not the length of the hash, then hash it.
@@ -8662,6 +8766,7 @@ static int SetSubject(DecodedCert* cert, int id, byte* str, word32 strLen,
  *
  * @param [in, out] cert       Certificate object.
  * @param [in, out] full       Full name string. ([/<type>=<value>]*)
+ *                             May be NULL when not wanted.
  * @param [in, out] idx        Index int full name to place next component.
  * @param [in, out] nid        NID of component type.
  * @param [in]      isSubject  Whether this data is for a subject name.
@@ -8771,8 +8876,11 @@ static int GetRDN(DecodedCert* cert, char* full, word32* idx, int* nid,
         if (ret == 0) {
             /* Check there is space for this in the full name string and
              * terminating NUL character. */
-            if ((typeStrLen + strLen) < (word32)(WC_ASN_NAME_MAX - *idx))
-            {
+            if (full == NULL) {
+                /* Name string not wanted. */
+            }
+            else if ((typeStrLen + strLen) <
+                     (word32)(WC_ASN_NAME_MAX - *idx)) {
                 /* Add RDN to full string. */
                 XMEMCPY(&full[*idx], typeStr, typeStrLen);
                 *idx += typeStrLen;
@@ -8790,9 +8898,11 @@ static int GetRDN(DecodedCert* cert, char* full, word32* idx, int* nid,
 #endif /* WOLFSSL_ASN_TEMPLATE */
 
 /* Get a certificate name into the certificate object.
+ *
+ * The full name string is only built when it is wanted - see
+ * GetCertNameBuf().
  *
  * @param [in, out] cert      Decoded certificate object.
- * @param [out]     full      Buffer to hold full name as a string.
  * @param [out]     hash      Buffer to hold hash of name.
  * @param [in]      nameType  ISSUER or SUBJECT.
  * @param [in]      input     Buffer holding certificate name.
@@ -8807,7 +8917,70 @@ static int GetRDN(DecodedCert* cert, char* full, word32* idx, int* nid,
  * @return  ASN_UNKNOWN_OID_E when the OID cannot be verified.
  * @return  MEMORY_E when dynamic memory allocation fails.
  */
-static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+/* Hash a certificate name and record where it is for a lazy parse. The name
+ * string is decoded by DecodeCertDeferred() when wanted. */
+static int SkipCertName(DecodedCert* cert, byte* hash, const byte* input,
+                        word32* inOutIdx, word32 maxIdx)
+{
+    int    length;
+    word32 srcIdx = *inOutIdx;
+
+    if (CalcHashId(input + srcIdx, maxIdx - srcIdx, hash) != 0)
+        return ASN_PARSE_E;
+    if (GetSequence(input, &srcIdx, &length, maxIdx) < 0)
+        return ASN_PARSE_E;
+
+#if defined(HAVE_PKCS7) || defined(WOLFSSL_CERT_EXT)
+    cert->issuerRaw = &input[srcIdx];
+    cert->issuerRawLen = length;
+#endif
+    cert->lazyIssuerIdx = *inOutIdx;
+    cert->lazyIssuerEnd = maxIdx;
+    cert->lazyIssuer = 1;
+    *inOutIdx = srcIdx + length;
+
+    return 0;
+}
+#endif /* WOLFSSL_LAZY_CERT_DECODE */
+
+/* Get the buffer to build the full name string of a certificate into.
+ *
+ * The issuer and subject strings share one allocation made on first use. A
+ * lazy parse of the certificate being verified doesn't build name strings.
+ *
+ * @param [in, out] cert      Decoded certificate object.
+ * @param [in]      nameType  ISSUER or SUBJECT.
+ * @param [in]      input     Buffer holding certificate name.
+ * @param [out]     full      Buffer for name string or NULL when not wanted.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails.
+ */
+static int GetCertNameBuf(DecodedCert* cert, int nameType, const byte* input,
+                          char** full)
+{
+    *full = NULL;
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    if (cert->decodeLazy && input == cert->source)
+        return 0;
+#else
+    (void)input;
+#endif
+    if (cert->issuer == NULL) {
+        cert->issuer = (char*)XMALLOC(2 * WC_ASN_NAME_MAX, cert->heap,
+                                      DYNAMIC_TYPE_DCERT);
+        if (cert->issuer == NULL)
+            return MEMORY_E;
+        cert->subject = cert->issuer + WC_ASN_NAME_MAX;
+        cert->issuer[0] = '\0';
+        cert->subject[0] = '\0';
+    }
+    *full = (nameType == ISSUER) ? cert->issuer : cert->subject;
+
+    return 0;
+}
+
+static int GetCertName(DecodedCert* cert, byte* hash, int nameType,
                        const byte* input, word32* inOutIdx, word32 maxIdx)
 {
 #ifndef WOLFSSL_ASN_TEMPLATE
@@ -8816,9 +8989,19 @@ static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
     int    ret;
     word32 idx;
     word32 srcIdx = *inOutIdx;
+    char*  full;
 
     WOLFSSL_MSG("Getting Cert Name");
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    /* TLS verification only needs the issuer hash */
+    if (cert->decodeLazy && nameType == ISSUER && input == cert->source)
+        return SkipCertName(cert, hash, input, inOutIdx, maxIdx);
+#endif
+    ret = GetCertNameBuf(cert, nameType, input, &full);
+    if (ret != 0)
+        return ret;
+
     /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
      * calculated over the entire DER encoding of the Name field, including
      * the tag and length. */
@@ -9229,7 +9412,7 @@ static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
             WOLFSSL_MSG("ASN Name too big, skipping");
             tooBig = TRUE;
         }
-        if ((copy != NULL) && !tooBig) {
+        if ((copy != NULL) && !tooBig && (full != NULL)) {
             XMEMCPY(&full[idx], copy, copyLen);
             idx += copyLen;
             XMEMCPY(&full[idx], &input[srcIdx], strLen);
@@ -9237,7 +9420,8 @@ static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
         }
         srcIdx += strLen;
     }
-    full[idx++] = 0;
+    if (full != NULL)
+        full[idx++] = 0;
 
 
     *inOutIdx = srcIdx;
@@ -9249,16 +9433,25 @@ static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
     word32 idx = 0;
     int    len;
     word32 srcIdx = *inOutIdx;
+    char*  full;
 #ifdef WOLFSSL_X509_NAME_AVAILABLE
     WOLFSSL_X509_NAME* dName = NULL;
 #endif /* WOLFSSL_X509_NAME_AVAILABLE */
 
     WOLFSSL_MSG("Getting Cert Name");
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    /* TLS verification only needs the issuer hash */
+    if (cert->decodeLazy && nameType == ISSUER && input == cert->source)
+        return SkipCertName(cert, hash, input, inOutIdx, maxIdx);
+#endif
+    ret = GetCertNameBuf(cert, nameType, input, &full);
+
     /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
      * calculated over the entire DER encoding of the Name field, including
      * the tag and length. */
-    if (CalcHashId(input + srcIdx, maxIdx - srcIdx, hash) != 0) {
+    if ((ret == 0) &&
+            (CalcHashId(input + srcIdx, maxIdx - srcIdx, hash) != 0)) {
         ret = ASN_PARSE_E;
     }
 
@@ -9347,7 +9540,8 @@ static int GetCertName(DecodedCert* cert, char* full, byte* hash, int nameType,
     }
     if (ret == 0) {
         /* Terminate string. */
-        full[idx] = 0;
+        if (full != NULL)
+            full[idx] = 0;
         /* Return index into encoding after name. */
         *inOutIdx = srcIdx;
 
@@ -9412,7 +9606,6 @@ enum {
 int GetName(DecodedCert* cert, int nameType, int maxIdx)
 {
 #ifndef WOLFSSL_ASN_TEMPLATE
-    char*  full;
     byte*  hash;
     int    length;
     word32 localIdx;
@@ -9420,14 +9613,7 @@ int GetName(DecodedCert* cert, int nameType, int maxIdx)
 
     WOLFSSL_MSG("Getting Cert Name");
 
-    if (nameType == ISSUER) {
-        full = cert->issuer;
-        hash = cert->issuerHash;
-    }
-    else {
-        full = cert->subject;
-        hash = cert->subjectHash;
-    }
+    hash = (nameType == ISSUER) ? cert->issuerHash : cert->subjectHash;
 
     if (cert->srcIdx >= (word32)maxIdx) {
         return BUFFER_E;
@@ -9456,13 +9642,12 @@ int GetName(DecodedCert* cert, int nameType, int maxIdx)
     }
     length += localIdx - cert->srcIdx;
 
-    return GetCertName(cert, full, hash, nameType, cert->source, &cert->srcIdx,
+    return GetCertName(cert, hash, nameType, cert->source, &cert->srcIdx,
                        cert->srcIdx + length);
 #else
     ASNGetData dataASN[certNameASN_Length];
     word32 idx = cert->srcIdx;
     int    ret = 0;
-    char*  full;
     byte*  hash;
 
     WOLFSSL_MSG("Getting Cert Name");
@@ -9476,18 +9661,11 @@ int GetName(DecodedCert* cert, int nameType, int maxIdx)
         /* Store offset of SEQUENCE that is start of name. */
         cert->srcIdx = dataASN[CERTNAMEASN_IDX_NAME].offset;
 
-        /* Get fields to fill in based on name type. */
-        if (nameType == ISSUER) {
-            full = cert->issuer;
-            hash = cert->issuerHash;
-        }
-        else {
-            full = cert->subject;
-            hash = cert->subjectHash;
-        }
+        /* Get hash to fill in based on name type. */
+        hash = (nameType == ISSUER) ? cert->issuerHash : cert->subjectHash;
 
         /* Parse certificate name. */
-        ret = GetCertName(cert, full, hash, nameType, cert->source,
+        ret = GetCertName(cert, hash, nameType, cert->source,
                           &cert->srcIdx, idx);
     }
 
@@ -10739,6 +10917,14 @@ void FreeSignatureCtx(SignatureCtx* sigCtx)
         XFREE(sigCtx->sigCpy, sigCtx->heap, DYNAMIC_TYPE_SIGNATURE);
         sigCtx->sigCpy = NULL;
     }
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+    if (sigCtx->keyShared) {
+        /* owned by the signer */
+        sigCtx->key.ptr = NULL;
+        sigCtx->keyShared = 0;
+    }
+    sigCtx->signer = NULL;
+#endif
 #ifndef NO_ASN_CRYPT
     if (sigCtx->key.ptr) {
         switch (sigCtx->keyOID) {
@@ -10881,6 +11067,214 @@ static int HashForSignature(const byte* buf, word32 bufSz, word32 sigOID,
 }
 #endif /* !NO_ASN_CRYPT */
 
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+/* Free a decoded public key.
+ *
+ * @param [in] key     RsaKey or ecc_key object.
+ * @param [in] keyOID  Type of key.
+ * @param [in] heap    Dynamic memory hint.
+ */
+static void FreeDecodedPubKey(void* key, word32 keyOID, void* heap)
+{
+    switch (keyOID) {
+    #ifndef NO_RSA
+        case RSAk:
+            wc_FreeRsaKey((RsaKey*)key);
+            XFREE(key, heap, DYNAMIC_TYPE_RSA);
+            break;
+    #endif
+    #ifdef HAVE_ECC
+        case ECDSAk:
+            wc_ecc_free((ecc_key*)key);
+            XFREE(key, heap, DYNAMIC_TYPE_ECC);
+            break;
+    #endif
+        default:
+            break;
+    }
+    (void)key;
+    (void)heap;
+}
+
+/* Free the decoded public key held by a signer.
+ *
+ * @param [in, out] signer  Signer object.
+ * @param [in]      heap    Dynamic memory hint.
+ */
+void FreeSignerPubKey(Signer* signer, void* heap)
+{
+    if (signer->pubKeyDecoded != NULL) {
+        FreeDecodedPubKey(signer->pubKeyDecoded, signer->keyOID, heap);
+        signer->pubKeyDecoded = NULL;
+    }
+#ifdef WOLFSSL_SIGNER_VERIFY_TABLE
+    if (signer->pubKeyTable != NULL) {
+        FreeDecodedPubKey(signer->pubKeyTable, signer->keyOID, heap);
+        signer->pubKeyTable = NULL;
+    }
+    signer->verifyCount = 0;
+#endif
+}
+
+/* Decode the signer's public key into a new key object.
+ *
+ * @param [in] signer  Signer object.
+ * @param [in] heap    Dynamic memory hint.
+ * @return  Decoded key on success.
+ * @return  NULL when the key can't be decoded or the type isn't cached.
+ */
+static void* DecodeSignerPubKey(Signer* signer, void* heap)
+{
+    void*  key;
+    word32 idx = 0;
+    int    ret;
+
+    switch (signer->keyOID) {
+    #ifndef NO_RSA
+        case RSAk:
+            key = XMALLOC(sizeof(RsaKey), heap, DYNAMIC_TYPE_RSA);
+            if (key == NULL)
+                return NULL;
+            ret = wc_InitRsaKey_ex((RsaKey*)key, heap, INVALID_DEVID);
+            if (ret != 0) {
+                XFREE(key, heap, DYNAMIC_TYPE_RSA);
+                return NULL;
+            }
+            ret = wc_RsaPublicKeyDecode(signer->publicKey, &idx, (RsaKey*)key,
+                                        signer->pubKeySize);
+            break;
+    #endif
+    #ifdef HAVE_ECC
+        case ECDSAk:
+            key = XMALLOC(sizeof(ecc_key), heap, DYNAMIC_TYPE_ECC);
+            if (key == NULL)
+                return NULL;
+            ret = wc_ecc_init_ex((ecc_key*)key, heap, INVALID_DEVID);
+            if (ret != 0) {
+                XFREE(key, heap, DYNAMIC_TYPE_ECC);
+                return NULL;
+            }
+            ret = wc_EccPublicKeyDecode(signer->publicKey, &idx, (ecc_key*)key,
+                                        signer->pubKeySize);
+            break;
+    #endif
+        default:
+            return NULL;
+    }
+
+    if (ret != 0) {
+        FreeDecodedPubKey(key, signer->keyOID, heap);
+        return NULL;
+    }
+
+    return key;
+}
+
+#ifdef WOLFSSL_SIGNER_VERIFY_TABLE
+/* Get the signer's ECC key with a verify comb table.
+ *
+ * Building the table costs about as much as five verifies, so it is only done
+ * by the verify that brings the signer's count to
+ * WOLFSSL_SIGNER_VERIFY_TABLE_MIN. CA keys used once or twice stay on the
+ * plain path.
+ *
+ * @param [in, out] signer  Signer object.
+ * @param [in]      heap    Dynamic memory hint.
+ * @return  Key with a table when there is one.
+ * @return  NULL when the plain decoded key is to be used.
+ */
+static void* GetSignerPubKeyTable(Signer* signer, void* heap)
+{
+    void* key;
+
+    key = WOLFSSL_ATOMIC_LOAD_PTR(signer->pubKeyTable);
+    if (key != NULL || signer->keyOID != ECDSAk)
+        return key;
+    /* only one verify sees the count reach the threshold */
+    if (WOLFSSL_ATOMIC_INC(signer->verifyCount) !=
+                                            WOLFSSL_SIGNER_VERIFY_TABLE_MIN) {
+        return NULL;
+    }
+
+    key = DecodeSignerPubKey(signer, heap);
+    if (key == NULL)
+        return NULL;
+    if (wc_ecc_make_verify_table((ecc_key*)key) != 0 ||
+            !WOLFSSL_ATOMIC_CAS_PTR(signer->pubKeyTable, key)) {
+        FreeDecodedPubKey(key, signer->keyOID, heap);
+        return NULL;
+    }
+
+    return key;
+}
+#endif /* WOLFSSL_SIGNER_VERIFY_TABLE */
+
+/* Get the signer's decoded public key, decoding it on first use.
+ *
+ * The key is published without a lock. Threads that race to decode it keep
+ * the first key published and free their own.
+ *
+ * @param [in, out] signer  Signer object.
+ * @param [in]      heap    Dynamic memory hint.
+ * @return  Decoded key on success.
+ * @return  NULL when the key can't be decoded or the type isn't cached. The
+ *          caller decodes its own key, reporting any error.
+ */
+static void* GetSignerPubKey(Signer* signer, void* heap)
+{
+    void* key;
+
+#ifdef WOLFSSL_SIGNER_VERIFY_TABLE
+    key = GetSignerPubKeyTable(signer, heap);
+    if (key != NULL)
+        return key;
+#endif
+
+    key = WOLFSSL_ATOMIC_LOAD_PTR(signer->pubKeyDecoded);
+    if (key != NULL)
+        return key;
+
+    key = DecodeSignerPubKey(signer, heap);
+    if (key == NULL)
+        return NULL;
+    if (!WOLFSSL_ATOMIC_CAS_PTR(signer->pubKeyDecoded, key)) {
+        /* another thread published first */
+        FreeDecodedPubKey(key, signer->keyOID, heap);
+        key = WOLFSSL_ATOMIC_LOAD_PTR(signer->pubKeyDecoded);
+    }
+
+    return key;
+}
+
+#ifdef HAVE_ECC
+/* Verify an ECDSA signature with a key shared between threads.
+ *
+ * wc_ecc_verify_hash() keeps its state in the key, so decode the signature
+ * here and use the stateless verify.
+ */
+static int VerifyEccShared(const byte* sig, word32 sigSz, const byte* hash,
+                           word32 hashSz, int* res, ecc_key* key)
+{
+    int    ret;
+    mp_int r[1];
+    mp_int s[1];
+
+    XMEMSET(r, 0, sizeof(r));
+    XMEMSET(s, 0, sizeof(s));
+
+    *res = 0;
+    ret = DecodeECC_DSA_Sig(sig, sigSz, r, s);
+    if (ret == 0) {
+        ret = wc_ecc_verify_hash_ex(r, s, hash, hashSz, res, key);
+        mp_clear(r);
+        mp_clear(s);
+    }
+
+    return ret;
+}
+#endif /* HAVE_ECC */
+#endif /* WOLFSSL_SIGNER_KEY_CACHE */
+
 /* Return codes: 0=Success, Negative (see error-crypt.h), ASN_SIG_CONFIRM_E */
 static int ConfirmSignature(SignatureCtx* sigCtx,
     const byte* buf, word32 bufSz,
@@ -10944,16 +11338,41 @@ static int ConfirmSignature(SignatureCtx* sigCtx,
 
         case SIG_STATE_KEY:
         {
+        #ifdef WOLFSSL_SIGNER_KEY_CACHE
+            /* use the signer's decoded key when verifying with it */
+            if (sigCtx->signer != NULL && sigCtx->devId == INVALID_DEVID &&
+                    sigCtx->signer->publicKey == key &&
+                    sigCtx->signer->keyOID == keyOID) {
+                sigCtx->key.ptr = GetSignerPubKey(sigCtx->signer,
+                                                  sigCtx->heap);
+                sigCtx->keyShared = (sigCtx->key.ptr != NULL);
+            }
+        #endif
+
             switch (keyOID) {
                 case RSAk:
                 {
                     word32 idx = 0;
 
-                    sigCtx->key.rsa = (RsaKey*)XMALLOC(sizeof(RsaKey),
-                                                sigCtx->heap, DYNAMIC_TYPE_RSA);
                     sigCtx->sigCpy = (byte*)XMALLOC(MAX_ENCODED_SIG_SZ,
                                          sigCtx->heap, DYNAMIC_TYPE_SIGNATURE);
-                    if (sigCtx->key.rsa == NULL || sigCtx->sigCpy == NULL) {
+                    if (sigCtx->sigCpy == NULL) {
+                        ERROR_OUT(MEMORY_E, exit_cs);
+                    }
+                #ifdef WOLFSSL_SIGNER_KEY_CACHE
+                    if (sigCtx->keyShared) {
+                        if (sigSz > MAX_ENCODED_SIG_SZ) {
+                            WOLFSSL_MSG("Verify Signature is too big");
+                            ERROR_OUT(BUFFER_E, exit_cs);
+                        }
+                        XMEMCPY(sigCtx->sigCpy, sig, sigSz);
+                        sigCtx->out = NULL;
+                        break;
+                    }
+                #endif
+                    sigCtx->key.rsa = (RsaKey*)XMALLOC(sizeof(RsaKey),
+                                                sigCtx->heap, DYNAMIC_TYPE_RSA);
+                    if (sigCtx->key.rsa == NULL) {
                         ERROR_OUT(MEMORY_E, exit_cs);
                     }
                     if ((ret = wc_InitRsaKey_ex(sigCtx->key.rsa, sigCtx->heap,
@@ -10979,6 +11398,10 @@ static int ConfirmSignature(SignatureCtx* sigCtx,
                     word32 idx = 0;
 
                     sigCtx->verify = 0;
+                #ifdef WOLFSSL_SIGNER_KEY_CACHE
+                    if (sigCtx->keyShared)
+                        break;
+                #endif
                     sigCtx->key.ecc = (ecc_key*)XMALLOC(sizeof(ecc_key),
                                                 sigCtx->heap, DYNAMIC_TYPE_ECC);
                     if (sigCtx->key.ecc == NULL) {
@@ -11016,6 +11439,13 @@ static int ConfirmSignature(SignatureCtx* sigCtx,
             switch (keyOID) {
                 case RSAk:
                 {
+                #ifdef WOLFSSL_SIGNER_KEY_CACHE
+                    if (sigCtx->keyShared) {
+                        ret = wc_RsaSSL_VerifyInlineShared(sigCtx->sigCpy,
+                                sigSz, &sigCtx->out, sigCtx->key.rsa);
+                    }
+                    else
+                #endif
                     {
                         ret = wc_RsaSSL_VerifyInline(sigCtx->sigCpy, sigSz,
                                                  &sigCtx->out, sigCtx->key.rsa);
@@ -11024,6 +11454,14 @@ static int ConfirmSignature(SignatureCtx* sigCtx,
                 }
                 case ECDSAk:
                 {
+                #ifdef WOLFSSL_SIGNER_KEY_CACHE
+                    if (sigCtx->keyShared) {
+                        ret = VerifyEccShared(sig, sigSz, sigCtx->digest,
+                                            sigCtx->digestSz, &sigCtx->verify,
+                                            sigCtx->key.ecc);
+                    }
+                    else
+                #endif
                     {
                         ret = wc_ecc_verify_hash(sig, sigSz, sigCtx->digest,
                                             sigCtx->digestSz, &sigCtx->verify,
@@ -13496,6 +13934,47 @@ exit:
 #define VERIFY_AND_SET_OID(bit) bit = 1;
 #endif
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+/* OID sums of the extensions in CertLazyExt order. */
+static const word32 lazyExtOid[CERT_LAZY_EXT_COUNT] = {
+    ALT_NAMES_OID, CRL_DIST_OID, AUTH_INFO_OID, EXT_KEY_USAGE_OID,
+    CERT_POLICY_OID
+};
+
+/* Record an extension to be decoded when first used.
+ *
+ * @return  1 when the extension was deferred.
+ * @return  0 when the extension must be decoded now.
+ * @return  ASN_OBJECT_ID_E when the extension was already seen.
+ */
+static int DeferExtension(DecodedCert* cert, const byte* input, int length,
+                          word32 oid, byte critical)
+{
+    int i;
+
+    for (i = 0; i < CERT_LAZY_EXT_COUNT; i++) {
+        if (lazyExtOid[i] == oid)
+            break;
+    }
+    if (i == CERT_LAZY_EXT_COUNT || input < cert->source ||
+            input + length > cert->source + cert->maxIdx) {
+        return 0;
+    }
+#ifndef WOLFSSL_NO_ASN_STRICT
+    if (cert->lazyExtPending & (1 << i))
+        return ASN_OBJECT_ID_E;
+#endif
+
+    cert->lazyExtIdx[i] = (word32)(input - cert->source);
+    cert->lazyExtSz[i] = (word32)length;
+    cert->lazyExtPending |= (byte)(1 << i);
+    if (critical)
+        cert->lazyExtCritical |= (byte)(1 << i);
+
+    return 1;
+}
+#endif /* WOLFSSL_LAZY_CERT_DECODE */
+
 /* Parse extension type specific data based on OID sum.
  *
  * Supported extensions:
@@ -13540,6 +14019,14 @@ static int DecodeExtensionType(const byte* input, int length, word32 oid,
     if (isUnknownExt != NULL)
         *isUnknownExt = 0;
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    if (cert->decodeLazy) {
+        ret = DeferExtension(cert, input, length, oid, critical);
+        if (ret != 0)
+            return (ret < 0) ? ret : 0;
+    }
+#endif
+
     switch (oid) {
         /* Basic Constraints. */
         case BASIC_CA_OID:
@@ -13746,6 +14233,47 @@ int wc_SetUnknownExtCallback(DecodedCert* cert,
 }
 #endif
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+/* Decode what a lazy parse left for later. The lazy parse is over after this
+ * is first called.
+ *
+ * @param [in, out] cert  Decoded certificate object.
+ * @param [in]      oid   OID sum of the extension to decode, or 0 for all
+ *                        extensions and the issuer name.
+ * @return  0 on success, including when there is nothing to decode.
+ * @return  BAD_FUNC_ARG when cert is NULL.
+ * @return  Extension or name decoding errors.
+ */
+int DecodeCertDeferred(DecodedCert* cert, word32 oid)
+{
+    int    ret = 0;
+    int    i;
+    word32 idx;
+
+    if (cert == NULL)
+        return BAD_FUNC_ARG;
+
+    cert->decodeLazy = 0;
+    for (i = 0; (ret == 0) && (i < CERT_LAZY_EXT_COUNT); i++) {
+        if ((cert->lazyExtPending & (1 << i)) &&
+                (oid == 0 || oid == lazyExtOid[i])) {
+            cert->lazyExtPending &= (byte)~(1 << i);
+            ret = DecodeExtensionType(cert->source + cert->lazyExtIdx[i],
+                    (int)cert->lazyExtSz[i], lazyExtOid[i],
+                    (byte)((cert->lazyExtCritical >> i) & 1), cert, NULL);
+        }
+    }
+    if ((ret == 0) && (oid == 0) && cert->lazyIssuer) {
+        cert->lazyIssuer = 0;
+        idx = cert->lazyIssuerIdx;
+        ret = GetCertName(cert, cert->issuerHash, ISSUER,
+                          cert->source, &idx, cert->lazyIssuerEnd);
+    }
+
+    return ret;
+}
+#endif /* WOLFSSL_LAZY_CERT_DECODE */
+
 /*
  *  Processing the Certificate Extensions. This does not modify the current
  *  index. It is works starting with the recorded extensions pointer.
@@ -14181,14 +14709,14 @@ static int DecodeCertInternal(DecodedCert* cert, int verify, int* criticalExt,
 
         /* Get the issuer name and calculate hash. */
         idx = dataASN[X509CERTASN_IDX_TBS_ISSUER_SEQ].offset;
-        ret = GetCertName(cert, cert->issuer, cert->issuerHash, ISSUER,
+        ret = GetCertName(cert, cert->issuerHash, ISSUER,
                           cert->source, &idx,
                           dataASN[X509CERTASN_IDX_TBS_VALIDITY_SEQ].offset);
     }
     if (ret == 0) {
         /* Get the subject name and calculate hash. */
         idx = dataASN[X509CERTASN_IDX_TBS_SUBJECT_SEQ].offset;
-        ret = GetCertName(cert, cert->subject, cert->subjectHash, SUBJECT,
+        ret = GetCertName(cert, cert->subjectHash, SUBJECT,
                           cert->source, &idx,
                           dataASN[X509CERTASN_IDX_TBS_SPUBKEYINFO_SEQ].offset);
     }
@@ -14626,7 +15154,7 @@ static int DecodeCertReq(DecodedCert* cert, int* criticalExt)
 
         /* Parse the subject name. */
         idx = dataASN[CERTREQASN_IDX_INFO_SUBJ_SEQ].offset;
-        ret = GetCertName(cert, cert->subject, cert->subjectHash, SUBJECT,
+        ret = GetCertName(cert, cert->subjectHash, SUBJECT,
                           cert->source, &idx,
                           dataASN[CERTREQASN_IDX_INFO_SPUBKEYINFO_SEQ].offset);
     }
@@ -14712,6 +15240,12 @@ int wc_ParseCert(DecodedCert* cert, int type, int verify, void* cm)
     #ifndef NO_SKID
         Signer* GetCAByName(void* signers, byte* hash);
     #endif
+    #ifdef WOLFSSL_CERT_VERIFY_CACHE
+        int  CheckCertVerifyCache(void* cm, const byte* certId,
+                                  const byte* issuerId);
+        void AddCertVerifyCache(void* cm, const byte* certId,
+                                const byte* issuerId);
+    #endif
 #ifdef __cplusplus
     }
 #endif
@@ -14737,12 +15271,86 @@ Signer* GetCAByName(void* signers, byte* hash)
 }
 #endif /* NO_SKID */
 
-#endif /* WOLFCRYPT_ONLY */
-
-#if defined(WOLFSSL_NO_TRUSTED_CERTS_VERIFY) && !defined(NO_SKID)
-static Signer* GetCABySubjectAndPubKey(DecodedCert* cert, void* cm)
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+int CheckCertVerifyCache(void* cm, const byte* certId, const byte* issuerId)
 {
-    Signer* ca = NULL;
+    (void)cm;
+    (void)certId;
+    (void)issuerId;
+
+    return 0;
+}
+
+void AddCertVerifyCache(void* cm, const byte* certId, const byte* issuerId)
+{
+    (void)cm;
+    (void)certId;
+    (void)issuerId;
+}
+#endif /* WOLFSSL_CERT_VERIFY_CACHE */
+
+#endif /* WOLFCRYPT_ONLY */
+
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+/* Calculate ids used to look up a verified certificate signature.
+ *
+ * certId is the hash of the signed data, signature algorithm and signature.
+ * issuerId is the hash of the public key that verifies the signature.
+ *
+ * @param [in]  cert      Certificate with CA set.
+ * @param [out] certId    Buffer to hold certificate id.
+ * @param [out] issuerId  Buffer to hold issuer key id.
+ * @return  0 on success.
+ * @return  Other value on hash failure.
+ */
+static int CertVerifyCacheIds(DecodedCert* cert, byte* certId, byte* issuerId)
+{
+    int ret;
+    byte oid[4];
+#ifdef WOLFSSL_SMALL_STACK
+    wc_Sha256* sha256;
+#else
+    wc_Sha256 sha256[1];
+#endif
+
+#ifdef WOLFSSL_SMALL_STACK
+    sha256 = (wc_Sha256*)XMALLOC(sizeof(wc_Sha256), cert->heap,
+                                 DYNAMIC_TYPE_TMP_BUFFER);
+    if (sha256 == NULL)
+        return MEMORY_E;
+#endif
+
+    c32toa(cert->signatureOID, oid);
+
+    ret = wc_InitSha256_ex(sha256, cert->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_Sha256Update(sha256, cert->source + cert->certBegin,
+                              cert->sigIndex - cert->certBegin);
+        if (ret == 0)
+            ret = wc_Sha256Update(sha256, oid, sizeof(oid));
+        if (ret == 0)
+            ret = wc_Sha256Update(sha256, cert->signature, cert->sigLength);
+        if (ret == 0)
+            ret = wc_Sha256Final(sha256, certId);
+        wc_Sha256Free(sha256);
+    }
+    if (ret == 0) {
+        ret = wc_Sha256Hash(cert->ca->publicKey, cert->ca->pubKeySize,
+                            issuerId);
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(sha256, cert->heap, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+#endif /* WOLFSSL_CERT_VERIFY_CACHE */
+
+#if defined(WOLFSSL_NO_TRUSTED_CERTS_VERIFY) && !defined(NO_SKID)
+static Signer* GetCABySubjectAndPubKey(DecodedCert* cert, void* cm)
+{
+    Signer* ca = NULL;
     if (cert->extSubjKeyIdSet)
         ca = GetCA(cm, cert->extSubjKeyId);
     if (ca == NULL)
@@ -15126,6 +15734,9 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
                                cert + idx, len, signatureOID, NULL);
         }
         else {
+        #ifdef WOLFSSL_SIGNER_KEY_CACHE
+            sigCtx->signer = ca;
+        #endif
             ret = ConfirmSignature(sigCtx, cert + tbsCertIdx,
                                sigIndex - tbsCertIdx,
                                ca->publicKey, ca->pubKeySize, ca->keyOID,
@@ -15268,6 +15879,9 @@ static int CheckCertSignature_ex(const byte* cert, word32 certSz, void* heap,
     }
 
     if (ret == 0) {
+    #ifdef WOLFSSL_SIGNER_KEY_CACHE
+        sigCtx->signer = ca;
+    #endif
         /* Check signature. */
         ret = ConfirmSignature(sigCtx, tbs, tbsSz, pubKey, pubKeySz, pubKeyOID,
                 sig, sigSz, sigOID, NULL);
@@ -15512,6 +16126,14 @@ int ParseCertRelative(DecodedCert* cert, int type, int verify, void* cm)
                 return ret;
         }
     #endif /* !NO_SKID */
+    #ifdef HAVE_OCSP
+        if (cert->publicKey != NULL && cert->pubKeySize > 0) {
+            ret = CalcKeyHashId(cert->publicKey, cert->pubKeySize,
+                                cert->keyOID, cert->subjectKeyHash);
+            if (ret != 0)
+                return ret;
+        }
+    #endif /* HAVE_OCSP */
 
         if (!cert->selfSigned || (verify != NO_VERIFY && type != CA_TYPE &&
                                                    type != TRUSTED_PEER_TYPE)) {
@@ -15530,11 +16152,17 @@ int ParseCertRelative(DecodedCert* cert, int type, int verify, void* cm)
             }
             if (cert->ca == NULL) {
                 cert->ca = GetCAByName(cm, cert->issuerHash);
-                /* If AKID is available then this CA doesn't have the public
-                 * key required */
+                /* If AKID is available then this CA must also be found by
+                 * it. The name lookup may have just loaded the CA. */
                 if (cert->ca && cert->extAuthKeyIdSet) {
-                    WOLFSSL_MSG("CA SKID doesn't match AKID");
-                    cert->ca = NULL;
+                    cert->ca = GetCA(cm, cert->extAuthKeyId);
+                    if (cert->ca != NULL && XMEMCMP(cert->issuerHash,
+                                  cert->ca->subjectNameHash, KEYID_SIZE) != 0) {
+                        cert->ca = NULL;
+                    }
+                    if (cert->ca == NULL) {
+                        WOLFSSL_MSG("CA SKID doesn't match AKID");
+                    }
                 }
             }
 
@@ -15554,6 +16182,10 @@ int ParseCertRelative(DecodedCert* cert, int type, int verify, void* cm)
 
             if (cert->ca) {
                 WOLFSSL_MSG("CA found");
+            #ifdef HAVE_OCSP
+                XMEMCPY(cert->issuerKeyHash, cert->ca->subjectKeyHash,
+                        KEYID_SIZE);
+            #endif
             }
         }
 
@@ -15698,23 +16330,53 @@ int ParseCertRelative(DecodedCert* cert, int type, int verify, void* cm)
         if (cert->ca) {
             if (verify == VERIFY || verify == VERIFY_OCSP ||
                                                  verify == VERIFY_SKIP_DATE) {
-                /* try to confirm/verify signature */
-                if ((ret = ConfirmSignature(&cert->sigCtx,
-                        cert->source + cert->certBegin,
-                        cert->sigIndex - cert->certBegin,
-                        cert->ca->publicKey, cert->ca->pubKeySize,
-                        cert->ca->keyOID, cert->signature,
-                        cert->sigLength, cert->signatureOID,
-                        sce_tsip_encRsaKeyIdx)) != 0) {
-                    if (ret != WC_PENDING_E) {
-                        WOLFSSL_MSG("Confirm signature failed");
+            #ifdef WOLFSSL_CERT_VERIFY_CACHE
+                byte certId[WC_SHA256_DIGEST_SIZE];
+                byte issuerId[WC_SHA256_DIGEST_SIZE];
+                int  haveIds;
+
+                /* signature already verified with this CA key? */
+                haveIds = (CertVerifyCacheIds(cert, certId, issuerId) == 0);
+                if (haveIds && CheckCertVerifyCache(cm, certId, issuerId)) {
+                    WOLFSSL_MSG("Signature found in verified cert cache");
+                }
+                else
+            #endif
+                {
+                #ifdef WOLFSSL_SIGNER_KEY_CACHE
+                    cert->sigCtx.signer = cert->ca;
+                #endif
+                    /* try to confirm/verify signature */
+                    if ((ret = ConfirmSignature(&cert->sigCtx,
+                            cert->source + cert->certBegin,
+                            cert->sigIndex - cert->certBegin,
+                            cert->ca->publicKey, cert->ca->pubKeySize,
+                            cert->ca->keyOID, cert->signature,
+                            cert->sigLength, cert->signatureOID,
+                            sce_tsip_encRsaKeyIdx)) != 0) {
+                        if (ret != WC_PENDING_E) {
+                            WOLFSSL_MSG("Confirm signature failed");
+                        }
+                        return ret;
                     }
-                    return ret;
+                #ifdef WOLFSSL_CERT_VERIFY_CACHE
+                    if (haveIds) {
+                        AddCertVerifyCache(cm, certId, issuerId);
+                    }
+                #endif
                 }
             }
         #ifndef IGNORE_NAME_CONSTRAINTS
             if (verify == VERIFY || verify == VERIFY_OCSP ||
                         verify == VERIFY_NAME || verify == VERIFY_SKIP_DATE) {
+            #ifdef WOLFSSL_LAZY_CERT_DECODE
+                if (cert->ca->permittedNames != NULL ||
+                                        cert->ca->excludedNames != NULL) {
+                    ret = DecodeCertDeferred(cert, ALT_NAMES_OID);
+                    if (ret != 0)
+                        return ret;
+                }
+            #endif
                 /* check that this cert's name is permitted by the signer's
                  * name constraints */
                 if (!ConfirmNameConstraints(cert->ca, cert)) {
@@ -15772,6 +16434,9 @@ Signer* MakeSigner(void* heap)
  */
 void FreeSigner(Signer* signer, void* heap)
 {
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+    FreeSignerPubKey(signer, heap);
+#endif
     XFREE(signer->name, heap, DYNAMIC_TYPE_SUBJECT_CN);
     XFREE((void*)signer->publicKey, heap, DYNAMIC_TYPE_PUBLIC_KEY);
 #ifndef IGNORE_NAME_CONSTRAINTS
@@ -17926,7 +18591,137 @@ static int SetAsymKeyDerPublic(const byte* pubKey, word32 pubKeyLen,
 }
 #endif /* WC_ENABLE_ASYM_KEY_EXPORT */
 
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_EXPORT)
+/* Encode the public part of an Ed25519 key in DER.
+ *
+ * Pass NULL for output to get the size of the encoding.
+ *
+ * @param [in]  key       Ed25519 key object.
+ * @param [out] output    Buffer to put encoded data in.
+ * @param [in]  inLen     Size of buffer in bytes.
+ * @param [in]  withAlg   Whether to use SubjectPublicKeyInfo format.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed25519PublicKeyToDer(ed25519_key* key, byte* output, word32 inLen,
+                             int withAlg)
+{
+    int    ret;
+    byte   pubKey[ED25519_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wc_ed25519_export_public(key, pubKey, &pubKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDerPublic(pubKey, pubKeyLen, output, inLen,
+            ED25519k, withAlg);
+    }
+    return ret;
+}
+#endif /* HAVE_ED25519 && HAVE_ED25519_KEY_EXPORT */
+
+#if defined(HAVE_CURVE25519) && defined(HAVE_CURVE25519_KEY_EXPORT)
+/* Encode the public part of a Curve25519 key in DER.
+ *
+ * Pass NULL for output to get the size of the encoding.
+ *
+ * @param [in]  key       Curve25519 key object.
+ * @param [out] output    Buffer to put encoded data in.
+ * @param [in]  inLen     Size of buffer in bytes.
+ * @param [in]  withAlg   Whether to use SubjectPublicKeyInfo format.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Curve25519PublicKeyToDer(curve25519_key* key, byte* output, word32 inLen,
+                                int withAlg)
+{
+    int    ret;
+    byte   pubKey[CURVE25519_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wc_curve25519_export_public(key, pubKey, &pubKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDerPublic(pubKey, pubKeyLen, output, inLen,
+            X25519k, withAlg);
+    }
+    return ret;
+}
+#endif /* HAVE_CURVE25519 && HAVE_CURVE25519_KEY_EXPORT */
+
+#if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_EXPORT)
+/* Encode the public part of an Ed448 key in DER.
+ *
+ * Pass NULL for output to get the size of the encoding.
+ *
+ * @param [in]  key       Ed448 key object.
+ * @param [out] output    Buffer to put encoded data in.
+ * @param [in]  inLen     Size of buffer in bytes.
+ * @param [in]  withAlg   Whether to use SubjectPublicKeyInfo format.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed448PublicKeyToDer(ed448_key* key, byte* output, word32 inLen,
+                           int withAlg)
+{
+    int    ret;
+    byte   pubKey[ED448_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wc_ed448_export_public(key, pubKey, &pubKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDerPublic(pubKey, pubKeyLen, output, inLen,
+            ED448k, withAlg);
+    }
+    return ret;
+}
+#endif /* HAVE_ED448 && HAVE_ED448_KEY_EXPORT */
+
+#if defined(HAVE_CURVE448) && defined(HAVE_CURVE448_KEY_EXPORT)
+/* Encode the public part of a Curve448 key in DER.
+ *
+ * Pass NULL for output to get the size of the encoding.
+ *
+ * @param [in]  key       Curve448 key object.
+ * @param [out] output    Buffer to put encoded data in.
+ * @param [in]  inLen     Size of buffer in bytes.
+ * @param [in]  withAlg   Whether to use SubjectPublicKeyInfo format.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Curve448PublicKeyToDer(curve448_key* key, byte* output, word32 inLen,
+                              int withAlg)
+{
+    int    ret;
+    byte   pubKey[CURVE448_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
 
+    ret = wc_curve448_export_public(key, pubKey, &pubKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDerPublic(pubKey, pubKeyLen, output, inLen,
+            X448k, withAlg);
+    }
+    return ret;
+}
+#endif /* HAVE_CURVE448 && HAVE_CURVE448_KEY_EXPORT */
 
 
 #ifdef WOLFSSL_CERT_GEN
@@ -23929,229 +24724,1940 @@ enum {
 
 #endif /* WC_ENABLE_ASYM_KEY_IMPORT */
 
-
-
-
-#ifdef WC_ENABLE_ASYM_KEY_EXPORT
-
-/* Build ASN.1 formatted key based on RFC 5958 (Asymmetric Key Packages)
- *
- * Pass NULL for output to get the size of the encoding.
- *
- * @param [in]  privKey      private key buffer
- * @param [in]  privKeyLen   private ket buffer length
- * @param [in]  pubKey       public key buffer (optional)
- * @param [in]  pubKeyLen    public ket buffer length
- * @param [out] output       Buffer to put encoded data in (optional)
- * @param [in]  outLen       Size of buffer in bytes
- * @param [in]  keyType      is "enum Key_Sum" like ED25519k
- * @return  Size of encoded data in bytes on success
- * @return  BAD_FUNC_ARG when key is NULL.
+#ifdef WC_ENABLE_ASYM_KEY_IMPORT
+/* Decode an RFC 5958 (Asymmetric Key Packages) private key.
+ *
+ * Also accepts the private value alone as an OCTET_STRING.
+ *
+ * @param [in]      input       BER encoded private key.
+ * @param [in, out] inOutIdx    On in, index to start decoding from.
+ *                              On out, index after the private key.
+ * @param [in]      inSz        Number of bytes in input.
+ * @param [out]     privKey     Buffer to hold private value.
+ * @param [in, out] privKeyLen  On in, size of privKey in bytes.
+ *                              On out, length of private value.
+ * @param [out]     pubKey      Buffer to hold public value (optional).
+ * @param [in, out] pubKeyLen   On in, size of pubKey in bytes.
+ *                              On out, length of public value or 0 when
+ *                              not present.
+ * @param [in]      keyType     "enum Key_Sum" value like ED25519k.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid or a value is too
+ *          big for its buffer.
  * @return  MEMORY_E when dynamic memory allocation failed.
- * @return  LENGTH_ONLY_E return length only.
  */
-static int SetAsymKeyDer(const byte* privKey, word32 privKeyLen,
-    const byte* pubKey, word32 pubKeyLen,
-    byte* output, word32 outLen, int keyType)
+static int DecodeAsymKey(const byte* input, word32* inOutIdx, word32 inSz,
+    byte* privKey, word32* privKeyLen, byte* pubKey, word32* pubKeyLen,
+    int keyType)
 {
-    int ret = 0;
 #ifndef WOLFSSL_ASN_TEMPLATE
-    word32 idx = 0, seqSz, verSz, algoSz, privSz, pubSz = 0, sz;
-#else
-    DECL_ASNSETDATA(dataASN, edKeyASN_Length);
-    int sz;
-#endif
+    word32 oid;
+    int    version, length, endKeyIdx, privSz, pubSz;
+    const byte* priv;
+    const byte* pub;
 
-    /* Validate parameters. */
-    if (privKey == NULL || outLen == 0) {
+    if (input == NULL || inOutIdx == NULL || inSz == 0 ||
+        privKey == NULL || privKeyLen == NULL) {
         return BAD_FUNC_ARG;
     }
 
-#ifndef WOLFSSL_ASN_TEMPLATE
-    /* calculate size */
-    if (pubKey) {
-        pubSz = 2 + 2 + pubKeyLen;
-    }
-    privSz = 2 + 2 + privKeyLen;
-    algoSz = SetAlgoID(keyType, NULL, oidKeyType, 0);
-    verSz  = 3; /* version is 3 bytes (enum + id + version(byte)) */
-    seqSz  = SetSequence(verSz + algoSz + privSz + pubSz, NULL);
-    sz = seqSz + verSz + algoSz + privSz + pubSz;
-
-    /* checkout output size */
-    if (output != NULL && sz > outLen) {
-        ret = BAD_FUNC_ARG;
-    }
+    if (GetSequence(input, inOutIdx, &length, inSz) >= 0) {
+        endKeyIdx = (int)*inOutIdx + length;
 
-    if (ret == 0 && output != NULL) {
-        /* write out */
-        /* seq */
-        seqSz  = SetSequence(verSz + algoSz + privSz + pubSz, output);
-        idx = seqSz;
-        /* ver */
-        SetMyVersion(0, output + idx, FALSE);
-        idx += verSz;
-        /* algo */
-        algoSz = SetAlgoID(keyType, output + idx, oidKeyType, 0);
-        idx += algoSz;
-        /* privKey */
-        idx += SetOctetString(2 + privKeyLen, output + idx);
-        idx += SetOctetString(privKeyLen, output + idx);
-        XMEMCPY(output + idx, privKey, privKeyLen);
-        idx += privKeyLen;
-        /* pubKey */
-        if (pubKey) {
-            idx += SetExplicit(1, 2 + pubKeyLen, output + idx);
-            idx += SetOctetString(pubKeyLen, output + idx);
-            XMEMCPY(output + idx, pubKey, pubKeyLen);
-            idx += pubKeyLen;
+        if (GetMyVersion(input, inOutIdx, &version, inSz) < 0)
+            return ASN_PARSE_E;
+        if (version != 0) {
+            WOLFSSL_MSG("Unrecognized version of private key");
+            return ASN_PARSE_E;
         }
 
-        ret = idx;
+        if (GetAlgoId(input, inOutIdx, &oid, oidKeyType, inSz) < 0)
+            return ASN_PARSE_E;
+        if (oid != (word32)keyType)
+            return ASN_PARSE_E;
+
+        if (GetOctetString(input, inOutIdx, &length, inSz) < 0)
+            return ASN_PARSE_E;
+    }
+    else {
+        /* Private value only. */
+        endKeyIdx = -1;
     }
-#else
 
-    CALLOC_ASNSETDATA(dataASN, edKeyASN_Length, ret, NULL);
+    if (GetOctetString(input, inOutIdx, &privSz, inSz) < 0)
+        return ASN_PARSE_E;
+    if ((word32)privSz > *privKeyLen)
+        return ASN_PARSE_E;
+    priv = input + *inOutIdx;
+    *inOutIdx += privSz;
 
-    if (ret == 0) {
-        /* Set version = 0 */
-        SetASN_Int8Bit(&dataASN[EDKEYASN_IDX_VER], 0);
-        /* Set OID. */
-        SetASN_OID(&dataASN[EDKEYASN_IDX_PKEYALGO_OID], keyType, oidKeyType);
-        /* Leave space for private key. */
-        SetASN_Buffer(&dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY], NULL, privKeyLen);
-        /* Don't write out attributes. */
-        dataASN[EDKEYASN_IDX_ATTRS].noOut = 1;
-        if (pubKey) {
-            /* Leave space for public key. */
-            SetASN_Buffer(&dataASN[EDKEYASN_IDX_PUBKEY_VAL], NULL, pubKeyLen);
-        }
-        else {
-            /* Don't put out public part. */
-            SetASNItem_NoOutNode(dataASN, edKeyASN, EDKEYASN_IDX_PUBKEY,
-                    edKeyASN_Length);
+    pubSz = 0;
+    if (endKeyIdx >= 0 && (int)*inOutIdx != endKeyIdx) {
+        if (GetASNHeader(input, ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED |
+                ASN_ASYMKEY_PUBKEY, inOutIdx, &length, inSz) < 0) {
+            return ASN_PARSE_E;
         }
+        if (GetOctetString(input, inOutIdx, &pubSz, inSz) < 0)
+            return ASN_PARSE_E;
+        pub = input + *inOutIdx;
+        *inOutIdx += pubSz;
 
-        /* Calculate the size of encoding. */
-        ret = SizeASN_Items(edKeyASN, dataASN, edKeyASN_Length, &sz);
+        if (pubKey != NULL && pubKeyLen != NULL) {
+            if ((word32)pubSz > *pubKeyLen)
+                return ASN_PARSE_E;
+            XMEMCPY(pubKey, pub, pubSz);
+        }
     }
+    if (endKeyIdx >= 0 && (int)*inOutIdx != endKeyIdx)
+        return ASN_PARSE_E;
 
-    /* Check buffer is big enough. */
-    if ((ret == 0) && (output != NULL) && (sz > (int)outLen)) {
+    XMEMCPY(privKey, priv, privSz);
+    *privKeyLen = privSz;
+    if (pubKeyLen != NULL)
+        *pubKeyLen = pubSz;
+
+    return 0;
+#else
+    DECL_ASNGETDATA(dataASN, edKeyASN_Length);
+    int ret = 0;
+    word32 oidSz;
+    const byte* oid;
+
+    if (input == NULL || inOutIdx == NULL || inSz == 0 ||
+        privKey == NULL || privKeyLen == NULL) {
         ret = BAD_FUNC_ARG;
     }
-    if ((ret == 0) && (output != NULL)) {
-        /* Encode private key. */
-        SetASN_Items(edKeyASN, dataASN, edKeyASN_Length, output);
 
-        /* Put private value into space provided. */
-        XMEMCPY((byte*)dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY].data.buffer.data,
-                privKey, privKeyLen);
+    CALLOC_ASNGETDATA(dataASN, edKeyASN_Length, ret, NULL);
 
-        if (pubKey != NULL) {
-            /* Put public value into space provided. */
-            XMEMCPY((byte*)dataASN[EDKEYASN_IDX_PUBKEY_VAL].data.buffer.data,
-                    pubKey, pubKeyLen);
+    if (ret == 0) {
+        /* Require the OID of the key type. */
+        oid = OidFromId((word32)keyType, oidKeyType, &oidSz);
+        GetASN_ExpBuffer(&dataASN[EDKEYASN_IDX_PKEYALGO_OID], oid, oidSz);
+        /* Copy out the private and public values. */
+        GetASN_Buffer(&dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY], privKey,
+                privKeyLen);
+        if (pubKey != NULL && pubKeyLen != NULL) {
+            GetASN_Buffer(&dataASN[EDKEYASN_IDX_PUBKEY_VAL], pubKey,
+                    pubKeyLen);
+        }
+        /* Parse full private key. */
+        ret = GetASN_Items(edKeyASN, dataASN, edKeyASN_Length, 1, input,
+                inOutIdx, inSz);
+        if (ret != 0) {
+            /* Parse just the OCTET_STRING. */
+            ret = GetASN_Items(&edKeyASN[EDKEYASN_IDX_PKEY_CURVEPKEY],
+                    &dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY], 1, 0, input,
+                    inOutIdx, inSz);
+            if (ret != 0) {
+                ret = ASN_PARSE_E;
+            }
         }
-
-        /* Return size of encoding. */
-        ret = sz;
+    }
+    if ((ret == 0) && (pubKeyLen != NULL) &&
+            (dataASN[EDKEYASN_IDX_PUBKEY_VAL].tag == 0)) {
+        /* No public value. */
+        *pubKeyLen = 0;
     }
 
-    FREE_ASNSETDATA(dataASN, NULL);
-#endif
+    FREE_ASNGETDATA(dataASN, NULL);
     return ret;
+#endif /* WOLFSSL_ASN_TEMPLATE */
 }
-#endif /* WC_ENABLE_ASYM_KEY_EXPORT */
-
 
+/* Decode an RFC 8410 SubjectPublicKeyInfo.
+ *
+ * @param [in]      input      BER encoded public key.
+ * @param [in, out] inOutIdx   On in, index to start decoding from.
+ *                             On out, index after the public key.
+ * @param [in]      inSz       Number of bytes in input.
+ * @param [out]     pubKey     Buffer to hold public value.
+ * @param [in, out] pubKeyLen  On in, size of pubKey in bytes.
+ *                             On out, length of public value.
+ * @param [in]      keyType    "enum Key_Sum" value like ED25519k.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ * @return  ASN_EXPECT_0_E when the public value is too big or data follows.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+static int DecodeAsymKeyPublic(const byte* input, word32* inOutIdx,
+    word32 inSz, byte* pubKey, word32* pubKeyLen, int keyType)
+{
+    int ret = 0;
+#ifndef WOLFSSL_ASN_TEMPLATE
+    int    length;
+    word32 oid;
+#else
+    DECL_ASNGETDATA(dataASN, edPubKeyASN_Length);
+    word32 oidSz;
+    const byte* oidBuf;
+#endif
 
+    if (input == NULL || inOutIdx == NULL || inSz == 0 ||
+        pubKey == NULL || pubKeyLen == NULL) {
+        return BAD_FUNC_ARG;
+    }
 
+#ifndef WOLFSSL_ASN_TEMPLATE
+    if (GetSequence(input, inOutIdx, &length, inSz) < 0)
+        return ASN_PARSE_E;
 
+    if (GetAlgoId(input, inOutIdx, &oid, oidKeyType, inSz) < 0)
+        return ASN_PARSE_E;
+    if (oid != (word32)keyType)
+        return ASN_PARSE_E;
 
+    ret = CheckBitString(input, inOutIdx, &length, inSz, 1, NULL);
+    if (ret != 0)
+        return ret;
 
+    /* Public value must fit and be the last of the input. */
+    if ((word32)length > *pubKeyLen)
+        return ASN_EXPECT_0_E;
+    if (*inOutIdx + (word32)length != inSz)
+        return ASN_EXPECT_0_E;
 
+    XMEMCPY(pubKey, input + *inOutIdx, length);
+    *pubKeyLen = length;
+    *inOutIdx += length;
+#else
+    CALLOC_ASNGETDATA(dataASN, edPubKeyASN_Length, ret, NULL);
 
+    if (ret == 0) {
+        /* Require the OID of the key type. */
+        oidBuf = OidFromId((word32)keyType, oidKeyType, &oidSz);
+        GetASN_ExpBuffer(&dataASN[EDPUBKEYASN_IDX_ALGOID_OID], oidBuf, oidSz);
+        /* Copy out the public value. */
+        GetASN_Buffer(&dataASN[EDPUBKEYASN_IDX_PUBKEY], pubKey, pubKeyLen);
+        ret = GetASN_Items(edPubKeyASN, dataASN, edPubKeyASN_Length, 1, input,
+                inOutIdx, inSz);
+    }
+    /* Public key must be the last of the input. */
+    if ((ret == 0) && (*inOutIdx != inSz)) {
+        ret = ASN_EXPECT_0_E;
+    }
 
-#ifndef WOLFSSL_ASN_TEMPLATE
+    FREE_ASNGETDATA(dataASN, NULL);
 #endif /* WOLFSSL_ASN_TEMPLATE */
+    return ret;
+}
+#endif /* WC_ENABLE_ASYM_KEY_IMPORT */
+
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT)
+/* Decode an Ed25519 private key, with or without its public key, into key.
+ *
+ * @param [in]      input     BER encoded private key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the private key.
+ * @param [in, out] key       Ed25519 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Ed25519PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                               ed25519_key* key, word32 inSz)
+{
+    int    ret;
+    byte   privKey[ED25519_KEY_SIZE];
+    byte   pubKey[ED25519_PUB_KEY_SIZE];
+    word32 privKeyLen = (word32)sizeof(privKey);
+    word32 pubKeyLen = (word32)sizeof(pubKey);
 
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
 
+    ret = DecodeAsymKey(input, inOutIdx, inSz, privKey, &privKeyLen,
+        pubKey, &pubKeyLen, ED25519k);
+    if (ret == 0) {
+        if (pubKeyLen == 0) {
+            ret = wc_ed25519_import_private_only(privKey, privKeyLen, key);
+        }
+        else {
+            ret = wc_ed25519_import_private_key(privKey, privKeyLen,
+                pubKey, pubKeyLen, key);
+        }
+    }
+    ForceZero(privKey, sizeof(privKey));
+    return ret;
+}
 
+/* Decode an Ed25519 SubjectPublicKeyInfo into key.
+ *
+ * @param [in]      input     BER encoded public key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the public key.
+ * @param [in, out] key       Ed25519 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Ed25519PublicKeyDecode(const byte* input, word32* inOutIdx,
+                              ed25519_key* key, word32 inSz)
+{
+    int    ret;
+    byte   pubKey[ED25519_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
 
-#ifdef WOLFSSL_ASN_TEMPLATE
-/* ASN.1 template for certificate name hash. */
-static const ASNItem nameHashASN[] = {
-/* OID  */ { 0, ASN_OBJECT_ID, 0, 0, 1 },
-/* NAME */ { 0, ASN_SEQUENCE, 1, 0, 0 },
-};
-enum {
-    NAMEHASHASN_IDX_OID = 0,
-    NAMEHASHASN_IDX_NAME,
-};
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
 
-/* Number of items in ASN.1 template for certificate name hash. */
-#define nameHashASN_Length (sizeof(nameHashASN) / sizeof(ASNItem))
-#endif /* WOLFSSL_ASN_TEMPLATE */
+    ret = DecodeAsymKeyPublic(input, inOutIdx, inSz, pubKey, &pubKeyLen,
+        ED25519k);
+    if (ret == 0) {
+        ret = wc_ed25519_import_public(pubKey, pubKeyLen, key);
+    }
+    return ret;
+}
+#endif /* HAVE_ED25519 && HAVE_ED25519_KEY_IMPORT */
 
-/* store WC_SHA hash of NAME */
-int GetNameHash(const byte* source, word32* idx, byte* hash, int maxIdx)
+#if defined(HAVE_CURVE25519) && defined(HAVE_CURVE25519_KEY_IMPORT)
+/* Decode a Curve25519 private key into key.
+ *
+ * @param [in]      input     BER encoded private key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the private key.
+ * @param [in, out] key       Curve25519 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Curve25519PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                                  curve25519_key* key, word32 inSz)
 {
-#ifndef WOLFSSL_ASN_TEMPLATE
-    int    length;  /* length of all distinguished names */
     int    ret;
-    word32 dummy;
-    byte   tag;
+    byte   privKey[CURVE25519_KEYSIZE];
+    word32 privKeyLen = CURVE25519_KEYSIZE;
 
-    WOLFSSL_ENTER("GetNameHash");
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
 
-    dummy = *idx;
-    if (GetASNTag(source, &dummy, &tag, maxIdx) == 0 && tag == ASN_OBJECT_ID) {
-        WOLFSSL_MSG("Trying optional prefix...");
+    ret = DecodeAsymKey(input, inOutIdx, inSz, privKey, &privKeyLen,
+        NULL, NULL, X25519k);
+    if (ret == 0) {
+        ret = wc_curve25519_import_private(privKey, privKeyLen, key);
+    }
+    ForceZero(privKey, sizeof(privKey));
+    return ret;
+}
 
-        if (GetLength(source, idx, &length, maxIdx) < 0)
-            return ASN_PARSE_E;
+/* Decode a Curve25519 SubjectPublicKeyInfo into key.
+ *
+ * @param [in]      input     BER encoded public key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the public key.
+ * @param [in, out] key       Curve25519 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Curve25519PublicKeyDecode(const byte* input, word32* inOutIdx,
+                                 curve25519_key* key, word32 inSz)
+{
+    int    ret;
+    byte   pubKey[CURVE25519_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
 
-        *idx += length;
-        WOLFSSL_MSG("Got optional prefix");
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
     }
 
-    /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
-     * calculated over the entire DER encoding of the Name field, including
-     * the tag and length. */
-    dummy = *idx;
-    if (GetSequence(source, idx, &length, maxIdx) < 0)
-        return ASN_PARSE_E;
+    ret = DecodeAsymKeyPublic(input, inOutIdx, inSz, pubKey, &pubKeyLen,
+        X25519k);
+    if (ret == 0) {
+        ret = wc_curve25519_import_public(pubKey, pubKeyLen, key);
+    }
+    return ret;
+}
+#endif /* HAVE_CURVE25519 && HAVE_CURVE25519_KEY_IMPORT */
 
-    ret = CalcHashId(source + dummy, length + *idx - dummy, hash);
+#if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_IMPORT)
+/* Decode an Ed448 private key, with or without its public key, into key.
+ *
+ * @param [in]      input     BER encoded private key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the private key.
+ * @param [in, out] key       Ed448 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Ed448PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                             ed448_key* key, word32 inSz)
+{
+    int    ret;
+    byte   privKey[ED448_KEY_SIZE];
+    byte   pubKey[ED448_PUB_KEY_SIZE];
+    word32 privKeyLen = (word32)sizeof(privKey);
+    word32 pubKeyLen = (word32)sizeof(pubKey);
 
-    *idx += length;
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
 
+    ret = DecodeAsymKey(input, inOutIdx, inSz, privKey, &privKeyLen,
+        pubKey, &pubKeyLen, ED448k);
+    if (ret == 0) {
+        if (pubKeyLen == 0) {
+            ret = wc_ed448_import_private_only(privKey, privKeyLen, key);
+        }
+        else {
+            ret = wc_ed448_import_private_key(privKey, privKeyLen,
+                pubKey, pubKeyLen, key);
+        }
+    }
+    ForceZero(privKey, sizeof(privKey));
     return ret;
-#else
-    ASNGetData dataASN[nameHashASN_Length];
-    int ret;
+}
 
-    XMEMSET(dataASN, 0, sizeof(dataASN));
-    /* Ignore the OID even when present. */
-    GetASN_OID(&dataASN[NAMEHASHASN_IDX_OID], oidIgnoreType);
-    /* Decode certificate name. */
-    ret = GetASN_Items(nameHashASN, dataASN, nameHashASN_Length, 0, source, idx,
-           maxIdx);
+/* Decode an Ed448 SubjectPublicKeyInfo into key.
+ *
+ * @param [in]      input     BER encoded public key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the public key.
+ * @param [in, out] key       Ed448 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Ed448PublicKeyDecode(const byte* input, word32* inOutIdx,
+                            ed448_key* key, word32 inSz)
+{
+    int    ret;
+    byte   pubKey[ED448_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = DecodeAsymKeyPublic(input, inOutIdx, inSz, pubKey, &pubKeyLen,
+        ED448k);
     if (ret == 0) {
-        /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
-         * calculated over the entire DER encoding of the Name field, including
-         * the tag and length. */
-        /* Calculate hash of complete name including SEQUENCE. */
-        ret = CalcHashId(
-                GetASNItem_Addr(dataASN[NAMEHASHASN_IDX_NAME], source),
-                GetASNItem_Length(dataASN[NAMEHASHASN_IDX_NAME], source),
-                hash);
+        ret = wc_ed448_import_public(pubKey, pubKeyLen, key);
+    }
+    return ret;
+}
+#endif /* HAVE_ED448 && HAVE_ED448_KEY_IMPORT */
+
+#if defined(HAVE_CURVE448) && defined(HAVE_CURVE448_KEY_IMPORT)
+/* Decode a Curve448 private key into key.
+ *
+ * @param [in]      input     BER encoded private key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the private key.
+ * @param [in, out] key       Curve448 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Curve448PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                                curve448_key* key, word32 inSz)
+{
+    int    ret;
+    byte   privKey[CURVE448_KEY_SIZE];
+    word32 privKeyLen = CURVE448_KEY_SIZE;
+
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
     }
 
+    ret = DecodeAsymKey(input, inOutIdx, inSz, privKey, &privKeyLen,
+        NULL, NULL, X448k);
+    if (ret == 0) {
+        ret = wc_curve448_import_private(privKey, privKeyLen, key);
+    }
+    ForceZero(privKey, sizeof(privKey));
+    return ret;
+}
+
+/* Decode a Curve448 SubjectPublicKeyInfo into key.
+ *
+ * @param [in]      input     BER encoded public key.
+ * @param [in, out] inOutIdx  On in, index to start decoding from.
+ *                            On out, index after the public key.
+ * @param [in, out] key       Curve448 key object.
+ * @param [in]      inSz      Number of bytes in input.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL or inSz is 0.
+ * @return  ASN_PARSE_E when the BER encoding is invalid.
+ */
+int wc_Curve448PublicKeyDecode(const byte* input, word32* inOutIdx,
+                               curve448_key* key, word32 inSz)
+{
+    int    ret;
+    byte   pubKey[CURVE448_PUB_KEY_SIZE];
+    word32 pubKeyLen = (word32)sizeof(pubKey);
+
+    if (input == NULL || inOutIdx == NULL || key == NULL || inSz == 0) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = DecodeAsymKeyPublic(input, inOutIdx, inSz, pubKey, &pubKeyLen,
+        X448k);
+    if (ret == 0) {
+        ret = wc_curve448_import_public(pubKey, pubKeyLen, key);
+    }
     return ret;
-#endif /* WOLFSSL_ASN_TEMPLATE */
 }
+#endif /* HAVE_CURVE448 && HAVE_CURVE448_KEY_IMPORT */
+
+#ifdef WC_ENABLE_ASYM_KEY_EXPORT
+
+/* Build ASN.1 formatted key based on RFC 5958 (Asymmetric Key Packages)
+ *
+ * Pass NULL for output to get the size of the encoding.
+ *
+ * @param [in]  privKey      private key buffer
+ * @param [in]  privKeyLen   private ket buffer length
+ * @param [in]  pubKey       public key buffer (optional)
+ * @param [in]  pubKeyLen    public ket buffer length
+ * @param [out] output       Buffer to put encoded data in (optional)
+ * @param [in]  outLen       Size of buffer in bytes
+ * @param [in]  keyType      is "enum Key_Sum" like ED25519k
+ * @return  Size of encoded data in bytes on success
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ * @return  LENGTH_ONLY_E return length only.
+ */
+static int SetAsymKeyDer(const byte* privKey, word32 privKeyLen,
+    const byte* pubKey, word32 pubKeyLen,
+    byte* output, word32 outLen, int keyType)
+{
+    int ret = 0;
+#ifndef WOLFSSL_ASN_TEMPLATE
+    word32 idx = 0, seqSz, verSz, algoSz, privSz, pubSz = 0, sz;
+#else
+    DECL_ASNSETDATA(dataASN, edKeyASN_Length);
+    int sz;
+#endif
+
+    /* Validate parameters. */
+    if (privKey == NULL || outLen == 0) {
+        return BAD_FUNC_ARG;
+    }
+
+#ifndef WOLFSSL_ASN_TEMPLATE
+    /* calculate size */
+    if (pubKey) {
+        pubSz = 2 + 2 + pubKeyLen;
+    }
+    privSz = 2 + 2 + privKeyLen;
+    algoSz = SetAlgoID(keyType, NULL, oidKeyType, 0);
+    verSz  = 3; /* version is 3 bytes (enum + id + version(byte)) */
+    seqSz  = SetSequence(verSz + algoSz + privSz + pubSz, NULL);
+    sz = seqSz + verSz + algoSz + privSz + pubSz;
+
+    /* checkout output size */
+    if (output != NULL && sz > outLen) {
+        ret = BAD_FUNC_ARG;
+    }
+
+    if (ret == 0 && output != NULL) {
+        /* write out */
+        /* seq */
+        seqSz  = SetSequence(verSz + algoSz + privSz + pubSz, output);
+        idx = seqSz;
+        /* ver */
+        SetMyVersion(0, output + idx, FALSE);
+        idx += verSz;
+        /* algo */
+        algoSz = SetAlgoID(keyType, output + idx, oidKeyType, 0);
+        idx += algoSz;
+        /* privKey */
+        idx += SetOctetString(2 + privKeyLen, output + idx);
+        idx += SetOctetString(privKeyLen, output + idx);
+        XMEMCPY(output + idx, privKey, privKeyLen);
+        idx += privKeyLen;
+        /* pubKey */
+        if (pubKey) {
+            idx += SetExplicit(1, 2 + pubKeyLen, output + idx);
+            idx += SetOctetString(pubKeyLen, output + idx);
+            XMEMCPY(output + idx, pubKey, pubKeyLen);
+            idx += pubKeyLen;
+        }
+
+        ret = idx;
+    }
+#else
+
+    CALLOC_ASNSETDATA(dataASN, edKeyASN_Length, ret, NULL);
+
+    if (ret == 0) {
+        /* Set version = 0 */
+        SetASN_Int8Bit(&dataASN[EDKEYASN_IDX_VER], 0);
+        /* Set OID. */
+        SetASN_OID(&dataASN[EDKEYASN_IDX_PKEYALGO_OID], keyType, oidKeyType);
+        /* Leave space for private key. */
+        SetASN_Buffer(&dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY], NULL, privKeyLen);
+        /* Don't write out attributes. */
+        dataASN[EDKEYASN_IDX_ATTRS].noOut = 1;
+        if (pubKey) {
+            /* Leave space for public key. */
+            SetASN_Buffer(&dataASN[EDKEYASN_IDX_PUBKEY_VAL], NULL, pubKeyLen);
+        }
+        else {
+            /* Don't put out public part. */
+            SetASNItem_NoOutNode(dataASN, edKeyASN, EDKEYASN_IDX_PUBKEY,
+                    edKeyASN_Length);
+        }
+
+        /* Calculate the size of encoding. */
+        ret = SizeASN_Items(edKeyASN, dataASN, edKeyASN_Length, &sz);
+    }
+
+    /* Check buffer is big enough. */
+    if ((ret == 0) && (output != NULL) && (sz > (int)outLen)) {
+        ret = BAD_FUNC_ARG;
+    }
+    if ((ret == 0) && (output != NULL)) {
+        /* Encode private key. */
+        SetASN_Items(edKeyASN, dataASN, edKeyASN_Length, output);
+
+        /* Put private value into space provided. */
+        XMEMCPY((byte*)dataASN[EDKEYASN_IDX_PKEY_CURVEPKEY].data.buffer.data,
+                privKey, privKeyLen);
+
+        if (pubKey != NULL) {
+            /* Put public value into space provided. */
+            XMEMCPY((byte*)dataASN[EDKEYASN_IDX_PUBKEY_VAL].data.buffer.data,
+                    pubKey, pubKeyLen);
+        }
+
+        /* Return size of encoding. */
+        ret = sz;
+    }
+
+    FREE_ASNSETDATA(dataASN, NULL);
+#endif
+    return ret;
+}
+#endif /* WC_ENABLE_ASYM_KEY_EXPORT */
+
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_EXPORT)
+/* Encode an Ed25519 private and public key in RFC 5958 format.
+ *
+ * @param [in]  key     Ed25519 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed25519KeyToDer(ed25519_key* key, byte* output, word32 inLen)
+{
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    return SetAsymKeyDer(key->k, ED25519_KEY_SIZE, key->p,
+        ED25519_PUB_KEY_SIZE, output, inLen, ED25519k);
+}
+
+/* Encode an Ed25519 private key, without the public key, in RFC 5958
+ * format.
+ *
+ * @param [in]  key     Ed25519 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed25519PrivateKeyToDer(ed25519_key* key, byte* output, word32 inLen)
+{
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    return SetAsymKeyDer(key->k, ED25519_KEY_SIZE, NULL, 0, output, inLen,
+        ED25519k);
+}
+#endif /* HAVE_ED25519 && HAVE_ED25519_KEY_EXPORT */
+
+#if defined(HAVE_CURVE25519) && defined(HAVE_CURVE25519_KEY_EXPORT)
+/* Encode a Curve25519 private key in RFC 5958 format.
+ *
+ * @param [in]  key     Curve25519 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Curve25519PrivateKeyToDer(curve25519_key* key, byte* output,
+                                 word32 inLen)
+{
+    int    ret;
+    byte   privKey[CURVE25519_KEYSIZE];
+    word32 privKeyLen = CURVE25519_KEYSIZE;
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wc_curve25519_export_private_raw(key, privKey, &privKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDer(privKey, privKeyLen, NULL, 0, output, inLen,
+            X25519k);
+    }
+    ForceZero(privKey, sizeof(privKey));
+    return ret;
+}
+#endif /* HAVE_CURVE25519 && HAVE_CURVE25519_KEY_EXPORT */
+
+#if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_EXPORT)
+/* Encode an Ed448 private and public key in RFC 5958 format.
+ *
+ * @param [in]  key     Ed448 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed448KeyToDer(ed448_key* key, byte* output, word32 inLen)
+{
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    return SetAsymKeyDer(key->k, ED448_KEY_SIZE, key->p,
+        ED448_PUB_KEY_SIZE, output, inLen, ED448k);
+}
+
+/* Encode an Ed448 private key, without the public key, in RFC 5958
+ * format.
+ *
+ * @param [in]  key     Ed448 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Ed448PrivateKeyToDer(ed448_key* key, byte* output, word32 inLen)
+{
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    return SetAsymKeyDer(key->k, ED448_KEY_SIZE, NULL, 0, output, inLen,
+        ED448k);
+}
+#endif /* HAVE_ED448 && HAVE_ED448_KEY_EXPORT */
+
+#if defined(HAVE_CURVE448) && defined(HAVE_CURVE448_KEY_EXPORT)
+/* Encode a Curve448 private key in RFC 5958 format.
+ *
+ * @param [in]  key     Curve448 key object.
+ * @param [out] output  Buffer to put encoded data in.
+ * @param [in]  inLen   Size of buffer in bytes.
+ * @return  Size of encoded data in bytes on success.
+ * @return  BAD_FUNC_ARG when key is NULL or output is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_Curve448PrivateKeyToDer(curve448_key* key, byte* output,
+                               word32 inLen)
+{
+    int    ret;
+    byte   privKey[CURVE448_KEY_SIZE];
+    word32 privKeyLen = CURVE448_KEY_SIZE;
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wc_curve448_export_private_raw(key, privKey, &privKeyLen);
+    if (ret == 0) {
+        ret = SetAsymKeyDer(privKey, privKeyLen, NULL, 0, output, inLen,
+            X448k);
+    }
+    ForceZero(privKey, sizeof(privKey));
+    return ret;
+}
+#endif /* HAVE_CURVE448 && HAVE_CURVE448_KEY_EXPORT */
+
+
+
+
+
+
+
+#ifndef WOLFSSL_ASN_TEMPLATE
+#endif /* WOLFSSL_ASN_TEMPLATE */
+
+
+
+
+#ifdef WOLFSSL_ASN_TEMPLATE
+/* ASN.1 template for certificate name hash. */
+static const ASNItem nameHashASN[] = {
+/* OID  */ { 0, ASN_OBJECT_ID, 0, 0, 1 },
+/* NAME */ { 0, ASN_SEQUENCE, 1, 0, 0 },
+};
+enum {
+    NAMEHASHASN_IDX_OID = 0,
+    NAMEHASHASN_IDX_NAME,
+};
+
+/* Number of items in ASN.1 template for certificate name hash. */
+#define nameHashASN_Length (sizeof(nameHashASN) / sizeof(ASNItem))
+#endif /* WOLFSSL_ASN_TEMPLATE */
+
+/* store WC_SHA hash of NAME */
+int GetNameHash(const byte* source, word32* idx, byte* hash, int maxIdx)
+{
+#ifndef WOLFSSL_ASN_TEMPLATE
+    int    length;  /* length of all distinguished names */
+    int    ret;
+    word32 dummy;
+    byte   tag;
+
+    WOLFSSL_ENTER("GetNameHash");
+
+    dummy = *idx;
+    if (GetASNTag(source, &dummy, &tag, maxIdx) == 0 && tag == ASN_OBJECT_ID) {
+        WOLFSSL_MSG("Trying optional prefix...");
+
+        if (GetLength(source, idx, &length, maxIdx) < 0)
+            return ASN_PARSE_E;
+
+        *idx += length;
+        WOLFSSL_MSG("Got optional prefix");
+    }
+
+    /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
+     * calculated over the entire DER encoding of the Name field, including
+     * the tag and length. */
+    dummy = *idx;
+    if (GetSequence(source, idx, &length, maxIdx) < 0)
+        return ASN_PARSE_E;
+
+    ret = CalcHashId(source + dummy, length + *idx - dummy, hash);
+
+    *idx += length;
+
+    return ret;
+#else
+    ASNGetData dataASN[nameHashASN_Length];
+    int ret;
+
+    XMEMSET(dataASN, 0, sizeof(dataASN));
+    /* Ignore the OID even when present. */
+    GetASN_OID(&dataASN[NAMEHASHASN_IDX_OID], oidIgnoreType);
+    /* Decode certificate name. */
+    ret = GetASN_Items(nameHashASN, dataASN, nameHashASN_Length, 0, source, idx,
+           maxIdx);
+    if (ret == 0) {
+        /* For OCSP, RFC2560 section 4.1.1 states the issuer hash should be
+         * calculated over the entire DER encoding of the Name field, including
+         * the tag and length. */
+        /* Calculate hash of complete name including SEQUENCE. */
+        ret = CalcHashId(
+                GetASNItem_Addr(dataASN[NAMEHASHASN_IDX_NAME], source),
+                GetASNItem_Length(dataASN[NAMEHASHASN_IDX_NAME], source),
+                hash);
+    }
+
+    return ret;
+#endif /* WOLFSSL_ASN_TEMPLATE */
+}
+
+#if defined(HAVE_CRL) || defined(HAVE_OCSP)
+/* Copy a CRL or OCSP date, stored without tag and length like certificate
+ * dates */
+static int GetDateCopy(const byte* buff, word32* idx, byte* date, byte* format,
+                       word32 maxIdx)
+{
+    const byte* datePtr = NULL;
+    int         length = 0;
+    int         ret;
+
+    ret = GetDateInfo(buff, idx, &datePtr, format, &length, maxIdx);
+    if (ret == 0) {
+        XMEMSET(date, 0, MAX_DATE_SIZE);
+        XMEMCPY(date, datePtr, length);
+    }
+
+    return ret;
+}
+#endif /* HAVE_CRL || HAVE_OCSP */
+
+#ifdef HAVE_CRL
+
+/* initialize decoded CRL */
+void InitDecodedCRL(DecodedCRL* dcrl, void* heap)
+{
+    WOLFSSL_MSG("InitDecodedCRL");
+
+    XMEMSET(dcrl, 0, sizeof(DecodedCRL));
+    dcrl->heap = heap;
+}
+
+
+/* free decoded CRL resources, the revoked list may have been taken over */
+void FreeDecodedCRL(DecodedCRL* dcrl)
+{
+    WOLFSSL_MSG("FreeDecodedCRL");
+
+    XFREE(dcrl->certs, dcrl->heap, DYNAMIC_TYPE_REVOKED);
+    dcrl->certs = NULL;
+    dcrl->totalCerts = 0;
+}
+
+
+/* Get the revoked certificate serial numbers.
+ * The entries are counted first so that the list is allocated once, even for
+ * CRLs with hundreds of thousands of entries. Revocation dates and entry
+ * extensions are not kept. */
+static int GetRevokedCerts(DecodedCRL* dcrl, const byte* buff, word32* inOutIdx,
+                           word32 maxIdx)
+{
+    word32 idx = *inOutIdx;
+    word32 start, end, entryEnd;
+    int    len;
+    int    cnt = 0;
+
+    WOLFSSL_ENTER("GetRevokedCerts");
+
+    if (GetSequence(buff, &idx, &len, maxIdx) < 0)
+        return ASN_PARSE_E;
+    start = idx;
+    end   = idx + len;
+
+    while (idx < end) {
+        if (GetSequence(buff, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        idx += len;
+        cnt++;
+    }
+
+    if (cnt > 0) {
+        dcrl->certs = (RevokedCert*)XMALLOC(sizeof(RevokedCert) * cnt,
+                                            dcrl->heap, DYNAMIC_TYPE_REVOKED);
+        if (dcrl->certs == NULL)
+            return MEMORY_E;
+    }
+
+    for (idx = start; idx < end; idx = entryEnd) {
+        RevokedCert* rc = &dcrl->certs[dcrl->totalCerts];
+
+        if (GetSequence(buff, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        entryEnd = idx + len;
+
+        if (GetASNHeader(buff, ASN_INTEGER, &idx, &len, entryEnd) < 0 ||
+                                                                     len <= 0)
+            return ASN_PARSE_E;
+        /* remove leading zero, matches serial number of decoded cert */
+        if (len > 1 && buff[idx] == 0x00) {
+            idx++;
+            len--;
+        }
+        if (len > EXTERNAL_SERIAL_SIZE) {
+            /* can't be the serial of a certificate we accept */
+            WOLFSSL_MSG("CRL entry serial too large, skipping");
+            continue;
+        }
+
+        rc->serialSz = (byte)len;
+        XMEMCPY(rc->serialNumber, buff + idx, len);
+        dcrl->totalCerts++;
+    }
+
+    *inOutIdx = end;
+
+    return 0;
+}
+
+
+#ifndef NO_SKID
+/* Get the Authority Key Identifier from the CRL extensions, others ignored */
+static int ParseCRL_Extensions(DecodedCRL* dcrl, const byte* buff, word32 idx,
+                               word32 maxIdx)
+{
+    word32 end, extEnd, localIdx;
+    word32 oid;
+    int    len;
+    byte   tag;
+
+    if (GetSequence(buff, &idx, &len, maxIdx) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+
+    for (; idx < end; idx = extEnd) {
+        if (GetSequence(buff, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        extEnd = idx + len;
+
+        oid = 0;
+        if (GetObjectId(buff, &idx, &oid, oidCrlExtType, extEnd) < 0)
+            return ASN_PARSE_E;
+        if (oid != AUTH_KEY_OID)
+            continue;
+
+        /* critical - optional */
+        localIdx = idx;
+        if (GetASNTag(buff, &localIdx, &tag, extEnd) == 0 &&
+                                                          tag == ASN_BOOLEAN) {
+            if (GetASNHeader(buff, ASN_BOOLEAN, &idx, &len, extEnd) < 0)
+                return ASN_PARSE_E;
+            idx += len;
+        }
+        if (GetOctetString(buff, &idx, &len, extEnd) < 0 ||
+                GetSequence(buff, &idx, &len, extEnd) < 0)
+            return ASN_PARSE_E;
+
+        /* keyIdentifier [0] IMPLICIT - optional */
+        localIdx = idx;
+        if (GetASNTag(buff, &localIdx, &tag, extEnd) == 0 &&
+                                           tag == (ASN_CONTEXT_SPECIFIC | 0)) {
+            idx = localIdx;
+            if (GetLength(buff, &idx, &len, extEnd) <= 0)
+                return ASN_PARSE_E;
+            if (GetHashId(buff + idx, len, dcrl->extAuthKeyId) != 0)
+                return ASN_PARSE_E;
+            dcrl->extAuthKeyIdSet = 1;
+        }
+    }
+
+    return 0;
+}
+#endif /* !NO_SKID */
+
+
+/* Verify the CRL signature with the issuing CA from the certificate manager */
+static int VerifyCRL_Signature(DecodedCRL* dcrl, const byte* buff, void* cm)
+{
+    SignatureCtx sigCtx[1];
+    Signer*      ca = NULL;
+    int          ret;
+
+#ifndef NO_SKID
+    if (dcrl->extAuthKeyIdSet) {
+        ca = GetCA(cm, dcrl->extAuthKeyId);
+        if (ca != NULL && XMEMCMP(dcrl->issuerHash, ca->subjectNameHash,
+                                                         KEYID_SIZE) != 0) {
+            ca = NULL;
+        }
+    }
+    if (ca == NULL) {
+        ca = GetCAByName(cm, dcrl->issuerHash);
+    }
+#else
+    ca = GetCA(cm, dcrl->issuerHash);
+#endif /* !NO_SKID */
+
+    if (ca == NULL) {
+        WOLFSSL_MSG("Did NOT find CRL issuer CA");
+        return ASN_CRL_NO_SIGNER_E;
+    }
+    if ((ca->keyUsage & KEYUSE_CRL_SIGN) == 0) {
+        WOLFSSL_MSG("CA cannot sign CRLs");
+        return ASN_CRL_NO_SIGNER_E;
+    }
+
+    InitSignatureCtx(sigCtx, dcrl->heap, INVALID_DEVID);
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+    sigCtx->signer = ca;
+#endif
+    ret = ConfirmSignature(sigCtx, buff + dcrl->certBegin,
+                           dcrl->sigIndex - dcrl->certBegin,
+                           ca->publicKey, ca->pubKeySize, ca->keyOID,
+                           dcrl->signature, dcrl->sigLength,
+                           dcrl->signatureOID, NULL);
+    FreeSignatureCtx(sigCtx);
+    if (ret != 0) {
+        WOLFSSL_MSG("CRL Confirm signature failed");
+        ret = ASN_CRL_CONFIRM_E;
+    }
+
+    return ret;
+}
+
+
+/* parse CRL buffer into decoded state, 0 on success
+ * revoked serial numbers are returned in CRL order */
+int ParseCRL(DecodedCRL* dcrl, const byte* buff, word32 sz, int verify,
+             void* cm)
+{
+    int     ret = 0;
+    int     len;
+    word32  idx = 0;
+    word32  localIdx;
+    word32  oid;
+    byte    tag;
+
+    WOLFSSL_MSG("ParseCRL");
+
+    if (dcrl == NULL || buff == NULL || sz == 0)
+        return BAD_FUNC_ARG;
+
+    /* CertificateList */
+    if (GetSequence(buff, &idx, &len, sz) < 0)
+        return ASN_PARSE_E;
+    dcrl->certBegin = idx;
+
+    /* TBSCertList */
+    if (GetSequence(buff, &idx, &len, sz) < 0)
+        return ASN_PARSE_E;
+    dcrl->sigIndex = len + idx;
+
+    /* version - optional, v2 */
+    localIdx = idx;
+    if (GetASNTag(buff, &localIdx, &tag, dcrl->sigIndex) == 0 &&
+                                                          tag == ASN_INTEGER) {
+        if (GetASNHeader(buff, ASN_INTEGER, &idx, &len, dcrl->sigIndex) < 0)
+            return ASN_PARSE_E;
+        idx += len;
+    }
+
+    /* signature */
+    if (GetAlgoId(buff, &idx, &oid, oidIgnoreType, dcrl->sigIndex) < 0)
+        return ASN_PARSE_E;
+
+    /* issuer */
+    if (GetNameHash(buff, &idx, dcrl->issuerHash, dcrl->sigIndex) < 0)
+        return ASN_PARSE_E;
+
+    /* thisUpdate */
+    ret = GetDateCopy(buff, &idx, dcrl->lastDate, &dcrl->lastDateFormat,
+                      dcrl->sigIndex);
+    if (ret != 0)
+        return ret;
+
+    /* nextUpdate - optional */
+    dcrl->nextDateFormat = ASN_OTHER_TYPE;
+    localIdx = idx;
+    if (GetASNTag(buff, &localIdx, &tag, dcrl->sigIndex) == 0 &&
+            (tag == ASN_UTC_TIME || tag == ASN_GENERALIZED_TIME)) {
+        ret = GetDateCopy(buff, &idx, dcrl->nextDate, &dcrl->nextDateFormat,
+                          dcrl->sigIndex);
+        if (ret != 0)
+            return ret;
+    }
+
+    /* revokedCertificates - optional */
+    localIdx = idx;
+    if (GetASNTag(buff, &localIdx, &tag, dcrl->sigIndex) == 0 &&
+                                       tag == (ASN_SEQUENCE | ASN_CONSTRUCTED)) {
+        ret = GetRevokedCerts(dcrl, buff, &idx, dcrl->sigIndex);
+        if (ret != 0)
+            return ret;
+    }
+
+    /* crlExtensions [0] EXPLICIT - optional */
+    localIdx = idx;
+    if (GetASNTag(buff, &localIdx, &tag, dcrl->sigIndex) == 0 &&
+                     tag == (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 0)) {
+        idx = localIdx;
+        if (GetLength(buff, &idx, &len, dcrl->sigIndex) < 0)
+            return ASN_PARSE_E;
+    #ifndef NO_SKID
+        ret = ParseCRL_Extensions(dcrl, buff, idx, idx + len);
+        if (ret != 0)
+            return ret;
+    #endif
+    }
+
+    /* signatureAlgorithm */
+    idx = dcrl->sigIndex;
+    if (GetAlgoId(buff, &idx, &dcrl->signatureOID, oidSigType, sz) < 0)
+        return ASN_PARSE_E;
+
+    /* signatureValue */
+    if (CheckBitString(buff, &idx, &len, sz, 1, NULL) < 0)
+        return ASN_PARSE_E;
+    dcrl->sigLength = len;
+    dcrl->signature = buff + idx;
+
+    if (verify != NO_VERIFY) {
+        ret = VerifyCRL_Signature(dcrl, buff, cm);
+    }
+
+    return ret;
+}
+
+#endif /* HAVE_CRL */
+
+#ifdef HAVE_OCSP
+
+/* Get the CertID of a single response.
+ * Hashes other than SHA-1 are not kept, hashAlgoOID tells the caller. */
+static int DecodeCertId(OcspEntry* single, const byte* source, word32* ioIndex,
+                        word32 size)
+{
+    CertStatus* cs = single->status;
+    word32      idx = *ioIndex;
+    word32      end;
+    int         len;
+
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+
+    /* hashAlgorithm */
+    if (GetAlgoId(source, &idx, &single->hashAlgoOID, oidHashType, end) < 0)
+        return ASN_PARSE_E;
+
+    /* issuerNameHash */
+    if (GetOctetString(source, &idx, &len, end) < 0)
+        return ASN_PARSE_E;
+    if (len == OCSP_DIGEST_SIZE)
+        XMEMCPY(single->issuerHash, source + idx, len);
+    idx += len;
+
+    /* issuerKeyHash */
+    if (GetOctetString(source, &idx, &len, end) < 0)
+        return ASN_PARSE_E;
+    if (len == OCSP_DIGEST_SIZE)
+        XMEMCPY(single->issuerKeyHash, source + idx, len);
+    idx += len;
+
+    /* serialNumber, leading zero removed to match the decoded cert */
+    if (GetASNHeader(source, ASN_INTEGER, &idx, &len, end) < 0 || len <= 0)
+        return ASN_PARSE_E;
+    if (len > 1 && source[idx] == 0x00) {
+        idx++;
+        len--;
+    }
+    if (len > EXTERNAL_SERIAL_SIZE)
+        return ASN_PARSE_E;
+    cs->serialSz = len;
+    XMEMCPY(cs->serial, source + idx, len);
+
+    *ioIndex = end;
+
+    return 0;
+}
+
+
+/* Decode a SingleResponse: CertID, status and the validity period */
+static int DecodeSingleResponse(OcspEntry* single, const byte* source,
+                                word32* ioIndex, word32 size)
+{
+    CertStatus* cs = single->status;
+    word32      idx = *ioIndex;
+    word32      end, localIdx;
+    int         len;
+    int         ret;
+    byte        tag;
+
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+
+    ret = DecodeCertId(single, source, &idx, end);
+    if (ret != 0)
+        return ret;
+
+    /* certStatus - revocation time and reason are not kept */
+    if (GetASNTag(source, &idx, &tag, end) < 0)
+        return ASN_PARSE_E;
+    switch (tag) {
+        case (ASN_CONTEXT_SPECIFIC | CERT_GOOD):
+            cs->status = CERT_GOOD;
+            break;
+        case (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | CERT_REVOKED):
+            cs->status = CERT_REVOKED;
+            break;
+        case (ASN_CONTEXT_SPECIFIC | CERT_UNKNOWN):
+            cs->status = CERT_UNKNOWN;
+            break;
+        default:
+            return ASN_PARSE_E;
+    }
+    if (GetLength(source, &idx, &len, end) < 0)
+        return ASN_PARSE_E;
+    idx += len;
+
+    /* thisUpdate */
+    ret = GetDateCopy(source, &idx, cs->thisDate, &cs->thisDateFormat, end);
+    if (ret != 0)
+        return ret;
+#if !defined(NO_ASN_TIME) && !defined(WOLFSSL_NO_OCSP_DATE_CHECK)
+    if (!XVALIDATE_DATE(cs->thisDate, cs->thisDateFormat, BEFORE))
+        return ASN_BEFORE_DATE_E;
+#endif
+
+    /* nextUpdate [0] EXPLICIT - optional */
+    cs->nextDateFormat = ASN_OTHER_TYPE;
+    localIdx = idx;
+    if (idx < end && GetASNTag(source, &localIdx, &tag, end) == 0 &&
+                     tag == (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 0)) {
+        idx = localIdx;
+        if (GetLength(source, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        ret = GetDateCopy(source, &idx, cs->nextDate, &cs->nextDateFormat,
+                          end);
+        if (ret != 0)
+            return ret;
+    #if !defined(NO_ASN_TIME) && !defined(WOLFSSL_NO_OCSP_DATE_CHECK)
+        if (!XVALIDATE_DATE(cs->nextDate, cs->nextDateFormat, AFTER))
+            return ASN_AFTER_DATE_E;
+    #endif
+    }
+
+    /* singleExtensions are ignored */
+    *ioIndex = end;
+
+    return 0;
+}
+
+
+/* Get the nonce from the response extensions, others are ignored */
+static int DecodeOcspRespExtensions(OcspResponse* resp, const byte* source,
+                                    word32 idx, word32 size)
+{
+    word32 end, extEnd, localIdx;
+    word32 oid;
+    int    len;
+    byte   tag;
+
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+
+    for (; idx < end; idx = extEnd) {
+        if (GetSequence(source, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        extEnd = idx + len;
+
+        oid = 0;
+        if (GetObjectId(source, &idx, &oid, oidOcspType, extEnd) < 0)
+            return ASN_PARSE_E;
+
+        /* critical - optional */
+        localIdx = idx;
+        if (GetASNTag(source, &localIdx, &tag, extEnd) == 0 &&
+                                                          tag == ASN_BOOLEAN) {
+            if (GetASNHeader(source, ASN_BOOLEAN, &idx, &len, extEnd) < 0)
+                return ASN_PARSE_E;
+            idx += len;
+        }
+        if (GetOctetString(source, &idx, &len, extEnd) < 0)
+            return ASN_PARSE_E;
+        if (oid != OCSP_NONCE_OID)
+            continue;
+
+        resp->nonce   = source + idx;
+        resp->nonceSz = len;
+        /* the nonce is usually wrapped in another OCTET STRING */
+        localIdx = idx;
+        if (GetOctetString(source, &localIdx, &len, extEnd) >= 0 &&
+                                                  localIdx + len == extEnd) {
+            resp->nonce   = source + localIdx;
+            resp->nonceSz = len;
+        }
+    }
+
+    return 0;
+}
+
+
+/* Append a new single response with its status to the response */
+static OcspEntry* NewOcspSingle(OcspResponse* resp, OcspEntry** tail)
+{
+    OcspEntry* single;
+
+    single = (OcspEntry*)XMALLOC(sizeof(OcspEntry), resp->heap,
+                                 DYNAMIC_TYPE_OCSP_ENTRY);
+    if (single == NULL)
+        return NULL;
+    XMEMSET(single, 0, sizeof(OcspEntry));
+
+    single->status = (CertStatus*)XMALLOC(sizeof(CertStatus), resp->heap,
+                                          DYNAMIC_TYPE_OCSP_STATUS);
+    if (single->status == NULL) {
+        XFREE(single, resp->heap, DYNAMIC_TYPE_OCSP_ENTRY);
+        return NULL;
+    }
+    XMEMSET(single->status, 0, sizeof(CertStatus));
+    single->totalStatus = 1;
+
+    if (*tail == NULL)
+        resp->single = single;
+    else
+        (*tail)->next = single;
+    *tail = single;
+
+    return single;
+}
+
+
+/* Decode the tbsResponseData, all single responses are kept */
+static int DecodeResponseData(OcspResponse* resp, word32* ioIndex,
+                              word32 size)
+{
+    const byte* source = resp->source;
+    OcspEntry*  tail = NULL;
+    OcspEntry*  single;
+    word32      idx = *ioIndex;
+    word32      end, listEnd, localIdx;
+    int         len;
+    int         ret;
+    byte        tag;
+
+    resp->response = source + idx;
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+    resp->responseSz = end - *ioIndex;
+
+    /* version [0] EXPLICIT - optional, v1 */
+    localIdx = idx;
+    if (GetASNTag(source, &localIdx, &tag, end) == 0 &&
+                     tag == (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 0)) {
+        idx = localIdx;
+        if (GetLength(source, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        idx += len;
+    }
+
+    /* responderID, the signer is found from the certs or the issuer */
+    if (GetASNTag(source, &idx, &tag, end) < 0)
+        return ASN_PARSE_E;
+    if (tag != (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 1) &&
+            tag != (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 2))
+        return ASN_PARSE_E;
+    if (GetLength(source, &idx, &len, end) < 0)
+        return ASN_PARSE_E;
+    idx += len;
+
+    /* producedAt */
+    ret = GetDateCopy(source, &idx, resp->producedDate,
+                      &resp->producedDateFormat, end);
+    if (ret != 0)
+        return ret;
+
+    /* responses */
+    if (GetSequence(source, &idx, &len, end) < 0)
+        return ASN_PARSE_E;
+    listEnd = idx + len;
+    while (idx < listEnd) {
+        single = NewOcspSingle(resp, &tail);
+        if (single == NULL)
+            return MEMORY_E;
+        ret = DecodeSingleResponse(single, source, &idx, listEnd);
+        if (ret != 0)
+            return ret;
+    }
+    if (resp->single == NULL)
+        return ASN_PARSE_E;
+
+    /* responseExtensions [1] EXPLICIT - optional */
+    localIdx = idx;
+    if (idx < end && GetASNTag(source, &localIdx, &tag, end) == 0 &&
+                     tag == (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 1)) {
+        idx = localIdx;
+        if (GetLength(source, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        ret = DecodeOcspRespExtensions(resp, source, idx, idx + len);
+        if (ret != 0)
+            return ret;
+    }
+
+    *ioIndex = end;
+
+    return 0;
+}
+
+
+/* Verify the response signature.
+ * A responder cert from the response must chain to a loaded CA and either be
+ * the issuer or be allowed to sign OCSP responses. Without one, the issuer
+ * of the certificate must have signed the response. */
+static int VerifyOcspSignature(OcspResponse* resp, const byte* cert,
+                               word32 certSz, void* cm)
+{
+    int ret;
+
+    if (cert != NULL) {
+    #ifdef WOLFSSL_SMALL_STACK
+        DecodedCert* dCert;
+    #else
+        DecodedCert  dCert[1];
+    #endif
+
+    #ifdef WOLFSSL_SMALL_STACK
+        dCert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), resp->heap,
+                                      DYNAMIC_TYPE_DCERT);
+        if (dCert == NULL)
+            return MEMORY_E;
+    #endif
+
+        InitDecodedCert(dCert, cert, certSz, resp->heap);
+        ret = ParseCertRelative(dCert, CERT_TYPE, VERIFY_OCSP, cm);
+        if (ret < 0) {
+            WOLFSSL_MSG("\tOCSP Responder certificate parsing failed");
+        }
+    #ifndef WOLFSSL_NO_OCSP_ISSUER_CHECK
+        else if ((dCert->extExtKeyUsage & EXTKEYUSE_OCSP_SIGN) == 0 &&
+                 XMEMCMP(dCert->subjectHash, resp->single->issuerHash,
+                                                     OCSP_DIGEST_SIZE) != 0) {
+            WOLFSSL_MSG("\tOCSP Responder key usage check failed");
+            ret = BAD_OCSP_RESPONDER;
+        }
+    #endif
+        else {
+            ret = ConfirmSignature(&dCert->sigCtx, resp->response,
+                                   resp->responseSz, dCert->publicKey,
+                                   dCert->pubKeySize, dCert->keyOID,
+                                   resp->sig, resp->sigSz, resp->sigOID,
+                                   NULL);
+            if (ret != 0) {
+                WOLFSSL_MSG("\tOCSP Confirm signature failed");
+                ret = ASN_OCSP_CONFIRM_E;
+            }
+        }
+
+        FreeDecodedCert(dCert);
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(dCert, resp->heap, DYNAMIC_TYPE_DCERT);
+    #endif
+    }
+    else {
+        SignatureCtx sigCtx[1];
+        Signer*      ca;
+
+    #ifndef NO_SKID
+        ca = GetCAByName(cm, resp->single->issuerHash);
+    #else
+        ca = GetCA(cm, resp->single->issuerHash);
+    #endif
+        if (ca != NULL && XMEMCMP(ca->subjectKeyHash,
+                       resp->single->issuerKeyHash, OCSP_DIGEST_SIZE) != 0) {
+            ca = NULL;
+        }
+        if (ca == NULL) {
+            WOLFSSL_MSG("\tOCSP issuer not found");
+            return ASN_NO_SIGNER_E;
+        }
+
+        InitSignatureCtx(sigCtx, resp->heap, INVALID_DEVID);
+    #ifdef WOLFSSL_SIGNER_KEY_CACHE
+        sigCtx->signer = ca;
+    #endif
+        ret = ConfirmSignature(sigCtx, resp->response, resp->responseSz,
+                               ca->publicKey, ca->pubKeySize, ca->keyOID,
+                               resp->sig, resp->sigSz, resp->sigOID, NULL);
+        FreeSignatureCtx(sigCtx);
+        if (ret != 0) {
+            WOLFSSL_MSG("\tOCSP Confirm signature failed");
+            ret = ASN_OCSP_CONFIRM_E;
+        }
+    }
+
+    return ret;
+}
+
+
+/* Decode the BasicOCSPResponse and verify its signature */
+static int DecodeBasicOcspResponse(OcspResponse* resp, word32* ioIndex,
+                                   word32 size, void* cm, int noVerify)
+{
+    const byte* source = resp->source;
+    const byte* cert = NULL;
+    word32      certSz = 0;
+    word32      idx = *ioIndex;
+    word32      end, localIdx;
+    int         len;
+    int         ret;
+    byte        tag;
+
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    end = idx + len;
+
+    ret = DecodeResponseData(resp, &idx, end);
+    if (ret != 0)
+        return ret;
+
+    /* signatureAlgorithm */
+    if (GetAlgoId(source, &idx, &resp->sigOID, oidSigType, end) < 0)
+        return ASN_PARSE_E;
+
+    /* signature */
+    if (CheckBitString(source, &idx, &len, end, 1, NULL) != 0)
+        return ASN_PARSE_E;
+    resp->sig   = source + idx;
+    resp->sigSz = len;
+    idx += len;
+
+    /* certs [0] EXPLICIT - optional, only the first is the responder */
+    localIdx = idx;
+    if (idx < end && GetASNTag(source, &localIdx, &tag, end) == 0 &&
+                     tag == (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 0)) {
+        idx = localIdx;
+        if (GetLength(source, &idx, &len, end) < 0 ||
+                GetSequence(source, &idx, &len, end) < 0)
+            return ASN_PARSE_E;
+        localIdx = idx;
+        if (GetSequence(source, &localIdx, &len, end) < 0)
+            return ASN_PARSE_E;
+    #ifndef WOLFSSL_NO_OCSP_OPTIONAL_CERTS
+        cert   = source + idx;
+        certSz = localIdx + len - idx;
+    #endif
+    }
+
+    *ioIndex = end;
+
+    if (noVerify)
+        return 0;
+
+    return VerifyOcspSignature(resp, cert, certSz, cm);
+}
+
+
+/* initialize response to decode source, nothing allocated */
+void InitOcspResponse(OcspResponse* resp, const byte* source, word32 inSz,
+                      void* heap)
+{
+    WOLFSSL_ENTER("InitOcspResponse");
+
+    XMEMSET(resp, 0, sizeof(OcspResponse));
+    resp->responseStatus = -1;
+    resp->source = source;
+    resp->maxIdx = inSz;
+    resp->heap   = heap;
+}
+
+
+/* free the single responses of a decoded response */
+void FreeOcspResponse(OcspResponse* resp)
+{
+    OcspEntry* single;
+    OcspEntry* next;
+
+    WOLFSSL_ENTER("FreeOcspResponse");
+
+    for (single = resp->single; single != NULL; single = next) {
+        next = single->next;
+        XFREE(single->status, resp->heap, DYNAMIC_TYPE_OCSP_STATUS);
+        XFREE(single, resp->heap, DYNAMIC_TYPE_OCSP_ENTRY);
+    }
+    resp->single = NULL;
+}
+
+
+/* Decode an OCSPResponse and verify the signature of a successful one with
+ * the CAs in the certificate manager, 0 on success.
+ * responseStatus must be checked by the caller. */
+int OcspResponseDecode(OcspResponse* resp, void* cm, int noVerify)
+{
+    const byte* source = resp->source;
+    word32      size = resp->maxIdx;
+    word32      idx = 0;
+    word32      oid;
+    int         len;
+    byte        tag;
+
+    WOLFSSL_ENTER("OcspResponseDecode");
+
+    /* OCSPResponse */
+    if (GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+    size = idx + len;
+
+    /* responseStatus */
+    if (GetASNHeader(source, ASN_ENUMERATED, &idx, &len, size) < 0 ||
+                                                                   len != 1)
+        return ASN_PARSE_E;
+    resp->responseStatus = source[idx++];
+    if (resp->responseStatus != OCSP_SUCCESSFUL)
+        return 0;
+
+    /* responseBytes [0] EXPLICIT */
+    if (GetASNTag(source, &idx, &tag, size) < 0 ||
+                     tag != (ASN_CONTEXT_SPECIFIC | ASN_CONSTRUCTED | 0))
+        return ASN_PARSE_E;
+    if (GetLength(source, &idx, &len, size) < 0 ||
+            GetSequence(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+
+    /* responseType */
+    if (GetObjectId(source, &idx, &oid, oidOcspType, size) < 0)
+        return ASN_PARSE_E;
+    if (oid != OCSP_BASIC_OID)
+        return ASN_PARSE_E;
+
+    /* response */
+    if (GetOctetString(source, &idx, &len, size) < 0)
+        return ASN_PARSE_E;
+
+    return DecodeBasicOcspResponse(resp, &idx, idx + len, cm, noVerify);
+}
+
+
+/* initialize request for cert, issuer hashes set by ParseCertRelative */
+int InitOcspRequest(OcspRequest* req, DecodedCert* cert, byte useNonce,
+                    void* heap)
+{
+    int ret = 0;
+
+    WOLFSSL_ENTER("InitOcspRequest");
+
+    if (req == NULL)
+        return BAD_FUNC_ARG;
+
+    XMEMSET(req, 0, sizeof(OcspRequest));
+    req->heap = heap;
+
+    if (cert != NULL) {
+        const byte* serial = cert->serial;
+        int         serialSz = cert->serialSz;
+
+    #ifdef WOLFSSL_LAZY_CERT_DECODE
+        /* responder URL is in the AIA extension */
+        ret = DecodeCertDeferred(cert, AUTH_INFO_OID);
+        if (ret != 0)
+            return ret;
+    #endif
+        XMEMCPY(req->issuerHash, cert->issuerHash, KEYID_SIZE);
+        XMEMCPY(req->issuerKeyHash, cert->issuerKeyHash, KEYID_SIZE);
+
+        /* leading zero removed, as in the responses */
+        if (serialSz > 1 && serial[0] == 0x00) {
+            serial++;
+            serialSz--;
+        }
+        if (serialSz <= 0)
+            return ASN_PARSE_E;
+        req->serial = (byte*)XMALLOC(serialSz, heap,
+                                     DYNAMIC_TYPE_OCSP_REQUEST);
+        if (req->serial == NULL)
+            return MEMORY_E;
+        XMEMCPY(req->serial, serial, serialSz);
+        req->serialSz = serialSz;
+
+        if (cert->extAuthInfoSz != 0 && cert->extAuthInfo != NULL) {
+            req->url = (byte*)XMALLOC(cert->extAuthInfoSz + 1, heap,
+                                      DYNAMIC_TYPE_OCSP_REQUEST);
+            if (req->url == NULL) {
+                XFREE(req->serial, heap, DYNAMIC_TYPE_OCSP_REQUEST);
+                req->serial = NULL;
+                return MEMORY_E;
+            }
+            XMEMCPY(req->url, cert->extAuthInfo, cert->extAuthInfoSz);
+            req->urlSz = cert->extAuthInfoSz;
+            req->url[req->urlSz] = 0;
+        }
+    }
+
+    if (useNonce) {
+    #ifdef WOLFSSL_SMALL_STACK
+        WC_RNG* rng;
+    #else
+        WC_RNG  rng[1];
+    #endif
+
+    #ifdef WOLFSSL_SMALL_STACK
+        rng = (WC_RNG*)XMALLOC(sizeof(WC_RNG), heap, DYNAMIC_TYPE_RNG);
+        if (rng == NULL)
+            ret = MEMORY_E;
+        else
+    #endif
+        if (wc_InitRng_ex(rng, heap, INVALID_DEVID) != 0) {
+            WOLFSSL_MSG("\tCannot initialize RNG. Skipping the OCSP Nonce.");
+        }
+        else {
+            if (wc_RNG_GenerateBlock(rng, req->nonce, MAX_OCSP_NONCE_SZ) != 0)
+                WOLFSSL_MSG("\tCannot run RNG. Skipping the OCSP Nonce.");
+            else
+                req->nonceSz = MAX_OCSP_NONCE_SZ;
+
+            wc_FreeRng(rng);
+        }
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(rng, heap, DYNAMIC_TYPE_RNG);
+    #endif
+    }
+
+    return ret;
+}
+
+
+void FreeOcspRequest(OcspRequest* req)
+{
+    WOLFSSL_ENTER("FreeOcspRequest");
+
+    if (req) {
+        XFREE(req->serial, req->heap, DYNAMIC_TYPE_OCSP_REQUEST);
+        req->serial = NULL;
+        XFREE(req->url, req->heap, DYNAMIC_TYPE_OCSP_REQUEST);
+        req->url = NULL;
+    }
+}
+
+
+/* Encode the request Extensions with the nonce, size only when output is
+ * NULL. Also sent in the status_request TLS extension.
+ * SEQUENCE { SEQUENCE { nonce OID, OCTET STRING { OCTET STRING nonce } } } */
+word32 EncodeOcspRequestExtensions(OcspRequest* req, byte* output,
+                                   word32 size)
+{
+    word32 valSz, extSz, totalSz;
+    word32 idx = 0;
+
+    WOLFSSL_ENTER("EncodeOcspRequestExtensions");
+
+    if (req == NULL || req->nonceSz <= 0)
+        return 0;
+
+    valSz   = SetOctetString(req->nonceSz, NULL) + req->nonceSz;
+    extSz   = SetObjectId(sizeof(ocspNonceOid), NULL) + sizeof(ocspNonceOid) +
+              SetOctetString(valSz, NULL) + valSz;
+    totalSz = SetSequence(extSz, NULL) + extSz;
+
+    if (output == NULL)
+        return SetSequence(totalSz, NULL) + totalSz;
+    if (SetSequence(totalSz, NULL) + totalSz > size)
+        return 0;
+
+    idx += SetSequence(totalSz, output + idx);
+    idx += SetSequence(extSz, output + idx);
+    idx += SetObjectId(sizeof(ocspNonceOid), output + idx);
+    XMEMCPY(output + idx, ocspNonceOid, sizeof(ocspNonceOid));
+    idx += sizeof(ocspNonceOid);
+    idx += SetOctetString(valSz, output + idx);
+    idx += SetOctetString(req->nonceSz, output + idx);
+    XMEMCPY(output + idx, req->nonce, req->nonceSz);
+    idx += req->nonceSz;
+
+    return idx;
+}
+
+
+/* Encode an OCSPRequest for the single certificate with a SHA-1 CertID.
+ * Returns the encoded size, only calculated when output is NULL, or a
+ * negative error */
+int EncodeOcspRequest(OcspRequest* req, byte* output, word32 size)
+{
+    byte   algoArray[MAX_ALGO_SZ];
+    word32 algoSz, certIdSz, reqSz, listSz, extSz, tbsSz, totalSz;
+    word32 idx = 0;
+
+    WOLFSSL_ENTER("EncodeOcspRequest");
+
+    if (req == NULL || req->serial == NULL || req->serialSz <= 0)
+        return BAD_FUNC_ARG;
+
+    algoSz = SetAlgoID(SHAh, algoArray, oidHashType, 0);
+    if (algoSz == 0)
+        return ASN_PARSE_E;
+
+    /* sizes of the contents of each SEQUENCE, innermost first */
+    certIdSz = algoSz +
+               SetOctetString(OCSP_DIGEST_SIZE, NULL) + OCSP_DIGEST_SIZE +
+               SetOctetString(OCSP_DIGEST_SIZE, NULL) + OCSP_DIGEST_SIZE +
+               SetASNInt(req->serialSz, req->serial[0], NULL) +
+               req->serialSz;
+    reqSz   = SetSequence(certIdSz, NULL) + certIdSz;
+    listSz  = SetSequence(reqSz, NULL) + reqSz;
+    /* requestExtensions [2] EXPLICIT - optional */
+    extSz   = EncodeOcspRequestExtensions(req, NULL, 0);
+    tbsSz   = SetSequence(listSz, NULL) + listSz;
+    if (extSz)
+        tbsSz += SetExplicit(2, extSz, NULL) + extSz;
+    totalSz = SetSequence(tbsSz, NULL) + tbsSz;
+
+    if (output == NULL)
+        return (int)(SetSequence(totalSz, NULL) + totalSz);
+    if (SetSequence(totalSz, NULL) + totalSz > size)
+        return BUFFER_E;
+
+    /* OCSPRequest, TBSRequest, requestList, Request, CertID */
+    idx += SetSequence(totalSz, output + idx);
+    idx += SetSequence(tbsSz, output + idx);
+    idx += SetSequence(listSz, output + idx);
+    idx += SetSequence(reqSz, output + idx);
+    idx += SetSequence(certIdSz, output + idx);
+    XMEMCPY(output + idx, algoArray, algoSz);
+    idx += algoSz;
+    idx += SetOctetString(OCSP_DIGEST_SIZE, output + idx);
+    XMEMCPY(output + idx, req->issuerHash, OCSP_DIGEST_SIZE);
+    idx += OCSP_DIGEST_SIZE;
+    idx += SetOctetString(OCSP_DIGEST_SIZE, output + idx);
+    XMEMCPY(output + idx, req->issuerKeyHash, OCSP_DIGEST_SIZE);
+    idx += OCSP_DIGEST_SIZE;
+    idx += SetASNInt(req->serialSz, req->serial[0], output + idx);
+    XMEMCPY(output + idx, req->serial, req->serialSz);
+    idx += req->serialSz;
+
+    if (extSz) {
+        idx += SetExplicit(2, extSz, output + idx);
+        idx += EncodeOcspRequestExtensions(req, output + idx, extSz);
+    }
+
+    return (int)idx;
+}
+
+
+/* Find the single response for the request and move it to the front.
+ * 0 when the response answers the request. */
+int CompareOcspReqResp(OcspRequest* req, OcspResponse* resp)
+{
+    OcspEntry* single;
+    OcspEntry* prev = NULL;
+
+    WOLFSSL_ENTER("CompareOcspReqResp");
+
+    if (req == NULL || resp == NULL)
+        return BAD_FUNC_ARG;
+
+    /* Nonces are not critical, the responder may leave it out. A response
+     * with a different nonce is a replay though. */
+    if (req->nonceSz != 0 && resp->nonce != NULL &&
+            (req->nonceSz != resp->nonceSz ||
+             XMEMCMP(req->nonce, resp->nonce, req->nonceSz) != 0)) {
+        WOLFSSL_MSG("\tnonce mismatch");
+        return 1;
+    }
+#ifdef WOLFSSL_FORCE_OCSP_NONCE_CHECK
+    if (req->nonceSz != 0 && resp->nonce == NULL) {
+        WOLFSSL_MSG("\tnonce missing from response");
+        return 1;
+    }
+#endif
+
+    for (single = resp->single; single != NULL; single = single->next) {
+        if (single->hashAlgoOID == SHAh &&
+                single->status->serialSz == req->serialSz &&
+                XMEMCMP(single->status->serial, req->serial,
+                        req->serialSz) == 0 &&
+                XMEMCMP(single->issuerHash, req->issuerHash,
+                        OCSP_DIGEST_SIZE) == 0 &&
+                XMEMCMP(single->issuerKeyHash, req->issuerKeyHash,
+                        OCSP_DIGEST_SIZE) == 0) {
+            break;
+        }
+        prev = single;
+    }
+
+    if (single == NULL) {
+        WOLFSSL_MSG("\tresponse and request don't match");
+        return 1;
+    }
+
+    if (prev != NULL) {
+        prev->next   = single->next;
+        single->next = resp->single;
+        resp->single = single;
+    }
+
+    return 0;
+}
+
+#endif /* HAVE_OCSP */
 
 
 
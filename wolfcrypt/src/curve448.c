@@ -31,4 +31,619 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#ifdef HAVE_CURVE448
 
+#include <wolfssl/wolfcrypt/curve448.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+/* The base point - u = 5. */
+static const unsigned char kCurve448BasePoint[CURVE448_PUB_KEY_SIZE] = {5};
+
+/* Clamp the private key as specified for X448 in RFC 7748. */
+static WC_INLINE void curve448_priv_clamp(byte* priv)
+{
+    priv[0] &= 0xfc;
+    priv[CURVE448_KEY_SIZE-1] |= 0x80;
+}
+
+static WC_INLINE void curve448_copy_point(byte* out, const byte* point,
+                                          int endian)
+{
+    if (endian == EC448_BIG_ENDIAN) {
+        int i;
+        /* put value in Big Endian format */
+        for (i = 0; i < CURVE448_KEY_SIZE; i++) {
+            out[i] = point[CURVE448_KEY_SIZE - i - 1];
+        }
+    }
+    else { /* put value in Little Endian format */
+        XMEMCPY(out, point, CURVE448_KEY_SIZE);
+    }
+}
+
+/* Make a new curve448 public key from the private key.
+ *
+ * public_size   [in]   Size of public key buffer in bytes.
+ * pub           [out]  Public key as little-endian array.
+ * private_size  [in]   Size of private key in bytes.
+ * priv          [in]   Private key as little-endian array.
+ * returns ECC_BAD_ARG_E when a size or pointer is invalid and
+ *         0 otherwise.
+ */
+int wc_curve448_make_pub(int public_size, byte* pub, int private_size,
+                         const byte* priv)
+{
+    if ((public_size != CURVE448_PUB_KEY_SIZE) ||
+        (private_size != CURVE448_KEY_SIZE)) {
+        return ECC_BAD_ARG_E;
+    }
+    if ((pub == NULL) || (priv == NULL)) {
+        return ECC_BAD_ARG_E;
+    }
+
+    fe448_init();
+
+    return curve448(pub, priv, kCurve448BasePoint);
+}
+
+/* Make a new curve448 private/public key.
+ *
+ * rng      [in]  Random number generator.
+ * keysize  [in]  Size of the key to generate - must be 56.
+ * key      [in]  Curve448 key object.
+ * returns BAD_FUNC_ARG when rng or key are NULL,
+ *         ECC_BAD_ARG_E when keysize is not CURVE448_KEY_SIZE,
+ *         other -ve value on random or scalar multiplication failure and
+ *         0 otherwise.
+ */
+int wc_curve448_make_key(WC_RNG* rng, int keysize, curve448_key* key)
+{
+    int ret;
+
+    if ((key == NULL) || (rng == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* currently only a key size of 56 bytes is used */
+    if (keysize != CURVE448_KEY_SIZE) {
+        return ECC_BAD_ARG_E;
+    }
+
+    /* random number for private key */
+    ret = wc_RNG_GenerateBlock(rng, key->k, (word32)keysize);
+    if (ret == 0) {
+        key->privSet = 1;
+        curve448_priv_clamp(key->k);
+        ret = wc_curve448_make_pub((int)sizeof(key->p), key->p,
+                                   (int)sizeof(key->k), key->k);
+        key->pubSet = (ret == 0);
+    }
+
+    return ret;
+}
+
+#ifdef HAVE_CURVE448_SHARED_SECRET
+
+/* Calculate the shared secret from the private key and peer's public key.
+ * Calculation over curve448.
+ * Secret encoded big-endian.
+ *
+ * private_key  [in]      Curve448 private key.
+ * public_key   [in]      Curve448 public key.
+ * out          [in]      Array to hold shared secret.
+ * outLen       [in/out]  On in, the number of bytes in array.
+ *                        On out, the number bytes put into array.
+ * returns BAD_FUNC_ARG when a parameter is NULL or outLen is less than
+ *         CURVE448_KEY_SIZE,
+ *         ECC_BAD_ARG_E when a key is not set and
+ *         0 otherwise.
+ */
+int wc_curve448_shared_secret(curve448_key* private_key,
+                              curve448_key* public_key,
+                              byte* out, word32* outLen)
+{
+    return wc_curve448_shared_secret_ex(private_key, public_key, out, outLen,
+                                        EC448_BIG_ENDIAN);
+}
+
+/* Calculate the shared secret from the private key and peer's public key.
+ * Calculation over curve448.
+ *
+ * private_key  [in]      Curve448 private key.
+ * public_key   [in]      Curve448 public key.
+ * out          [in]      Array to hold shared secret.
+ * outLen       [in/out]  On in, the number of bytes in array.
+ *                        On out, the number bytes put into array.
+ * endian       [in]      Endianness to use when encoding number in array.
+ * returns BAD_FUNC_ARG when a parameter is NULL or outLen is less than
+ *         CURVE448_KEY_SIZE,
+ *         ECC_BAD_ARG_E when a key is not set and
+ *         0 otherwise.
+ */
+int wc_curve448_shared_secret_ex(curve448_key* private_key,
+                                 curve448_key* public_key,
+                                 byte* out, word32* outLen, int endian)
+{
+    byte o[CURVE448_PUB_KEY_SIZE];
+    int ret;
+
+    /* sanity check */
+    if ((private_key == NULL) || (public_key == NULL) || (out == NULL) ||
+            (outLen == NULL) || (*outLen < CURVE448_KEY_SIZE)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* make sure we have a populated private and public key */
+    if (!public_key->pubSet || !private_key->privSet) {
+        return ECC_BAD_ARG_E;
+    }
+
+    fe448_init();
+
+    ret = curve448(o, private_key->k, public_key->p);
+#ifdef WOLFSSL_ECDHX_SHARED_NOT_ZERO
+    if (ret == 0) {
+        int i;
+        byte t = 0;
+        for (i = 0; i < CURVE448_PUB_KEY_SIZE; i++) {
+            t |= o[i];
+        }
+        if (t == 0) {
+            ret = ECC_OUT_OF_RANGE_E;
+        }
+    }
+#endif
+    if (ret == 0) {
+        curve448_copy_point(out, o, endian);
+        *outLen = CURVE448_KEY_SIZE;
+    }
+
+    ForceZero(o, sizeof(o));
+
+    return ret;
+}
+
+#endif /* HAVE_CURVE448_SHARED_SECRET */
+
+#ifdef HAVE_CURVE448_KEY_EXPORT
+
+/* Export the curve448 public key.
+ * Public key encoded big-endian.
+ *
+ * key     [in]      Curve448 public key.
+ * out     [in]      Array to hold public key.
+ * outLen  [in/out]  On in, the number of bytes in array.
+ *                   On out, the number bytes put into array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when outLen is less than CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_public(curve448_key* key, byte* out, word32* outLen)
+{
+    return wc_curve448_export_public_ex(key, out, outLen, EC448_BIG_ENDIAN);
+}
+
+/* Export the curve448 public key.
+ *
+ * key     [in]      Curve448 public key.
+ * out     [in]      Array to hold public key.
+ * outLen  [in/out]  On in, the number of bytes in array.
+ *                   On out, the number bytes put into array.
+ * endian  [in]      Endianness to use when encoding number in array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when outLen is less than CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_public_ex(curve448_key* key, byte* out, word32* outLen,
+                                 int endian)
+{
+    int ret = 0;
+
+    if ((key == NULL) || (out == NULL) || (outLen == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* check and set outgoing key size */
+    if (*outLen < CURVE448_PUB_KEY_SIZE) {
+        *outLen = CURVE448_PUB_KEY_SIZE;
+        return ECC_BAD_ARG_E;
+    }
+
+    /* calculate public if missing */
+    if (!key->pubSet) {
+        ret = wc_curve448_make_pub((int)sizeof(key->p), key->p,
+                                   (int)sizeof(key->k), key->k);
+        key->pubSet = (ret == 0);
+    }
+    if (ret == 0) {
+        curve448_copy_point(out, key->p, endian);
+        *outLen = CURVE448_PUB_KEY_SIZE;
+    }
+
+    return ret;
+}
+
+#endif /* HAVE_CURVE448_KEY_EXPORT */
+
+#ifdef HAVE_CURVE448_KEY_IMPORT
+
+/* Import a curve448 public key from a byte array.
+ * Public key encoded in big-endian.
+ *
+ * in      [in]  Array holding public key.
+ * inLen   [in]  Number of bytes of data in array.
+ * key     [in]  Curve448 public key.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when inLen is not CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_public(const byte* in, word32 inLen,
+                              curve448_key* key)
+{
+    return wc_curve448_import_public_ex(in, inLen, key, EC448_BIG_ENDIAN);
+}
+
+/* Import a curve448 public key from a byte array.
+ *
+ * in      [in]  Array holding public key.
+ * inLen   [in]  Number of bytes of data in array.
+ * key     [in]  Curve448 public key.
+ * endian  [in]  Endianness of encoded number in byte array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when inLen is not CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_public_ex(const byte* in, word32 inLen,
+                                 curve448_key* key, int endian)
+{
+    /* sanity check */
+    if ((key == NULL) || (in == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* check size of incoming keys */
+    if (inLen != CURVE448_PUB_KEY_SIZE) {
+       return ECC_BAD_ARG_E;
+    }
+
+    curve448_copy_point(key->p, in, endian);
+    key->pubSet = 1;
+
+    return 0;
+}
+
+/* Check the public key value (big or little endian)
+ *
+ * pub     [in]  Public key bytes.
+ * pubSz   [in]  Size of public key in bytes.
+ * endian  [in]  Public key bytes passed in as big-endian or little-endian.
+ * returns BAD_FUNC_ARG when pub is NULL,
+ *         BUFFER_E when size of public key is zero,
+ *         ECC_BAD_ARG_E if key size is not 56 bytes or public key value is
+ *         zero or one and
+ *         0 otherwise.
+ */
+int wc_curve448_check_public(const byte* pub, word32 pubSz, int endian)
+{
+    word32 i;
+
+    if (pub == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* Check for empty key data */
+    if (pubSz == 0) {
+        return BUFFER_E;
+    }
+
+    /* Check key length */
+    if (pubSz != CURVE448_PUB_KEY_SIZE) {
+        return ECC_BAD_ARG_E;
+    }
+
+    if (endian == EC448_LITTLE_ENDIAN) {
+        /* Check for value of zero or one */
+        for (i = pubSz - 1; i > 0; i--) {
+            if (pub[i] != 0) {
+                break;
+            }
+        }
+        if ((i == 0) && (pub[0] == 0 || pub[0] == 1)) {
+            return ECC_BAD_ARG_E;
+        }
+    }
+    else {
+        /* Check for value of zero or one */
+        for (i = 0; i < pubSz - 1; i++) {
+            if (pub[i] != 0) {
+                break;
+            }
+        }
+        if ((i == pubSz - 1) && (pub[i] == 0 || pub[i] == 1)) {
+            return ECC_BAD_ARG_E;
+        }
+    }
+
+    return 0;
+}
+
+#endif /* HAVE_CURVE448_KEY_IMPORT */
+
+#ifdef HAVE_CURVE448_KEY_EXPORT
+
+/* Export the curve448 private key raw form.
+ * Private key encoded big-endian.
+ *
+ * key     [in]      Curve448 private key.
+ * out     [in]      Array to hold private key.
+ * outLen  [in/out]  On in, the number of bytes in array.
+ *                   On out, the number bytes put into array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when outLen is less than CURVE448_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_private_raw(curve448_key* key, byte* out,
+                                   word32* outLen)
+{
+    return wc_curve448_export_private_raw_ex(key, out, outLen,
+                                             EC448_BIG_ENDIAN);
+}
+
+/* Export the curve448 private key raw form.
+ *
+ * key     [in]      Curve448 private key.
+ * out     [in]      Array to hold private key.
+ * outLen  [in/out]  On in, the number of bytes in array.
+ *                   On out, the number bytes put into array.
+ * endian  [in]      Endianness to use when encoding number in array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when outLen is less than CURVE448_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_private_raw_ex(curve448_key* key, byte* out,
+                                      word32* outLen, int endian)
+{
+    /* sanity check */
+    if ((key == NULL) || (out == NULL) || (outLen == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* check size of outgoing buffer */
+    if (*outLen < CURVE448_KEY_SIZE) {
+        *outLen = CURVE448_KEY_SIZE;
+        return ECC_BAD_ARG_E;
+    }
+
+    curve448_copy_point(out, key->k, endian);
+    *outLen = CURVE448_KEY_SIZE;
+
+    return 0;
+}
+
+/* Export the curve448 private and public keys in raw form.
+ * Private and public key encoded big-endian.
+ *
+ * key     [in]      Curve448 private key.
+ * priv    [in]      Array to hold private key.
+ * privSz  [in/out]  On in, the number of bytes in private key array.
+ *                   On out, the number bytes put into private key array.
+ * pub     [in]      Array to hold public key.
+ * pubSz   [in/out]  On in, the number of bytes in public key array.
+ *                   On out, the number bytes put into public key array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is less than CURVE448_KEY_SIZE or pubSz is
+ *         less than CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_key_raw(curve448_key* key, byte* priv, word32 *privSz,
+                               byte* pub, word32 *pubSz)
+{
+    return wc_curve448_export_key_raw_ex(key, priv, privSz, pub, pubSz,
+                                         EC448_BIG_ENDIAN);
+}
+
+/* Export the curve448 private and public keys in raw form.
+ *
+ * key     [in]      Curve448 private key.
+ * priv    [in]      Array to hold private key.
+ * privSz  [in/out]  On in, the number of bytes in private key array.
+ *                   On out, the number bytes put into private key array.
+ * pub     [in]      Array to hold public key.
+ * pubSz   [in/out]  On in, the number of bytes in public key array.
+ *                   On out, the number bytes put into public key array.
+ * endian  [in]      Endianness to use when encoding number in array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is less than CURVE448_KEY_SIZE or pubSz is
+ *         less than CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_export_key_raw_ex(curve448_key* key, byte* priv, word32 *privSz,
+                                  byte* pub, word32 *pubSz, int endian)
+{
+    int ret;
+
+    /* export private part */
+    ret = wc_curve448_export_private_raw_ex(key, priv, privSz, endian);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* export public part */
+    return wc_curve448_export_public_ex(key, pub, pubSz, endian);
+}
+
+#endif /* HAVE_CURVE448_KEY_EXPORT */
+
+#ifdef HAVE_CURVE448_KEY_IMPORT
+
+/* Import curve448 private and public keys from a byte arrays.
+ * Private and public keys encoded in big-endian.
+ *
+ * priv    [in]  Array holding private key.
+ * privSz  [in]  Number of bytes of data in private key array.
+ * pub     [in]  Array holding public key.
+ * pubSz   [in]  Number of bytes of data in public key array.
+ * key     [in]  Curve448 private/public key.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is not CURVE448_KEY_SIZE or pubSz is not
+ *         CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_private_raw(const byte* priv, word32 privSz,
+                                   const byte* pub, word32 pubSz,
+                                   curve448_key* key)
+{
+    return wc_curve448_import_private_raw_ex(priv, privSz, pub, pubSz, key,
+                                             EC448_BIG_ENDIAN);
+}
+
+/* Import curve448 private and public keys from a byte arrays.
+ *
+ * priv    [in]  Array holding private key.
+ * privSz  [in]  Number of bytes of data in private key array.
+ * pub     [in]  Array holding public key.
+ * pubSz   [in]  Number of bytes of data in public key array.
+ * key     [in]  Curve448 private/public key.
+ * endian  [in]  Endianness of encoded numbers in byte arrays.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is not CURVE448_KEY_SIZE or pubSz is not
+ *         CURVE448_PUB_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_private_raw_ex(const byte* priv, word32 privSz,
+                                      const byte* pub, word32 pubSz,
+                                      curve448_key* key, int endian)
+{
+    int ret;
+
+    /* import private part */
+    ret = wc_curve448_import_private_ex(priv, privSz, key, endian);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* import public part */
+    return wc_curve448_import_public_ex(pub, pubSz, key, endian);
+}
+
+/* Import curve448 private key from a byte array.
+ * Private key encoded in big-endian.
+ *
+ * priv    [in]  Array holding private key.
+ * privSz  [in]  Number of bytes of data in private key array.
+ * key     [in]  Curve448 private/public key.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is not CURVE448_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_private(const byte* priv, word32 privSz,
+                               curve448_key* key)
+{
+    return wc_curve448_import_private_ex(priv, privSz, key, EC448_BIG_ENDIAN);
+}
+
+/* Import curve448 private key from a byte array.
+ *
+ * priv    [in]  Array holding private key.
+ * privSz  [in]  Number of bytes of data in private key array.
+ * key     [in]  Curve448 private/public key.
+ * endian  [in]  Endianness of encoded number in byte array.
+ * returns BAD_FUNC_ARG when a parameter is NULL,
+ *         ECC_BAD_ARG_E when privSz is not CURVE448_KEY_SIZE and
+ *         0 otherwise.
+ */
+int wc_curve448_import_private_ex(const byte* priv, word32 privSz,
+                                  curve448_key* key, int endian)
+{
+    /* sanity check */
+    if ((key == NULL) || (priv == NULL)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* check size of incoming keys */
+    if ((int)privSz != CURVE448_KEY_SIZE) {
+        return ECC_BAD_ARG_E;
+    }
+
+    curve448_copy_point(key->k, priv, endian);
+    key->privSet = 1;
+
+    /* Clamp the key */
+    curve448_priv_clamp(key->k);
+
+    return 0;
+}
+
+#endif /* HAVE_CURVE448_KEY_IMPORT */
+
+
+/* Initialize the curve448 key.
+ *
+ * key    [in]  Curve448 key object.
+ * heap   [in]  Heap hint.
+ * devId  [in]  Device identifier - unused.
+ * returns BAD_FUNC_ARG when key is NULL and 0 otherwise.
+ */
+int wc_curve448_init_ex(curve448_key* key, void* heap, int devId)
+{
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    XMEMSET(key, 0, sizeof(*key));
+    key->heap = heap;
+    (void)devId;
+
+    fe448_init();
+
+    return 0;
+}
+
+/* Initialize the curve448 key.
+ *
+ * key  [in]  Curve448 key object.
+ * returns BAD_FUNC_ARG when key is NULL and 0 otherwise.
+ */
+int wc_curve448_init(curve448_key* key)
+{
+    return wc_curve448_init_ex(key, NULL, INVALID_DEVID);
+}
+
+/* Clears the curve448 key data
+ *
+ * key  [in]  Curve448 key object.
+ */
+void wc_curve448_free(curve448_key* key)
+{
+    if (key != NULL) {
+        ForceZero(key->k, sizeof(key->k));
+        XMEMSET(key->p, 0, sizeof(key->p));
+        key->pubSet = 0;
+        key->privSet = 0;
+    }
+}
+
+
+/* Get the curve448 key's size.
+ *
+ * key  [in]  Curve448 key object.
+ * returns 0 if key is NULL and CURVE448_KEY_SIZE otherwise.
+ */
+int wc_curve448_size(curve448_key* key)
+{
+    int ret = 0;
+
+    if (key != NULL) {
+        ret = CURVE448_KEY_SIZE;
+    }
+
+    return ret;
+}
+
+#endif /* HAVE_CURVE448 */
@@ -51,20 +51,26 @@ Possible ECC enable options:
  * ECC_DUMP_OID:        Enables dump of OID encoding and sum    default: off
  * ECC_CACHE_CURVE:     Enables cache of curve info to improve performance
  *                                                              default: off
- * FP_ECC:              ECC Fixed Point Cache                   default: off
- *                      FP cache is not supported for SECP160R1, SECP160R2,
- *                      SECP160K1 and SECP224K1. These do not work with scalars
- *                      that are the length of the order when the order is
- *                      longer than the prime.
+ * NO_ECC_FIXED_BASE:   Disables the static comb tables of the NIST base
+ *                      points (ecc_comb.i) used by key generation, signing
+ *                      and verify tables                       default: off
  * USE_ECC_B_PARAM:     Enable ECC curve B param                default: off
  *                      (on for HAVE_COMP_KEY)
  * WOLFSSL_ECC_CURVE_STATIC:                                    default off (on for windows)
  *                      For the ECC curve paramaters `ecc_set_type` use fixed
  *                      array for hex string
- * WC_ECC_NONBLOCK:     Enable non-blocking support for sign/verify.
- *                      Requires SP with WOLFSSL_SP_NONBLOCK
+ * WC_ECC_NONBLOCK:     Enable non-blocking support for key generation,
+ *                      shared secret and verify. With a context set by
+ *                      wc_ecc_set_nonblock() the operations return
+ *                      FP_WOULDBLOCK until complete, doing at most maxSteps
+ *                      ladder steps per call.
  * WC_ECC_NONBLOCK_ONLY Enable the non-blocking function only, no fall-back to
  *                      normal blocking API's
+ * NO_ECC_VERIFY_TABLE: Disables per-key verify tables built with
+ *                      wc_ecc_make_verify_table()              default: off
+ * NO_ECC_PRESIGN:      Disables the per-key pool of precomputed ECDSA
+ *                      nonces set up with wc_ecc_presign_init()
+ *                                                              default: off
  * WOLFSSL_ECDSA_SET_K: Enables the setting of the 'k' value to use during ECDSA
  *                      signing. If the value is invalid, a new random 'k' is
  *                      generated in the loop. (For testing)
@@ -124,6 +130,11 @@ ECC Curve Sizes:
 
 /* Make sure custom curves is enabled for Brainpool or Koblitz curve types */
 
+#if defined(WC_ECC_NONBLOCK) && \
+    (defined(FREESCALE_LTC_ECC) || defined(WOLFSSL_STM32_PKA))
+    #error ECC non-blocking requires the software point multiplication
+#endif
+
 
 /* public ASN interface */
 #include <wolfssl/wolfcrypt/asn_public.h>
@@ -144,6 +155,10 @@ ECC Curve Sizes:
     #include <wolfssl/wolfcrypt/hash.h>
 #endif
 
+#ifdef WOLFSSL_HAVE_SP_ECC
+    #include <wolfssl/wolfcrypt/sp.h>
+#endif
+
 
     #define WOLFSSL_MISC_INCLUDED
     #include <wolfcrypt/src/misc.c>
@@ -841,7 +856,7 @@ typedef struct ecc_curve_spec {
     mp_int Gx_lcl;
     mp_int Gy_lcl;
 #else
-    mp_int* spec_ints;
+    byte*  spec_ints;
     word32 spec_count;
     word32 spec_use;
 #endif
@@ -877,12 +892,16 @@ enum ecc_curve_load_mask {
     #define ALLOC_CURVE_SPECS(intcount, err)
     #define FREE_CURVE_SPECS()
 #else
+    /* Curve parameters are held in integers only big enough for the largest
+     * curve compiled in. */
+    #define ECC_SPEC_INT_SZ     MP_INT_SIZEOF_BITS(MAX_ECC_BITS)
     #define DECLARE_CURVE_SPECS(intcount) \
-        mp_int spec_ints[(intcount)]; \
+        mp_digit spec_ints[((intcount) * ECC_SPEC_INT_SZ + \
+                            sizeof(mp_digit) - 1) / sizeof(mp_digit)]; \
         ecc_curve_spec curve_lcl; \
         ecc_curve_spec* curve = &curve_lcl; \
         XMEMSET(curve, 0, sizeof(ecc_curve_spec)); \
-        curve->spec_ints = spec_ints; \
+        curve->spec_ints = (byte*)spec_ints; \
         curve->spec_count = (intcount)
     #define ALLOC_CURVE_SPECS(intcount, err)
     #define FREE_CURVE_SPECS()
@@ -944,10 +963,10 @@ static int wc_ecc_curve_cache_load_item(ecc_curve_spec* curve, const char* src,
         WOLFSSL_MSG("Invalid DECLARE_CURVE_SPECS count");
         return ECC_BAD_ARG_E;
     }
-    *dst = &curve->spec_ints[curve->spec_use++];
+    *dst = (mp_int*)(curve->spec_ints + curve->spec_use++ * ECC_SPEC_INT_SZ);
 #endif
 
-    err = mp_init(*dst);
+    err = INIT_MP_INT_SIZE(*dst, MAX_ECC_BITS);
     if (err == MP_OKAY) {
         curve->load_mask |= mask;
 
@@ -1169,7 +1188,8 @@ static int _ecc_projective_dbl_point(ecc_point *P, ecc_point *R, mp_int* a,
 static int _ecc_projective_add_point(ecc_point* P, ecc_point* Q, ecc_point* R,
                                      mp_int* a, mp_int* modulus, mp_digit mp)
 {
-   mp_int  t1[1], t2[1];
+   DECL_MP_INT_SIZE_DYN(t1, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(t2, mp_count_bits(modulus), MAX_ECC_BITS);
    mp_int  *x, *y, *z;
    int     err;
 
@@ -1181,7 +1201,10 @@ static int _ecc_projective_add_point(ecc_point* P, ecc_point* Q, ecc_point* R,
    }
 
 
-   if ((err = mp_init_multi(t1, t2, NULL, NULL, NULL, NULL)) != MP_OKAY) {
+   err = INIT_MP_INT_SIZE(t1, mp_count_bits(modulus));
+   if (err == MP_OKAY)
+      err = INIT_MP_INT_SIZE(t2, mp_count_bits(modulus));
+   if (err != MP_OKAY) {
       return err;
    }
 
@@ -1414,12 +1437,16 @@ int ecc_projective_add_point(ecc_point* P, ecc_point* Q, ecc_point* R,
 static int _ecc_projective_dbl_point(ecc_point *P, ecc_point *R, mp_int* a,
                                      mp_int* modulus, mp_digit mp)
 {
-   mp_int  t1[1], t2[1];
+   DECL_MP_INT_SIZE_DYN(t1, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(t2, mp_count_bits(modulus), MAX_ECC_BITS);
    mp_int *x, *y, *z;
    int    err;
 
 
-   if ((err = mp_init_multi(t1, t2, NULL, NULL, NULL, NULL)) != MP_OKAY) {
+   err = INIT_MP_INT_SIZE(t1, mp_count_bits(modulus));
+   if (err == MP_OKAY)
+      err = INIT_MP_INT_SIZE(t2, mp_count_bits(modulus));
+   if (err != MP_OKAY) {
       return err;
    }
 
@@ -1566,7 +1593,8 @@ int ecc_projective_dbl_point(ecc_point *P, ecc_point *R, mp_int* a,
 */
 int ecc_map_ex(ecc_point* P, mp_int* modulus, mp_digit mp, int ct)
 {
-   mp_int  t1[1], t2[1];
+   DECL_MP_INT_SIZE_DYN(t1, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(t2, mp_count_bits(modulus), MAX_ECC_BITS);
    mp_int *x, *y, *z;
    int    err;
 
@@ -1586,7 +1614,10 @@ int ecc_map_ex(ecc_point* P, mp_int* modulus, mp_digit mp, int ct)
    }
 
 
-   if ((err = mp_init_multi(t1, t2, NULL, NULL, NULL, NULL)) != MP_OKAY) {
+   err = INIT_MP_INT_SIZE(t1, mp_count_bits(modulus));
+   if (err == MP_OKAY)
+      err = INIT_MP_INT_SIZE(t2, mp_count_bits(modulus));
+   if (err != MP_OKAY) {
       return MEMORY_E;
    }
 
@@ -1601,7 +1632,7 @@ int ecc_map_ex(ecc_point* P, mp_int* modulus, mp_digit mp, int ct)
            /* first map z back to normal */
            err = mp_montgomery_reduce(z, modulus, mp);
            if (err == MP_OKAY)
-               err = mp_invmod(z, modulus, t1);
+               err = mp_invmod_ct(z, modulus, t1);
        }
    }
 
@@ -1634,6 +1665,160 @@ int ecc_map_ex(ecc_point* P, mp_int* modulus, mp_digit mp, int ct)
    mp_clear(t2);
 
 
+   return err;
+}
+
+/**
+  Map projective Jacobian points back to affine space with one inversion.
+  Montgomery's trick: the inverse of each z is recovered from the inverse of
+  the product of all of them at a cost of 3(n-1) multiplications.
+  P        [in/out] The points to map
+  n        Number of points
+  modulus  The modulus of the field the ECC curve is in
+  mp       The "b" value from montgomery_setup()
+  mont     Leave x and y in Montgomery form and set z to zero, the affine
+           form that point addition treats as a mixed addition
+  heap     Heap hint
+  return   MP_OKAY on success
+*/
+int ecc_map_batch(ecc_point** P, int n, mp_int* modulus, mp_digit mp,
+                  int mont, void* heap)
+{
+   byte*   c;
+   DECL_MP_INT_SIZE_DYN(inv, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(zi, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(t1, mp_count_bits(modulus), MAX_ECC_BITS);
+   DECL_MP_INT_SIZE_DYN(t2, mp_count_bits(modulus), MAX_ECC_BITS);
+   int     bits;
+   size_t  cSz;
+   int     err;
+   int     i, cnt = 0, used = 0;
+
+   if (P == NULL || n < 0 || modulus == NULL)
+       return ECC_BAD_ARG_E;
+   if (n == 0)
+       return MP_OKAY;
+
+   bits = mp_count_bits(modulus);
+   cSz = MP_INT_SIZEOF_BITS(bits);
+   (void)bits;
+
+   /* c[i] is the product of z over the first i+1 points, Montgomery form */
+   c = (byte*)XMALLOC(cSz * (size_t)n, heap, DYNAMIC_TYPE_ECC);
+   if (c == NULL)
+       return MEMORY_E;
+   #define ECC_MAP_C(i)     ((mp_int*)(c + cSz * (size_t)(i)))
+
+   err = INIT_MP_INT_SIZE(inv, bits);
+   if (err == MP_OKAY)
+       err = INIT_MP_INT_SIZE(zi, bits);
+   if (err == MP_OKAY)
+       err = INIT_MP_INT_SIZE(t1, bits);
+   if (err == MP_OKAY)
+       err = INIT_MP_INT_SIZE(t2, bits);
+   if (err == MP_OKAY) {
+       /* a product of no values is one */
+       err = mp_montgomery_calc_normalization(inv, modulus);
+   }
+   for (i = 0; (err == MP_OKAY) && (i < n); i++) {
+       err = INIT_MP_INT_SIZE(ECC_MAP_C(i), bits);
+       if (err != MP_OKAY)
+           break;
+       used++;
+
+       if (mp_iszero(P[i]->z)) {
+           /* point at infinity is left out of the product */
+           err = mp_copy(inv, ECC_MAP_C(i));
+           if (err == MP_OKAY)
+               err = mp_set(P[i]->x, 0);
+           if (err == MP_OKAY)
+               err = mp_set(P[i]->y, 0);
+           if (err == MP_OKAY)
+               err = mp_set(P[i]->z, 1);
+           continue;
+       }
+       err = mp_mul(inv, P[i]->z, ECC_MAP_C(i));
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(ECC_MAP_C(i), modulus, mp);
+       if (err == MP_OKAY)
+           err = mp_copy(ECC_MAP_C(i), inv);
+       cnt++;
+   }
+
+   /* invert the product: from zR take out R twice so that the inverse
+    * comes back in Montgomery form */
+   if ((err == MP_OKAY) && (cnt > 0)) {
+       err = mp_montgomery_reduce(inv, modulus, mp);
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(inv, modulus, mp);
+       if (err == MP_OKAY)
+           err = mp_invmod_ct(inv, modulus, t1);
+       if (err == MP_OKAY)
+           err = mp_copy(t1, inv);
+   }
+
+   for (i = n - 1; (err == MP_OKAY) && (cnt > 0) && (i >= 0); i--) {
+       if (mp_iszero(P[i]->x) && mp_iszero(P[i]->y) && mp_isone(P[i]->z))
+           continue;
+
+       /* 1/z[i] = (1/c[i]) * c[i-1], then drop z[i] from the inverse */
+       if (i > 0) {
+           err = mp_mul(inv, ECC_MAP_C(i - 1), zi);
+           if (err == MP_OKAY)
+               err = mp_montgomery_reduce(zi, modulus, mp);
+       }
+       else {
+           err = mp_copy(inv, zi);
+       }
+       if ((err == MP_OKAY) && (i > 0)) {
+           err = mp_mul(inv, P[i]->z, inv);
+           if (err == MP_OKAY)
+               err = mp_montgomery_reduce(inv, modulus, mp);
+       }
+
+       /* get 1/z^2 and 1/z^3 */
+       if (err == MP_OKAY)
+           err = mp_sqr(zi, t1);
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(t1, modulus, mp);
+       if (err == MP_OKAY)
+           err = mp_mul(t1, zi, t2);
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(t2, modulus, mp);
+       if ((err == MP_OKAY) && !mont) {
+           err = mp_montgomery_reduce(t1, modulus, mp);
+           if (err == MP_OKAY)
+               err = mp_montgomery_reduce(t2, modulus, mp);
+       }
+
+       /* multiply against x/y */
+       if (err == MP_OKAY)
+           err = mp_mul(P[i]->x, t1, P[i]->x);
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(P[i]->x, modulus, mp);
+       if (err == MP_OKAY)
+           err = mp_mul(P[i]->y, t2, P[i]->y);
+       if (err == MP_OKAY)
+           err = mp_montgomery_reduce(P[i]->y, modulus, mp);
+
+       if (err == MP_OKAY) {
+           if (mont)
+               mp_zero(P[i]->z);
+           else
+               err = mp_set(P[i]->z, 1);
+       }
+   }
+
+   /* clean up */
+   for (i = 0; i < used; i++)
+       mp_clear(ECC_MAP_C(i));
+   XFREE(c, heap, DYNAMIC_TYPE_ECC);
+   #undef ECC_MAP_C
+   mp_clear(inv);
+   mp_clear(zi);
+   mp_clear(t1);
+   mp_clear(t2);
+
    return err;
 }
 #endif /* !FREESCALE_LTC_ECC && !WOLFSSL_STM32_PKA */
@@ -1651,7 +1836,8 @@ int ecc_map(ecc_point* P, mp_int* modulus, mp_digit mp)
 #define M_POINTS 8
 
 static int ecc_mulmod(const mp_int* k, ecc_point* tG, ecc_point* R,
-    ecc_point** M, mp_int* a, mp_int* modulus, mp_digit mp, WC_RNG* rng)
+    ecc_point** M, mp_int* a, mp_int* modulus, mp_digit mp, WC_RNG* rng,
+    void* heap)
 {
    int      err = MP_OKAY;
    int      i;
@@ -1679,6 +1865,10 @@ static int ecc_mulmod(const mp_int* k, ecc_point* tG, ecc_point* R,
            if (err != MP_OKAY) break;
        }
 
+   /* affine table entries make the window additions mixed */
+   if (err == MP_OKAY)
+       err = ecc_map_batch(M, M_POINTS, modulus, mp, 1, heap);
+
    /* setup sliding window */
    if (err == MP_OKAY) {
        mode   = 0;
@@ -1729,7 +1919,7 @@ static int ecc_mulmod(const mp_int* k, ecc_point* tG, ecc_point* R,
                    err = mp_copy(M[bitbuf-M_POINTS]->y, R->y);
                    if (err != MP_OKAY) break;
 
-                   err = mp_copy(M[bitbuf-M_POINTS]->z, R->z);
+                   err = mp_montgomery_calc_normalization(R->z, modulus);
                    first = 0;
                } else {
                    /* normal window */
@@ -1807,12 +1997,12 @@ static int ecc_point_to_mont(ecc_point* p, ecc_point* r, mp_int* modulus,
                              void* heap)
 {
    int err = MP_OKAY;
-   mp_int        mu[1];
+   DECL_MP_INT_SIZE_DYN(mu, mp_count_bits(modulus), MAX_ECC_BITS);
 
    (void)heap;
 
    if (err == MP_OKAY)
-       err = mp_init(mu);
+       err = INIT_MP_INT_SIZE(mu, mp_count_bits(modulus));
    if (err == MP_OKAY) {
        err = mp_montgomery_calc_normalization(mu, modulus);
 
@@ -1937,7 +2127,7 @@ int wc_ecc_mulmod_ex(const mp_int* k, ecc_point *G, ecc_point *R, mp_int* a,
        goto exit;
    }
 
-   err = ecc_mulmod(k, tG, R, M, a, modulus, mp, NULL);
+   err = ecc_mulmod(k, tG, R, M, a, modulus, mp, NULL, heap);
    /* map R back from projective space */
    if (err == MP_OKAY && map)
        err = ecc_map(R, modulus, mp);
@@ -2037,7 +2227,7 @@ int wc_ecc_mulmod_ex2(const mp_int* k, ecc_point *G, ecc_point *R, mp_int* a,
    }
 
 
-   err = ecc_mulmod(k, tG, R, M, a, modulus, mp, rng);
+   err = ecc_mulmod(k, tG, R, M, a, modulus, mp, rng, heap);
 
    (void)order;
    /* map R back from projective space */
@@ -2059,6 +2249,213 @@ exit:
    return err;
 }
 
+#ifdef WC_ECC_NONBLOCK
+/* non-blocking operation sub-states */
+enum {
+    ECC_NB_STATE_NONE = 0,
+    ECC_NB_STATE_MUL2ADD_B
+};
+
+/* Zeroize and free the ladder registers of a non-blocking context.
+ *
+ * @param  [in]  nb    Non-blocking context.
+ * @param  [in]  heap  Heap hint.
+ */
+static void ecc_nb_free_ladder(ecc_nb_ctx_t* nb, void* heap)
+{
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        wc_ecc_forcezero_point(nb->R[i]);
+        wc_ecc_del_point_ex(nb->R[i], heap);
+        nb->R[i] = NULL;
+    }
+    mp_forcezero(&nb->k);
+    nb->swap = 0;
+}
+
+/* Free all points of a non-blocking context and return it to idle.
+ *
+ * @param  [in]  nb    Non-blocking context.
+ * @param  [in]  heap  Heap hint.
+ */
+static void ecc_nb_free(ecc_nb_ctx_t* nb, void* heap)
+{
+    ecc_nb_free_ladder(nb, heap);
+    wc_ecc_forcezero_point(nb->T);
+    wc_ecc_del_point_ex(nb->T, heap);
+    nb->T = NULL;
+    nb->state = ECC_NB_STATE_NONE;
+}
+
+/* Swap the ladder registers when m is 1 without branching on m.
+ *
+ * @param  [in]  nb       Non-blocking context.
+ * @param  [in]  modulus  Prime of the curve.
+ * @param  [in]  m        1 to swap, 0 to leave.
+ * @return  MP_OKAY on success.
+ */
+static int ecc_nb_cond_swap(ecc_nb_ctx_t* nb, mp_int* modulus, int m)
+{
+    int err;
+    int c = get_digit_count(modulus);
+
+    err = mp_cond_swap_ct(nb->R[0]->x, nb->R[1]->x, c, m);
+    if (err == MP_OKAY)
+        err = mp_cond_swap_ct(nb->R[0]->y, nb->R[1]->y, c, m);
+    if (err == MP_OKAY)
+        err = mp_cond_swap_ct(nb->R[0]->z, nb->R[1]->z, c, m);
+
+    return err;
+}
+
+/* Time-sliced point multiplication using a Montgomery ladder.
+ * At most maxSteps ladder steps are performed on each call so that the caller
+ * can service other work in between.
+ *
+ * The ladder runs on k + order or k + 2 * order, whichever has the bit above
+ * the order's top bit set, so the number of steps is the bit length of the
+ * order whatever the value of k. Registers are swapped with masks rather than
+ * indexed by scalar bits.
+ *
+ * @param  [in]   nb       Non-blocking context.
+ * @param  [in]   k        Scalar less than order - must be the same on each
+ *                         call.
+ * @param  [in]   G        Point to multiply - must be the same on each call.
+ * @param  [out]  R        Product in montgomery projective form.
+ * @param  [in]   a        Curve parameter a.
+ * @param  [in]   modulus  Prime of the curve.
+ * @param  [in]   order    Order of the curve.
+ * @param  [in]   heap     Heap hint.
+ * @return  MP_OKAY when the product is in R.
+ * @return  FP_WOULDBLOCK when more calls are required.
+ * @return  Other -ve on failure.
+ */
+static int ecc_mulmod_nb(ecc_nb_ctx_t* nb, mp_int* k, ecc_point* G,
+    ecc_point* R, mp_int* a, mp_int* modulus, mp_int* order, void* heap)
+{
+    int    err = MP_OKAY;
+    int    b;
+    word32 steps = (nb->maxSteps != 0) ? nb->maxSteps : WC_ECC_NB_STEPS;
+
+    if (nb->R[0] == NULL) {
+        /* first call: R[0] = G, R[1] = 2G and start below the fixed top bit */
+        int bits = mp_count_bits(order);
+        DECL_MP_INT_SIZE_DYN(t, bits + 2, MAX_ECC_BITS + 2);
+
+        if (mp_iszero(k) || mp_cmp(k, order) != MP_LT)
+            err = ECC_OUT_OF_RANGE_E;
+        if (err == MP_OKAY)
+            err = INIT_MP_INT_SIZE(t, bits + 2);
+        if (err == MP_OKAY)
+            err = mp_init(&nb->k);
+        /* k + order is in [2^(bits-1), 2^(bits+1)), when below 2^bits use
+         * k + 2 * order */
+        if (err == MP_OKAY)
+            err = mp_add(k, order, &nb->k);
+        if (err == MP_OKAY)
+            err = mp_add(&nb->k, order, t);
+        if (err == MP_OKAY)
+            err = mp_cond_swap_ct(&nb->k, t,
+                                    (bits + 2 + DIGIT_BIT - 1) / DIGIT_BIT,
+                                    mp_is_bit_set(&nb->k, (mp_digit)bits) ^ 1);
+        mp_forcezero(t);
+
+        if (err == MP_OKAY)
+            err = wc_ecc_new_point_ex(&nb->R[0], heap);
+        if (err == MP_OKAY)
+            err = wc_ecc_new_point_ex(&nb->R[1], heap);
+        if (err == MP_OKAY)
+            err = mp_montgomery_setup(modulus, &nb->mp);
+        if (err == MP_OKAY)
+            err = ecc_point_to_mont(G, nb->R[0], modulus, heap);
+        if (err == MP_OKAY)
+            err = ecc_projective_dbl_point_safe(nb->R[0], nb->R[1], a, modulus,
+                                                                        nb->mp);
+        if (err == MP_OKAY) {
+            nb->bit = bits - 1;
+            nb->swap = 0;
+        }
+    }
+
+    for (; err == MP_OKAY && nb->bit >= 0 && steps > 0; steps--) {
+        b = mp_is_bit_set(&nb->k, (mp_digit)nb->bit) ? 1 : 0;
+
+        /* swap when the bit differs from the last one, then
+         * R[1] = R[0] + R[1], R[0] = 2 * R[0] */
+        err = ecc_nb_cond_swap(nb, modulus, nb->swap ^ b);
+        nb->swap = b;
+        if (err == MP_OKAY)
+            err = ecc_projective_add_point_safe(nb->R[0], nb->R[1], nb->R[1],
+                                                     a, modulus, nb->mp, NULL);
+        if (err == MP_OKAY)
+            err = ecc_projective_dbl_point_safe(nb->R[0], nb->R[0], a,
+                                                                modulus, nb->mp);
+        nb->bit--;
+    }
+
+    if (err == MP_OKAY) {
+        if (nb->bit >= 0)
+            return FP_WOULDBLOCK;
+
+        err = ecc_nb_cond_swap(nb, modulus, nb->swap);
+        if (err == MP_OKAY)
+            err = mp_copy(nb->R[0]->x, R->x);
+        if (err == MP_OKAY)
+            err = mp_copy(nb->R[0]->y, R->y);
+        if (err == MP_OKAY)
+            err = mp_copy(nb->R[0]->z, R->z);
+    }
+
+    ecc_nb_free_ladder(nb, heap);
+
+    return err;
+}
+
+/* Time-sliced kA*A + kB*B, result mapped to affine in C.
+ * The products are computed one after the other with ecc_mulmod_nb().
+ *
+ * @return  MP_OKAY when the result is in C.
+ * @return  FP_WOULDBLOCK when more calls are required.
+ * @return  Other -ve on failure.
+ */
+static int ecc_mul2add_nb(ecc_nb_ctx_t* nb, ecc_point* A, mp_int* kA,
+    ecc_point* B, mp_int* kB, ecc_point* C, mp_int* a, mp_int* modulus,
+    mp_int* order, void* heap)
+{
+    int err = MP_OKAY;
+
+    if (nb->state == ECC_NB_STATE_NONE) {
+        if (nb->T == NULL)
+            err = wc_ecc_new_point_ex(&nb->T, heap);
+        if (err == MP_OKAY)
+            err = ecc_mulmod_nb(nb, kA, A, nb->T, a, modulus, order,
+                                                                          heap);
+        if (err == MP_OKAY) {
+            /* yield between products to keep each slice bounded */
+            nb->state = ECC_NB_STATE_MUL2ADD_B;
+            err = FP_WOULDBLOCK;
+        }
+    }
+    else if (nb->state == ECC_NB_STATE_MUL2ADD_B) {
+        err = ecc_mulmod_nb(nb, kB, B, C, a, modulus, order, heap);
+        if (err == MP_OKAY)
+            err = ecc_projective_add_point_safe(nb->T, C, C, a, modulus, nb->mp,
+                                                                          NULL);
+        if (err == MP_OKAY)
+            err = ecc_map(C, modulus, nb->mp);
+    }
+    else {
+        err = BAD_STATE_E;
+    }
+
+    if (err != FP_WOULDBLOCK)
+        ecc_nb_free(nb, heap);
+
+    return err;
+}
+#endif /* WC_ECC_NONBLOCK */
+
 #endif /* !FREESCALE_LTC_ECC && !WOLFSSL_STM32_PKA */
 
 /** ECC Fixed Point mulmod global
@@ -2602,11 +2999,33 @@ static int wc_ecc_shared_secret_gen_sync(ecc_key* private_key, ecc_point* point,
 
     WOLFSSL_ENTER("wc_ecc_shared_secret_gen_sync");
 
-
-    (void)point;
-    (void)out;
-    (void)outlen;
-    (void)k;
+#ifdef WOLFSSL_SP_ECC_256
+    if (private_key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[private_key->idx].id == ECC_SECP256R1) {
+        SAVE_VECTOR_REGISTERS(return _svr_ret;);
+        err = sp_ecc_secret_gen_256(k, point, out, outlen, private_key->heap);
+        RESTORE_VECTOR_REGISTERS();
+    }
+    else
+#endif
+#ifdef WOLFSSL_SP_ECC_384
+    if (private_key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[private_key->idx].id == ECC_SECP384R1) {
+        SAVE_VECTOR_REGISTERS(return _svr_ret;);
+        err = sp_ecc_secret_gen_384(k, point, out, outlen, private_key->heap);
+        RESTORE_VECTOR_REGISTERS();
+    }
+    else
+#endif
+#ifdef WOLFSSL_SP_ECC_521
+    if (private_key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[private_key->idx].id == ECC_SECP521R1) {
+        SAVE_VECTOR_REGISTERS(return _svr_ret;);
+        err = sp_ecc_secret_gen_521(k, point, out, outlen, private_key->heap);
+        RESTORE_VECTOR_REGISTERS();
+    }
+    else
+#endif
     {
         ecc_point* result = NULL;
         word32 x = 0;
@@ -2635,6 +3054,13 @@ static int wc_ecc_shared_secret_gen_sync(ecc_key* private_key, ecc_point* point,
         }
 
 
+    #ifdef WC_ECC_NONBLOCK
+        if (err == MP_OKAY && private_key->nb_ctx != NULL) {
+            err = ecc_mulmod_nb(private_key->nb_ctx, k, point, result,
+                     curve->Af, curve->prime, curve->order, private_key->heap);
+        }
+        else
+    #endif
         if (err == MP_OKAY) {
             /* Map in a separate call as this should be constant time */
             err = wc_ecc_mulmod_ex2(k, point, result, curve->Af, curve->prime,
@@ -2659,6 +3085,10 @@ static int wc_ecc_shared_secret_gen_sync(ecc_key* private_key, ecc_point* point,
             err = mp_to_unsigned_bin(result->x,out +
                                      (x - mp_unsigned_bin_size(result->x)));
         }
+    #ifdef WC_ECC_NONBLOCK
+        /* keep the buffer size for the next call */
+        if (err != FP_WOULDBLOCK)
+    #endif
         *outlen = x;
 
         wc_ecc_del_point_ex(result, private_key->heap);
@@ -2875,63 +3305,349 @@ int wc_ecc_gen_k(WC_RNG* rng, int size, mp_int* k, mp_int* order)
 #endif /* !WC_NO_RNG */
 }
 
-static WC_INLINE void wc_ecc_reset(ecc_key* key)
+#if defined(WC_ECC_FIXED_BASE) || defined(WC_ECC_VERIFY_TABLE)
+/* Signed comb multiplication.
+ *
+ * An odd scalar k is recoded as s = (k + 2^L - 1) / 2, L = teeth * spacing,
+ * so that k is the sum of (2 * s_i - 1) * 2^i: every bit stands for +1 or -1.
+ * Column c takes bits c, c + spacing, ... of s and selects one of
+ * ECC_COMB_ENTRIES points and a sign. No column is zero, so a multiply is one
+ * double and one mixed add per column. An even scalar is replaced by
+ * order - k and the signs are flipped.
+ *
+ * Entry m of the table of P is 2^((teeth - 1) * spacing) * P plus, for each
+ * lower tooth j, 2^(j * spacing) * P when bit j of m is set and minus it when
+ * not. Entries are affine x and y in Montgomery form.
+ */
+#define ECC_COMB_TEETH      6
+#define ECC_COMB_ENTRIES    (1 << (ECC_COMB_TEETH - 1))
+
+#ifdef WC_ECC_FIXED_BASE
+    #include "ecc_comb.i"
+#endif
+
+/* Bits between comb teeth for a curve order. */
+static word32 ecc_comb_spacing(mp_int* order)
 {
-    /* make sure required key variables are reset */
-    key->state = ECC_STATE_NONE;
+    return ((word32)mp_count_bits(order) + ECC_COMB_TEETH - 1) /
+                                                                ECC_COMB_TEETH;
 }
 
-/* create the public ECC key from a private key
- *
- * key     an initialized private key to generate public part from
- * curveIn [in]curve for key, can be NULL
- * pubOut  [out]ecc_point holding the public key, if NULL then public key part
- *         is cached in key instead.
- *
- * Note this function is local to the file because of the argument type
- *      ecc_curve_spec. Having this argument allows for not having to load the
- *      curve type multiple times when generating a key with wc_ecc_make_key().
- * For async the results are placed directly into pubOut, so this function
- *      does not need to be called again
+/* Get bit of a big-endian scalar, bits past the end are zero. */
+static WC_INLINE int ecc_comb_bit(const byte* s, word32 sSz, word32 bit)
+{
+    if (bit >= sSz * WOLFSSL_BIT_SIZE)
+        return 0;
+    return (s[sSz - 1 - (bit / WOLFSSL_BIT_SIZE)] >> (bit % WOLFSSL_BIT_SIZE))
+                                                                          & 1;
+}
+
+/* Recode a scalar for the signed comb.
  *
- * returns MP_OKAY on success
+ * k      Scalar less than order
+ * order  Odd order of the curve
+ * s      [out] Recoded scalar, big-endian
+ * sSz    Bytes in s, at least teeth * spacing bits
+ * neg    [out] 1 when order - k was recoded and all signs must be flipped
+ * return MP_OKAY on success
  */
-static int ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
-        ecc_point* pubOut, WC_RNG* rng)
+static int ecc_comb_recode(const mp_int* k, mp_int* order, word32 spacing,
+                           byte* s, word32 sSz, int* neg)
 {
-    int err = MP_OKAY;
-#ifdef HAVE_ECC_MAKE_PUB
-    ecc_point* pub;
-    DECLARE_CURVE_SPECS(ECC_CURVE_FIELD_COUNT);
-#endif /* HAVE_ECC_MAKE_PUB */
+    int    err;
+    int    even;
+    DECL_MP_INT_SIZE_DYN(u, mp_count_bits(order), MAX_ECC_BITS);
+    DECL_MP_INT_SIZE_DYN(t, mp_count_bits(order), MAX_ECC_BITS);
 
-    (void)rng;
+    err = INIT_MP_INT_SIZE(u, mp_count_bits(order));
+    if (err == MP_OKAY)
+        err = INIT_MP_INT_SIZE(t, mp_count_bits(order));
+    if (err != MP_OKAY)
+        return err;
 
-    if (key == NULL) {
-        return BAD_FUNC_ARG;
-    }
+    even = mp_isodd((mp_int*)k) == MP_NO;
 
-    SAVE_VECTOR_REGISTERS(return _svr_ret;);
+    /* u = the odd one of k and order - k */
+    err = mp_copy(k, u);
+    if (err == MP_OKAY)
+        err = mp_sub(order, (mp_int*)k, t);
+    if (err == MP_OKAY)
+        err = mp_cond_swap_ct(u, t, get_digit_count(order), even);
 
-#ifdef HAVE_ECC_MAKE_PUB
-    /* if ecc_point passed in then use it as output for public key point */
-    if (pubOut != NULL) {
-        pub = pubOut;
+    /* s = (u + 2^L - 1) / 2 */
+    if (err == MP_OKAY)
+        err = mp_2expt(t, (int)(spacing * ECC_COMB_TEETH));
+    if (err == MP_OKAY)
+        err = mp_sub_d(t, 1, t);
+    if (err == MP_OKAY)
+        err = mp_add(u, t, u);
+    if (err == MP_OKAY)
+        err = mp_div_2(u, u);
+    if (err == MP_OKAY)
+        err = mp_to_unsigned_bin_len(u, s, (int)sSz);
+
+    *neg = even;
+
+    mp_forcezero(u);
+    mp_forcezero(t);
+    return err;
+}
+
+/* Entry index and sign, 1 for negative, of comb column col. */
+static WC_INLINE int ecc_comb_digit(const byte* s, word32 sSz, word32 spacing,
+                                    word32 col, int* sign)
+{
+    int    idx = 0;
+    int    top;
+    word32 j;
+
+    for (j = 0; j < ECC_COMB_TEETH - 1; j++)
+        idx |= ecc_comb_bit(s, sSz, j * spacing + col) << j;
+    top = ecc_comb_bit(s, sSz, (ECC_COMB_TEETH - 1) * spacing + col);
+
+    /* a clear top tooth is the negation of the entry with the other teeth
+     * flipped */
+    idx ^= (top - 1) & (ECC_COMB_ENTRIES - 1);
+    *sign = top ^ 1;
+
+    return idx;
+}
+
+/* Load comb entry idx into T as an affine point, z of zero, negated when neg
+ * is set. With ct all entries are read and the negation is a conditional
+ * swap so the timing does not depend on idx or neg.
+ */
+static int ecc_comb_load(const byte* table, word32 coordSz, int idx, int neg,
+                         int ct, ecc_point* T, mp_int* modulus)
+{
+    int         err;
+    byte        buf[2 * MAX_ECC_BYTES];
+    const byte* entry;
+    DECL_MP_INT_SIZE_DYN(t, mp_count_bits(modulus), MAX_ECC_BITS);
+
+    if (ct) {
+        int           m;
+        word32        i;
+        wolfssl_word  w[(2 * MAX_ECC_BYTES) / WOLFSSL_WORD_SIZE];
+        word32        words = (2 * coordSz) / WOLFSSL_WORD_SIZE;
+
+        /* whole words then the remaining bytes */
+        XMEMSET(w, 0, sizeof(w));
+        XMEMSET(buf, 0, 2 * coordSz);
+        for (m = 0; m < ECC_COMB_ENTRIES; m++) {
+            byte         mask = ctMaskEq(m, idx);
+            wolfssl_word wmask = (wolfssl_word)0 - (mask & 1);
+            wolfssl_word e;
+
+            entry = table + (word32)m * 2 * coordSz;
+            for (i = 0; i < words; i++) {
+                XMEMCPY(&e, entry + i * WOLFSSL_WORD_SIZE, sizeof(e));
+                w[i] |= e & wmask;
+            }
+            for (i *= WOLFSSL_WORD_SIZE; i < 2 * coordSz; i++)
+                buf[i] |= entry[i] & mask;
+        }
+        XMEMCPY(buf, w, words * WOLFSSL_WORD_SIZE);
+        ForceZero(w, sizeof(w));
+        entry = buf;
     }
     else {
-        /* caching public key making it a ECC_PRIVATEKEY instead of
-           ECC_PRIVATEKEY_ONLY */
-        pub = &key->pubkey;
-        key->type = ECC_PRIVATEKEY_ONLY;
+        entry = table + (word32)idx * 2 * coordSz;
     }
 
-    /* avoid loading the curve unless it is not passed in */
-    if (curveIn != NULL) {
-        curve = curveIn;
+    err = mp_read_unsigned_bin(T->x, entry, (int)coordSz);
+    if (err == MP_OKAY)
+        err = mp_read_unsigned_bin(T->y, entry + coordSz, (int)coordSz);
+    if (ct)
+        ForceZero(buf, 2 * coordSz);
+    if (err == MP_OKAY)
+        mp_zero(T->z);
+
+    /* -y is modulus - y */
+    if (err == MP_OKAY && ct) {
+        err = INIT_MP_INT_SIZE(t, mp_count_bits(modulus));
+        if (err == MP_OKAY)
+            err = mp_sub(modulus, T->y, t);
+        if (err == MP_OKAY)
+            err = mp_cond_swap_ct(T->y, t, get_digit_count(modulus), neg);
+        mp_forcezero(t);
     }
-    else {
-        /* load curve info */
-        if (err == MP_OKAY) {
+    else if (err == MP_OKAY && neg) {
+        err = mp_sub(modulus, T->y, T->y);
+    }
+
+    return err;
+}
+
+/* Add the affine point T to R. first is 1 while R is infinity: at the start
+ * and if a sum cancels.
+ */
+static int ecc_comb_accum(ecc_point* R, ecc_point* T, int* first, mp_int* a,
+                          mp_int* modulus, mp_digit mp)
+{
+    int err;
+
+    if (*first) {
+        *first = 0;
+        err = mp_copy(T->x, R->x);
+        if (err == MP_OKAY)
+            err = mp_copy(T->y, R->y);
+        if (err == MP_OKAY)
+            err = mp_montgomery_calc_normalization(R->z, modulus);
+    }
+    else {
+        err = ecc_projective_add_point_safe(R, T, R, a, modulus, mp, first);
+    }
+
+    return err;
+}
+#endif /* WC_ECC_FIXED_BASE || WC_ECC_VERIFY_TABLE */
+
+#ifdef WC_ECC_FIXED_BASE
+/* Find the comb table of a curve's base point. The entries are in Montgomery
+ * form for a fixed R which must be the one the math library uses for modulus.
+ */
+static const byte* ecc_comb_base_table(const ecc_key* key, mp_int* modulus)
+{
+    int    i;
+    word32 montBits;
+
+    if (key->idx == ECC_CUSTOM_IDX || key->dp == NULL)
+        return NULL;
+
+#ifdef WOLFSSL_SP_MATH_ALL
+    /* sp_int reduces by 2^bits of the modulus, at least one digit */
+    montBits = (word32)mp_count_bits(modulus);
+    if (montBits < DIGIT_BIT)
+        montBits = DIGIT_BIT;
+#else
+    montBits = (word32)get_digit_count(modulus) * DIGIT_BIT;
+#endif
+
+    for (i = 0; ecc_comb_bases[i].table != NULL; i++) {
+        if (ecc_comb_bases[i].id == key->dp->id) {
+            if (montBits != ecc_comb_bases[i].montBits) {
+                break;
+            }
+            return ecc_comb_bases[i].table;
+        }
+    }
+
+    return NULL;
+}
+
+/* Computes k*G with the comb table of the base point. Constant time in the
+ * value of k.
+ *
+ * table    Comb table of the base point
+ * k        Scalar, less than order
+ * R        [out] k*G in Jacobian Montgomery form, not mapped
+ * coordSz  Bytes in a coordinate
+ * return MP_OKAY on success
+ */
+static int ecc_mulmod_base_comb(const byte* table, const mp_int* k,
+                                ecc_point* R, mp_int* a, mp_int* modulus,
+                                mp_int* order, word32 coordSz, void* heap)
+{
+    int        err;
+    byte       s[MAX_ECC_BYTES + 1];
+    word32     spacing = ecc_comb_spacing(order);
+    word32     sSz = (spacing * ECC_COMB_TEETH + 7) / WOLFSSL_BIT_SIZE;
+    ecc_point* T = NULL;
+    mp_digit   mp = 0;
+    int        neg = 0;
+    int        first = 1;
+    int        idx;
+    int        sign;
+    word32     col;
+
+    if (sSz > sizeof(s) || coordSz > MAX_ECC_BYTES) {
+        return BAD_FUNC_ARG;
+    }
+
+    err = ecc_comb_recode(k, order, spacing, s, sSz, &neg);
+    if (err == MP_OKAY)
+        err = wc_ecc_new_point_ex(&T, heap);
+    if (err == MP_OKAY)
+        err = mp_montgomery_setup(modulus, &mp);
+
+    for (col = spacing; (err == MP_OKAY) && (col-- > 0); ) {
+        idx = ecc_comb_digit(s, sSz, spacing, col, &sign);
+        err = ecc_comb_load(table, coordSz, idx, sign ^ neg, 1, T, modulus);
+        if ((err == MP_OKAY) && !first)
+            err = ecc_projective_dbl_point_safe(R, R, a, modulus, mp);
+        if (err == MP_OKAY)
+            err = ecc_comb_accum(R, T, &first, a, modulus, mp);
+    }
+
+    ForceZero(s, sizeof(s));
+    if (T != NULL) {
+        mp_forcezero(T->x);
+        mp_forcezero(T->y);
+        wc_ecc_del_point_ex(T, heap);
+    }
+
+    return err;
+}
+#endif /* WC_ECC_FIXED_BASE */
+
+static WC_INLINE void wc_ecc_reset(ecc_key* key)
+{
+    /* make sure required key variables are reset */
+    key->state = ECC_STATE_NONE;
+}
+
+/* create the public ECC key from a private key
+ *
+ * key     an initialized private key to generate public part from
+ * curveIn [in]curve for key, can be NULL
+ * pubOut  [out]ecc_point holding the public key, if NULL then public key part
+ *         is cached in key instead.
+ *
+ * Note this function is local to the file because of the argument type
+ *      ecc_curve_spec. Having this argument allows for not having to load the
+ *      curve type multiple times when generating a key with wc_ecc_make_key().
+ * For async the results are placed directly into pubOut, so this function
+ *      does not need to be called again
+ *
+ * returns MP_OKAY on success
+ */
+static int ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
+        ecc_point* pubOut, WC_RNG* rng)
+{
+    int err = MP_OKAY;
+#ifdef HAVE_ECC_MAKE_PUB
+    ecc_point* pub;
+    DECLARE_CURVE_SPECS(ECC_CURVE_FIELD_COUNT);
+#endif /* HAVE_ECC_MAKE_PUB */
+
+    (void)rng;
+
+    if (key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    SAVE_VECTOR_REGISTERS(return _svr_ret;);
+
+#ifdef HAVE_ECC_MAKE_PUB
+    /* if ecc_point passed in then use it as output for public key point */
+    if (pubOut != NULL) {
+        pub = pubOut;
+    }
+    else {
+        /* caching public key making it a ECC_PRIVATEKEY instead of
+           ECC_PRIVATEKEY_ONLY */
+        pub = &key->pubkey;
+        key->type = ECC_PRIVATEKEY_ONLY;
+    }
+
+    /* avoid loading the curve unless it is not passed in */
+    if (curveIn != NULL) {
+        curve = curveIn;
+    }
+    else {
+        /* load curve info */
+        if (err == MP_OKAY) {
             ALLOC_CURVE_SPECS(ECC_CURVE_FIELD_COUNT, err);
         }
         if (err == MP_OKAY) {
@@ -2949,11 +3665,33 @@ static int ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
         err = mp_init_multi(pub->x, pub->y, pub->z, NULL, NULL, NULL);
     }
 
-
-
+#ifdef WOLFSSL_SP_ECC_256
+    if (err == MP_OKAY && key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[key->idx].id == ECC_SECP256R1) {
+        err = sp_ecc_mulmod_base_256(&key->k, pub, 1, key->heap);
+    }
+    else
+#endif
+#ifdef WOLFSSL_SP_ECC_384
+    if (err == MP_OKAY && key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[key->idx].id == ECC_SECP384R1) {
+        err = sp_ecc_mulmod_base_384(&key->k, pub, 1, key->heap);
+    }
+    else
+#endif
+#ifdef WOLFSSL_SP_ECC_521
+    if (err == MP_OKAY && key->idx != ECC_CUSTOM_IDX &&
+            ecc_sets[key->idx].id == ECC_SECP521R1) {
+        err = sp_ecc_mulmod_base_521(&key->k, pub, 1, key->heap);
+    }
+    else
+#endif
     if (err == MP_OKAY) {
         mp_digit mp = 0;
         ecc_point* base = NULL;
+    #ifdef WC_ECC_FIXED_BASE
+        const byte* baseTable;
+    #endif
         err = wc_ecc_new_point_ex(&base, key->heap);
 
         /* read in the x/y for this key */
@@ -2967,6 +3705,22 @@ static int ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
             err = mp_set(base->z, 1);
 
         /* make the public key */
+    #ifdef WC_ECC_NONBLOCK
+        if (err == MP_OKAY && key->nb_ctx != NULL) {
+            err = ecc_mulmod_nb(key->nb_ctx, &key->k, base, pub, curve->Af,
+                                      curve->prime, curve->order, key->heap);
+        }
+        else
+    #endif
+    #ifdef WC_ECC_FIXED_BASE
+        if (err == MP_OKAY &&
+                (baseTable = ecc_comb_base_table(key, curve->prime)) != NULL) {
+            err = ecc_mulmod_base_comb(baseTable, &key->k, pub, curve->Af,
+                       curve->prime, curve->order, (word32)key->dp->size,
+                       key->heap);
+        }
+        else
+    #endif
         if (err == MP_OKAY) {
             /* Map in a separate call as this should be constant time */
             err = wc_ecc_mulmod_ex2(&key->k, base, pub, curve->Af, curve->prime,
@@ -3074,9 +3828,19 @@ static int _ecc_make_key_ex(WC_RNG* rng, int keysize, ecc_key* key,
 
 
    { /* software key gen */
+        int genK = 1;
+
+    #ifdef WC_ECC_NONBLOCK
+        /* k is already set when resuming the public key calculation */
+        if (key->nb_ctx != NULL && key->nb_ctx->R[0] != NULL) {
+            genK = 0;
+        }
+    #endif
 
         /* setup the key variables */
-        err = mp_init(&key->k);
+        if (genK) {
+            err = mp_init(&key->k);
+        }
 
         /* load curve info */
         if (err == MP_OKAY) {
@@ -3087,7 +3851,7 @@ static int _ecc_make_key_ex(WC_RNG* rng, int keysize, ecc_key* key,
         }
 
         /* generate k */
-        if (err == MP_OKAY) {
+        if (err == MP_OKAY && genK) {
             err = wc_ecc_gen_k(rng, key->dp->size, &key->k, curve->order);
         }
 
@@ -3100,6 +3864,11 @@ static int _ecc_make_key_ex(WC_RNG* rng, int keysize, ecc_key* key,
         ) {
             key->type = ECC_PRIVATEKEY;
         }
+    #ifdef WC_ECC_NONBLOCK
+        else if (err == FP_WOULDBLOCK) {
+            /* keep k for the next call */
+        }
+    #endif
         else {
             /* cleanup these on failure case only */
             mp_forcezero(&key->k);
@@ -3611,7 +4380,7 @@ static int ecc_sign_hash_sw(ecc_key* key, ecc_key* pubkey, WC_RNG* rng,
 
             /* k' = 1/k.b
                   = 1/k' */
-            err = mp_invmod(kp, curve->order, kp);
+            err = mp_invmod_ct(kp, curve->order, kp);
             if (err != MP_OKAY) break;
 
             /* s = x.r */
@@ -3653,6 +4422,412 @@ static int ecc_sign_hash_sw(ecc_key* key, ecc_key* pubkey, WC_RNG* rng,
     return err;
 }
 
+/* load digest into e, truncated to the bit length of the order */
+static int ecc_sign_load_digest(const byte* in, word32 inlen, mp_int* order,
+                                mp_int* e)
+{
+    int err;
+    /* we may need to truncate if hash is longer than key size */
+    word32 orderBits = mp_count_bits(order);
+
+    /* truncate down to byte size, may be all that's needed */
+    if ((WOLFSSL_BIT_SIZE * inlen) > orderBits)
+        inlen = (orderBits + WOLFSSL_BIT_SIZE - 1) / WOLFSSL_BIT_SIZE;
+    err = mp_read_unsigned_bin(e, in, inlen);
+
+    /* may still need bit truncation too */
+    if (err == MP_OKAY && (WOLFSSL_BIT_SIZE * inlen) > orderBits)
+        mp_rshb(e, WOLFSSL_BIT_SIZE - (orderBits & 0x7));
+
+    return err;
+}
+
+#ifdef WC_ECC_PRESIGN
+/* Presignatures.
+ *
+ * Of r = (k.G).x mod n and s = k^-1.(e + d.r) mod n only s depends on the
+ * message, so the point multiplication and inversion for a nonce can be done
+ * ahead of time, from an idle loop or a background thread calling
+ * wc_ecc_presign_fill(). Signing then takes an entry from the pool and is
+ * left with three modular multiplications. An entry is removed under the pool
+ * lock before it is used, so each nonce signs at most one message, and the
+ * slot is zeroized.
+ */
+
+/* Zeroize all entries of the pool. Call with the lock held. */
+static void ecc_presign_clear(ecc_presign_pool* pool)
+{
+    ForceZero(pool->entries, pool->depth * sizeof(ecc_presign));
+    pool->count = 0;
+}
+
+/* Drop the entries when running in a child of the process that made them.
+ * Parent and child would otherwise sign with the same nonces, and two
+ * signatures with one nonce give away the private key. Call with the lock
+ * held. */
+static void ecc_presign_check_pid(ecc_presign_pool* pool)
+{
+#ifdef WC_ECC_PRESIGN_PID
+    pid_t pid = getpid();
+
+    if (pool->pid != pid) {
+        ecc_presign_clear(pool);
+        pool->pid = pid;
+    }
+#else
+    (void)pool;
+#endif
+}
+
+/* Make one presignature for the curve of key.
+ *
+ * k^-1 is calculated as b.(k.b)^-1 with a random b so that the inversion does
+ * not operate on k directly, as in ecc_sign_hash_sw().
+ */
+static int ecc_presign_make(ecc_key* key, WC_RNG* rng, ecc_curve_spec* curve,
+                            ecc_presign* entry)
+{
+    int err;
+    int loop_check = 0;
+    word32 orderSz = (word32)mp_unsigned_bin_size(curve->order);
+    mp_int b[1], r[1];
+    ecc_key pubkey[1];
+
+    err = mp_init_multi(b, r, NULL, NULL, NULL, NULL);
+    if (err != MP_OKAY) {
+        return err;
+    }
+    err = wc_ecc_init_ex(pubkey, key->heap, INVALID_DEVID);
+    if (err != MP_OKAY) {
+        mp_clear(b);
+        mp_clear(r);
+        return err;
+    }
+
+    /* Generate blinding value - non-zero value. */
+    do {
+        if (++loop_check > 64) {
+            err = RNG_FAILURE_E;
+            break;
+        }
+        err = wc_ecc_gen_k(rng, key->dp->size, b, curve->order);
+    }
+    while (err == MP_ZERO_E);
+    loop_check = 0;
+
+    for (; err == MP_OKAY;) {
+        if (++loop_check > 64) {
+            err = RNG_FAILURE_E;
+            break;
+        }
+        err = _ecc_make_key_ex(rng, key->dp->size, pubkey, key->dp->id,
+                               WC_ECC_FLAG_NONE);
+        if (err != MP_OKAY) break;
+
+        /* r = x1 mod n */
+        err = mp_mod(pubkey->pubkey.x, curve->order, r);
+        if (err != MP_OKAY) break;
+
+        if (mp_iszero(r) == MP_NO) {
+            mp_int* kp = &pubkey->k;
+
+            /* k' = 1/k.b */
+            err = mp_mulmod(kp, b, curve->order, kp);
+            if (err == MP_OKAY)
+                err = mp_invmod_ct(kp, curve->order, kp);
+            /* 1/k = b.k' */
+            if (err == MP_OKAY)
+                err = mp_mulmod(kp, b, curve->order, kp);
+            if (err == MP_OKAY)
+                err = mp_to_unsigned_bin_len(kp, entry->kinv, (int)orderSz);
+            if (err == MP_OKAY)
+                err = mp_to_unsigned_bin_len(r, entry->r, (int)orderSz);
+            break;
+        }
+        mp_forcezero(&pubkey->k);
+    }
+
+    wc_ecc_free(pubkey);
+    mp_forcezero(b);
+    mp_clear(r);
+
+    return err;
+}
+
+/* Take a presignature for the curve of key out of its pool.
+ *
+ * The refill callback is called, outside the lock, when the pool is left below
+ * its low watermark.
+ *
+ * returns 1 when an entry was taken and 0 otherwise
+ */
+static int ecc_presign_take(ecc_key* key, ecc_presign* entry)
+{
+    ecc_presign_pool* pool = key->presign;
+    wc_EccPresignCb cb;
+    void* cbCtx;
+    int taken = 0;
+    int low;
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        return 0;
+    }
+    ecc_presign_check_pid(pool);
+    if (pool->dp == key->dp && pool->count > 0) {
+        pool->count--;
+        XMEMCPY(entry, &pool->entries[pool->count], sizeof(ecc_presign));
+        ForceZero(&pool->entries[pool->count], sizeof(ecc_presign));
+        taken = 1;
+    }
+    low = (pool->count < pool->lowWater);
+    cb = pool->cb;
+    cbCtx = pool->cbCtx;
+    wc_UnLockMutex(&pool->lock);
+
+    if (low && cb != NULL) {
+        cb(key, cbCtx);
+    }
+
+    return taken;
+}
+
+/* Sign with a presignature: s = k^-1.(e + d.r) mod n.
+ *
+ * returns MP_OKAY on success and MP_ZERO_E when s is zero, in which case the
+ * caller signs with a fresh nonce
+ */
+static int ecc_sign_hash_presign(const byte* in, word32 inlen, ecc_key* key,
+                                 const ecc_presign* entry, mp_int* r,
+                                 mp_int* s)
+{
+    int err = MP_OKAY;
+    word32 orderSz = 0;
+    mp_int e[1], kinv[1];
+    DECLARE_CURVE_SPECS(1);
+
+    ALLOC_CURVE_SPECS(1, err);
+    if (err != MP_OKAY) {
+        return err;
+    }
+    err = mp_init_multi(e, kinv, NULL, NULL, NULL, NULL);
+    if (err == MP_OKAY) {
+        err = wc_ecc_curve_load(key->dp, &curve, ECC_CURVE_FIELD_ORDER);
+    }
+    if (err == MP_OKAY) {
+        orderSz = (word32)mp_unsigned_bin_size(curve->order);
+        err = ecc_sign_load_digest(in, inlen, curve->order, e);
+    }
+    if (err == MP_OKAY)
+        err = mp_read_unsigned_bin(kinv, entry->kinv, orderSz);
+    if (err == MP_OKAY)
+        err = mp_read_unsigned_bin(r, entry->r, orderSz);
+
+    /* s = x.r/k */
+    if (err == MP_OKAY)
+        err = mp_mulmod(&key->k, r, curve->order, s);
+    if (err == MP_OKAY)
+        err = mp_mulmod(kinv, s, curve->order, s);
+    /* e' = e/k */
+    if (err == MP_OKAY)
+        err = mp_mulmod(kinv, e, curve->order, e);
+    /* s = e/k + x.r/k = (e + x.r)/k */
+    if (err == MP_OKAY)
+        err = mp_addmod_ct(e, s, curve->order, s);
+    if (err == MP_OKAY && mp_iszero(s) == MP_YES)
+        err = MP_ZERO_E;
+
+    mp_forcezero(kinv);
+    mp_forcezero(e);
+    wc_ecc_curve_free(curve);
+    FREE_CURVE_SPECS();
+
+    return err;
+}
+
+/**
+  Set up a presignature pool on a private key, replacing any existing pool
+  key       A private ECC key
+  depth     Number of presignatures to hold, 0 for WC_ECC_PRESIGN_DEPTH and
+            WC_ECC_PRESIGN_LOW_WATER
+  lowWater  Refill callback is called when fewer entries than this are left
+  return    MP_OKAY if successful
+*/
+int wc_ecc_presign_init(ecc_key* key, word32 depth, word32 lowWater)
+{
+    ecc_presign_pool* pool;
+
+    if (key == NULL || (depth != 0 && lowWater > depth)) {
+        return BAD_FUNC_ARG;
+    }
+    if (depth == 0) {
+        depth = WC_ECC_PRESIGN_DEPTH;
+        lowWater = WC_ECC_PRESIGN_LOW_WATER;
+    }
+
+    wc_ecc_presign_free(key);
+
+    pool = (ecc_presign_pool*)XMALLOC(sizeof(ecc_presign_pool) +
+                                      depth * sizeof(ecc_presign), key->heap,
+                                      DYNAMIC_TYPE_ECC);
+    if (pool == NULL) {
+        return MEMORY_E;
+    }
+    XMEMSET(pool, 0, sizeof(ecc_presign_pool));
+    if (wc_InitMutex(&pool->lock) != 0) {
+        XFREE(pool, key->heap, DYNAMIC_TYPE_ECC);
+        return BAD_MUTEX_E;
+    }
+    pool->entries = (ecc_presign*)(pool + 1);
+    pool->depth = depth;
+    pool->lowWater = lowWater;
+#ifdef WC_ECC_PRESIGN_PID
+    pool->pid = getpid();
+#endif
+    ecc_presign_clear(pool);
+
+    key->presign = pool;
+
+    return MP_OKAY;
+}
+
+/**
+  Set the callback called when signing leaves the pool below its low
+  watermark, e.g. to wake a thread that calls wc_ecc_presign_fill()
+  key       A private ECC key with a presignature pool
+  cb        Callback, NULL for none
+  ctx       Passed to the callback
+  return    MP_OKAY if successful
+*/
+int wc_ecc_presign_set_cb(ecc_key* key, wc_EccPresignCb cb, void* ctx)
+{
+    if (key == NULL || key->presign == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    if (wc_LockMutex(&key->presign->lock) != 0) {
+        return BAD_MUTEX_E;
+    }
+    key->presign->cb = cb;
+    key->presign->cbCtx = ctx;
+    wc_UnLockMutex(&key->presign->lock);
+
+    return MP_OKAY;
+}
+
+/**
+  Add presignatures to the pool of a key until it is full.
+  The work is done outside the pool lock so signing is not held up. The RNG
+  must not be in use by another thread.
+  key       A private ECC key with a presignature pool
+  rng       Random number generator for the nonces
+  max       Most entries to add, 0 for no limit
+  return    Number of entries added, or a negative error
+*/
+int wc_ecc_presign_fill(ecc_key* key, WC_RNG* rng, word32 max)
+{
+    int err = MP_OKAY;
+    word32 added = 0;
+    ecc_presign_pool* pool;
+    ecc_presign entry;
+    DECLARE_CURVE_SPECS(1);
+
+    if (key == NULL || rng == NULL || key->presign == NULL ||
+            key->dp == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    pool = key->presign;
+
+    ALLOC_CURVE_SPECS(1, err);
+    if (err == MP_OKAY) {
+        err = wc_ecc_curve_load(key->dp, &curve, ECC_CURVE_FIELD_ORDER);
+    }
+
+    while (err == MP_OKAY && (max == 0 || added < max)) {
+        int full;
+
+        if (wc_LockMutex(&pool->lock) != 0) {
+            err = BAD_MUTEX_E;
+            break;
+        }
+        ecc_presign_check_pid(pool);
+        full = (pool->dp == key->dp && pool->count >= pool->depth);
+        wc_UnLockMutex(&pool->lock);
+        if (full) {
+            break;
+        }
+
+        err = ecc_presign_make(key, rng, curve, &entry);
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        if (wc_LockMutex(&pool->lock) != 0) {
+            err = BAD_MUTEX_E;
+            break;
+        }
+        ecc_presign_check_pid(pool);
+        /* entries for another curve are of no use once the key changed */
+        if (pool->dp != key->dp) {
+            ecc_presign_clear(pool);
+            pool->dp = key->dp;
+        }
+        if (pool->count < pool->depth) {
+            XMEMCPY(&pool->entries[pool->count], &entry, sizeof(ecc_presign));
+            pool->count++;
+            added++;
+        }
+        wc_UnLockMutex(&pool->lock);
+    }
+
+    ForceZero(&entry, sizeof(entry));
+    wc_ecc_curve_free(curve);
+    FREE_CURVE_SPECS();
+
+    if (err != MP_OKAY) {
+        return err;
+    }
+    return (int)added;
+}
+
+/**
+  Number of presignatures ready to use for the current curve of the key
+  key       A private ECC key with a presignature pool
+  return    Count, or BAD_FUNC_ARG
+*/
+int wc_ecc_presign_count(ecc_key* key)
+{
+    int count = 0;
+
+    if (key == NULL || key->presign == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    if (wc_LockMutex(&key->presign->lock) != 0) {
+        return BAD_MUTEX_E;
+    }
+    ecc_presign_check_pid(key->presign);
+    if (key->presign->dp == key->dp) {
+        count = (int)key->presign->count;
+    }
+    wc_UnLockMutex(&key->presign->lock);
+
+    return count;
+}
+
+/**
+  Zeroize and free the presignature pool of a key, also done by wc_ecc_free()
+  key       The ECC key
+*/
+void wc_ecc_presign_free(ecc_key* key)
+{
+    if (key == NULL || key->presign == NULL) {
+        return;
+    }
+    ecc_presign_clear(key->presign);
+    wc_FreeMutex(&key->presign->lock);
+    XFREE(key->presign, key->heap, DYNAMIC_TYPE_ECC);
+    key->presign = NULL;
+}
+#endif /* WC_ECC_PRESIGN */
+
 /**
   Sign a message digest
   in        The message digest to sign
@@ -3701,10 +4876,68 @@ int wc_ecc_sign_hash_ex(const byte* in, word32 inlen, WC_RNG* rng,
     }
 #endif
 
-   (void)inlen;
-
+#ifdef WC_ECC_PRESIGN
+   if (key->presign != NULL
+   #if defined(WOLFSSL_ECDSA_SET_K) || defined(WOLFSSL_ECDSA_SET_K_ONE_LOOP) || \
+       defined(WOLFSSL_ECDSA_DETERMINISTIC_K) || \
+       defined(WOLFSSL_ECDSA_DETERMINISTIC_K_VARIANT)
+           && key->sign_k == NULL
+   #endif
+       ) {
+       ecc_presign entry;
+
+       if (ecc_presign_take(key, &entry)) {
+           err = ecc_sign_hash_presign(in, inlen, key, &entry, r, s);
+           ForceZero(&entry, sizeof(entry));
+           /* s of zero: sign again with a fresh nonce */
+           if (err != MP_ZERO_E) {
+               return err;
+           }
+       }
+   }
+#endif
 
+#if defined(WOLFSSL_SP_ECC_256) || defined(WOLFSSL_SP_ECC_384) || \
+    defined(WOLFSSL_SP_ECC_521)
+   if (key->idx != ECC_CUSTOM_IDX) {
+       mp_int* sign_k = NULL;
+   #if defined(WOLFSSL_ECDSA_SET_K) || defined(WOLFSSL_ECDSA_SET_K_ONE_LOOP) || \
+       defined(WOLFSSL_ECDSA_DETERMINISTIC_K) || \
+       defined(WOLFSSL_ECDSA_DETERMINISTIC_K_VARIANT)
+       sign_k = key->sign_k;
+   #endif
+   #ifdef WOLFSSL_SP_ECC_256
+       if (ecc_sets[key->idx].id == ECC_SECP256R1) {
+           SAVE_VECTOR_REGISTERS(return _svr_ret;);
+           err = sp_ecc_sign_256(in, inlen, rng, &key->k, r, s, sign_k,
+                                 key->heap);
+           RESTORE_VECTOR_REGISTERS();
+           return err;
+       }
+   #endif
+   #ifdef WOLFSSL_SP_ECC_384
+       if (ecc_sets[key->idx].id == ECC_SECP384R1) {
+           SAVE_VECTOR_REGISTERS(return _svr_ret;);
+           err = sp_ecc_sign_384(in, inlen, rng, &key->k, r, s, sign_k,
+                                 key->heap);
+           RESTORE_VECTOR_REGISTERS();
+           return err;
+       }
+   #endif
+   #ifdef WOLFSSL_SP_ECC_521
+       if (ecc_sets[key->idx].id == ECC_SECP521R1) {
+           SAVE_VECTOR_REGISTERS(return _svr_ret;);
+           err = sp_ecc_sign_521(in, inlen, rng, &key->k, r, s, sign_k,
+                                 key->heap);
+           RESTORE_VECTOR_REGISTERS();
+           return err;
+       }
+   #endif
+       (void)sign_k;
+   }
+#endif
 
+   (void)inlen;
 
    e = &e_lcl;
 
@@ -3731,17 +4964,7 @@ int wc_ecc_sign_hash_ex(const byte* in, word32 inlen, WC_RNG* rng,
 
    /* load digest into e */
    if (err == MP_OKAY) {
-       /* we may need to truncate if hash is longer than key size */
-       word32 orderBits = mp_count_bits(curve->order);
-
-       /* truncate down to byte size, may be all that's needed */
-       if ((WOLFSSL_BIT_SIZE * inlen) > orderBits)
-           inlen = (orderBits + WOLFSSL_BIT_SIZE - 1) / WOLFSSL_BIT_SIZE;
-       err = mp_read_unsigned_bin(e, in, inlen);
-
-       /* may still need bit truncation too */
-       if (err == MP_OKAY && (WOLFSSL_BIT_SIZE * inlen) > orderBits)
-           mp_rshb(e, WOLFSSL_BIT_SIZE - (orderBits & 0x7));
+       err = ecc_sign_load_digest(in, inlen, curve->order, e);
    }
 
    /* make up a key and export the public copy */
@@ -4073,6 +5296,20 @@ int wc_ecc_free(ecc_key* key)
 
 
 
+#ifdef WC_ECC_NONBLOCK
+    /* release an operation that was abandoned part way through */
+    if (key->nb_ctx != NULL) {
+        ecc_nb_free(key->nb_ctx, key->heap);
+    }
+#endif
+#ifdef WC_ECC_VERIFY_TABLE
+    XFREE(key->verifyTable, key->heap, DYNAMIC_TYPE_ECC);
+    key->verifyTable = NULL;
+#endif
+#ifdef WC_ECC_PRESIGN
+    wc_ecc_presign_free(key);
+#endif
+
     mp_clear(key->pubkey.x);
     mp_clear(key->pubkey.y);
     mp_clear(key->pubkey.z);
@@ -4290,9 +5527,9 @@ int ecc_mul2add(ecc_point* A, mp_int* kA,
     err = mp_montgomery_setup(modulus, &mp);
 
   if (err == MP_OKAY) {
-    mp_int  mu[1];
+    DECL_MP_INT_SIZE_DYN(mu, mp_count_bits(modulus), MAX_ECC_BITS);
     if (err == MP_OKAY) {
-        err = mp_init(mu);
+        err = INIT_MP_INT_SIZE(mu, mp_count_bits(modulus));
     }
     if (err == MP_OKAY) {
       err = mp_montgomery_calc_normalization(mu, modulus);
@@ -4349,6 +5586,12 @@ int ecc_mul2add(ecc_point* A, mp_int* kA,
     }
   }
 
+  if (err == MP_OKAY) {
+    /* affine table entries make the additions mixed */
+    err = ecc_map_batch(precomp + 1, SHAMIR_PRECOMP_SZ - 1, modulus, mp, 1,
+                                                                         heap);
+  }
+
   if (err == MP_OKAY) {
     nibble  = 3;
     first   = 1;
@@ -4401,7 +5644,7 @@ int ecc_mul2add(ecc_point* A, mp_int* kA,
                     err = mp_copy(precomp[i]->y, C->y);
 
                 if (err == MP_OKAY)
-                    err = mp_copy(precomp[i]->z, C->z);
+                    err = mp_montgomery_calc_normalization(C->z, modulus);
                 else
                     break;
             } else {
@@ -4438,6 +5681,321 @@ int ecc_mul2add(ecc_point* A, mp_int* kA,
   return err;
 }
 
+#ifdef WC_ECC_VERIFY_TABLE
+/* Build a signed comb table of P.
+ *
+ * P        Affine point in normal form
+ * table    [out] ECC_COMB_ENTRIES entries of x and y
+ * spacing  Bits between comb teeth
+ * coordSz  Bytes in a coordinate
+ * mu       Montgomery normalizer of the modulus
+ * return MP_OKAY on success
+ */
+static int ecc_comb_build(ecc_point* P, byte* table, word32 spacing,
+                          word32 coordSz, mp_int* mu, mp_int* a,
+                          mp_int* modulus, mp_digit mp, void* heap)
+{
+    ecc_point* teeth[ECC_COMB_TEETH];
+    ecc_point* pts[ECC_COMB_ENTRIES];
+    int        err = MP_OKAY;
+    int        i, j;
+    word32     d;
+
+    XMEMSET(teeth, 0, sizeof(teeth));
+    XMEMSET(pts, 0, sizeof(pts));
+    for (i = 0; (err == MP_OKAY) && (i < ECC_COMB_TEETH); i++)
+        err = wc_ecc_new_point_ex(&teeth[i], heap);
+    for (j = 0; (err == MP_OKAY) && (j < ECC_COMB_ENTRIES); j++)
+        err = wc_ecc_new_point_ex(&pts[j], heap);
+
+    /* teeth: 2^(i * spacing) * P in Montgomery form */
+    if (err == MP_OKAY)
+        err = mp_mulmod(P->x, mu, modulus, teeth[0]->x);
+    if (err == MP_OKAY)
+        err = mp_mulmod(P->y, mu, modulus, teeth[0]->y);
+    if (err == MP_OKAY)
+        err = mp_copy(mu, teeth[0]->z);
+    for (i = 1; (err == MP_OKAY) && (i < ECC_COMB_TEETH); i++) {
+        err = wc_ecc_copy_point(teeth[i - 1], teeth[i]);
+        for (d = 0; (err == MP_OKAY) && (d < spacing); d++) {
+            err = ecc_projective_dbl_point_safe(teeth[i], teeth[i], a,
+                                                modulus, mp);
+        }
+    }
+
+    /* entry 0 is the top tooth minus the others, setting bit i of an entry
+     * adds twice tooth i */
+    if (err == MP_OKAY)
+        err = wc_ecc_copy_point(teeth[ECC_COMB_TEETH - 1], pts[0]);
+    for (i = 0; (err == MP_OKAY) && (i < ECC_COMB_TEETH - 1); i++) {
+        err = mp_sub(modulus, teeth[i]->y, teeth[i]->y);
+        if (err == MP_OKAY) {
+            err = ecc_projective_add_point_safe(pts[0], teeth[i], pts[0], a,
+                                                modulus, mp, NULL);
+        }
+        if (err == MP_OKAY)
+            err = mp_sub(modulus, teeth[i]->y, teeth[i]->y);
+        if (err == MP_OKAY) {
+            err = ecc_projective_dbl_point_safe(teeth[i], teeth[i], a,
+                                                modulus, mp);
+        }
+    }
+    /* affine teeth make the additions below mixed */
+    if (err == MP_OKAY) {
+        err = ecc_map_batch(teeth, ECC_COMB_TEETH - 1, modulus, mp, 1,
+                                                                        heap);
+    }
+    for (j = 1; (err == MP_OKAY) && (j < ECC_COMB_ENTRIES); j++) {
+        for (i = ECC_COMB_TEETH - 2; (j >> i) == 0; i--) {
+        }
+        err = ecc_projective_add_point_safe(pts[j ^ (1 << i)], teeth[i],
+                                            pts[j], a, modulus, mp, NULL);
+    }
+
+    for (j = 0; (err == MP_OKAY) && (j < ECC_COMB_ENTRIES); j++) {
+        if (mp_iszero(pts[j]->x) && mp_iszero(pts[j]->y))
+            err = ECC_INF_E;
+    }
+    /* entries stay in Montgomery form for mixed additions */
+    if (err == MP_OKAY)
+        err = ecc_map_batch(pts, ECC_COMB_ENTRIES, modulus, mp, 1, heap);
+
+    for (j = 0; (err == MP_OKAY) && (j < ECC_COMB_ENTRIES); j++) {
+        byte* entry = table + (word32)j * 2 * coordSz;
+
+        err = mp_to_unsigned_bin_len(pts[j]->x, entry, (int)coordSz);
+        if (err == MP_OKAY)
+            err = mp_to_unsigned_bin_len(pts[j]->y, entry + coordSz,
+                                                                (int)coordSz);
+    }
+
+    for (i = 0; i < ECC_COMB_TEETH; i++)
+        wc_ecc_del_point_ex(teeth[i], heap);
+    for (j = 0; j < ECC_COMB_ENTRIES; j++)
+        wc_ecc_del_point_ex(pts[j], heap);
+
+    return err;
+}
+
+/* Computes kG*G + kQ*Q = C with the comb tables of a verify table.
+ * Scalars are public so this is not constant time.
+ */
+static int ecc_verify_table_mul2add(const ecc_verify_table* table, mp_int* kG,
+                                    mp_int* kQ, ecc_point* C, mp_int* a,
+                                    mp_int* modulus, mp_int* order, void* heap)
+{
+    byte       sG[MAX_ECC_BYTES + 1];
+    byte       sQ[MAX_ECC_BYTES + 1];
+    word32     sSz = (table->spacing * ECC_COMB_TEETH + 7) / WOLFSSL_BIT_SIZE;
+    ecc_point* T = NULL;
+    mp_digit   mp = 0;
+    int        err;
+    int        negG = 0;
+    int        negQ = 0;
+    int        first = 1;
+    int        idx;
+    int        sign;
+    word32     col;
+
+    if (sSz > sizeof(sG)) {
+        return BAD_FUNC_ARG;
+    }
+
+    err = ecc_comb_recode(kG, order, table->spacing, sG, sSz, &negG);
+    if (err == MP_OKAY)
+        err = ecc_comb_recode(kQ, order, table->spacing, sQ, sSz, &negQ);
+    if (err == MP_OKAY)
+        err = wc_ecc_new_point_ex(&T, heap);
+    if (err == MP_OKAY)
+        err = mp_montgomery_setup(modulus, &mp);
+
+    for (col = table->spacing; (err == MP_OKAY) && (col-- > 0); ) {
+        if (!first)
+            err = ecc_projective_dbl_point_safe(C, C, a, modulus, mp);
+        if (err == MP_OKAY) {
+            idx = ecc_comb_digit(sG, sSz, table->spacing, col, &sign);
+            err = ecc_comb_load(table->G, table->coordSz, idx, sign ^ negG, 0,
+                                T, modulus);
+        }
+        if (err == MP_OKAY)
+            err = ecc_comb_accum(C, T, &first, a, modulus, mp);
+        if (err == MP_OKAY) {
+            idx = ecc_comb_digit(sQ, sSz, table->spacing, col, &sign);
+            err = ecc_comb_load(table->Q, table->coordSz, idx, sign ^ negQ, 0,
+                                T, modulus);
+        }
+        if (err == MP_OKAY)
+            err = ecc_comb_accum(C, T, &first, a, modulus, mp);
+    }
+
+    if (err == MP_OKAY) {
+        if (first) {
+            /* sum is infinity */
+            mp_zero(C->x);
+            mp_zero(C->y);
+            err = mp_set(C->z, 1);
+        }
+        else {
+            err = ecc_map(C, modulus, mp);
+        }
+    }
+
+    wc_ecc_del_point_ex(T, heap);
+    return err;
+}
+
+/* Check the verify table was built for the current public key. */
+static int ecc_verify_table_match(ecc_key* key)
+{
+    const ecc_verify_table* table = key->verifyTable;
+    byte                    q[2 * MAX_ECC_BYTES];
+
+    if (table == NULL || table->coordSz != (word32)key->dp->size ||
+                                                   !mp_isone(key->pubkey.z)) {
+        return 0;
+    }
+    if (mp_to_unsigned_bin_len(key->pubkey.x, q, (int)table->coordSz) !=
+                                                                      MP_OKAY ||
+        mp_to_unsigned_bin_len(key->pubkey.y, q + table->coordSz,
+                                            (int)table->coordSz) != MP_OKAY) {
+        return 0;
+    }
+    return XMEMCMP(q, table->qx, 2 * table->coordSz) == 0;
+}
+
+/* Precompute a comb table of the public key so that later verifications with
+ * this key need about a sixth of the point doublings. The base point uses the
+ * static table of its curve, or gets a table here when there is none.
+ * Worth it for keys that verify many signatures, such as CA keys.
+ * The table is used until the public key changes and freed by wc_ecc_free().
+ * No table is made for curves with a dedicated implementation.
+ *
+ * key  Public key on a named curve
+ * return MP_OKAY on success
+ */
+int wc_ecc_make_verify_table(ecc_key* key)
+{
+    int               err = MP_OKAY;
+    word32            spacing = 0, coordSz = 0, entriesSz = 0;
+    ecc_verify_table* table = NULL;
+    const byte*       baseTable = NULL;
+    byte*             gTable = NULL;
+    ecc_point*        G = NULL;
+    DECL_MP_INT_SIZE(mu, MAX_ECC_BITS);
+    mp_digit          mp = 0;
+    DECLARE_CURVE_SPECS(ECC_CURVE_FIELD_COUNT);
+
+    if (key == NULL || key->dp == NULL || wc_ecc_is_valid_idx(key->idx) == 0 ||
+            key->type == ECC_PRIVATEKEY_ONLY || !mp_isone(key->pubkey.z)) {
+        return BAD_FUNC_ARG;
+    }
+
+    XFREE(key->verifyTable, key->heap, DYNAMIC_TYPE_ECC);
+    key->verifyTable = NULL;
+
+    /* SP verification does not use the table */
+#ifdef WOLFSSL_SP_ECC_256
+    if (key->idx != ECC_CUSTOM_IDX && key->dp->id == ECC_SECP256R1) {
+        return MP_OKAY;
+    }
+#endif
+#ifdef WOLFSSL_SP_ECC_384
+    if (key->idx != ECC_CUSTOM_IDX && key->dp->id == ECC_SECP384R1) {
+        return MP_OKAY;
+    }
+#endif
+#ifdef WOLFSSL_SP_ECC_521
+    if (key->idx != ECC_CUSTOM_IDX && key->dp->id == ECC_SECP521R1) {
+        return MP_OKAY;
+    }
+#endif
+
+    ALLOC_CURVE_SPECS(ECC_CURVE_FIELD_COUNT, err);
+    if (err != 0) {
+        return err;
+    }
+    err = wc_ecc_curve_load(key->dp, &curve, ECC_CURVE_FIELD_ALL);
+
+    if (err == MP_OKAY) {
+        spacing = ecc_comb_spacing(curve->order);
+        coordSz = (word32)key->dp->size;
+        if (coordSz > MAX_ECC_BYTES ||
+             (spacing * ECC_COMB_TEETH + 7) / WOLFSSL_BIT_SIZE >
+                                                           MAX_ECC_BYTES + 1) {
+            err = BAD_FUNC_ARG;
+        }
+    }
+#ifdef WC_ECC_FIXED_BASE
+    if (err == MP_OKAY)
+        baseTable = ecc_comb_base_table(key, curve->prime);
+#endif
+    if (err == MP_OKAY) {
+        entriesSz = ECC_COMB_ENTRIES * 2 * coordSz;
+        table = (ecc_verify_table*)XMALLOC(sizeof(ecc_verify_table) +
+                    2 * coordSz + entriesSz + (baseTable == NULL ? entriesSz : 0),
+                    key->heap, DYNAMIC_TYPE_ECC);
+        if (table == NULL) {
+            err = MEMORY_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        table->spacing = spacing;
+        table->coordSz = coordSz;
+        table->qx = (byte*)(table + 1);
+        table->Q = table->qx + 2 * coordSz;
+        if (baseTable == NULL) {
+            gTable = table->Q + entriesSz;
+            baseTable = gTable;
+        }
+        table->G = baseTable;
+
+        err = mp_to_unsigned_bin_len(key->pubkey.x, table->qx, (int)coordSz);
+    }
+    if (err == MP_OKAY) {
+        err = mp_to_unsigned_bin_len(key->pubkey.y, table->qx + coordSz,
+                                                                  (int)coordSz);
+    }
+
+    if (err == MP_OKAY) {
+        err = INIT_MP_INT_SIZE(mu, MAX_ECC_BITS);
+        if (err == MP_OKAY)
+            err = mp_montgomery_calc_normalization(mu, curve->prime);
+        if (err == MP_OKAY)
+            err = mp_montgomery_setup(curve->prime, &mp);
+        if (err == MP_OKAY && gTable != NULL) {
+            err = wc_ecc_new_point_ex(&G, key->heap);
+            if (err == MP_OKAY)
+                err = mp_copy(curve->Gx, G->x);
+            if (err == MP_OKAY)
+                err = mp_copy(curve->Gy, G->y);
+            if (err == MP_OKAY)
+                err = mp_set(G->z, 1);
+            if (err == MP_OKAY) {
+                err = ecc_comb_build(G, gTable, spacing, coordSz, mu,
+                                     curve->Af, curve->prime, mp, key->heap);
+            }
+        }
+        if (err == MP_OKAY) {
+            err = ecc_comb_build(&key->pubkey, table->Q, spacing, coordSz, mu,
+                                 curve->Af, curve->prime, mp, key->heap);
+        }
+        mp_clear(mu);
+    }
+
+    if (err == MP_OKAY) {
+        key->verifyTable = table;
+    }
+    else {
+        XFREE(table, key->heap, DYNAMIC_TYPE_ECC);
+    }
+
+    wc_ecc_del_point_ex(G, key->heap);
+    wc_ecc_curve_free(curve);
+    FREE_CURVE_SPECS();
+
+    return err;
+}
+#endif /* WC_ECC_VERIFY_TABLE */
 
 
 /* verify
@@ -4635,7 +6193,36 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
   }
 #endif
 
-
+#ifdef WOLFSSL_SP_ECC_256
+   if (key->idx != ECC_CUSTOM_IDX &&
+           ecc_sets[key->idx].id == ECC_SECP256R1) {
+       SAVE_VECTOR_REGISTERS(return _svr_ret;);
+       err = sp_ecc_verify_256(hash, hashlen, key->pubkey.x, key->pubkey.y,
+           key->pubkey.z, r, s, res, key->heap);
+       RESTORE_VECTOR_REGISTERS();
+       return err;
+   }
+#endif
+#ifdef WOLFSSL_SP_ECC_384
+   if (key->idx != ECC_CUSTOM_IDX &&
+           ecc_sets[key->idx].id == ECC_SECP384R1) {
+       SAVE_VECTOR_REGISTERS(return _svr_ret;);
+       err = sp_ecc_verify_384(hash, hashlen, key->pubkey.x, key->pubkey.y,
+           key->pubkey.z, r, s, res, key->heap);
+       RESTORE_VECTOR_REGISTERS();
+       return err;
+   }
+#endif
+#ifdef WOLFSSL_SP_ECC_521
+   if (key->idx != ECC_CUSTOM_IDX &&
+           ecc_sets[key->idx].id == ECC_SECP521R1) {
+       SAVE_VECTOR_REGISTERS(return _svr_ret;);
+       err = sp_ecc_verify_521(hash, hashlen, key->pubkey.x, key->pubkey.y,
+           key->pubkey.z, r, s, res, key->heap);
+       RESTORE_VECTOR_REGISTERS();
+       return err;
+   }
+#endif
 
    ALLOC_CURVE_SPECS(ECC_CURVE_FIELD_COUNT, err);
    if (err != 0) {
@@ -4690,7 +6277,7 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
 
    /*  w  = s^-1 mod n */
    if (err == MP_OKAY)
-       err = mp_invmod(s, curve->order, w);
+       err = mp_invmod_ct(s, curve->order, w);
 
    /* u1 = ew */
    if (err == MP_OKAY)
@@ -4724,6 +6311,22 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
    if (err == MP_OKAY)
        err = wc_ecc_point_add(mG, mQ, mG, curve->prime);
 #else
+  #ifdef WC_ECC_NONBLOCK
+    /* compute u1*mG + u2*mQ over several calls */
+    if (err == MP_OKAY && key->nb_ctx != NULL) {
+        err = ecc_mul2add_nb(key->nb_ctx, mG, u1, mQ, u2, mG, curve->Af,
+                                      curve->prime, curve->order, key->heap);
+    }
+    else
+  #endif
+  #ifdef WC_ECC_VERIFY_TABLE
+    /* comb tables built for this key */
+    if (err == MP_OKAY && ecc_verify_table_match(key)) {
+        err = ecc_verify_table_mul2add(key->verifyTable, u1, u2, mG,
+                              curve->Af, curve->prime, curve->order, key->heap);
+    }
+    else
+  #endif
     /* use Shamir's trick to compute u1*mG + u2*mQ using half the doubles */
     if (err == MP_OKAY) {
         err = ecc_mul2add(mG, u1, mQ, u2, mG, curve->Af, curve->prime,
@@ -0,0 +1,1162 @@
+/* ecc_comb.i
+ *
+ * Copyright (C) 2006-2021 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+/* Signed comb tables of the NIST curve base points, included by ecc.c.
+ * Generated by scripts/ecc_comb_gen.py - regenerate rather than edit.
+ * Spacing is the order bits divided by ECC_COMB_TEETH, rounded up.
+ * Entry m is 2^(5*spacing)*G plus, for j = 0..4, 2^(j*spacing)*G when bit j
+ * of m is set and minus it when not. Each entry is affine x then y,
+ * big-endian, in Montgomery form for R = 2^(64 * ceil(prime bits / 64)).
+ * A table is only used when the math library's Montgomery R matches.
+ */
+
+#ifdef ECC224
+/* SECP224R1: spacing 38, Montgomery R = 2^256 */
+static const byte ecc_comb_secp224r1[ECC_COMB_ENTRIES * 2 * 28] = {
+    /* 0 */
+    0xa6, 0x60, 0x62, 0xa0, 0xd6, 0xf1, 0xe6, 0x50, 0x63, 0x8f, 0x82, 0xa6,
+    0x9c, 0x54, 0x03, 0xe7, 0x80, 0x4c, 0x4f, 0x88, 0x74, 0x15, 0x9d, 0x6c,
+    0x88, 0xca, 0x52, 0x55, 0x35, 0xbb, 0x59, 0xff, 0xb7, 0x96, 0xbe, 0x16,
+    0xbc, 0xd0, 0x33, 0x26, 0xb3, 0x1b, 0xb1, 0xee, 0xf7, 0x3c, 0x76, 0x3a,
+    0x7c, 0x7d, 0x33, 0xf3, 0xc9, 0x11, 0x93, 0x36,
+    /* 1 */
+    0x37, 0xf0, 0x35, 0xf6, 0xaf, 0x89, 0x45, 0x70, 0x93, 0x5b, 0xff, 0x64,
+    0x9d, 0xa6, 0xbb, 0xd5, 0xd5, 0xe8, 0xb5, 0x50, 0x97, 0xd9, 0x36, 0x3a,
+    0xbd, 0x2b, 0x96, 0xb2, 0x9d, 0x9f, 0x81, 0xdf, 0x65, 0x4b, 0x51, 0x90,
+    0x46, 0x5f, 0x19, 0x36, 0x36, 0x8d, 0x3f, 0xc6, 0x20, 0xb2, 0xee, 0x05,
+    0xa0, 0xb1, 0xf8, 0xfb, 0xa7, 0x84, 0xc4, 0x64,
+    /* 2 */
+    0x14, 0x03, 0xa8, 0x65, 0x8c, 0xcb, 0xcd, 0x35, 0x52, 0xd7, 0x3a, 0x87,
+    0xee, 0xb7, 0x68, 0x7b, 0x27, 0xb7, 0x14, 0xa3, 0x87, 0x28, 0x9d, 0x95,
+    0xc0, 0x7e, 0xd8, 0xb0, 0x34, 0x00, 0x67, 0xb4, 0xac, 0x5a, 0x47, 0x68,
+    0x0a, 0x9f, 0xc8, 0xe9, 0x73, 0xf9, 0x92, 0x5a, 0xcd, 0x51, 0x4d, 0x22,
+    0xca, 0xbc, 0x52, 0xb2, 0x3e, 0x25, 0x57, 0x43,
+    /* 3 */
+    0x52, 0x35, 0x41, 0x14, 0xfb, 0x0b, 0x45, 0x63, 0xa9, 0xde, 0xdc, 0x3a,
+    0xec, 0x87, 0x2e, 0x99, 0x75, 0x3d, 0x34, 0x47, 0x43, 0xd3, 0x5f, 0xf5,
+    0x9b, 0x97, 0x64, 0x80, 0x1f, 0x3a, 0xdb, 0x53, 0xf2, 0x07, 0x97, 0xd1,
+    0x0d, 0x48, 0x6e, 0x91, 0x34, 0xb4, 0x5f, 0x42, 0x0d, 0x95, 0xf4, 0x9f,
+    0x51, 0x6d, 0x0f, 0xef, 0x86, 0xb4, 0x87, 0x8e,
+    /* 4 */
+    0x63, 0x66, 0x1d, 0xe2, 0x8a, 0x42, 0xdd, 0x78, 0x7b, 0xe6, 0x4f, 0x7f,
+    0x52, 0x66, 0x61, 0xca, 0xf7, 0xe2, 0x96, 0x7f, 0x6c, 0x53, 0x09, 0xbe,
+    0x29, 0xd6, 0xf6, 0xf8, 0x55, 0x28, 0x72, 0x86, 0xa7, 0xf4, 0xb2, 0x47,
+    0x6a, 0x19, 0x7f, 0x1a, 0x83, 0x42, 0x15, 0xe7, 0xea, 0x9c, 0x79, 0x4b,
+    0x13, 0x9e, 0xb7, 0x1e, 0x5e, 0x6a, 0xbb, 0xb6,
+    /* 5 */
+    0x4f, 0x00, 0xcb, 0x46, 0xb9, 0x0e, 0x5b, 0x30, 0xf2, 0xfb, 0x83, 0xb5,
+    0x4b, 0xa2, 0x30, 0xd0, 0xcf, 0xa8, 0x73, 0x56, 0x7d, 0xc5, 0xfc, 0x82,
+    0xd0, 0xfa, 0xda, 0xd3, 0xa5, 0xf3, 0x71, 0xf3, 0xd1, 0x70, 0x1a, 0xf5,
+    0x03, 0x06, 0x89, 0xd9, 0x2f, 0xf0, 0xe3, 0xe4, 0xab, 0x52, 0xfa, 0xd9,
+    0xa1, 0x15, 0xee, 0x2e, 0x7d, 0xbf, 0x20, 0x36,
+    /* 6 */
+    0x5c, 0x62, 0x33, 0xa2, 0x24, 0xc3, 0x5d, 0x74, 0x73, 0x28, 0xf4, 0x04,
+    0x9a, 0xc0, 0x99, 0x54, 0xe6, 0xc7, 0xbc, 0x07, 0x03, 0x4b, 0x3b, 0x72,
+    0xfd, 0xc3, 0x5f, 0x46, 0x40, 0xc6, 0xf2, 0x55, 0xc3, 0x2b, 0x50, 0xa4,
+    0xd3, 0x9a, 0x47, 0xbb, 0x6b, 0xf1, 0x89, 0x38, 0x65, 0xb7, 0xae, 0x48,
+    0x70, 0xba, 0x08, 0xf3, 0xca, 0x6e, 0xef, 0x84,
+    /* 7 */
+    0x3c, 0x64, 0x77, 0x50, 0x9d, 0x1b, 0x3e, 0xb6, 0x20, 0xf6, 0xc0, 0x40,
+    0x08, 0x7f, 0x41, 0xc0, 0xe0, 0x67, 0x16, 0x6b, 0xb4, 0xfb, 0x41, 0x13,
+    0x87, 0xc3, 0x15, 0x8e, 0x75, 0x52, 0x3d, 0xaa, 0x9f, 0xa6, 0x95, 0x1b,
+    0x15, 0xcb, 0x69, 0x9e, 0xf2, 0x3c, 0x81, 0xc8, 0x27, 0x38, 0xb8, 0xa4,
+    0x84, 0xef, 0xc6, 0x19, 0x84, 0x81, 0x7e, 0xd6,
+    /* 8 */
+    0x24, 0x69, 0x4d, 0xba, 0xb1, 0x6e, 0x77, 0x17, 0xab, 0xa5, 0x37, 0xe0,
+    0x01, 0xf7, 0x37, 0xb3, 0x9b, 0xf9, 0x86, 0xfe, 0x47, 0xb0, 0x1c, 0xb5,
+    0x9a, 0x9a, 0x95, 0x27, 0x60, 0x37, 0x6f, 0x1c, 0xbc, 0x92, 0xa3, 0x81,
+    0x4b, 0xd3, 0x0d, 0x49, 0xd2, 0xdb, 0x7f, 0x31, 0x44, 0xd7, 0x49, 0x1c,
+    0x68, 0x7d, 0xa7, 0xd8, 0xf7, 0x1f, 0xc0, 0x7d,
+    /* 9 */
+    0x8b, 0x38, 0x51, 0x43, 0x50, 0x3d, 0x66, 0x17, 0x6e, 0x9d, 0x19, 0x56,
+    0xf6, 0xbb, 0x56, 0x2e, 0x1b, 0xa5, 0x99, 0x08, 0x52, 0x9f, 0x6f, 0xf4,
+    0x17, 0x67, 0x09, 0xa7, 0x18, 0x66, 0x17, 0x01, 0x24, 0x98, 0xc6, 0x1e,
+    0xc9, 0xf7, 0xb8, 0x20, 0xa7, 0x16, 0xb5, 0x29, 0x9b, 0x40, 0x71, 0xb8,
+    0x9d, 0x11, 0x8e, 0x8b, 0x48, 0x36, 0x02, 0xad,
+    /* 10 */
+    0x8a, 0x3c, 0xcf, 0x38, 0x81, 0x48, 0x17, 0x47, 0x80, 0x80, 0x94, 0x4b,
+    0x92, 0x15, 0x7f, 0x00, 0x4d, 0x87, 0x07, 0x56, 0x45, 0x0c, 0x7a, 0x5d,
+    0xa3, 0xf4, 0xc0, 0xbc, 0xb0, 0x9a, 0x54, 0x0a, 0x26, 0x28, 0x37, 0xf0,
+    0x2e, 0x27, 0x8d, 0xaf, 0x8d, 0x8e, 0x3a, 0x66, 0x62, 0x4f, 0x70, 0xc4,
+    0x88, 0x91, 0xea, 0x9b, 0x36, 0x37, 0x73, 0xa5,
+    /* 11 */
+    0x69, 0xba, 0x17, 0x54, 0xbc, 0x38, 0x1c, 0xb1, 0x4a, 0x6c, 0xe6, 0xef,
+    0xd7, 0xb3, 0x83, 0xd1, 0x5e, 0x29, 0x92, 0xb1, 0xa6, 0x55, 0x98, 0x0f,
+    0x64, 0xe6, 0x01, 0x2e, 0x1a, 0x91, 0xd8, 0x00, 0xd9, 0xbd, 0xb1, 0xb3,
+    0x99, 0x23, 0x1a, 0xcb, 0x78, 0x31, 0xea, 0x43, 0x67, 0xf1, 0x01, 0xa5,
+    0xcb, 0x77, 0x45, 0x25, 0x4d, 0xf6, 0xb0, 0x55,
+    /* 12 */
+    0x96, 0xe3, 0x8d, 0xe3, 0x37, 0xea, 0x46, 0xdd, 0xbf, 0x1d, 0x7e, 0x8f,
+    0x65, 0x1d, 0xfe, 0x40, 0x95, 0xfd, 0xa5, 0x8e, 0x0d, 0x4f, 0x33, 0x70,
+    0x72, 0x87, 0xec, 0x76, 0x98, 0x2d, 0x22, 0x39, 0xe5, 0xc7, 0xc2, 0x80,
+    0xab, 0x70, 0x3d, 0x6d, 0xe1, 0x26, 0x11, 0x0f, 0x5c, 0x66, 0x7f, 0x25,
+    0x43, 0x2b, 0x9e, 0xdc, 0x6c, 0xb6, 0x93, 0x0f,
+    /* 13 */
+    0xfb, 0xd4, 0xff, 0x5b, 0xfe, 0x58, 0xb6, 0x21, 0xee, 0xaf, 0xee, 0x1f,
+    0xd6, 0xae, 0x58, 0x6e, 0x8c, 0x13, 0x3c, 0x83, 0x4b, 0x0f, 0xef, 0x06,
+    0x1b, 0x20, 0xa4, 0xc9, 0x19, 0x2c, 0x67, 0xc2, 0x7a, 0x4c, 0x7f, 0x4d,
+    0x79, 0x88, 0x88, 0xfd, 0x9c, 0xbe, 0x0f, 0xf0, 0xb1, 0xf3, 0x2f, 0x2d,
+    0xe5, 0x8e, 0x0c, 0x8f, 0xce, 0xa0, 0xb9, 0x05,
+    /* 14 */
+    0x89, 0xba, 0x6a, 0x52, 0xb9, 0x08, 0x4c, 0xc4, 0x42, 0x32, 0xe7, 0x83,
+    0x76, 0xd7, 0x06, 0xd3, 0x6e, 0x0a, 0xce, 0x2f, 0x72, 0x91, 0x4e, 0x7f,
+    0x87, 0xa8, 0xee, 0x9f, 0xfe, 0xe7, 0x7d, 0x15, 0xc9, 0xdd, 0xd5, 0xf2,
+    0xd2, 0xd6, 0x45, 0x6b, 0x79, 0xb6, 0x75, 0x55, 0x4b, 0x0e, 0x76, 0x29,
+    0x37, 0xf7, 0x04, 0xf2, 0x59, 0x5f, 0xa7, 0x47,
+    /* 15 */
+    0x06, 0x97, 0x16, 0x3a, 0x8e, 0x37, 0x77, 0xe6, 0x7e, 0x62, 0x3b, 0x5d,
+    0xef, 0xd2, 0x9f, 0xf8, 0xc8, 0xbe, 0x2d, 0x58, 0xf6, 0x83, 0x33, 0xc3,
+    0xd7, 0x50, 0x96, 0xf7, 0xec, 0x33, 0x96, 0x39, 0x4a, 0xaf, 0x46, 0x9a,
+    0x3b, 0x9e, 0xaf, 0x11, 0x4b, 0x05, 0x32, 0x47, 0xe8, 0x0f, 0x10, 0xf2,
+    0x69, 0x7a, 0x62, 0x1e, 0x56, 0xfb, 0x85, 0x6a,
+    /* 16 */
+    0xb3, 0xae, 0xa1, 0xf6, 0x3a, 0xc7, 0x3b, 0xd0, 0x5f, 0x56, 0x4c, 0xe4,
+    0x9b, 0x7d, 0x3b, 0xb0, 0x85, 0xd6, 0xc4, 0x28, 0xe9, 0xae, 0x99, 0x47,
+    0xc2, 0x66, 0x60, 0xab, 0xe4, 0x53, 0xea, 0x8c, 0xa0, 0x69, 0xea, 0x95,
+    0x44, 0xfb, 0xe7, 0x37, 0xc0, 0xb9, 0x85, 0xa6, 0x19, 0x20, 0xe0, 0x37,
+    0xab, 0x41, 0xc9, 0x96, 0x0b, 0x22, 0x36, 0x33,
+    /* 17 */
+    0x88, 0xa8, 0xbe, 0x4e, 0x6f, 0x70, 0x49, 0x1c, 0xf3, 0xda, 0xbf, 0x3a,
+    0x11, 0xdc, 0x50, 0xab, 0x25, 0x0a, 0x26, 0xc7, 0xcb, 0x44, 0x5d, 0x3e,
+    0xcb, 0xf1, 0x89, 0xc3, 0x89, 0x96, 0xd8, 0x14, 0xc5, 0x14, 0x59, 0x33,
+    0xeb, 0xf0, 0x32, 0xd2, 0x58, 0xea, 0x4a, 0xca, 0x2f, 0xb5, 0xb6, 0x59,
+    0xc2, 0xb2, 0xf5, 0x10, 0x78, 0x9c, 0x7f, 0x1b,
+    /* 18 */
+    0xd1, 0xf5, 0xad, 0x7a, 0x8a, 0xfb, 0xbc, 0x6e, 0x06, 0xaa, 0x1b, 0x84,
+    0xc1, 0x34, 0xfb, 0x09, 0x76, 0x35, 0x50, 0x7b, 0xa5, 0x90, 0x13, 0x6d,
+    0x3a, 0xbb, 0xcf, 0x89, 0xe4, 0x08, 0x14, 0xed, 0xcc, 0xe6, 0xa4, 0xe0,
+    0xba, 0x7c, 0x5b, 0x90, 0xbe, 0x67, 0x9a, 0x05, 0x31, 0x1a, 0xce, 0xfc,
+    0x5d, 0x8d, 0x05, 0xc9, 0x83, 0xe6, 0x23, 0x46,
+    /* 19 */
+    0x6c, 0x15, 0x00, 0x25, 0x29, 0xc7, 0x5b, 0x4e, 0xa4, 0xf0, 0x44, 0x3e,
+    0x3d, 0x0d, 0xe1, 0x6f, 0x37, 0xc6, 0x74, 0xdc, 0xba, 0xac, 0x33, 0xaf,
+    0xe6, 0x7e, 0x40, 0x28, 0xf1, 0x0a, 0x3a, 0x62, 0x81, 0xde, 0x2d, 0x5a,
+    0xd6, 0x35, 0xd0, 0x73, 0xcd, 0x52, 0x88, 0xcb, 0x4b, 0x70, 0xb4, 0xa8,
+    0x58, 0xc4, 0x12, 0x5a, 0xa2, 0x26, 0x4f, 0x9a,
+    /* 20 */
+    0x45, 0xd5, 0xfe, 0xb1, 0x5f, 0x5b, 0x78, 0xa6, 0xab, 0x3d, 0xff, 0x41,
+    0xcd, 0x15, 0x00, 0x1a, 0x9d, 0x7f, 0x65, 0x4b, 0xc5, 0xb2, 0x98, 0x96,
+    0x33, 0xc6, 0x72, 0x9f, 0x75, 0x55, 0x0f, 0xc9, 0x2f, 0x61, 0xdb, 0x6a,
+    0xa1, 0xff, 0x1b, 0xca, 0x97, 0x7a, 0x30, 0x4d, 0x98, 0xc5, 0x14, 0x99,
+    0x7a, 0x6e, 0xda, 0x61, 0x69, 0xf0, 0xb0, 0x3e,
+    /* 21 */
+    0x0f, 0x23, 0x16, 0x1a, 0x87, 0x97, 0x85, 0xae, 0x86, 0x57, 0x0b, 0x2e,
+    0x92, 0x75, 0x32, 0x9d, 0x3c, 0x73, 0xca, 0x9a, 0xd1, 0xe1, 0xff, 0x96,
+    0xcb, 0x05, 0x3d, 0x62, 0x09, 0x0d, 0x4a, 0xd4, 0x6f, 0x22, 0x98, 0x93,
+    0xb4, 0xb8, 0xa2, 0xb8, 0xa9, 0x12, 0xa2, 0xb1, 0x15, 0x91, 0xfc, 0xd1,
+    0x72, 0xf5, 0x25, 0xe4, 0x15, 0xe1, 0x57, 0xd0,
+    /* 22 */
+    0x72, 0xc6, 0xa4, 0xd0, 0x1a, 0x43, 0x4c, 0x87, 0xce, 0x54, 0xeb, 0xed,
+    0xa1, 0xa3, 0xbc, 0xa3, 0x60, 0xca, 0xa8, 0xf8, 0x86, 0xf9, 0xa0, 0xe3,
+    0x3a, 0x03, 0xf0, 0x86, 0xa7, 0xfe, 0xc8, 0xf1, 0x77, 0x66, 0x1c, 0x2a,
+    0xc3, 0x7d, 0x3f, 0xd5, 0xe4, 0x52, 0x93, 0xd5, 0x52, 0xfb, 0x41, 0x17,
+    0x8f, 0x4a, 0x00, 0x28, 0x78, 0xb8, 0xb0, 0x07,
+    /* 23 */
+    0x94, 0xd0, 0x1d, 0x03, 0x05, 0xc9, 0x71, 0xf7, 0x48, 0xc3, 0xb7, 0x77,
+    0x1d, 0x97, 0x48, 0x15, 0xeb, 0xd6, 0x00, 0x88, 0x04, 0xe4, 0x6e, 0xe2,
+    0xbb, 0x01, 0x1c, 0xde, 0xfb, 0x92, 0xc8, 0x89, 0x73, 0xa2, 0x9b, 0x29,
+    0xc8, 0x12, 0xd1, 0x6e, 0xd6, 0xa9, 0xdb, 0x4b, 0x86, 0x93, 0x06, 0x58,
+    0xc8, 0x27, 0x28, 0x84, 0x7d, 0x8f, 0xfa, 0x18,
+    /* 24 */
+    0x1c, 0xf5, 0x2e, 0xe7, 0xef, 0x87, 0x71, 0xd3, 0x5d, 0x5d, 0x05, 0xde,
+    0x0c, 0xa9, 0x41, 0x83, 0xd8, 0x4b, 0x34, 0xdf, 0x59, 0x64, 0x24, 0x93,
+    0x11, 0x29, 0x65, 0x02, 0x86, 0xb1, 0x42, 0x58, 0x27, 0x63, 0xa5, 0x6e,
+    0x6a, 0xe8, 0xcf, 0x66, 0xff, 0xe4, 0x47, 0xf8, 0x4a, 0x19, 0x80, 0x03,
+    0x28, 0xb1, 0xce, 0xb8, 0xbc, 0xb8, 0xc3, 0x35,
+    /* 25 */
+    0x0d, 0xa3, 0x44, 0x28, 0x63, 0x0d, 0x80, 0xa7, 0xd0, 0x38, 0x02, 0x93,
+    0x0d, 0x46, 0x52, 0xb9, 0xd0, 0x30, 0x09, 0xf7, 0x22, 0xdf, 0x60, 0x4a,
+    0x1f, 0x01, 0x02, 0x77, 0x37, 0xe0, 0xf2, 0x54, 0xcb, 0xe9, 0x27, 0x55,
+    0x2c, 0xcd, 0xd3, 0x2e, 0x11, 0x40, 0x0f, 0xb7, 0x0e, 0xc1, 0xa4, 0xa6,
+    0x4f, 0x6d, 0xb0, 0xc3, 0xcf, 0xe3, 0x77, 0xfe,
+    /* 26 */
+    0x61, 0xa2, 0x41, 0x77, 0xed, 0xf2, 0xad, 0x22, 0x7f, 0x99, 0xe9, 0xf4,
+    0x32, 0x1b, 0xb7, 0xbf, 0x0e, 0x89, 0xc3, 0x2d, 0xb9, 0x0d, 0xe7, 0x69,
+    0xdf, 0xdc, 0xe4, 0x90, 0x3e, 0xb0, 0xfa, 0xfa, 0x2f, 0x32, 0x74, 0x62,
+    0x70, 0x93, 0x89, 0x68, 0x2f, 0x6b, 0x86, 0xf0, 0x57, 0x76, 0x52, 0xc3,
+    0x26, 0x2a, 0xf6, 0xda, 0x1a, 0x16, 0xc7, 0xa6,
+    /* 27 */
+    0xd2, 0xcb, 0x8e, 0x8d, 0x87, 0x76, 0x2b, 0x1a, 0x40, 0xd9, 0x0a, 0x61,
+    0xf8, 0xe7, 0x6f, 0x20, 0x98, 0xa1, 0xb3, 0xa0, 0x55, 0x4d, 0xb4, 0xac,
+    0xcf, 0x18, 0x24, 0x9f, 0x46, 0xa1, 0xee, 0xf5, 0x10, 0x75, 0xb5, 0x36,
+    0xf9, 0x71, 0xa9, 0x9c, 0xfc, 0x40, 0x51, 0x6d, 0x9f, 0xe4, 0x52, 0xb6,
+    0x53, 0xaa, 0x45, 0x47, 0xa6, 0x8c, 0x63, 0xdb,
+    /* 28 */
+    0x87, 0x43, 0xa9, 0xc9, 0xa3, 0x8d, 0xe9, 0x1d, 0x26, 0x7b, 0x9d, 0xe9,
+    0xc6, 0xe3, 0x1b, 0x63, 0x53, 0xaf, 0x6f, 0x6d, 0x53, 0x5d, 0xb5, 0xac,
+    0x4e, 0x23, 0x33, 0xc6, 0x76, 0xe2, 0x22, 0xab, 0x68, 0x9b, 0x4e, 0x08,
+    0x08, 0x3b, 0x0d, 0xe2, 0xe7, 0x3f, 0xbd, 0x2d, 0x15, 0x0e, 0x94, 0x3c,
+    0x73, 0xd0, 0xdf, 0xe4, 0x9a, 0xc0, 0x56, 0x1a,
+    /* 29 */
+    0xdb, 0x91, 0x50, 0x1d, 0xcd, 0x94, 0x9c, 0x8b, 0x05, 0x78, 0x88, 0x50,
+    0xb0, 0x7b, 0x60, 0x3a, 0xc5, 0x54, 0x0a, 0x9c, 0x9b, 0xe5, 0xda, 0xe4,
+    0x0e, 0x15, 0x76, 0xc4, 0x03, 0x50, 0xe9, 0x4a, 0x37, 0xfd, 0xeb, 0xca,
+    0xd0, 0x56, 0xcd, 0x5f, 0x91, 0x43, 0x7b, 0x27, 0x30, 0xf4, 0xce, 0xbf,
+    0x20, 0xe0, 0x8e, 0x3d, 0x39, 0xf4, 0x51, 0x2f,
+    /* 30 */
+    0x80, 0xb8, 0x59, 0x03, 0x29, 0x06, 0x51, 0x5c, 0x1e, 0xd9, 0xe3, 0x5b,
+    0xee, 0x8e, 0xa3, 0x8d, 0x18, 0x74, 0x4b, 0x74, 0x48, 0x1c, 0x1c, 0x5c,
+    0xb5, 0xff, 0x84, 0x28, 0x58, 0x15, 0xe8, 0x0e, 0x0c, 0xf5, 0x49, 0x09,
+    0x9a, 0x6b, 0xf5, 0x10, 0x03, 0xca, 0x6f, 0x02, 0xe6, 0x9d, 0x05, 0x6a,
+    0x28, 0x8e, 0x01, 0x44, 0x41, 0xdd, 0x42, 0x8b,
+    /* 31 */
+    0x4a, 0xa5, 0x15, 0x85, 0x56, 0x6a, 0x3b, 0xeb, 0xce, 0x3d, 0xa4, 0x1e,
+    0xe6, 0x8f, 0x72, 0x8d, 0x64, 0xa7, 0x19, 0xf7, 0x15, 0x37, 0xf5, 0xdd,
+    0xc4, 0xc8, 0xc9, 0xa0, 0x03, 0x48, 0xcd, 0xd6, 0x3b, 0x5d, 0xbe, 0x43,
+    0xc9, 0xc0, 0x56, 0xa8, 0x1a, 0x48, 0x38, 0xa2, 0xb5, 0xaf, 0x98, 0x2d,
+    0x87, 0x54, 0x62, 0x95, 0x4e, 0x3e, 0x2e, 0x8c,
+};
+#endif /* ECC224 */
+
+#ifdef ECC256
+/* SECP256R1: spacing 43, Montgomery R = 2^256 */
+static const byte ecc_comb_secp256r1[ECC_COMB_ENTRIES * 2 * 32] = {
+    /* 0 */
+    0x0a, 0x01, 0x9d, 0x49, 0x13, 0xe6, 0x6b, 0xe3, 0x95, 0x71, 0xfd, 0x85,
+    0x18, 0x22, 0x78, 0x7f, 0x02, 0x7f, 0xff, 0x32, 0xed, 0xd6, 0xc6, 0x2c,
+    0xfd, 0x92, 0xa1, 0x6c, 0x06, 0x64, 0xac, 0xba, 0xc3, 0xcd, 0xbf, 0xe4,
+    0x4b, 0xfd, 0x3e, 0x6c, 0x5c, 0x2d, 0xa5, 0x23, 0x39, 0x7d, 0x0a, 0x65,
+    0x4c, 0x39, 0x38, 0xd1, 0x24, 0x66, 0x86, 0x54, 0x5e, 0x19, 0xd0, 0x43,
+    0x8c, 0xc4, 0xcd, 0xd4,
+    /* 1 */
+    0x69, 0x4e, 0x0e, 0x50, 0xde, 0xbb, 0x40, 0x7a, 0xfa, 0x90, 0xc0, 0x7d,
+    0x56, 0x5c, 0x8b, 0x4a, 0x4e, 0x39, 0x9d, 0x45, 0x0e, 0x8a, 0x9e, 0x6a,
+    0x21, 0xca, 0xb5, 0x78, 0x13, 0x31, 0xc1, 0x51, 0xec, 0xce, 0xc4, 0x3a,
+    0xef, 0xd3, 0x09, 0x37, 0xfa, 0xd4, 0x46, 0xc7, 0xc7, 0x45, 0xd3, 0xc9,
+    0xae, 0x61, 0xd1, 0x8a, 0x29, 0xc7, 0x4a, 0xbc, 0x19, 0xe4, 0x37, 0x55,
+    0x97, 0xc9, 0x24, 0xcf,
+    /* 2 */
+    0x33, 0x64, 0x71, 0x02, 0x3e, 0x80, 0x19, 0x23, 0xe8, 0x5d, 0xcd, 0x4b,
+    0x16, 0x56, 0x96, 0x8c, 0x31, 0xf4, 0x1d, 0x13, 0x8d, 0xc8, 0xb9, 0xf8,
+    0x6a, 0xcc, 0xa7, 0xbc, 0xa5, 0x70, 0x6b, 0xf7, 0x73, 0x55, 0x73, 0xb8,
+    0xa6, 0xe0, 0x36, 0xba, 0xc8, 0xc4, 0xe7, 0xff, 0xe7, 0xbd, 0xa6, 0x59,
+    0x44, 0xad, 0x4d, 0x17, 0x5d, 0x81, 0x5b, 0xda, 0xf2, 0x16, 0x59, 0x9e,
+    0x78, 0x47, 0x34, 0x42,
+    /* 3 */
+    0x99, 0x18, 0x81, 0xa0, 0x1f, 0x19, 0x1e, 0xc7, 0xf9, 0xca, 0x0a, 0xc3,
+    0x83, 0x83, 0x33, 0x79, 0xf3, 0xd5, 0x26, 0x7c, 0xc7, 0xb9, 0xbc, 0x08,
+    0x15, 0xde, 0xfd, 0xbf, 0xd7, 0xcd, 0xf7, 0xa1, 0x77, 0xab, 0x6d, 0x00,
+    0x63, 0x74, 0x94, 0xc1, 0x8b, 0xc7, 0xf2, 0x88, 0xcd, 0xd9, 0x02, 0xf5,
+    0xa8, 0x32, 0x2f, 0x84, 0x57, 0xcf, 0xcd, 0x78, 0x6e, 0x6b, 0x0e, 0x3a,
+    0x1b, 0x80, 0x11, 0x7c,
+    /* 4 */
+    0x2b, 0xd2, 0x5c, 0xaf, 0xef, 0x05, 0xf8, 0xe4, 0x11, 0x86, 0x75, 0x01,
+    0x05, 0x9b, 0xb7, 0xf6, 0xf0, 0xc3, 0xc8, 0x55, 0x85, 0xb3, 0x83, 0x7a,
+    0xec, 0xb2, 0x05, 0xed, 0x9f, 0x36, 0xe7, 0x68, 0x61, 0xcc, 0x0e, 0x0f,
+    0x01, 0x61, 0x4a, 0x89, 0x75, 0x7a, 0xf2, 0xdb, 0xbc, 0xdf, 0x4f, 0x96,
+    0x5d, 0x96, 0x22, 0x37, 0xb2, 0xbd, 0xb9, 0x24, 0xaf, 0xce, 0xa2, 0x2e,
+    0xf6, 0x66, 0xb1, 0x14,
+    /* 5 */
+    0xd6, 0x64, 0xfd, 0xc4, 0x7e, 0xe5, 0xf3, 0x16, 0x66, 0x26, 0xbd, 0x0b,
+    0x68, 0xbe, 0xb3, 0xc0, 0xb8, 0x36, 0xba, 0x1f, 0xe1, 0xe6, 0x9a, 0x2d,
+    0x38, 0xe5, 0x9c, 0x15, 0x0f, 0x64, 0x0f, 0xad, 0xf5, 0xc0, 0x47, 0xae,
+    0x12, 0x36, 0x93, 0x35, 0xc6, 0xeb, 0xef, 0x5a, 0x99, 0x1f, 0x9b, 0xaa,
+    0x0b, 0x0b, 0xe0, 0x01, 0x70, 0xe3, 0x98, 0x42, 0x24, 0xbc, 0xe2, 0x1a,
+    0xc2, 0xbf, 0x5a, 0xc1,
+    /* 6 */
+    0x31, 0x72, 0x09, 0x8a, 0x14, 0x3a, 0xf0, 0xc1, 0x5e, 0x71, 0x56, 0xe3,
+    0x20, 0xa7, 0xfd, 0xa1, 0x16, 0x10, 0xe5, 0x41, 0x2e, 0x3d, 0x82, 0xf9,
+    0x3f, 0xc1, 0xcf, 0x43, 0x85, 0xee, 0x57, 0xb9, 0x8b, 0x9c, 0x9f, 0x27,
+    0x3c, 0xc5, 0x7c, 0x86, 0x9b, 0xd7, 0x5c, 0x48, 0x9c, 0xb4, 0x51, 0xa2,
+    0xcd, 0x57, 0x75, 0xf9, 0xa1, 0xb3, 0xa5, 0x5c, 0xe3, 0x09, 0x73, 0xe1,
+    0x7c, 0x46, 0x72, 0x42,
+    /* 7 */
+    0x0f, 0x7b, 0xba, 0x60, 0x51, 0x4d, 0x54, 0x6e, 0x61, 0x0c, 0x23, 0x5c,
+    0xa1, 0x3f, 0xd5, 0xfd, 0xfc, 0x9a, 0x26, 0x17, 0xb8, 0x5d, 0x48, 0xf4,
+    0xaf, 0x6e, 0xc5, 0xdd, 0xa0, 0x90, 0x6a, 0x93, 0x41, 0xf6, 0xde, 0xc1,
+    0x4d, 0x5c, 0xc3, 0x8d, 0x06, 0x67, 0x1a, 0xf6, 0x79, 0xaa, 0x92, 0xb4,
+    0xe0, 0xd4, 0x44, 0x76, 0xf8, 0x4f, 0xda, 0x52, 0xa4, 0xc8, 0x10, 0xd1,
+    0x5b, 0xf1, 0x77, 0x65,
+    /* 8 */
+    0xc2, 0x0b, 0xac, 0x66, 0x23, 0x06, 0x1c, 0x9f, 0x4b, 0xa3, 0x60, 0x3e,
+    0x69, 0x9b, 0x64, 0x4e, 0xf5, 0x7c, 0xac, 0x05, 0xb0, 0xc9, 0x59, 0x1e,
+    0x66, 0x58, 0x63, 0xda, 0x38, 0xa4, 0x95, 0x6b, 0x55, 0x75, 0x0f, 0x95,
+    0x80, 0x3e, 0x75, 0xdb, 0x04, 0xfc, 0xd6, 0x7a, 0xfa, 0x0e, 0xbf, 0x75,
+    0xc6, 0x1e, 0x3f, 0x6a, 0xf1, 0x9b, 0xd3, 0x94, 0x2a, 0xbb, 0x90, 0x23,
+    0x73, 0x63, 0x9f, 0x4c,
+    /* 9 */
+    0x64, 0xdc, 0x49, 0xb3, 0x67, 0xb7, 0x21, 0xc8, 0x77, 0xcf, 0xcc, 0x7d,
+    0xa3, 0x59, 0x1b, 0x99, 0xa9, 0x20, 0xa2, 0x0d, 0x03, 0x3a, 0xfe, 0x0b,
+    0x74, 0xcf, 0x66, 0xa8, 0x81, 0x1d, 0x6c, 0x76, 0x64, 0x29, 0x54, 0x38,
+    0x1a, 0xaa, 0x9c, 0x93, 0xa5, 0x6d, 0xa3, 0x55, 0x3e, 0x64, 0x45, 0xf3,
+    0x35, 0x65, 0x22, 0xba, 0x34, 0x5d, 0x36, 0xec, 0x3d, 0x2d, 0x03, 0x39,
+    0x9b, 0x38, 0x84, 0xfa,
+    /* 10 */
+    0x55, 0xe3, 0xc2, 0x59, 0x5c, 0xa8, 0x54, 0x4b, 0xce, 0x2d, 0x25, 0xa3,
+    0xc3, 0xcc, 0x6b, 0x03, 0xde, 0xf6, 0x27, 0x66, 0xec, 0xa4, 0xea, 0x63,
+    0x97, 0x32, 0xb5, 0xee, 0xe9, 0xb0, 0x49, 0x75, 0xfd, 0x24, 0x19, 0x30,
+    0xf6, 0x23, 0x60, 0x1a, 0x0b, 0x4e, 0x4f, 0xe4, 0x6e, 0x81, 0x14, 0x98,
+    0xa5, 0x60, 0xd5, 0xd6, 0xce, 0x44, 0xf1, 0x5a, 0xcb, 0x7b, 0x05, 0x7c,
+    0xad, 0xbf, 0x5e, 0x54,
+    /* 11 */
+    0x35, 0xbe, 0x04, 0xce, 0x63, 0x1c, 0xd6, 0x89, 0xcf, 0x93, 0x0c, 0x93,
+    0xc4, 0xc4, 0xe9, 0xef, 0x79, 0x37, 0xf9, 0x44, 0xa1, 0x43, 0xd9, 0x62,
+    0x11, 0x46, 0xa6, 0x56, 0xe1, 0xcf, 0x1e, 0xe0, 0x57, 0xf9, 0xf7, 0x22,
+    0x5b, 0x25, 0xec, 0x54, 0x5e, 0x60, 0x6b, 0xeb, 0x51, 0xfb, 0x59, 0xa1,
+    0xcd, 0x84, 0xcd, 0x02, 0xb1, 0xc4, 0x93, 0x0f, 0x9b, 0xd4, 0xce, 0xa2,
+    0xa3, 0x0a, 0xf5, 0x7b,
+    /* 12 */
+    0x3a, 0x63, 0x7c, 0x0e, 0x58, 0x7a, 0x18, 0xe6, 0x76, 0x74, 0x1d, 0x3b,
+    0x84, 0x5a, 0x0d, 0xdc, 0xac, 0xd0, 0xfd, 0xb3, 0x04, 0xc3, 0x5b, 0x63,
+    0x82, 0x1e, 0x44, 0xb0, 0xfd, 0x06, 0x71, 0x89, 0x7a, 0x35, 0xae, 0x9f,
+    0x22, 0x21, 0x90, 0x9a, 0x1f, 0xcd, 0x33, 0xb9, 0xa1, 0x29, 0x3e, 0xa3,
+    0x0c, 0xd8, 0x81, 0x72, 0xc7, 0x11, 0x49, 0xfd, 0xcf, 0xe4, 0x73, 0x67,
+    0x51, 0x6d, 0x4c, 0x58,
+    /* 13 */
+    0xab, 0x36, 0x04, 0x8e, 0x13, 0xc5, 0xd0, 0x38, 0x2d, 0x11, 0x90, 0x07,
+    0x5a, 0xa0, 0x79, 0x30, 0x42, 0x34, 0x0e, 0x3b, 0x8e, 0xde, 0xf8, 0x0c,
+    0xdc, 0xcf, 0xe4, 0xac, 0xbe, 0x6e, 0xbc, 0x56, 0xdf, 0xae, 0x02, 0xb2,
+    0xbc, 0x02, 0xb4, 0xf2, 0xc0, 0x2a, 0x82, 0x8d, 0x8a, 0x35, 0xf4, 0xda,
+    0x45, 0x79, 0xc8, 0x83, 0x88, 0xe8, 0xc2, 0x6e, 0x72, 0xe6, 0x42, 0xf6,
+    0x5f, 0xba, 0x58, 0xb1,
+    /* 14 */
+    0xf8, 0xbe, 0x72, 0xa1, 0xe7, 0xec, 0x1a, 0x0c, 0x14, 0x74, 0xa4, 0xcb,
+    0xd2, 0x6f, 0xb1, 0xbc, 0xd5, 0x5d, 0x80, 0x42, 0x9a, 0x82, 0x93, 0x44,
+    0x7c, 0xa7, 0x4f, 0x2f, 0x7f, 0x68, 0xbd, 0xd1, 0x04, 0xe0, 0xd9, 0xe5,
+    0x90, 0x99, 0x4d, 0xc6, 0x9d, 0x25, 0xaa, 0x89, 0x4a, 0xcf, 0xec, 0x1a,
+    0x59, 0x11, 0x61, 0xd7, 0x6f, 0x76, 0x2e, 0x90, 0x73, 0xe8, 0x53, 0x22,
+    0x3e, 0xac, 0x9f, 0xc1,
+    /* 15 */
+    0x6b, 0xe6, 0x00, 0xde, 0xef, 0xec, 0x4e, 0xb8, 0x5d, 0xf1, 0xf8, 0x7b,
+    0xb8, 0x89, 0x68, 0x53, 0x69, 0x74, 0xdb, 0xf2, 0x3c, 0x37, 0xdb, 0x15,
+    0xa5, 0xc2, 0xe2, 0xc3, 0x06, 0xbb, 0x88, 0xd3, 0xea, 0x0e, 0xd0, 0xe9,
+    0x02, 0xbe, 0x35, 0x8f, 0xda, 0xae, 0x36, 0x65, 0xa0, 0xe7, 0x2e, 0xc5,
+    0x41, 0xba, 0x10, 0xb5, 0xc8, 0x13, 0x9a, 0x3b, 0x7a, 0xc9, 0x1e, 0x47,
+    0x72, 0x46, 0x9f, 0x14,
+    /* 16 */
+    0x3c, 0x51, 0xd4, 0x5a, 0x0c, 0x1c, 0xf0, 0xaf, 0xcb, 0x4c, 0x29, 0x47,
+    0xd8, 0x80, 0x2f, 0xe2, 0xa7, 0x0f, 0xe3, 0x91, 0x09, 0x20, 0x01, 0xa2,
+    0x63, 0x98, 0xc2, 0xb5, 0x5a, 0x53, 0x32, 0x1c, 0x1b, 0x00, 0x11, 0x97,
+    0x8f, 0xf8, 0x8d, 0xc9, 0x14, 0xb0, 0xaf, 0x81, 0xdb, 0xba, 0xd9, 0x90,
+    0x66, 0x8f, 0xc6, 0x22, 0xaa, 0x85, 0x26, 0x02, 0x6c, 0xa8, 0x3d, 0x78,
+    0xa7, 0xc3, 0xfd, 0x9e,
+    /* 17 */
+    0xc1, 0x7a, 0x5c, 0x4a, 0x04, 0x48, 0x60, 0xd8, 0xc4, 0x09, 0xb7, 0x17,
+    0xae, 0x22, 0x27, 0x5b, 0xc8, 0xd6, 0x4e, 0x02, 0x41, 0x01, 0x67, 0x56,
+    0x25, 0x32, 0x8c, 0x46, 0xda, 0x00, 0xe0, 0xb3, 0x5e, 0xa0, 0x29, 0x41,
+    0xe0, 0x88, 0xa4, 0xa2, 0x85, 0xde, 0x76, 0xf0, 0xad, 0x4d, 0x4c, 0x58,
+    0x2b, 0x7d, 0x51, 0xfc, 0x40, 0x65, 0x64, 0xe1, 0xe1, 0xb4, 0x7e, 0x4a,
+    0xb1, 0x2b, 0x30, 0x2d,
+    /* 18 */
+    0x66, 0x61, 0x9c, 0xa5, 0xbd, 0x01, 0x96, 0xe2, 0x34, 0xa1, 0xd1, 0x96,
+    0x00, 0xdd, 0x6f, 0x5d, 0xc0, 0x19, 0x70, 0xc2, 0x45, 0x5c, 0x3b, 0x66,
+    0x31, 0xf8, 0x45, 0xf1, 0x8d, 0x1b, 0xb3, 0xb3, 0x5d, 0x3f, 0xdb, 0x4c,
+    0x4b, 0xdb, 0xaa, 0x83, 0xaa, 0xc8, 0xf6, 0x1c, 0x36, 0xd2, 0xdc, 0x69,
+    0x33, 0x90, 0xb6, 0x48, 0x37, 0x60, 0x75, 0x2a, 0x6c, 0xba, 0x36, 0xe6,
+    0x2a, 0xb1, 0x48, 0xc8,
+    /* 19 */
+    0x3a, 0x3e, 0xad, 0xdb, 0xe1, 0x16, 0x22, 0xa2, 0xc3, 0xf6, 0x84, 0xce,
+    0x40, 0x75, 0x3a, 0x42, 0x81, 0xe9, 0x85, 0x63, 0x3a, 0x1a, 0x23, 0xcf,
+    0x78, 0x35, 0xe7, 0xc2, 0x32, 0x02, 0xba, 0x4d, 0x79, 0xe7, 0xb5, 0xae,
+    0xcc, 0x63, 0x88, 0x7d, 0x7a, 0xb7, 0x40, 0x4c, 0x07, 0x7e, 0x74, 0x63,
+    0xfc, 0x25, 0xda, 0xae, 0x65, 0x1d, 0xf3, 0x67, 0xa4, 0xe7, 0x17, 0xcc,
+    0x8f, 0x81, 0x93, 0xef,
+    /* 20 */
+    0x77, 0xf9, 0xa2, 0xbd, 0x87, 0x61, 0x49, 0x60, 0x76, 0x66, 0xed, 0x3c,
+    0x7f, 0x58, 0x4a, 0xf8, 0xef, 0x8d, 0x4b, 0xeb, 0x19, 0x34, 0x1a, 0x6c,
+    0x62, 0xa3, 0xd6, 0x00, 0xcc, 0xf4, 0x7a, 0xfd, 0xca, 0x1c, 0x21, 0x98,
+    0x49, 0x7f, 0x25, 0x09, 0x82, 0x2f, 0x8b, 0x57, 0xbe, 0xbf, 0xac, 0xe7,
+    0x28, 0xc4, 0x76, 0x66, 0xa6, 0x38, 0xae, 0xe7, 0x64, 0x52, 0xbc, 0xd1,
+    0xa7, 0xc5, 0xf4, 0xe2,
+    /* 21 */
+    0x7b, 0xd0, 0x8f, 0xd0, 0x00, 0x9d, 0x86, 0xe2, 0x29, 0x8c, 0x21, 0xe4,
+    0xd4, 0x96, 0x8b, 0x25, 0x3d, 0x4f, 0x51, 0xfd, 0xf6, 0x6d, 0xa8, 0x53,
+    0x21, 0x66, 0x80, 0x13, 0xab, 0x27, 0x67, 0x95, 0x71, 0x0a, 0x8d, 0x48,
+    0x09, 0xa6, 0xa1, 0x4c, 0x2b, 0x09, 0x10, 0x7b, 0x45, 0xe9, 0x1a, 0x00,
+    0x5a, 0xdb, 0x8e, 0x4c, 0xc2, 0x8f, 0x36, 0x6c, 0x0e, 0x68, 0xb0, 0xae,
+    0x83, 0x68, 0xcd, 0x52,
+    /* 22 */
+    0x00, 0xe6, 0x83, 0x7c, 0xc2, 0x27, 0x12, 0xf9, 0x44, 0x1a, 0x98, 0x5f,
+    0xc2, 0xa7, 0xaa, 0x6a, 0xbc, 0xb8, 0xd7, 0xd2, 0x11, 0xae, 0x0c, 0x0f,
+    0x03, 0x9f, 0x15, 0x9e, 0x4a, 0xe9, 0xf8, 0xf8, 0x60, 0xa9, 0xd1, 0xaa,
+    0x2f, 0x85, 0x94, 0x8b, 0xe3, 0xc2, 0xf4, 0x85, 0x28, 0xb5, 0xf7, 0xc4,
+    0x7b, 0xe7, 0xa9, 0x89, 0x52, 0x29, 0xfe, 0x32, 0x27, 0x70, 0x56, 0x4f,
+    0x92, 0xff, 0xe4, 0x67,
+    /* 23 */
+    0xb9, 0x2d, 0xaf, 0xd0, 0x3b, 0x14, 0x3e, 0xee, 0x09, 0x60, 0x49, 0xd0,
+    0xd6, 0xfd, 0xc4, 0x97, 0x26, 0xb1, 0x36, 0xbe, 0x68, 0x90, 0x81, 0x8a,
+    0x61, 0x7c, 0xd7, 0x63, 0xbe, 0xef, 0xb4, 0xf3, 0xae, 0x67, 0x22, 0x5b,
+    0x14, 0xf1, 0x42, 0x5b, 0x2d, 0x71, 0x7a, 0x33, 0x44, 0x9d, 0x46, 0x9f,
+    0x71, 0xd0, 0x91, 0x55, 0x57, 0xd9, 0x66, 0x11, 0x3d, 0xd5, 0x8d, 0x4c,
+    0x0c, 0x16, 0xa1, 0x1d,
+    /* 24 */
+    0xe2, 0x20, 0x73, 0x08, 0xad, 0x87, 0xc7, 0xd9, 0xb9, 0xd5, 0x59, 0x47,
+    0xde, 0x6f, 0xd5, 0xca, 0x77, 0x94, 0x56, 0xf5, 0x1b, 0x1f, 0xcd, 0xca,
+    0xc9, 0x1c, 0x3a, 0x19, 0xd5, 0xc5, 0xfd, 0x3d, 0x64, 0x4c, 0x1c, 0xee,
+    0x97, 0xad, 0x18, 0x37, 0x92, 0x7b, 0x60, 0x94, 0x37, 0x26, 0xc3, 0x3e,
+    0x08, 0xe8, 0xb6, 0xb3, 0x37, 0x5e, 0xa4, 0x13, 0x9a, 0x54, 0x5b, 0x69,
+    0x5e, 0x19, 0x23, 0x85,
+    /* 25 */
+    0x37, 0x9a, 0xbb, 0x43, 0x9f, 0x5f, 0xbb, 0x80, 0xce, 0x06, 0x6a, 0x44,
+    0xa2, 0x45, 0x24, 0xbc, 0xbd, 0x36, 0x37, 0x6e, 0x51, 0x23, 0x1f, 0x96,
+    0xc3, 0x4a, 0x5a, 0x61, 0x8d, 0x75, 0x8d, 0x83, 0x0c, 0x6f, 0x96, 0xac,
+    0x86, 0xce, 0x7b, 0x89, 0x88, 0xa9, 0x18, 0x38, 0x4c, 0x00, 0xce, 0xed,
+    0x5a, 0xec, 0xde, 0xef, 0x34, 0x37, 0xf4, 0xd5, 0xcf, 0x1c, 0xc5, 0xa7,
+    0x0c, 0x12, 0xf0, 0xe1,
+    /* 26 */
+    0x09, 0xc8, 0xbd, 0x94, 0x24, 0xa8, 0xb4, 0x53, 0xe8, 0x4e, 0xb6, 0x3b,
+    0x74, 0x91, 0xe4, 0xc4, 0xa0, 0x71, 0xef, 0x2b, 0xb4, 0xda, 0x49, 0x4f,
+    0xd4, 0x67, 0x83, 0xa0, 0x89, 0x33, 0x72, 0x19, 0x0f, 0x8a, 0xca, 0xac,
+    0x3f, 0xcb, 0x8d, 0x99, 0x2e, 0x05, 0x41, 0x09, 0x9f, 0xe0, 0xd6, 0x2f,
+    0xf3, 0xd1, 0x33, 0x43, 0x6f, 0x63, 0xb8, 0x61, 0xaf, 0xaf, 0x51, 0x04,
+    0x3f, 0x86, 0x63, 0xc9,
+    /* 27 */
+    0x19, 0x59, 0x54, 0xa7, 0x22, 0x1b, 0xef, 0xa5, 0x7c, 0x94, 0x29, 0x9d,
+    0xf6, 0x2d, 0x0d, 0x8a, 0x2e, 0x7f, 0xa2, 0xb3, 0x23, 0x75, 0xe3, 0x48,
+    0xa0, 0x0f, 0x1a, 0xc8, 0x21, 0x2f, 0x48, 0xd4, 0xd1, 0x54, 0x1b, 0x8e,
+    0x9b, 0x6d, 0x22, 0x8a, 0x9b, 0x71, 0x55, 0x9e, 0x97, 0x17, 0xb4, 0x32,
+    0x6f, 0x07, 0x97, 0x6c, 0x39, 0xde, 0x55, 0x23, 0x2c, 0x32, 0x4c, 0x13,
+    0xa0, 0xdd, 0x5c, 0x52,
+    /* 28 */
+    0x46, 0x8b, 0xeb, 0x88, 0xb3, 0x50, 0xaa, 0xba, 0x97, 0x6d, 0x07, 0x61,
+    0x76, 0x56, 0xe0, 0x88, 0xc8, 0x03, 0xf9, 0xbc, 0x6a, 0xe2, 0xf9, 0x6d,
+    0x18, 0x2f, 0x4b, 0x72, 0x9a, 0x39, 0x5d, 0xdb, 0x1d, 0xf6, 0x62, 0xb6,
+    0x84, 0x7b, 0xa9, 0xb1, 0xfa, 0x52, 0xef, 0x3d, 0x28, 0x20, 0xee, 0x98,
+    0xf7, 0x20, 0x46, 0xb7, 0xee, 0x75, 0x06, 0x7d, 0xfa, 0x25, 0x42, 0x06,
+    0x55, 0xbd, 0x5f, 0x53,
+    /* 29 */
+    0xe9, 0x95, 0xdd, 0x88, 0x0d, 0x11, 0xaf, 0x6d, 0x70, 0x93, 0xce, 0xb9,
+    0x16, 0x78, 0x2d, 0xf7, 0x69, 0xf4, 0xd3, 0xc9, 0xf9, 0xfc, 0x95, 0x33,
+    0xee, 0x6b, 0xb6, 0x9b, 0xde, 0x32, 0xcc, 0x14, 0xc6, 0x6a, 0xae, 0xc1,
+    0xb3, 0x01, 0x26, 0xeb, 0xfb, 0x45, 0xd2, 0x52, 0x8e, 0x55, 0x8e, 0x58,
+    0x33, 0x0c, 0x9b, 0xb8, 0x7a, 0x00, 0xd4, 0xa6, 0x73, 0x51, 0x21, 0x86,
+    0x40, 0x2c, 0x54, 0x02,
+    /* 30 */
+    0xb2, 0x6b, 0xed, 0x39, 0xa9, 0x97, 0xaa, 0x99, 0x6b, 0x51, 0x75, 0x1c,
+    0x20, 0xae, 0x1d, 0x26, 0x9c, 0xf4, 0x94, 0x69, 0xb8, 0x6a, 0xc9, 0x74,
+    0x99, 0xb3, 0x2d, 0xec, 0x59, 0xcc, 0x4b, 0xe4, 0x70, 0xb1, 0x9f, 0x6e,
+    0x84, 0x70, 0x24, 0xa5, 0xce, 0xc3, 0xdc, 0xd3, 0xde, 0x88, 0x55, 0x14,
+    0xc7, 0x2f, 0x46, 0x99, 0x33, 0x24, 0xf6, 0xe7, 0x65, 0xae, 0xf6, 0x7e,
+    0xc3, 0x62, 0x48, 0x5d,
+    /* 31 */
+    0xf3, 0x02, 0x05, 0x99, 0x62, 0x96, 0xe8, 0xfc, 0xd0, 0x2e, 0xc4, 0x41,
+    0x83, 0x3a, 0xcc, 0xb5, 0x6c, 0xe7, 0xc4, 0xf7, 0x4a, 0x59, 0x71, 0x59,
+    0xf9, 0xc5, 0xe9, 0xde, 0x44, 0xb0, 0x6e, 0xd7, 0x24, 0x03, 0xea, 0x21,
+    0x83, 0x0c, 0x38, 0x8b, 0x42, 0x17, 0x01, 0x66, 0xf5, 0xdd, 0x78, 0xd6,
+    0xff, 0x42, 0x9d, 0xda, 0x9c, 0x84, 0x9b, 0x09, 0x7d, 0xf6, 0xc5, 0xc6,
+    0xc2, 0xaf, 0xbe, 0x06,
+};
+#endif /* ECC256 */
+
+#ifdef ECC384
+/* SECP384R1: spacing 64, Montgomery R = 2^384 */
+static const byte ecc_comb_secp384r1[ECC_COMB_ENTRIES * 2 * 48] = {
+    /* 0 */
+    0x3c, 0x81, 0x1b, 0x82, 0x92, 0x99, 0x82, 0x42, 0xd5, 0x13, 0x2c, 0x90,
+    0xe6, 0x90, 0x46, 0x94, 0x4d, 0xc2, 0x89, 0x4f, 0x01, 0xf7, 0xd8, 0x4a,
+    0x5b, 0x71, 0xf6, 0xf3, 0xdb, 0xc8, 0x23, 0x4f, 0xa7, 0xd4, 0xf1, 0x8d,
+    0x99, 0xe1, 0xb0, 0xbb, 0x81, 0x05, 0xc9, 0x6e, 0x02, 0x51, 0xe6, 0x1e,
+    0x16, 0x1c, 0x12, 0xcc, 0xaa, 0x10, 0x64, 0x03, 0x18, 0x07, 0x62, 0x17,
+    0x3c, 0x2f, 0x4a, 0x30, 0x82, 0x67, 0xc0, 0xc1, 0x00, 0x42, 0xbc, 0x0b,
+    0xdb, 0x89, 0x93, 0x61, 0x78, 0xbc, 0x8e, 0x86, 0xed, 0x4f, 0x8b, 0x37,
+    0x6c, 0xd8, 0xae, 0x98, 0x71, 0x5a, 0x4b, 0xce, 0xeb, 0xb8, 0x8b, 0xc9,
+    /* 1 */
+    0xd6, 0xf8, 0xa5, 0x28, 0xd7, 0x4f, 0x0f, 0xae, 0xe9, 0xe4, 0x25, 0xd7,
+    0x25, 0xce, 0x07, 0xaa, 0x92, 0x53, 0xb4, 0x52, 0x85, 0x46, 0x50, 0x4a,
+    0x43, 0x94, 0x23, 0x26, 0xfc, 0x96, 0x1f, 0xdf, 0x69, 0x41, 0x1f, 0x8e,
+    0x4c, 0xfd, 0x6b, 0x8f, 0x79, 0x08, 0x66, 0x7c, 0x25, 0xd0, 0x1d, 0x41,
+    0x7b, 0xfe, 0x35, 0x17, 0xe8, 0x14, 0xeb, 0x2a, 0x33, 0xfd, 0x3b, 0x38,
+    0x40, 0x05, 0x2f, 0x93, 0x7e, 0x31, 0xa4, 0xea, 0x87, 0xd7, 0x8f, 0xfa,
+    0xf8, 0xe3, 0xa6, 0x3d, 0x88, 0xce, 0x81, 0xee, 0x34, 0xe9, 0x5e, 0x87,
+    0xe1, 0xf6, 0x93, 0xb7, 0x79, 0x54, 0xb2, 0x97, 0x81, 0xcc, 0x9e, 0x20,
+    /* 2 */
+    0x2f, 0x70, 0x93, 0x4c, 0x52, 0x44, 0x70, 0xea, 0x6a, 0xfe, 0xe6, 0xfb,
+    0x05, 0x80, 0x34, 0x08, 0x56, 0x93, 0xa4, 0x45, 0x07, 0x90, 0x43, 0x7e,
+    0x38, 0x6a, 0xb0, 0x95, 0xef, 0x91, 0x99, 0xc4, 0x9e, 0x8d, 0x06, 0x8a,
+    0xaa, 0xdb, 0xc1, 0x5a, 0x69, 0xa8, 0x48, 0x8c, 0xa3, 0x96, 0x9d, 0x42,
+    0x51, 0x2f, 0xd9, 0x03, 0xf0, 0x0d, 0x72, 0xb0, 0x2d, 0xdd, 0x85, 0x6c,
+    0xf5, 0x4e, 0xa1, 0x7e, 0xcd, 0x5a, 0xae, 0x98, 0xa0, 0xf1, 0xa0, 0x90,
+    0x10, 0x07, 0xba, 0x0f, 0xaa, 0x99, 0xbb, 0x75, 0x06, 0x99, 0x4d, 0x64,
+    0x4f, 0xd3, 0x21, 0x88, 0xf3, 0xd8, 0xd4, 0x09, 0xa6, 0xca, 0x10, 0x27,
+    /* 3 */
+    0xa6, 0x97, 0x3d, 0x02, 0x17, 0xeb, 0x97, 0x02, 0xbf, 0xbf, 0xf1, 0x54,
+    0x3d, 0x55, 0xce, 0x0b, 0x82, 0x12, 0x6c, 0xa4, 0x50, 0x47, 0x40, 0xa9,
+    0x0a, 0xf5, 0xa9, 0xb4, 0x65, 0xdf, 0xf7, 0xc2, 0x89, 0x1d, 0x7d, 0x8e,
+    0x62, 0x1c, 0x1c, 0x67, 0x51, 0xa2, 0xcf, 0x1c, 0x30, 0x45, 0x22, 0x04,
+    0x05, 0x37, 0xaf, 0x67, 0x32, 0xba, 0xb6, 0xde, 0x9f, 0xca, 0x50, 0x2b,
+    0x08, 0xbc, 0xf9, 0x1a, 0xe1, 0xda, 0x65, 0x67, 0xb2, 0x09, 0xf2, 0x21,
+    0xe3, 0x4b, 0x2b, 0x89, 0xf7, 0x67, 0xc4, 0xfe, 0x91, 0x25, 0x1e, 0x53,
+    0x71, 0x1d, 0xcc, 0x22, 0x15, 0x7c, 0x77, 0x16, 0x66, 0xf2, 0xd8, 0x8c,
+    /* 4 */
+    0x6d, 0x6c, 0xd3, 0x74, 0xa6, 0xb6, 0xf8, 0x7b, 0x2c, 0x82, 0xa5, 0xd6,
+    0x2d, 0x6f, 0x0c, 0x04, 0x5e, 0xbb, 0x36, 0xad, 0xa8, 0x24, 0x9b, 0x24,
+    0x97, 0x9b, 0x3b, 0x11, 0x6c, 0x82, 0x81, 0xab, 0x87, 0x76, 0x68, 0xd7,
+    0x59, 0x50, 0xea, 0xb3, 0xdc, 0x58, 0x7f, 0x70, 0x9f, 0x30, 0x2b, 0xa8,
+    0xd4, 0x78, 0x07, 0xc1, 0x92, 0x86, 0x4b, 0x61, 0x92, 0x0f, 0xd0, 0xa4,
+    0x9f, 0x1c, 0xb1, 0xfa, 0x0b, 0x3b, 0xc7, 0x46, 0x5c, 0x6a, 0xda, 0x68,
+    0x1f, 0x21, 0x96, 0x10, 0x9b, 0xcf, 0x87, 0xe8, 0x82, 0x43, 0x96, 0xad,
+    0x90, 0x08, 0x75, 0x97, 0x2e, 0x7a, 0x79, 0x81, 0x15, 0xe2, 0x20, 0xa2,
+    /* 5 */
+    0x9f, 0x29, 0x9d, 0xfb, 0x3e, 0xea, 0xe8, 0x15, 0x32, 0x64, 0xcb, 0xff,
+    0x37, 0x9e, 0xda, 0x53, 0x9e, 0x2e, 0xfe, 0x36, 0xc1, 0xba, 0xef, 0xfd,
+    0xe7, 0x36, 0x0f, 0xe0, 0x4f, 0xe5, 0xff, 0xf1, 0x6d, 0x1f, 0x44, 0x20,
+    0x28, 0x5e, 0x7b, 0x2f, 0x5b, 0xce, 0x03, 0xd7, 0x93, 0x05, 0x1a, 0x22,
+    0x7d, 0xb5, 0x6b, 0x98, 0x9c, 0xa3, 0xd7, 0x37, 0xe6, 0x17, 0xd6, 0x1e,
+    0xe9, 0xf5, 0x20, 0xa6, 0x33, 0x16, 0xf3, 0xb6, 0x9d, 0xee, 0xe5, 0xda,
+    0x4e, 0x7a, 0x85, 0x54, 0xe4, 0x86, 0x1d, 0x27, 0x3d, 0x75, 0xb5, 0x04,
+    0xd2, 0x4e, 0xaa, 0x11, 0xd7, 0x3a, 0xdf, 0x1b, 0x58, 0x92, 0x26, 0x05,
+    /* 6 */
+    0xa3, 0x4a, 0x75, 0x3f, 0xea, 0x7e, 0x52, 0xdb, 0x08, 0x4a, 0x1f, 0x88,
+    0xe8, 0x9a, 0x6d, 0x54, 0x1d, 0x63, 0xb6, 0xcd, 0xe2, 0xa0, 0x8d, 0xf4,
+    0xa1, 0xd8, 0x33, 0x53, 0xe3, 0x98, 0x2f, 0x0d, 0xfc, 0xb8, 0xe4, 0xf3,
+    0x20, 0x34, 0x21, 0x65, 0x93, 0x8f, 0x36, 0xe5, 0x08, 0xa4, 0x23, 0xbf,
+    0x9c, 0xa8, 0xdd, 0x30, 0x11, 0x4b, 0xfa, 0xfa, 0x6d, 0x59, 0xc7, 0x34,
+    0x5c, 0xe4, 0x28, 0xa5, 0x90, 0xfd, 0x42, 0x65, 0x12, 0x2e, 0xbf, 0xf7,
+    0x95, 0x7f, 0x63, 0x59, 0x1a, 0x9c, 0x27, 0xcf, 0x22, 0x6a, 0x85, 0xe5,
+    0xe4, 0x52, 0x68, 0x82, 0x79, 0xc9, 0xa7, 0xfd, 0xec, 0xcb, 0xfc, 0x95,
+    /* 7 */
+    0x88, 0x42, 0xf9, 0x43, 0xad, 0x70, 0x4f, 0x9b, 0x54, 0x31, 0x4f, 0x07,
+    0x9c, 0xa0, 0xfc, 0x93, 0x8c, 0x2b, 0x04, 0xfe, 0x9e, 0x15, 0xa6, 0x17,
+    0x94, 0xf1, 0x2e, 0xa3, 0x64, 0x3b, 0x19, 0xb3, 0xdd, 0x76, 0xf4, 0x1f,
+    0xf6, 0x17, 0x0c, 0x50, 0xf6, 0xcf, 0x22, 0x94, 0xcc, 0xa6, 0xa5, 0xa4,
+    0xfb, 0x5e, 0xa4, 0xf8, 0x82, 0x25, 0xd2, 0xee, 0xf3, 0x13, 0x60, 0x1e,
+    0xf6, 0xca, 0x4c, 0xe6, 0xa4, 0x00, 0x65, 0x24, 0xef, 0x9d, 0x3e, 0xe2,
+    0xfb, 0x5f, 0xdf, 0x69, 0x15, 0xde, 0xad, 0xf4, 0xed, 0x5a, 0xd9, 0x7f,
+    0xb3, 0x8f, 0x0a, 0xba, 0x25, 0xf9, 0x55, 0x7f, 0x42, 0xfc, 0xff, 0xf0,
+    /* 8 */
+    0x47, 0x7f, 0xe5, 0x16, 0x21, 0xee, 0xe2, 0x81, 0xf2, 0x9e, 0x91, 0xfe,
+    0x46, 0x0f, 0xe6, 0x5b, 0x9f, 0x37, 0x19, 0x78, 0xe9, 0x13, 0x9b, 0x40,
+    0x26, 0x9a, 0xf9, 0x00, 0x12, 0x74, 0xcb, 0x59, 0x1f, 0xf2, 0x00, 0xc8,
+    0x65, 0xe0, 0x49, 0x19, 0xb8, 0xd2, 0x4a, 0x67, 0xa6, 0xab, 0x49, 0x62,
+    0x25, 0x93, 0xea, 0x87, 0x96, 0x93, 0x28, 0xaf, 0xf7, 0x29, 0x72, 0xd8,
+    0x17, 0xfd, 0x03, 0x80, 0xeb, 0x25, 0x9e, 0x9c, 0x85, 0x94, 0x88, 0xfe,
+    0xb4, 0xb8, 0xdb, 0xfc, 0x11, 0xd6, 0x4e, 0xa9, 0x51, 0x67, 0xdd, 0x3c,
+    0x51, 0xef, 0x40, 0x67, 0x08, 0x23, 0x92, 0x19, 0x69, 0xf7, 0x94, 0xc0,
+    /* 9 */
+    0x28, 0xb7, 0x44, 0x3e, 0x79, 0xf1, 0x88, 0x98, 0x3b, 0x99, 0xcd, 0xa3,
+    0xc6, 0x72, 0x7d, 0xbf, 0x8d, 0xed, 0x2e, 0xe7, 0x89, 0x90, 0xe7, 0x20,
+    0x03, 0x1b, 0x04, 0xdb, 0xa3, 0xdb, 0xb5, 0xf9, 0x10, 0x4b, 0x7e, 0x40,
+    0xa8, 0x70, 0x3d, 0x41, 0xa3, 0x9c, 0x15, 0xe8, 0x07, 0xb0, 0xb0, 0xb4,
+    0x54, 0xfa, 0x96, 0x7a, 0xda, 0xd3, 0x39, 0x21, 0xe6, 0xca, 0x98, 0x88,
+    0x90, 0x26, 0xfe, 0x1c, 0xfb, 0x25, 0xfd, 0x27, 0x33, 0xc1, 0xf1, 0x1b,
+    0xfb, 0x09, 0x70, 0x11, 0x57, 0xc9, 0x66, 0xc1, 0x29, 0x9c, 0x19, 0xc3,
+    0x62, 0x41, 0x67, 0x57, 0x02, 0x56, 0xeb, 0xf5, 0xfa, 0x79, 0xa3, 0x2c,
+    /* 10 */
+    0xa9, 0xc1, 0x09, 0xee, 0x19, 0xe1, 0xea, 0x96, 0xd7, 0xc9, 0xc6, 0x0c,
+    0xc1, 0x71, 0x85, 0x35, 0xce, 0xd9, 0xac, 0xb4, 0x63, 0x4d, 0xc5, 0x57,
+    0xd1, 0x9d, 0x6f, 0x6d, 0x01, 0x1b, 0x47, 0x87, 0x84, 0xed, 0xfd, 0x2c,
+    0x2c, 0x9f, 0x77, 0x13, 0xe6, 0x0e, 0x71, 0x17, 0x9d, 0xa8, 0xc2, 0x59,
+    0x1e, 0x03, 0xcf, 0x0b, 0x97, 0xe5, 0xd9, 0x54, 0x6a, 0xe8, 0x10, 0xf7,
+    0x79, 0xc1, 0xcf, 0x19, 0xe6, 0xd7, 0x30, 0x0a, 0x83, 0xe2, 0xdd, 0x24,
+    0xe6, 0xc8, 0x80, 0x4e, 0x72, 0x79, 0x05, 0x13, 0x43, 0x1a, 0xc5, 0xcb,
+    0xc5, 0x0f, 0x5a, 0xca, 0xc8, 0x18, 0xb2, 0x9f, 0x26, 0x35, 0x3f, 0x33,
+    /* 11 */
+    0x8a, 0x27, 0xb0, 0x18, 0xec, 0x50, 0xa0, 0xd6, 0x64, 0x4c, 0x01, 0xff,
+    0x60, 0x4b, 0xa9, 0x43, 0xa4, 0x82, 0x64, 0xfe, 0xc5, 0xd9, 0x5a, 0xf5,
+    0x74, 0x21, 0xbc, 0x7d, 0xe9, 0x98, 0xdf, 0xe9, 0x72, 0x36, 0xb3, 0x7c,
+    0xee, 0x33, 0x55, 0x7e, 0x33, 0xd2, 0xf8, 0xb1, 0x0f, 0x56, 0x1e, 0xcf,
+    0x20, 0x54, 0xef, 0x3c, 0x4b, 0x50, 0x25, 0xfe, 0x8c, 0x7d, 0xc8, 0x26,
+    0xe9, 0x1e, 0x43, 0xdf, 0x16, 0xaa, 0x7b, 0x11, 0x97, 0xce, 0xd8, 0x18,
+    0x0e, 0x4c, 0x0e, 0xc0, 0x48, 0x13, 0xbf, 0xae, 0xe6, 0x7f, 0xc2, 0x69,
+    0xa2, 0x43, 0x6b, 0x74, 0x92, 0xfd, 0x9f, 0xf3, 0xd2, 0x6f, 0x0a, 0xf3,
+    /* 12 */
+    0x89, 0x1a, 0xcd, 0x63, 0x68, 0x26, 0xe3, 0x1a, 0x9e, 0x75, 0xe6, 0x60,
+    0x1e, 0xcb, 0xf8, 0x8e, 0x2c, 0xc7, 0x66, 0x80, 0xfd, 0xb6, 0xa1, 0xbf,
+    0xfc, 0x4a, 0x88, 0x3c, 0xb8, 0x7b, 0x12, 0xdc, 0x19, 0x33, 0xbe, 0x20,
+    0x8a, 0xcd, 0x05, 0x12, 0x7c, 0xf8, 0x81, 0xf0, 0x5a, 0xa5, 0xdd, 0x5b,
+    0x53, 0x0e, 0x78, 0xb6, 0x7a, 0xd2, 0xd4, 0xe2, 0xba, 0x6b, 0xbe, 0xcf,
+    0xf3, 0x29, 0xfa, 0xad, 0xa5, 0x03, 0x36, 0xfc, 0x33, 0x77, 0x1d, 0xd9,
+    0x3e, 0xf9, 0xa1, 0xa4, 0x8f, 0xd9, 0x5c, 0x9b, 0x14, 0xa4, 0x25, 0x12,
+    0x04, 0x2e, 0x6b, 0xe0, 0x74, 0xd3, 0xa6, 0x06, 0xe9, 0x40, 0xe9, 0x1e,
+    /* 13 */
+    0x5f, 0x0e, 0x8e, 0xa4, 0x66, 0xd6, 0x33, 0x7b, 0x7d, 0x07, 0xef, 0xdb,
+    0x53, 0xa6, 0xe0, 0xdc, 0xb9, 0x95, 0xe0, 0x2a, 0x94, 0xc1, 0x57, 0xbf,
+    0x83, 0x0a, 0x81, 0x1a, 0x1f, 0xbb, 0x10, 0x2c, 0xae, 0x78, 0x6f, 0x2a,
+    0xbb, 0x0f, 0xb9, 0xf0, 0xb6, 0x0d, 0xff, 0x39, 0x65, 0xc8, 0xe0, 0x83,
+    0x70, 0x8c, 0x30, 0xea, 0x76, 0x27, 0x39, 0x93, 0xa7, 0x76, 0x58, 0x69,
+    0xc8, 0xd8, 0x32, 0x1e, 0x60, 0x37, 0x61, 0x22, 0x15, 0xf7, 0x0b, 0x7a,
+    0x79, 0x23, 0x52, 0xf7, 0xf7, 0xe1, 0xc6, 0x02, 0xad, 0xe8, 0x3d, 0x00,
+    0x57, 0x8e, 0x7b, 0xed, 0x34, 0x06, 0x8a, 0x0d, 0x3c, 0x3e, 0x50, 0x29,
+    /* 14 */
+    0x73, 0x58, 0x76, 0x8f, 0x4c, 0xac, 0x7e, 0x5c, 0x04, 0xbe, 0x38, 0x37,
+    0x92, 0x60, 0xb7, 0xee, 0x2e, 0xef, 0x2f, 0xa1, 0x4a, 0xfe, 0xc2, 0x8b,
+    0xfe, 0x8b, 0xd5, 0xbf, 0x9a, 0x29, 0x4c, 0x81, 0x0a, 0x36, 0x34, 0x02,
+    0x1f, 0xc1, 0x1b, 0x27, 0xae, 0xc1, 0x35, 0x97, 0x02, 0x69, 0x97, 0x95,
+    0x27, 0x9a, 0xde, 0x30, 0x0f, 0x66, 0x8f, 0xc9, 0x0e, 0x58, 0xc2, 0x93,
+    0x90, 0xf2, 0x0e, 0x37, 0x42, 0x7f, 0xcd, 0x5f, 0x1f, 0xf8, 0x5d, 0x04,
+    0x55, 0xc4, 0x74, 0xf4, 0x88, 0xc6, 0xd2, 0xa5, 0xe5, 0xc3, 0x9b, 0xe8,
+    0xad, 0x33, 0x01, 0x58, 0x3e, 0x3a, 0xba, 0xda, 0x7f, 0x7b, 0x96, 0xbb,
+    /* 15 */
+    0x65, 0x41, 0xf6, 0xfa, 0x43, 0x5e, 0x0a, 0x97, 0x50, 0x94, 0x81, 0xd8,
+    0x9c, 0x11, 0xa9, 0x7b, 0x94, 0x3b, 0xe2, 0xdf, 0x92, 0x53, 0x64, 0x09,
+    0xe0, 0xf4, 0xdf, 0x8a, 0x38, 0xfc, 0x2d, 0xd1, 0xa1, 0x77, 0x87, 0xab,
+    0x7c, 0xdf, 0x3a, 0x12, 0xa9, 0x27, 0x75, 0x16, 0x74, 0xbe, 0xd4, 0x19,
+    0xe3, 0x4a, 0x64, 0x9a, 0x4b, 0x52, 0x9e, 0xae, 0x74, 0x9b, 0xaf, 0xd2,
+    0xe5, 0x18, 0x77, 0x12, 0x6c, 0xb7, 0x5c, 0xa2, 0x82, 0xf8, 0x6e, 0xd2,
+    0xa0, 0xeb, 0x36, 0xd4, 0xb4, 0x05, 0x0f, 0xe1, 0x1c, 0x44, 0x29, 0x20,
+    0x44, 0xa6, 0xaa, 0x79, 0x16, 0x30, 0x37, 0xc4, 0xf8, 0xb2, 0x98, 0x96,
+    /* 16 */
+    0xd9, 0x1a, 0x6c, 0x51, 0xfe, 0x78, 0xd2, 0xed, 0xe8, 0x4e, 0xf6, 0xe3,
+    0xbf, 0x87, 0x62, 0xc4, 0xe7, 0x16, 0x58, 0xe3, 0xb6, 0xc2, 0xc6, 0x28,
+    0x7f, 0x77, 0x5d, 0x79, 0x4b, 0xb5, 0xfd, 0xa9, 0x2b, 0x37, 0xaa, 0x1e,
+    0x53, 0xda, 0x67, 0xd6, 0x23, 0x19, 0x32, 0x42, 0xcd, 0x2c, 0xea, 0xf6,
+    0x65, 0xff, 0xac, 0xb3, 0xd5, 0xab, 0x9f, 0x93, 0x57, 0x7a, 0x31, 0xd6,
+    0x96, 0x7d, 0x10, 0xa7, 0x7a, 0x77, 0x41, 0xba, 0xc3, 0xe5, 0x92, 0xb3,
+    0x48, 0x9f, 0x00, 0x7d, 0xaf, 0x5a, 0x87, 0x4d, 0x5a, 0xaf, 0xb6, 0xfa,
+    0xb3, 0xa7, 0x8e, 0xd5, 0xd4, 0x4d, 0x69, 0x40, 0xc5, 0x6d, 0x1c, 0x53,
+    /* 17 */
+    0x8a, 0xd4, 0xa9, 0xd5, 0xe6, 0xd0, 0x51, 0x62, 0x75, 0x8e, 0x39, 0xbe,
+    0x75, 0x8c, 0xb1, 0xd9, 0x22, 0x14, 0xd0, 0xf2, 0x3d, 0xf9, 0xc6, 0x8c,
+    0xa1, 0xfa, 0x9f, 0x68, 0x12, 0x9d, 0x99, 0x18, 0x52, 0x68, 0xb3, 0x5b,
+    0xc2, 0x50, 0x01, 0x36, 0xb2, 0x87, 0xfb, 0x3e, 0x66, 0x67, 0x5f, 0xe6,
+    0xb5, 0xd1, 0x9c, 0xcd, 0xfe, 0x56, 0xe7, 0xb7, 0x02, 0x24, 0xec, 0x71,
+    0xaf, 0xee, 0x1c, 0x9b, 0x1c, 0xd2, 0xa7, 0x37, 0x1f, 0x35, 0xd7, 0x51,
+    0xfd, 0x64, 0x0d, 0x77, 0x1d, 0x02, 0xe2, 0xab, 0x29, 0xd6, 0x70, 0xfa,
+    0xbf, 0xa0, 0x8c, 0x37, 0x27, 0x4a, 0xcb, 0x90, 0x68, 0xa7, 0xed, 0x0f,
+    /* 18 */
+    0xcf, 0x7b, 0xb7, 0x00, 0x30, 0xf7, 0xd0, 0x2f, 0x6b, 0x4e, 0x02, 0x82,
+    0x2d, 0x02, 0xab, 0x19, 0x8c, 0xc2, 0x6c, 0x0f, 0xd8, 0xf0, 0x3c, 0x5a,
+    0xed, 0xda, 0x39, 0x27, 0x49, 0x38, 0x69, 0x38, 0xaf, 0x96, 0x81, 0x1d,
+    0x03, 0x37, 0x5a, 0x86, 0xe6, 0x20, 0xd9, 0x09, 0xb2, 0x40, 0x98, 0x43,
+    0xd3, 0xf3, 0x86, 0x41, 0xcd, 0x97, 0x22, 0xae, 0x90, 0x71, 0x50, 0xdd,
+    0x1a, 0xf4, 0x0b, 0x7f, 0xc0, 0x22, 0x70, 0xcb, 0x84, 0x63, 0xa3, 0xe0,
+    0xc8, 0x50, 0xee, 0x6f, 0x28, 0x3c, 0x7f, 0x68, 0x0e, 0xab, 0x5a, 0xa9,
+    0x45, 0xfb, 0x24, 0x75, 0x80, 0xd7, 0x87, 0xb1, 0x73, 0x37, 0x22, 0x39,
+    /* 19 */
+    0xa0, 0x1a, 0xb5, 0x1a, 0xba, 0x20, 0xe3, 0xbc, 0x51, 0x30, 0xa4, 0x7c,
+    0xdf, 0x04, 0x2d, 0x7e, 0x0c, 0xbd, 0xf5, 0xdc, 0x48, 0x69, 0xad, 0x12,
+    0x69, 0xc0, 0xb5, 0x03, 0xde, 0x53, 0x6f, 0x63, 0x3c, 0x8f, 0xa5, 0xac,
+    0x26, 0x10, 0x72, 0x5f, 0x00, 0x64, 0x84, 0x45, 0xa1, 0x44, 0xbd, 0x76,
+    0x52, 0xed, 0xef, 0xd8, 0xe6, 0x82, 0x92, 0x9d, 0xa4, 0x44, 0x70, 0x85,
+    0x72, 0x97, 0x22, 0xa5, 0xdb, 0x5b, 0xc6, 0xa9, 0xa6, 0xe5, 0xc4, 0x7e,
+    0x55, 0xc6, 0x39, 0xc2, 0x5f, 0x86, 0xf5, 0xfe, 0xef, 0x7b, 0xfd, 0xa6,
+    0x2f, 0x52, 0x0f, 0xba, 0xaf, 0xaf, 0xe1, 0x0f, 0x80, 0xc6, 0x3e, 0x3b,
+    /* 20 */
+    0x70, 0xd7, 0x60, 0x01, 0x2b, 0x21, 0x36, 0x50, 0x5a, 0x02, 0xb9, 0x48,
+    0x96, 0xa1, 0x58, 0x41, 0x4a, 0x51, 0x1c, 0xa5, 0xc9, 0x35, 0x97, 0x1f,
+    0x8b, 0x65, 0xee, 0xe1, 0xa8, 0x6e, 0x72, 0xc3, 0xc5, 0xea, 0x3f, 0x3a,
+    0x34, 0x92, 0x80, 0x4e, 0xfd, 0x6d, 0x56, 0x45, 0xa2, 0x81, 0x6c, 0x0a,
+    0x25, 0x72, 0xd6, 0x22, 0x1e, 0x9d, 0x3c, 0x78, 0x2a, 0xfb, 0xa7, 0x8b,
+    0x4d, 0x1c, 0x2a, 0x26, 0xe6, 0xce, 0x86, 0x48, 0x56, 0x28, 0xb9, 0xe8,
+    0xdc, 0x9b, 0x37, 0x50, 0x81, 0x72, 0x6e, 0x34, 0xda, 0x18, 0x42, 0x45,
+    0x0d, 0x3e, 0x61, 0x9c, 0x6f, 0xa0, 0x4d, 0x78, 0x65, 0x33, 0x08, 0xb7,
+    /* 21 */
+    0xc8, 0x11, 0xaa, 0x8b, 0x3a, 0xd9, 0x51, 0x7d, 0x9c, 0x89, 0x3d, 0xd5,
+    0xf6, 0xe1, 0xf1, 0x8d, 0x84, 0x23, 0x47, 0x8d, 0x02, 0x09, 0xd1, 0xfa,
+    0x0e, 0x1f, 0x46, 0x47, 0xf7, 0x10, 0x87, 0xa0, 0x28, 0x2e, 0xbc, 0x1e,
+    0x6f, 0x4b, 0x70, 0x80, 0x4a, 0xd4, 0x82, 0xd3, 0x84, 0x90, 0x72, 0x95,
+    0xc9, 0x55, 0xac, 0x20, 0xc6, 0xc9, 0xc0, 0xa6, 0x84, 0x89, 0x48, 0x02,
+    0x56, 0x2d, 0x92, 0x2e, 0xb7, 0x27, 0x6e, 0x59, 0xe7, 0x32, 0x5e, 0x5d,
+    0x78, 0x37, 0x61, 0x80, 0xca, 0xf0, 0x4a, 0x4d, 0x8b, 0xfd, 0xf9, 0x1b,
+    0xd2, 0x00, 0x4c, 0x7d, 0xbc, 0x4d, 0xeb, 0xdf, 0xd7, 0x5e, 0x02, 0x2d,
+    /* 22 */
+    0x2a, 0x90, 0xe5, 0xf2, 0xd9, 0xa3, 0xaf, 0xfe, 0xe0, 0x5f, 0xc5, 0x93,
+    0xc9, 0x0c, 0x38, 0x51, 0xa4, 0x13, 0x80, 0x52, 0xa7, 0xf9, 0x91, 0xad,
+    0x7a, 0xe5, 0xe9, 0x2c, 0xcf, 0xf9, 0xa4, 0xa2, 0x97, 0x22, 0xb8, 0x9a,
+    0x5c, 0x06, 0x04, 0x9f, 0x0a, 0xf3, 0x02, 0x69, 0x9e, 0xa5, 0x6f, 0xee,
+    0xda, 0x46, 0x27, 0xe4, 0xd2, 0xf5, 0xab, 0x4e, 0xe6, 0xdf, 0xc5, 0x4d,
+    0x11, 0x7d, 0xe9, 0x78, 0xac, 0xda, 0x4e, 0x3f, 0x92, 0xc8, 0x99, 0x21,
+    0x50, 0x96, 0x3e, 0xd4, 0x6d, 0xf2, 0x1f, 0xe0, 0xe8, 0xf6, 0x30, 0xee,
+    0x23, 0xdd, 0x4b, 0x60, 0x3c, 0xf9, 0x23, 0x3c, 0xf8, 0xe6, 0x63, 0x3c,
+    /* 23 */
+    0xa6, 0x55, 0x0e, 0xb2, 0xad, 0xea, 0xa3, 0x7c, 0x9a, 0x58, 0x68, 0x3c,
+    0xcf, 0x74, 0xcf, 0x1d, 0x0d, 0xb2, 0x3a, 0x43, 0x2b, 0x6f, 0x81, 0x6a,
+    0xf2, 0xf8, 0xbe, 0x04, 0xb9, 0x5d, 0x29, 0xf2, 0xf5, 0x84, 0x6e, 0xa8,
+    0xd3, 0x6b, 0x7f, 0x65, 0xc3, 0x2d, 0x7a, 0x99, 0x1f, 0x33, 0x15, 0x8b,
+    0x82, 0x83, 0x03, 0x01, 0x99, 0x6a, 0x20, 0x86, 0xae, 0x67, 0x0b, 0x73,
+    0x48, 0xae, 0x8c, 0x0a, 0x26, 0x71, 0xac, 0x30, 0x7a, 0x32, 0x1a, 0x32,
+    0xea, 0x63, 0x27, 0xfd, 0x31, 0xee, 0x6f, 0x85, 0x24, 0x61, 0x53, 0x27,
+    0xf7, 0x49, 0x94, 0x83, 0x42, 0xb3, 0xfb, 0xa4, 0x47, 0x05, 0x7b, 0x02,
+    /* 24 */
+    0x3c, 0x98, 0x83, 0x8a, 0xc9, 0xbe, 0x7f, 0xf8, 0x59, 0x83, 0x84, 0x0f,
+    0xe2, 0x00, 0xc2, 0xfb, 0xe5, 0x3a, 0xe6, 0x78, 0x19, 0xbd, 0x54, 0x2e,
+    0x19, 0x4b, 0x26, 0x65, 0x0d, 0x53, 0x4c, 0x70, 0x95, 0x91, 0xe4, 0x60,
+    0x9a, 0x66, 0x0c, 0xa6, 0x50, 0xf1, 0xa9, 0xbd, 0xb5, 0xdf, 0x93, 0x27,
+    0x8e, 0x9f, 0xde, 0x8f, 0x08, 0x0c, 0x3b, 0x9c, 0xfb, 0xd0, 0x67, 0x7f,
+    0x8e, 0x75, 0x27, 0x66, 0x01, 0x66, 0x34, 0x35, 0xa8, 0xf4, 0x05, 0x76,
+    0xe4, 0xd2, 0xfe, 0x37, 0x11, 0xf9, 0x9c, 0x21, 0xc9, 0xa0, 0xac, 0x9c,
+    0x99, 0xac, 0x40, 0xec, 0x9c, 0xb6, 0x92, 0xa4, 0x4c, 0x76, 0x27, 0x30,
+    /* 25 */
+    0x5c, 0xf0, 0xf9, 0xd0, 0xfc, 0xfb, 0xda, 0xc8, 0x12, 0x0b, 0xab, 0x6e,
+    0x56, 0x22, 0x93, 0xf1, 0x8c, 0x8c, 0xc1, 0xf0, 0xc0, 0x9e, 0xa8, 0xf4,
+    0x0e, 0x16, 0x71, 0x06, 0x53, 0xcf, 0x8d, 0x84, 0x84, 0x15, 0xf9, 0xff,
+    0x1a, 0x1a, 0x87, 0xc1, 0x42, 0x26, 0x85, 0xd5, 0x1b, 0xe4, 0x5f, 0xc3,
+    0xb2, 0x99, 0xe4, 0xc0, 0xbb, 0x5f, 0x68, 0x7c, 0x5f, 0x4a, 0xfc, 0x82,
+    0x49, 0x54, 0xc3, 0xd6, 0xb5, 0x53, 0x70, 0x2c, 0xa7, 0x86, 0xfc, 0x40,
+    0xab, 0xf2, 0xa5, 0x6b, 0x99, 0x84, 0xa2, 0x68, 0x4e, 0x1c, 0xef, 0x47,
+    0xd6, 0x66, 0x9c, 0x00, 0x10, 0x6f, 0xa6, 0x77, 0xb8, 0x3d, 0xcc, 0xaf,
+    /* 26 */
+    0xde, 0x01, 0x48, 0xec, 0xdb, 0xb0, 0x44, 0xef, 0xf3, 0xe4, 0x0e, 0x57,
+    0x85, 0x87, 0xe6, 0x2d, 0xce, 0xf0, 0x98, 0xd9, 0x88, 0xb9, 0xc9, 0xf6,
+    0x90, 0xf8, 0x04, 0xfb, 0xdb, 0x96, 0xdf, 0x04, 0xc9, 0xfc, 0x3c, 0x1f,
+    0x62, 0xe7, 0xe2, 0x69, 0x07, 0x2f, 0x45, 0x8d, 0x54, 0xc8, 0x5b, 0x88,
+    0xff, 0xdf, 0x2f, 0x58, 0xa0, 0xb1, 0x27, 0x61, 0x4b, 0xc5, 0x76, 0xce,
+    0x6a, 0x26, 0x84, 0xaa, 0xe7, 0xdc, 0x01, 0x99, 0x9d, 0xe6, 0x1f, 0x9e,
+    0x9b, 0x94, 0x59, 0x2b, 0x8b, 0xea, 0x80, 0xee, 0x86, 0x50, 0x74, 0x84,
+    0x42, 0x32, 0x7d, 0x10, 0x69, 0x34, 0x52, 0xfd, 0x54, 0xde, 0xe3, 0x89,
+    /* 27 */
+    0x50, 0xe9, 0x83, 0x6a, 0x75, 0xaa, 0x28, 0xd4, 0x65, 0x2d, 0x53, 0x4c,
+    0x21, 0xc4, 0x7c, 0xbf, 0x54, 0x16, 0xf5, 0x92, 0x27, 0x58, 0xbd, 0x5b,
+    0xf9, 0x7b, 0xda, 0xc6, 0x05, 0xbc, 0x77, 0x58, 0x2e, 0x06, 0x59, 0xc0,
+    0xac, 0xca, 0x49, 0xec, 0x88, 0x03, 0xde, 0xb7, 0x54, 0xee, 0x24, 0x3e,
+    0x82, 0x24, 0xda, 0x88, 0x87, 0xa8, 0xd0, 0x78, 0x00, 0x29, 0x3b, 0xd8,
+    0x3f, 0xfe, 0xf9, 0x17, 0x10, 0x8d, 0x27, 0xac, 0x34, 0x6c, 0x14, 0x7b,
+    0xc7, 0x4e, 0x5e, 0x3b, 0x58, 0x85, 0x61, 0x6d, 0xcd, 0xe8, 0x98, 0x72,
+    0x13, 0x03, 0x0c, 0x71, 0xed, 0x57, 0xdd, 0xea, 0xb6, 0x70, 0xbf, 0x38,
+    /* 28 */
+    0xde, 0x66, 0xd6, 0xc9, 0xb1, 0xf1, 0x55, 0xed, 0x56, 0x89, 0x43, 0x4f,
+    0x15, 0xd4, 0xfd, 0xfd, 0x76, 0x02, 0x1e, 0x22, 0x40, 0xb4, 0x18, 0xba,
+    0x5e, 0x75, 0x05, 0x60, 0xd9, 0x59, 0xc9, 0x53, 0x16, 0x23, 0xdf, 0x5a,
+    0x5e, 0x53, 0xa0, 0x8b, 0x9b, 0x8c, 0x2d, 0xe2, 0x85, 0x0e, 0x03, 0x2c,
+    0x19, 0xb3, 0xee, 0x03, 0xc6, 0x85, 0xd6, 0x91, 0x85, 0x14, 0x38, 0xb3,
+    0x24, 0x0d, 0x79, 0xdc, 0x7b, 0x90, 0x62, 0xee, 0xbc, 0xc1, 0x09, 0x7a,
+    0x3a, 0x19, 0x42, 0xab, 0xde, 0x27, 0x9d, 0x6f, 0xf4, 0x14, 0x4e, 0x60,
+    0x24, 0xc1, 0x96, 0xfa, 0x24, 0x85, 0x48, 0x39, 0xb3, 0xf7, 0x99, 0x92,
+    /* 29 */
+    0xd8, 0xd2, 0x37, 0x62, 0xf1, 0x77, 0xdd, 0xd6, 0xc7, 0x3c, 0x40, 0x28,
+    0xa0, 0x17, 0xb5, 0xe5, 0x7d, 0x01, 0xae, 0x58, 0x2b, 0x1f, 0x57, 0x87,
+    0x23, 0xc6, 0xa2, 0x0f, 0x51, 0xed, 0x84, 0x60, 0x20, 0x07, 0x62, 0xa0,
+    0x5d, 0xf3, 0x8c, 0xf0, 0x47, 0x91, 0xb9, 0xa5, 0x1f, 0xdb, 0x21, 0xdc,
+    0x54, 0xf8, 0xac, 0xbb, 0x2d, 0x19, 0x9c, 0xec, 0xda, 0xef, 0x1b, 0xe8,
+    0x97, 0x88, 0x26, 0xe6, 0xe0, 0xa4, 0x0b, 0xee, 0xbb, 0xa1, 0x74, 0x4a,
+    0x50, 0x13, 0xd7, 0xdc, 0x56, 0xc9, 0xa0, 0x93, 0x30, 0x19, 0x30, 0x17,
+    0x76, 0x6f, 0x96, 0xdb, 0x2c, 0xa3, 0xf0, 0x5f, 0x65, 0x02, 0xf0, 0x3c,
+    /* 30 */
+    0x19, 0x7c, 0x2b, 0x48, 0x23, 0xfb, 0x1a, 0x8a, 0x32, 0x29, 0xa4, 0xf7,
+    0xf1, 0x92, 0x26, 0x76, 0x5a, 0x92, 0x4d, 0xa6, 0xca, 0x60, 0x3f, 0x7a,
+    0xd4, 0xa8, 0x0c, 0x75, 0x0e, 0x7e, 0xa6, 0xe1, 0x77, 0x8b, 0x48, 0x79,
+    0x5a, 0x9b, 0x54, 0x04, 0x80, 0xf1, 0x30, 0x23, 0xae, 0xb3, 0x30, 0xa1,
+    0x37, 0xf8, 0x1a, 0xa5, 0xcf, 0x17, 0x7f, 0x1b, 0x80, 0x46, 0x0d, 0x4e,
+    0x9f, 0xf9, 0xbf, 0xc5, 0xd8, 0xc7, 0x49, 0xc5, 0xff, 0x31, 0xb6, 0x38,
+    0xc5, 0x8a, 0xd8, 0x9b, 0x42, 0x57, 0xa1, 0x94, 0xbf, 0x3e, 0x08, 0x88,
+    0x09, 0xc4, 0xba, 0x6a, 0x1c, 0xc4, 0x15, 0x42, 0x62, 0x9a, 0xb9, 0x02,
+    /* 31 */
+    0x6f, 0xd9, 0x4b, 0x0c, 0xe6, 0x39, 0x5b, 0xf6, 0xd5, 0xaa, 0x73, 0xe3,
+    0x68, 0x72, 0xb1, 0x23, 0xdc, 0x41, 0xd9, 0xbd, 0x55, 0xa0, 0x52, 0x87,
+    0xa5, 0x55, 0x1e, 0x44, 0x91, 0xae, 0x21, 0x9f, 0x30, 0x3f, 0x48, 0xa6,
+    0xbf, 0x99, 0xa0, 0xbf, 0x1a, 0xe0, 0xc4, 0xe1, 0x1c, 0x71, 0x85, 0x80,
+    0x5c, 0x13, 0xeb, 0x4b, 0xd9, 0x02, 0x46, 0x34, 0x29, 0xc0, 0x21, 0x7b,
+    0xdf, 0x9f, 0x53, 0x71, 0x94, 0xfe, 0xda, 0xfb, 0xf3, 0xbc, 0x5f, 0x5f,
+    0x8a, 0xdb, 0xd8, 0xc1, 0xca, 0x51, 0xaf, 0xea, 0x9c, 0xd9, 0x62, 0x08,
+    0x49, 0x7c, 0xac, 0x10, 0xbb, 0x95, 0xfd, 0xba, 0xc0, 0x0a, 0xfb, 0xc1,
+};
+#endif /* ECC384 */
+
+#ifdef ECC521
+/* SECP521R1: spacing 87, Montgomery R = 2^576 */
+static const byte ecc_comb_secp521r1[ECC_COMB_ENTRIES * 2 * 66] = {
+    /* 0 */
+    0x01, 0x3d, 0x64, 0x43, 0xe3, 0x8f, 0x62, 0xab, 0x67, 0x87, 0x9f, 0x40,
+    0x08, 0x8b, 0xc0, 0x01, 0x18, 0x06, 0xf9, 0x27, 0x02, 0x21, 0x99, 0x0d,
+    0x9f, 0x86, 0xbc, 0x8e, 0x7d, 0x35, 0x7d, 0x0c, 0x92, 0xb9, 0x33, 0x0c,
+    0x8c, 0xb6, 0xc5, 0x42, 0xf4, 0xf2, 0xac, 0x32, 0x95, 0x56, 0x80, 0x56,
+    0x17, 0x29, 0x35, 0xae, 0xd5, 0xe4, 0x81, 0x68, 0x53, 0x6d, 0xf8, 0x78,
+    0x62, 0x27, 0x7d, 0xd7, 0x74, 0x9d, 0x00, 0x84, 0xb2, 0xc1, 0xa9, 0xba,
+    0x41, 0x36, 0x41, 0xa9, 0x25, 0x31, 0x70, 0xc4, 0xba, 0xe2, 0x0a, 0xc1,
+    0x6c, 0x4f, 0x32, 0x3c, 0xbb, 0xe3, 0x87, 0xc4, 0x3f, 0x20, 0x35, 0xec,
+    0x3b, 0xc8, 0xa5, 0xaa, 0x2d, 0xed, 0x43, 0x91, 0xd8, 0x3c, 0xb2, 0xec,
+    0xc0, 0x4f, 0x21, 0xc1, 0x2f, 0x3a, 0xd5, 0xc4, 0x69, 0x13, 0x26, 0x4e,
+    0x2c, 0x19, 0x6c, 0xc2, 0x28, 0x74, 0xda, 0xbf, 0xc7, 0xbd, 0x8e, 0x97,
+    /* 1 */
+    0x01, 0xff, 0xf9, 0x04, 0x14, 0xc1, 0xc1, 0x4c, 0x2e, 0xcd, 0xfc, 0x61,
+    0x89, 0x73, 0x7d, 0x0b, 0x77, 0x6e, 0x3d, 0xe6, 0x93, 0x42, 0x15, 0x11,
+    0x0f, 0x86, 0x28, 0xa0, 0x32, 0xde, 0x93, 0xef, 0x0f, 0x2e, 0x04, 0x95,
+    0xb6, 0xb4, 0x0f, 0xdb, 0xcc, 0x59, 0xbe, 0x0e, 0x9c, 0x5b, 0x92, 0x40,
+    0xc2, 0x81, 0x97, 0x7e, 0x1a, 0x82, 0xe0, 0x71, 0x60, 0x1e, 0xbc, 0x80,
+    0x72, 0x3e, 0xfa, 0xd2, 0x74, 0xe9, 0x01, 0x6c, 0x92, 0x6d, 0x69, 0x7b,
+    0xb0, 0x28, 0x00, 0x7a, 0xb9, 0xe5, 0xd4, 0xfa, 0xb6, 0x48, 0x3d, 0x1e,
+    0xf7, 0x2a, 0x79, 0x3f, 0x40, 0x48, 0x30, 0x3e, 0xfa, 0x0f, 0xe6, 0xd3,
+    0x96, 0x5f, 0x7a, 0x9c, 0x63, 0xd9, 0x82, 0xbd, 0x5a, 0xbe, 0xfd, 0xaf,
+    0x61, 0x24, 0x3f, 0x40, 0xc1, 0x81, 0x1c, 0xcf, 0xd4, 0x6c, 0x65, 0x5a,
+    0x93, 0xdb, 0xfd, 0x94, 0xde, 0xbc, 0x09, 0x47, 0x5e, 0xb2, 0x29, 0xe8,
+    /* 2 */
+    0x01, 0xf3, 0x26, 0x91, 0x1a, 0x4d, 0xe3, 0x52, 0xb5, 0x80, 0xef, 0x1f,
+    0xf3, 0x51, 0x4a, 0x41, 0x11, 0xc5, 0x07, 0x20, 0x18, 0xd5, 0x29, 0x53,
+    0x26, 0xfb, 0xe6, 0x81, 0x88, 0x02, 0x40, 0xd5, 0xc9, 0xed, 0x45, 0xbd,
+    0xe7, 0x47, 0xae, 0x5d, 0x35, 0x26, 0xf7, 0x1d, 0xdd, 0xa1, 0x1f, 0x48,
+    0x24, 0x5d, 0xce, 0x87, 0x9a, 0xcb, 0x0b, 0xa5, 0xaa, 0x77, 0x9b, 0x11,
+    0x50, 0x29, 0xa2, 0x17, 0x3f, 0x69, 0x00, 0x5a, 0xba, 0xdd, 0x79, 0x99,
+    0xd3, 0xef, 0x4d, 0x65, 0xde, 0x4a, 0xeb, 0x32, 0x40, 0xfd, 0x3f, 0x7e,
+    0x60, 0xa6, 0xd5, 0x28, 0x3d, 0xb2, 0x6f, 0xa3, 0x8d, 0x14, 0x3d, 0x43,
+    0xbe, 0x8a, 0x81, 0x13, 0xd8, 0x58, 0x7d, 0xc9, 0xac, 0x2b, 0x59, 0x78,
+    0x40, 0x56, 0xca, 0x93, 0x5e, 0xa6, 0x2b, 0x1d, 0xfa, 0xb8, 0x46, 0xf1,
+    0x37, 0x71, 0x5d, 0xea, 0x19, 0xa4, 0x8a, 0x8c, 0x44, 0x0e, 0x84, 0xe1,
+    /* 3 */
+    0x01, 0xcc, 0xfc, 0xcd, 0x8b, 0xfa, 0x36, 0x96, 0xf5, 0x3e, 0x20, 0xf4,
+    0x89, 0x8e, 0xc4, 0x71, 0x9c, 0x62, 0x4f, 0xf5, 0x76, 0x17, 0xa1, 0xff,
+    0xb5, 0x88, 0xa9, 0xbb, 0xb7, 0x6f, 0xc0, 0xa5, 0x6f, 0x1c, 0x06, 0x2e,
+    0xaa, 0xaf, 0x83, 0xc9, 0x81, 0xde, 0xc5, 0x91, 0xcd, 0x01, 0xe2, 0xa9,
+    0xef, 0x7e, 0xdb, 0x66, 0x6e, 0xf0, 0x8f, 0xbb, 0x48, 0xc7, 0x4b, 0xe8,
+    0x2f, 0x13, 0xbb, 0x02, 0x83, 0xe3, 0x00, 0x42, 0xcf, 0xa6, 0x8a, 0xaf,
+    0x92, 0x2b, 0x62, 0x79, 0xd8, 0x45, 0x60, 0x78, 0x03, 0xfe, 0x3e, 0x10,
+    0x4f, 0x3c, 0x13, 0x73, 0x38, 0xc3, 0xa0, 0xda, 0xdd, 0x19, 0x40, 0x73,
+    0xd6, 0x25, 0x74, 0x6b, 0x2e, 0x82, 0xdc, 0x03, 0xeb, 0xff, 0x9a, 0x99,
+    0xe1, 0xfa, 0x4b, 0x6e, 0xc2, 0x63, 0x3a, 0x41, 0x47, 0xaa, 0x7a, 0x7d,
+    0x47, 0x22, 0xd9, 0xfc, 0x91, 0x27, 0x76, 0x09, 0x06, 0x50, 0x1c, 0xb8,
+    /* 4 */
+    0x00, 0xf4, 0xc6, 0xd2, 0xd2, 0xb5, 0x62, 0x44, 0x72, 0xff, 0x67, 0xf0,
+    0xf7, 0x13, 0xcd, 0x4d, 0x95, 0x21, 0xa5, 0xa2, 0x05, 0x18, 0xc2, 0x01,
+    0xda, 0xe4, 0x9f, 0xa3, 0x95, 0x8d, 0x50, 0xd9, 0x91, 0x65, 0xce, 0x67,
+    0x6e, 0x09, 0x9a, 0xdc, 0x92, 0x59, 0x6c, 0x66, 0xf0, 0x90, 0x00, 0x6a,
+    0xff, 0x84, 0x21, 0xc7, 0xaf, 0x66, 0xae, 0x5b, 0xb7, 0x3e, 0xa4, 0x51,
+    0x15, 0x99, 0xe9, 0x14, 0xab, 0x0f, 0x01, 0xa9, 0x34, 0x8c, 0xa7, 0xac,
+    0xc8, 0x3d, 0x8f, 0x8e, 0x24, 0x70, 0xeb, 0x0c, 0x66, 0xcc, 0x6b, 0xe8,
+    0x78, 0xf5, 0x27, 0x0d, 0xdc, 0xdc, 0x72, 0x15, 0x97, 0xaa, 0x11, 0xaa,
+    0xd3, 0x49, 0xd4, 0x77, 0x9d, 0x47, 0x7b, 0x6f, 0x9f, 0x88, 0x5c, 0xe1,
+    0xa3, 0xdc, 0x2e, 0x17, 0x84, 0x0f, 0x81, 0x23, 0xfb, 0x86, 0x54, 0xf1,
+    0x88, 0x2e, 0xfd, 0xde, 0xb9, 0xd3, 0x82, 0x24, 0x35, 0x9a, 0x7a, 0xb7,
+    /* 5 */
+    0x00, 0x4f, 0xb2, 0x83, 0x7e, 0xba, 0xbf, 0xab, 0xcc, 0xb3, 0x8a, 0xcc,
+    0x5d, 0x2b, 0x3b, 0x78, 0x68, 0x76, 0x60, 0x10, 0x3c, 0x54, 0x2e, 0xb5,
+    0x68, 0x82, 0x7a, 0xfa, 0x53, 0x32, 0x40, 0x86, 0x86, 0xfc, 0x8f, 0xd3,
+    0x0b, 0x8c, 0xb1, 0x29, 0x6d, 0x65, 0x1e, 0xf1, 0x19, 0x75, 0x46, 0x7d,
+    0x46, 0x70, 0xa0, 0x46, 0x19, 0xfe, 0x2f, 0xf3, 0x71, 0x61, 0x56, 0xde,
+    0x6e, 0xd7, 0x47, 0x41, 0x1c, 0x33, 0x00, 0xe0, 0x10, 0xa3, 0x8e, 0x39,
+    0xfd, 0x32, 0xe7, 0x3b, 0xdc, 0xbd, 0x66, 0x41, 0x39, 0x2f, 0x6d, 0x4b,
+    0xaf, 0x8a, 0x52, 0xe7, 0x48, 0x47, 0x4d, 0x01, 0x81, 0xd5, 0xa5, 0x2e,
+    0xa8, 0x53, 0x1a, 0x91, 0x18, 0x83, 0xd7, 0x3b, 0xfa, 0x2a, 0xc1, 0xd0,
+    0x68, 0x17, 0x16, 0x6b, 0xe9, 0x54, 0xe5, 0xd8, 0xd1, 0x1d, 0xe0, 0xc0,
+    0x2f, 0x81, 0xfc, 0xf3, 0x37, 0x6b, 0xf7, 0x59, 0x81, 0xe2, 0x6e, 0x43,
+    /* 6 */
+    0x01, 0x6c, 0x3a, 0x56, 0x4f, 0x4b, 0xd6, 0xb7, 0xa6, 0xd9, 0xca, 0x89,
+    0x8b, 0x1f, 0x58, 0x40, 0xc8, 0xea, 0x34, 0x50, 0x24, 0x67, 0xc8, 0xac,
+    0x0a, 0xee, 0x43, 0x30, 0xcc, 0x30, 0xb2, 0x3c, 0xef, 0x45, 0xfa, 0x9c,
+    0xa6, 0xf8, 0xa4, 0xf5, 0xb3, 0xce, 0xfc, 0x01, 0xe0, 0x98, 0xe1, 0x0f,
+    0xa1, 0xc6, 0x0d, 0x6b, 0x6b, 0x4d, 0x6d, 0xdd, 0x9a, 0xce, 0xb7, 0x15,
+    0x73, 0x94, 0xf8, 0xc7, 0xe1, 0x3c, 0x00, 0x3f, 0x14, 0xa1, 0xb0, 0xbf,
+    0x55, 0xd6, 0x13, 0xa9, 0xe5, 0x9c, 0xaa, 0xd6, 0x2c, 0x91, 0xfc, 0xa9,
+    0x7b, 0x9e, 0xfe, 0xe6, 0x9f, 0x15, 0x08, 0x52, 0x7a, 0xb6, 0xa0, 0xe7,
+    0x3f, 0x79, 0xe9, 0x53, 0x5e, 0x01, 0x2f, 0x2d, 0xe4, 0x18, 0xa5, 0x72,
+    0xac, 0x30, 0xc5, 0xab, 0xd6, 0x58, 0xa6, 0xfa, 0x83, 0xe1, 0xf6, 0x7d,
+    0xca, 0x19, 0x26, 0x22, 0x60, 0x02, 0x4e, 0xca, 0xe8, 0xcf, 0xa0, 0x9e,
+    /* 7 */
+    0x01, 0xdc, 0xf2, 0x6f, 0xf3, 0xc5, 0x87, 0x74, 0x97, 0xfe, 0xe7, 0xaa,
+    0xf8, 0xca, 0x1b, 0x1e, 0x94, 0x39, 0x04, 0xa6, 0x46, 0x1c, 0xdd, 0xbb,
+    0x51, 0x7c, 0x37, 0x2d, 0x64, 0xca, 0xb3, 0x20, 0x6d, 0xa6, 0xd7, 0xdd,
+    0x93, 0x6d, 0x26, 0x60, 0x09, 0xee, 0x79, 0xa9, 0x39, 0x20, 0x35, 0xdc,
+    0x98, 0x37, 0x98, 0xfb, 0xbd, 0xde, 0xe1, 0xac, 0x71, 0x85, 0xbb, 0xfd,
+    0x9c, 0x34, 0xef, 0xcb, 0x14, 0xb7, 0x01, 0x14, 0xa6, 0xbe, 0x41, 0x45,
+    0x98, 0x07, 0xf7, 0x76, 0x73, 0x28, 0xbb, 0x63, 0xc3, 0x28, 0x12, 0xf2,
+    0xb7, 0xa1, 0x9c, 0xe6, 0xa5, 0xac, 0x96, 0x83, 0xc5, 0x53, 0x08, 0x41,
+    0x74, 0x53, 0xc9, 0x1f, 0x57, 0x20, 0xff, 0x65, 0xc0, 0x89, 0x85, 0x8f,
+    0x23, 0x03, 0x28, 0x59, 0x45, 0xf4, 0xfd, 0xd4, 0xcb, 0x92, 0x8a, 0x23,
+    0x84, 0x6d, 0x86, 0xfb, 0xa6, 0x5e, 0x72, 0x19, 0x9b, 0x94, 0x8f, 0x07,
+    /* 8 */
+    0x00, 0x7e, 0xf9, 0x2c, 0x67, 0x27, 0x6b, 0x97, 0xbb, 0x87, 0xc3, 0xec,
+    0x21, 0xae, 0x93, 0x9e, 0xf5, 0x03, 0x38, 0x84, 0xc2, 0x2a, 0x57, 0xf2,
+    0x3a, 0x30, 0xb5, 0xc2, 0x77, 0x54, 0x2e, 0x58, 0x5f, 0xb9, 0xe4, 0xf0,
+    0x4f, 0x4c, 0xfe, 0xa8, 0x57, 0x04, 0x8d, 0x7e, 0x2c, 0x8e, 0x61, 0xad,
+    0xa1, 0x29, 0xa1, 0x9a, 0x83, 0x88, 0xc6, 0x8f, 0x1c, 0x9f, 0xbe, 0x82,
+    0xc5, 0x9a, 0xa2, 0x27, 0x93, 0x8d, 0x01, 0x93, 0x1a, 0x92, 0x99, 0x8e,
+    0x02, 0xf9, 0xb5, 0x45, 0xde, 0x0c, 0xcd, 0x1e, 0x5c, 0xbf, 0xf6, 0xb3,
+    0xd2, 0xee, 0x5e, 0xbf, 0xe2, 0x28, 0x91, 0x1a, 0x85, 0x6b, 0x92, 0x70,
+    0x21, 0xc7, 0x0c, 0x6c, 0x59, 0xb6, 0x11, 0xf1, 0x41, 0x99, 0x08, 0x3c,
+    0x6f, 0x49, 0xe1, 0x80, 0x14, 0x1b, 0x9f, 0x98, 0xb3, 0xe3, 0xa8, 0x1c,
+    0x52, 0x0d, 0xa5, 0x6d, 0xf4, 0xdb, 0x3f, 0x58, 0x06, 0x7d, 0x76, 0xb7,
+    /* 9 */
+    0x01, 0xa2, 0x9e, 0xf6, 0x74, 0xcc, 0x51, 0x15, 0xb3, 0xdf, 0x17, 0x13,
+    0xf0, 0x2e, 0x8e, 0x1d, 0xf1, 0x80, 0x9d, 0xb0, 0xf1, 0xae, 0xed, 0xc5,
+    0xe9, 0x4e, 0x56, 0x95, 0x45, 0x0f, 0x7f, 0x48, 0x2d, 0x51, 0x6f, 0xae,
+    0x1e, 0x47, 0x7c, 0x85, 0x56, 0x42, 0x36, 0xce, 0xb2, 0x0e, 0xd1, 0x06,
+    0x90, 0x19, 0xe7, 0xf2, 0xb6, 0x8d, 0x77, 0xf6, 0x45, 0xce, 0xa9, 0xc1,
+    0xdc, 0xf3, 0xa3, 0xdf, 0x50, 0x96, 0x01, 0xd1, 0x1c, 0x00, 0x3c, 0xe3,
+    0x74, 0xf2, 0xb0, 0x08, 0x33, 0x5e, 0x76, 0xf9, 0x50, 0x56, 0x6b, 0x37,
+    0x78, 0x40, 0x2b, 0x8a, 0xa8, 0xbb, 0xcd, 0x20, 0x4e, 0x05, 0x31, 0x66,
+    0x24, 0x8a, 0x3f, 0xaf, 0x77, 0x04, 0x2a, 0x26, 0x81, 0x75, 0x1f, 0x79,
+    0x26, 0xed, 0x3e, 0xda, 0x96, 0x07, 0xc3, 0x39, 0x65, 0x11, 0x86, 0xd8,
+    0xc6, 0x61, 0xe7, 0x0f, 0xe1, 0xb6, 0x06, 0x7a, 0xac, 0x57, 0x66, 0x43,
+    /* 10 */
+    0x00, 0xed, 0x6a, 0xae, 0xfc, 0xa0, 0x51, 0x41, 0x74, 0xf1, 0x94, 0x79,
+    0x96, 0xdf, 0x86, 0x59, 0xf8, 0x28, 0x69, 0x12, 0xe8, 0x58, 0xda, 0x52,
+    0xb4, 0x42, 0xf7, 0xbe, 0x4c, 0x3f, 0x76, 0x7b, 0xd5, 0xb4, 0x4a, 0xe9,
+    0xfb, 0x66, 0x75, 0x56, 0x88, 0xd1, 0xc3, 0x51, 0xbb, 0xbe, 0x3c, 0xe1,
+    0x2f, 0xd5, 0xf4, 0x80, 0x24, 0x58, 0x83, 0xc6, 0x16, 0xda, 0x22, 0xec,
+    0x39, 0x35, 0x73, 0xd7, 0x15, 0xe8, 0x00, 0x8b, 0xae, 0x58, 0xa9, 0x9f,
+    0x37, 0x42, 0x04, 0xa6, 0x2a, 0x21, 0xc6, 0xdc, 0xb0, 0x79, 0x33, 0xa7,
+    0xe4, 0x24, 0x01, 0xb0, 0x37, 0x50, 0x37, 0x4b, 0x91, 0xf1, 0x20, 0xb8,
+    0x39, 0x2e, 0xf8, 0xdb, 0x10, 0x8a, 0xaf, 0x94, 0xe2, 0xb6, 0x7a, 0xbc,
+    0x0a, 0x3c, 0x9f, 0xc8, 0xd0, 0xfe, 0xc9, 0xb5, 0x7e, 0x9e, 0xa5, 0x8d,
+    0x50, 0xe5, 0xa9, 0x01, 0x0b, 0x96, 0x7d, 0x27, 0xad, 0x24, 0x55, 0xb2,
+    /* 11 */
+    0x01, 0x4a, 0xa8, 0x10, 0x0f, 0x5c, 0xa9, 0x26, 0xcb, 0x45, 0xbe, 0x93,
+    0x9c, 0x5b, 0x84, 0xfe, 0x89, 0x24, 0xb5, 0x3d, 0xcc, 0xc8, 0x5b, 0xe3,
+    0xdc, 0xbc, 0xce, 0x78, 0x6c, 0xe1, 0x1a, 0x62, 0x12, 0x2f, 0x2a, 0xc7,
+    0xd4, 0x59, 0x1f, 0x7e, 0x4e, 0xa7, 0x8f, 0x76, 0xa8, 0x98, 0x44, 0x5d,
+    0x16, 0xd1, 0xe5, 0x47, 0x3b, 0x91, 0x14, 0xdb, 0x5a, 0xcb, 0x99, 0xc8,
+    0x93, 0x2d, 0x95, 0xf7, 0x8d, 0x05, 0x01, 0xe9, 0xcf, 0x28, 0xfb, 0x34,
+    0xf3, 0xaf, 0x65, 0xeb, 0xd8, 0x7c, 0xfe, 0xc1, 0x40, 0xb6, 0x5a, 0x5c,
+    0x5a, 0x47, 0xdf, 0xa4, 0x23, 0xb7, 0x0a, 0x19, 0x99, 0x98, 0x1e, 0x9d,
+    0x1a, 0x93, 0xc7, 0x47, 0x67, 0x1b, 0xf6, 0xfa, 0x56, 0x47, 0xef, 0xf1,
+    0x28, 0x65, 0x21, 0x16, 0xa9, 0x73, 0xa2, 0x73, 0x5e, 0x18, 0xf8, 0x45,
+    0x4c, 0x0b, 0x21, 0x7f, 0xbd, 0xde, 0xea, 0xf0, 0xbe, 0x10, 0xaa, 0xa6,
+    /* 12 */
+    0x01, 0x28, 0xb9, 0x46, 0xbc, 0x95, 0x1e, 0xda, 0xb2, 0x7a, 0x1d, 0xb0,
+    0xa3, 0x41, 0x46, 0xe1, 0x69, 0x72, 0x2e, 0xec, 0xe3, 0x44, 0x9e, 0x1b,
+    0x5f, 0x3b, 0xe8, 0x8e, 0x64, 0x53, 0x08, 0x96, 0x26, 0xf7, 0xd5, 0x22,
+    0xcf, 0xbd, 0xc8, 0x3f, 0xcb, 0xc1, 0x39, 0x71, 0x53, 0x4b, 0x07, 0x33,
+    0x44, 0x75, 0x4b, 0xf4, 0x20, 0x3b, 0xcf, 0x2a, 0xa6, 0xe9, 0xb2, 0xdd,
+    0xd4, 0xd3, 0xf5, 0x74, 0x66, 0x5a, 0x01, 0xe4, 0xc4, 0xf9, 0x2e, 0x60,
+    0x05, 0x41, 0x32, 0x76, 0xd5, 0x43, 0xcc, 0x4d, 0x82, 0x07, 0xe0, 0x22,
+    0xb9, 0x93, 0x1e, 0x8d, 0xa6, 0x06, 0x52, 0xac, 0x39, 0x04, 0x53, 0x7c,
+    0xd3, 0x6b, 0x27, 0xf8, 0xe2, 0x81, 0xa8, 0x00, 0xc8, 0x07, 0xb6, 0xd3,
+    0xd1, 0x6f, 0x61, 0x0f, 0x65, 0x0f, 0x1e, 0x29, 0xb7, 0x5c, 0xeb, 0x62,
+    0x0a, 0x97, 0x5c, 0x8e, 0x65, 0x90, 0x0c, 0xda, 0x9c, 0xe2, 0x3e, 0xd3,
+    /* 13 */
+    0x01, 0x25, 0x5a, 0xbe, 0xd4, 0xd6, 0xc5, 0x23, 0xf5, 0x56, 0x9a, 0x6f,
+    0x68, 0x2a, 0xe2, 0x4e, 0x7b, 0xe2, 0xa9, 0x78, 0xa4, 0x21, 0x48, 0x13,
+    0xbc, 0x17, 0x35, 0x45, 0x59, 0x62, 0x5d, 0x15, 0xac, 0xf1, 0xb8, 0xa0,
+    0x88, 0x5c, 0xca, 0xa3, 0xd1, 0x72, 0x70, 0x91, 0x13, 0x4a, 0xe3, 0x93,
+    0x86, 0x90, 0xdc, 0x50, 0x4e, 0x24, 0x7e, 0x70, 0xa1, 0x86, 0x2c, 0x32,
+    0x97, 0x34, 0x76, 0x4a, 0x60, 0x71, 0x01, 0xfb, 0x23, 0xfc, 0x53, 0x15,
+    0x8c, 0x81, 0xfd, 0x01, 0x6e, 0x3f, 0x14, 0x99, 0x93, 0xfc, 0x31, 0x74,
+    0x48, 0xc6, 0x10, 0xc1, 0x08, 0x0f, 0xd0, 0x4e, 0x6b, 0x4e, 0x1a, 0x68,
+    0xeb, 0x2e, 0x41, 0x1d, 0xbb, 0xa1, 0x7b, 0x08, 0x48, 0x8d, 0x75, 0x2b,
+    0x96, 0x34, 0x5a, 0x57, 0x0a, 0x62, 0x98, 0xee, 0xd4, 0xf1, 0x68, 0x26,
+    0x97, 0x98, 0x9e, 0x18, 0xcc, 0xe6, 0xd4, 0x79, 0xac, 0xd3, 0x7f, 0x06,
+    /* 14 */
+    0x00, 0xac, 0x29, 0xe4, 0x90, 0xc6, 0x21, 0x16, 0x1e, 0x10, 0x92, 0xbb,
+    0x52, 0x1f, 0x4d, 0x75, 0xd9, 0x20, 0xbf, 0x90, 0x1b, 0x74, 0xbd, 0x5c,
+    0x0f, 0x46, 0x89, 0x9a, 0x4d, 0xe3, 0xdf, 0x86, 0x3a, 0x5e, 0x8a, 0x2e,
+    0x9a, 0xcf, 0x3b, 0x3a, 0x7d, 0x13, 0xbf, 0x44, 0x16, 0x7e, 0xcc, 0x39,
+    0x68, 0x1a, 0xa8, 0x91, 0x56, 0x4c, 0xda, 0x83, 0x1b, 0x5e, 0xef, 0x4e,
+    0x2f, 0x64, 0x96, 0x7c, 0x9a, 0x9e, 0x00, 0x43, 0xbb, 0xec, 0xd9, 0x42,
+    0x55, 0x87, 0x7c, 0xfa, 0x72, 0xf8, 0x70, 0x4f, 0x55, 0x4f, 0xae, 0x9f,
+    0xfd, 0xbc, 0x26, 0x73, 0x86, 0x5d, 0x9b, 0xdd, 0xf9, 0x8a, 0xd2, 0x79,
+    0x20, 0x7f, 0x38, 0x30, 0x27, 0xb1, 0x0f, 0x61, 0xe0, 0x02, 0x2d, 0x36,
+    0x46, 0x4e, 0xba, 0xb2, 0xb5, 0xc4, 0xef, 0xce, 0x5b, 0xc9, 0x57, 0x38,
+    0xe8, 0xf9, 0x0c, 0x19, 0x6e, 0x2c, 0x3f, 0x46, 0x17, 0x2e, 0x31, 0x2d,
+    /* 15 */
+    0x00, 0xfb, 0x39, 0xc3, 0x82, 0x6c, 0x6b, 0x97, 0xc1, 0x30, 0x17, 0x6e,
+    0xfd, 0xa6, 0x77, 0xc6, 0xa7, 0xd3, 0x44, 0x78, 0xb0, 0xd5, 0xc7, 0xde,
+    0xb1, 0x0b, 0x56, 0x83, 0x24, 0x37, 0x10, 0xd0, 0x91, 0xd0, 0x79, 0x84,
+    0xc0, 0x7c, 0x49, 0x96, 0x68, 0x0e, 0x10, 0x98, 0x17, 0x48, 0x95, 0x33,
+    0x47, 0xdd, 0x4c, 0xdf, 0x13, 0x42, 0x03, 0xda, 0x13, 0x0a, 0x35, 0x82,
+    0x9b, 0xdc, 0xf3, 0x73, 0x5d, 0xb2, 0x00, 0x07, 0x7a, 0xa8, 0x86, 0x48,
+    0x11, 0xa9, 0x7d, 0xae, 0x6e, 0x60, 0xf5, 0xc8, 0xc3, 0x48, 0x4d, 0xf2,
+    0x30, 0x67, 0x1e, 0x7e, 0xe8, 0x02, 0xba, 0x71, 0x55, 0xd2, 0x53, 0xe9,
+    0x75, 0x9b, 0x2e, 0x8f, 0x6e, 0xe3, 0x1a, 0x40, 0x6f, 0x06, 0x61, 0x8e,
+    0x88, 0x57, 0xc0, 0x88, 0x0c, 0xff, 0x4e, 0x86, 0x4c, 0x4d, 0xe3, 0xf3,
+    0x71, 0x7b, 0x92, 0x93, 0xe8, 0xd6, 0x5b, 0xfc, 0x87, 0xa8, 0xbe, 0x04,
+    /* 16 */
+    0x00, 0x4d, 0xb2, 0xd5, 0x74, 0x5b, 0x33, 0xcf, 0x15, 0x69, 0x86, 0x14,
+    0xa2, 0x7f, 0x0d, 0x47, 0x8c, 0x6d, 0xff, 0x37, 0x21, 0xd2, 0x0a, 0x51,
+    0x5e, 0x66, 0x6e, 0x57, 0x19, 0x19, 0x55, 0x92, 0x6d, 0x91, 0x53, 0x15,
+    0x2e, 0xad, 0xac, 0xe8, 0xd0, 0x2c, 0x96, 0x13, 0x2f, 0x98, 0xad, 0x60,
+    0x2a, 0xbc, 0x9f, 0x3b, 0xfe, 0x9b, 0xe5, 0xeb, 0x05, 0xa3, 0xc7, 0x03,
+    0x4e, 0x39, 0xc9, 0xe3, 0xcd, 0x6f, 0x01, 0x66, 0x2a, 0xa9, 0x1c, 0xa0,
+    0xdf, 0x9f, 0xc5, 0x6a, 0x07, 0xb3, 0xd0, 0x4c, 0x54, 0x18, 0x28, 0x86,
+    0x7d, 0x24, 0x75, 0xa4, 0x7c, 0x97, 0xd7, 0x6d, 0xe1, 0xc0, 0xf1, 0x2d,
+    0x5f, 0x2c, 0x40, 0x56, 0xab, 0x0a, 0xa1, 0x27, 0x8d, 0x20, 0x71, 0x10,
+    0x84, 0x0c, 0x2c, 0x70, 0x81, 0x4c, 0x0b, 0x16, 0x19, 0x81, 0xfc, 0x9e,
+    0xaf, 0xce, 0x53, 0x2c, 0xa2, 0xd1, 0x3b, 0x25, 0x28, 0x84, 0xb7, 0xb2,
+    /* 17 */
+    0x01, 0xd2, 0x6c, 0xd9, 0x2d, 0xd5, 0x8e, 0x91, 0x5c, 0x4d, 0xfa, 0xcd,
+    0x5c, 0x29, 0x93, 0xb8, 0xda, 0xba, 0xab, 0xc3, 0x4d, 0x36, 0xf9, 0x6c,
+    0x0c, 0xe5, 0xa7, 0x09, 0x87, 0xb3, 0x2d, 0x69, 0xd0, 0xec, 0x92, 0xfc,
+    0x60, 0x30, 0xa1, 0xf6, 0xc7, 0xe3, 0x80, 0xba, 0xef, 0x34, 0xc4, 0xad,
+    0xea, 0x1f, 0x69, 0x2b, 0x9e, 0xe0, 0x69, 0x26, 0xc0, 0xa0, 0x1a, 0xb4,
+    0x9a, 0x6c, 0x77, 0x52, 0xe1, 0xd0, 0x00, 0xe3, 0x7e, 0x49, 0x1d, 0x3d,
+    0xf9, 0x88, 0x05, 0xfe, 0x67, 0x78, 0xbf, 0xd2, 0x5c, 0x32, 0xc3, 0x7a,
+    0x20, 0xeb, 0x41, 0x8b, 0x87, 0x28, 0xd1, 0x40, 0x6c, 0xf2, 0xe7, 0xaf,
+    0x5b, 0x3c, 0xb4, 0xc6, 0x06, 0x10, 0xfb, 0xa4, 0xba, 0x9a, 0xf5, 0x1f,
+    0xc6, 0xb7, 0x02, 0x0b, 0x4a, 0x56, 0x02, 0x09, 0xe6, 0x9d, 0x39, 0xe9,
+    0xff, 0x1e, 0x3f, 0x22, 0x50, 0x76, 0x16, 0xfb, 0x4f, 0x5a, 0x5a, 0x02,
+    /* 18 */
+    0x01, 0x2f, 0xf1, 0xa7, 0x56, 0x58, 0x7b, 0x0b, 0x7b, 0x0c, 0xf4, 0xd1,
+    0x6d, 0xae, 0x2d, 0x17, 0x5f, 0x83, 0xa2, 0xc2, 0x5f, 0xfd, 0x7d, 0x69,
+    0x48, 0xf9, 0xdf, 0x63, 0x61, 0x14, 0x4f, 0x3c, 0x7d, 0xe2, 0x8b, 0x56,
+    0x47, 0x1d, 0x0e, 0x2b, 0xc4, 0x37, 0xa4, 0xb9, 0xfe, 0x46, 0x44, 0x57,
+    0x45, 0x0c, 0x21, 0xa4, 0x2d, 0x93, 0x8b, 0xf1, 0xff, 0x45, 0xd7, 0xde,
+    0x3e, 0x93, 0x9a, 0x22, 0x11, 0x1f, 0x00, 0x8d, 0xe5, 0xd8, 0x9b, 0x17,
+    0x23, 0x4c, 0x7d, 0x11, 0x32, 0xe2, 0x74, 0xfc, 0x5c, 0xff, 0x26, 0x41,
+    0xe5, 0x20, 0x67, 0x4e, 0xe0, 0xb1, 0x23, 0x6b, 0x7b, 0x71, 0xb6, 0x7b,
+    0x90, 0xd3, 0xe2, 0x93, 0x42, 0x7e, 0xd0, 0xc4, 0x5f, 0x7f, 0xd1, 0x6a,
+    0x21, 0x48, 0x15, 0x5c, 0xb1, 0x68, 0xe4, 0x97, 0x20, 0xa5, 0xb2, 0xc5,
+    0xba, 0x57, 0xad, 0x1d, 0xea, 0x66, 0x41, 0xb3, 0x57, 0xae, 0xfc, 0x68,
+    /* 19 */
+    0x01, 0x6d, 0xcc, 0x57, 0x92, 0x1c, 0xb2, 0xcf, 0xff, 0xbb, 0xa1, 0x31,
+    0xf7, 0x56, 0x01, 0x0d, 0x06, 0x37, 0x7e, 0x48, 0xac, 0xe5, 0xf2, 0x54,
+    0x40, 0xef, 0x0b, 0x59, 0x7a, 0xf9, 0xc1, 0xb5, 0xd9, 0x85, 0x68, 0x7a,
+    0x47, 0xe9, 0x0d, 0x97, 0x49, 0xef, 0xd9, 0x03, 0x79, 0x0f, 0x98, 0x31,
+    0x1c, 0x78, 0x09, 0x19, 0x4f, 0x1b, 0x25, 0x66, 0x23, 0x1d, 0x71, 0x94,
+    0x1a, 0x96, 0xb3, 0xed, 0x2e, 0x50, 0x01, 0x42, 0x41, 0xbb, 0xb6, 0xf8,
+    0xdd, 0xa3, 0xec, 0x58, 0x41, 0xa2, 0x16, 0x8d, 0xc1, 0x0c, 0x20, 0x3f,
+    0xd0, 0xfe, 0x51, 0xfa, 0x46, 0x40, 0xcc, 0x9b, 0x4a, 0x4d, 0x68, 0x46,
+    0x3d, 0x88, 0x96, 0x4b, 0x6b, 0x52, 0xfc, 0x60, 0xf9, 0x75, 0x7e, 0xae,
+    0x0e, 0xad, 0xfe, 0x93, 0x88, 0xe9, 0x0c, 0x77, 0xe3, 0x38, 0x76, 0x5c,
+    0xf1, 0x3d, 0xcf, 0x86, 0xe1, 0x0f, 0xda, 0x98, 0xe5, 0x96, 0x24, 0xc5,
+    /* 20 */
+    0x00, 0x21, 0x30, 0x4f, 0xb5, 0x51, 0xf5, 0x45, 0x0e, 0x45, 0x45, 0x41,
+    0x0b, 0xa4, 0x45, 0x11, 0xd4, 0x70, 0xb6, 0xce, 0x7f, 0xa0, 0xef, 0x41,
+    0x75, 0xf5, 0x23, 0x13, 0x49, 0x86, 0x2b, 0xc4, 0x47, 0xf5, 0x56, 0xee,
+    0xc6, 0x19, 0xd4, 0x9e, 0xac, 0xb4, 0x0a, 0x99, 0x96, 0x8d, 0x05, 0x42,
+    0xd2, 0x14, 0xac, 0xf5, 0x76, 0x49, 0x52, 0xe0, 0x16, 0x64, 0x57, 0x18,
+    0xc7, 0x33, 0xd2, 0xa0, 0xcb, 0xdd, 0x01, 0xf7, 0x48, 0x5f, 0xd2, 0x14,
+    0xbe, 0x23, 0x1f, 0x3d, 0xb5, 0x67, 0xcc, 0x2c, 0x8b, 0xe6, 0x58, 0x39,
+    0xf0, 0xf7, 0xf9, 0x7c, 0x04, 0xef, 0x23, 0x86, 0x8b, 0x28, 0x9a, 0x3d,
+    0x98, 0x10, 0x84, 0x5e, 0xd5, 0xbd, 0x14, 0x5d, 0x33, 0xcb, 0x8d, 0x67,
+    0x63, 0xe4, 0xde, 0x7c, 0x38, 0x83, 0xb0, 0xca, 0x68, 0x4d, 0xeb, 0x6d,
+    0x90, 0x15, 0xe5, 0x71, 0x7b, 0x23, 0x50, 0xbf, 0x96, 0xaf, 0xa0, 0xe5,
+    /* 21 */
+    0x01, 0x3b, 0xaa, 0x78, 0x46, 0x85, 0x7b, 0x28, 0x50, 0xa5, 0x83, 0x1a,
+    0x38, 0x4d, 0x76, 0x88, 0x90, 0x8b, 0x16, 0xe7, 0x71, 0x15, 0xad, 0x4c,
+    0x77, 0x80, 0xbe, 0xe6, 0x5b, 0xdb, 0x50, 0x77, 0x8f, 0xc3, 0xbb, 0xf4,
+    0xff, 0xb2, 0xf0, 0x32, 0x9d, 0xbe, 0xe1, 0xdc, 0x29, 0x51, 0x85, 0xd3,
+    0x47, 0xf1, 0x01, 0x82, 0x95, 0x9a, 0xd4, 0x10, 0x72, 0xe7, 0x7c, 0x7d,
+    0x85, 0x64, 0x0e, 0xdd, 0x9c, 0x76, 0x01, 0x36, 0x31, 0xc5, 0xa0, 0x4d,
+    0x2f, 0x84, 0xa7, 0x12, 0x73, 0x97, 0x06, 0xe5, 0xa6, 0x6a, 0x59, 0x2b,
+    0xa6, 0xad, 0xfe, 0xd6, 0x46, 0x1f, 0x0c, 0xee, 0xf3, 0xd7, 0x29, 0xc8,
+    0x68, 0xec, 0xfa, 0xe1, 0xd6, 0x24, 0xbf, 0x68, 0x2e, 0x90, 0x9e, 0x49,
+    0x3d, 0x0c, 0x1b, 0x41, 0x1d, 0x00, 0xfe, 0xe1, 0x0a, 0x44, 0x9a, 0xa8,
+    0xac, 0x8f, 0xe5, 0x1a, 0xc1, 0x0a, 0xea, 0x32, 0xe2, 0x7f, 0x77, 0x70,
+    /* 22 */
+    0x01, 0xd8, 0x3e, 0x62, 0x92, 0x04, 0xa6, 0xef, 0x0b, 0x58, 0x2b, 0x19,
+    0x75, 0xb3, 0x2e, 0x8a, 0xdc, 0x50, 0xdd, 0xba, 0x7d, 0x93, 0x2c, 0x81,
+    0x69, 0xb6, 0xa2, 0xbb, 0x1b, 0x49, 0x2c, 0x6f, 0xde, 0xfb, 0x48, 0x81,
+    0xaa, 0x4e, 0x04, 0x7d, 0x86, 0xd8, 0x37, 0x21, 0x00, 0xa2, 0xd9, 0xe3,
+    0x5e, 0x5f, 0x52, 0x4e, 0x98, 0x6c, 0xa7, 0x7f, 0xab, 0xf5, 0xd1, 0x47,
+    0x5f, 0xa3, 0x03, 0xce, 0x20, 0x2a, 0x01, 0x3a, 0xc7, 0x17, 0x49, 0x96,
+    0x5c, 0x3a, 0x0f, 0x9f, 0xd6, 0x10, 0xbf, 0x99, 0xae, 0x64, 0x98, 0x11,
+    0xd6, 0xf3, 0x2d, 0x6b, 0xda, 0xa8, 0xd5, 0x74, 0x8e, 0x48, 0x97, 0x98,
+    0xd1, 0xec, 0x62, 0xaf, 0xa5, 0x89, 0x98, 0x2e, 0xf8, 0xa6, 0x4a, 0xc1,
+    0xb1, 0x6b, 0xd4, 0x92, 0x60, 0xaa, 0x47, 0x1f, 0x5f, 0x93, 0x7e, 0x94,
+    0x5d, 0xd5, 0xfa, 0xb6, 0xda, 0x64, 0xd0, 0xbb, 0xcb, 0x5d, 0x81, 0xd9,
+    /* 23 */
+    0x01, 0xa1, 0x4d, 0x54, 0xd3, 0xe0, 0x22, 0x18, 0xab, 0x41, 0x49, 0x68,
+    0xff, 0xfc, 0x0e, 0x59, 0xf4, 0xfa, 0x2c, 0x76, 0x03, 0x87, 0x29, 0x47,
+    0x89, 0xad, 0x03, 0x98, 0x40, 0x27, 0xdc, 0x41, 0x17, 0xb3, 0x37, 0xde,
+    0x2b, 0xcb, 0x4d, 0xe5, 0xd4, 0x3d, 0xaf, 0xb1, 0xad, 0x12, 0xb2, 0xfa,
+    0x22, 0x22, 0xc1, 0xaa, 0x8a, 0x75, 0x55, 0x01, 0xa6, 0xa7, 0xd8, 0x2e,
+    0xf6, 0x68, 0x7c, 0x09, 0xe9, 0x7d, 0x01, 0xdf, 0xaa, 0xf4, 0xff, 0xf4,
+    0x71, 0x76, 0xe9, 0xeb, 0x12, 0x81, 0x21, 0x1a, 0xf8, 0x13, 0xbe, 0x5a,
+    0xc8, 0x4d, 0x6b, 0x30, 0xb3, 0x02, 0xa6, 0x6a, 0xc2, 0x90, 0x55, 0x34,
+    0x0b, 0x43, 0x8c, 0x36, 0xc6, 0x9a, 0x8d, 0xb8, 0xef, 0x95, 0x05, 0x2f,
+    0x8e, 0xef, 0xd2, 0x8d, 0x62, 0x69, 0x6e, 0xa2, 0x47, 0x29, 0xcd, 0xe8,
+    0xdd, 0x9b, 0x4d, 0x38, 0x6c, 0x09, 0x42, 0xa6, 0x37, 0xbb, 0x4f, 0x1e,
+    /* 24 */
+    0x01, 0x48, 0xbc, 0x35, 0x8e, 0x8e, 0x30, 0xce, 0xf4, 0x38, 0x33, 0xeb,
+    0xd3, 0x58, 0xd4, 0x6a, 0xe8, 0x7f, 0xfe, 0x8f, 0xd1, 0x5d, 0xd6, 0x72,
+    0x39, 0x77, 0xf4, 0xf4, 0x7c, 0xef, 0x61, 0x09, 0x03, 0x61, 0x14, 0xfa,
+    0xfa, 0x70, 0x4d, 0x5c, 0x1b, 0xb4, 0x2e, 0x04, 0x06, 0xd5, 0x09, 0x21,
+    0x32, 0x09, 0xb4, 0x59, 0x52, 0x4e, 0xbb, 0x08, 0x7c, 0x3e, 0x9c, 0x51,
+    0x6f, 0x7a, 0x09, 0x01, 0xf6, 0xaf, 0x00, 0xc1, 0x46, 0x98, 0x21, 0xe6,
+    0x1d, 0x47, 0x28, 0x71, 0x44, 0x03, 0x0e, 0x43, 0x6d, 0x3f, 0x76, 0x97,
+    0x16, 0x9b, 0x5b, 0xb5, 0xe9, 0x2a, 0x38, 0xe7, 0xa4, 0x1b, 0xc9, 0x50,
+    0x0c, 0x7a, 0x80, 0xed, 0xb9, 0xf6, 0x74, 0x33, 0x07, 0x80, 0x4a, 0x30,
+    0x70, 0x3e, 0x74, 0x39, 0x38, 0xf3, 0x14, 0x3f, 0x24, 0x99, 0xe5, 0x7a,
+    0x9a, 0x81, 0x7c, 0xa8, 0x3a, 0x5d, 0x96, 0x71, 0x4e, 0xb2, 0x22, 0x36,
+    /* 25 */
+    0x01, 0x4d, 0xe0, 0xa2, 0xd2, 0x66, 0x52, 0x97, 0x0c, 0x63, 0xe4, 0xe9,
+    0x4d, 0x0a, 0x13, 0xbf, 0x93, 0xfc, 0x59, 0xfa, 0x78, 0xdb, 0x31, 0xa5,
+    0x2f, 0xf5, 0x13, 0x10, 0x8e, 0x1c, 0x95, 0x9c, 0x13, 0xc5, 0x97, 0xf7,
+    0xbd, 0x09, 0xaa, 0x18, 0x69, 0x65, 0xf7, 0x91, 0xb1, 0xb4, 0xe8, 0x5b,
+    0x96, 0x50, 0xcd, 0x4d, 0x95, 0xc8, 0x7b, 0x12, 0x10, 0x9a, 0xa4, 0x06,
+    0x48, 0x18, 0x3c, 0xbc, 0x37, 0x53, 0x01, 0x09, 0x02, 0x30, 0xb9, 0x52,
+    0xa8, 0x74, 0x4e, 0x5f, 0xb9, 0xf2, 0x80, 0x3c, 0x2a, 0x9e, 0x6f, 0xcd,
+    0xa2, 0xa2, 0xf3, 0x38, 0x8e, 0x1b, 0xc1, 0x28, 0x7b, 0x37, 0x4b, 0x9c,
+    0x00, 0x0c, 0x83, 0x25, 0x6f, 0xac, 0x7a, 0x5d, 0xb9, 0x35, 0x95, 0x40,
+    0x70, 0xa4, 0x62, 0x5a, 0x8b, 0xcd, 0x78, 0xbb, 0xeb, 0xc8, 0x74, 0xc8,
+    0x4f, 0x52, 0xa1, 0x2c, 0xc0, 0x3f, 0x7f, 0xcf, 0x7d, 0x0d, 0x78, 0x10,
+    /* 26 */
+    0x00, 0xa8, 0x15, 0xf6, 0x65, 0x4e, 0x54, 0x3c, 0x01, 0x50, 0xe0, 0xb7,
+    0x99, 0x6d, 0xd1, 0x58, 0x34, 0xf4, 0x62, 0xe8, 0x5c, 0xb8, 0xc8, 0xa8,
+    0xd3, 0xf0, 0x59, 0x75, 0x0f, 0xb8, 0x92, 0x42, 0x0f, 0xab, 0x1e, 0xa1,
+    0x1d, 0x06, 0xe4, 0xf2, 0xca, 0x48, 0xf7, 0x1f, 0x64, 0x2b, 0x4b, 0x71,
+    0xb7, 0xa2, 0xd3, 0x71, 0x64, 0xf9, 0x61, 0x8b, 0xdd, 0x31, 0x47, 0xa5,
+    0x52, 0xac, 0xbe, 0xef, 0xf1, 0x54, 0x00, 0x1b, 0x3c, 0x49, 0x99, 0x13,
+    0x17, 0xac, 0xb7, 0x4f, 0xeb, 0x1b, 0xdf, 0x46, 0xf8, 0x17, 0x88, 0xe0,
+    0xe7, 0xbc, 0x05, 0xc2, 0xf0, 0x3a, 0x2b, 0xe5, 0xfa, 0x2f, 0x90, 0x41,
+    0x42, 0x78, 0x97, 0x4b, 0x43, 0x36, 0x82, 0x75, 0xa6, 0x37, 0x91, 0x26,
+    0xc7, 0x42, 0x42, 0x8a, 0x44, 0x19, 0x98, 0x14, 0x41, 0x59, 0xd9, 0x35,
+    0x04, 0x47, 0xdc, 0x3f, 0xcf, 0xa0, 0x23, 0xb8, 0xe1, 0x8d, 0xb7, 0x89,
+    /* 27 */
+    0x00, 0x10, 0x4f, 0xea, 0x84, 0xb6, 0x16, 0x5a, 0x38, 0xa2, 0x64, 0x14,
+    0x0b, 0xc4, 0xb5, 0x9c, 0x99, 0x66, 0xf7, 0x84, 0xb7, 0xe8, 0xf0, 0xcd,
+    0x53, 0xef, 0x6e, 0x5d, 0xe8, 0xbb, 0x69, 0x80, 0x32, 0x6b, 0xc6, 0x28,
+    0x8d, 0x39, 0xd0, 0x73, 0x01, 0xf1, 0x87, 0x82, 0x44, 0x4f, 0x36, 0x6a,
+    0xb1, 0x89, 0x0a, 0x93, 0xa3, 0xf6, 0x30, 0xd8, 0x37, 0xb6, 0xab, 0x0f,
+    0xde, 0x00, 0x70, 0x9e, 0x6e, 0xcd, 0x00, 0x0c, 0x19, 0x1c, 0xc6, 0x59,
+    0xea, 0x57, 0xb0, 0xb8, 0x04, 0x01, 0x63, 0xee, 0x49, 0x2c, 0xe1, 0x52,
+    0x7f, 0x6f, 0x3f, 0xd8, 0x87, 0x99, 0xc6, 0x53, 0x78, 0xce, 0xda, 0x21,
+    0x2f, 0x44, 0x44, 0x1f, 0x9c, 0xbb, 0x6e, 0xb9, 0x8a, 0xa3, 0x31, 0x30,
+    0xf1, 0x1a, 0xa8, 0x6e, 0x74, 0x21, 0xe1, 0x5d, 0x97, 0x32, 0x62, 0x99,
+    0xe1, 0x90, 0xf7, 0xa1, 0xcb, 0x6d, 0x6d, 0x07, 0xfd, 0x82, 0x44, 0x2b,
+    /* 28 */
+    0x01, 0x32, 0x8a, 0xb2, 0x7b, 0x4e, 0xaf, 0xa6, 0xee, 0xdb, 0x1d, 0xf6,
+    0x53, 0xca, 0x55, 0x2b, 0x5c, 0x16, 0xc5, 0x51, 0xaf, 0x12, 0x01, 0xc8,
+    0x75, 0x54, 0x89, 0x88, 0x05, 0x53, 0x53, 0xe3, 0x4d, 0xc7, 0x9f, 0x6e,
+    0xa3, 0x9e, 0xc0, 0x23, 0x14, 0x1d, 0x22, 0xe8, 0x95, 0xd3, 0xd2, 0x48,
+    0x38, 0xae, 0x8a, 0xbf, 0xa9, 0x28, 0x2d, 0x6f, 0x14, 0xca, 0x03, 0x56,
+    0x9e, 0x99, 0x0a, 0x9c, 0x0c, 0x05, 0x01, 0x22, 0x66, 0x00, 0xa3, 0x68,
+    0x87, 0x7e, 0x39, 0xc2, 0x34, 0x77, 0xd9, 0xea, 0x43, 0xde, 0xbd, 0x3c,
+    0x80, 0x30, 0xa2, 0x74, 0x4a, 0xa2, 0xe1, 0xb1, 0x26, 0xfa, 0xe2, 0xa2,
+    0x3f, 0x17, 0x3b, 0xd7, 0x5b, 0xf4, 0xd9, 0x10, 0xa6, 0x49, 0xef, 0xc9,
+    0x1c, 0x69, 0x98, 0xbe, 0xeb, 0xb3, 0x9d, 0x8a, 0x5c, 0xf1, 0x09, 0x79,
+    0x35, 0xe2, 0xa3, 0xad, 0xa5, 0x9c, 0xb8, 0xc4, 0x6d, 0x82, 0xb3, 0x49,
+    /* 29 */
+    0x01, 0xc5, 0xa9, 0xbb, 0x26, 0x46, 0x6b, 0x07, 0xad, 0x7b, 0xeb, 0xcf,
+    0x4f, 0x74, 0x77, 0x1c, 0x91, 0xb7, 0xa3, 0x80, 0xbf, 0x7c, 0x57, 0xc8,
+    0xc7, 0x35, 0x75, 0xe2, 0xbd, 0x41, 0x8a, 0x70, 0xe9, 0x0e, 0xe3, 0x10,
+    0x7f, 0xe0, 0xb3, 0x7c, 0x84, 0xe0, 0xdc, 0xd4, 0x3c, 0xbc, 0x9d, 0x68,
+    0x5c, 0x92, 0x44, 0x8a, 0x04, 0xd6, 0xfd, 0x25, 0xd3, 0x4c, 0xf0, 0x08,
+    0x5c, 0xaa, 0x77, 0x8b, 0xfa, 0xa7, 0x00, 0xe9, 0x6d, 0xbb, 0xe1, 0x1c,
+    0xfb, 0x05, 0x8e, 0x2e, 0x5a, 0x58, 0x85, 0x3f, 0x70, 0x62, 0x38, 0xf6,
+    0x67, 0x8b, 0x76, 0xb2, 0x8b, 0xd9, 0xf8, 0xcf, 0x5a, 0x22, 0x05, 0xd5,
+    0x81, 0x4f, 0x5a, 0xd0, 0x39, 0x48, 0x89, 0xce, 0x80, 0x12, 0x55, 0xac,
+    0x73, 0x78, 0x86, 0x2d, 0x37, 0xdd, 0x41, 0x0d, 0x5a, 0x86, 0xdf, 0xbf,
+    0xd0, 0x98, 0x51, 0xe3, 0x3f, 0xd9, 0xb7, 0x46, 0x45, 0xb1, 0xba, 0xcc,
+    /* 30 */
+    0x00, 0x53, 0x05, 0x73, 0xd9, 0x16, 0x80, 0xa8, 0xf0, 0x59, 0xd0, 0x1e,
+    0x31, 0x58, 0xdb, 0x85, 0x02, 0xc1, 0x82, 0x33, 0x0c, 0x74, 0x2c, 0x39,
+    0x4b, 0xad, 0x73, 0x8f, 0x55, 0xd9, 0x0f, 0x21, 0x53, 0xdd, 0x1a, 0x8b,
+    0xb7, 0xdc, 0x18, 0x9f, 0xb5, 0x1b, 0x3f, 0x08, 0x03, 0xf4, 0xea, 0x69,
+    0xc5, 0x09, 0x54, 0xd9, 0xdb, 0x79, 0x15, 0x0a, 0x72, 0x82, 0x31, 0xc1,
+    0xe7, 0x19, 0xfb, 0x51, 0x47, 0x95, 0x00, 0xd1, 0x5e, 0xc7, 0x36, 0x21,
+    0xad, 0xd3, 0xa0, 0x68, 0x1c, 0xaa, 0xc3, 0xce, 0x73, 0xef, 0xbd, 0x97,
+    0x7c, 0x0d, 0x42, 0x7c, 0x9a, 0xd4, 0x3d, 0xe3, 0x25, 0x77, 0x81, 0xb2,
+    0xae, 0xeb, 0x6c, 0xf7, 0xea, 0xe8, 0x26, 0x79, 0xa1, 0xe6, 0x0c, 0x94,
+    0xc6, 0x11, 0x00, 0xd9, 0x38, 0xf9, 0x41, 0x71, 0x82, 0xa0, 0x96, 0x5b,
+    0xf3, 0xaa, 0xe1, 0x3c, 0x19, 0x2c, 0xff, 0xac, 0xfa, 0x9d, 0x4a, 0x3a,
+    /* 31 */
+    0x00, 0xeb, 0xa6, 0xd8, 0xc7, 0x3c, 0x55, 0x6f, 0x4e, 0xa3, 0x55, 0xd9,
+    0xeb, 0xbd, 0x96, 0xb8, 0x8c, 0x17, 0x49, 0x4d, 0xbf, 0x0e, 0x73, 0x68,
+    0xe2, 0xda, 0xa2, 0x13, 0xab, 0x26, 0xcb, 0x61, 0x24, 0x76, 0x83, 0x11,
+    0xdd, 0xd6, 0x5c, 0xbf, 0xa3, 0x01, 0x51, 0x11, 0x58, 0x07, 0x4f, 0x2f,
+    0x3e, 0x81, 0xd2, 0x13, 0x94, 0x41, 0xfd, 0x9a, 0x61, 0x46, 0x5b, 0x7e,
+    0xf7, 0x92, 0x36, 0x78, 0x4b, 0x9a, 0x01, 0x49, 0x38, 0x95, 0xc3, 0x34,
+    0x6f, 0xd4, 0xfe, 0x5d, 0x7a, 0x91, 0x60, 0xe6, 0x52, 0x11, 0x2a, 0x40,
+    0xf5, 0xca, 0x69, 0xd9, 0x9b, 0x4c, 0x29, 0xb7, 0x05, 0xfa, 0x1f, 0x24,
+    0x12, 0xfd, 0x87, 0xe1, 0xe0, 0x02, 0xf9, 0xe0, 0x58, 0x01, 0xb3, 0xbf,
+    0xe6, 0x11, 0x09, 0x31, 0x0d, 0x89, 0x94, 0x0a, 0x36, 0x46, 0xf3, 0x11,
+    0x11, 0x04, 0xcf, 0x7f, 0xd7, 0xfa, 0x54, 0x7a, 0x16, 0x3c, 0xb0, 0xc3,
+};
+#endif /* ECC521 */
+
+/* Base point tables by curve id */
+static const struct {
+    int         id;         /* curve id */
+    word32      montBits;   /* bits of the Montgomery R of the entries */
+    const byte* table;
+} ecc_comb_bases[] = {
+#ifdef ECC224
+    { ECC_SECP224R1, 256, ecc_comb_secp224r1 },
+#endif
+#ifdef ECC256
+    { ECC_SECP256R1, 256, ecc_comb_secp256r1 },
+#endif
+#ifdef ECC384
+    { ECC_SECP384R1, 384, ecc_comb_secp384r1 },
+#endif
+#ifdef ECC521
+    { ECC_SECP521R1, 576, ecc_comb_secp521r1 },
+#endif
+    { ECC_CURVE_INVALID, 0, NULL }
+};
@@ -29,3 +29,1127 @@
 /* in case user set HAVE_ED25519 there */
 #include <wolfssl/wolfcrypt/settings.h>
 
+
+#ifdef HAVE_ED25519
+
+#include <wolfssl/wolfcrypt/ed25519.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/hash.h>
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+#if defined(HAVE_ED25519_SIGN) || defined(HAVE_ED25519_VERIFY)
+#define ED25519CTX_SIZE    32
+
+static const byte ed25519Ctx[ED25519CTX_SIZE+1] =
+                                             "SigEd25519 no Ed25519 collisions";
+#endif
+
+/* Hash the message into SHA-512 digest.
+ *
+ * key     Key for heap hint.
+ * in      Data to hash.
+ * inLen   Length of data in bytes.
+ * hash    Buffer to hold digest.
+ * returns 0 on success and a hash error code otherwise.
+ */
+static int ed25519_hash(ed25519_key* key, const byte* in, word32 inLen,
+    byte* hash)
+{
+    int ret;
+    wc_Sha512 sha;
+
+    ret = wc_InitSha512_ex(&sha, key->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_Sha512Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, hash);
+        wc_Sha512Free(&sha);
+    }
+
+    return ret;
+}
+
+#if defined(HAVE_ED25519_SIGN) || defined(HAVE_ED25519_VERIFY)
+/* Initialize the hash and, for the ctx and ph variants, add the dom2 prefix.
+ *
+ * sha         SHA-512 object to initialize.
+ * key         Key for heap hint.
+ * type        Ed25519, Ed25519ctx or Ed25519ph.
+ * context     Context of the signature. May be NULL when contextLen is 0.
+ * contextLen  Length of the context in bytes.
+ * returns 0 on success and a hash error code otherwise.
+ */
+static int ed25519_hash_init(wc_Sha512* sha, ed25519_key* key, byte type,
+    const byte* context, byte contextLen)
+{
+    int ret;
+
+    ret = wc_InitSha512_ex(sha, key->heap, INVALID_DEVID);
+    if (ret == 0 && (type == Ed25519ctx || type == Ed25519ph)) {
+        ret = wc_Sha512Update(sha, ed25519Ctx, ED25519CTX_SIZE);
+        if (ret == 0)
+            ret = wc_Sha512Update(sha, &type, sizeof(type));
+        if (ret == 0)
+            ret = wc_Sha512Update(sha, &contextLen, sizeof(contextLen));
+        if (ret == 0 && context != NULL)
+            ret = wc_Sha512Update(sha, context, contextLen);
+    }
+
+    return ret;
+}
+#endif
+
+/* Derive the public key from the private key.
+ *
+ * key       Key with the private part set.
+ * pubKey    Buffer to hold the compressed public key.
+ * pubKeySz  Size of buffer in bytes. Must be ED25519_PUB_KEY_SIZE.
+ * returns BAD_FUNC_ARG when a parameter is NULL or the size is wrong,
+ *         ECC_PRIV_KEY_E when the private key is not set and 0 on success.
+ */
+int wc_ed25519_make_public(ed25519_key* key, unsigned char* pubKey,
+                           word32 pubKeySz)
+{
+    int   ret = 0;
+    byte  az[ED25519_PRV_KEY_SIZE];
+    ge_p3 A;
+
+    if (key == NULL || pubKey == NULL || pubKeySz != ED25519_PUB_KEY_SIZE)
+        ret = BAD_FUNC_ARG;
+
+    if ((ret == 0) && (!key->privKeySet)) {
+        ret = ECC_PRIV_KEY_E;
+    }
+
+    if (ret == 0)
+        ret = ed25519_hash(key, key->k, ED25519_KEY_SIZE, az);
+    if (ret == 0) {
+        /* apply clamp */
+        az[0]  &= 248;
+        az[31] &= 63; /* same than az[31] &= 127 because of az[31] |= 64 */
+        az[31] |= 64;
+
+        ge_scalarmult_base(&A, az);
+        ge_p3_tobytes(pubKey, &A);
+
+        key->pubKeySet = 1;
+    }
+
+    ForceZero(az, sizeof(az));
+
+    return ret;
+}
+
+/* generate an ed25519 key pair.
+ * returns 0 on success
+ */
+int wc_ed25519_make_key(WC_RNG* rng, int keySz, ed25519_key* key)
+{
+    int ret;
+
+    if (rng == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* ed25519 has 32 byte key sizes */
+    if (keySz != ED25519_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    key->privKeySet = 0;
+    key->pubKeySet = 0;
+
+    ret = wc_RNG_GenerateBlock(rng, key->k, ED25519_KEY_SIZE);
+    if (ret != 0)
+        return ret;
+
+    key->privKeySet = 1;
+    ret = wc_ed25519_make_public(key, key->p, ED25519_PUB_KEY_SIZE);
+    if (ret != 0) {
+        key->privKeySet = 0;
+        ForceZero(key->k, ED25519_KEY_SIZE);
+        return ret;
+    }
+
+    /* put public key after private key, on the same buffer */
+    XMEMMOVE(key->k + ED25519_KEY_SIZE, key->p, ED25519_PUB_KEY_SIZE);
+
+    return ret;
+}
+
+
+#ifdef HAVE_ED25519_SIGN
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed25519 key to use when signing
+    type        one of Ed25519, Ed25519ctx or Ed25519ph
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+static int ed25519_sign_msg(const byte* in, word32 inLen, byte* out,
+                            word32 *outLen, ed25519_key* key, byte type,
+                            const byte* context, byte contextLen)
+{
+    ge_p3  R;
+    byte   nonce[WC_SHA512_DIGEST_SIZE];
+    byte   hram[WC_SHA512_DIGEST_SIZE];
+    byte   az[ED25519_PRV_KEY_SIZE];
+    wc_Sha512 sha;
+    int    ret;
+
+    /* sanity check on arguments */
+    if (in == NULL || out == NULL || outLen == NULL || key == NULL ||
+                                         (context == NULL && contextLen != 0)) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (!key->pubKeySet)
+        return BAD_FUNC_ARG;
+    if (!key->privKeySet)
+        return BAD_FUNC_ARG;
+
+    /* check and set up out length */
+    if (*outLen < ED25519_SIG_SIZE) {
+        *outLen = ED25519_SIG_SIZE;
+        return BUFFER_E;
+    }
+    *outLen = ED25519_SIG_SIZE;
+
+    /* step 1: create nonce to use where nonce is r in
+       r = H(h_b, ... ,h_2b-1,M) */
+    ret = ed25519_hash(key, key->k, ED25519_KEY_SIZE, az);
+    if (ret != 0)
+        return ret;
+
+    /* apply clamp */
+    az[0]  &= 248;
+    az[31] &= 63; /* same than az[31] &= 127 because of az[31] |= 64 */
+    az[31] |= 64;
+
+    ret = ed25519_hash_init(&sha, key, type, context, contextLen);
+    if (ret == 0) {
+        ret = wc_Sha512Update(&sha, az + ED25519_KEY_SIZE, ED25519_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, nonce);
+        wc_Sha512Free(&sha);
+    }
+    if (ret == 0) {
+        sc_reduce(nonce);
+
+        /* step 2: computing R = rB where rB is the scalar multiplication of
+           r and B */
+        ge_scalarmult_base(&R,nonce);
+        ge_p3_tobytes(out,&R);
+
+        /* step 3: hash R + public key + message getting H(R,A,M) then
+           creating S = (r + H(R,A,M)a) mod l */
+        ret = ed25519_hash_init(&sha, key, type, context, contextLen);
+    }
+    if (ret == 0) {
+        ret = wc_Sha512Update(&sha, out, ED25519_SIG_SIZE/2);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, key->p, ED25519_PUB_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, hram);
+        wc_Sha512Free(&sha);
+    }
+    if (ret == 0) {
+        sc_reduce(hram);
+        sc_muladd(out + (ED25519_SIG_SIZE/2), hram, az, nonce);
+    }
+
+    ForceZero(az, sizeof(az));
+    ForceZero(nonce, sizeof(nonce));
+
+    return ret;
+}
+
+/*
+    in     contains the message to sign
+    inLen  is the length of the message to sign
+    out    is the buffer to write the signature
+    outLen [in/out] input size of out buf
+                     output gets set as the final length of out
+    key    is the ed25519 key to use when signing
+    return 0 on success
+ */
+int wc_ed25519_sign_msg(const byte* in, word32 inLen, byte* out,
+                        word32 *outLen, ed25519_key* key)
+{
+    return ed25519_sign_msg(in, inLen, out, outLen, key, (byte)Ed25519, NULL,
+                            0);
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed25519 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed25519ctx_sign_msg(const byte* in, word32 inLen, byte* out,
+                           word32 *outLen, ed25519_key* key,
+                           const byte* context, byte contextLen)
+{
+    return ed25519_sign_msg(in, inLen, out, outLen, key, Ed25519ctx, context,
+                            contextLen);
+}
+
+/*
+    hash        contains the SHA-512 hash of the message to sign
+    hashLen     is the length of the SHA-512 hash of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed25519 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed25519ph_sign_hash(const byte* hash, word32 hashLen, byte* out,
+                           word32 *outLen, ed25519_key* key,
+                           const byte* context, byte contextLen)
+{
+    return ed25519_sign_msg(hash, hashLen, out, outLen, key, Ed25519ph, context,
+                            contextLen);
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed25519 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed25519ph_sign_msg(const byte* in, word32 inLen, byte* out,
+                          word32 *outLen, ed25519_key* key,
+                          const byte* context, byte contextLen)
+{
+    int  ret;
+    byte hash[WC_SHA512_DIGEST_SIZE];
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = ed25519_hash(key, in, inLen, hash);
+    if (ret != 0)
+        return ret;
+
+    return wc_ed25519ph_sign_hash(hash, sizeof(hash), out, outLen, key, context,
+                                  contextLen);
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed25519 key to use when signing
+    type        one of Ed25519, Ed25519ctx or Ed25519ph
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed25519_sign_msg_ex(const byte* in, word32 inLen, byte* out,
+                            word32 *outLen, ed25519_key* key, byte type,
+                            const byte* context, byte contextLen)
+{
+    return ed25519_sign_msg(in, inLen, out, outLen, key, type, context,
+                            contextLen);
+}
+#endif /* HAVE_ED25519_SIGN */
+
+#ifdef HAVE_ED25519_VERIFY
+
+/* Order of the group, little endian. */
+static const byte ed25519Order[] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+    0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/* Check the scalar half of a signature, S, is less than the order.
+ *
+ * s        Little-endian S from the signature.
+ * returns 0 when S is in range and BAD_FUNC_ARG otherwise.
+ */
+static int ed25519_check_s(const byte* s)
+{
+    int i;
+
+    for (i = (int)sizeof(ed25519Order) - 1; i >= 0; i--) {
+        /* Bigger than order. */
+        if (s[i] > ed25519Order[i])
+            return BAD_FUNC_ARG;
+        /* Less than order. */
+        if (s[i] < ed25519Order[i])
+            return 0;
+    }
+    /* Same value as order. */
+    return BAD_FUNC_ARG;
+}
+
+/*
+   sig        is array of bytes containing the signature
+   sigLen     is the length of sig byte array
+   msg        the array of bytes containing the message
+   msgLen     length of msg array
+   res        will be 1 on successful verify and 0 on unsuccessful
+   key        Ed25519 public key
+   type       one of Ed25519, Ed25519ctx or Ed25519ph
+   context    extra signing data
+   contextLen length of extra signing data
+   return     0 and res of 1 on success
+*/
+static int ed25519_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                              word32 msgLen, int* res, ed25519_key* key,
+                              byte type, const byte* context, byte contextLen)
+{
+    byte   rcheck[ED25519_KEY_SIZE];
+    byte   h[WC_SHA512_DIGEST_SIZE];
+    ge_p3  A;
+    ge_p2  R;
+    wc_Sha512 sha;
+    int    ret;
+
+    /* sanity check on arguments */
+    if (sig == NULL || msg == NULL || res == NULL || key == NULL ||
+                                         (context == NULL && contextLen != 0)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* set verification failed by default */
+    *res = 0;
+
+    /* check on basics needed to verify signature */
+    if (sigLen != ED25519_SIG_SIZE || (sig[ED25519_SIG_SIZE-1] & 224))
+        return BAD_FUNC_ARG;
+
+    /* Check S is not larger than or equal to order. */
+    if (ed25519_check_s(sig + ED25519_SIG_SIZE/2) != 0)
+        return BAD_FUNC_ARG;
+
+    /* uncompress A (public key), test if valid, and negate it */
+    if (ge_frombytes_negate_vartime(&A, key->p) != 0)
+        return BAD_FUNC_ARG;
+
+    /* find H(R,A,M) and store it as h */
+    ret = ed25519_hash_init(&sha, key, type, context, contextLen);
+    if (ret != 0)
+        return ret;
+    ret = wc_Sha512Update(&sha, sig, ED25519_SIG_SIZE/2);
+    if (ret == 0)
+        ret = wc_Sha512Update(&sha, key->p, ED25519_PUB_KEY_SIZE);
+    if (ret == 0)
+        ret = wc_Sha512Update(&sha, msg, msgLen);
+    if (ret == 0)
+        ret = wc_Sha512Final(&sha, h);
+    wc_Sha512Free(&sha);
+    if (ret != 0)
+        return ret;
+
+    sc_reduce(h);
+
+    /*
+       Uses a fast single-signature verification SB = R + H(R,A,M)A becomes
+       SB - H(R,A,M)A saving decompression of R
+    */
+    ret = ge_double_scalarmult_vartime(&R, h, &A, sig + (ED25519_SIG_SIZE/2));
+    if (ret != 0)
+        return ret;
+
+    ge_tobytes(rcheck, &R);
+
+    /* comparison of R created to R in sig */
+    ret = ConstantCompare(rcheck, sig, ED25519_SIG_SIZE/2);
+    if (ret != 0) {
+        ret = SIG_VERIFY_E;
+    }
+    else {
+        /* set the verification status */
+        *res = 1;
+    }
+
+    return ret;
+}
+
+/*
+   sig     is array of bytes containing the signature
+   sigLen  is the length of sig byte array
+   msg     the array of bytes containing the message
+   msgLen  length of msg array
+   res     will be 1 on successful verify and 0 on unsuccessful
+   key     Ed25519 public key
+   return  0 and res of 1 on success
+*/
+int wc_ed25519_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                          word32 msgLen, int* res, ed25519_key* key)
+{
+    return ed25519_verify_msg(sig, sigLen, msg, msgLen, res, key, (byte)Ed25519,
+                              NULL, 0);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed25519 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return  0 and res of 1 on success
+*/
+int wc_ed25519ctx_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                             word32 msgLen, int* res, ed25519_key* key,
+                             const byte* context, byte contextLen)
+{
+    return ed25519_verify_msg(sig, sigLen, msg, msgLen, res, key, Ed25519ctx,
+                              context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   hash        the array of bytes containing the SHA-512 hash of the message
+   hashLen     length of hash array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed25519 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return  0 and res of 1 on success
+*/
+int wc_ed25519ph_verify_hash(const byte* sig, word32 sigLen, const byte* hash,
+                             word32 hashLen, int* res, ed25519_key* key,
+                             const byte* context, byte contextLen)
+{
+    return ed25519_verify_msg(sig, sigLen, hash, hashLen, res, key, Ed25519ph,
+                              context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed25519 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return  0 and res of 1 on success
+*/
+int wc_ed25519ph_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                            word32 msgLen, int* res, ed25519_key* key,
+                            const byte* context, byte contextLen)
+{
+    int  ret;
+    byte hash[WC_SHA512_DIGEST_SIZE];
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = ed25519_hash(key, msg, msgLen, hash);
+    if (ret != 0)
+        return ret;
+
+    return ed25519_verify_msg(sig, sigLen, hash, sizeof(hash), res, key,
+                              Ed25519ph, context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed25519 public key
+   type        one of Ed25519, Ed25519ctx or Ed25519ph
+   context     extra signing data
+   contextLen  length of extra signing data
+   return  0 and res of 1 on success
+*/
+int wc_ed25519_verify_msg_ex(const byte* sig, word32 sigLen, const byte* msg,
+                              word32 msgLen, int* res, ed25519_key* key,
+                              byte type, const byte* context, byte contextLen)
+{
+    return ed25519_verify_msg(sig, sigLen, msg, msgLen, res, key, type,
+                              context, contextLen);
+}
+
+#ifndef WOLFSSL_ED25519_BATCH_SZ
+    /* Number of signatures combined into one multi-scalar multiplication. */
+    #define WOLFSSL_ED25519_BATCH_SZ    64
+#endif
+/* Size in bytes of the random multipliers. */
+#define ED25519_BATCH_Z_SIZE    16
+
+/* Encoding of the base point B = (x, 4/5) with x positive. */
+static const byte ed25519BasePoint[ED25519_PUB_KEY_SIZE] = {
+    0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+};
+
+/* Check the y-coordinate of an encoded point is less than p = 2^255 - 19.
+ *
+ * returns 1 when the encoding is canonical and 0 otherwise.
+ */
+static int ed25519_canonical_y(const byte* s)
+{
+    int i;
+
+    if ((s[ED25519_PUB_KEY_SIZE - 1] & 0x7f) != 0x7f)
+        return 1;
+    for (i = ED25519_PUB_KEY_SIZE - 2; i > 0; i--) {
+        if (s[i] != 0xff)
+            return 1;
+    }
+    return s[0] < 0xed;
+}
+
+/* Verify up to WOLFSSL_ED25519_BATCH_SZ signatures with one equation.
+ *
+ * With random 128-bit z_i, checks that
+ *   (sum z_i.S_i).B - sum z_i.R_i - sum (z_i.h_i).A_i = 0
+ * which holds when every signature is valid. On failure, each signature is
+ * verified on its own to find the invalid ones.
+ * Signatures that are malformed, or whose R or A don't decode, are invalid
+ * without being added to the equation. R must also be canonically encoded
+ * as wc_ed25519_verify_msg() compares it byte for byte.
+ *
+ * pt     Work space for 2 * count + 1 points.
+ * sc     Work space for 2 * count + 1 scalars.
+ * idx    Work space for count indices.
+ * returns 0 when all were checked, otherwise an error code.
+ */
+static int ed25519_verify_batch_chunk(const byte** sigs, const word32* sigLens,
+    const byte** msgs, const word32* msgLens, ed25519_key** keys, word32 count,
+    int* res, WC_RNG* rng, ge_p3* pt, byte* sc, word32* idx, void* heap)
+{
+    byte      z[WOLFSSL_ED25519_BATCH_SZ * ED25519_BATCH_Z_SIZE];
+    byte      h[WC_SHA512_DIGEST_SIZE];
+    byte      zero[ED25519_KEY_SIZE];
+    wc_Sha512 sha;
+    ge_p3     sum;
+    fe        t;
+    word32    i;
+    word32    m = 0;
+    int       n = 1;
+    int       ret;
+
+    XMEMSET(zero, 0, sizeof(zero));
+    /* Scalar of the base point accumulates sum z_i.S_i. */
+    XMEMSET(sc, 0, ED25519_KEY_SIZE);
+
+    ret = wc_RNG_GenerateBlock(rng, z, count * ED25519_BATCH_Z_SIZE);
+
+    for (i = 0; ret == 0 && i < count; i++) {
+        const byte*  sig = sigs[i];
+        ed25519_key* key = keys[i];
+        ge_p3*       R = &pt[n];
+        ge_p3*       A = &pt[n + 1];
+        byte*        zs = sc + ED25519_KEY_SIZE * n;
+
+        res[i] = 0;
+
+        if (sigLens[i] != ED25519_SIG_SIZE ||
+                (sig[ED25519_SIG_SIZE - 1] & 224) != 0 ||
+                ed25519_check_s(sig + ED25519_SIG_SIZE/2) != 0 ||
+                !ed25519_canonical_y(sig)) {
+            continue;
+        }
+        /* Decode -A and -R. An R of x = 0 with the sign bit set is not
+         * canonical either. */
+        if (ge_frombytes_negate_vartime(A, key->p) != 0 ||
+                ge_frombytes_negate_vartime(R, sig) != 0) {
+            continue;
+        }
+        if ((sig[ED25519_SIG_SIZE/2 - 1] >> 7) != 0 && !fe_isnonzero(R->X))
+            continue;
+
+        /* h = H(R,A,M) */
+        ret = ed25519_hash_init(&sha, key, (byte)Ed25519, NULL, 0);
+        if (ret != 0)
+            break;
+        ret = wc_Sha512Update(&sha, sig, ED25519_SIG_SIZE/2);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, key->p, ED25519_PUB_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, msgs[i], msgLens[i]);
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, h);
+        wc_Sha512Free(&sha);
+        if (ret != 0)
+            break;
+        sc_reduce(h);
+
+        /* Scalars: z_i for -R, z_i.h_i for -A and add z_i.S_i for B. */
+        XMEMSET(zs, 0, ED25519_KEY_SIZE);
+        XMEMCPY(zs, z + ED25519_BATCH_Z_SIZE * i, ED25519_BATCH_Z_SIZE);
+        sc_muladd(zs + ED25519_KEY_SIZE, zs, h, zero);
+        sc_muladd(sc, zs, sig + ED25519_SIG_SIZE/2, sc);
+
+        idx[m++] = i;
+        n += 2;
+    }
+
+    if (ret == 0 && m > 1) {
+        ret = ge_multi_scalarmult_vartime(&sum, sc, pt, n, heap);
+        if (ret == 0) {
+            /* Identity is (0 : Z : Z). */
+            fe_sub(t, sum.Y, sum.Z);
+            if (!fe_isnonzero(sum.X) && !fe_isnonzero(t)) {
+                for (i = 0; i < m; i++)
+                    res[idx[i]] = 1;
+                m = 0;
+            }
+        }
+    }
+
+    /* Single signature or the batch failed: verify one at a time. */
+    for (i = 0; ret == 0 && i < m; i++) {
+        word32 j = idx[i];
+
+        ret = ed25519_verify_msg(sigs[j], sigLens[j], msgs[j], msgLens[j],
+                                 &res[j], keys[j], (byte)Ed25519, NULL, 0);
+        if (ret == SIG_VERIFY_E || ret == BAD_FUNC_ARG)
+            ret = 0;
+    }
+
+    ForceZero(z, sizeof(z));
+    ForceZero(sc, ED25519_KEY_SIZE * n);
+
+    return ret;
+}
+
+/*
+   Verify a batch of Ed25519 signatures. The signatures are checked together,
+   in groups of up to WOLFSSL_ED25519_BATCH_SZ, with a random linear
+   combination and one multi-scalar multiplication. A group that doesn't
+   verify is checked one signature at a time to find the invalid ones.
+
+   A signature with small order components in R or A may be rejected by
+   wc_ed25519_verify_msg() but still pass the combined check with a small
+   probability. Verify individually when this must not happen.
+
+   sigs     array of signatures
+   sigLens  lengths of the signatures
+   msgs     array of messages
+   msgLens  lengths of the messages
+   keys     Ed25519 public keys, one per signature
+   count    number of signatures
+   res      array of count results, each 1 on successful verify and 0 on
+            unsuccessful
+   rng      random number generator for the multipliers
+   return   0 when all signatures verify, SIG_VERIFY_E when one or more
+            don't and another error code on failure
+*/
+int wc_ed25519_verify_msg_batch(const byte** sigs, const word32* sigLens,
+                                const byte** msgs, const word32* msgLens,
+                                ed25519_key** keys, word32 count, int* res,
+                                WC_RNG* rng)
+{
+    ge_p3*  pt;
+    byte*   sc;
+    word32* idx;
+    void*   heap = NULL;
+    word32  i;
+    word32  sz;
+    int     ret = 0;
+
+    if (sigs == NULL || sigLens == NULL || msgs == NULL || msgLens == NULL ||
+            keys == NULL || res == NULL || rng == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    for (i = 0; i < count; i++) {
+        if (sigs[i] == NULL || msgs[i] == NULL || keys[i] == NULL)
+            return BAD_FUNC_ARG;
+    }
+    if (count == 0)
+        return 0;
+    heap = keys[0]->heap;
+
+    sz = (count < WOLFSSL_ED25519_BATCH_SZ) ? count : WOLFSSL_ED25519_BATCH_SZ;
+    pt = (ge_p3*)XMALLOC((sizeof(ge_p3) + 2 * ED25519_KEY_SIZE) * (2 * sz + 1) +
+                         sizeof(word32) * sz, heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (pt == NULL)
+        return MEMORY_E;
+    sc = (byte*)(pt + 2 * sz + 1);
+    idx = (word32*)(sc + ED25519_KEY_SIZE * (2 * sz + 1));
+
+    /* The first point is B: decode gives -B so negate it back. */
+    if (ge_frombytes_negate_vartime(&pt[0], ed25519BasePoint) != 0)
+        ret = ECC_BAD_ARG_E;
+    if (ret == 0) {
+        fe_neg(pt[0].X, pt[0].X);
+        fe_neg(pt[0].T, pt[0].T);
+    }
+
+    for (i = 0; ret == 0 && i < count; i += sz) {
+        word32 cnt = (count - i < sz) ? count - i : sz;
+
+        ret = ed25519_verify_batch_chunk(sigs + i, sigLens + i, msgs + i,
+                                         msgLens + i, keys + i, cnt, res + i,
+                                         rng, pt, sc, idx, heap);
+    }
+
+    XFREE(pt, heap, DYNAMIC_TYPE_TMP_BUFFER);
+
+    for (i = 0; ret == 0 && i < count; i++) {
+        if (res[i] != 1)
+            ret = SIG_VERIFY_E;
+    }
+
+    return ret;
+}
+#endif /* HAVE_ED25519_VERIFY */
+
+
+/* initialize information and memory for key */
+int wc_ed25519_init_ex(ed25519_key* key, void* heap, int devId)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    XMEMSET(key, 0, sizeof(ed25519_key));
+    key->heap = heap;
+    (void)devId;
+
+    fe_init();
+
+    return 0;
+}
+
+int wc_ed25519_init(ed25519_key* key)
+{
+    return wc_ed25519_init_ex(key, NULL, INVALID_DEVID);
+}
+
+/* clear memory of key */
+void wc_ed25519_free(ed25519_key* key)
+{
+    if (key == NULL)
+        return;
+
+    ForceZero(key, sizeof(ed25519_key));
+}
+
+
+#ifdef HAVE_ED25519_KEY_EXPORT
+
+/*
+    outLen should contain the size of out buffer when input. outLen is than set
+    to the final output length.
+    returns 0 on success
+ */
+int wc_ed25519_export_public(ed25519_key* key, byte* out, word32* outLen)
+{
+    /* sanity check on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED25519_PUB_KEY_SIZE) {
+        *outLen = ED25519_PUB_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED25519_PUB_KEY_SIZE;
+    XMEMCPY(out, key->p, ED25519_PUB_KEY_SIZE);
+
+    return 0;
+}
+
+#endif /* HAVE_ED25519_KEY_EXPORT */
+
+
+#ifdef HAVE_ED25519_KEY_IMPORT
+/*
+    Imports a compressed/uncompressed public key.
+    in    the byte array containing the public key
+    inLen the length of the byte array being passed in
+    key   ed25519 key struct to put the public key in
+ */
+int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key)
+{
+    int ret = 0;
+
+    /* sanity check on arguments */
+    if (in == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    if (inLen < ED25519_PUB_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    /* compressed prefix according to draft
+       http://www.ietf.org/id/draft-koch-eddsa-for-openpgp-02.txt */
+    if (in[0] == 0x40 && inLen == ED25519_PUB_KEY_SIZE + 1) {
+        /* key is stored in compressed format so just copy in */
+        XMEMCPY(key->p, (in + 1), ED25519_PUB_KEY_SIZE);
+        key->pubKeySet = 1;
+    }
+    /* importing uncompressed public key */
+    else if (in[0] == 0x04 && inLen > 2*ED25519_PUB_KEY_SIZE) {
+        /* pass in (x,y) and store compressed key */
+        ret = ge_compress_key(key->p, in+1,
+                              in+1+ED25519_PUB_KEY_SIZE, ED25519_PUB_KEY_SIZE);
+        if (ret == 0)
+            key->pubKeySet = 1;
+    }
+    /* if not specified compressed or uncompressed check key size
+       if key size is equal to compressed key size copy in key */
+    else if (inLen == ED25519_PUB_KEY_SIZE) {
+        XMEMCPY(key->p, in, ED25519_PUB_KEY_SIZE);
+        key->pubKeySet = 1;
+    }
+    else {
+        /* bad public key format */
+        ret = BAD_FUNC_ARG;
+    }
+
+    return ret;
+}
+
+
+/*
+    For importing a private key.
+ */
+int wc_ed25519_import_private_only(const byte* priv, word32 privSz,
+                                                               ed25519_key* key)
+{
+    /* sanity check on arguments */
+    if (priv == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* key size check */
+    if (privSz != ED25519_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    XMEMCPY(key->k, priv, ED25519_KEY_SIZE);
+    key->privKeySet = 1;
+
+    return 0;
+}
+
+/* Import an ed25519 private and public keys from byte array(s).
+ *
+ * priv     [in]  Array holding private key from wc_ed25519_export_private_only(),
+ *                or private+public keys from wc_ed25519_export_private().
+ * privSz   [in]  Number of bytes of data in private key array.
+ * pub      [in]  Array holding public key (or NULL).
+ * pubSz    [in]  Number of bytes of data in public key array (or 0).
+ * key      [in]  Ed25519 private/public key.
+ * returns BAD_FUNC_ARG when a required parameter is NULL or an invalid
+ *         combination of keys/lengths is supplied, 0 otherwise.
+ */
+int wc_ed25519_import_private_key(const byte* priv, word32 privSz,
+                                const byte* pub, word32 pubSz, ed25519_key* key)
+{
+    int ret;
+
+    /* sanity check on arguments */
+    if (priv == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* key size check */
+    if (privSz != ED25519_KEY_SIZE && privSz != ED25519_PRV_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    if (pub == NULL) {
+        if (pubSz != 0)
+            return BAD_FUNC_ARG;
+        if (privSz != ED25519_PRV_KEY_SIZE)
+            return BAD_FUNC_ARG;
+        pub = priv + ED25519_KEY_SIZE;
+        pubSz = ED25519_PUB_KEY_SIZE;
+    }
+    else if (pubSz < ED25519_PUB_KEY_SIZE) {
+        return BAD_FUNC_ARG;
+    }
+
+    XMEMCPY(key->k, priv, ED25519_KEY_SIZE);
+    key->privKeySet = 1;
+
+    /* import public key */
+    ret = wc_ed25519_import_public(pub, pubSz, key);
+    if (ret != 0) {
+        key->privKeySet = 0;
+        ForceZero(key->k, ED25519_KEY_SIZE);
+        return ret;
+    }
+
+    /* make the private key (priv + pub) */
+    XMEMCPY(key->k + ED25519_KEY_SIZE, key->p, ED25519_PUB_KEY_SIZE);
+
+    return ret;
+}
+
+#endif /* HAVE_ED25519_KEY_IMPORT */
+
+
+#ifdef HAVE_ED25519_KEY_EXPORT
+
+/*
+ export private key only (secret part so 32 bytes)
+ outLen should contain the size of out buffer when input. outLen is than set
+ to the final output length.
+ returns 0 on success
+ */
+int wc_ed25519_export_private_only(ed25519_key* key, byte* out, word32* outLen)
+{
+    /* sanity checks on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED25519_KEY_SIZE) {
+        *outLen = ED25519_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED25519_KEY_SIZE;
+    XMEMCPY(out, key->k, ED25519_KEY_SIZE);
+
+    return 0;
+}
+
+/*
+ export private key, including public part
+ outLen should contain the size of out buffer when input. outLen is than set
+ to the final output length.
+ returns 0 on success
+ */
+int wc_ed25519_export_private(ed25519_key* key, byte* out, word32* outLen)
+{
+    /* sanity checks on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED25519_PRV_KEY_SIZE) {
+        *outLen = ED25519_PRV_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED25519_PRV_KEY_SIZE;
+    XMEMCPY(out, key->k, ED25519_PRV_KEY_SIZE);
+
+    return 0;
+}
+
+/* export full private key and public key
+   return 0 on success
+ */
+int wc_ed25519_export_key(ed25519_key* key,
+                          byte* priv, word32 *privSz,
+                          byte* pub, word32 *pubSz)
+{
+    int ret;
+
+    /* export 'full' private part */
+    ret = wc_ed25519_export_private(key, priv, privSz);
+    if (ret != 0)
+        return ret;
+
+    /* export public part */
+    ret = wc_ed25519_export_public(key, pub, pubSz);
+
+    return ret;
+}
+
+#endif /* HAVE_ED25519_KEY_EXPORT */
+
+/* Check the public key is valid.
+ *
+ * When private key available, check the calculated public key matches.
+ * When no private key, check Y is in range and an X is able to be calculated.
+ *
+ * @param [in] key  Ed25519 private/public key.
+ * @return  0 otherwise.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  PUBLIC_KEY_E when the public key is not set, doesn't match or is
+ *          invalid.
+ * @return  other -ve value on hash failure.
+ */
+int wc_ed25519_check_key(ed25519_key* key)
+{
+    int ret = 0;
+    unsigned char pubKey[ED25519_PUB_KEY_SIZE];
+    ge_p3 A;
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    if (!key->pubKeySet)
+        ret = PUBLIC_KEY_E;
+
+    if (ret == 0 && key->privKeySet) {
+        ret = wc_ed25519_make_public(key, pubKey, sizeof(pubKey));
+        if (ret == 0 && XMEMCMP(pubKey, key->p, ED25519_PUB_KEY_SIZE) != 0)
+            ret = PUBLIC_KEY_E;
+    }
+    else if (ret == 0) {
+        if (ge_frombytes_negate_vartime(&A, key->p) != 0)
+            ret = PUBLIC_KEY_E;
+    }
+
+    return ret;
+}
+
+/* returns the private key size (secret only) in bytes */
+int wc_ed25519_size(ed25519_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED25519_KEY_SIZE;
+}
+
+/* returns the private key size (secret + public) in bytes */
+int wc_ed25519_priv_size(ed25519_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED25519_PRV_KEY_SIZE;
+}
+
+/* returns the compressed key size in bytes (public key) */
+int wc_ed25519_pub_size(ed25519_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED25519_PUB_KEY_SIZE;
+}
+
+/* returns the size of signature in bytes */
+int wc_ed25519_sig_size(ed25519_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED25519_SIG_SIZE;
+}
+
+#endif /* HAVE_ED25519 */
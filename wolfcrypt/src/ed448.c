@@ -32,4 +32,887 @@
 /* in case user set HAVE_ED448 there */
 #include <wolfssl/wolfcrypt/settings.h>
 
+#ifdef HAVE_ED448
 
+#include <wolfssl/wolfcrypt/ed448.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/hash.h>
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+#if defined(HAVE_ED448_SIGN) || defined(HAVE_ED448_VERIFY)
+/* Size of context bytes to use with hash when signing and verifying. */
+#define ED448CTX_SIZE    8
+/* Context to pass to hash when signing and verifying. */
+static const byte ed448Ctx[ED448CTX_SIZE+1] = "SigEd448";
+#endif
+
+/* Hash the data into a SHAKE256 digest of the requested length.
+ *
+ * key      Key for heap hint.
+ * in       Data to hash.
+ * inLen    Length of data in bytes.
+ * hash     Buffer to hold digest.
+ * hashLen  Number of bytes of digest to output.
+ * returns 0 on success and a hash error code otherwise.
+ */
+static int ed448_hash(ed448_key* key, const byte* in, word32 inLen,
+    byte* hash, word32 hashLen)
+{
+    int ret;
+    wc_Shake sha;
+
+    ret = wc_InitShake256(&sha, key->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_Shake256_Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Shake256_Final(&sha, hash, hashLen);
+        wc_Shake256_Free(&sha);
+    }
+
+    return ret;
+}
+
+#if defined(HAVE_ED448_SIGN) || defined(HAVE_ED448_VERIFY)
+/* Initialize the hash and add dom4 - Ed448 always uses the prefix.
+ *
+ * sha         SHAKE256 object to initialize.
+ * key         Key for heap hint.
+ * type        Ed448 or Ed448ph.
+ * context     Context of the signature. May be NULL when contextLen is 0.
+ * contextLen  Length of the context in bytes.
+ * returns 0 on success and a hash error code otherwise.
+ */
+static int ed448_hash_init(wc_Shake* sha, ed448_key* key, byte type,
+    const byte* context, byte contextLen)
+{
+    int ret;
+
+    ret = wc_InitShake256(sha, key->heap, INVALID_DEVID);
+    if (ret == 0)
+        ret = wc_Shake256_Update(sha, ed448Ctx, ED448CTX_SIZE);
+    if (ret == 0)
+        ret = wc_Shake256_Update(sha, &type, sizeof(type));
+    if (ret == 0)
+        ret = wc_Shake256_Update(sha, &contextLen, sizeof(contextLen));
+    if (ret == 0 && context != NULL)
+        ret = wc_Shake256_Update(sha, context, contextLen);
+
+    return ret;
+}
+#endif
+
+/* Hash the private key and clamp the secret scalar in the first half.
+ *
+ * key  Key with the private part set.
+ * az   Buffer of ED448_PRV_KEY_SIZE bytes to hold the expanded key.
+ * returns 0 on success and a hash error code otherwise.
+ */
+static int ed448_expand_key(ed448_key* key, byte* az)
+{
+    int ret;
+
+    ret = ed448_hash(key, key->k, ED448_KEY_SIZE, az, ED448_PRV_KEY_SIZE);
+    if (ret == 0) {
+        /* apply clamp */
+        az[0]  &= 0xfc;
+        az[55] |= 0x80;
+        az[56]  = 0x00;
+    }
+
+    return ret;
+}
+
+/* Derive the public key from the private key.
+ *
+ * key       Key with the private part set.
+ * pubKey    Buffer to hold the compressed public key.
+ * pubKeySz  Size of buffer in bytes. Must be ED448_PUB_KEY_SIZE.
+ * returns BAD_FUNC_ARG when a parameter is NULL or the size is wrong,
+ *         ECC_PRIV_KEY_E when the private key is not set and 0 on success.
+ */
+int wc_ed448_make_public(ed448_key* key, unsigned char* pubKey,
+                         word32 pubKeySz)
+{
+    int      ret = 0;
+    byte     az[ED448_PRV_KEY_SIZE];
+    byte     s[ED448_SIG_SIZE];
+    ge448_p2 A;
+
+    if (key == NULL || pubKey == NULL || pubKeySz != ED448_PUB_KEY_SIZE)
+        ret = BAD_FUNC_ARG;
+
+    if ((ret == 0) && (!key->privKeySet)) {
+        ret = ECC_PRIV_KEY_E;
+    }
+
+    if (ret == 0)
+        ret = ed448_expand_key(key, az);
+    if (ret == 0) {
+        /* the clamped scalar has bit 447 set - reduce for the base table */
+        XMEMSET(s, 0, sizeof(s));
+        XMEMCPY(s, az, ED448_KEY_SIZE);
+        sc448_reduce(s);
+
+        ge448_scalarmult_base(&A, s);
+        ge448_to_bytes(pubKey, &A);
+
+        key->pubKeySet = 1;
+    }
+
+    ForceZero(az, sizeof(az));
+    ForceZero(s, sizeof(s));
+
+    return ret;
+}
+
+/* generate an ed448 key pair.
+ * returns 0 on success
+ */
+int wc_ed448_make_key(WC_RNG* rng, int keySz, ed448_key* key)
+{
+    int ret;
+
+    if (rng == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* ed448 has 57 byte key sizes */
+    if (keySz != ED448_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    key->privKeySet = 0;
+    key->pubKeySet = 0;
+
+    ret = wc_RNG_GenerateBlock(rng, key->k, ED448_KEY_SIZE);
+    if (ret != 0)
+        return ret;
+
+    key->privKeySet = 1;
+    ret = wc_ed448_make_public(key, key->p, ED448_PUB_KEY_SIZE);
+    if (ret != 0) {
+        key->privKeySet = 0;
+        ForceZero(key->k, ED448_KEY_SIZE);
+        return ret;
+    }
+
+    /* put public key after private key, on the same buffer */
+    XMEMMOVE(key->k + ED448_KEY_SIZE, key->p, ED448_PUB_KEY_SIZE);
+
+    return ret;
+}
+
+
+#ifdef HAVE_ED448_SIGN
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed448 key to use when signing
+    type        one of Ed448 or Ed448ph
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+static int ed448_sign_msg(const byte* in, word32 inLen, byte* out,
+                          word32 *outLen, ed448_key* key, byte type,
+                          const byte* context, byte contextLen)
+{
+    ge448_p2 R;
+    byte     nonce[ED448_SIG_SIZE];
+    byte     hram[ED448_SIG_SIZE];
+    byte     az[ED448_PRV_KEY_SIZE];
+    wc_Shake sha;
+    int      ret;
+
+    /* sanity check on arguments */
+    if (in == NULL || out == NULL || outLen == NULL || key == NULL ||
+                                         (context == NULL && contextLen != 0)) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (!key->pubKeySet)
+        return BAD_FUNC_ARG;
+    if (!key->privKeySet)
+        return BAD_FUNC_ARG;
+
+    /* check and set up out length */
+    if (*outLen < ED448_SIG_SIZE) {
+        *outLen = ED448_SIG_SIZE;
+        return BUFFER_E;
+    }
+    *outLen = ED448_SIG_SIZE;
+
+    /* step 1: create nonce to use where nonce is r in
+       r = H(h_b, ... ,h_2b-1,M) */
+    ret = ed448_expand_key(key, az);
+    if (ret != 0)
+        return ret;
+
+    ret = ed448_hash_init(&sha, key, type, context, contextLen);
+    if (ret == 0) {
+        ret = wc_Shake256_Update(&sha, az + ED448_KEY_SIZE, ED448_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Shake256_Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Shake256_Final(&sha, nonce, sizeof(nonce));
+        wc_Shake256_Free(&sha);
+    }
+    if (ret == 0) {
+        sc448_reduce(nonce);
+
+        /* step 2: computing R = rB where rB is the scalar multiplication of
+           r and B */
+        ge448_scalarmult_base(&R, nonce);
+        ge448_to_bytes(out, &R);
+
+        /* step 3: hash R + public key + message getting H(R,A,M) then
+           creating S = (r + H(R,A,M)a) mod l */
+        ret = ed448_hash_init(&sha, key, type, context, contextLen);
+    }
+    if (ret == 0) {
+        ret = wc_Shake256_Update(&sha, out, ED448_SIG_SIZE/2);
+        if (ret == 0)
+            ret = wc_Shake256_Update(&sha, key->p, ED448_PUB_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Shake256_Update(&sha, in, inLen);
+        if (ret == 0)
+            ret = wc_Shake256_Final(&sha, hram, sizeof(hram));
+        wc_Shake256_Free(&sha);
+    }
+    if (ret == 0) {
+        sc448_reduce(hram);
+        sc448_muladd(out + (ED448_SIG_SIZE/2), hram, az, nonce);
+    }
+
+    ForceZero(az, sizeof(az));
+    ForceZero(nonce, sizeof(nonce));
+
+    return ret;
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed448 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed448_sign_msg(const byte* in, word32 inLen, byte* out, word32 *outLen,
+                      ed448_key* key, const byte* context, byte contextLen)
+{
+    return ed448_sign_msg(in, inLen, out, outLen, key, Ed448, context,
+                          contextLen);
+}
+
+/*
+    hash        contains the SHAKE256 hash of the message to sign
+    hashLen     is the length of the SHAKE256 hash of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed448 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed448ph_sign_hash(const byte* hash, word32 hashLen, byte* out,
+                         word32 *outLen, ed448_key* key,
+                         const byte* context, byte contextLen)
+{
+    return ed448_sign_msg(hash, hashLen, out, outLen, key, Ed448ph, context,
+                          contextLen);
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed448 key to use when signing
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed448ph_sign_msg(const byte* in, word32 inLen, byte* out,
+                        word32 *outLen, ed448_key* key,
+                        const byte* context, byte contextLen)
+{
+    int  ret;
+    byte hash[ED448_PREHASH_SIZE];
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = ed448_hash(key, in, inLen, hash, sizeof(hash));
+    if (ret != 0)
+        return ret;
+
+    return wc_ed448ph_sign_hash(hash, sizeof(hash), out, outLen, key, context,
+                                contextLen);
+}
+
+/*
+    in          contains the message to sign
+    inLen       is the length of the message to sign
+    out         is the buffer to write the signature
+    outLen      [in/out] input size of out buf
+                          output gets set as the final length of out
+    key         is the ed448 key to use when signing
+    type        one of Ed448 or Ed448ph
+    context     extra signing data
+    contextLen  length of extra signing data
+    return 0 on success
+ */
+int wc_ed448_sign_msg_ex(const byte* in, word32 inLen, byte* out,
+                         word32 *outLen, ed448_key* key, byte type,
+                         const byte* context, byte contextLen)
+{
+    return ed448_sign_msg(in, inLen, out, outLen, key, type, context,
+                          contextLen);
+}
+#endif /* HAVE_ED448_SIGN */
+
+#ifdef HAVE_ED448_VERIFY
+
+/* Order of the group, little endian. */
+static const byte ed448Order[ED448_SIG_SIZE/2] = {
+    0xf3, 0x44, 0x58, 0xab, 0x92, 0xc2, 0x78, 0x23,
+    0x55, 0x8f, 0xc5, 0x8d, 0x72, 0xc2, 0x6c, 0x21,
+    0x90, 0x36, 0xd6, 0xae, 0x49, 0xdb, 0x4e, 0xc4,
+    0xe9, 0x23, 0xca, 0x7c, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00
+};
+
+/* Check the scalar half of a signature, S, is less than the order.
+ *
+ * s        Little-endian S from the signature.
+ * returns 0 when S is in range and BAD_FUNC_ARG otherwise.
+ */
+static int ed448_check_s(const byte* s)
+{
+    int i;
+
+    for (i = (int)sizeof(ed448Order) - 1; i >= 0; i--) {
+        /* Bigger than order. */
+        if (s[i] > ed448Order[i])
+            return BAD_FUNC_ARG;
+        /* Less than order. */
+        if (s[i] < ed448Order[i])
+            return 0;
+    }
+    /* Same value as order. */
+    return BAD_FUNC_ARG;
+}
+
+/*
+   sig        is array of bytes containing the signature
+   sigLen     is the length of sig byte array
+   msg        the array of bytes containing the message
+   msgLen     length of msg array
+   res        will be 1 on successful verify and 0 on unsuccessful
+   key        Ed448 public key
+   type       one of Ed448 or Ed448ph
+   context    extra signing data
+   contextLen length of extra signing data
+   return     0 and res of 1 on success
+*/
+static int ed448_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                            word32 msgLen, int* res, ed448_key* key,
+                            byte type, const byte* context, byte contextLen)
+{
+    byte     rcheck[ED448_KEY_SIZE];
+    byte     h[ED448_SIG_SIZE];
+    ge448_p2 A;
+    ge448_p2 R;
+    wc_Shake sha;
+    int      ret;
+
+    /* sanity check on arguments */
+    if (sig == NULL || msg == NULL || res == NULL || key == NULL ||
+                                         (context == NULL && contextLen != 0)) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* set verification failed by default */
+    *res = 0;
+
+    /* check on basics needed to verify signature */
+    if (sigLen != ED448_SIG_SIZE)
+        return BAD_FUNC_ARG;
+
+    /* Check S is not larger than or equal to order. */
+    if (ed448_check_s(sig + ED448_SIG_SIZE/2) != 0)
+        return BAD_FUNC_ARG;
+
+    /* uncompress A (public key), test if valid, and negate it */
+    if (ge448_from_bytes_negate_vartime(&A, key->p) != 0)
+        return BAD_FUNC_ARG;
+
+    /* find H(R,A,M) and store it as h */
+    ret = ed448_hash_init(&sha, key, type, context, contextLen);
+    if (ret != 0)
+        return ret;
+    ret = wc_Shake256_Update(&sha, sig, ED448_SIG_SIZE/2);
+    if (ret == 0)
+        ret = wc_Shake256_Update(&sha, key->p, ED448_PUB_KEY_SIZE);
+    if (ret == 0)
+        ret = wc_Shake256_Update(&sha, msg, msgLen);
+    if (ret == 0)
+        ret = wc_Shake256_Final(&sha, h, sizeof(h));
+    wc_Shake256_Free(&sha);
+    if (ret != 0)
+        return ret;
+
+    sc448_reduce(h);
+
+    /*
+       Uses a fast single-signature verification SB = R + H(R,A,M)A becomes
+       SB - H(R,A,M)A saving decompression of R
+    */
+    ret = ge448_double_scalarmult_vartime(&R, h, &A, sig + (ED448_SIG_SIZE/2));
+    if (ret != 0)
+        return ret;
+
+    ge448_to_bytes(rcheck, &R);
+
+    /* comparison of R created to R in sig */
+    ret = ConstantCompare(rcheck, sig, ED448_SIG_SIZE/2);
+    if (ret != 0) {
+        ret = SIG_VERIFY_E;
+    }
+    else {
+        /* set the verification status */
+        *res = 1;
+    }
+
+    return ret;
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed448 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return      0 and res of 1 on success
+*/
+int wc_ed448_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                        word32 msgLen, int* res, ed448_key* key,
+                        const byte* context, byte contextLen)
+{
+    return ed448_verify_msg(sig, sigLen, msg, msgLen, res, key, Ed448,
+                            context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   hash        the array of bytes containing the SHAKE256 hash of the message
+   hashLen     length of hash array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed448 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return      0 and res of 1 on success
+*/
+int wc_ed448ph_verify_hash(const byte* sig, word32 sigLen, const byte* hash,
+                           word32 hashLen, int* res, ed448_key* key,
+                           const byte* context, byte contextLen)
+{
+    return ed448_verify_msg(sig, sigLen, hash, hashLen, res, key, Ed448ph,
+                            context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed448 public key
+   context     extra signing data
+   contextLen  length of extra signing data
+   return      0 and res of 1 on success
+*/
+int wc_ed448ph_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                          word32 msgLen, int* res, ed448_key* key,
+                          const byte* context, byte contextLen)
+{
+    int  ret;
+    byte hash[ED448_PREHASH_SIZE];
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = ed448_hash(key, msg, msgLen, hash, sizeof(hash));
+    if (ret != 0)
+        return ret;
+
+    return wc_ed448ph_verify_hash(sig, sigLen, hash, sizeof(hash), res, key,
+                                  context, contextLen);
+}
+
+/*
+   sig         is array of bytes containing the signature
+   sigLen      is the length of sig byte array
+   msg         the array of bytes containing the message
+   msgLen      length of msg array
+   res         will be 1 on successful verify and 0 on unsuccessful
+   key         Ed448 public key
+   type        one of Ed448 or Ed448ph
+   context     extra signing data
+   contextLen  length of extra signing data
+   return      0 and res of 1 on success
+*/
+int wc_ed448_verify_msg_ex(const byte* sig, word32 sigLen, const byte* msg,
+                           word32 msgLen, int* res, ed448_key* key,
+                           byte type, const byte* context, byte contextLen)
+{
+    return ed448_verify_msg(sig, sigLen, msg, msgLen, res, key, type,
+                            context, contextLen);
+}
+#endif /* HAVE_ED448_VERIFY */
+
+
+/* initialize information and memory for key */
+int wc_ed448_init_ex(ed448_key* key, void* heap, int devId)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    XMEMSET(key, 0, sizeof(ed448_key));
+    key->heap = heap;
+    (void)devId;
+
+    fe448_init();
+
+    return 0;
+}
+
+int wc_ed448_init(ed448_key* key)
+{
+    return wc_ed448_init_ex(key, NULL, INVALID_DEVID);
+}
+
+/* clear memory of key */
+void wc_ed448_free(ed448_key* key)
+{
+    if (key == NULL)
+        return;
+
+    ForceZero(key, sizeof(ed448_key));
+}
+
+
+#ifdef HAVE_ED448_KEY_EXPORT
+
+/*
+    outLen should contain the size of out buffer when input. outLen is than set
+    to the final output length.
+    returns 0 on success
+ */
+int wc_ed448_export_public(ed448_key* key, byte* out, word32* outLen)
+{
+    /* sanity check on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED448_PUB_KEY_SIZE) {
+        *outLen = ED448_PUB_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED448_PUB_KEY_SIZE;
+    XMEMCPY(out, key->p, ED448_PUB_KEY_SIZE);
+
+    return 0;
+}
+
+#endif /* HAVE_ED448_KEY_EXPORT */
+
+
+#ifdef HAVE_ED448_KEY_IMPORT
+/*
+    Imports a compressed/uncompressed public key.
+    in    the byte array containing the public key
+    inLen the length of the byte array being passed in
+    key   ed448 key struct to put the public key in
+ */
+int wc_ed448_import_public(const byte* in, word32 inLen, ed448_key* key)
+{
+    int ret = 0;
+
+    /* sanity check on arguments */
+    if (in == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    if (inLen < ED448_PUB_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    /* compressed prefix according to draft
+       https://tools.ietf.org/html/draft-ietf-openpgp-rfc4880bis-06 */
+    if (in[0] == 0x40 && inLen == ED448_PUB_KEY_SIZE + 1) {
+        /* key is stored in compressed format so just copy in */
+        XMEMCPY(key->p, (in + 1), ED448_PUB_KEY_SIZE);
+        key->pubKeySet = 1;
+    }
+    /* importing uncompressed public key */
+    else if (in[0] == 0x04 && inLen > 2*ED448_PUB_KEY_SIZE) {
+        /* pass in (x,y) and store compressed key */
+        ret = ge448_compress_key(key->p, in+1, in+1+ED448_PUB_KEY_SIZE,
+                                 ED448_PUB_KEY_SIZE);
+        if (ret == 0)
+            key->pubKeySet = 1;
+    }
+    /* if not specified compressed or uncompressed check key size
+       if key size is equal to compressed key size copy in key */
+    else if (inLen == ED448_PUB_KEY_SIZE) {
+        XMEMCPY(key->p, in, ED448_PUB_KEY_SIZE);
+        key->pubKeySet = 1;
+    }
+    else {
+        /* bad public key format */
+        ret = BAD_FUNC_ARG;
+    }
+
+    return ret;
+}
+
+
+/*
+    For importing a private key.
+ */
+int wc_ed448_import_private_only(const byte* priv, word32 privSz,
+                                 ed448_key* key)
+{
+    /* sanity check on arguments */
+    if (priv == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* key size check */
+    if (privSz != ED448_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    XMEMCPY(key->k, priv, ED448_KEY_SIZE);
+    key->privKeySet = 1;
+
+    return 0;
+}
+
+/* Import an ed448 private and public keys from byte array(s).
+ *
+ * priv     [in]  Array holding private key from wc_ed448_export_private_only(),
+ *                or private+public keys from wc_ed448_export_private().
+ * privSz   [in]  Number of bytes of data in private key array.
+ * pub      [in]  Array holding public key (or NULL).
+ * pubSz    [in]  Number of bytes of data in public key array (or 0).
+ * key      [in]  Ed448 private/public key.
+ * returns BAD_FUNC_ARG when a required parameter is NULL or an invalid
+ *         combination of keys/lengths is supplied, 0 otherwise.
+ */
+int wc_ed448_import_private_key(const byte* priv, word32 privSz,
+                                const byte* pub, word32 pubSz, ed448_key* key)
+{
+    int ret;
+
+    /* sanity check on arguments */
+    if (priv == NULL || key == NULL)
+        return BAD_FUNC_ARG;
+
+    /* key size check */
+    if (privSz != ED448_KEY_SIZE && privSz != ED448_PRV_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    if (pub == NULL) {
+        if (pubSz != 0)
+            return BAD_FUNC_ARG;
+        if (privSz != ED448_PRV_KEY_SIZE)
+            return BAD_FUNC_ARG;
+        pub = priv + ED448_KEY_SIZE;
+        pubSz = ED448_PUB_KEY_SIZE;
+    }
+    else if (pubSz < ED448_PUB_KEY_SIZE) {
+        return BAD_FUNC_ARG;
+    }
+
+    XMEMCPY(key->k, priv, ED448_KEY_SIZE);
+    key->privKeySet = 1;
+
+    /* import public key */
+    ret = wc_ed448_import_public(pub, pubSz, key);
+    if (ret != 0) {
+        key->privKeySet = 0;
+        ForceZero(key->k, ED448_KEY_SIZE);
+        return ret;
+    }
+
+    /* make the private key (priv + pub) */
+    XMEMCPY(key->k + ED448_KEY_SIZE, key->p, ED448_PUB_KEY_SIZE);
+
+    return ret;
+}
+
+#endif /* HAVE_ED448_KEY_IMPORT */
+
+
+#ifdef HAVE_ED448_KEY_EXPORT
+
+/*
+ export private key only (secret part so 57 bytes)
+ outLen should contain the size of out buffer when input. outLen is than set
+ to the final output length.
+ returns 0 on success
+ */
+int wc_ed448_export_private_only(ed448_key* key, byte* out, word32* outLen)
+{
+    /* sanity checks on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED448_KEY_SIZE) {
+        *outLen = ED448_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED448_KEY_SIZE;
+    XMEMCPY(out, key->k, ED448_KEY_SIZE);
+
+    return 0;
+}
+
+/*
+ export private key, including public part
+ outLen should contain the size of out buffer when input. outLen is than set
+ to the final output length.
+ returns 0 on success
+ */
+int wc_ed448_export_private(ed448_key* key, byte* out, word32* outLen)
+{
+    /* sanity checks on arguments */
+    if (key == NULL || out == NULL || outLen == NULL)
+        return BAD_FUNC_ARG;
+
+    if (*outLen < ED448_PRV_KEY_SIZE) {
+        *outLen = ED448_PRV_KEY_SIZE;
+        return BUFFER_E;
+    }
+
+    *outLen = ED448_PRV_KEY_SIZE;
+    XMEMCPY(out, key->k, ED448_PRV_KEY_SIZE);
+
+    return 0;
+}
+
+/* export full private key and public key
+   return 0 on success
+ */
+int wc_ed448_export_key(ed448_key* key,
+                        byte* priv, word32 *privSz,
+                        byte* pub, word32 *pubSz)
+{
+    int ret;
+
+    /* export 'full' private part */
+    ret = wc_ed448_export_private(key, priv, privSz);
+    if (ret != 0)
+        return ret;
+
+    /* export public part */
+    ret = wc_ed448_export_public(key, pub, pubSz);
+
+    return ret;
+}
+
+#endif /* HAVE_ED448_KEY_EXPORT */
+
+/* Check the public key is valid.
+ *
+ * When private key available, check the calculated public key matches.
+ * When no private key, check Y is in range and an X is able to be calculated.
+ *
+ * @param [in] key  Ed448 private/public key.
+ * @return  0 otherwise.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  PUBLIC_KEY_E when the public key is not set, doesn't match or is
+ *          invalid.
+ * @return  other -ve value on hash failure.
+ */
+int wc_ed448_check_key(ed448_key* key)
+{
+    int ret = 0;
+    unsigned char pubKey[ED448_PUB_KEY_SIZE];
+    ge448_p2 A;
+
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    if (!key->pubKeySet)
+        ret = PUBLIC_KEY_E;
+
+    if (ret == 0 && key->privKeySet) {
+        ret = wc_ed448_make_public(key, pubKey, sizeof(pubKey));
+        if (ret == 0 && XMEMCMP(pubKey, key->p, ED448_PUB_KEY_SIZE) != 0)
+            ret = PUBLIC_KEY_E;
+    }
+    else if (ret == 0) {
+        if (ge448_from_bytes_negate_vartime(&A, key->p) != 0)
+            ret = PUBLIC_KEY_E;
+    }
+
+    return ret;
+}
+
+/* returns the private key size (secret only) in bytes */
+int wc_ed448_size(ed448_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED448_KEY_SIZE;
+}
+
+/* returns the private key size (secret + public) in bytes */
+int wc_ed448_priv_size(ed448_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED448_PRV_KEY_SIZE;
+}
+
+/* returns the compressed key size in bytes (public key) */
+int wc_ed448_pub_size(ed448_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED448_PUB_KEY_SIZE;
+}
+
+/* returns the size of signature in bytes */
+int wc_ed448_sig_size(ed448_key* key)
+{
+    if (key == NULL)
+        return BAD_FUNC_ARG;
+
+    return ED448_SIG_SIZE;
+}
+
+#endif /* HAVE_ED448 */
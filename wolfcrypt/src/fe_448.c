@@ -30,3 +30,544 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#if defined(HAVE_CURVE448) || defined(HAVE_ED448)
+
+#include <wolfssl/wolfcrypt/fe_448.h>
+
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+#ifdef CURVED448_128BIT
+
+typedef __uint128_t uint128_t;
+
+/* Mask of the low 56 bits of a limb. */
+#define FE448_MASK  ((word64)0x00ffffffffffffffULL)
+
+/* Initialize the field element operations.
+ */
+void fe448_init(void)
+{
+}
+
+/* Set the field element to 0.
+ *
+ * r  A field element.
+ */
+void fe448_0(fe448 r)
+{
+    XMEMSET(r, 0, sizeof(fe448));
+}
+
+/* Set the field element to 1.
+ *
+ * r  A field element.
+ */
+void fe448_1(fe448 r)
+{
+    XMEMSET(r, 0, sizeof(fe448));
+    r[0] = 1;
+}
+
+/* Copy field element a into field element r.
+ *
+ * r  Field element to copy into.
+ * a  Field element to copy.
+ */
+void fe448_copy(fe448 r, const fe448 a)
+{
+    XMEMCPY(r, a, sizeof(fe448));
+}
+
+/* Propagate the carries through the limbs and fold the overflow above 2^448
+ * back in using 2^448 = 2^224 + 1 (mod p).
+ * Leaves every limb at most 56 bits plus a small carry in limbs 0 and 4.
+ *
+ * a  A field element.
+ */
+static WC_INLINE void fe448_carry(fe448 a)
+{
+    word64 o;
+    int i;
+
+    for (i = 0; i < 7; i++) {
+        a[i + 1] += a[i] >> 56;
+        a[i] &= FE448_MASK;
+    }
+    o = a[7] >> 56;
+    a[7] &= FE448_MASK;
+    a[0] += o;
+    a[4] += o;
+}
+
+/* Conditionally swap the field elements a and b in constant time.
+ *
+ * a  A field element.
+ * b  A field element.
+ * c  If 1 then swap and if 0 then don't swap.
+ */
+static WC_INLINE void fe448_cswap(fe448 a, fe448 b, int c)
+{
+    word64 m = (word64)0 - (word64)c;
+    word64 t;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        t = (a[i] ^ b[i]) & m;
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+/* Conditionally move field element a into r in constant time.
+ *
+ * r  Field element to move into.
+ * a  Field element to move.
+ * c  If 1 then move and if 0 then don't move.
+ */
+void fe448_cmov(fe448 r, const fe448 a, int c)
+{
+    word64 m = (word64)0 - (word64)c;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] ^= (r[i] ^ a[i]) & m;
+    }
+}
+
+/* Convert the field element to a fully reduced little-endian array of bytes.
+ *
+ * b  Array of bytes.
+ * a  Field element to convert.
+ */
+void fe448_to_bytes(unsigned char* b, const fe448 a)
+{
+    fe448  t;
+    sword64 c;
+    word64 m;
+    int i, j;
+
+    fe448_copy(t, a);
+    fe448_carry(t);
+    fe448_carry(t);
+
+    /* Subtract p: limbs are 2^56-1 except limb 4 which is 2^56-2. */
+    c = 0;
+    for (i = 0; i < 8; i++) {
+        c += (sword64)t[i] - (sword64)(FE448_MASK - (i == 4));
+        t[i] = (word64)c & FE448_MASK;
+        c >>= 56;
+    }
+    /* Add p back when the subtraction borrowed. */
+    m = (word64)c;
+    c = 0;
+    for (i = 0; i < 8; i++) {
+        c += (sword64)t[i] + (sword64)((FE448_MASK - (i == 4)) & m);
+        t[i] = (word64)c & FE448_MASK;
+        c >>= 56;
+    }
+
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < 7; j++) {
+            b[i * 7 + j] = (unsigned char)(t[i] >> (8 * j));
+        }
+    }
+}
+
+/* Convert a little-endian array of 56 bytes into a field element.
+ * The value need not be less than the modulus.
+ *
+ * r  Field element to set.
+ * b  Array of bytes.
+ */
+void fe448_from_bytes(fe448 r, const unsigned char* b)
+{
+    int i, j;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = 0;
+        for (j = 0; j < 7; j++) {
+            r[i] |= (word64)b[i * 7 + j] << (8 * j);
+        }
+    }
+}
+
+/* The field element value 0 as an array of bytes. */
+static const unsigned char zero[56] = {0};
+
+/* Constant time check as to whether a is not 0.
+ *
+ * a  A field element.
+ * returns 0 when zero and non-zero otherwise.
+ */
+int fe448_isnonzero(const fe448 a)
+{
+    unsigned char b[56];
+
+    fe448_to_bytes(b, a);
+    return ConstantCompare(b, zero, 56);
+}
+
+/* Check whether a is negative - the least significant bit of the fully
+ * reduced value is set.
+ *
+ * a  A field element.
+ * returns 1 when negative and 0 otherwise.
+ */
+int fe448_isnegative(const fe448 a)
+{
+    unsigned char b[56];
+
+    fe448_to_bytes(b, a);
+    return b[0] & 1;
+}
+
+/* Add two field elements. r = (a + b) mod p
+ *
+ * r  Field element to hold sum.
+ * a  Field element to add.
+ * b  Field element to add.
+ */
+void fe448_add(fe448 r, const fe448 a, const fe448 b)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = a[i] + b[i];
+    }
+    fe448_carry(r);
+}
+
+/* Subtract a field element from another. r = (a - b) mod p
+ * 4 * p is added so that no limb goes negative.
+ *
+ * r  Field element to hold difference.
+ * a  Field element to subtract from.
+ * b  Field element to subtract.
+ */
+void fe448_sub(fe448 r, const fe448 a, const fe448 b)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = a[i] + (((word64)1 << 58) - 4 - 4 * (i == 4)) - b[i];
+    }
+    fe448_carry(r);
+}
+
+/* Negate a field element. r = -a mod p
+ *
+ * r  Field element to hold result.
+ * a  Field element to negate.
+ */
+void fe448_neg(fe448 r, const fe448 a)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = (((word64)1 << 58) - 4 - 4 * (i == 4)) - a[i];
+    }
+    fe448_carry(r);
+}
+
+/* Multiply a field element by 39081. r = (39081 * a) mod p
+ *
+ * r  Field element to hold result.
+ * a  Field element to multiply.
+ */
+void fe448_mul39081(fe448 r, const fe448 a)
+{
+    uint128_t t = 0;
+    word64 o;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        t += (uint128_t)a[i] * 39081;
+        r[i] = (word64)t & FE448_MASK;
+        t >>= 56;
+    }
+    o = (word64)t;
+    r[0] += o;
+    r[4] += o;
+    fe448_carry(r);
+}
+
+/* Reduce the Karatsuba products into a field element.
+ * With phi = 2^224 the modulus is phi^2 - phi - 1, so for
+ * a = a0 + a1.phi and b = b0 + b1.phi:
+ *   a.b = (a0.b0 + a1.b1) + ((a0+a1).(b0+b1) - a0.b0).phi  (mod p)
+ * Each of the three 4x4 products has seven coefficients; those at positions
+ * 4..6 are multiples of phi and fold as phi.phi = phi + 1.
+ *
+ * r   Field element to hold result.
+ * sl  Coefficients 0..3 of a0.b0.
+ * sh  Coefficients 4..6 of a0.b0 (index 3 is zero).
+ * tl  Coefficients 0..3 of a1.b1.
+ * th  Coefficients 4..6 of a1.b1 (index 3 is zero).
+ * ul  Coefficients 0..3 of (a0+a1).(b0+b1).
+ * uh  Coefficients 4..6 of (a0+a1).(b0+b1) (index 3 is zero).
+ */
+static WC_INLINE void fe448_reduce_k(fe448 r, const uint128_t* sl,
+    const uint128_t* sh, const uint128_t* tl, const uint128_t* th,
+    const uint128_t* ul, const uint128_t* uh)
+{
+    uint128_t lo = 0;
+    uint128_t hi = 0;
+    int i;
+
+    /* Every term of a0.b0 is also a term of (a0+a1).(b0+b1) so both sums are
+     * non-negative. */
+    for (i = 0; i < 4; i++) {
+        lo += sl[i] + tl[i] + uh[i] - sh[i];
+        hi += th[i] + ul[i] - sl[i] + uh[i];
+        r[i] = (word64)lo & FE448_MASK;
+        r[i + 4] = (word64)hi & FE448_MASK;
+        lo >>= 56;
+        hi >>= 56;
+    }
+    /* lo overflows at phi and hi at phi^2 = phi + 1. */
+    lo += hi + r[4];
+    hi += r[0];
+    r[4] = (word64)lo & FE448_MASK;
+    r[5] += (word64)(lo >> 56);
+    r[0] = (word64)hi & FE448_MASK;
+    r[1] += (word64)(hi >> 56);
+}
+
+/* Multiply two field elements. r = (a * b) mod p
+ *
+ * r  Field element to hold result.
+ * a  Field element to multiply.
+ * b  Field element to multiply.
+ */
+void fe448_mul(fe448 r, const fe448 a, const fe448 b)
+{
+    word64 aa[4], bb[4];
+    uint128_t sl[4], sh[4], tl[4], th[4], ul[4], uh[4];
+    int i, j;
+
+    for (i = 0; i < 4; i++) {
+        aa[i] = a[i] + a[i + 4];
+        bb[i] = b[i] + b[i + 4];
+    }
+    for (i = 0; i < 4; i++) {
+        sl[i] = tl[i] = ul[i] = 0;
+        sh[i] = th[i] = uh[i] = 0;
+        for (j = 0; j <= i; j++) {
+            sl[i] += (uint128_t)a[j] * b[i - j];
+            tl[i] += (uint128_t)a[j + 4] * b[i - j + 4];
+            ul[i] += (uint128_t)aa[j] * bb[i - j];
+        }
+        for (j = i + 1; j < 4; j++) {
+            sh[i] += (uint128_t)a[j] * b[i + 4 - j];
+            th[i] += (uint128_t)a[j + 4] * b[i + 8 - j];
+            uh[i] += (uint128_t)aa[j] * bb[i + 4 - j];
+        }
+    }
+    fe448_reduce_k(r, sl, sh, tl, th, ul, uh);
+}
+
+/* Square a field element. r = (a * a) mod p
+ * Cross products are computed once and doubled.
+ *
+ * r  Field element to hold result.
+ * a  Field element to square.
+ */
+void fe448_sqr(fe448 r, const fe448 a)
+{
+    word64 aa[4];
+    uint128_t sl[4], sh[4], tl[4], th[4], ul[4], uh[4];
+    int i, j;
+
+    for (i = 0; i < 4; i++) {
+        aa[i] = a[i] + a[i + 4];
+    }
+    for (i = 0; i < 4; i++) {
+        sl[i] = tl[i] = ul[i] = 0;
+        sh[i] = th[i] = uh[i] = 0;
+        for (j = 0; j < i - j; j++) {
+            sl[i] += (uint128_t)a[j] * a[i - j];
+            tl[i] += (uint128_t)a[j + 4] * a[i - j + 4];
+            ul[i] += (uint128_t)aa[j] * aa[i - j];
+        }
+        sl[i] <<= 1;
+        tl[i] <<= 1;
+        ul[i] <<= 1;
+        if ((i & 1) == 0) {
+            sl[i] += (uint128_t)a[i / 2] * a[i / 2];
+            tl[i] += (uint128_t)a[i / 2 + 4] * a[i / 2 + 4];
+            ul[i] += (uint128_t)aa[i / 2] * aa[i / 2];
+        }
+        for (j = i + 1; j < i + 4 - j; j++) {
+            sh[i] += (uint128_t)a[j] * a[i + 4 - j];
+            th[i] += (uint128_t)a[j + 4] * a[i + 8 - j];
+            uh[i] += (uint128_t)aa[j] * aa[i + 4 - j];
+        }
+        sh[i] <<= 1;
+        th[i] <<= 1;
+        uh[i] <<= 1;
+        if ((i & 1) == 0 && i < 3) {
+            sh[i] += (uint128_t)a[i / 2 + 2] * a[i / 2 + 2];
+            th[i] += (uint128_t)a[i / 2 + 6] * a[i / 2 + 6];
+            uh[i] += (uint128_t)aa[i / 2 + 2] * aa[i / 2 + 2];
+        }
+    }
+    fe448_reduce_k(r, sl, sh, tl, th, ul, uh);
+}
+
+/* Square a field element n times. r = a^(2^n) mod p
+ *
+ * r  Field element to hold result.
+ * a  Field element to square.
+ * n  Number of squarings - must be at least 1.
+ */
+static void fe448_sqr_n(fe448 r, const fe448 a, int n)
+{
+    fe448_sqr(r, a);
+    while (--n > 0) {
+        fe448_sqr(r, r);
+    }
+}
+
+/* Raise a field element to the power (p-3)/4 = 2^446 - 2^222 - 1.
+ * Used for the inverse and for square roots.
+ *
+ * r  Field element to hold result.
+ * a  Field element to exponentiate.
+ */
+void fe448_pow_2_446_222_1(fe448 r, const fe448 a)
+{
+    fe448 t1, t2, t3, t6, t24;
+
+    /* t1 = a^(2^2-1) */
+    fe448_sqr(t1, a);
+    fe448_mul(t1, t1, a);
+    /* t3 = a^(2^3-1) */
+    fe448_sqr(t3, t1);
+    fe448_mul(t3, t3, a);
+    /* t6 = a^(2^6-1) */
+    fe448_sqr_n(t6, t3, 3);
+    fe448_mul(t6, t6, t3);
+    /* t1 = a^(2^12-1) */
+    fe448_sqr_n(t1, t6, 6);
+    fe448_mul(t1, t1, t6);
+    /* t24 = a^(2^24-1) */
+    fe448_sqr_n(t24, t1, 12);
+    fe448_mul(t24, t24, t1);
+    /* t1 = a^(2^48-1) */
+    fe448_sqr_n(t1, t24, 24);
+    fe448_mul(t1, t1, t24);
+    /* t2 = a^(2^96-1) */
+    fe448_sqr_n(t2, t1, 48);
+    fe448_mul(t2, t2, t1);
+    /* t1 = a^(2^192-1) */
+    fe448_sqr_n(t1, t2, 96);
+    fe448_mul(t1, t1, t2);
+    /* t1 = a^(2^216-1) */
+    fe448_sqr_n(t1, t1, 24);
+    fe448_mul(t1, t1, t24);
+    /* t1 = a^(2^222-1) */
+    fe448_sqr_n(t1, t1, 6);
+    fe448_mul(t1, t1, t6);
+    /* t2 = a^(2^223-1) */
+    fe448_sqr(t2, t1);
+    fe448_mul(t2, t2, a);
+    /* r = a^(2^446-2^223+2^222-1) = a^(2^446-2^222-1) */
+    fe448_sqr_n(t2, t2, 223);
+    fe448_mul(r, t2, t1);
+}
+
+/* Invert the field element. r = a^(p-2) = 1/a mod p
+ * p-2 = 4.((p-3)/4) + 1
+ *
+ * r  Field element to hold result.
+ * a  Field element to invert.
+ */
+void fe448_invert(fe448 r, const fe448 a)
+{
+    fe448 t;
+
+    fe448_pow_2_446_222_1(t, a);
+    fe448_sqr(t, t);
+    fe448_sqr(t, t);
+    fe448_mul(r, t, a);
+}
+
+/* Scalar multiply the field element a by n using the Montgomery Ladder.
+ * Implemented to RFC 7748 - the scalar is used as given.
+ *
+ * r  Resulting x-ordinate, 56 bytes, little-endian.
+ * n  Scalar as an array of bytes.
+ * a  Point to multiply as the x-ordinate, little-endian.
+ * returns 0 on success.
+ */
+int curve448(byte* r, const byte* n, const byte* a)
+{
+    fe448 x1, x2, z2, x3, z3;
+    fe448 t0, t1, t2;
+    int i;
+    unsigned int swap;
+    unsigned int b;
+
+    fe448_from_bytes(x1, a);
+    fe448_1(x2);
+    fe448_0(z2);
+    fe448_copy(x3, x1);
+    fe448_1(z3);
+
+    swap = 0;
+    for (i = 447; i >= 0; --i) {
+        b = (n[i >> 3] >> (i & 7)) & 1;
+        swap ^= b;
+        fe448_cswap(x2, x3, (int)swap);
+        fe448_cswap(z2, z3, (int)swap);
+        swap = b;
+
+        /* A = x2 + z2, B = x2 - z2, C = x3 + z3, D = x3 - z3 */
+        fe448_add(t0, x2, z2);
+        fe448_sub(t1, x2, z2);
+        fe448_add(t2, x3, z3);
+        fe448_sub(z3, x3, z3);
+        /* DA, CB */
+        fe448_mul(x3, z3, t0);
+        fe448_mul(z3, t2, t1);
+        /* AA, BB */
+        fe448_sqr(t0, t0);
+        fe448_sqr(t1, t1);
+        /* x3 = (DA + CB)^2, z3 = x1.(DA - CB)^2 */
+        fe448_add(t2, x3, z3);
+        fe448_sub(z3, x3, z3);
+        fe448_sqr(x3, t2);
+        fe448_sqr(z3, z3);
+        fe448_mul(z3, z3, x1);
+        /* x2 = AA.BB, E = AA - BB, z2 = E.(AA + a24.E) */
+        fe448_mul(x2, t0, t1);
+        fe448_sub(t1, t0, t1);
+        fe448_mul39081(t2, t1);
+        fe448_add(t2, t2, t0);
+        fe448_mul(z2, t1, t2);
+    }
+    fe448_cswap(x2, x3, (int)swap);
+    fe448_cswap(z2, z3, (int)swap);
+
+    fe448_invert(z2, z2);
+    fe448_mul(x2, x2, z2);
+    fe448_to_bytes(r, x2);
+
+    ForceZero(x2, sizeof(x2));
+    ForceZero(z2, sizeof(z2));
+    ForceZero(x3, sizeof(x3));
+    ForceZero(z3, sizeof(z3));
+    ForceZero(t0, sizeof(t0));
+    ForceZero(t1, sizeof(t1));
+
+    return 0;
+}
+
+#endif /* CURVED448_128BIT */
+
+#endif /* HAVE_CURVE448 || HAVE_ED448 */
@@ -28,3 +28,17 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#if defined(HAVE_CURVE25519) || defined(HAVE_ED25519)
+
+#include <wolfssl/wolfcrypt/fe_operations.h>
+
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+
+#if defined(CURVED25519_X64)
+    /* Assembly code in fe_x25519_asm.S */
+#elif defined(CURVED25519_128BIT)
+    #include "fe_x25519_128.i"
+#endif
+
+#endif /* HAVE_CURVE25519 || HAVE_ED25519 */
@@ -30,3 +30,3446 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#ifdef HAVE_ED448
+
+#include <wolfssl/wolfcrypt/ge_448.h>
+#include <wolfssl/wolfcrypt/ed448.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#ifdef NO_INLINE
+    #include <wolfssl/wolfcrypt/misc.h>
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+#endif
+
+/*
+sc448 means scalars modulo the order of the base point,
+  L = 2^446 - 13818066809895115352007386748515426880336692474882178609894547503885.
+Scalars are reduced by repeatedly folding the bits above 2^446 back in,
+multiplied by 2^446 mod L, and then conditionally subtracting L once.
+*/
+
+/* Number of 32-bit words large enough for a 114 byte hash. */
+#define SC448_WORDS     29
+/* Number of 32-bit words in a reduced scalar. */
+#define SC448_RED_WORDS 14
+
+/* 2^446 mod L as 32-bit words, little endian. */
+static const word32 sc448_c[7] = {
+    0x54a7bb0d, 0xdc873d6d, 0x723a70aa, 0xde933d8d,
+    0x5129c96f, 0x3bb124b6, 0x8335dc16
+};
+
+/* The order, L, as 32-bit words, little endian. */
+static const word32 sc448_order[SC448_RED_WORDS] = {
+    0xab5844f3, 0x2378c292, 0x8dc58f55, 0x216cc272,
+    0xaed63690, 0xc44edb49, 0x7cca23e9, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x3fffffff
+};
+
+/* Load a little-endian array of bytes into 32-bit words.
+ *
+ * t    Words to fill - SC448_WORDS in length.
+ * b    Array of bytes.
+ * len  Number of bytes in array.
+ */
+static void sc448_load(word32* t, const byte* b, int len)
+{
+    int i;
+
+    XMEMSET(t, 0, SC448_WORDS * sizeof(word32));
+    for (i = 0; i < len; i++) {
+        t[i >> 2] |= (word32)b[i] << (8 * (i & 3));
+    }
+}
+
+/* Fold the bits at and above 2^446 back into the value.
+ * t = (t mod 2^446) + (t >> 446) * (2^446 mod L)
+ *
+ * t  Value to fold - SC448_WORDS in length.
+ */
+static void sc448_fold(word32* t)
+{
+    word32 hi[15];
+    word32 p[22];
+    word64 c;
+    int i, j;
+
+    for (i = 0; i < 15; i++) {
+        hi[i] = (t[13 + i] >> 30) | (t[14 + i] << 2);
+    }
+    t[13] &= 0x3fffffff;
+    for (i = SC448_RED_WORDS; i < SC448_WORDS; i++) {
+        t[i] = 0;
+    }
+
+    XMEMSET(p, 0, sizeof(p));
+    for (i = 0; i < 15; i++) {
+        c = 0;
+        for (j = 0; j < 7; j++) {
+            c += (word64)hi[i] * sc448_c[j] + p[i + j];
+            p[i + j] = (word32)c;
+            c >>= 32;
+        }
+        p[i + 7] = (word32)c;
+    }
+
+    c = 0;
+    for (i = 0; i < 22; i++) {
+        c += (word64)t[i] + p[i];
+        t[i] = (word32)c;
+        c >>= 32;
+    }
+}
+
+/* Reduce the value and store as a 57 byte scalar in constant time.
+ * The value must be less than 2^446 + 2^446 mod L after folding.
+ *
+ * b  Array to hold 57 byte scalar.
+ * t  Value to reduce - SC448_WORDS in length.
+ */
+static void sc448_store(byte* b, word32* t)
+{
+    word32 d[SC448_RED_WORDS];
+    sword64 s = 0;
+    word32 m;
+    int i;
+
+    /* Enough folds to bring any 912-bit value under 2^446 + 2^446 mod L. */
+    for (i = 0; i < 4; i++) {
+        sc448_fold(t);
+    }
+
+    for (i = 0; i < SC448_RED_WORDS; i++) {
+        s += (sword64)t[i] - sc448_order[i];
+        d[i] = (word32)s;
+        s >>= 32;
+    }
+    /* m is all ones when t is less than L. */
+    m = (word32)s;
+    for (i = 0; i < SC448_RED_WORDS; i++) {
+        t[i] = (t[i] & m) | (d[i] & ~m);
+    }
+
+    for (i = 0; i < 56; i++) {
+        b[i] = (byte)(t[i >> 2] >> (8 * (i & 3)));
+    }
+    b[56] = 0;
+
+    ForceZero(d, sizeof(d));
+}
+
+/* Reduce a 114 byte hash modulo the order.
+ * The result is stored in the first 57 bytes.
+ *
+ * b  [in]  Array of bytes representing value to reduce.
+ *    [out] Reduced value.
+ */
+void sc448_reduce(byte* b)
+{
+    word32 t[SC448_WORDS];
+
+    sc448_load(t, b, 114);
+    sc448_store(b, t);
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Multiply a by b and add d modulo the order. r = (a * b + d) mod L
+ *
+ * r  Array to hold 57 byte result.
+ * a  Scalar to multiply.
+ * b  Scalar to multiply.
+ * d  Scalar to add.
+ */
+void sc448_muladd(byte* r, const byte* a, const byte* b, const byte* d)
+{
+    word32 t[SC448_WORDS];
+    word32 ta[SC448_WORDS];
+    word32 tb[SC448_WORDS];
+    word64 c;
+    int i, j;
+
+    sc448_load(t, d, 56);
+    sc448_load(ta, a, 56);
+    sc448_load(tb, b, 56);
+
+    for (i = 0; i < SC448_RED_WORDS; i++) {
+        c = 0;
+        for (j = 0; j < SC448_RED_WORDS; j++) {
+            c += (word64)ta[i] * tb[j] + t[i + j];
+            t[i + j] = (word32)c;
+            c >>= 32;
+        }
+        for (j = i + SC448_RED_WORDS; j < SC448_WORDS; j++) {
+            c += t[j];
+            t[j] = (word32)c;
+            c >>= 32;
+        }
+    }
+    sc448_store(r, t);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(ta, sizeof(ta));
+    ForceZero(tb, sizeof(tb));
+}
+
+static const ge448_precomp base[56][8] = {
+{
+  {
+    { 0x26a82bc70cc05e, 0x80e18b00938e26, 0xf72ab66511433b, 0xa3d3a46412ae1a,
+      0x0f1767ea6de324, 0x36da9e14657047, 0xed221d15a622bf, 0x4f1970c66bed0d },
+    { 0x08795bf230fa14, 0x132c4ed7c8ad98, 0x1ce67c39c4fdbd, 0x05a0c2d73ad3ff,
+      0xa3984087789c1e, 0xc7624bea73736c, 0x248876203756c9, 0x693f46716eb6bc }
+  },
+  {
+    { 0x55555555555555, 0x55555555555555, 0x55555555555555, 0x55555555555555,
+      0xaaaaaaaaaaaaa9, 0xaaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaa },
+    { 0xeafbcdea9386ed, 0xb2bed1cda06bda, 0x833a2a3098bbbc, 0x8ad8c4b80d6565,
+      0x884dd7b7e36d72, 0xc2b0036ed7a035, 0x8db359d6205086, 0xae05e9634ad704 }
+  },
+  {
+    { 0x28173286ff2f8f, 0xb769465da85757, 0xf7f6271fd6e862, 0x4a3fcfe8daa9cb,
+      0xda82c7e2ba077a, 0x943332241b8b8c, 0x6455bd64316cb6, 0x0865886b9108af },
+    { 0x22ac13588ed6fc, 0x9a68fed02dafb8, 0x1bdb6767f0bffa, 0xec4e1d58bb3a33,
+      0x56c3b9fce43c82, 0xa6449a4a8d9523, 0xf706cbda7ad43a, 0xe005a8dbd5125c }
+  },
+  {
+    { 0xce42ac48ba7f30, 0xe1798949e120e2, 0xf1515dd8ba21ae, 0x70c74cc301b7bd,
+      0x0891c693fda4be, 0x29ea255a09cf4e, 0x2c1419a17226f9, 0x49dcbc5c6c0cce },
+    { 0xe236f86de51839, 0x44285d0d4f5b32, 0x7ea1ca9472b5d4, 0x7b8a5bc1c0d8f9,
+      0x57d845c90dc322, 0x1b979cb7c02f04, 0x27164b33a5de02, 0xd49077e4accde5 }
+  },
+  {
+    { 0xa99d1092030034, 0x2d8cefc6f950d0, 0x7a920c3c96f07b, 0x958812808bc0d5,
+      0x62ada756d761e8, 0x0def80cbcf7285, 0x0e2ba7601eedb5, 0x7a9f9335a48dcb },
+    { 0xb4731472f435eb, 0x5512881f225443, 0xee59d2b33c5840, 0xb698017127d7a4,
+      0xb18fced86551f7, 0x0ade260ca1823a, 0xd3b9109ce4fd58, 0xadfd751a2517ed }
+  },
+  {
+    { 0x7fd7652abef79c, 0x6c20a07443a878, 0x5c1840d12a7109, 0x4a06e4a876451c,
+      0x3bed0b4ad95f65, 0x25d2e673fb0260, 0x2e00349aebd971, 0x54523e04498b72 },
+    { 0xea5d1da07c7bcc, 0xcce776938ea98c, 0x80284e861d2b3e, 0x48de76b6e1ff1b,
+      0x7b121869c58522, 0xbfd053a2765a1a, 0x2d743ec056c667, 0x3f99b9cd8ab61c }
+  },
+  {
+    { 0xdf9567ceb5eaf7, 0x110a6b478ac7d7, 0x2d335014706e0b, 0x0df9c7b0b5a209,
+      0xba4223d568e684, 0xd78af2d8c3719b, 0x77467b9a5291b6, 0x079748e5c89bef },
+    { 0xe20d3fadac377f, 0x34e866972b5c09, 0xd8687a3c40bbb7, 0x7b3946fd2f84c9,
+      0xd00e40ca78f50e, 0xb87594417e7179, 0x9c7373bcb23583, 0x7ddeda3c90fd69 }
+  },
+  {
+    { 0x2538a67153bde0, 0x223aca9406b696, 0xf9080dc1ad713e, 0x6c4cb47d816a64,
+      0xbc285685dc8b97, 0xd97b037c08e2d7, 0x5b63fb45d0e66b, 0xd1f1bc5520e8a3 },
+    { 0x4eb873ce69e09b, 0x1663164bc8ee45, 0x08f7003ba8d89f, 0x4b98ead386ad82,
+      0xa4b93b7bd94c7b, 0x46ba408c6b38b3, 0xdae87d1f3574ff, 0xc7564f4e9bea9b }
+  }
+},
+{
+  {
+    { 0x2e4fdb25bfac1c, 0xf0d79aaf5f3bca, 0xe756b0d20fb7cc, 0xe3696beb39609a,
+      0xa019fc35a5ab58, 0xa2b24853b281dd, 0xe3e2be761ac0a2, 0xf19c34feb56730 },
+    { 0x2d25ce8a30241e, 0xf5661eab73d7a1, 0x4611ed0daac9f4, 0xd5442344ced72c,
+      0xce78f52e92e985, 0x6fe5dd44da4aad, 0xfcaddc61d363ce, 0x3beb69cc9111bf }
+  },
+  {
+    { 0xd2e7660940ebc9, 0xe032018b17bbe0, 0xad4939175c0575, 0xdd0b14721c7f34,
+      0x52c2ba43e147e0, 0x7dd03c60ee8973, 0x5472e8decf2754, 0x17a1cd1d6482bb },
+    { 0xdd43b848128b3f, 0xf0cae34ea7dd25, 0x81ca99fff07df2, 0x1c8959792ebbdc,
+      0x45c7a6872155e6, 0x907a50e39ddd08, 0xbe398c2bb2d89b, 0x38063f91b3b536 }
+  },
+  {
+    { 0x149fafbf843b23, 0x00ab582ac7f22a, 0xa3b981bf2f4d4c, 0x2ce1a654341a22,
+      0x68a40747c03b63, 0x63206a212f2cf8, 0xc9961d35149741, 0xfb85430bc7099e },
+    { 0x9c9107290a9e59, 0x734e94a06de367, 0x5cf3cbedb99214, 0xc6bce3245b1fb9,
+      0x1a82abedd7be0d, 0xf74976aede7d1c, 0x7025b7c21503bd, 0xf7894910d096ab }
+  },
+  {
+    { 0x6bd48bb555a41b, 0xfbdd0d067de206, 0x98bc477dd6dfd1, 0x1d0693b3e40b8a,
+      0x6e15563da32ae4, 0x0194a20fcebaa2, 0xda116150980a93, 0x8e119200109cec },
+    { 0x8ea0552ffb9726, 0xeba50a4047e44b, 0xc050d2460ddf76, 0xe009204ac690e0,
+      0x47b86399b18edc, 0x2f5b76ac77f23f, 0x4296c240792905, 0x73f6b4a06f6dc7 }
+  },
+  {
+    { 0xb6ef9ea3b10cad, 0x312843df7c8fce, 0x5bdcd528bedf86, 0x2889059f6dd823,
+      0x04578e908bfde0, 0x3245df3123e2e5, 0xbf461d57ee9e3a, 0xddec2d46f94ceb },
+    { 0x21b43b9145768f, 0xe79a8f9dae962a, 0xff1972bcbb043f, 0xe3dcf6d239649b,
+      0xed592bdc533b85, 0x14ff94fdbe22d0, 0x6c4eb87f1d8e22, 0xd8d4c71d18cf6d }
+  },
+  {
+    { 0xcda666c8d96345, 0x9ecaa25836cd21, 0x6e885bd984606e, 0x1dd5fef804f054,
+      0x9dfff6b6959ae4, 0x99b9cf8c9b55cc, 0xb4716b062b9b80, 0x13ec87c554b128 },
+    { 0xe696d1f75aacc2, 0xf78c99387fc5ff, 0x76c09473809d42, 0x99ce62db618fa8,
+      0x35e3e022f53341, 0x62fc1ac0db6c5e, 0xa1fb8e600d8b47, 0x0bc107058f0d1e }
+  },
+  {
+    { 0x1f4526916da513, 0x1f2fc04f5cf341, 0xae9208664d23e0, 0x4e33082da8a113,
+      0x2688ec61cfc085, 0x6f2e8de6e5327f, 0x2070db3b4e48a8, 0xd6626973240ade },
+    { 0xa6b317ffbd997b, 0x9fa1b5649e26bd, 0xcbf0d258cba0f3, 0x4a7791b17b4745,
+      0x25f555b5c9e190, 0x7cd3940923ec4c, 0x16f4c6ae98f1b6, 0x7962116bcd4e0f }
+  },
+  {
+    { 0x8d58fa302491e3, 0x7cf76c67ab3898, 0xbc2f657647ebc7, 0x5f4bfe0d25f5a3,
+      0x503f478d69505d, 0x4a889fc3fb6645, 0x33e1bc1fa86b18, 0xabb234f5508dd8 },
+    { 0x5348e1b9a05b48, 0x57ac5f164dc858, 0x21f4d38ec8a2d3, 0x5ec6d3ca3a3e9d,
+      0xcd4062e560a0b8, 0x49b74f73433f59, 0xefd9d87cab14e3, 0x858ce7feb964f5 }
+  }
+},
+{
+  {
+    { 0x7577254eb731b4, 0x9fff1fb4e2397e, 0x749b145c821715, 0x40619fe2e65e67,
+      0x57b82812e618d8, 0x063186c707b83e, 0xcfc80cb31b24a2, 0xcca6185ac75169 },
+    { 0x6539f44b255818, 0x5895da00368bce, 0x841a30917c7482, 0x85469e1b1a9c9e,
+      0x05664c0e4f7d9d, 0x8a063187b35cc0, 0x214763aa0e9b0a, 0x1bd872c4b26ac2 }
+  },
+  {
+    { 0x3578f97a93762b, 0x434f69a72d52bc, 0xddcca4022cb565, 0xa7d1e41ff20544,
+      0x823475d8a66588, 0x9fc97c799d7baf, 0x15542f1660e421, 0xa7d1f60843faf6 },
+    { 0xbbfaab54063ccc, 0x3ad9bada49855a, 0xffd5f1c5bddbfe, 0x0e419c2ae87e59,
+      0xdce6ed6f89956b, 0xf047c21ccd8951, 0x6ed4a1ba83c991, 0x85af86e2d28e0a }
+  },
+  {
+    { 0x04433c49ed48a8, 0xeffa8580bc375d, 0xfb0e1b2fa6e3b5, 0x51483a2a1aadda,
+      0x733448df8b2ea8, 0xaa0513cf639f0c, 0x6bc61a3a23bf84, 0x3e64f68dc2430d },
+    { 0x51bf502c5876b1, 0x6b833751c0dd2a, 0xe597be1342914f, 0x43d5ab0f8e632c,
+      0x2696715d62587b, 0xe87d20aed34f24, 0x25b7e14e18baf7, 0xf5eb753e22e084 }
+  },
+  {
+    { 0x51da71724d8295, 0xd478e4318d1340, 0xacf94f42cf7f66, 0x230d7d13760711,
+      0x078a66a5abc626, 0xd78b0bd6b5f6da, 0x23a971396d1d0b, 0x87623d64bd960f },
+    { 0x0841a9977db53f, 0x23c1a53f4d03ee, 0x2f62c2e1f95df1, 0xd1e2ec1116f4e7,
+      0x896d2fe34811a9, 0xad65e2bec8096e, 0x09d36f9b1744a6, 0x564bac7ff5ddf7 }
+  },
+  {
+    { 0x48b41e2c3f77cb, 0x52276730968938, 0xff1b899fd9b452, 0x67cf3bf2e03908,
+      0x3731d90248a6fb, 0xd800a05256598f, 0x347d2f2bdc8530, 0xc72a3007ad08a1 },
+    { 0x5e5be741d65f73, 0x183d4ae4206ead, 0xcb50c1cade4013, 0x39db43d3102483,
+      0x0eb49fa70d6325, 0xa18f6a2c1f02b9, 0x3e6fe30dbf5e66, 0xac4eeb93a82aa5 }
+  },
+  {
+    { 0x295affd3613d47, 0x7b7e68ab56f343, 0x980629692b173b, 0x937061ebad35fb,
+      0x25019785c21eea, 0xe92721b787a746, 0x463c46c3651631, 0x6da4b5dc6f2d5a },
+    { 0xcb67cc16e6d18c, 0x1b30d520010588, 0x1bb6ea6db1d1e8, 0x9c6308aad11474,
+      0xc3167413d19b1c, 0xf2e84d7be4fb79, 0xeccb873e050f77, 0xf7c8d80cc2bf86 }
+  },
+  {
+    { 0x16fe2e17ab20e5, 0x274deadecf3a92, 0x9f434870972f67, 0x9a65a454605751,
+      0x9351f07b8980b2, 0x412962b0eb08a5, 0xb8c9bfd733f440, 0xac2cd641ca250f },
+    { 0x68cdd0f2ba7d26, 0xd3d2a4a4e0beea, 0x50135c19f4a258, 0xb475e53f0d02e4,
+      0x432d8c6589283a, 0x29141bfa0a2b6c, 0xd7379ec13704bc, 0x831562c52459bf }
+  },
+  {
+    { 0x676b366eeec506, 0xdd6cad545da557, 0x9de39cb77057d2, 0x388c5fedf05bf1,
+      0x6e55650dfb1f03, 0xdbceffa52126c9, 0xe4d187b3a4a220, 0xac914f9eb27020 },
+    { 0x3f4ab98d2e5f30, 0x6ae97dadd94451, 0x64af6950d80981, 0x36b4b90f2aa2ce,
+      0x6adcd7a18fcf59, 0x3ddfe6dc116c81, 0x661072b549b9e3, 0xd9e3134ec4584d }
+  }
+},
+{
+  {
+    { 0x6e46707a1e400c, 0xcdc990b551e806, 0xfa512513a07724, 0x500553f1b3e4f5,
+      0x67e8b58ef4dac3, 0x958349f2cb4cc7, 0x948b4ed7f9143c, 0xe646d092b7822b },
+    { 0xd185dd52bc3c26, 0x34ba16ec837fc9, 0x516d4ba5a788b7, 0x72f2de756142b0,
+      0x5846f61f445b3d, 0xdaec5c9f4631a1, 0xa10b18d169ea9b, 0x85d2998af6751b }
+  },
+  {
+    { 0xda0cac443ddf31, 0x0966e171860911, 0x9c3a7173cba600, 0x5781880571f895,
+      0x5e2a927737ac21, 0x8a461486c253fb, 0xe801cf595ee626, 0x271166a5f84fc0 },
+    { 0x306937fba856bd, 0x80cb179be80a43, 0x70393b2ffb5980, 0xa8e4a1c660fc64,
+      0x5078abfc0d5c98, 0x62ba530fbd31ff, 0xda608449e51b88, 0xdb6ecb0355ae15 }
+  },
+  {
+    { 0xbcbb6ea23c5d49, 0x08906ba87959bc, 0x61cc0880991665, 0x21d6b41d90d13c,
+      0x0c27ac1d03afe9, 0x159995f5cfea52, 0x4057e20bdfe220, 0xdd1b349cbdf058 },
+    { 0x0cd66262e37159, 0x8cea8e43eb0d17, 0x553af085bce7f0, 0xb94cb5f5b6511d,
+      0x7b8d3a550e0330, 0x415911057ab7e7, 0x320820e6aa886f, 0x130d4d6c5b6b81 }
+  },
+  {
+    { 0x2f98059c7bb2ed, 0x33ebf4ca49bdfb, 0x04c72a1b0a675b, 0x94f9ea4adb6c14,
+      0x03376d8cf728c0, 0x5c059d34c6eb6a, 0x0178408eb8da48, 0x8bf607b2956817 },
+    { 0x7ad2822ceb3d28, 0xd07a40337ae653, 0xbc68739c1e46b2, 0x15d7cca9154ba9,
+      0x6b97103a26617d, 0xa610314b2e0d28, 0x52a08bafd4d363, 0x80c2638c7dc2af }
+  },
+  {
+    { 0x0cde7ef3187140, 0x93b92ca4b70acd, 0x5696e507a79cdc, 0x73cc9728eaab66,
+      0x6b8c5b68f1b0c7, 0xb39a3184f7e0b1, 0x72cfb0d376108a, 0x0c53efc98536a7 },
+    { 0x03b52a824c2f1e, 0x717132e6399b78, 0x31ebd25349a85d, 0x265ee811a200d4,
+      0x0b1aad2407d7ad, 0x9a9ebc894d2962, 0x994e6cd41171d9, 0x09178d86c8fa83 }
+  },
+  {
+    { 0x7d1d238a2593a1, 0x863e93ab38fb19, 0xd23a4cce7712a9, 0x7477b1327efcd5,
+      0x3ba69ff1392f6c, 0x63e0c32f7bb5a5, 0x20412c0026effd, 0xd3ee8e4ef424ab },
+    { 0x14c0b2d64e5174, 0x2a611f2e58c47b, 0xaa58a06c1e8635, 0x1870c3ecf17034,
+      0xb0d5e3483f1bf3, 0xb19905c16c7eb3, 0xbf85d626efa4ca, 0xfd16b2f180f92b }
+  },
+  {
+    { 0xc0431af3adcb48, 0xc9a7a8dba90496, 0xd765a163895294, 0xb02a41a551de70,
+      0xb71b261749b8a1, 0x0dfa89ec6f3e47, 0x392c0d80f5d9ce, 0x43c59d831aee3c },
+    { 0x94bfb6d4d76f49, 0xe8f5b8227d68a5, 0x78ae1d9630fd08, 0x1379029ce1bdae,
+      0x9689da066715dc, 0x5d4cb24d3278c7, 0x77c98339e84fbc, 0xc8478dcea1048c }
+  },
+  {
+    { 0xe4b8f31770d2ba, 0x744f65242ea095, 0xd06e090036f138, 0xd3a3d5b3b078ca,
+      0xc7ae54178b8417, 0xad6c5d4c738fd7, 0x61789844676454, 0xfbf34235d9a392 },
+    { 0x8e451a7fff772f, 0x8605bb75ffbead, 0x6f75cc1930d59f, 0xd4f47558f3f460,
+      0xefd2d796700c8a, 0xceb462a2406421, 0x8ed0f979dfe8f1, 0x0280bf1d1d7600 }
+  }
+},
+{
+  {
+    { 0x761c219dd9a54d, 0x1127fcb86a39c0, 0x7d0e4f04c9bedd, 0x27c017a4d976b6,
+      0x800c973da042cf, 0xe7419af2593f11, 0xbd49448ae67960, 0xd3b60b7744fd85 },
+    { 0x5e74ed961676fe, 0x7383ef339af627, 0x34407e05e62df7, 0xb0534618bf3196,
+      0xd6b7184583b407, 0xe3d068555011be, 0x94083d02124b52, 0xa908324f780aaf }
+  },
+  {
+    { 0xb27af1a73ec9c3, 0xb66ad9f70fa725, 0x07724f58cf73e4, 0xc3fcd579949358,
+      0x06efb79da0cc01, 0x1e977d210597c9, 0xcd732be703e8d6, 0x6fd29bf6d0b69e },
+    { 0xca658ac667128e, 0xca0036ac7872b3, 0xc9698585355837, 0x59f3be8075cf1c,
+      0x9f1b9b03809a11, 0x6881ced9733871, 0x8cda0fbe902a5f, 0x4d8c69b4e3871e }
+  },
+  {
+    { 0x5c3bd07ddee82f, 0xe52dd312f9723b, 0xcf8761174f1be8, 0xd9ecbd835f8657,
+      0x4f77393fbfea17, 0xec9579fd78fe2c, 0x320de920fb0450, 0xbfc9b8d95d9c47 },
+    { 0x818bd425e1b4c3, 0x0e0c41c40e2c78, 0x0f7ce9abccb0d0, 0xc7e9fa45ef81fb,
+      0x2561d6f73574ad, 0xa2d8d99d2efb0b, 0xcf8f316e96cd0a, 0x088f0f14964807 }
+  },
+  {
+    { 0x0a8498945d5a19, 0x47ab39c6c2131f, 0x5c02824f3fc35d, 0x3be77c89ee8127,
+      0xa8491b7c90b80a, 0x5397631a28aa93, 0x54d6e816c0b344, 0x22878be876d0e4 },
+    { 0xeecb8a46db3bf6, 0x340f29554577a3, 0xa7798689a00f85, 0x98465d74bb9147,
+      0x9532d7dda3c736, 0x6d574f17504b20, 0x6e356f4d86e435, 0x70c2e8d4533887 }
+  },
+  {
+    { 0xdce5a0ad293980, 0x32d7210069010e, 0x64af59f06deaaa, 0xd6b43c459239e4,
+      0x74bf2559199c29, 0x3efff4111e1e2b, 0x1aa7b5ecb0f8d8, 0x9baa22b989e395 },
+    { 0xf78db807b33ac1, 0x05a3b4354ce80a, 0x371defc7bc8e12, 0x63305a01224610,
+      0x028b1ae6d697ef, 0x7aba39c1cd8051, 0x76ed7a928ee4b4, 0x31bd02a7f99901 }
+  },
+  {
+    { 0xf9dab7af075566, 0x84e29a5f56f18b, 0x3a4c45af64e56d, 0xcf3644a6a7302d,
+      0xfb40808156b658, 0xf33ef9cf96be52, 0xfe92038caa2f08, 0xcfaf2e3b261894 },
+    { 0xf2a0dbc224ce3f, 0xed05009592eb27, 0x501743f95889d0, 0xa88a47877c95c2,
+      0x86755fbdd63da9, 0x9024acfc7ee828, 0x634b020f38113b, 0x3c5aacc6056e64 }
+  },
+  {
+    { 0xe03ff3aa2ef760, 0x3b95767b1c3bac, 0x51ce6aa940d754, 0x7cbac3f47a9a3d,
+      0xa864ac434f8d1a, 0x1eff3f280dbd47, 0xd8ab6607ebd5ca, 0xc4df5c405b07ed },
+    { 0x3dc92dfa4f095b, 0x5ae36a57cdbd9a, 0x7ff29737891e04, 0x37c03130a5fe7b,
+      0x210d7b0aa6e35e, 0x6edfb53bf200d8, 0x787b68d84afb85, 0x9b5c49b72c6de3 }
+  },
+  {
+    { 0x51857164010f4e, 0xe0b144b0536ebe, 0xacabb14887d663, 0xac1caededf584f,
+      0xb43fb8faf175a3, 0x310b6d5f992a3c, 0xf2c4aa285178a4, 0x69c99698bd56bf },
+    { 0x73d6372a4d972e, 0x3d5bb2e9583803, 0x7bf7d18d891581, 0xa5ce5d7568a34a,
+      0x670b4331f45c81, 0x97265a71f96910, 0xdb14eb3b07c1ea, 0xdf008eafed447c }
+  }
+},
+{
+  {
+    { 0x0379f5a00c2f10, 0xb320b4fd350285, 0x74e560e8efdd7d, 0xf2f017ef46a140,
+      0x2ced1a60f34624, 0x7c4b4e3ca08ec9, 0xdffc2a15d8bc6b, 0xcc8f3f3527b007 },
+    { 0x59f8ac4861fe83, 0x8d48d2cd03144c, 0xa8457d2bfa6dce, 0xd7ed333677c136,
+      0xcb8e219c228e18, 0x5f70bc916ab1e4, 0x2ae3a3d3780370, 0x9f3365488f17ad }
+  },
+  {
+    { 0xeab0710960e4bb, 0xc668a78ab9cfd3, 0x2e85553b0ef946, 0xa43c4b98df5df3,
+      0x0ecd5593cb3646, 0x6f543c418dbe71, 0xee7edaaf59818b, 0xc44e8d290911c1 },
+    { 0xafb38b1269b509, 0x9e2737c52afe2c, 0x5b2ef02ccfa664, 0x1e0aeace1cc58b,
+      0x37a57e95ea134e, 0xc9c465a83b9fc2, 0x4b9e8c76e3ecca, 0xca07dbe9bdbab5 }
+  },
+  {
+    { 0xd297f3cb0d7807, 0xee441a5f59ce61, 0x728553bb2db844, 0x90f87e5640e9e0,
+      0xaa72cbfcb76dff, 0x065c6864012d57, 0xd5ee88f9678b44, 0x3d74b852177603 },
+    { 0x3f9c947748b68e, 0x03856d98f44d44, 0xde34b84462426c, 0xc16d1bb845ab29,
+      0x9df6217d2e18de, 0xec6d219b154643, 0x22a8ec32ee0f8f, 0x632ad3891c5175 }
+  },
+  {
+    { 0x19d9d236869267, 0x628df94fe5532a, 0x458d76c6dc9a01, 0x405fe6c2cc39c8,
+      0x7dddc67f3a04ba, 0xfee630312500c7, 0x580b6f0a50e9de, 0xfb5918a6090604 },
+    { 0xd7159253af6b2d, 0x83d62d61c7d1ec, 0x94398c185858c4, 0x94643dc14bfb64,
+      0x758fa38af7db80, 0xe2d7d93a8a1557, 0xa569e853562af1, 0xd226bdd84346aa }
+  },
+  {
+    { 0xc2d0a5ed0ccd20, 0xeb9adb85dbc0cf, 0xe0a29ee26d7e88, 0x8bb39f884a8e98,
+      0x511f1c137396ea, 0xbc9ec5ac8b2fb3, 0x299d81c090e5bc, 0xe1dfe344cdd587 },
+    { 0x80f61f45e465b7, 0x5699c531bad59e, 0x85e92e4b79ff92, 0x1e64fce9db244c,
+      0x3748574a22097d, 0xe2aa6b9efff24e, 0xb951be70a10bc6, 0x66853269067a1c }
+  },
+  {
+    { 0xf716ddfa6114d3, 0x9e515f5037ec1f, 0x773454144944a6, 0x1540c4caba97cc,
+      0xe41e5488b54bb7, 0x4363156cae37bc, 0xc384eaff3d2ce8, 0x72a4f454c58ba4 },
+    { 0x0ceb530dcaf3fc, 0x72d536578dcdbb, 0x9b44084c6320fa, 0x6262d34eb74c70,
+      0x8abac85608e6dc, 0x82a526410dd38d, 0xbc39911a819b8d, 0xbda15fe03ad0d9 }
+  },
+  {
+    { 0xadbf587f9dc60b, 0xf9d814f7d846d2, 0xccdd241b77bde0, 0x89cb6d72242f50,
+      0x95c0e3ee6360a8, 0x7c7dd5adf49713, 0x68e0e4957d5814, 0x3aa097d0c16571 },
+    { 0xb56b672267d03a, 0x4f557088c44af4, 0x67c49e7f3252a5, 0x871d6cfc94a469,
+      0x57ae99801fbfaa, 0x5c0e48f48a5d8e, 0xe9bf9c85e240b9, 0xa41018999d41ca }
+  },
+  {
+    { 0x6beb0c7b2889b4, 0x78b7f899455370, 0xd43421447ca364, 0xdd9d2da9f21e5b,
+      0xa0c7c180a7e4aa, 0x022c0d4da1660c, 0xe1f5c165a57002, 0x51c7c9e518f68f },
+    { 0x6d521b62586502, 0xa0f2cb3183ec1b, 0x578b4e0caa5e16, 0x7bd4fbd764997f,
+      0x7ec56c364b1804, 0xb75a2540ee08e4, 0x6bf74a6dc19080, 0x6ec793d97d6e59 }
+  }
+},
+{
+  {
+    { 0x16789d60a4beb9, 0x512b2cd9b9c801, 0xf8b6d108c7bb9c, 0xd85651e9ebdc8c,
+      0xc9450829ba971a, 0x852d9ea7e1cf78, 0x6a45e350af01e2, 0xe6cdadf6151dcf },
+    { 0xc454bb42b8c01b, 0x59e0c493d54cd2, 0x8e1e686454d608, 0x0dbae4bd8c6103,
+      0xa5603a16c18b18, 0x227a6b23369093, 0xf1e89295f3de1c, 0x42f0b588ab63c5 }
+  },
+  {
+    { 0xf1974cc5b596d8, 0xee8093f44719f0, 0x40ba933f6f5b54, 0xd6e53652f3d654,
+      0x9aeb83526d73b8, 0x50ed5350776382, 0x3be47d6ad43875, 0x21d56dfc786e48 },
+    { 0x8a75e18b73bb39, 0x9eba84cf265a78, 0x7c02a4d2e772e7, 0xf7df6d44c1ecd2,
+      0xa8d9ea06cef71b, 0x86e8f91cae3b68, 0x2fd141199efefa, 0x0b36ab2214e6f6 }
+  },
+  {
+    { 0xd79065cbdce61c, 0xcb562ffdecb229, 0xef5d3d14600849, 0x348b31b1d23ac8,
+      0xb2ea69915c36b8, 0x268683d4822836, 0x083edbec6f0b7d, 0xaf4f39d1a7821c },
+    { 0x23be6e84e64841, 0xe9e246365bf791, 0xa3208ac02bfd7c, 0x231989cd01357d,
+      0x79b8aad6422ab4, 0x57d2b7e91b8564, 0x28ebbcc8c04421, 0xdc787d87d09c05 }
+  },
+  {
+    { 0xeb99f626c7bed5, 0x326b15f39cd0e8, 0xd9d53dcd860615, 0xdf636e71bf4205,
+      0x1eaa0bf0752209, 0x17ce69a4744abb, 0x474572df3ea2fb, 0xc4f6f73224a7f3 },
+    { 0x7ed86ad63081b4, 0xcd4cdc74a20afb, 0x7563831b301b2e, 0x5b4d2b1e038699,
+      0xa15d1fa802a15f, 0x6687aaf13e9172, 0x3eccd36ba6da90, 0x34e829d7474e83 }
+  },
+  {
+    { 0x4cea19b19c9b27, 0xa14c37a5f52523, 0x248b16d726625c, 0x8c40f9f6cabc21,
+      0x918470c32a5c65, 0x314056b2a98d5b, 0x6c974cf34a0714, 0x0c8f8a94f6314a },
+    { 0x484455770bccfd, 0xf5835db740c9fd, 0x12e59b5a21407c, 0xbe338e0db1689d,
+      0x5a50ce9dd5e915, 0xb1780e9ef99f39, 0x1262b55ee4d833, 0x4be3f2289c5340 }
+  },
+  {
+    { 0xbb99b906c4b858, 0xa7724d1550ca53, 0x7d31f5a826962e, 0xf239322a5804da,
+      0x3e113200275048, 0xcbb1bb83ee4cb6, 0xdb865251331191, 0xb7caf9e7d1d903 },
+    { 0x06e3b0577d7a9d, 0x7a132b0b3bbbf5, 0xd61fbc57c50575, 0x393f712af4b646,
+      0xef77972cb7efe9, 0x20e6d5d5ea4995, 0x0ac23d4fbbe4c6, 0x8456617c807f2a }
+  },
+  {
+    { 0x4995fb35396143, 0xa8b4bd1b99dc46, 0x2293e8e4150064, 0x2f77d4922a3545,
+      0xe866b03b2192c4, 0x58b01f05e0aa38, 0xe406b232ed246b, 0x447edb3ed60974 },
+    { 0xf541b338869703, 0x6959fe0383420a, 0xd6b39db4be4e48, 0x048f3b4b5714ef,
+      0x68b49685d9e4b8, 0xbda8e6c2177963, 0x5094e35c4211fe, 0xea591c32d46d1a }
+  },
+  {
+    { 0x3a768ff2fef780, 0x4218d2832970c6, 0xce598e4ec6da17, 0xf675645fbb126a,
+      0xb04c23f0427617, 0xc9f93fbe4fce74, 0x44a414b3c91b00, 0x4d982f31d3b3cc },
+    { 0xb1d40e8b24cce0, 0x5a21c07133e73d, 0x6e9358e0bb589d, 0x39cfb172399844,
+      0x83f7647166080e, 0xcfe7bf8450b468, 0x2a288f71e8434f, 0xd39f1e521a81e3 }
+  }
+},
+{
+  {
+    { 0x78c6f13528af6f, 0x0001fe294b74d9, 0xae7742501aab44, 0x7cbe937ef0039c,
+      0xaf3e4f00fa2a67, 0xe28175fda1378e, 0x72adeed8ccd90e, 0x16a8ce100af22f },
+    { 0x69fae17cbf63dd, 0x67861729e39e26, 0xe92b3d5f827a18, 0x4d75e418403682,
+      0x01a4fd99056a79, 0x89efb2d20008f5, 0xa2f6918b78ff15, 0xf41c870a3437f5 }
+  },
+  {
+    { 0xc840ae57be353c, 0x465a5eb3fb2691, 0x34a89f07eba833, 0xf620896013346e,
+      0x563b5f0e875df2, 0x5f7fc8bfbc44ce, 0x22fcb5acfedf9d, 0x7cf68d47dc691b },
+    { 0x37f7c2d76a103f, 0x728a128fd87b7d, 0x7db2ad8ccf2132, 0xa4c13feb100e63,
+      0xcd28a517b511d5, 0xb910280721ca5c, 0xec1305fd84bd52, 0xb9646422729791 }
+  },
+  {
+    { 0x83fccdf5bc7462, 0x01f3ddad6f012f, 0x57f11713a6a87c, 0xedb47ceff403ac,
+      0x6c184e5baab073, 0x5b17c7d6f0d6a1, 0x45a4c4f3ef2c91, 0x26c3f7e86a8f41 },
+    { 0x81a6db0b646514, 0xf84059fca8b9ae, 0xd73dab69f02305, 0x0de3faec4b7c6c,
+      0x18abb88696df2f, 0x45dd1b975d7740, 0x3aeccc69ee35bc, 0x478252eb029f88 }
+  },
+  {
+    { 0x66bf85b8b2ce15, 0x1175425335709d, 0x00169ef8123874, 0xfd3c18c9b89868,
+      0xb3612f9775204e, 0x4b8d09dc2cd510, 0xafa12e614559ad, 0x1ddaa889657493 },
+    { 0x87d700b1e77a08, 0xaf4cf2f14d2e71, 0xe00835dbf90c94, 0xb16a6ec6dc8429,
+      0x02a7210f8a4d92, 0x5a5ab403d0c48d, 0x0052b3ab5b9bea, 0x6242739e138f89 }
+  },
+  {
+    { 0x7c215d316b2819, 0xdacb65efeb9d7a, 0xc3c569ed833423, 0xbc08435886a058,
+      0x132c4db7e5cb61, 0x6373a279422aff, 0x43b9d7efca9fc4, 0xe3319a5dbe465f },
+    { 0x51d36870b39da7, 0xcb6d7984b75492, 0x77eb272eadd87a, 0xf2fb47de0d3f6c,
+      0x807fd86f9f791c, 0xf01086b975e885, 0xf9314b5b6a3604, 0x8cd453867be852 }
+  },
+  {
+    { 0x7c1e6b3858f79b, 0xf0477c4938caf9, 0xb311bbf3e88c44, 0x9234c091e3a3c1,
+      0x531af2b95a1d4d, 0xf3cc969b8d1c64, 0x6f3c328b51e78d, 0x5a1bd6c34e8881 },
+    { 0x2e312393a9336f, 0x020f0cc5ced897, 0x4b45d7b5fab121, 0x8068b1c1841210,
+      0x1bd85fc8349170, 0xfe816d80f97fe5, 0x108981814b84fc, 0x1d4fabbb93cd48 }
+  },
+  {
+    { 0x1f11d45aef599e, 0x8d91243b09c58a, 0xd2eec7bd08c3c3, 0x5a6039b3b02793,
+      0xb27fed58fb2c00, 0xb5de44de8acf5e, 0x2c3e0cd6e6c698, 0x2f96ed4777180d },
+    { 0x67de8bf96d0e36, 0xd36a2b6c9b6d65, 0x8df5d37637d59c, 0x951899fc8d9878,
+      0x0fa090db13fcf8, 0xa5270811f5c7b4, 0x56a6560513a37a, 0xc6f553014dc1fe }
+  },
+  {
+    { 0x7f6def794945d6, 0x2f52fe38cc8832, 0x0228ad9a812ff5, 0xcd282e5bb8478a,
+      0xa0bc9afbe91b07, 0x0360cdc11165e2, 0xb5240fd7b857e4, 0x67f1665fa36b08 },
+    { 0x84ce588ad2c93f, 0x94db722e8ff4c0, 0xad2edbb489c8a3, 0x6b2d5b87e5f278,
+      0x0265e58d1d0798, 0xd2c9f264c5589e, 0xde81f094e4074d, 0xc539595303089f }
+  }
+},
+{
+  {
+    { 0x183492f83e882c, 0x4d58203b5e6c12, 0x1ac96c3efec20b, 0xabd5a5be1cd15e,
+      0x7e1e242cbbb14b, 0x9f03f45d0543b3, 0xc94bc47d678158, 0x7917be0a446cad },
+    { 0x53f2be29b37394, 0x0cb0a6c064cc76, 0x3a857bcfba3da3, 0xac86bc580fcb49,
+      0x9d5336e30ab146, 0xafb093d5bc1270, 0x996689de5c3b6e, 0x55189faea076ba }
+  },
+  {
+    { 0x99ef986646ce03, 0xa155f8130e6100, 0x75bef1729b6b07, 0xc46f08e1de077b,
+      0xf52fdc57ed0526, 0xe09d98961a299a, 0x95273297b8e93a, 0x11255b50acd185 },
+    { 0x57919db4a6acdd, 0x708a5784451d74, 0x5b0bd01283f7b3, 0xe82f40cc3d9260,
+      0x2ab96ec82bbdc2, 0x921f680c164d87, 0xf0f7883c17a6a9, 0xc366478382a001 }
+  },
+  {
+    { 0x5c9aa072e40791, 0xf0b72d6a0776bf, 0x445f9b2eaa50dc, 0xa929fa96bda47f,
+      0x539dc713bbfc49, 0x4f16dd0006a78b, 0x331ba3deef39c7, 0xbfa0a24c34157c },
+    { 0x0220beb6a3b482, 0x3164d4d6c43885, 0xa03bb5dacdea23, 0xd6b8b5a9d8f450,
+      0xd218e65bd208fe, 0x43948ed35c476f, 0x29a0dd80a2ed2b, 0xa6ccf3325295b7 }
+  },
+  {
+    { 0xf68f15fac38939, 0xb3dd5a2f8010c1, 0xf7ac290a35f141, 0xdc8f3b27388574,
+      0x7ec3de1e95fed2, 0xc625451257ac7d, 0x66fc33e664e55a, 0xd3968d34832ba5 },
+    { 0x980291bc026448, 0xfcb212524da4a5, 0xbca7df4827a360, 0xfcc395c85ca63b,
+      0xcf566ec8e9f733, 0x835ee9bd465f70, 0xe66d111372f916, 0xc066cf904d9211 }
+  },
+  {
+    { 0xb9763a38b48818, 0xa6d23cc4288f96, 0xe27fcf5ed3a229, 0x6aebf9cabaff00,
+      0xf3375038131cd1, 0x13ad41dffabd58, 0x1bee6af861c83b, 0x274fe969c142e7 },
+    { 0x70ebcc99b84b5b, 0xe1a57d78191cfc, 0x46ccd06cbf00b8, 0xc233e8eefe402d,
+      0xb4ab215beebeb3, 0xb7424eabd14e7b, 0x351259aa679578, 0x6d6d01e471d684 }
+  },
+  {
+    { 0x755c465815ae38, 0xadc3e85611db56, 0x633999b188dd50, 0xfdf7509c12d907,
+      0x25bcfde238b6af, 0x50d705d397f5e7, 0xb65f60b944c974, 0x8867fc327ac325 },
+    { 0x2edc4413763eff, 0x892c0b3341fb63, 0xb34b83ab3a7f28, 0x9aa106d15c2f18,
+      0x720bbc61bb2277, 0x637f72a5cfaefd, 0xf57db6ef43e565, 0xceb7c67b58e772 }
+  },
+  {
+    { 0x2793da56ecc1de, 0x4e1097438f31b2, 0x4229b4f8781267, 0xe5d2272dec04a1,
+      0x6abb463ec17cff, 0x28aaa7e0cbb048, 0x41dc081d22ef85, 0xcbc361e5e63d0f },
+    { 0xb78aafcad5dbaa, 0x0111505fc1edc3, 0x63ed66d92c7bfa, 0x2982284e468919,
+      0x30f1f21b8c0d8c, 0xf0567472685093, 0x0e085b6f03dd0f, 0xa8c8db85581e66 }
+  },
+  {
+    { 0x42009a6264ad0c, 0x13bf2b8593bef4, 0x1d111905d4e8b1, 0xfe3e940ef7bddc,
+      0xa012275624e62c, 0xcb659241d6d3cc, 0xc7bcc70edb7ab6, 0xff9fafbb750b1c },
+    { 0xf65df297fea84b, 0x17c84a890b0e02, 0xa92a859301e821, 0xbee8cb2fb480d1,
+      0x7010b8c59c604e, 0x47bf3f4e803c43, 0xd64514247b3fff, 0xc4c5dcb9f0da13 }
+  }
+},
+{
+  {
+    { 0x8af700cb5253b3, 0x31ca605206957a, 0x25744393eafdcd, 0x2ba5ae1d3ae15e,
+      0x710b7385b82579, 0x145ab57112b95a, 0x4b133a038c55c5, 0xf7559c92a16fef },
+    { 0x70c3e68d9ba896, 0x475dd32c33d07a, 0xe084e473a41e40, 0xddc9382fd2e706,
+      0x34b727579510bd, 0x5e78a69a5f901e, 0x429dfd7dcfb823, 0x1d9dc18014f0a3 }
+  },
+  {
+    { 0x364fcdfaf403d7, 0xd9ea4ffb7d7b34, 0x21a3426cbb1dac, 0xfa51052143b4f5,
+      0x2bca0736df2409, 0x7e6985a8ad7285, 0x3a1a9d04aaa27f, 0x1a815e19fc0c6c },
+    { 0xfab6147bb65bb3, 0xa36dc0d33ced0b, 0x26a88592062d78, 0x343861728a5fb7,
+      0xe82da254ebb1ad, 0x70f5071d05aa11, 0x0b7f847adaac48, 0xeb812bc93cb269 }
+  },
+  {
+    { 0xcb317ccf7caccc, 0xd3410d9cf85098, 0xca68c8d7f078d7, 0xfe9e812b782efc,
+      0x32e7c0f5f544b5, 0x44fe95a3a7b7f2, 0xf4f1543e91327b, 0x27d118d76645ed },
+    { 0x690547cd7abc2c, 0xf64680fb53c8af, 0xbe0cbe079ea989, 0x6cf0ccea91af28,
+      0xa3b85a29daa2f9, 0xd4b663c91faed0, 0x782c7b7a8b20ba, 0xf494fafb8d98ce }
+  },
+  {
+    { 0x080c0d7002f55a, 0xf4f8f142d6d9dd, 0xb326229382f025, 0x58fd0b5ad28c20,
+      0x704b9928d06a15, 0xf4545d97fbd8e4, 0xc32fa63ed55581, 0x3ab793601ac0fd },
+    { 0x13ece526099fd1, 0x776dba89c79178, 0x8d28212ce26c45, 0x09fddaf60d739c,
+      0xf9931eda84826e, 0x6e73d90b29439e, 0x94cfefc9095e61, 0x3050d16802f474 }
+  },
+  {
+    { 0x0898f8f9f6394b, 0x48b8cea88b0e91, 0x4bc99254c1b362, 0xe3fccb4827d9ec,
+      0x5d4cf9ad950d6a, 0xa16f1ef39b5b38, 0x3c76d1d620f288, 0x9fdd059e119390 },
+    { 0x7b5de9efb5edf8, 0x3e290b9769d14e, 0x4df3a916bd10b5, 0xae99bca82f8f7b,
+      0x5481d5dc9524af, 0xf112e4f69504f1, 0xb048f0951931ec, 0xbff876a18f51b1 }
+  },
+  {
+    { 0x932e2a746c1c37, 0x903ad529aea4c1, 0x717ac918f161f2, 0xa57d197f425e2a,
+      0xae89dac7f39e0e, 0x91655c0baa2a58, 0xe3dc28654836dd, 0xb5f0baaa9ec9e6 },
+    { 0xf7c4662bdbda04, 0xbe5393b51059c0, 0xb16d552dd95b0f, 0xde495b31b3bd96,
+      0xb2a6e02c0206c5, 0x045cc09014d3a9, 0xf66a3152a2f490, 0x208c108c5dea05 }
+  },
+  {
+    { 0x6e38b6865237ea, 0x93a13039f27fc6, 0x9a6d510a95068a, 0x6fbf216e7c9e54,
+      0x7824290571ac1d, 0x8cb23ba91c2a0c, 0x611202ec7e434d, 0x8f901bf76058b4 },
+    { 0xef0ac050849588, 0xe0d2ddedd31804, 0xaf5417ceb2ca81, 0x420ac065d1a509,
+      0x46e345e9683bb6, 0x6daf635f613f7f, 0xc9e829148a9576, 0x5f9f1d1176d147 }
+  },
+  {
+    { 0xd24ae1d77e9709, 0x77751dc0047b8a, 0xe325334c6a1593, 0x9baf962671f86a,
+      0x425af6ac29a15e, 0x31086002796e33, 0xb6ea78cfc253a5, 0x4c733e0afae0ea },
+    { 0x4b7443a97c99b9, 0xc14e9e450203a6, 0xd1bb51552680ba, 0xa56a3efd55533a,
+      0xa66e38c169e1a0, 0xb3e4df9eed7da0, 0x022c937ddce3d9, 0x8552089f6e36b4 }
+  }
+},
+{
+  {
+    { 0x8e4bf95f5cc82e, 0x2ad80c3c3ed6c9, 0xf2e5b2cc9045e1, 0x42c906559b06d4,
+      0xc1f73797b43b84, 0x1710dbf72d7992, 0xe98cf47767b41c, 0xe713fce7bfb9e9 },
+    { 0x9f54ae99fa5134, 0x3002fd8de40d0e, 0xdc282b79311334, 0x5519810bfeb360,
+      0x31539c70f96ffe, 0x04eacc0d27777b, 0x59824108ff5053, 0x598236632b67ad }
+  },
+  {
+    { 0x6eb45546bea5c2, 0x82cfae0d509a33, 0x6a69bd8394bb59, 0x1880d8d5770ee1,
+      0x63518447dacf9e, 0x5b1ecc5f02b891, 0xeb7d900b6c9a5a, 0xdab8a768897da8 },
+    { 0x28c7be598851a6, 0x0101d4f4d73c3b, 0x3c2569c5084996, 0xb9bc911280bde0,
+      0x513a22acd0d4f9, 0xdf2986d2a15f3b, 0x231c28f2aa4943, 0x29623ad0333870 }
+  },
+  {
+    { 0x2ceb1784084416, 0x924cf1c49516cd, 0x76536c04be856f, 0x11b59cd47a265b,
+      0x720dc844999494, 0x910f794007b795, 0x8434e142d3df83, 0x8f53878bd478d3 },
+    { 0xd9b072eaeb9c2f, 0x16f87eafd8a29f, 0x8c42f9b2fd0de1, 0x916721e0e816ef,
+      0x2ecb47018bde37, 0xcde3b7a2375da2, 0x30d0657ef94281, 0x51054565cd7af8 }
+  },
+  {
+    { 0x7230b334bdced3, 0x0c6a3e10838569, 0xf19c9ece3493b8, 0xf2759270d97c57,
+      0xf14181e0c862eb, 0xfd3bac132c72bc, 0x620563ff3be362, 0x672ccaf47283b7 },
+    { 0x191e3fa2b7bf16, 0xf838633520dad7, 0xd3dde553629d87, 0x14d8836af86ebe,
+      0x3db7dfb221b2ce, 0x3872abb0aed72a, 0xb60de528c665b7, 0x89c259644982cb }
+  },
+  {
+    { 0x799a2de4dbba25, 0xd818aaea42715e, 0xbc88f4df55c362, 0x142a163713c9ae,
+      0x411e8eefbfb33f, 0x34b46296bb684a, 0x4344becdc81817, 0xcc9573d17f9d46 },
+    { 0xf85f8bcff38a7d, 0xa14bf730caf117, 0x126874f4ba6429, 0xcc9bf22aa5db97,
+      0x62b56df6aba827, 0xfee1cb89c9772a, 0xe36838f177e541, 0x698815dadd438f }
+  },
+  {
+    { 0xc9fd89438ed1ad, 0x73cd79d7b6a601, 0x2210e6205e8d20, 0x72384ac3592af5,
+      0x5ccc079763d07e, 0x2f31a4aa5f79eb, 0x693f4ed2945a95, 0xc7120178056fdc },
+    { 0x361ecd2df4b09a, 0xa5644eab7d929a, 0x34abc0b3fabe9a, 0x1a2473ce942a8c,
+      0xe00c9246454bc3, 0xab324bcdff7366, 0xe1412f121b8f99, 0x970b572e33551e }
+  },
+  {
+    { 0x6ca4cacbd0a6b5, 0x5584787921d654, 0x18e5253c809bda, 0x01b32c3f0cbe5e,
+      0xb9aa7540f987dd, 0x628f4bb6dfa4db, 0x0255f0b891890b, 0x25b7df4874e590 },
+    { 0xbded3188ed5f95, 0x9dc428dca93023, 0xc68f25abccf520, 0xc4f3764e616e6c,
+      0xd9a57f1a1d9993, 0xd1964a5533431b, 0x06cd77f02ab6d0, 0xa66079103e52e0 }
+  },
+  {
+    { 0xab088645f72700, 0xf77b2ff0a1a44e, 0x43ebdd8c2a24b5, 0xa6d67114f564d7,
+      0x495df63f414160, 0xf5bacd776f6de6, 0x3011aff7c2b43d, 0xbb1e64c3241928 },
+    { 0xf70c5725034073, 0x891c62a68f1e97, 0xed8eb2eb22e374, 0xd3a53e97dbcc2f,
+      0x1d06281dc8f220, 0x9eef48face4393, 0x96014f5d2abecd, 0x1da7e092653ceb }
+  }
+},
+{
+  {
+    { 0x7593318d00bc94, 0x586f3c6c7262a2, 0xea68f52958ad31, 0x6707fccd4e8bed,
+      0xb7e35d6cb3f9ce, 0x2cbb6f7f4b1be8, 0xa5352687b41aee, 0x1d77845f7b39b8 },
+    { 0xb1f3995eaf9554, 0x3250f70fe9e7d4, 0x62e5d1ba00c23c, 0x5e422f5c10e3bf,
+      0x7a18039c25cec4, 0xb4e66a17cc4d5b, 0xad7c5f636d0e0c, 0x9f40b12a4cf347 }
+  },
+  {
+    { 0x697f88251e3696, 0xc89bc40ab0a648, 0x8f261a59785804, 0x4c7f900b51a2bd,
+      0xd00e7af8a2dfcf, 0xf9c534db642aeb, 0xea2a79fb63df0e, 0x392a69af2f64a4 },
+    { 0x0c0f01cc331b6c, 0x414bf2e6a5edb5, 0xfe5ed815068391, 0x0a8078d62fbc34,
+      0x78a438254bca98, 0xf7a49ae3d727c7, 0x96c1de1ab4dffe, 0x45901f73b9440a }
+  },
+  {
+    { 0x3f1189facfe46e, 0xdca6f464467443, 0xac385422eb5bcf, 0xb02dce9906bf72,
+      0xdd8cdacfe1d454, 0xc26f04c65f7218, 0xb4748596ea145d, 0xc53dc6b5bdb315 },
+    { 0xbe5be749ad7197, 0x627e91918b5ecc, 0x57c889c9ea405d, 0x2e5650c1a5360b,
+      0x42290df1b30b27, 0x4a071575242687, 0x553ed1fd379133, 0xb9d7a0701db019 }
+  },
+  {
+    { 0xcfe551c56597dc, 0x81af92a925ebd6, 0x83efe16f4e8d57, 0x61bb4311f640d3,
+      0xf80440f78b414a, 0x72f3c636c9e3b4, 0xb55f43a6a03c66, 0x47a9dede417037 },
+    { 0x1a7e287dbb612b, 0x895c3c7dbb9220, 0xd50c86e6c04764, 0xed5269853cf7ca,
+      0xc78d799f74af55, 0xb2ba0f2b969ff2, 0x06d48151c6530b, 0x764a1fe165a575 }
+  },
+  {
+    { 0x4383a3bc1b5ece, 0x0563c8854ff148, 0x9a452795af796e, 0xffba7c088e9953,
+      0xfe9fb5eb6a3001, 0x795098825b6b19, 0x67c899ad81be5e, 0xc89ac8d2f9d29b },
+    { 0x7c76ba329ab8f7, 0xb2a18c96e40f74, 0x1b5056e3864d9b, 0xdfa503d9b582b8,
+      0xfb035197c9c68e, 0xdc501316b3c22b, 0x38ab231a6c96ff, 0x4ea527c8cb1c10 }
+  },
+  {
+    { 0xd632f20c05b4ed, 0xe0199fab2a032d, 0x373295626812d7, 0x2aed855013df13,
+      0x92ca24b39f96ac, 0x620273dbb9751a, 0x5d0d21ef7437a1, 0x9de2a43077de56 },
+    { 0x0569b1211a4674, 0xfc3923e89c3989, 0x3d127042c5c770, 0x0072b9084e8c37,
+      0x7178d4dac39f9a, 0x5f8292f778d345, 0x9e5bf0f77c7307, 0x7691610c3a20f5 }
+  },
+  {
+    { 0x7c4ead5705fe96, 0x377ec35c8e464c, 0x3e5b9907689954, 0xc0f6949a2d31ea,
+      0x839d395c580671, 0x2f347a6b215b09, 0xfdcfa33683df83, 0x6e12cc26af39a8 },
+    { 0xae46ec813a3bd2, 0x03a7d3b59366f8, 0xe2029d5b87aed4, 0xbdc4e43fe1b83d,
+      0x768437cdb8a1a8, 0xe47acc3ea0dd7f, 0x550e0cc62a0af4, 0xcaf2cbc1a20962 }
+  },
+  {
+    { 0x5a784f7f28a78f, 0x952a9b507e9724, 0x8ac5e411bab7a3, 0x1251e3fb7bc1e1,
+      0xe360f82dc15e22, 0x3ac72da95213f5, 0x65ee9ba4dcd47b, 0xdfeab7b3af5952 },
+    { 0x34c5c8026fd3c6, 0xd977b08f3ac7ee, 0x003bd017dba2f6, 0xcfc5cf8ac98c8d,
+      0x05eb6040e46922, 0xc248b17faa9352, 0xfa41c0f395c7a7, 0x29931d4b71ee44 }
+  }
+},
+{
+  {
+    { 0xac087bb07861c5, 0x3bd37db5ae8240, 0x94c68ecf94518f, 0xd32a378ff88a5b,
+      0x42c8aaf9b441d1, 0x089db70fc07f12, 0x211c386d3d4455, 0x1db9af7546b158 },
+    { 0xdfd1b6551bc927, 0x69c04930733df4, 0xdc72cd42aeb586, 0xeebdace823aa13,
+      0x51b3b3c56ad643, 0xb983a99d4e0426, 0xa1e5b6c69c4ecc, 0x37cd38245e6668 }
+  },
+  {
+    { 0x158ce6d9f73aea, 0x36a774914ff475, 0x0d4e424dc0b018, 0xc2c44483946f09,
+      0x7a7de3ffacda62, 0x49a19e6b486709, 0x65094d8db61da7, 0x09edfd98f5ee87 },
+    { 0xe460fcfb37226d, 0x3b9d03969bf470, 0x3d4d511247ca22, 0xc7248d6c782cb1,
+      0x91189a000ad293, 0x1244942e8abe75, 0x9f88d12bf52cdb, 0x368463ebbbcadf }
+  },
+  {
+    { 0x419e4b38074f45, 0xd3f8e2e0771c83, 0xd2743b42e68d34, 0xc68b7dbb116a00,
+      0xfad2cf7d84cc37, 0xcfd27c0b7a0f4d, 0x3b9e23f190e587, 0x7bab499751ca9e },
+    { 0x3270861a8f12ee, 0xee1f38d31b36d5, 0x748bb31e4c0eed, 0x9be5c9b110ebad,
+      0x728660bc8b6cb6, 0x7bc9df793d914a, 0x73a4f2cc88c859, 0xbe4a2fdb4e7f0e }
+  },
+  {
+    { 0xe566ff8a450e77, 0xb0b40066a13aba, 0x483a510cd7dc90, 0xb1a20135fa9ccc,
+      0xeb0b631a80e67c, 0x7c34e1f020801a, 0x0257dc8f4e447c, 0x7abe7d174c6f0f },
+    { 0xf115a3ab19a576, 0x8f0474a064ca0e, 0x999bb6b351f99b, 0x855254b773edc3,
+      0x49f6c2f427d717, 0x9f682532e0cef2, 0x1fe126c2ee34f5, 0x1ec2cae80150f7 }
+  },
+  {
+    { 0x862c5afc005b7a, 0x61adea7ec4ef17, 0xf885fd3007b446, 0x25c129d9b0e30e,
+      0xbc10f25feec7e0, 0x3901ac4df79ee1, 0xad49db7fe9e19f, 0xc8624d9360d050 },
+    { 0xc74a576bf3260b, 0xbde80248c010c2, 0xf15532909b6977, 0x6a5a82ed52dcf8,
+      0x4fbf59d29b9dfc, 0x337d049c7b730c, 0xb3deac63a89cd4, 0x1e07595ad2f2eb }
+  },
+  {
+    { 0xa0b0a4d3b7c84e, 0xf132c378cf2b00, 0x192814beaaa8ec, 0xe7929f97b4b5df,
+      0xf08a68e42d0ab7, 0x814afb17b60cdd, 0x78c348c7d9c160, 0xf8a948844db217 },
+    { 0xcdefd88eaa2578, 0xf717f56bd0e260, 0x7754e131694d02, 0x1254c14181dbd8,
+      0x0dacdd26e5f312, 0xb8abdfbcef87bf, 0xb985972e74e2ea, 0x1717621002b424 }
+  },
+  {
+    { 0x92cc75e162df70, 0x1e20c0618ee849, 0xc036b4626aa590, 0x31be67e4da5155,
+      0x04911b5f7213b0, 0x39261d7bb2e72e, 0x9e844665c015a3, 0x2f59fc0298ae67 },
+    { 0xa3ea7ba1701fcc, 0x87a5fa90ebd651, 0xa607ed4301d7b1, 0xbd4ec5f3b2e271,
+      0x732a1a2dc4180f, 0xbe15d82feaa8c1, 0x103670266f2f3f, 0xccfd3979e79ce8 }
+  },
+  {
+    { 0x82ab83570a54ad, 0x5c1dee8e3bec75, 0xf583ff454b556b, 0x9220199f461e60,
+      0xdf61ca887fc4e7, 0x6641fd20776dad, 0x00c6edd8edd061, 0xaf9b14255f7e87 },
+    { 0x73f15e49bbe3ec, 0xdd3b788f8bc1fa, 0xb24cc071b8ff86, 0x6c260d241be58b,
+      0xec1c4e36b10ada, 0xf6b42097fdb985, 0x0d0ac85d47c212, 0x967191c07d78d1 }
+  }
+},
+{
+  {
+    { 0x3b11638843d0f3, 0x4b89297f27f10e, 0x477236e863ba2a, 0x1949622add280c,
+      0x7cd523504da757, 0xe0e99d279e4ff7, 0xb4ef894537da41, 0xc55dde45a24ff1 },
+    { 0x18d8e21b587521, 0x8010b5d3777833, 0x4af522dd3a54c8, 0x7cd476b4c0ac13,
+      0x4587e614099f67, 0x494d0ed605ee64, 0x3218ba2cc80903, 0x5ff56aa0b2e169 }
+  },
+  {
+    { 0x51ec94e3a06c69, 0xa26d7be5e65c52, 0x156f113d44ee96, 0x70f0968bf5b9b4,
+      0x9b7e4695f5332d, 0x36c295f6703829, 0x1522690d04f492, 0xcf35ca4728043b },
+    { 0xf9ca3e1190a7c3, 0x53d2413f971b07, 0xae596529c48b49, 0x74672b8fefff5c,
+      0x0a3018ba7643b0, 0x51919e83e9b0a8, 0x89ad33dc932fb5, 0x52a4419643e687 }
+  },
+  {
+    { 0x7778990d2d0acd, 0x3bdbcce487fdf1, 0xdc413ca2b03dd2, 0x278755b9a2b7d0,
+      0x4ebb8b535ddd7f, 0x0465152bcbdb92, 0x34f22d6671d051, 0x1ba04c787192b9 },
+    { 0xb1693f483560c1, 0xe08a5937d174e9, 0x47ffdc464dc9af, 0x1123596ce8126c,
+      0x632d95f1124628, 0x66287abfee7c76, 0xb40fe60c552332, 0x3f11729e304e1e }
+  },
+  {
+    { 0x97a6ea05030a8c, 0x692419809c27b2, 0x3308501ac9dd5d, 0x9fed7fabe73fdc,
+      0xea555440535286, 0xc7c07ab6c9b832, 0x178c882c51b967, 0x6fa0c6986ee075 },
+    { 0xbaa4a15b8b5c4a, 0xf83c0ea3130c0a, 0xcf8624b2800331, 0xade85cd7ccbcb8,
+      0x971d7f6f08445d, 0xfd480b76a546dc, 0xdc15a38c93761c, 0xc4c495c9d04631 }
+  },
+  {
+    { 0x5f4cee89470efe, 0x9fe896188d93ad, 0x24783b3f4e49ce, 0x1bc7ed752ffb3e,
+      0xa3abe6a6d81e17, 0xd6bb8b47a333c3, 0x3485c0b10a3527, 0x7cddc9c31a9d10 },
+    { 0x0c78112c38ca37, 0x10e249ddd2f8d8, 0x72c88ccc511911, 0x4d75b5a29a6c84,
+      0xc74b267a227b1e, 0x698390cf8e35ad, 0x8f27edfe98d230, 0xec922f26bdc7f4 }
+  },
+  {
+    { 0xac34023fc32e11, 0xe0ae2f547200d1, 0xa7c7492bd98c82, 0x3910b687b02154,
+      0x6fdd06ce28ab6d, 0xd3a7e49d98b012, 0x4c1c82b9f54207, 0xef5bbe645c176f },
+    { 0x3d17960d3e71eb, 0x90d7e84080e70c, 0x83e6438bff5d9e, 0x1877e1f535d85c,
+      0x931ed6efbb69cc, 0xcf962651247848, 0x76d618b750da4e, 0xc076708717fbf6 }
+  },
+  {
+    { 0x80a5ac5eec5126, 0x6d05dd13379c80, 0x514b0892336d32, 0x586c0066725137,
+      0xab2365a574f954, 0x3c89ea0ac7d356, 0xf1f2edd27460ba, 0xf200ddbab9870f },
+    { 0xc8f1b2ca35e885, 0x5d22f86e6e7550, 0x24b9a409554615, 0xcb41107616314f,
+      0xca752f0c976a11, 0x3e2f839a08291a, 0x0cff22ff2c420e, 0xafd603e82b9747 }
+  },
+  {
+    { 0xaddeddc810a3da, 0x78b6c2dd3a87bf, 0xbc7020bde3a04c, 0x47ab9739b6d045,
+      0x3b046d60959358, 0x0f953e7509ee3e, 0x803dc8669fc61b, 0xcceaec0893c8d4 },
+    { 0x21f8c40b048a45, 0xb535073fcaea8a, 0xe712c3590e360b, 0x5d0f3f48403338,
+      0xe0ea26c7207f2d, 0x20f6b57ffd9e05, 0xb97d68e4788b00, 0xb1215541889cce }
+  }
+},
+{
+  {
+    { 0x0079817464238e, 0x21103020d381ca, 0x1cc4c6ed9f01b5, 0x5e35dc55a131b1,
+      0xb61848d06944eb, 0x83792a029631a3, 0xbe1017fafca0dd, 0x70aaa01782fcbb },
+    { 0xc63b7a099945e7, 0xe9164ecc4486c1, 0xb133e35885f2c1, 0x186f0d3c99ae02,
+      0x2fca4922bf53e6, 0xf922aa248a02bc, 0x4fe64900dd3dca, 0xe8c313ff6a8207 }
+  },
+  {
+    { 0xc5b358397caf1e, 0xa001922922a4b6, 0x67e36bedf07c95, 0xabaa0aeb2f4f34,
+      0x66dc926dedc333, 0x82021c438ec5b3, 0x82b4f2600ab176, 0x1b7c22e69c45af },
+    { 0x07b0dbe0924ad9, 0xe030936a407dde, 0x66e1ce926ccd06, 0xb50c108e3505a9,
+      0x8b921e1da98f51, 0x449ca1a20cf7c7, 0xadb80c7e67d079, 0x205aa54834372d }
+  },
+  {
+    { 0x1482b4819bf847, 0xd6c16ab5906f0f, 0x323fb1723ad060, 0x0346389c832be7,
+      0xe71b2d82ee45bf, 0x761c37dfb22276, 0xa9b33345d70be2, 0x81a06565a0627a },
+    { 0x337750399a6282, 0xafc8d2ed0436f0, 0x22f71d3c53342f, 0x66ca56d8939ad3,
+      0x15a919230e09ba, 0x261091ea6de890, 0x609d700e78f2d5, 0x8aa52ee8eaaf78 }
+  },
+  {
+    { 0xa398788ce76258, 0x3031d07494b975, 0x4a6d652043dfe2, 0xdb1a849b4401ec,
+      0xf81ebbbce8bbcc, 0x937dd4716efe9e, 0x9c19350ef85ecc, 0x260d932214273b },
+    { 0x1d7e21e77bf1a3, 0x199d689a544eb7, 0x9da594194ced50, 0x71a60be8a0aeaa,
+      0x183a0ae26d3b51, 0x49f176a8df9728, 0x744376e3230674, 0xb2cb21ae25541c }
+  },
+  {
+    { 0x7a721589a0071f, 0xe19dd29e7d2a6b, 0x3deb34e55113f0, 0xef1f8ebede573b,
+      0xa8f7ff95665e37, 0xa2c21eaf2d7777, 0x1387afa91e2e39, 0x04057b97db68f6 },
+    { 0x8b9d5ae1c241f7, 0x689588a8e75993, 0x79585b45c0e2d4, 0xba1ef167b64974,
+      0x72685bc1c08a75, 0xf0a5814d572edd, 0x71464a35ab0e70, 0xc93c92b339aea7 }
+  },
+  {
+    { 0x1917e2a5b8a87d, 0xea5db763a82756, 0x5bba2fb6420e2b, 0x5cc0501019372a,
+      0xb1ef8beccc5efd, 0xaf06393f49c57d, 0x3ab1adf87a0bc4, 0x2ee4cca34fe6b6 },
+    { 0xd1606686b8ba9b, 0xef137d97efec13, 0x7b6046550abb76, 0xb40ec2bf753a00,
+      0x696ed22eaf8f1d, 0x398c91fd8ba3d8, 0x11f203437db313, 0xe1ec33bfe5079e }
+  },
+  {
+    { 0x8a10c00bdc81f0, 0x5f392566fe8e05, 0xa595dab14a368e, 0x32b318138cec6b,
+      0xd77afde1b00d00, 0x3c979284d9923d, 0x78f0e7a76e13dd, 0x5ee8e59bf75675 },
+    { 0x49ec89391b130c, 0x9416182a47a441, 0x54555b576e2ce8, 0xcbdd2fd349c40b,
+      0x10ae7379392bbe, 0x270b1112e2dab0, 0x5cb7712af293f4, 0xfc22a33d6095c6 }
+  },
+  {
+    { 0xdcb5bbd0f15878, 0xbcf27adb6bba48, 0x979913e7b70eba, 0x4c0f34b158578a,
+      0x53f59a76ed6088, 0x19b3b2c75b0fc2, 0xad628dc0153f3c, 0x5195a2bcec1607 },
+    { 0x95f8b84dfe0f7a, 0x935c6b0152920b, 0x25f9e314da1056, 0x4910a94b28c229,
+      0x54b03b48ee4d6e, 0xc991fc3694e3ed, 0x68c4c26dbe5709, 0xc9cfce463d7657 }
+  }
+},
+{
+  {
+    { 0x21c9227f52a44e, 0x7f105a2e85bfbd, 0x887781f6268fc2, 0x56ee808a2d7e35,
+      0x14f9de52d3930f, 0x4a4e356dcb561a, 0x87362267f95598, 0x211c3425f34151 },
+    { 0x8fcb75b0eaf9cb, 0xcc9edf93d60ce2, 0x54412c9a5fe627, 0x6036a72842dd09,
+      0x71ce668a6c6099, 0x02b30d75386764, 0xb69bed36f18e23, 0x124c9b1d1de9f4 }
+  },
+  {
+    { 0xe8f8d95e69b531, 0xe1e115eaff1049, 0x9087cd1eddea0c, 0x8ed55a57449916,
+      0x8009f547808404, 0x990f21617fea55, 0x68ba624fe8ecf9, 0x8ac295056d1f47 },
+    { 0x3257887529dfb0, 0xc4a613f244c080, 0xabb1ac028672fa, 0xb2915c531eb291,
+      0x6e368ca8fababa, 0x6b8c2591fde498, 0x67724a1f2a548c, 0x6b3b7e8f90409b }
+  },
+  {
+    { 0x5415003fae20aa, 0x95858a985df5ce, 0x42bc9870ac6bee, 0x8d843c539ea1a9,
+      0x5de200cb571043, 0x084fcd51741a33, 0xe1ca20c0009d1c, 0x0271d28e957e6d },
+    { 0x84cbf809e3be55, 0xc804dda1c578c6, 0xea85489409a93a, 0x64a450a972021d,
+      0xc6a2161e681312, 0x280bff965bc111, 0xd358a4b0f8526f, 0xd967be8953a3ab }
+  },
+  {
+    { 0x4c5e6157dd066c, 0x37afd33634c8d4, 0xa3ac88a42d8b87, 0x9681e9b938b607,
+      0x7a286ab37fe4c8, 0xdeee5742494245, 0x184b9d36af75a8, 0x20f696a3670c04 },
+    { 0x1340adfa39e8b9, 0x03c19290850b2e, 0x435ebd42c0e1ef, 0x49de18b142ee9b,
+      0xb440b273f116f2, 0xd94e9fa2214463, 0x1b0ddd36311543, 0x1ae042a991ba3c }
+  },
+  {
+    { 0xbc322f85bb47aa, 0x9e2562554a5845, 0x96b65ae21115f3, 0x46fbed4bb5757b,
+      0x18aec4f4c42dce, 0xc59caf68d801f0, 0x91894631205521, 0x66bd8e089feb7a },
+    { 0x39ebe95c529ee7, 0x28d89928eadb99, 0x6058c786927544, 0x877e7a5d3808ec,
+      0x8f651111c52eaf, 0xfb59812ae221cd, 0x22289c6f890391, 0xa97695b4966e92 }
+  },
+  {
+    { 0xf0a91226ff10f0, 0x49a931ba2a65c8, 0x3fcebbcb1d3cb0, 0x70eb79bca9685f,
+      0x82520b5ab38cb6, 0xccf991b76304c3, 0x575aab1af8b07c, 0xec8166a5ed5efb },
+    { 0xddc5698c8689b1, 0x227c949b2e78d7, 0x61323218e07d91, 0x658a11d22cfd62,
+      0x908fb44004dd5f, 0xe3d14f090d21b1, 0x6f3db9da6a1639, 0x09d86c0333a525 }
+  },
+  {
+    { 0xd83eaf06f043f7, 0x88ab648b52d5f6, 0x67c664d57144d7, 0x55d7644eafc8b5,
+      0x1c89f20cceb291, 0x51aec7b831ac47, 0x51172fa6148854, 0x8fabf7ef6d7bfe },
+    { 0x5910316477ee27, 0x5f299dd20fe61e, 0x48079a842826ab, 0xf4a83ba22591fa,
+      0x8fac66055482ec, 0x48fd5f16b65b3b, 0x4288a7c9fd9e19, 0x27db8199377894 }
+  },
+  {
+    { 0x2936ee47fd9dd6, 0xcce5f0e9ec87c6, 0x15a50e3db6e3b4, 0x61df105ad701c8,
+      0x3601add1dff1f7, 0xb761e06e8a16e1, 0x4341e021af3f91, 0x9156a4a933fa3f },
+    { 0x9dc46ae54bc01d, 0x605577a64eb910, 0x22b99f85a59a99, 0xab2dbaf0a229d8,
+      0xa8bfb656599364, 0x39ed4a5e94ebf0, 0x7b46a1e0dbb23e, 0x117b1958751422 }
+  }
+},
+{
+  {
+    { 0xd19e8fd423bddf, 0x9d77042387ef59, 0x315cbdd849590a, 0xfdc637c7866c1e,
+      0x72be83d03515a6, 0xd44a4a00376780, 0x3b9613119e0c2b, 0x023aca37b1a689 },
+    { 0xf5f368782282ea, 0x44710898a8b5c7, 0xcd2f00a17a3066, 0x754e11281ed681,
+      0x9c6c70c0bfcefd, 0xd6aced03b6f29b, 0xe443d562817a2a, 0xe590ef4e7c0012 }
+  },
+  {
+    { 0xc2f96763e62e2a, 0x661816eb2daa26, 0x3515fd2dd5f512, 0xdc36e2756b6e75,
+      0x0bdde4674cc658, 0x102908600e7644, 0xfdf00451694a09, 0x454bcb6ceac169 },
+    { 0xf4c92ab6481eb6, 0x8b77afa09750e7, 0xe6f42316362d6d, 0x0d45deef53a3ae,
+      0xdac7aacd7dcf98, 0x628cb7f125ec4a, 0x41e8a20aec0320, 0x7418c7eea2e35b }
+  },
+  {
+    { 0x4d649abdf40519, 0x8cb22d43525833, 0x15f6d137a5333f, 0x8c3991b72c23ee,
+      0x248b9a50cd44a3, 0x6b4c4e0ccc1a75, 0x3221efb15c99a9, 0x236d5040a9c504 },
+    { 0x401c7fbd559100, 0xcf0e07507c524d, 0x39647c034a9275, 0x2355422f7e8683,
+      0x3e0a16eb3ae670, 0x1c83bcbad61b7f, 0x491bcb19ca6cbe, 0xe668dc45e29458 }
+  },
+  {
+    { 0xe44c65b219379e, 0x211381bbb607ee, 0xd4c7428b7bc6db, 0xba62a03b76a2e8,
+      0xe1729c98bb0b31, 0x3caeb50c6bbc10, 0x6c66727b0187aa, 0xbf9d2f0fb90dcf },
+    { 0xec693501184dc6, 0xd58d2a32698eb5, 0xb366d8da316b07, 0xe1e39bb251c017,
+      0xbe44ba9adb157f, 0xbaa9a9a8a8b06c, 0xd0f46356e473e1, 0xd25a8f61d681c6 }
+  },
+  {
+    { 0xba39d5fcb102c7, 0x66eba21d8aa1eb, 0xcc2591a697fbf4, 0x5adb5792317f54,
+      0xa01ae71f76c6f9, 0x2c525de5042705, 0xc8f42724f4479f, 0x26ab54ae6d7a5b },
+    { 0xda217b5dc28106, 0xc7cadeaeb2ae6a, 0x0b1609453ea3b2, 0xcddcc1ccc6111b,
+      0x5c47affa7a7beb, 0xf9931bd0e52dab, 0x5231835c6dcf96, 0x7095bdef27ea4e }
+  },
+  {
+    { 0xee8adaec33b4e2, 0x300665163ceb44, 0xf1476fb880b086, 0x07033289569ce8,
+      0x2cabf9a238b595, 0x85017bc26c8158, 0x420b5b568d5144, 0xa9f5f1ef9c696f },
+    { 0x1409c3ac8fec5a, 0x541516f28e9579, 0x06573f70e1f446, 0x3e3c7062311b96,
+      0x0033f1a3c2ffd8, 0x8e808fcca6711c, 0x716752d07aef98, 0x5e53e9a92525b3 }
+  },
+  {
+    { 0xce98a425a1c29f, 0xaa703483ca6dc9, 0xe77d822edfa48b, 0xd2e3455068abca,
+      0xb456e81482cfca, 0xc5aa9817fbfb08, 0x8979f258243194, 0x727f2172cd043d },
+    { 0x7cca616aa53923, 0x387c5aee9bcb72, 0x0173fd437580bb, 0xdd7795b75fc0d9,
+      0x47d1c37345deae, 0x2eb5d7fb0d1c03, 0xf7a1b92958f002, 0x7365cf48f61b67 }
+  },
+  {
+    { 0x4b22c3b562a5ed, 0x711216f5c7cd07, 0x51f72c49ba0648, 0xc10d0930de9e6f,
+      0xaca479bfda63ba, 0x4722a55af532b0, 0x8d59eb77236f39, 0x5cad8744465c34 },
+    { 0xa2119e5722b0c1, 0xb670264f343ea4, 0x6910f02c19f387, 0xcfec5bc0381fba,
+      0x5f5de0d52c0a1d, 0x4e474d56378cb6, 0x2fc802727e2ba3, 0xa215da3159b541 }
+  }
+},
+{
+  {
+    { 0xed535858499895, 0xa0aefd565c998d, 0x210d8502d5a561, 0xc2cc23ca2cd9d6,
+      0x2371d46c4d297e, 0x88b2143d18d441, 0xbebdad9043993d, 0x6ba91e7ad5f28d },
+    { 0xc2bb3f13a731f4, 0xd35cfac5d0d5c3, 0x995099835ac427, 0x8938bb55458adb,
+      0x0bd738cab26f3b, 0x56db3d5a28cd8d, 0x87eb95fa1d8b4b, 0xd6700efe7f3b4b }
+  },
+  {
+    { 0x962c920ea1e57b, 0xd3be37e6dded6d, 0xf499b622c96a73, 0x3eaf7b46c99752,
+      0xa310c89025590b, 0x535aa4a721db23, 0x56ab57819714a0, 0xeecb4fad4048c1 },
+    { 0x7b79ec4470c466, 0xc4e8f2e1383cee, 0x0f5d7765750c45, 0xa3b3bc3725527d,
+      0x2f5deb66d00cce, 0x5d5a0f495a8d81, 0x50a442ee02b824, 0xafb04462a11628 }
+  },
+  {
+    { 0x72b67bc0c613de, 0x0150d4be6f0b24, 0x847854e8ed289d, 0xe08292fa320f88,
+      0xd5b6da329c6160, 0x2a48e2d4fb9d06, 0x55d9e412de087c, 0x65683b54f02100 },
+    { 0x4dc8c2ea8886c6, 0xe966dd220d6114, 0x99745eba57af97, 0x23a9a71b854725,
+      0x8effe05621a047, 0xf16d284049a4be, 0x95828c25b0660f, 0xd5b69ba56e96b0 }
+  },
+  {
+    { 0x0b5b4244ffa0b8, 0x0585b45096cc5e, 0x413e1aef505d37, 0xe5652a30c7ab8d,
+      0xab32fb72990120, 0x6b8b16e3f09368, 0xbf9fadbefe128e, 0x85f366b14b7671 },
+    { 0xcb2f294090608d, 0x25e2769ac3045f, 0x069c4f06131904, 0x1c57cf1329a779,
+      0x72fe0d5b7cace7, 0x04d9f430897a45, 0xbaf32f6359a645, 0x0fa854ffa7485a }
+  },
+  {
+    { 0xae3533c5f56f60, 0x9773bbb0ad9360, 0x769b34a38fbe6b, 0xb5ba8e9ffb0c00,
+      0xa93931875472e4, 0x12cac92ce5f30f, 0x514fc06a9e7dbc, 0xd7ca86558b4734 },
+    { 0xd101ff365a730b, 0x92da451abe70e9, 0xfb5f94aef7bf4b, 0x8c3ef4c1d56c7b,
+      0xb0857668435c10, 0x7fbbbdae7ed4cc, 0x1da6eaf24f372f, 0x0ab2c1f59b8ae3 }
+  },
+  {
+    { 0x63a1a78f10a4b9, 0xbb5278d0c7e510, 0x97b224ef874142, 0x0a9ff52b2517b1,
+      0x1b5a485c5cd920, 0x1a8e2eba1823b9, 0x2b088c00e914a8, 0xe5ec3adcf13432 },
+    { 0x0d6ab3e6e7e253, 0x9f0f5cd6f18458, 0x839a744f459a6d, 0xb4b4f941eb15f7,
+      0xe0313acc72cb14, 0x58ee933b20472d, 0x5f73d7a872543e, 0xb1700c5501f067 }
+  },
+  {
+    { 0xb70428e085f67f, 0x5441d5143cabe5, 0x4d0e8c2e0a6055, 0x8d39a080882e4f,
+      0x615bb32c1cb39d, 0x113f18df7a1642, 0xbab8cf5250681f, 0x3017ba2677b72a },
+    { 0xcd2b6e95a3a876, 0x04765012035a69, 0x31d6440efa2ea0, 0xde8f8d156874d5,
+      0xcbc71cd0199d4a, 0xc546b61e7f2170, 0x4e57e4e112c4c3, 0x58955a8d1622ba }
+  },
+  {
+    { 0x0064cd704e2f6f, 0xe9d458de0edd38, 0xeb1a5977e0a5c8, 0xe322ece01fc0a8,
+      0x8b9d1661032a19, 0x3e7b539a89de94, 0xfa30262001c754, 0xe33de4ddb588f6 },
+    { 0x4dafbdb954eb94, 0xbb436480584c1b, 0x622c93e5dbe29b, 0x968f9e3f57b931,
+      0x98f03be0f6453b, 0xb0ecc7f08f696c, 0x5af55f4a505335, 0x028533efb3fa9b }
+  }
+},
+{
+  {
+    { 0x3bc8e6827e8d86, 0x4e43b3063f105a, 0x5301b7d4981250, 0x8b0a75e9f72fa8,
+      0x88f59db357348c, 0x5f0ebb1ec4208e, 0x4712561c043d3b, 0x9e5ded0c806b97 },
+    { 0xf9bd0a62121d09, 0x1759ecbe337cd1, 0xd1acc0ee945542, 0x3683febbd2f63a,
+      0x44f1bccda5dfe9, 0xa3606c9707f22f, 0x45ef0642d96ca5, 0xfc3107d9022df9 }
+  },
+  {
+    { 0xe81320b44be755, 0xdf213d55c7c761, 0xf43d2d5b4e5db9, 0x3bcfd828dedcd2,
+      0xdf368a6d37a9ec, 0xfef20aef475a77, 0x22f5894162c064, 0x956bc660142a7d },
+    { 0xaaa10e27daec78, 0x3cb9b72b6e9a78, 0xa740bade383f72, 0xc31b4017759007,
+      0xdada964a7afc50, 0x6bf062cfd3d11f, 0x9470d535db3679, 0x339447303abf13 }
+  },
+  {
+    { 0x533f44046e5d7f, 0xd1793e349048c8, 0x59e11501929b94, 0xcddbbcb8364134,
+      0x795c794582774f, 0x114dfc4e03081a, 0x541ef68ef54042, 0x159295b23f18cd },
+    { 0xfb7e2ba48a2c8c, 0xe2d4572bb6d116, 0x7bb0b22d750b53, 0xc58888cd142ee8,
+      0xd11537a90c9e2d, 0x77d5858d02eb9e, 0x1fa4c75d444a79, 0xf19b2d3d58a68d }
+  },
+  {
+    { 0x37e5b73eb8b90f, 0x3737f7a3f2a963, 0x87913fa9de35e0, 0xec7f9928731edd,
+      0x6e6259e219491e, 0xb2148a04de236c, 0x89700e8fdd309b, 0x9ce51e49f0bf80 },
+    { 0xe7ec421301f17b, 0xa4b570a3bc5f4f, 0xc2b1b2a1285ee2, 0x5e86bc8c53db73,
+      0xb65fceaf24fa90, 0x9e74c5608ab024, 0x5c8003df9ed877, 0xa632e9e4a2cbbc }
+  },
+  {
+    { 0x32a4546c91c8b5, 0xc122b5ac969363, 0xbbbec5e3648b3a, 0xd5a365e25143b0,
+      0xcf3e46454157ce, 0x9712f04f9bab64, 0xc12d43a04b4008, 0x51932d72edf1c7 },
+    { 0xaef1655b2f8470, 0xaa8e3f36c24ace, 0x7da75da6b4e761, 0xd371827b90bca2,
+      0x84db4500afb45c, 0xae12045ef46b5d, 0x91639a5d962f98, 0x669cbe672f2ac0 }
+  },
+  {
+    { 0x851bb3183a4356, 0x7d436bf9a1bf15, 0x46a3f0e120b378, 0x9302abc3f5b357,
+      0x1e0672693fef53, 0xb12f4a95fd2ee9, 0x94a884c7de9433, 0x2645234a6f2874 },
+    { 0x6fb56f5cdb8dfa, 0x4a17dfc9e0ee4e, 0xe269d8383ab01e, 0xda932dab77c10f,
+      0x463af0c0321243, 0xbe1d68216fc8a3, 0x2eae3ea48b39e3, 0x94230213b03e7b }
+  },
+  {
+    { 0xaeb507cb22f28a, 0xa77458b49a6b44, 0x232ed5ac03dc17, 0x79dfc169c61ac6,
+      0x7c48be9cd71b93, 0x983d68ac429cd9, 0x7709c4798ae2c8, 0xe4765c0a5df075 },
+    { 0x23c4deb3367f33, 0xbdf2b7e37d72a7, 0xbaab5c70af2d26, 0xd609f7ffd026ab,
+      0x23b72b2541b039, 0x8d06bac83be852, 0x911d4a9cb23d1c, 0xeae815cfb0dbd7 }
+  },
+  {
+    { 0x487c35c2c33481, 0xffab636b6136db, 0xccd4daea3d3aa4, 0x87149bbc3704e0,
+      0x9de8119c0e8396, 0xd49357a58e7ca6, 0x68789181562d75, 0xc7453815ab1fad },
+    { 0x0f1579802c9b91, 0x7ffc3f0b1ddde5, 0xa01d5e06aae50d, 0x6a97e65e279873,
+      0x4bcf42fb5b1b41, 0x1c6410f32f5982, 0xd4f760050701c8, 0xff02663873b90d }
+  }
+},
+{
+  {
+    { 0xdc53ea2e5b2de2, 0x94b352d38acecb, 0x37d960b0d9d5e5, 0xabd868f90bd997,
+      0x781668f35a7376, 0x043d59710118bf, 0xd4da719f57928a, 0x01942f6983e46c },
+    { 0xab97fc8728bd76, 0x825956b4b5c1c5, 0x202809fc82a104, 0xdb63e9cc8e3132,
+      0xa41c701c2181af, 0xd28018043e066a, 0xc734e4124044ce, 0x4d9ab23505193c }
+  },
+  {
+    { 0x0bcd42af9f0c3f, 0xda21a46b94a218, 0xe55243c0ffc788, 0x318aae647a5551,
+      0x8c2938b79af9cb, 0x5d15232ec1dce5, 0x3d310ba8ad2e5c, 0xd3d972494f792a },
+    { 0xdeb4ca112a9553, 0x2f1ed04eb54d9d, 0xaa9c9cf69fb7a1, 0xeb73c3a54dcd3a,
+      0xee3eddcf5f201f, 0x35f9e1cba7d234, 0x1d1d04cd2e242f, 0x48df9d80df7515 }
+  },
+  {
+    { 0x4ecc77da81dd9a, 0xa6ac4bb03aa015, 0x7645842bbc4fed, 0x9ae34cd9d6cf52,
+      0xf8ff0335917e0b, 0x7c9da37c2cc175, 0x1e74dccaaacfbe, 0xa8f2df07999af8 },
+    { 0xd06c4ea102a466, 0x2156e87ae190dd, 0xc95db8aec4a863, 0x49edffd244a6fe,
+      0x110fae6904f81e, 0xbaa3e50a1cd104, 0x5bd38a20478b65, 0x2b57d05daefbcc }
+  },
+  {
+    { 0x1ce92ba86f4534, 0xb2a8592414f5e3, 0xdd7a4c69979436, 0x7599aff3f0add7,
+      0xe0ce4d3e2d4f64, 0x74475cc401a29f, 0xaef6541a2377d9, 0x54048f53f917b6 },
+    { 0x1b86b2205312ec, 0x779ba2231493cb, 0xc718369aac9320, 0xeab01a8617fce4,
+      0x17b1f10f7187fa, 0xe68eda0a1aca46, 0x61033fe2586342, 0xfc14e790b6ca43 }
+  },
+  {
+    { 0x9f2231913d2491, 0x66bdb537997202, 0x0bafb0c4617f34, 0x5917831f3bb7b3,
+      0x6feb2a6b45bddb, 0x08662b30202c19, 0x0bc2b5705852f6, 0x2c00fd491818c2 },
+    { 0xca7672cda37dac, 0xfe4c04c5a30865, 0x5f1399f322e92a, 0xe7d67ea25b1beb,
+      0xe08b014dce7f68, 0x24df52af2f2b3c, 0x2028b23750ecd1, 0x9b25d4bc810a45 }
+  },
+  {
+    { 0xa35b7157a9d799, 0x6da1eb301f9c99, 0x33ef91ce363ba8, 0x21c0e2ece140da,
+      0xb0b11bf158cd84, 0x6a8744293da438, 0x924f10d3db585b, 0xf5ddd7310c6159 },
+    { 0xb72dcb86a74c21, 0x6d14198cc8f79f, 0x99f4b6c9c5a8d6, 0x063968890e135c,
+      0x330edb883f6385, 0xe1a5a6b9079675, 0x6e37fa8b8f5fe0, 0x60e2fd961dca1e }
+  },
+  {
+    { 0xc6cb40366c395e, 0x03b21a7b51d0f1, 0xbc478a5e693181, 0x0017c2fc6cff33,
+      0x740a5b839d8d1e, 0x3968d664d9ec6d, 0xfd53738b0ef1b0, 0x73ca8fd1ed0a04 },
+    { 0x4ace93875ab371, 0xd602936ddad7e9, 0x1f5424a750bcc2, 0xfe09b3668c7a17,
+      0x165f7de58341ec, 0x95b825a6ce61e5, 0x9d31e1966c83c4, 0x65b3e08cc5887b }
+  },
+  {
+    { 0xd37e93221482d1, 0x9af659708b6380, 0x279426a7d61e4b, 0x80dd0ec80997ad,
+      0x7239b0dd5b76d4, 0x92e6c73e76c098, 0xeeb2321eab3e1d, 0xa69c4a7eb1a910 },
+    { 0x46d6aa7833d9ae, 0x3ee6957572b0fe, 0x44ccbedcdb3d97, 0x342f29dcbea01b,
+      0x0d518c58926876, 0xaaabae75585d2c, 0xc548c77e008f58, 0x819e2fa21fab2c }
+  }
+},
+{
+  {
+    { 0x468e149c16e981, 0x286c7909ddbb7c, 0x2a92d47db7a38a, 0xde614e68a27cb2,
+      0x8dc8822e5b0ab6, 0x38441aecf48565, 0x11ed5c9089435b, 0x238928682d0d31 },
+    { 0xc6698d472f2f31, 0x295242c56d76af, 0x4099205eba563b, 0xae7de5a3ab7384,
+      0xccdf127d0ed86c, 0xb9b6d5b965c3c3, 0xe351a8f2c31ad7, 0xa761dd8ac12f13 }
+  },
+  {
+    { 0xda115ddf171ab7, 0x2de17b1401f93d, 0x95019ca40964b4, 0x169d1f465ba3c3,
+      0x534a0070090d08, 0x805c5e282bf410, 0x15dfe1165f8d90, 0x827a416ca72456 },
+    { 0x5af888433a36c4, 0x8bfa54cd8ee604, 0x08fd1419ce290f, 0x2db5e8c287b3a6,
+      0xe5be98103cdad2, 0x155b874bf810b9, 0x2ae42de670f473, 0x22185847f74657 }
+  },
+  {
+    { 0x54b2a5023ffa43, 0xcf87b16a24d919, 0x1ff540263524e8, 0x73c94e056d1e54,
+      0x76515523899fb5, 0x13a721418723bf, 0x39afbdd3561517, 0x49b790a9f2862e },
+    { 0xc8c1f4f527d2ce, 0x1997aec7609bb7, 0x583ad8002a3400, 0xac2374e4f79706,
+      0xbf1f9a821b7183, 0x06158ab6600fe0, 0xfcc9b2ebd56751, 0xe1de5acddaaec7 }
+  },
+  {
+    { 0x230baa1788fdab, 0xf30860a7d04597, 0xa2c7ece99f4caa, 0xbd39f106ad065e,
+      0xfd92f5d3bef7bd, 0x6069fad96d2203, 0xbff38cac4d9e0d, 0x419a0171fda313 },
+    { 0x5d77fd8572f035, 0x5af99f2b282b40, 0x7257d3b23facff, 0xf2ee22358c90af,
+      0xcc2687d9b6a52a, 0x140892c302430e, 0xa934d5e3ec4f38, 0xc087d7c3bd18be }
+  },
+  {
+    { 0x7e94138a2c5ed7, 0xbc8ceef53610bf, 0xe89356bd86f803, 0x9a3a3805a55330,
+      0xe894aba11ad648, 0x2e68fbaba95918, 0x643e2bafcad344, 0x0dd025661640aa },
+    { 0xc02e479e25cbdd, 0xd78c4d813a1b3f, 0xa6dae8fcca9692, 0x3dd91e9e5de8a0,
+      0x78ae0ce764ea36, 0xb4ad99985dbc5e, 0x967ff23e82a169, 0xaeb26ecbaee1fc }
+  },
+  {
+    { 0x8c502559a6f90c, 0x56e7abe0ea374a, 0x675c72256413b2, 0xd3fc17e946753f,
+      0x28c4e1fe235f7c, 0xe209bcdb028eb0, 0x7d0f93a489fe88, 0xb966a2e063706a },
+    { 0xb6c228c4a30319, 0x6868efeca6d674, 0x0610a70057311a, 0x0808112bad7f89,
+      0x2a2462c1dd6181, 0x52ed9feb58e88a, 0xbbff16f33821a2, 0xda53e9617f882a }
+  },
+  {
+    { 0xb6ffca38c30e5d, 0xa90f9915c905f5, 0x72fb200d753e88, 0xe509d4c7256c6a,
+      0x369e552d866500, 0xee4b7e033cf8ae, 0x280d954efcf6eb, 0x5b275d3d557f0e },
+    { 0xeb17211b5cecf8, 0xd6ad50fbdb2f8d, 0x2478c7b35e04b7, 0x97e7143ac73bd3,
+      0x09d6ede4817e24, 0x68fea712c405e1, 0x34adbc905f67a1, 0xd20ab7073edf99 }
+  },
+  {
+    { 0xe116a96569f191, 0xb3f0bce4d6e29a, 0x30b9e1af51dbab, 0x1dd36f3346d276,
+      0x83151030749a27, 0x242f148ab47f70, 0xe8a5bcf5585681, 0x8b801845ed79ba },
+    { 0xa4042fd3894ad1, 0x82f781d2b88bc6, 0x2d34cacbe4c397, 0x8731aeadd99c9f,
+      0x0f95498ef1d382, 0xcaba2e1dd0bbc9, 0x78889e954064e8, 0x8cd9c9761a8ab9 }
+  }
+},
+{
+  {
+    { 0xf31f53ffa0459e, 0xf8742a1315cd6b, 0xabe2f50ae64e97, 0xbd787419b9da48,
+      0x4521a3351e526e, 0xfa05935e10ba45, 0x5c947e1e8f903c, 0x0aa47d15a754ee },
+    { 0xb2849efd814825, 0x9c2a5d25c9968d, 0x24dbb2604e634c, 0x33f3a4cdb38194,
+      0xe04f609c8a2b6b, 0xcaefd8eabbbfdb, 0x683119a404498b, 0x24ab7a98b21cbd }
+  },
+  {
+    { 0x6f1326921fa2dd, 0xd79e61cc10a4bc, 0xac4b3ce4bd6d46, 0x52459b6bd3f37b,
+      0xce0f0a3a396966, 0x050d1d5a1ed488, 0x1b9c403e0b17fa, 0xee1abd004a2e66 },
+    { 0x97065c35cf3e3b, 0x6513d5fbe33441, 0xcd3463479047ae, 0x45cbb1cfd22df1,
+      0x7a173ae967b17c, 0x75f5ba72223cda, 0xe3d12dbefe0a73, 0x3b7f94dfd7adcf }
+  },
+  {
+    { 0xd596a13f1e9b7d, 0x04f5bdd6734e0c, 0x18b694f8be163a, 0x15620c7d959fa3,
+      0x65fc2c553d2a3b, 0xd44a364c4d36f2, 0xc8b421f268ceab, 0x564139abfe2bd4 },
+    { 0xb52461019d4633, 0x5ab3f886346934, 0x96691fe9819422, 0xdfdec898b39b82,
+      0x84b1c7997cfb27, 0xe59a98d4d6d004, 0x5e5d0c612c350f, 0xb431220d415774 }
+  },
+  {
+    { 0x3d0ca736aae0a2, 0x7b1991f48c2d8c, 0x00ae8565cdae72, 0xdbb6ca0bd55128,
+      0x3c2ab2a45c82bf, 0xea5a55979545ca, 0xeba9a26d5927d0, 0xb52e40183257fc },
+    { 0x55ed517ca9650a, 0xbdaa081e3ebff2, 0x8cf7ce49f8831b, 0x1d0b5bd6e3b8d3,
+      0xa314a9fd8fc869, 0x07f2079b892bab, 0xb700dbfa0cc9d9, 0x7105a086dc0a39 }
+  },
+  {
+    { 0x0c7e05d8c7d901, 0xa7ff681af3182b, 0xb88e3caf9a0d06, 0xfe20a12c343b7f,
+      0x9f0257703251f9, 0xf225dedc40c5eb, 0x50e0cecb208ea7, 0x5b250f0e6eeb65 },
+    { 0x807a1534806b6e, 0xded120afa94139, 0x237ddc749366fb, 0xdd3674e5a34bcb,
+      0xef6cdff9c4a61d, 0x036194bb2fb896, 0x38659539528cd9, 0x0723c596936a52 }
+  },
+  {
+    { 0x1f84cd5e17719d, 0x545939bc73b394, 0xefbf3c583e84e7, 0x6cc46f1f77fd66,
+      0xa629f591383ab8, 0x9177ffacd35cd2, 0x039187f9dd411b, 0xa9cf1cf7b7eea8 },
+    { 0xa3b105aac47e5d, 0xa755bead0a9da4, 0x50cfbae73da15e, 0x9456cbc60b628c,
+      0x7ffc3629b7a910, 0x30b5924cd6d6a4, 0x198629f0b04ab6, 0xc74609c624dea9 }
+  },
+  {
+    { 0x27d4d77af12fa6, 0xdd8a216690aeb2, 0xe48fc02fe24417, 0x1970403720e17e,
+      0x95013fdce37b42, 0x06817d2de4bd9b, 0xc5863e763d0ba2, 0xa1bafc0a556f5d },
+    { 0xf28ec7b410a78a, 0x0dcac420a01a63, 0xfcd3fa4b5bce11, 0x054d7e5d278b89,
+      0x5195db85ce49e3, 0x4c0b1672c73d96, 0xd94307720a1bdb, 0x66fa8b359c77a7 }
+  },
+  {
+    { 0xb9e93aed7462fe, 0xbfe54b218dde4f, 0xaabb5283dbb08e, 0x8c367020e5fc45,
+      0x35028888e69be3, 0x6d2efc1c12a11d, 0xfce5cebf265e30, 0x58c8bb35742c7e },
+    { 0x32e89dcccf7fa0, 0xa811f33dd020a4, 0xa10d6205129fe5, 0x3841c88e4ed29b,
+      0xf3303a9d8b1ea6, 0xa9a0cad1781f58, 0x4502b388f3ef0b, 0x2b7587e74c6d35 }
+  }
+},
+{
+  {
+    { 0xc6eaea123ae7cd, 0xa1884d473c0caa, 0x901e76fef1ea88, 0xdb9935ca14269d,
+      0xe8b2486947f1de, 0x4ad56f4a657588, 0xe7680542913fb1, 0x2abff5d37600da },
+    { 0xa814813a81a797, 0x63e76a446acb69, 0xb1038394ab8277, 0x587de349d8e759,
+      0xdfaeb8dddf62df, 0x24fe1cf9239d49, 0x7de7409e130d1c, 0x3ecfef9581d070 }
+  },
+  {
+    { 0x8d177a0f87c72d, 0xae7e5818c6d1de, 0x0077b5f8cece85, 0x382483832d2187,
+      0x49d8b156db2bd2, 0xe9e5513c8d85b9, 0x63c410ce05c53f, 0xceaf2fbd86f752 },
+    { 0x0b432fe93806c5, 0x18eb15d3d06c75, 0xcaad82612cfc02, 0x581e0401e2d045,
+      0xd573cb595edcfd, 0xce71948dbc66e3, 0xcf68721acc14ea, 0xf68bea26cac4dc }
+  },
+  {
+    { 0xd8576afcb74da2, 0x8771c29c433f46, 0x7315af6e2f5b8e, 0xc195481ba33928,
+      0xb77dcc22fb1f94, 0xcb3e57ca610f75, 0xeb2a92753907df, 0x916f14923eff95 },
+    { 0xbb378e4b6cd291, 0xa2a5e2b2f13ce1, 0xa8a0e60bcd00b0, 0x5902741682b75a,
+      0xa0882c93f65a77, 0x2069f75c93cfff, 0x1ede40570c0cb9, 0x13840c90d526c4 }
+  },
+  {
+    { 0xdc2caaa03ced48, 0x2079219a0315be, 0xca493563b1f642, 0x0202dc7b0665f2,
+      0xe5d6bbdb7a5238, 0x36fbd5e26eab32, 0xb3988f1f5819b4, 0x5b15dc84aa4d69 },
+    { 0xa52feed54e5c24, 0x927471be91a797, 0xd119bfdd57f677, 0xde38f7b78e4c4f,
+      0xa7af516b150bc3, 0x403b21e26b76c2, 0x589067d92300dc, 0x04e406a066802a }
+  },
+  {
+    { 0x28e7d09a9ca9bb, 0xaa84fd5fccf4a0, 0xdbe9fb8635b7ed, 0x9ede3f5d56fc7c,
+      0xa4b5031b01cb29, 0x584299d7f93703, 0xbd28868b6fe825, 0x1d385d48b9c2d9 },
+    { 0x6606f4a822be80, 0xb5a0165626d0fd, 0x9920a2014568ad, 0x7d430f41c6d174,
+      0xc243e16e02e9e9, 0x367f1d2a6bd649, 0x693910071b8c36, 0x2ede1314de2984 }
+  },
+  {
+    { 0xdc781875beec32, 0x1fff0cca525ff4, 0x6e86425676df34, 0x2b4e8a63f638e1,
+      0xc4991d29b1e59f, 0x399d0011589717, 0x406464ebe041cd, 0x901cb3d9e65bb0 },
+    { 0xf5f4572fb42307, 0xf81b3b0f1b7307, 0x8fb695cf2094d1, 0x7db4792db56f7b,
+      0x36836d55a794e0, 0x2da477b09bc879, 0x1cdfadb1887c40, 0x65dc6c2f2699b6 }
+  },
+  {
+    { 0x36f9f214737972, 0x48f0c8b7a387b0, 0xa156ed339a1d24, 0x375293a0fed268,
+      0xf679f487ff75cb, 0xd15a00f1cc9e62, 0x92a7dc722c3877, 0xe9870636fb0ed4 },
+    { 0xfd8e59c16f5f3c, 0x375732eaeeb48e, 0x2dd9213ca1ab42, 0xcb062099ffccea,
+      0xfc611f6b23edfd, 0x271634999b060e, 0xb938b5d820de8a, 0x138f6e7eb49a32 }
+  },
+  {
+    { 0x7feda63e485f70, 0x646380aeb27b2c, 0xcf8fe32c4511c7, 0x2c68e1eff9406a,
+      0xa9f2fd920b6020, 0x1c98fc63b3e465, 0xb8dac3593e53aa, 0x2fb47b6a750e96 },
+    { 0xea373ef1950bb3, 0x81566944ac7aec, 0x8d6b3c2b55b931, 0x5d13f2db62ef7d,
+      0x4647f2aab9182b, 0x8f56c5a33bf07c, 0xc5ab284b35a221, 0x0747ab75a46a6b }
+  }
+},
+{
+  {
+    { 0x5b9236c86b85c5, 0x5967a0dc482448, 0x397c9557df6ae0, 0xf83ee1c5378f2b,
+      0xf82df656e05dd1, 0x4c424f619d7c8b, 0xa612550a6d5f2a, 0xfe8482a63c3ebf },
+    { 0xcb8d4030142c82, 0x08b06623679e6c, 0x3ea51463eca5ee, 0x089eb3b1370500,
+      0xcbfb19c5a0d306, 0x2f6858842a65bb, 0xe3e1db5e51e119, 0x2c150e7110895e }
+  },
+  {
+    { 0xf323488f6d4c4c, 0x5fc931f63b87e2, 0x8867da035c759f, 0xb6f1eff9746d4c,
+      0x8a8172d990be0a, 0x1113eee5c407b4, 0xd80dacf378ed8a, 0x99b57cf3fa7fd1 },
+    { 0xf5bb6d95176405, 0x6b8963a92e83b5, 0xac55b6b8a7ef8d, 0xe73fa126c1fbf0,
+      0xdb3756060148df, 0x72f1a98f3f1fba, 0x1f71d0aea550f2, 0xc3ea4f09544a87 }
+  },
+  {
+    { 0x5b09da24322bf3, 0x2a573d561264e1, 0x93cb2e1803acc4, 0x397b4fbe502fc6,
+      0xddfb21239e0ebc, 0xeccd8f5bbcbc57, 0x49d3bed4663788, 0x37192aa1218df9 },
+    { 0x8a05bc92ffa3c6, 0xc38c28123ebf4d, 0xc80d547fe343a8, 0xa8d5a5b6c63516,
+      0xc5d8ce18d8fa6b, 0xeb5e87224a87c0, 0x9806e9e75bfa23, 0x11f0889689469a }
+  },
+  {
+    { 0x81005f68e75666, 0xb84d861d349505, 0xe0832829f321ea, 0xb751d7acfa33a1,
+      0x793cf6f067c550, 0x073a6b21027e56, 0x53f40ee66a6012, 0x70bfaa8c210fa9 },
+    { 0x1518e39e4b5998, 0x8f0b53024b8d9c, 0xd91c281afdf923, 0xc5cfb2824e3f69,
+      0x63a529a870871f, 0x3d3e8872128dad, 0xed658dccb30cce, 0xf9373b9afb7bae }
+  },
+  {
+    { 0x22d4dbede58ed2, 0x4fefc1d03f8789, 0x6b0a1fe344817f, 0x96bef40a56b0b2,
+      0x32684eeda249fa, 0x8298864524a91b, 0xa958baf0c736a1, 0xd033a7def2f3e5 },
+    { 0x5be3edc43f4d6a, 0x326a39d9c89abb, 0x90c44f755d997a, 0x20581066e966c2,
+      0xdbae4906548038, 0xac7bc97d473fc1, 0xb34488b4b2603a, 0x27aea275e9bb98 }
+  },
+  {
+    { 0xa59e7281b88773, 0xe2f05d40c241f6, 0xa56229e4e75749, 0x8f00c0b1b10705,
+      0x855994619394d3, 0x0d7e352aaf5e32, 0x526c462787b8ea, 0x89297d9a179d48 },
+    { 0xeff17e6ef43892, 0x17091eb221f841, 0x82f5eb34a4b848, 0x6bea4778eb7b76,
+      0x21f227176c536c, 0xd9ef2c896c81bb, 0x7c2754654bf4d3, 0x9dd4662d7c28c8 }
+  },
+  {
+    { 0xe7fff0020e1a6b, 0x26a35c6a08d467, 0xb3c773d3248c91, 0xa646615ba7d935,
+      0xa91f453b0d26fa, 0xdcf9c3460c6d32, 0x63668619e3e3dc, 0x3012813f30f3e2 },
+    { 0xac6623dc2fc61a, 0x108dc252bfd2ff, 0xd7f5c0d231d6ea, 0xa904f9aad1107e,
+      0x46941c20d1e9c8, 0xe5b6451c810cf2, 0xaba8e674f511d1, 0x5b4b94f08373fe }
+  },
+  {
+    { 0x002d4e2849c230, 0x9bed0efd8ba391, 0x745e0c0828e319, 0xcd40907ca58de2,
+      0x2c87ab11abaa4a, 0x3c17a97db64391, 0x36b184e86c72d2, 0xb03d202485f7aa },
+    { 0x2b6b79bde24aba, 0xdcb78542325fb2, 0xf5d1db966ebae2, 0x35a4d5b903840a,
+      0x7afeb09190e9da, 0x1818f6a35c1792, 0x90091fa3faa269, 0xc4ccff62570235 }
+  }
+},
+{
+  {
+    { 0xa177619ec85940, 0xfca24db7ef7eee, 0xb2450f37a90c11, 0x29d256ddbf4f85,
+      0x920c8d051316c3, 0x2f7f7ba04474da, 0x308117f2ec9a0b, 0xd0a231ad0d2085 },
+    { 0xf3288fc7ab641d, 0xc68bade9f4fa32, 0x768f014bbf8253, 0x5eff260c0a33f0,
+      0xc71b4536bb93ce, 0xa71d045680697f, 0xb62444cce72bc3, 0x11f03e8d1379f3 }
+  },
+  {
+    { 0x1f54789c16df92, 0x874c642e3ed142, 0x6699f60fa2a9f1, 0xbd1b8d33fecfc1,
+      0x59682d58a3d953, 0xf17c0214a36b81, 0xeb9621d181a666, 0x7c2c3ab3cf1ad8 },
+    { 0xe6888c3e529f7c, 0x197b66ab355315, 0x63b558a83e31ac, 0x4aa7bc5891c68e,
+      0xc17d989592e360, 0xc750a291363666, 0x0d534704909ac0, 0xd6d02724594a10 }
+  },
+  {
+    { 0x35c541b3fbb635, 0x50016d05982afa, 0x58ebce496b0ca0, 0xb940027577ea56,
+      0xf29d305e38480f, 0x43705b0ebd6a2c, 0x0e4acdae90c639, 0xbe94a29f56e05e },
+    { 0xc61f4a030659ad, 0x39074adc402211, 0xfe0d8d551b621d, 0x2d02e8dd1d5222,
+      0x05ece3c46c2683, 0xf70705ac689d41, 0xe3caf444d837bf, 0xfda058475ba6d0 }
+  },
+  {
+    { 0x1098163cb7d458, 0x12b645ff5ba834, 0x70a318128af72c, 0x5f4727ef32e5dd,
+      0x7cbae1510a21b4, 0xa80bf806785389, 0x9827402b8f93b7, 0xe385f8208349da },
+    { 0x2d054619589f6e, 0x6aa5b26e7c0191, 0xe79ae12bd5574d, 0x5d13f914148e61,
+      0x7b2be0f13716ff, 0x82b0fe680bb81f, 0x697633c3e2569c, 0x6c1f083873f8b3 }
+  },
+  {
+    { 0x6e26d850be1674, 0xe4e47f6ab8044f, 0xfdf46e882fc434, 0x639ae2cc89cadc,
+      0x2244a524b85bdc, 0xb1e4790b7cf4ea, 0x51dce037e0bb8f, 0xdd143352716cee },
+    { 0x1c049b48e8841d, 0x6bf26dcb97c621, 0x21d6255ba01178, 0x477258a8e4f0e4,
+      0xf5e437e68f8ef1, 0xd118fbc8b03e1e, 0x3d6bc51e1c91b3, 0xa259486d5b6907 }
+  },
+  {
+    { 0x4159cfc7b6f5dc, 0x05a52b3493694a, 0xeeb511c83b8883, 0x19d79e42b06400,
+      0x8e503a2738f37e, 0xa30e5795a94ad9, 0x3981c75262618d, 0x06b6c692dcba19 },
+    { 0xd7242ee4d1b051, 0x6274ccb3b350c4, 0x66df0bbf540019, 0x4d66be65ae12d5,
+      0xcea29601049cba, 0x40473398df84b3, 0x7d6c96b75a31c8, 0xbb80159874174c }
+  },
+  {
+    { 0xf0f7be059f1aa4, 0x798f39adcff451, 0x96763ff8014e1e, 0x03987a809cc5ec,
+      0x4919656893650a, 0x92e8eef75e24df, 0x54e97cde89d639, 0x8081d067682cc0 },
+    { 0xb9ef41aa8ceb71, 0xb8173a4a4d7aaa, 0x93d81b1c54ee10, 0xabe180570a445a,
+      0xac0ff9764d569d, 0x86946b23e570be, 0x8e11dd24180641, 0x3d0b33c99f67dc }
+  },
+  {
+    { 0x2c9637e48bf5a4, 0x9fdec19ccaf112, 0xe5cde9d5c42023, 0x9869620878f0cc,
+      0xcf970a21fe6eba, 0x1df5ec854e678b, 0x4667f0128d00dd, 0xfa7260db0b3fa8 },
+    { 0x6bd2895b34239b, 0x04c8bc52d2a50d, 0x14e55ef6cb23e2, 0x6440c273a278d5,
+      0xf4b12e32193046, 0x46adf645dd4c08, 0x70e29984656e8c, 0xe7b36eae4acd44 }
+  }
+},
+{
+  {
+    { 0xea64a5716cf664, 0x8497ee426fd357, 0x44d94b4814e851, 0xf4aac225a6a2cf,
+      0x947b30980c301f, 0xf390ba17865383, 0x16c4fc6d1773d3, 0x61b98146227220 },
+    { 0x07dd03a1dd0270, 0x290ca820f160df, 0x8f2205444ba955, 0x4e85e450b6f1b3,
+      0xfd73ce9ad78089, 0x67c12702f2cb0e, 0xa7de0d7ee33a61, 0x6a811cc6553261 }
+  },
+  {
+    { 0x5ef05742d0a427, 0xe8d2e95220a341, 0xdd28cbf8044886, 0xdad7b4ba1aa58b,
+      0xb28f3738ec901b, 0x1841a935bbe3db, 0x8fd7cd1a075fee, 0x93b603fc0d3cdd },
+    { 0xca54fd55edd859, 0xa4cb05f64ed687, 0x3138668ed1a3d7, 0x1224fdaee32be5,
+      0xf1f532bc80aeb3, 0xa4f65d0e8d4d69, 0xc697a015905fe5, 0x514da7a6690ce4 }
+  },
+  {
+    { 0xc7b9af83de4a55, 0xc79bad7b318d93, 0x1808071f5b1c83, 0x92112efb965b16,
+      0x655ab387bb740a, 0x53dbc8b384ff87, 0xd153c2872dc6f2, 0x2ec20e199c7819 },
+    { 0x65e46ea3b854b5, 0x272d5aec711db5, 0xfd1bb5326e19e8, 0x33280b83dc0665,
+      0x95b986eb8f1c4a, 0xa671fc4a685c4a, 0xa03cbd583bdbbf, 0xd329402ab77544 }
+  },
+  {
+    { 0x40fa6518e62b35, 0x3913b11f9e55a6, 0x4e8089b5270a41, 0x565f52a80d1886,
+      0x93b5f05512749b, 0x35c869c141c547, 0x9a44a1af86717f, 0x2b9984b9c2b2cb },
+    { 0x61fb6074952322, 0x2d4072f7af1464, 0x9b2fa8c600eb30, 0x6071fb7f10668e,
+      0x27cc24d90634ca, 0x3875bc2471d32b, 0x678590ba11210c, 0x352b447fcc5a9a }
+  },
+  {
+    { 0x795d5415fa3200, 0xadaa557a92949f, 0x42fff063cc88c4, 0x26d683171b68a5,
+      0x3286549e67ad8c, 0x5bf636386396b2, 0x41229b6e12c8ea, 0x05320c9748952e },
+    { 0xae36b63900b460, 0x9354ff2f2b6aff, 0x10b810b065ee0c, 0x4d6925fcc8bb38,
+      0x31c03fd7a22f14, 0x76b7f4457544e8, 0x3a9123cc0eed26, 0x77acd67e0cd1cc }
+  },
+  {
+    { 0x2e9053007ec527, 0x32388ef62937cf, 0xa445389e229188, 0xa44b68e33bcebe,
+      0x5a8722e4c4e701, 0xfd066e8cf07e41, 0xa3c1a4f95fab62, 0xb4d6a1be542f24 },
+    { 0xe6a92e4af6c9b5, 0x9452484c83d61d, 0x422b55b0062276, 0x261973a5279688,
+      0xde8be263999fb2, 0x64e96287b029ca, 0xd8edfaa06897d4, 0x408319c6955511 }
+  },
+  {
+    { 0xff6baed50a5632, 0x922b7d05c5885a, 0xdf0f3b31b45864, 0x27e49c0c04340e,
+      0x618c566122c447, 0x7863a38eafee7e, 0x7143affb828cb0, 0x51fcf4cf9d054e },
+    { 0xc4a4b3127f5e09, 0x021f47a90be2bd, 0x1a060197ab956d, 0xe77fa1586ea86b,
+      0x9ccde87d550ef3, 0x7dee53a6532654, 0x8b4f060e826387, 0xda38637ad077b5 }
+  },
+  {
+    { 0xbc901b30e9fac8, 0xfa082046fb2a2a, 0x92f68ab5e04efc, 0x184a30a9ac12d0,
+      0x1aa11aab25d479, 0x8bc5f4c0f03161, 0x7e3a083cfc8817, 0x84d9355597f93f },
+    { 0xc014478239abc6, 0xb226b098d37b04, 0xb056942f575789, 0x816b95aba745eb,
+      0x2a49d39b98ddb6, 0xc41ca26291af81, 0xb3afe99ab26347, 0x59c31bc604b638 }
+  }
+},
+{
+  {
+    { 0xa16a8b9c42befd, 0x731c9c92052f00, 0x1ad49b41f5dfa0, 0x7a289e3bffce36,
+      0x868fac00c79cf1, 0x6d6d28486721ab, 0x590f928e726c94, 0x0e802cb51f3841 },
+    { 0x6a6a57a0b694bc, 0xb9bb0cd8120fb8, 0xad96ac79c05826, 0x294da8c7768df0,
+      0xfe32311b56c6c6, 0x291c2c6ae8d050, 0x1c765e7e7db4c9, 0xe058298d65f9f7 }
+  },
+  {
+    { 0x4bfa85b7e8d345, 0xa04ef95de1dfc8, 0xb5f7f21324ace3, 0x4b350a1574b14a,
+      0x11436bff8e5c8d, 0x1c789f97642369, 0xeb5e335fb623ce, 0x9deacd2442d562 },
+    { 0x4ff989f531ee71, 0x43e2c49aacb52a, 0xa76319885bfadc, 0x08b6d5cd0161a0,
+      0x010e3fa541f197, 0x83a589e3279a16, 0xf0991376309f9b, 0x07c093bf1cea10 }
+  },
+  {
+    { 0x1ce3f0f33d2192, 0x07b559ac37ce73, 0xaa2ad38207be27, 0x84f053b7ed93de,
+      0xbc5c7973b98a4b, 0xc92346163aa9b9, 0x807cc16231a10c, 0x8ffdf57a061209 },
+    { 0xa9ca741497070f, 0xf608ec9d113b3a, 0x51327268d0384d, 0x96686acf5ec307,
+      0x437bbbd71c4665, 0xdef09d57c379ca, 0xf8be033621747c, 0x2775b378ae8047 }
+  },
+  {
+    { 0x4009798b2c4fc2, 0x148d7d1203772e, 0x9d9392df8423fb, 0xa5bd72eaf8cef4,
+      0x579d58d4380b53, 0x2ff88f18c39d24, 0x9ca2fbc5706466, 0xb42987d1e56af2 },
+    { 0xcc2556e5d94ea8, 0x4e5c2b35369d76, 0x5de35742a94f9c, 0x8d068c95cb4145,
+      0x4d553ff51bfcbf, 0x3ab71648a23fce, 0xc9cb3a9d0fa7f3, 0xf81209bed9ced1 }
+  },
+  {
+    { 0xde7356ee5b66f5, 0x7b2bf1ae8a25e0, 0x09a444a2c9b725, 0xfd8a2f44906c55,
+      0x409cc8082514f3, 0x47e009928999a9, 0x0a582a66a312f4, 0xf7946f8f6723de },
+    { 0xa55f6ba92d8aff, 0xb62c3c8a544b1c, 0xa1d14115c16a94, 0xc3783192ad5e71,
+      0x13d784706b1dd6, 0x99005f8ee7ff55, 0xfb5ea3f8a1e7d8, 0xdc7f53cb4cac39 }
+  },
+  {
+    { 0x482abaf36e3794, 0xc23e9e5c74684f, 0x4544cf6f1629be, 0xd8a8ee52f40374,
+      0x2eea87ff433bdb, 0x489a99cae9990e, 0xefc131e54b23b6, 0x25fe6998600270 },
+    { 0x03d2d9ec059a7e, 0xa6445b56979c3c, 0x491a10c9bfbcea, 0x15b5974e937af1,
+      0x4be8002797c7fc, 0xbed8a49fedcfee, 0x35751cea9e0691, 0xe9a9fa39ef5982 }
+  },
+  {
+    { 0xeffeaca3065de7, 0x841d544ac4d4e2, 0x8144679caf199f, 0x98cf4f9443967a,
+      0x8cd57f4f33183c, 0x390832ac1b15eb, 0xc4b1feaa53b500, 0xd762a10dff24b5 },
+    { 0xccd3eedb0ee2a9, 0xa6dd4a9362d485, 0xeb4ff26f1d047a, 0xc0771fd23860fc,
+      0xdbb4e394b64114, 0x2ff3f244d29b29, 0x9cac005387b365, 0x05b7aa6de5994a }
+  },
+  {
+    { 0x5e71752c03dd63, 0xad10fe9bc74687, 0x51a5b0c54c76ab, 0x763fd501f586d4,
+      0xc7bd5ce816048b, 0x8fc83d23f744dc, 0x0561802109df9a, 0x18fb01fccf0e43 },
+    { 0xe4606fc038ab23, 0x5878f1fa664c98, 0x3aedbbd5da7356, 0x3c578f5516746a,
+      0x259477f1a17210, 0xc7a869d028248f, 0x6517a6148cbf95, 0xbc5f91d3d04d47 }
+  }
+},
+{
+  {
+    { 0x15fd9a9083ca53, 0x1161da02697ca6, 0xf516af356b676c, 0x8a420d575eec13,
+      0x72d67421a9526b, 0x8d8c29e76b463f, 0x38a4f588815627, 0xf7e528be0650f9 },
+    { 0x2cfa78e382edca, 0x638d183c4ad83c, 0x96d3b9de4a0119, 0x5769ccba7c1101,
+      0xc3b3b792b8d04a, 0x96212f64951bde, 0xad7905a481161e, 0x8fd676241c5edf }
+  },
+  {
+    { 0xf7b063539d6cde, 0x69d0549115a84a, 0x4a976c6cbd9fe4, 0xc92953f950ff96,
+      0x1d7f0fe654d127, 0x7293870da0f75d, 0x7bb3652cf2277f, 0x64798c9834484f },
+    { 0xb94d8bfac3a76c, 0xf5721a97ff776b, 0x23a6e9f2722e31, 0xe9da9969a5c034,
+      0xb9bbf83456ebc3, 0x239f58a96956a4, 0x8b75beb18b7f00, 0x6c2b5b8a51cb97 }
+  },
+  {
+    { 0x78b1c627eb41f3, 0x0638fcf17c4352, 0x939edd80c5709c, 0x0a8dfc3edc906c,
+      0x3942f47efb01ed, 0x4c8275749986fe, 0x792545c4dffa57, 0xeee68836c3ff26 },
+    { 0x824d08e12b1218, 0x515a478902457f, 0xc70cc9cbae55b3, 0x1240737bcef9d4,
+      0xf22e6162f9db7f, 0x98c4f0291f8da2, 0xa89219cafaaa67, 0xf35fd87e7d27e2 }
+  },
+  {
+    { 0x19b0cd701b80d0, 0x3d7e29df9aebd1, 0xd39c9ca0477cbc, 0xac0f6155ff0d3d,
+      0x8a51993520fd01, 0x508ff54b22d6fb, 0x8786c47318d3ab, 0x4312c464a683f8 },
+    { 0x73b1d3995359f6, 0x0d94fa5963011e, 0x5723af29bfe83e, 0xafa90016841df3,
+      0x791e92ab7c498a, 0xbc931ad7ea4253, 0x438e016b783c06, 0x1347db22ca662b }
+  },
+  {
+    { 0x41df37dfbaa861, 0x98ecb23329e4de, 0xdaf1560507e018, 0xa902269b088e32,
+      0xad898a5e4cab2f, 0xd84e9ed02c1e1b, 0xc20a5d58488af3, 0xc7165af6cc77c6 },
+    { 0x8526f3adeb7461, 0x03577b14a2d332, 0x28e469de4760b5, 0x442c7f9b276266,
+      0x90d5c77f9c90fa, 0x7aa87163e211bd, 0x56d8ff05decfd6, 0xa204b56ee23e6e }
+  },
+  {
+    { 0x2e4374e4aceafc, 0x978743b6fcd5e5, 0xa0f6345c4855ca, 0x9bc7e4fe98074b,
+      0x3835d57c33d08a, 0xeec7c8b6f00566, 0x71628a21acf55c, 0x5da375097fb19e },
+    { 0x6904a8e01a7125, 0xad33c85e6e3780, 0x1702928c19f94a, 0xb424ff27c04b3d,
+      0xb212e3919e2ba3, 0x4cca8e8c9af4c9, 0x98ab7aefd9bf0e, 0x21d245d9799db5 }
+  },
+  {
+    { 0x6b034dcec08806, 0xfd763f2b40f2d9, 0x5e16de029cb906, 0x02b70148a0e16a,
+      0x463c8eee071e12, 0x644728125ad509, 0x9ee6f2ddc0e07a, 0x188895c68d4d97 },
+    { 0x092fff3b27f971, 0xb3c159fc9b7722, 0xe27d8ff3cae42d, 0xf8a5ed6e87071d,
+      0x318388f607ebd2, 0x924967b53486f1, 0x77304947c46e1f, 0xf279c60f21d196 }
+  },
+  {
+    { 0xef2bc0384f3201, 0xf8750c71f94c51, 0xbaa4f5a986ec65, 0x6f8a5de2732a33,
+      0x0f13d80299e365, 0x2709530e85261f, 0x097d922f527d56, 0x4969687be1f3f8 },
+    { 0x9f3f5043e1708d, 0xac67b874aa4be4, 0x75fb042320a87e, 0xa361ad36e2cad6,
+      0xcb01470203e9f6, 0xe3807b7c9b76c6, 0xf086833b907c09, 0xe9bed3c7e85a01 }
+  }
+},
+{
+  {
+    { 0xa7ea98991780c7, 0x04e4eccd2476b6, 0x0af9f58c494b68, 0xe0f269fdee64fd,
+      0x85a61f6021bd26, 0xc265c35b5d284b, 0x58755ea3775afd, 0x617f1742ecf2c6 },
+    { 0x50109e25ec556a, 0x235366bfd57e39, 0x7b3c97644b6b2e, 0xf7f9e82b2b7b9c,
+      0xb6196ab0ec6409, 0x88f1d160a20d9e, 0xe3be3b4586f761, 0x9983c26e26395d }
+  },
+  {
+    { 0x1d7605c6909ee2, 0xfc4d970995ec8a, 0x2d82e9dcf2b361, 0x07f0ef61225f55,
+      0xa240c13aee9c55, 0xd449d1e5627b54, 0x07164a73a44575, 0x61a15fdbd4bd71 },
+    { 0x30696b9d3a9fe4, 0x68308c77e7e326, 0x3ac222bce0b8c8, 0x83ee319304db8e,
+      0xeca503b5e5db0b, 0x78a8dceb1c6539, 0x4a8b05e2d256bc, 0xa1c3cb8bd9fd57 }
+  },
+  {
+    { 0x5685531d95aa96, 0xc6f11746bd51ff, 0xb38308ac9c2343, 0x52ee64a2921841,
+      0x60809c478f3b01, 0xe297a99ae403ac, 0x7edc18fcb09a5b, 0x4808bcb81ac92a },
+    { 0x3ec1bb234dc89a, 0x1e8b42e4e39da5, 0xde67d5ee526486, 0x237654876f0684,
+      0x0a583bd285a3dd, 0x3d8b87dfe9b009, 0x45bd7360413979, 0xb5d5f9038a727f }
+  },
+  {
+    { 0x7b8820f4bde3ee, 0xea712ef24d5170, 0x517f88cdf6ec7b, 0xb15cecf983ea9a,
+      0x9eeee4431a4592, 0x786c784ebb013e, 0x2f06cb31f4e15d, 0x5603fd84f4fda1 },
+    { 0xf6790e99e1321f, 0x274c66a74a4c09, 0xa4b70b49a41a4e, 0x7700bddada5157,
+      0xe54a60d51be8dc, 0xfaf92761a477e0, 0x6661c72b027eac, 0x50e2340280b917 }
+  },
+  {
+    { 0x635f40f96ec123, 0x4a331337a766a4, 0x9ce4416b935587, 0xbb6e1f595d97e4,
+      0x26147239d4197d, 0xabd4478490e896, 0xf6a1b2a8bba895, 0x401fa405e27a45 },
+    { 0x7354ba50620900, 0xc443a29385678b, 0x48aba1053cf5fa, 0xd67e723bbe152d,
+      0x4b858e02a63d68, 0x174e1ee72be4ee, 0xad0fbb39ab8d46, 0xa0fdffbce17dd7 }
+  },
+  {
+    { 0xa1ea3259c46fd8, 0xeca122e9fb96ef, 0xf9074a26767acd, 0x9b004a22787082,
+      0x389f8077f3ba8e, 0x6463de90d5aabe, 0xf30ceaab090585, 0x71b31e85634ab8 },
+    { 0x0dee65caf02aed, 0x506886e20ac252, 0x0665f7886b8a59, 0xb9b784df2bb328,
+      0x46e443adc6b089, 0x3d5de1966c27fd, 0x0419265f0fde70, 0xed946122b5c034 }
+  },
+  {
+    { 0x5a52ad213b0056, 0x9fbeb92b909ee3, 0xb42ba18bdaab08, 0xec127c4ffc8a77,
+      0xc6d2985fda906a, 0x5355547994bbe7, 0xa7470c09cdfd62, 0x31a3971d2e675a },
+    { 0x8d8311ccc8b356, 0xabb0bf801b4372, 0x33c1cad0294566, 0xe2e649ce07b672,
+      0x9084d882ae3284, 0x7a90d4c1835ce2, 0xb4d1cd5809d44c, 0x78227149f0528f }
+  },
+  {
+    { 0xca884cfbf5844b, 0x9dd05c48524cf9, 0xdbffa1936ba889, 0xef94fdd29e7666,
+      0x358f81b3eaf48f, 0x96734d51530d56, 0x378b2d14adf9e5, 0x2f850464731f61 },
+    { 0xd6ae90599dcb83, 0xa4f89e06199239, 0x64052498f0f958, 0x2866d99cc27707,
+      0x64681a2f551c0f, 0x2c7b0d04c37080, 0x218925b00ac301, 0x8d57fb354df895 }
+  }
+},
+{
+  {
+    { 0xdaebde0809c8d7, 0x58c761c0e95ea1, 0xbd9965000ae5e2, 0x6117a85cd51acd,
+      0xc4424d87c55d56, 0xe9b1ddedfbeeaf, 0xda98bb50db4791, 0xff3a5a63fca108 },
+    { 0x172fb8e5ccbea1, 0x9fe12a7a9f6cc9, 0x1de4b0b8967ce2, 0xc1ab60f671dbc6,
+      0x338385a5dedcda, 0x647a4203a043fe, 0xe9abc6428ebc89, 0xc357ff003ba3c8 }
+  },
+  {
+    { 0x37061e7de39ebd, 0xebb91352be567a, 0xa9a6f6bd6bb80a, 0x039345d99f0ba2,
+      0x215494e98bbf47, 0xf2cb7a4a2a1ccb, 0xf51aa1037f67c9, 0xd29c85c17fff71 },
+    { 0x8d4e4f24d30b87, 0x20fdf5593a8309, 0x9b9f9cf757075c, 0x09142adcd70101,
+      0x901d0ee766ca55, 0x6a5d86a32e418b, 0x550ad92d7fcaec, 0x64e8818d91b26e }
+  },
+  {
+    { 0x5cea0f747e5ee5, 0x8ca1d31be99699, 0x52db8465c136c7, 0x8cecb3890e0d74,
+      0xb8efe9dede2ad8, 0x18d6ff8f17ade8, 0xd2227352d66c20, 0xc46593ef2005fd },
+    { 0xe5ebe6ff7141e1, 0xc968315e0126f2, 0x95adc731cb91b6, 0x753b54c38a6003,
+      0xa6141254230a61, 0x23ac6eb559fece, 0x9816b603865c23, 0x567014e543a570 }
+  },
+  {
+    { 0xd46091ddd2b71f, 0x3999a5d97d24ff, 0xce2a4f11ecff3c, 0xab2687c581c6f0,
+      0xa9fb2ebcba70b4, 0x6fde35642093e1, 0x00253ecaee724a, 0xa08ce3c2b81bdd },
+    { 0xa251238935a2b3, 0x8cae1d4584f750, 0x011469e988a219, 0x61f7ed35a6a50e,
+      0xe13ebaa01fcebd, 0x794b97631d8867, 0xf25755ccda32e7, 0x368a97b4564cd1 }
+  },
+  {
+    { 0x0d22224aa3397b, 0x1dbb3e638066db, 0xfe0b5ee0ce8e32, 0x09c17c87bab4dc,
+      0x5cc65ddf188b64, 0x74c4abf211b5fa, 0xdcc17b7ab0ba86, 0xfbdf46fa535501 },
+    { 0x4775087aca569e, 0x6575f9006a1718, 0xb5c45a9b94de93, 0x0fc80068497171,
+      0x775d965489f7ab, 0x8775b58f5c0c89, 0x05d4e201a06254, 0x8cab349b6d73a5 }
+  },
+  {
+    { 0xca7816339465b0, 0x3ef914814498fd, 0x9ca1f346255c11, 0x389fd15b7f38f1,
+      0xdac2089354b8f3, 0x82d07fca840a70, 0xf53fd731dd483a, 0xa6e4eae1590578 },
+    { 0x7bf65af3c01b77, 0x27542f3a75c982, 0xc5bd947716cfce, 0xba5fe76884b9e7,
+      0x39bae14d55725d, 0x982f64efae0eab, 0xcfae6627a5293a, 0x22a25a1d60f464 }
+  },
+  {
+    { 0x74caecc7dd5e16, 0x23678a2ce7bca3, 0x467393257f1ba1, 0x4eb9948a4c1697,
+      0x5d400e8eaba18d, 0x128d1c89807871, 0x78f9627bff38a6, 0xf80b813a39d4cc },
+    { 0x8aeefa031d3aad, 0x504219927db664, 0x244fc694cb6383, 0x319047772192a3,
+      0xcc86075bbfb57b, 0xbae3a134451511, 0x16cf416f6174f0, 0xb343cc0d376813 }
+  },
+  {
+    { 0x31ac9b9d1824b7, 0x6282260ec8f61a, 0xbbeb9f8c781765, 0x06ab5c02d110da,
+      0xd583e2247146b8, 0x79a16084100d05, 0x16dbbb4f0a5c95, 0xfe2af1de331667 },
+    { 0x26f0364af8710e, 0x1cb8c91eec08fe, 0x436bce61d95e9f, 0xfe9050c57944a0,
+      0x5f45acf07b626b, 0x48dc93f9cf1276, 0x4491371a05bfb7, 0x51063044bcf785 }
+  }
+},
+{
+  {
+    { 0xac2e294ed0b3b6, 0x5c5ade6671637b, 0x2f289ce1140677, 0xaf446e2754eb53,
+      0x70911b720421ad, 0x4b73836e0b7556, 0xcadf1042a97827, 0x4824e498005bc6 },
+    { 0xb0eeccd937c28a, 0x1ce061d0c3ee97, 0xcb076319f33faa, 0x9980bf4aea66dc,
+      0x2bd0755d111d98, 0x43feaf67fe4de0, 0xe76fb80b077b2f, 0x227dc9f5793b04 }
+  },
+  {
+    { 0xea24ae514f49ba, 0xbc39ea611436e7, 0x9d7fed278485d8, 0xb6ef00cdf8b131,
+      0x0237b4bfdbc7af, 0x08745b564ccd27, 0xaf8595dafc5a76, 0x43657af29f5500 },
+    { 0x300718348470f8, 0x51f91fd640fd53, 0x859c807be15512, 0x7d1a474ab3e9c5,
+      0x5d714d981553e5, 0x07573436f62310, 0xedc5be06b02a62, 0x5a4b9b7ea47832 }
+  },
+  {
+    { 0x03e0a24e93dbb3, 0x25841dccadc884, 0xabc1a818d10ad5, 0x207e38a2042ddd,
+      0x7fffbdbfeba8d8, 0x74efebba3ec9b5, 0x0bc39ca0b40a9f, 0x69ee9c90267feb },
+    { 0xd402facbc62919, 0xe9f8fc11cf53c6, 0xe76fa5a7cc7d81, 0x4f2d87696bb19d,
+      0xd4fb7f9adc67c7, 0x40621d596702dc, 0x5b6a98e438f6c5, 0xa7c64def1a1036 }
+  },
+  {
+    { 0x84c5e809a092c7, 0x9e40e0a11c22b7, 0x820a091d06c99b, 0x45fdc77eecca8f,
+      0xfe1b8a35794f16, 0x31f7e5b4ce3d6d, 0xfd5e01082c74c8, 0xfdabf30c1f6f7d },
+    { 0xbfa6017b9248a0, 0xe898d30546b941, 0x878c492207ff65, 0xbf22e8db874e64,
+      0x43fdb1b53a547e, 0xb66deda5fbd464, 0x59127a6c7ae1b5, 0xa4636466a7515a }
+  },
+  {
+    { 0x22c4e66de9ab2e, 0xfaf60c20203c58, 0xed2d7bf0d5c5ed, 0xdbc16fe4ca0f19,
+      0x54e8ef6465b979, 0xe2d64b1a310ef9, 0xa0f2c953778636, 0xf3b4aa4281883b },
+    { 0x4ac9af09be6629, 0xba455e11ca90c5, 0x0147538856f492, 0xc80db7eabd7840,
+      0xb3526d96beb9cd, 0x37657fb9d81503, 0x8729a16193cec3, 0xd9a93fbd69952a }
+  },
+  {
+    { 0xfce017594f47c6, 0x228da21e366d05, 0x27ce0b2dc8baf3, 0x8cc660b6b4a951,
+      0xf678947384bb01, 0xc629d7d44d980c, 0x47980e4e85e81f, 0xa2e636a1cd723e },
+    { 0x6b6ebae77fb207, 0x70179614c92891, 0x5569541b4d279c, 0xbb6b36a41758cb,
+      0xecaa22227a8e30, 0x8b6746ab470ad9, 0x4c4601763e2d3d, 0xe19c4edd3edaec }
+  },
+  {
+    { 0x0b43fec34718c8, 0x553c407f33499f, 0x8272efb970d1db, 0x008c62ca8e8d1c,
+      0xe4b79d763eec45, 0x1fd4230f2d71a3, 0x090fdafa368c36, 0xf62c101fca7baa },
+    { 0x1c9e6c8d2395b3, 0x671ed6304c5513, 0x577d933299a465, 0x286890e63f9986,
+      0xd92a95dbfc979c, 0xcebd79d2b51019, 0xe74d88b3d07251, 0x8b6db73906f9ad }
+  },
+  {
+    { 0xc0c43db7b3d90c, 0x85d154e4304a06, 0xe8aceefaf2f38e, 0x5e0429383d9459,
+      0x65e5e32431afd1, 0x9e5f050a900a65, 0xcbaa1718a26671, 0x33d0b249c93de7 },
+    { 0x3dcbf92d5b6680, 0xc47e5ec20006f9, 0xc9711299a51924, 0x665d9b8cd0ed46,
+      0xed2d63fa5fcab6, 0xa817eb6cfbfc5a, 0xb38169fb76eb76, 0x8b93544f11160b }
+  }
+},
+{
+  {
+    { 0x02eca52693bdcd, 0xbbf09232ae01d6, 0x0b0a2de8b44b3e, 0xdb82449b250dff,
+      0x0c42b866e1c530, 0xcd226dca64c2c4, 0xcfb2bb1f046b5f, 0x97e2fae3fccb0d },
+    { 0xdf9290745ed156, 0x224dcb9f641229, 0x2126abc5f1f67e, 0xa7eed5ae9c8a6b,
+      0x40abedc9857d9b, 0x3f9c7f6de941c6, 0x2158d42d725ddf, 0xbdd10158c69543 }
+  },
+  {
+    { 0xa7dd24e8df2fbc, 0x3adbcfd13d1aee, 0xf6a32d113b2177, 0x89a72327a9a14c,
+      0xe3aef43dc65df9, 0xeaec3e3a64d74c, 0x4d387d84fec33b, 0xaba2a0521a2128 },
+    { 0x2382c226b85e30, 0x4352d85cd2aad3, 0xb0c6001d9772c4, 0x7ed82635f3653f,
+      0x3626a6f0300f47, 0x23909de6ca7e4e, 0xb43dd81c154141, 0x9a49fad7e4bc68 }
+  },
+  {
+    { 0xa3661df2428f88, 0xbe48b0256e0db2, 0x3cd1871ce79aa9, 0x90ab87123dddac,
+      0x9c58fb971871a6, 0xf031f7fa34910e, 0xb501eea81060e4, 0xdb668ba791224e },
+    { 0x240bbcb6a705bc, 0x7e76fbd2d1865e, 0x6e2cd022513641, 0xe6c522546365c9,
+      0xe46a8b8a5a01fb, 0x696fa7bb67618b, 0x418b3b90db6792, 0x7204acd7108b9c }
+  },
+  {
+    { 0xb5a143b8456b45, 0x8a3ab25f53b4d9, 0xb112a58e13a570, 0x613ca3281487d2,
+      0x837d8233b1e7c9, 0x592baded41e9d5, 0xdc1893a5cd02f2, 0x08795028972e23 },
+    { 0x7003c08cb76261, 0x14bde9e332a5e0, 0x14b2872cbbd78e, 0x5594061de238e8,
+      0xad12645067466c, 0xa8d0e64f5e4952, 0x5b44b82c7f8d06, 0xb51bea8fb1b828 }
+  },
+  {
+    { 0xebad6853f0dacc, 0x5c31b8b1cbebbc, 0x6746975fa5a2dc, 0x2d9596531d9faa,
+      0x343797d00fc0e4, 0x38d821c55fe01b, 0x0bfdb247323aa0, 0x42613c4f962a8e },
+    { 0x599a211e134bc0, 0x75fa4a147a7084, 0x6e719487f734b5, 0xd5ced2d6dfca2b,
+      0x9fa0fdc8aeabd2, 0x5e6b03f12361da, 0xad23d315859fcf, 0x3120ef125a5fc8 }
+  },
+  {
+    { 0x990ef628e9f638, 0xfdaa240626a60c, 0x4a3de202abddab, 0xd5d10b7d8872b2,
+      0xa01b7301ea5880, 0x481697fa81b9d8, 0x29841533471ed8, 0xefd73f8292d37c },
+    { 0xdda76269994beb, 0xa0377036a4f865, 0xda992ece5b47d5, 0x912a427e53edba,
+      0x64675989264e45, 0xd3b68c3af71222, 0x9d3436c6dedc5f, 0x1e027af076b2ad }
+  },
+  {
+    { 0xd56fca14382f4a, 0x83712a48966b7b, 0xd6b2cf5a4c9ddb, 0xa66be29f602875,
+      0x70e4266894f3d0, 0x007d220b3195ca, 0xba38d8f82c74d4, 0xdccc5fcd975cbd },
+    { 0x03e1610c88b38b, 0xeb9f9a152e0d8d, 0x6a57ecab646eb7, 0x161641fc76b6c1,
+      0xf9025adbd2e12b, 0x87c74db5c0e26d, 0xed5cb51bfeca74, 0x603dfb6e34a08c }
+  },
+  {
+    { 0xc4be728cb03307, 0xde34c0ec2741cc, 0xe01db05a74eb17, 0x1bfce0c8905e4b,
+      0xb18830ad1b1826, 0xcacbb41e87bbfb, 0x8696842d2f1a79, 0xa80e5fb08c83ea },
+    { 0xe48f1633f1439c, 0xc1d4108cd6987b, 0x05705c4b751814, 0xa9bffd0c1c622d,
+      0x23de4af46cd053, 0xf782f5e39457c3, 0x815276b5e5d243, 0x31320416161ae3 }
+  }
+},
+{
+  {
+    { 0x245966177f2542, 0x203be7e8372b25, 0xc7c9426ee2007b, 0xc5641380621799,
+      0xda56589c28c3ce, 0x13e8a7c7afc1e3, 0xdba81e9e352082, 0xf43054904435c7 },
+    { 0x4d26533691de4a, 0x364408cfb777ab, 0xccdfb43eae7f88, 0xbc40f44a525b11,
+      0x8e112a53c60627, 0x7f7c581e17e696, 0x0fd78781ea774a, 0xd09e6320b1f582 }
+  },
+  {
+    { 0x44390bd70aab15, 0x41112bc889c3f2, 0x6b02894d685349, 0x71030015584dfe,
+      0x373cb1b1ba7887, 0x53d286c2a017c7, 0x2ed03883c81fdc, 0x3bfc5e3fbcc6fc },
+    { 0xd38ac6ffd6418d, 0xc667e96bfad89e, 0x46f4f77eab4d66, 0x194c04f0911293,
+      0x0fd09cf68c48d5, 0x6f5b05563cf7f4, 0x0c0a8c4acd562f, 0x94c1d8336d965d }
+  },
+  {
+    { 0x94fc8f0caa127a, 0xc762d5dd803690, 0x8bfdfd11ebf0d3, 0xa98cdf248eac50,
+      0x3d7365d8b5ff10, 0x20dc29bc65b4de, 0x62ac28e8ec7c68, 0x7f5a13290372d2 },
+    { 0xf3d8a253246658, 0xa4bebd39ac202a, 0x078ede75cc1697, 0x5525800c8fc022,
+      0x302a8025fae77b, 0x018013957917b6, 0x7c8806d864bf55, 0x4e2d87812f06f1 }
+  },
+  {
+    { 0x8d351183d66e88, 0xfb861a1a91d02a, 0x8c27c2a7850e5f, 0x9fd6399a5496f6,
+      0x52152ae8080049, 0x600e2fffd1c2dc, 0xc75902affe8b2e, 0x5c4d2cce03b175 },
+    { 0x8ad7c424f57e78, 0x77cf6061736f87, 0x2876012f85038a, 0xff328451b97b95,
+      0x3cc6dd5392dfc8, 0x72f1363a6f5075, 0x028ec4471de894, 0x7030f2f6f45a86 }
+  },
+  {
+    { 0x66400f59695817, 0xeda0a7df20ea36, 0x855be51d394992, 0x2d082c18336f62,
+      0x30944ddf28c868, 0xfb5f8530dc86d0, 0x9562ae5564a0bd, 0x1f7ea12b6b9b51 },
+    { 0x5bd74e0d0a7148, 0x6c8247fb91e572, 0x699aba547da498, 0xed825811f7c814,
+      0x434674b62057b9, 0x8b4df5e15c15b4, 0x2a97da1b110081, 0x2a96b0c4c417fe }
+  },
+  {
+    { 0x4f75dfc237639d, 0xe5ad6bc1db7029, 0xd43e06eb3d28f7, 0x89f3bb5e447989,
+      0xc426a2c01a1a6e, 0x33ea71c315878f, 0x8a7784ab1b5705, 0xa59e86e77ca811 },
+    { 0xddb133c36ae155, 0x49f1d4c0d51b42, 0x55080829d05519, 0x20e23be5291816,
+      0x35047ec67181ec, 0x6237dc47aad091, 0xa1d3ce1e2e25a2, 0x1de05220d3db4c }
+  },
+  {
+    { 0xe9a5e19d9fd423, 0x0c2c3d09801e43, 0x043c2dd28df2da, 0x4eecab4e1ad12a,
+      0x97e17979615aa5, 0xe57b879ca7bb5e, 0xa2a903ccc92619, 0x5cef370aa56e93 },
+    { 0xbef29fa7f3232c, 0x1cf35ed2b7ad5c, 0x35c48933b6077a, 0xe0651487a1d47d,
+      0xedb4673ce14572, 0xdc9e98c0b17629, 0xef98ebe9a02a5c, 0x1f772e311d03c0 }
+  },
+  {
+    { 0xcbdbdcd4608f72, 0xb4352235a13c6f, 0xa6497f64bb3c21, 0x3af238312c15c9,
+      0xfbbf4b36322d11, 0x520a5c6c641775, 0x18cd967e81e0e1, 0x980b2c63de3871 },
+    { 0xfa9db619ae44a2, 0x0281dd2176bc56, 0xfd037118a7f817, 0x9c485454129b30,
+      0xb439648039626d, 0x355050ee4ada6b, 0xc9c16d67f5d98c, 0xf53ccc318c4d5e }
+  }
+},
+{
+  {
+    { 0x50ae9423ffb20b, 0xa6c0b426865eb4, 0x4677f7d09930f1, 0x742e0b64a16427,
+      0x521d18ef976f9a, 0x43ac9cfa454749, 0xda3a91dc51f50d, 0xf657029ad6f954 },
+    { 0xfe5f0646b4f99a, 0xd92a5d963ad4ce, 0xfcb55092e0e081, 0xadc85ab8d8a858,
+      0x8e9b9660632f0f, 0xe7a4f168d7216d, 0x00a4cc559c3b99, 0xed6d0bdba09dc1 }
+  },
+  {
+    { 0x7236d141621beb, 0x1751fd4bc7ca95, 0xaa619d12f5319c, 0xfc2b15b4e9316f,
+      0x2d1a9069fd4d33, 0x28c3bac8ced829, 0xf2efab51dd998f, 0x2c133303b149ed },
+    { 0x65237c9f601ac6, 0xb54dd6507d6a45, 0xa1ce391fb1a4cf, 0x2957533115f67e,
+      0x6456da8465279b, 0x02890aaa993e02, 0x6891853b7175e4, 0x3fda2030f3e59b }
+  },
+  {
+    { 0xe99fe12d8c6e0b, 0x7cb07ff5341c56, 0xc292c7bdf77b24, 0xf52dfd0ca29906,
+      0x4a6aa26772f02c, 0x26f7684e1bbd09, 0xec56b2bee7c2a8, 0x67709e6ad4a312 },
+    { 0x99c57b2c570263, 0xeb0100b2faafae, 0x980d5d1ff25eca, 0xace35e682cf936,
+      0x5a82ce544679ed, 0x5c76a41074b81e, 0xf36fa43a00abb1, 0x064281904ffb2d }
+  },
+  {
+    { 0x68f6bc804bdd28, 0xc311d96b5dc7ad, 0xff0d646ed32e45, 0xaf3cdc6e0f712d,
+      0xd4508e9d483861, 0xb624be50e1c277, 0xc510275c5dd841, 0x451c5c3298dc02 },
+    { 0xf87d479dd34d6b, 0xda7f293dd06a38, 0x575e129b699e9f, 0x79e5fb2215b2cc,
+      0xd280028657e690, 0x7fecd09e702a71, 0x85160abfa13677, 0x5de3427ce65f64 }
+  },
+  {
+    { 0x84e4bf6e8fff38, 0x16f3725b358b1c, 0x360371c3b472a5, 0xe64c06152f217a,
+      0x8e673790501241, 0x88e81d6ab2dd96, 0xf3e218a1385604, 0x9736cafe84184d },
+    { 0xb55a043dbb93a3, 0x335088f9301088, 0xcea7a2db2a4959, 0x48e5d4ab882c33,
+      0x114f09bad46179, 0x4416467b446576, 0x01cb23e34c6c2f, 0xddebf04a02db8a }
+  },
+  {
+    { 0x36d60cc9bde8a1, 0x20fd2f2676e4ad, 0xebdcfb78936581, 0x245d0d5dbfc2c3,
+      0x104c62ca9f82e5, 0x7387457d654d9b, 0xe966777ae7f10e, 0xefeb16f1d8e582 },
+    { 0x4faf4f170364b5, 0x0e1ab58d612472, 0x11bbfe7fed6085, 0xb360a14a59a09a,
+      0x61d96e9722fdb6, 0x16a12f194068bd, 0x225bf07f73c2be, 0x1e64665c8bd24e }
+  },
+  {
+    { 0x27a478a3698c75, 0x778ccd36202aa2, 0x0149c638d87f1f, 0xa660e5f784edae,
+      0xe0d4d2f82adfa8, 0xf512dd61ba1f9d, 0x90cfed96245c58, 0x6c3a54818b53dd },
+    { 0x833f70cbdc094f, 0xa5f26f5b1514e7, 0x93e7cf51c8cf13, 0x1436601186ec43,
+      0x81924ace78170a, 0xcc880a08694368, 0x2dfa9550b62cbb, 0x0bc6aa496b4a2c }
+  },
+  {
+    { 0x5157a7e3561aa2, 0x525c5008645c1e, 0x22feb4ece7cbb3, 0x36d0d25c89a58b,
+      0x43131f7c9bde9c, 0x74afdda881f731, 0x99ab87c7c8e36a, 0xf07a476c1d4fb2 },
+    { 0x1b82056bebc606, 0x95a1e5afcf089f, 0xc5bccfa2b55d5c, 0x8fbc18e00eb0b1,
+      0x93a06fe9efb483, 0xcafd7252d74c57, 0xc7518f03de4350, 0x9a719bfc6fd762 }
+  }
+},
+{
+  {
+    { 0x5ee0d832362087, 0x7f2c0d70b167e8, 0xb7327895e0e865, 0xef5b2e898c4e65,
+      0x222797d8fe9cc1, 0xfe6d73e82d1e15, 0xc7c0e9cf62dc4b, 0x962acfe937ceda },
+    { 0xd763711c1e85c7, 0x8f2dbbc2836978, 0xbadc0558c44e98, 0xed63eaba3e93f8,
+      0x807e85741b55c7, 0xd51ae5e6d1207b, 0xa0ef9a639d541b, 0x58855f9a0c56a5 }
+  },
+  {
+    { 0x7d88eaa213091d, 0xcbdfee745b6a0d, 0x826a0124f5e077, 0xb04fc1390f1e4c,
+      0x1961ac3aea69aa, 0x3afb719d5bb63e, 0x2a378374ac7e5c, 0x78efcc1c50ca45 },
+    { 0x346e8f0b8abdef, 0x27e3dbd88095d0, 0x56d3379ffc6c22, 0x67d416cfa4b291,
+      0xc3baaf63b1b373, 0x0184e1fdf73bae, 0x38ae8f79167528, 0x7329d4c35d6297 }
+  },
+  {
+    { 0x45d2ac9f568c52, 0x51348149808593, 0x0c92d8331b7ed8, 0x921327a0876ecd,
+      0xf752d75052736a, 0x7b56487bc6b837, 0x6b1a320a23b4cc, 0x1983937ec0d665 },
+    { 0x2c3017c08554ab, 0x40ad955366e87f, 0x88c4edf8ed7f02, 0x64a7db13cc5e6d,
+      0x5ac91fa2dc978b, 0x016a20d925d2a2, 0x3604dfeabb57b4, 0xc3683ecd7e2e85 }
+  },
+  {
+    { 0xc47150a4c0c6d0, 0x30af45ee22adcf, 0x39b5acb022ea4b, 0xfbe318577203b5,
+      0xe5aaa346fd9b59, 0x0062c90dd1c8dc, 0xcf113f354049ac, 0xd8fba4d63a31b5 },
+    { 0x73b54881056a69, 0x3be6cbcd780bda, 0x5776ec230ba2b9, 0xbe883cf8e8d6f7,
+      0x64efe945c2be6f, 0x064f704f1ade8d, 0x41cfd17743110e, 0xaac94114c20abe }
+  },
+  {
+    { 0x91f9192f1c1468, 0x8176e744563e13, 0xa48b5f90bda15d, 0x2a085aeda42af6,
+      0xfd38ab2425c018, 0x2884ba408abafb, 0x356f318cbd091d, 0x454e450817871b },
+    { 0xe080e818ada531, 0xa40f1eb3152ba8, 0x051049f0c38eb1, 0x37e4bb3bd45003,
+      0x6d0980454a01e5, 0x6de932feeb824a, 0xccdef37dc93481, 0x8633e0793a05e8 }
+  },
+  {
+    { 0xbe94256034675c, 0x376c01d08db789, 0x8707ee79af1b6b, 0x633b3ef11bfbac,
+      0x694f33fd06db60, 0x2a68bfcbb13407, 0x1c860c9da27c3a, 0xbca16ded701ac3 },
+    { 0x2b76cfac59ffd0, 0xf9a116554d718d, 0xf86a1db67f0878, 0xe313e05af34e85,
+      0xa1888113343159, 0xdbe4c3f0bb7ed1, 0x73b67e80c732bc, 0xa4e1c87e74110e }
+  },
+  {
+    { 0xce1106b5c6770c, 0x422c70b5c0bcb7, 0x32a39908195e7f, 0xa24968d1ccd4aa,
+      0x8f08ecf720e557, 0x5da10a454bcc81, 0x9d3c73b6cd846e, 0xaeb12c7368d065 },
+    { 0x2110859cf9fd1b, 0xd2a4801ee2bd6d, 0x376e556e9466ac, 0x767803b3b5aa35,
+      0x343f842b8a89ba, 0x3263cc16726bbf, 0x26caf1725871b0, 0xef66ad641b8578 }
+  },
+  {
+    { 0xc9f2249638068c, 0x96d282c1ccf9af, 0x71df30c69b435a, 0x88c943acb9d5c9,
+      0xbf98ef12a8f378, 0xffc1824114c6ff, 0xda3ad2cd52e8c7, 0xf1222bc1afcb59 },
+    { 0x459e94b0ee334a, 0xd4477b8421933a, 0x60fb7b0a1e401e, 0xfde6e820d1e330,
+      0xcecfe9b3233fde, 0x09ec4662e93523, 0xa5ba64930775b9, 0xcc397e5adf80f2 }
+  }
+},
+{
+  {
+    { 0x2fe182d4ddc8a8, 0x88d6e79ac056bf, 0xc3ff2d10e41e4e, 0x32ec7f92c3679f,
+      0x3561f094e61051, 0x4553f5a6c6250a, 0x2b765efdd25c5b, 0xe3a40a26a1cd7f },
+    { 0xb27309b5d821dd, 0x950fb8dc2c17ca, 0xfeed0158fb0d4c, 0x762c479f550179,
+      0x306cf44e095840, 0x84b413ad379e66, 0xd6e5d5abb2e4f1, 0x8bc12b794b085d }
+  },
+  {
+    { 0xc0d4cb804b5532, 0x7a31525b9940a6, 0x010e7dd68c69d1, 0xd81f29d2a18c35,
+      0x08ae7703f11e73, 0x5358f876e55106, 0x299e8cac960ef5, 0x89a6fb4acfc8dc },
+    { 0x5996a406dc7d4a, 0x21e5112e51b96e, 0x95b8c3d09a202b, 0x306ab0fd441f1f,
+      0x2834fed98d4245, 0xc29c387d0abbde, 0xf6a9bf1b805c15, 0x602f4f8c4e458d }
+  },
+  {
+    { 0xf041486e5a893a, 0x53b891d8934327, 0x11e000d4000758, 0xa4ccde8662bad9,
+      0xe34d3edb9a1b64, 0x72d967584e7a6d, 0x773da2f6627be4, 0xa11c946e835ae3 },
+    { 0x02e8203650bc15, 0x2d35936e58b78d, 0xe9cfbe8f21a3cc, 0x55ad8311049222,
+      0xbf99de438fff47, 0xebbfd803831db5, 0xe990636af2af42, 0xc26ae52b7f5a0e }
+  },
+  {
+    { 0xb5d85b1fa8f846, 0x4166489b3b1455, 0x768260dd36a305, 0xc6a82354ff5645,
+      0xd241cd8d6e93e5, 0xeed9aa1a406e74, 0x9e96ab05f600d9, 0xa26b8b56eca2a1 },
+    { 0x78321cfd705aef, 0xc4fb6b3c0161ec, 0xdc324415199cf1, 0x33627d0d0a5067,
+      0x13490cb15143ee, 0x77e0ede85b4f44, 0x904f12e394b165, 0x90f50f5efab32d }
+  },
+  {
+    { 0x4aa0a16bc2de96, 0x172596aaa9c12b, 0xd512e1e60e8a29, 0x77d35c1f637e83,
+      0xbb0d141d2aae0b, 0x8a878a58c03738, 0x6d24c01ab0e525, 0xb7d3136f760887 },
+    { 0xdbc3f8f3f91b7c, 0xe7b4bcaa8722c0, 0x3286a91da0ae65, 0x8372274225b084,
+      0x5884cd5ae1886c, 0xb4e63ef3a23cf7, 0xfe5f202f2dd0da, 0x951fac9653916c }
+  },
+  {
+    { 0x05e2e8f854fa4e, 0xf411f941edaf10, 0x26cc562a0a928d, 0x78fd34e4abce65,
+      0x1d8760998a32e2, 0x85dc76f4c37518, 0xdcaeef500e8021, 0x7fcb2f84e9b2a5 },
+    { 0x9eba91ef382c06, 0x2052e8524cae53, 0x617336ef5c1519, 0xf1546d5b4e632b,
+      0xa9edc81d7b8ffd, 0xdb2914f29ab68c, 0xe805070debbaba, 0x775e53bc3b719e }
+  },
+  {
+    { 0xa40e294065256a, 0x9f113868fb031a, 0xac03af8059667c, 0x432eb3a0475f58,
+      0x22332bf01faad0, 0xc8132e9bc57a11, 0x27d5a173bc3f8b, 0x5471fc6930bf3e },
+    { 0xba28bc0e6bff40, 0x198d57e555e564, 0x13ce8319c65b8f, 0xb0a5c9d5681b51,
+      0x467588bdeb9e11, 0xf1891a7bb4250b, 0x10b938bd12b433, 0x0b8c80224dcda4 }
+  },
+  {
+    { 0xc428703cf332d3, 0x9d0053cf2a5b98, 0x4e4c6207838a15, 0x2e92919fbf8a43,
+      0x39ad52421cd9a5, 0x584ed6c1561588, 0x20af30517a95c8, 0xa223077b70e1c8 },
+    { 0x679cfea2fa4871, 0x54f2a46ac633c7, 0x60306514cdc5f1, 0xc4facda75a1dc7,
+      0x710a2882d07d19, 0xd55864e6b44992, 0x44d4b6c454c5b2, 0x2855d2872f9981 }
+  }
+},
+{
+  {
+    { 0x4071b3ec7b0674, 0x800eb14f8794d5, 0x70573afbe6783e, 0xafaa4407785901,
+      0x112d2a1405f32c, 0x3761a52169b3e2, 0xe168b31842a366, 0x5bc322f9bf4734 },
+    { 0x36ef240976c4a0, 0x066f3d6fea4e64, 0x0e954bda989e57, 0xe36ef5ef9466e4,
+      0x6bb615abeb9226, 0x5571e5f3d5a2ca, 0xa86efe24897a86, 0xed7e9cf28a9f77 }
+  },
+  {
+    { 0xdf10c971f82c68, 0x796ba1e3b597e6, 0x1ac77ece718cbf, 0xc8175bb410eac8,
+      0x0cdf9a1bc555ef, 0x6b889f17524e05, 0x6bf1e61ae26d82, 0xb3f6ad5d2e97d9 },
+    { 0x94dcff9f226487, 0x60e6356be03dde, 0xda1f93b6a3dd7d, 0xf1be72179ca90c,
+      0x05ed3131e6bce5, 0xcf50908d48af3e, 0x3b0e85c61e554f, 0xfe7e35ba2778d3 }
+  },
+  {
+    { 0x42c503275ac5a9, 0xa66a66dda062c2, 0xa4f4f82caa7023, 0x489d47664b4f86,
+      0x10b108897311ad, 0x55dd637177b2ec, 0xa5ccff09a267b1, 0xf07690bff327b0 },
+    { 0x39162ed2250cd2, 0x1426de08b255f1, 0xf227afd1bdd731, 0x78f8a36fa4c844,
+      0x267a211157379c, 0x3f05f92cc04acb, 0x374496cfc69cae, 0xbf2c5d016ebfec }
+  },
+  {
+    { 0x605418bd0518d1, 0x3237f809e1cbc6, 0x37a7005286c019, 0xf1fb0e0b15af0b,
+      0xfc3b97caa853c0, 0x1f48bd0e6beba2, 0x8e5d7c5e6a72f1, 0x575e66d26ebf0c },
+    { 0x099477662eae3d, 0x53f074f96c9c65, 0x6cfbfdbb81bade, 0x98b4efe3fed7d1,
+      0xdaa112338c3382, 0xdf88b7347b8ec6, 0x9b0fe4b9504a4f, 0x2e7df4cf30c1c3 }
+  },
+  {
+    { 0x25380cb2fc1833, 0xb8e248c18d62de, 0x91c8f59d82f9db, 0x5ec2b202444750,
+      0x3f3a1f766b6f74, 0x0180aa9dd7d14d, 0xd0a342d2956b9c, 0x26e910e7139873 },
+    { 0x2261dc4139e23d, 0x7edb181b8343dd, 0xfcf1073b4038dd, 0x88870efa3bfea3,
+      0x4e98ba964a263e, 0x3c6e5dc70811f5, 0x17d28f5f86055d, 0xca9c27666e4199 }
+  },
+  {
+    { 0x0b2d8bd964ef8c, 0x5a99b8588e2ba6, 0x9e927b204498ce, 0x9ff20c5756eb25,
+      0x97cc27b3f27736, 0xf32dd6d4729583, 0xbdc26580381a94, 0x70fef15ef2c06f },
+    { 0x50a619149252cc, 0x9eb4a14236b4b9, 0x9b1b2158e00f78, 0x27add366ea9c23,
+      0xef61763c3a8e79, 0xed4542fd82ce56, 0xa8737e70caed75, 0xeca0ac2d452d76 }
+  },
+  {
+    { 0x20c07793d082d0, 0x6e3ce64c9e9f3b, 0xb3a4dce75a195f, 0x3a3c305bdd9f24,
+      0xe2545c88688942, 0xa463c82080f32b, 0x442974842686b8, 0xf50e20d7213866 },
+    { 0x265ac523826e74, 0x26fba57228e8ec, 0x8a1e1dbe6b3ed8, 0x7c7b278f0fe65a,
+      0x9a6df23c395234, 0x99562060b0f114, 0x440c8c4ef90837, 0x21ad22a3645f65 }
+  },
+  {
+    { 0x1e023a6edd31b2, 0xf76d1459ff8668, 0x970705617b45c8, 0x06120781e88e37,
+      0x85c51c8922faac, 0x4df392e22756d9, 0x8907fd0a03c98e, 0x626f46a52ea51c },
+    { 0xf8f766a486c8a2, 0x8c499a288ed18c, 0x44d2dc63c4f0de, 0x47dde686f2a0b6,
+      0x9a655f84a973fd, 0x3e7124e786ac80, 0x699e61ce8a0574, 0xdf0ba9a31cdd0d }
+  }
+},
+{
+  {
+    { 0x76270add73e69b, 0x991120fc67d38a, 0x7be58309469f0c, 0x93aba597db40ac,
+      0x2b707bc822fc08, 0x4199fc069551cd, 0x38deed4f367324, 0xca518e12228787 },
+    { 0x72f1befd9a9277, 0x57d4aabe49ae90, 0x13810d5db23478, 0x2a8b7809b4b77f,
+      0xb542f4e1b4e004, 0x4080fd03ec77f0, 0xb49e9fecec6596, 0x20338d33f16037 }
+  },
+  {
+    { 0x4adcdae53554b0, 0xfea4906e04c4db, 0x0808bec7748233, 0xde7477c47148d7,
+      0xdd9124c03da38c, 0x6b2503125ee8e9, 0xae67399b0d6161, 0x70c4acd82203b6 },
+    { 0x9683916d31dae8, 0x34775031ac7f69, 0x9553153988e4ad, 0xb58f41153a15e1,
+      0xb65a2d492ba2dd, 0x7c3efb1a90169c, 0x210f45e6b1747d, 0x16e8d1bcff488d }
+  },
+  {
+    { 0x252adf89d703db, 0x259ac1dfdfeb39, 0x7faf6af115e806, 0x7aaefd6c1aff21,
+      0x80542107c0113d, 0x481f1a5e19b4b1, 0x7c17d43fcc8c61, 0x8b04452bb0bbbe },
+    { 0xe51e5f54cebae1, 0x05341ba56a414c, 0x0083a2c7fb8a30, 0xb4663f277f4952,
+      0xce72eec4bb0074, 0x74fdd66a3584d1, 0x6b9e58eb02e076, 0x5be45d53b961f4 }
+  },
+  {
+    { 0xc7474f31ab2e0b, 0x2838ccbf4bf454, 0x634392ef3c3eac, 0x440e40a137602b,
+      0xeea67e9d1ae8e3, 0xafdf93a77e221e, 0x3c9f3da2719a10, 0x466ecef32c8256 },
+    { 0x1061c19f9c432f, 0xa1332d9b1c7d98, 0xbc735f2a425c2c, 0x1429cdf4b1bccb,
+      0x77b42a16bbb5f9, 0x30078e35955ae4, 0x8acd77721cc315, 0xaa90d5fe86fa99 }
+  },
+  {
+    { 0xfcfd460721115a, 0x6a7de3e08269b8, 0xe5964a696dd47e, 0x6717cd58dca975,
+      0x7ea4ebe98b149e, 0x6f894d5b7b8057, 0xbd6f9607f30e31, 0x61ca45323df092 },
+    { 0x32241f99d782f3, 0x55173b02abfae2, 0x0abe0edd15bbbd, 0xb6d3c0ab438abb,
+      0x62fb4679ffa20b, 0x30926b5d31560a, 0x44bf27c2a0aa6d, 0xf7473131a4cb97 }
+  },
+  {
+    { 0xa2f6c0db0535de, 0xcb02ae1c855166, 0xc699e6bb3422f0, 0x774febe281ba8a,
+      0x1d9d24fffabcc7, 0x0b31ba1fe12ba5, 0x4c8680313d0af7, 0x90640d32f47160 },
+    { 0xa0c4bf45876603, 0x717f6fa950ab08, 0xf12bb53a710de8, 0xc500c616a88f50,
+      0x0070f992645351, 0x57aab5d2446893, 0xd553fa8b68f657, 0xe8537c1693c55d }
+  },
+  {
+    { 0x58e86eb7fc7684, 0xdf330f7bfc73a9, 0x41e337dcc11936, 0x36d92006e35759,
+      0x01327033500d8b, 0xfa684059483354, 0xc8f2980667851b, 0x538ec8918296b0 },
+    { 0xa2a2c4fcff55f9, 0xb260d4d60d20bd, 0x3ed576fd9cc59f, 0x4ed8c64d514fcc,
+      0x37ebfb2c22b315, 0xca67a3694c212c, 0x4f8e08c3a1795e, 0x498f9264e7261f }
+  },
+  {
+    { 0xfea7382c59b3d4, 0xb9942ed3f2925f, 0xe4b00dc8ea77e8, 0x74a18ec3cab02e,
+      0xbbbb752ef16d0b, 0x639da4fffab032, 0xc371a4a3aa30f0, 0x8e26b22caa175b },
+    { 0x94e41567e2b62e, 0x7cceea625a794c, 0x931d2f4479f015, 0x946183d90b25b2,
+      0x1504e9768a2807, 0xa7577d3fa49ddd, 0x24fc87edd48699, 0x9edefd63d7d99c }
+  }
+},
+{
+  {
+    { 0x0508b340f0b450, 0xe0069a5c36f7f4, 0x26556642a5a761, 0x0193fd8848e04d,
+      0xc108cf573fe2e7, 0x05eb0ecfd787d4, 0x1555ccbff28985, 0xb5af09f651b995 },
+    { 0x167d72ce1134be, 0xd6d98bf57c669a, 0x40fb7166dd76fa, 0xeabbf202a41b31,
+      0x300ff0e09b75b0, 0x32b6fadd9a0c1e, 0x805188365a80e0, 0x8bef69332110fe }
+  },
+  {
+    { 0x637802fbef47d4, 0xfac114b2d16eaa, 0x7b3f3ab0415644, 0x17ab8d12dd895b,
+      0x271b7fe87195f3, 0xa3f867ea71f65f, 0x39ba40cc80583a, 0x6db067256e1fcc },
+    { 0x4feab4e06662a8, 0xc857415c74bd46, 0x18032ed732b126, 0x87c8aea7a099ea,
+      0xb4a753536fe0a8, 0x33a98da27673f6, 0x3e40c022b8e549, 0x2def1af9a4c587 }
+  },
+  {
+    { 0x9618b68a8c9ad9, 0xd70b4aa49defda, 0xae8b1385f788ef, 0x87c3542dd523f4,
+      0xe42c7055c5b004, 0x6303360fa7df57, 0x33e27a75f6d068, 0x9b3268e8ff331a },
+    { 0x845cc9623ee0c3, 0x003af70ac80084, 0x6a9f931530c41d, 0xa1d7051bb127f0,
+      0x642ce05ca36245, 0xc34205b0323ee9, 0x7cc8912b7b3513, 0x6252cc8076cbdb }
+  },
+  {
+    { 0x10e68a07089522, 0x36c136158fc658, 0x490397d74723a4, 0x42692c0519d56c,
+      0x69d251bf1ff235, 0xe689d03c2cbf37, 0xf04ceba825b7f4, 0xd6b9bee2281c2e },
+    { 0xc52ef3fe0043ab, 0x351bf28d1d1be8, 0x277615f0f18a5a, 0x31f717f5d6800f,
+      0xf5fb82dab922e2, 0x99aee2f2d6ae43, 0x42477fec63b982, 0x904aeb1a594a01 }
+  },
+  {
+    { 0xaa82174eb39974, 0xbc38e6195e6aa0, 0x6a3df8a25c0675, 0xf324203ffbe739,
+      0xfa5a0b4a3f0649, 0x79c87327a7a6b8, 0xeb65ecd40ad3f5, 0x718d416e4e45c5 },
+    { 0x029dbf4e2326fd, 0x0c63416e7942f0, 0x6d0c7286f4e678, 0x59f0b10a138601,
+      0x8a1d9788d92ea9, 0x9f8d712c22eca5, 0x73970447b6b96b, 0xa2d49eee6fb955 }
+  },
+  {
+    { 0x249f900bf14a19, 0xd3522da63a8cd2, 0x28a32f386964d2, 0xacf712bc1fa743,
+      0x98a9bfc0bb94d3, 0x318ece1bc06824, 0xfc476754fce7f0, 0x19caec9e4135b7 },
+    { 0x6de68a8c6817bb, 0x7121960f3b6d89, 0xa7d4261f5a818e, 0x0c0ba519157455,
+      0x78b6acf450d5ff, 0x198b4934e8649a, 0x0941a3cfd05da3, 0x264ea4adb55951 }
+  },
+  {
+    { 0xcfee91c46e5a31, 0x47b6806fff7366, 0xdb14be45df849d, 0x3c5e22bac66cc7,
+      0x7f3f284a5f4769, 0x4e00815383be36, 0x39a9f0b8072b0b, 0x9887cd5c7eadd6 },
+    { 0x7dd8f05b659511, 0x15c796dd2e1cb9, 0xe5edb0c0d31345, 0x2025df06939c60,
+      0x6314c08bf15de1, 0x03c154804c7fb5, 0x413337fbb5d3ed, 0xfc20b40477e983 }
+  },
+  {
+    { 0x7f968805db0ef9, 0x05562dee9c2a70, 0x071e5bc7dae133, 0xa8cdd12237fc4a,
+      0x6d565e74ea492b, 0xa17cf94381ee52, 0x6ab8a4e9f5c546, 0xbb642f340288ef },
+    { 0x64e59215df5c2d, 0x43696e3bb906f4, 0x73a841a74ae46c, 0xe264883c506b8a,
+      0x9542e1aa1be548, 0x89385395e81b4a, 0x5642cfaeaca6ce, 0xed8077b806e0f9 }
+  }
+},
+{
+  {
+    { 0x1c776c47e13597, 0x0ec8b289e584fd, 0x0bb6043b8b61e8, 0xdcc17489cd835b,
+      0x493e6ac39fef9a, 0xb44eb34d133e17, 0xfebcd0071cb6f9, 0xe6cf543d20eff2 },
+    { 0xf265cad0a004c7, 0x9b06c9dd35cc12, 0x769f985cb4ea53, 0x29160a20993434,
+      0xdf8dd108d939c4, 0xefa177c6711e2f, 0x1695790cd7a2cd, 0x38da3d777f6642 }
+  },
+  {
+    { 0x9bfcfd96307b74, 0xc26a36dbfdabc3, 0x9341be04abe28e, 0xdb20b5273d1387,
+      0xf8d229c3d1949c, 0xf1e0afeb8b3a41, 0x29c60dfed565d0, 0x6930bb58b43b2c },
+    { 0x1d76527fc0718f, 0xdb981431f67189, 0x0c62f6451f32cc, 0x70a66268bd35e5,
+      0x1725641c1cece7, 0x7f130a8f96f4a4, 0x72319e9f06ee98, 0x215b73867bf9b2 }
+  },
+  {
+    { 0x8d1bec20aaddd7, 0xfb8b95bb8be4f9, 0xeac193efde1026, 0xa5edea79d5860c,
+      0x4adbaea44280d3, 0xce8b67038f4798, 0x914c107ec30dea, 0xbdc5cf7000776b },
+    { 0xb6fd7d1a206a13, 0x9941ebadae986e, 0x76c27a81f1caaa, 0x6967c123f108b4,
+      0x6f115284aea2d0, 0x9bb4319144ddac, 0x1a4d3eac8ec6fc, 0xfe4b0b8bf37420 }
+  },
+  {
+    { 0x5d9a4a1ec0ac6f, 0x84b79f2fc7c80d, 0x64222f7c14fac3, 0xdd9e039c23b3f2,
+      0x4a84abdea956bb, 0x370dcbaebe09dc, 0x79a9ea8e0eaf82, 0x4cfb60aaee375f },
+    { 0x6a10dbf9106827, 0xa3ba5cf43f305b, 0x481b885c1bb083, 0x2f52380b3117b1,
+      0x0066122ddd6791, 0x4f8923e63bace3, 0x5c5f499ecb88d4, 0xfdc780a3bac146 }
+  },
+  {
+    { 0x34b70ae7ba1f71, 0x909182945bd184, 0x3b39778e707313, 0xdeefc5e6164e91,
+      0xbb55bed4971f39, 0x7d523398dafc8b, 0x82391bfa6adf0f, 0xfd6f90ae319522 },
+    { 0x60fdf77f29bbc9, 0xeff9ed8aaa4030, 0x978e045f8c0d3f, 0xe0502c3eed65cd,
+      0x3104d8f3cfd4c8, 0xab1be44a639005, 0xe83f4319eeab3f, 0x01970e8451d797 }
+  },
+  {
+    { 0xbc972f83180f4b, 0xac053c0617779d, 0x89392c57fa149f, 0xdc4699bbcb6263,
+      0x0ae8b28ce12882, 0xdca19a7af1a4dc, 0xd3d719f64e1a74, 0xbb50201affdd5d },
+    { 0x56f73107ac30e9, 0x65cc9c71878900, 0x83f586627338a3, 0x122adefac5bb13,
+      0x97de2001bcd4d5, 0x6ed3985b8aa3a0, 0x8680f1d6821f9b, 0xcb42028dda9f98 }
+  },
+  {
+    { 0xcdb07080ec2db3, 0xe28c8333dad1a1, 0x2093e32de2da07, 0x731707383b8987,
+      0xad17871f552b8d, 0x846da9851cf70a, 0xf94a16e5c4f5e1, 0x84299960f8348a },
+    { 0x4bf3f6898db78a, 0xad77fa83d19b52, 0x69767728b972dc, 0x7dfa35a5321be0,
+      0x9881846dd344a6, 0xe550292ad4e2a8, 0x8075217bc68bf1, 0xdd837c4893be15 }
+  },
+  {
+    { 0x09c931ed4fab5b, 0xb2dcf08b77a0f1, 0x7dac5c0e0d38a6, 0xa5570b00ae73af,
+      0xc7c19d3f5aed28, 0x575fa6f5251e92, 0xb843cd6cdf7275, 0xd9d3d8e9a01287 },
+    { 0xf94e356b3c370b, 0xc62b99ffe464b0, 0x7792650a986057, 0xeaa67d5c4b1874,
+      0xba1ba4d0b07078, 0xdbf636d7a03699, 0x1a16c34edd32a3, 0x6ce2495a45cb5d }
+  }
+},
+{
+  {
+    { 0xd7c4d9aa684441, 0xce62af630cd42a, 0xcd2669b43014c4, 0xce7e7116f65b24,
+      0x1847ce9576fa19, 0x82585ac9dd8ca6, 0x3009096b42e1db, 0x2b2c83e384ab8b },
+    { 0xe171ffcb4e9a6e, 0x9de42187374b40, 0x5701f9fdb1d616, 0x211e122a3e8cbc,
+      0x04e8c1a1e400bf, 0x02974700f37159, 0x41775d13df8c28, 0xcfaad4a61ac2db }
+  },
+  {
+    { 0x6341b4d7dc0f49, 0xaff6c2df471a53, 0x20ec795fb8e91e, 0x4c7a4dfc3b7b62,
+      0x9f33ff2d374938, 0x38f8c653a60f2e, 0xc1168ac2efef73, 0x046146fce408ee },
+    { 0x9b39ac0308b0c3, 0xe032d6136b8570, 0xee07d8dfc4aacf, 0x0a82acbd5a41dd,
+      0xbe0ded27c3d726, 0xce51d60b926ce9, 0xfa2f7f45806c1e, 0xe367c6d1dec59c }
+  },
+  {
+    { 0x64511b6da2547b, 0x76a349c0761405, 0x37d662601223ab, 0x0e243c1f4d7c48,
+      0xdc9c8b4da756a0, 0xc7430dfd72e7e9, 0x0eb130827b4210, 0x7a9c044cf11cbd },
+    { 0x2c08ff6e8dd150, 0x18b738c2932fc6, 0x07d565104513e8, 0x0ca5cffaa40a17,
+      0xd48634101baa8f, 0xfb20fafb72b79e, 0x1a051e5654020f, 0xe3b33174e17f23 }
+  },
+  {
+    { 0x05910484de9428, 0x620542a5abdf97, 0xaa0ededa16a4d1, 0xa93f71c6d65bb9,
+      0x88be135b8dfaf9, 0x1d9f4e557ca8ee, 0x4c896aa26781ad, 0xd3fbe316c6c49f },
+    { 0x088d8522c34c3d, 0xbb6d645badff1e, 0xe3080b8385450d, 0x5ccc54c50ab1f3,
+      0x4e07e6eac0657d, 0xa7ba596b7ef2c0, 0xcceca8a73a81e9, 0xa0b804c8284c35 }
+  },
+  {
+    { 0x7c55956f17a6a2, 0xb451d81789cfa8, 0xdf414e82506eaa, 0x6ef40fbae96562,
+      0x63ea2830e0297e, 0xf5df26e73c46fa, 0xe00641caac8bce, 0xc89ed8f64371f3 },
+    { 0xd22b08e793202e, 0x39a9033875cb50, 0xe64eec0f85ddb4, 0xdce45a77acf7b5,
+      0x39d1e71b9b802d, 0xafdfe7cbd559ac, 0x17ec1f8809eeb5, 0x8c0e38a4889b8c }
+  },
+  {
+    { 0x47eabfe17089da, 0x2d18466ec90c50, 0xa511aa45861531, 0xebb3d348c39b39,
+      0xa0ac4daf1b5282, 0xea26be7a9dadba, 0x8992ba8554d86e, 0x7fcbdb6d5f2ef5 },
+    { 0x320e79b56863e7, 0xeb9d0c0a7dce2d, 0xb9f4031784cbc6, 0x68823ee7ac1f81,
+      0xa6b6f4f9d87497, 0x83c67b657f9b6e, 0x37357470fef2a7, 0xf38028f59596e2 }
+  },
+  {
+    { 0x9ea57ab7e82886, 0x18221c548c44d5, 0xbf8e6cf314a24f, 0x70ff18efd025e5,
+      0x08d03de5334468, 0x2b206d57404fb7, 0xb92327155e36b0, 0xcc7604ab88ddd9 },
+    { 0x3df51524a746f0, 0x8fdebd8168e3fc, 0xffc550c7f8c32c, 0x1dbbc17148743e,
+      0xd48af29b88e18b, 0x8dca11c750027c, 0x717f9db1832be3, 0x22923e02b06019 }
+  },
+  {
+    { 0xd4e06f5c1cc4d3, 0x0fa32e32b4f03a, 0x956b9afc4628d0, 0x95c39ce939dad1,
+      0x39d41e08a00416, 0xfd7ff266fb01aa, 0xc6033d545af340, 0x2f655428e36584 },
+    { 0x14cfb1f8dff960, 0x7236ffcda81474, 0xc6a6788d452d0f, 0x2ad4a5277f6094,
+      0x369d65a07eea74, 0x27c6c38d6229aa, 0xe590e098863976, 0x361ca6eb38b142 }
+  }
+},
+{
+  {
+    { 0x6803413dfeb7ef, 0xb669d71d3f4fad, 0x5df402ac941606, 0xe5d17768e6c5b7,
+      0x131bcb392ab236, 0x7f1fb31ce2e0e0, 0xa2c020d9e98c35, 0x33b23c0f28657b },
+    { 0xed14e739cf7879, 0x10d4867b4357b3, 0x127cea331e4e04, 0xc60d25faa5f8a7,
+      0xfef840a025b987, 0x78081d666f2a0a, 0x0fa0b97ac36198, 0xe0bb919134dc9f }
+  },
+  {
+    { 0xc1d2461cc32eae, 0x0fdbfdf0f79a37, 0x70f2bc21c95f02, 0x7d68bec372cddf,
+      0x44f78178439342, 0xa3d56784843a6c, 0xbadf77a07f8959, 0xf45819873db4ca },
+    { 0xe8eaaf3d54f805, 0x2f529d1b84c1e7, 0x404e32e21e535c, 0xabac85c159b5f5,
+      0x4e8e594b00466f, 0x40fcaabc941873, 0x3b4e370be407c6, 0xccd57885b2e58d }
+  },
+  {
+    { 0x3ee615e88b74a8, 0xd7d6608eab4e69, 0x27cf9f1e4ace36, 0x282359e7aebabb,
+      0x96e509bf6d162f, 0xad906f3f1a290a, 0xe7d6c4f1314a58, 0xeecffe4218431d },
+    { 0xa66e0e9e2cfed9, 0xb0887ec71f0544, 0xd34e36ba04c5d7, 0x094daa5ed4392d,
+      0xcda83adc8aa925, 0x1adef91b979786, 0x3124dcbfddc5d6, 0x5cc27ed0b70c14 }
+  },
+  {
+    { 0x386dbc00eac2d8, 0xa716ecbc50ca30, 0x9e3fc0580d9f04, 0x37dde44cfeaceb,
+      0xd88d74da3522d5, 0x6bb9e9f2cf239a, 0x9e7fb49a7cbfec, 0xe1a75f00a5c0ef },
+    { 0x6e434e7fb9229d, 0x0ec6df5c8a79b3, 0x7046380d3fb311, 0xe957ef052e20fa,
+      0x0f4fe9a9ef4614, 0x1b37d9c54d8f2b, 0x23b2dc139d84a2, 0xf62c4f6724e713 }
+  },
+  {
+    { 0xbd6922c747e219, 0x34d14383869b7b, 0x8c875a596f2272, 0xd9602c03fe361e,
+      0x081348f744839f, 0x61bd16c61ac1f1, 0x993b727d8da4e1, 0xbb40ba87741271 },
+    { 0xe6dcc9881dcfff, 0x9f513f593ce616, 0xdc09683618cd8f, 0xc3b1d1026639be,
+      0xe8f149fc762ee2, 0x59f26efb244aae, 0x3f2de27693dd96, 0xd8b68f79c3a7de }
+  },
+  {
+    { 0x6fa20b9970bd5b, 0x87242d775f6179, 0xa95a6c672d9308, 0x6eb251837a8a58,
+      0xfdea12ac59562c, 0x4419c1e20f1fc3, 0x0c1bd999d66788, 0x4b7428832c0547 },
+    { 0x4f38accdf479ab, 0x01f6271c52a942, 0xe3298f402ca9a7, 0x533dacab718fc8,
+      0x133602ab093ca8, 0xc04da808f98104, 0xd0f2e23af08620, 0x882c817178b164 }
+  },
+  {
+    { 0x28e6678ec30a71, 0xe646879f78aca1, 0x868a64b88fa078, 0x671030afee3433,
+      0xb2a06bb87c0211, 0x202eca946c406a, 0x64d6284e4f0f59, 0x56ae4a23c9f907 },
+    { 0x5abbb561dcc100, 0x6fef6cf07c7784, 0xb6e25cddb7302d, 0xa26785b42980e8,
+      0xe7d4043fb96801, 0x46df55d8e4282b, 0x9c0a5f5c602d6e, 0xf06560475dfe29 }
+  },
+  {
+    { 0x0e82a1a3dcbc90, 0xb1ee285656feac, 0xfa4353b0d3d3b2, 0xc2e7a6edd5c5df,
+      0x13707e1416ce53, 0xc84ce0787ebc07, 0xdd273ce8a9a834, 0x432a6175e8e1e7 },
+    { 0xa359670bd0064a, 0xc899dd56534516, 0x666560edb27169, 0x1537b22a19a068,
+      0x3420507eac7527, 0x479f25e6fc13a7, 0xc847acc1bc19b3, 0xecdecf00b20d45 }
+  }
+},
+{
+  {
+    { 0x6f241004acea57, 0xdace1c6da68597, 0xea7dd4150ce77f, 0x1aecb841585884,
+      0x92ff208ea4a85c, 0xde9433c88eebd2, 0x53cd3183f4d289, 0x397085826539af },
+    { 0x4b57599b827d87, 0xdc82ac03d77638, 0x694336652f6e61, 0xb8fc4b0ad5e8a6,
+      0x1b6f7dcf388642, 0x6f24533a74dd57, 0xc66937841750cf, 0x06757eb28a37af }
+  },
+  {
+    { 0x0e70d53c133995, 0x88a5e0c7c8c97d, 0x4e59dbf85f3be3, 0x0f364ac0e92698,
+      0x3a1e79bef6940f, 0xc8a3941d85d23a, 0x143bb999a00e58, 0x61cf7d6c6f2f10 },
+    { 0x979c99485150fe, 0xcfd0df259d773f, 0xce97b9daab7bcd, 0xc9fff8e6afd8fc,
+      0x246befd89a4628, 0xf6302821567090, 0x15393426749c58, 0xff47d0ea0f3fd3 }
+  },
+  {
+    { 0x09b0bfd35f6706, 0x74645812c82e69, 0xb60729f50d5fe9, 0xf13324595c74f1,
+      0x33647e3bb76c89, 0x01264045a9afcc, 0x46d57ee0f154ab, 0x2efa55525680a4 },
+    { 0x12ebfc65329d90, 0xcb37ae579800af, 0x5bb53496f8e310, 0x9b59c63f1bb936,
+      0x5b49baaf4610e9, 0x2bbeeef4f2d6ac, 0x87ee21e0badc67, 0x12e2aadf1ddfa0 }
+  },
+  {
+    { 0x5b4668fa9109ee, 0xfa951338a6cea2, 0xe45e6fc4068e16, 0x8ae9a0c0205ed8,
+      0x2993b96679b79b, 0xc6b878fed604d3, 0x01d020832c77f3, 0xd45d890495a1ab },
+    { 0x99348fa29d2030, 0x961f9a661f8f7a, 0xfd53212674f74b, 0x45cee23b3e72bc,
+      0x3fccb86b77e2d5, 0xdff03104219cb7, 0x233771dc056871, 0x1214e327d2c521 }
+  },
+  {
+    { 0x9f51e15ff2a8e1, 0x86571c5138bc70, 0xbfc4caf0c09d46, 0x65e33fec2a0c18,
+      0x8214392426867d, 0x51ce6c080ae4ed, 0x6cbe8d7b110de6, 0x7f6e947fd22ea4 },
+    { 0x7373a75cadefc4, 0x6fca1d2b0c682f, 0xcd2140df3c7c1e, 0x8653a37558b7a5,
+      0x653e74e55eb321, 0xbe0c6b3c31af73, 0x3376379f4fc365, 0x3570b3771add4d }
+  },
+  {
+    { 0x9061ec183c3494, 0xaf2f28d677bc95, 0x6fe72793bf8768, 0xc5f50e30fa86d8,
+      0x6c03060a3293ce, 0x4d53357e2355a6, 0x43a59eae4df931, 0x6f48f5d13b79c6 },
+    { 0xa4d073dddc5192, 0x6d0e318a65773f, 0x1008792765de9e, 0xa724ed239a0375,
+      0x510ff1497d7c9e, 0x251f6225baa863, 0x86464fe648a351, 0xf85e98fd50fd91 }
+  },
+  {
+    { 0x29c963486ee987, 0x93e8e5210dcc9f, 0xa1fc4d1c910b1f, 0x015acacfeb603e,
+      0xc9f25f80844a5f, 0x50de93c73f4dac, 0x1758783310a4aa, 0x544d570358f106 },
+    { 0x4eeec7b1dc68ca, 0x6238e6fe00fbcb, 0x34d394cb4e83c9, 0x764ffa22292656,
+      0x5614cd1f641f2e, 0x4252eb69e07234, 0xcbaef4568d2ba4, 0x8c9c5508a98b17 }
+  },
+  {
+    { 0xf235d9d4106140, 0x1bf2fc39eb601e, 0x6fb6ca9375e0c3, 0x4bf5492c0024d2,
+      0x3d97093eb54cc6, 0xc60931f5c90cb5, 0xfa88808fbe0f1a, 0xc22b83dd33e7d4 },
+    { 0x9cfec53c0abbf5, 0x52c3f0a93723df, 0x0622b7e39b96b6, 0x300de281667270,
+      0x50b66c79ef426a, 0x8849189c6eb295, 0xeaec3a98914a7e, 0x7ed56b0c4c99e0 }
+  }
+},
+{
+  {
+    { 0x7926403687e557, 0xa3498165310017, 0x1b06e91d43a8fd, 0xf201db46ac23cb,
+      0x6f172ad4f48750, 0x5ed8c8ce74bd3e, 0x492a654daba648, 0x123010ba9b64ff },
+    { 0xa83125b6e89f93, 0x3a3b0b0398378a, 0x9622e0b0aebe7c, 0xb9cbfdc49512a4,
+      0x13edffd6aaf12a, 0x555dff59f5eafd, 0x3cba6fe1212efa, 0xd07b744d9bb0f8 }
+  },
+  {
+    { 0x45732b09a48920, 0xf3080fc13ff36d, 0x9347395de8f950, 0x14d025a382b897,
+      0x60c5a7404d72ad, 0x30be7e511a9c71, 0x43ffabd31ac33a, 0x97b06f335cbb14 },
+    { 0xe4ff5c57740de9, 0x5fed090aacf81e, 0x97196eee8b7c9d, 0x316dcd1045910b,
+      0x7a2b2f55ad8c63, 0x674fffdc5b03bb, 0xc1cd133e65953c, 0x3c060520a83556 }
+  },
+  {
+    { 0x797c3f6091c23d, 0x2ea2de339c9c05, 0x5d958b4a31f67c, 0xf97afe5d5f088c,
+      0xbcfbd2a0b37243, 0xc43ad3eeca630c, 0xb92a33742845e0, 0x970bff7a9a0f16 },
+    { 0x86355115970a79, 0xcee332ef205928, 0x2c58d70c04c208, 0xdbfe19a3f5e5bf,
+      0x8f8f2c88e51c56, 0xb61f58e8e2da75, 0x4046a19624d93f, 0x7de64dbe1f9538 }
+  },
+  {
+    { 0xd018e1cc2d850e, 0x8cdb64363a723c, 0x9a65abe90a42af, 0xfeece9616f20cc,
+      0xc906800d5cff56, 0x0acf23a3f0deed, 0x2143061728dd3a, 0x66276e2b8ce34c },
+    { 0x23700dc73cc9c7, 0xdb448515b1778b, 0x330f41e4aab669, 0x2f5aabcf5282a4,
+      0xff837a930f9e01, 0x1a1eb2f901cc98, 0xd3f4ed9e69bd7f, 0xa6b11418a72a7d }
+  },
+  {
+    { 0x34bde809ea3b43, 0x5ddcb705ced6ae, 0x8257f5b95a6cb8, 0xaac205dc77dcb8,
+      0x77d740d035b397, 0xca7847fcf7e0a6, 0x9404dd6085601b, 0x0a5046c457e4f9 },
+    { 0xcaee868bc11470, 0xb118796005c5f6, 0xcc04976ec79173, 0x7f51ba721f6827,
+      0xa8e3f0c486ff7e, 0x327163af87838c, 0xcf2883e6d039fd, 0x6fb7ab6db8b0e2 }
+  },
+  {
+    { 0x8ca5bac620d669, 0xff707c8ed7caa9, 0xdaefa2b927909b, 0x1d2f9557029da3,
+      0x52a3ba46d131a0, 0xe5a94fd3ab1041, 0x508917799bc0ae, 0xf750354fa1bd16 },
+    { 0xdd4e83a6cd31fd, 0xd33505392fac84, 0xf914cbc1691382, 0x669683fda6ade6,
+      0x69446438878513, 0x429d3cc4b1a72d, 0x655c46a61eec36, 0x881eded4bc4970 }
+  },
+  {
+    { 0x5b39d377ca647f, 0x41533c1e917b34, 0xea2aeb57daf734, 0xf1ef1eb1286560,
+      0x582f2e008e0473, 0x5913d7d5edc74a, 0x588c7ec3c1e754, 0xbd6db057146fe1 },
+    { 0x3b0d49e7634907, 0x4c65ce4e43b9cc, 0xb87e9582d92d5b, 0x05135727ab1519,
+      0x03ec0848c3aed0, 0x4d7aa21561a641, 0xe5f821199e92ad, 0x379b55f48a457c }
+  },
+  {
+    { 0x8317c34d6a8442, 0xb0ab4a5ae499da, 0xebcb16e720e8eb, 0xfd5c5639a96908,
+      0xcab4d67ad23acf, 0xa600a79bcdf748, 0x18a6340a2a6a51, 0xf2f415c3aabd69 },
+    { 0xdb38a4f747258a, 0xb6ea5602e24415, 0xfad1ea9f1f7655, 0x4e27eb5c957684,
+      0xf8283e1b2e1cfc, 0x8f83bd6aa6291c, 0x28d23b55619e84, 0xb9f34e893770a4 }
+  }
+},
+{
+  {
+    { 0x1bb84377515fb1, 0xac73f2a7b860a6, 0x78afdfa22b390f, 0x815502b66048aa,
+      0xf513b9785bf620, 0x2524e653fc5d7c, 0xa10adc0178c969, 0xa1d53965391c8d },
+    { 0x09fccc5a8bcc45, 0xa1f97d67710e1e, 0xd694442897d0a1, 0x7030beb5f42400,
+      0xdebe08c7127908, 0x96b715c2187637, 0xc598250b528129, 0x0f62f45a1ccb07 }
+  },
+  {
+    { 0x8404941b765479, 0xfdecff45837dc4, 0x1796372adbd465, 0x5f84c793159806,
+      0x6d2e46b6aaad34, 0xd303b4a384b375, 0x440acd5b392002, 0x4f2a4a7c475e87 },
+    { 0x038e1da5606fc2, 0x2d821c29c2f050, 0xc074cb3f139db4, 0xde2fee74ec59be,
+      0x5a819eea84ed59, 0xd65c62c3e98711, 0x72eb440b9723c1, 0xb92775401be611 }
+  },
+  {
+    { 0x929fe64ab9e9fc, 0x04379fd0bf1e85, 0xb322093bc28ee3, 0x78ac4e2e4555e1,
+      0xdb42b58abc5588, 0x1c1b5e177c8b12, 0xf6d78dd40366c4, 0xc21ff75bdae22e },
+    { 0x1e3d28ea211df2, 0xc5a65a13617c0a, 0x3fa02c058140d5, 0x155c346b62d10c,
+      0xc9cf142e48268f, 0xdc140831993bc3, 0x07c44d40ee69dc, 0x61699505e2ac46 }
+  },
+  {
+    { 0x44e4a51d0fb585, 0x00846bef1f3ce8, 0xedef39a8e2de1e, 0x430afe333b3934,
+      0xac78b054337188, 0x0f39de4c9a3f24, 0x039edddc9ae6a4, 0xf4701578eacd51 },
+    { 0x1e396949a2f31a, 0xc8a40f4b19a8b1, 0xdddd10c9d239d8, 0xf974245887e066,
+      0xfdb51113ea28c6, 0xb5af0fbe1122a9, 0xd30c89f36e0267, 0x7b1c0f774f024c }
+  },
+  {
+    { 0x1ec995607a39bf, 0x1c3ecf23a68d15, 0xd8a5c4e4f59fe9, 0xacb2032271abc3,
+      0xbc6bdf071ef239, 0x660d7abb39b391, 0x2e73bb2b627a0e, 0x3464d7e248fc7e },
+    { 0xaa492491666760, 0xa257b6a8582659, 0xf572cef5593089, 0x2f51bde73ca6bf,
+      0x234b63f764cff5, 0x29f48ead411a35, 0xd837840afe1db1, 0x58ec0b1d9f4c4b }
+  },
+  {
+    { 0x8e1deba5e6f3dc, 0xc636cf406a5ff7, 0xe172b06c80ca0f, 0x56dc0985ffb90a,
+      0x895c2189a05e83, 0x6ddfaec7561ac2, 0xaa3574996283a0, 0x6dfb2627e7cd43 },
+    { 0x6576de52c8ca27, 0x6a4a87249018eb, 0x00c275c5c34342, 0xe34805ad2d90c4,
+      0x651b161d8743c4, 0xb3b9d9b7312bf3, 0x5d4b8e20bf7e00, 0x8899bdf78d3d7e }
+  },
+  {
+    { 0x9644ad8faa9cd1, 0x34c98bf6e0e58e, 0x6022aad404c637, 0x2a11a737ac013b,
+      0x5bdd1035540899, 0x2e675721e022a4, 0xe32045db834c33, 0x74a260c2f2d01c },
+    { 0x20d59e9c48841c, 0x05045dde560359, 0xeba779cac998ac, 0x5bed10c00a6218,
+      0x25d4f8e5327ef4, 0xa2784744597794, 0xefd68ca831d11e, 0x9ad370d934446a }
+  },
+  {
+    { 0x3089b3e73c92ac, 0x0ff3f27957a75c, 0x843d3d9d676f50, 0xe547a19d496d43,
+      0x68911c98e924a4, 0xfab38f885b5522, 0x104881183e0ac5, 0xcaccea9dc788c4 },
+    { 0xfbe2e95e3c6aad, 0xa7b3992b3a6cf1, 0x5302ec587d78b1, 0xf589a0e1826100,
+      0x2acdb978610632, 0x1e4ea8f9232b26, 0xb21194e9c09a15, 0xab13645849b909 }
+  }
+},
+{
+  {
+    { 0x92e5d6df3a71c1, 0x349ed29297d661, 0xe58bd521713fc9, 0xad999a7b9ddfb5,
+      0x271c30f3c28ce0, 0xf6cd7dc2a9d460, 0xaf728e9207dec7, 0x9c2a532fcb8bf0 },
+    { 0xd70218468bf486, 0x73b45be7ab8ea8, 0xddfc6581795c93, 0x79416606bb8da2,
+      0x658f19788e07a2, 0xa9d5b0826d3d12, 0x4d7c95f9535b52, 0xad55e25268ef8a }
+  },
+  {
+    { 0x94a9b0ba2bc326, 0x485ecc5167e5f3, 0x8340bc7c97fc74, 0x06f882b07aaa5c,
+      0x4b57455849698a, 0xd9281ebb36a0ba, 0x8918c6c8b8108f, 0xedd1eea5b50d1d },
+    { 0x94d737d2a25f50, 0x0e5a8232446ad0, 0x02a54357ced3e2, 0xb09a92a4af8ced,
+      0x85fc498eeecef2, 0x06a02b9e71e3d4, 0x00ad30784bb49a, 0xf61585e64a5b4a }
+  },
+  {
+    { 0x915f6d8b86a4c9, 0x944bc6ba861e1f, 0x3091ca754465ef, 0x11df859eb53a38,
+      0xd44dde50144679, 0x6c8da9a0994edd, 0xeebcebf91241ef, 0xc419354c2f6859 },
+    { 0x1f4969349581b6, 0x5712b10bb26cb4, 0x8fcaa41b09fd59, 0xbd39aad72e22e3,
+      0xf70e794b1199b0, 0xdf63c0cc6f863d, 0xd58166fee9df4f, 0xb9224eac45e70b }
+  },
+  {
+    { 0x80072face525f4, 0x8597bd666a5502, 0xf65e203dbc9725, 0xeccfbe3f2222a4,
+      0x490aa422339834, 0x134889162489e8, 0xaff3f80a735084, 0x69d53d2f3f1bd6 },
+    { 0xb123ffc813341a, 0x359084c1173848, 0x751425ed29b08d, 0x1edda523890ad4,
+      0xb64974c607cf20, 0xa8c8cb8b42ac7c, 0xd5cb305edd42e5, 0xf3034dc44c090a }
+  },
+  {
+    { 0x428921dbb18e19, 0x4cfd680fed2127, 0x671144d92ac8c3, 0x2121901132c894,
+      0x25d0e567604cd9, 0xa372223afbc2a0, 0xcf98a5256c16f7, 0x71f129ab5459e1 },
+    { 0xf4afdc5b668b2e, 0xc5d937a0c2d410, 0xe2cc4af285d54a, 0x1c827778c53e18,
+      0x270f2c369a92f6, 0x799f9ac616327a, 0xce658d9d4246f2, 0x0fb681ffb12e36 }
+  },
+  {
+    { 0xc5ab11ee0690fe, 0x80261e33f74249, 0x8eb4b4758c1cf2, 0x4895a80184ae9b,
+      0x4a4bdb6d3e27eb, 0xa7a1638bfd251c, 0x29ec144417a7e3, 0xd0736093f1b960 },
+    { 0xcb1ed8349c73d1, 0x33fc84a8d1945a, 0x9f668dbe965118, 0x3331743a82811f,
+      0xf394dec28ba540, 0x44ce601654a454, 0x240dbb63623645, 0xf07e7f22e61048 }
+  },
+  {
+    { 0x7c9f1763d45213, 0x3eefa709c1f77f, 0xde3c3c51b48350, 0x4a2bc649d481a7,
+      0xfd4a58a7874f3d, 0x96655d4037b302, 0x945252868bf5ab, 0x1b6d46a75177f6 },
+    { 0x7de6763efb8d00, 0xb2c1ba7a741b7b, 0xcca6af47bae6ed, 0xe4378ca5b68b3f,
+      0xfb757deaf71948, 0x7f07b5ebc6ac99, 0x752a56827d636d, 0xc8b7d1d4b8a34f }
+  },
+  {
+    { 0x76cb78e325331b, 0x41f41c9add2eed, 0x03db2385c5f623, 0xbbc1d177102fa2,
+      0x80f137a60182ec, 0xfdd856955adf15, 0x4f53f5ee3373dc, 0xec6faf021b669b },
+    { 0x7d4e9830b86081, 0x10d3cd9f2d979c, 0x0f48f5824a22c8, 0x86c540c02f99ee,
+      0xf4c66545e6c5fc, 0xaf0c588bc404c8, 0x2e6edbd423118a, 0x86e32e90690eab }
+  }
+},
+{
+  {
+    { 0x1d12656dfbfa6f, 0xa4980957646018, 0x2f1071bc3597d0, 0x3df83f91dda80a,
+      0x5853e28f3ae449, 0xb853d319e19aad, 0x863f01ba0d8a46, 0xa84fca62fef108 },
+    { 0xbe4c0b7fb84de9, 0x40a03dcc0727bf, 0x781f841b18575c, 0x6a63045466cddb,
+      0x6be758205dc7a2, 0x420f87f07ae811, 0x28082423bf96c8, 0x723998c51c6821 }
+  },
+  {
+    { 0x38ab64181f5863, 0xd82ecbd05ff9e1, 0x339c94ea065856, 0x143054aa45156d,
+      0xe6d64bf065628c, 0xe530086a938589, 0x22d3a49385d79b, 0x0b107900ab8245 },
+    { 0xb0d80fbca387b5, 0x698206e35551d7, 0x199685da10bb73, 0xa8e5fa89107378,
+      0x36e5724d99dbbf, 0xd67f476d581b03, 0x7a15be788dd1e6, 0x8dac8e4e5baa31 }
+  },
+  {
+    { 0x4d5d88fe170ef8, 0xb6ba5de1e9e600, 0x4a89d41edeabc5, 0x737c66b8fac936,
+      0x8d05b2365c3125, 0x85a5cbcb61b68e, 0x8fea62620a6af9, 0x85115ded8b50ec },
+    { 0x5430c8d6a6f30b, 0x8bef9cf8474295, 0x0648f5bbe77f38, 0xfe2b72f9e47bd7,
+      0xad6c5da93106e2, 0x4fa6f3dfa7a6c3, 0xdcd2ed8b396650, 0x7de1cce1157ef9 }
+  },
+  {
+    { 0x70a5f6c1f241d1, 0x6c354d8798cd5c, 0x23c78381a729fb, 0xcff8f15523cbda,
+      0x5683ff43493697, 0xef7dbab7534f53, 0xd7bd08e2243d53, 0x6f644cbf8072a9 },
+    { 0xac960f9b22db63, 0xa97f41723af04d, 0x692b652d9798af, 0x0e35967fedb156,
+      0x14b5e50dfe6ee8, 0x7597edeb411070, 0x116f3ce442b3f9, 0xe9b5ae81b2b6db }
+  },
+  {
+    { 0xf4385ee2315930, 0xc8d029827a8740, 0x7907a8dd934a43, 0x20bc946c582191,
+      0xa4acb3e6a405e7, 0x8c1d6c843df2f5, 0x9df1593991f0b5, 0xbb9df984d9be9d },
+    { 0x63620088e4b190, 0xee1421eada3a88, 0xb84f0ccf93b027, 0x7a5d6678e95091,
+      0x3974462f3e3704, 0xfa6fb5ec593e98, 0x44b6cf7a6477d2, 0xe885b57b09a562 }
+  },
+  {
+    { 0x6e339e909a0c02, 0x57afff00e75f29, 0x797d8d6fb7db03, 0xc6e11a3d25a236,
+      0x643ce1c0107260, 0xe644ec462eae1c, 0x821d5b83f5a3f5, 0xa8ad453c0579d6 },
+    { 0x6518ed417d43a4, 0x46e76a53f87ccd, 0xd6cbaabf9bef95, 0x25688324f7cbcf,
+      0x367159a08476b4, 0x1d1b401be6d324, 0x348cb98a605026, 0x144f3fe43b6b1e }
+  },
+  {
+    { 0xbabbd787b1822c, 0xd34ba7e2aa51f8, 0x086f1cc41fbea4, 0x96f7eac746f3d9,
+      0xad97f26281ecaf, 0x751a905a14ee2c, 0xb4e7fe90d7335f, 0x0d97b8f4892ff0 },
+    { 0xdb8a3155a5c40e, 0x64e5de77ba567b, 0x4f155f71eefe88, 0xe2297e9fb6fbf4,
+      0xfe24bf96c16be5, 0x2251847cdd83e2, 0x13ac2c85eda444, 0x49d1b85283275f }
+  },
+  {
+    { 0xca08731423e08f, 0x7046bb087d2f14, 0x876f10c3bc846c, 0x2202b76358fbe3,
+      0x0d4fc1c0e26ac6, 0x1fc748bb986881, 0x609e61c8384a18, 0x28a72d60d88e00 },
+    { 0x1332a3178c6e2f, 0x0367919b3526a4, 0x53989e4698fe3e, 0x14b1145b16a99b,
+      0xef9ec80ddbb75f, 0x76256240e53955, 0x54e087a8744ae1, 0xce50e8a672b875 }
+  }
+},
+{
+  {
+    { 0x4c88b2ba29629c, 0x946559c7b2642f, 0x933d432f7ebe4c, 0x97109b663632c9,
+      0x799b3fbe53184d, 0xd4628710f069a6, 0x0c182a13a68351, 0x974a8399a2437a },
+    { 0x29f19972a70278, 0x01b98b6d9c424b, 0xd85a60b08f4c37, 0xcc3523f2b1da15,
+      0xf922115ddffb0f, 0xee0fe4dde84ae2, 0x810440c55365be, 0xd2f66391a457e8 }
+  },
+  {
+    { 0x5e6879fe2ddd05, 0x92a7545abdfc61, 0x7dedd63a5cede8, 0x8a03b3f70df4bd,
+      0xa5d1f6591f6cbb, 0x372fde610f3fb2, 0x4537f9ea9dee05, 0x7eb85bbdf7aa50 },
+    { 0x963edf8e8c504d, 0x53c8dcae7bdb6b, 0xa246e4c6fedf2d, 0x75533400c55bde,
+      0x2aa748d0270a54, 0xadb6cf005860dd, 0x8d314509b84763, 0x626720deb405ef }
+  },
+  {
+    { 0xa3709ae6601328, 0x68e94fd2ac2478, 0x38793439d5d247, 0xfa467af392c198,
+      0x49e7b0d15df607, 0x8c5812261792a8, 0x79f76581d3762f, 0xaa38895244a39d },
+    { 0xef60af9c5cd0bc, 0x2b0db53a33b3bb, 0xe3e0b1f251015d, 0xc608afce64489e,
+      0xe52b05703651aa, 0x1dda8b91c6f7b9, 0x833f022ff41893, 0x58eb0a0192818c }
+  },
+  {
+    { 0x6c1300cfc7b5a7, 0x6d2ffe1a83ab33, 0x7b3cd019c02eef, 0x6c64559ba60d55,
+      0x2e9c16c19e2f73, 0x11b24aedbe47b1, 0xc10a2ee1b8153b, 0x35c0e081e02e1a },
+    { 0xa9f470c1dd6f16, 0x4ea93b6f41a290, 0xac240f825ee03f, 0x6cd88adb85aabd,
+      0x378a64a1be2f8f, 0xbf254da417bac1, 0x7e4e5a59231142, 0x057aadc3b8c057 }
+  },
+  {
+    { 0x607c77a80af479, 0xd3e01ff5ccdf74, 0x9680aaf101b4c7, 0xd2a7be12fc50a6,
+      0x92a788db72d782, 0x35daf2e4640b52, 0xc170d6939e601c, 0x16e05f57b25c2f },
+    { 0x47a42a66fe37f8, 0xeb74271beca298, 0x401e11e179da16, 0xfb8da82aa53873,
+      0xd657d635bb4783, 0x6847758fcea0b1, 0x2f261fb0993154, 0x868abe3592853a }
+  },
+  {
+    { 0x1a4c54335766ab, 0xa1c84d66f4e4ea, 0x5d737a660ba199, 0x4a7b1e298b15a2,
+      0x207877ffd967d3, 0xcaec82dc262b4d, 0x0b278494f2a37d, 0x34781416ac1711 },
+    { 0x28e3df18fc6856, 0xbec03f816d003f, 0x2bd705bff39ebd, 0x1dcb53b2d776d3,
+      0xabafa7d5c0e7ce, 0x5b9c8c24a53332, 0xe9f90d99d90214, 0x789747ec129690 }
+  },
+  {
+    { 0x94d3c3954e2dfa, 0x919f406afb2a8f, 0x159ef0534e3927, 0xcdb4d14a165c37,
+      0xa23e5e8288f337, 0x95867c00f90242, 0x2528150e34e781, 0x104e5016657b95 },
+    { 0x695a6c9bcdda24, 0x609b99523eb5fa, 0xcbce4f516a60f8, 0xec63f7df084a29,
+      0x3075ada20c811f, 0x129a1928c716a1, 0xd65f4d4cd4cd4a, 0xe18fa9c62188be }
+  },
+  {
+    { 0x1672757bac60e3, 0x525b3b9577144b, 0x38fc997887055b, 0x7a7712631e4408,
+      0x884f173cba2fcf, 0x783cbdc5962ac0, 0x4f3ed0a22287dc, 0x8a73e3450e20e6 },
+    { 0xe7a1cd0d764583, 0x8997d8d0d58ee6, 0x0ea08e9aa13ed6, 0xed478d0cf363cb,
+      0x068523d5b37bf4, 0x8b5a9e8783f13c, 0xde47bbd87528a9, 0xd6499cccaec313 }
+  }
+},
+{
+  {
+    { 0x54781bbe09859d, 0x89b6e067f5e648, 0xb006dfe7075824, 0x17316600717f68,
+      0x9c865540b4efe2, 0xdbdb2575e30d8e, 0xa6a5db13b4d50f, 0x3b5662cfa47beb },
+    { 0x9d4091f89d4a59, 0x790517b550a7dc, 0x19eae96c52965e, 0x1a7b3c5b5ed7a4,
+      0x19e9ac6eb16541, 0x5f6262fef66852, 0x1b83091c4cda27, 0xa4adf6f3bf742b }
+  },
+  {
+    { 0x8cc2365a5100e7, 0x3026f508592422, 0xa4de79a3d714d0, 0xefa0d3f90fcb30,
+      0x126d559474ada0, 0xd68fa77c94350a, 0xfa80e570c7cb45, 0xe042bb83985fbf },
+    { 0x51c80f1fe13dba, 0xeace234cf055d7, 0x6b8197b73f95f7, 0x9ca5a89dcdbe89,
+      0x2124d5fdfd9896, 0x7c695569e7ca37, 0x58e806a8babb37, 0x91b4cc7baf99ce }
+  },
+  {
+    { 0x874e253197e968, 0x36277f53160668, 0x0b65dda8b95dbe, 0x477a792f0872a1,
+      0x03a7e3a314268d, 0xa96c8420c805c7, 0xb941968b7bc4a8, 0x79dce3075db390 },
+    { 0x577d4ef6f4cc14, 0x5b0d205b5d1107, 0x64ff20f9f93624, 0x0b15e315034a2f,
+      0x3a0f6bb8b6f35c, 0x0399a84e0d0ec5, 0xd0e58230d5d521, 0xdeb3da1cb1dd54 }
+  },
+  {
+    { 0x24684ae182401a, 0x0b79c1c21a706f, 0xe1d81f8d8998af, 0xadf870f4bb069f,
+      0xd57f85cf3dd7aa, 0x62d8e06e4a40f8, 0x0c5228c8b55aa1, 0xc34244aa9c0a1a },
+    { 0xb5c6cf968f544e, 0xa560533de23ab7, 0xaa5512047c690c, 0x20eda5b12aaaa6,
+      0xea0a49a751a6a0, 0x6d6cfff2baa272, 0x95b756ebf4c28a, 0xd747074e6178a4 }
+  },
+  {
+    { 0xa27b453221a94b, 0xd56ad13e635f20, 0x03574b08c95117, 0xf0ee953ed30b70,
+      0xb48d733957796f, 0xf5d958358c336b, 0x6170cd882db529, 0xcd3ef00ec9d1ea },
+    { 0xd1bea0de4d105f, 0xd2d670fad6a559, 0x652d01252f9690, 0x5f51fb2c2529b0,
+      0x5e88bf0e89df2a, 0x9a90684cd686e4, 0xf519ccd882c7a1, 0x933a0dfc2f4d37 }
+  },
+  {
+    { 0x0720a9f3f66938, 0x99356b6d8149df, 0xb89c419a3d7f61, 0xe6581344ba6e31,
+      0xd130561ab936c8, 0x0625f6c40dbef1, 0x7b2d6a2b6bb847, 0x3ca8b2984d506b },
+    { 0x6bf729afb011b0, 0x01c307833448c9, 0x6ae95080837420, 0xf781a8da207fb8,
+      0xcc54d5857562a9, 0xc9b7364858c5ab, 0xdfb5035359908f, 0x8bf77fd9631138 }
+  },
+  {
+    { 0xf523365c13fbb1, 0x88532ea9993ed5, 0x5318b025a73492, 0x94bff5ce5a8f3c,
+      0x73f9e61306c2a0, 0x00abbacf2668a3, 0x23ce332076237d, 0xc867f1734c0f9b },
+    { 0x1e50995cfd2136, 0x0026a6eb2b70f8, 0x66cb1845077a7d, 0xc31b2b8a3b498e,
+      0xc12035b260ec86, 0x1cbee81e1b3df0, 0xfd7b8048d55a42, 0x912a41cf47a8c8 }
+  },
+  {
+    { 0xab9ffe79e157e3, 0x9cfe46d44dc158, 0x435551c8a4a3ef, 0x638acc03b7e3a8,
+      0x08a4ebd49954a7, 0x295390c13194f7, 0x3a2b68b253892a, 0xc1662c225d5b11 },
+    { 0xcfba0723a5d2bb, 0xffaf6d3cc327c9, 0x6c6314bc67e254, 0x66616312f32208,
+      0xf780f97bea72e1, 0x495af40002122f, 0x3562f247578a99, 0x5f479a377ce51e }
+  }
+},
+{
+  {
+    { 0x91a58841a82a12, 0xa75417580f3a62, 0x399009ff73417a, 0x2db1fb90a8c5cd,
+      0x82c8912c046d51, 0x0a3f5778f18274, 0x2ad0ede26ccae2, 0x7d6bd8b8a4e9c2 },
+    { 0xaa0d7974b3de44, 0xf8658b996ac9bb, 0x31e7be25f6c334, 0x23836ce4df12c9,
+      0x029027b59eb5c9, 0x2f225315b8649d, 0xa0fdf03d907162, 0x101d9df9e80226 }
+  },
+  {
+    { 0xf12037a9a90835, 0xd2d0882f0222a7, 0xeaf8d40c3814e2, 0xa986dc68b8146b,
+      0x147a3318504653, 0x734e0032feaf67, 0x6f27bbf602bec5, 0xa1e21f16a688f3 },
+    { 0x5a8eeab73c4ae5, 0x4dbaddbe70b412, 0x871cebacfd2af1, 0x18603827d7a286,
+      0x024059db5bb401, 0x2557c093c39b73, 0xfc5a7116681697, 0xf881c0f891b57c }
+  },
+  {
+    { 0x3c443f18ea191a, 0x76faa58d700ad0, 0x6fe6cfabe7fcbf, 0xaefc5288990ef7,
+      0x44e30fa80004cc, 0xc744adc6d8ef85, 0xafcd931912df70, 0xf62a9d1572a6d8 },
+    { 0x47158a03219f27, 0x76fb27ead73136, 0x41bb2adcc2d614, 0x8858cb9de1ec21,
+      0xab402c45f15866, 0x6675d5bbc82bbf, 0x4ee9dd6f1b28d3, 0x875884fe373c17 }
+  },
+  {
+    { 0x17806dd2a67d36, 0xaa23a8632c9ec1, 0xd914126fc1ee55, 0xbf8f7bd653701b,
+      0x9b0111aea71367, 0x61fd4aba98e417, 0xeb45298561c5a5, 0x2187b0ae7af394 },
+    { 0x71f12db1616dde, 0x061760907da7b4, 0x414d37602ddb04, 0x1100be7286fb58,
+      0xd7cf88d6f0d95b, 0x8539d23746d703, 0xdccc9d64e23d73, 0xaeef1d2ec89680 }
+  },
+  {
+    { 0x82ccf1a336508d, 0xa128c1f5bad150, 0x551d8c029a188d, 0xef13dd4771404f,
+      0xdd67696c37b993, 0x428c0e20dddad2, 0x222278d038c94c, 0x1a24a51078e3f2 },
+    { 0xd297fe6edb0db9, 0x00988d28251a87, 0xbb946f8bfaa0d7, 0x380f7b9df45ea0,
+      0x8526415afccf5e, 0x909bfbfe9ec7bc, 0x2ed7093124755c, 0x436802889404e2 }
+  },
+  {
+    { 0x21b9fa036d9ef1, 0xfd64b7ce433526, 0xd9d7eb76544849, 0x201620cd5b54b3,
+      0x25fab3dbb61159, 0x90d4eb0c53e0d3, 0xba098319e74772, 0x8749658ec1681c },
+    { 0xa354349fec316b, 0x639a9b1a743ea2, 0x2e514ca37c50e6, 0x9f4a4fddbaf6c5,
+      0x0df87ef6f511c9, 0xadd4cef0c00d95, 0x401c0ebaa1433f, 0x3c3a59ebb38af9 }
+  },
+  {
+    { 0x8706245f0e7dca, 0xad238cd3fb29ca, 0x03304439b7d8f0, 0xfdcd6e6154f495,
+      0xc67e24a7d4ad09, 0x1b209e85438390, 0xf893b81b0c211e, 0x1aa86f07e11e36 },
+    { 0x2cca3ffedea8b1, 0x7eedd073b306cd, 0x78e37bc12ee222, 0x257870bbc42a1d,
+      0x5fb2bb91fbd397, 0x470247009d6c60, 0x11748a320bdc36, 0x3ff24dc04280e8 }
+  },
+  {
+    { 0x0eb1c679839b52, 0x5bcca27acfbd32, 0xb506c1674898e3, 0x37d662e2489e5e,
+      0x8dc0731f694887, 0x571149ef43f1dc, 0x6430a3766d63dc, 0x0d2640eb50dd70 },
+    { 0x2b561493b2675b, 0x1b4806588c604f, 0x55c86a8aafbabc, 0xa7b9447608aaba,
+      0xa42f63504cad8c, 0x0f72b1dcee7788, 0x1d68374755d99a, 0xd7cdd8f5be2531 }
+  }
+},
+{
+  {
+    { 0x67873bdbcdfee1, 0xa5a0c0afcd0a3f, 0x59389f93cfa3d4, 0x14e945ce1c865c,
+      0x62d2f8e1d588cc, 0xfd02f8a8e228b4, 0x208f791b42b649, 0x0e0dff1ab397ad },
+    { 0x30ac3d90bc6eb1, 0xf14f16a5f313bb, 0x70fa447e2a0ad2, 0x6e406855a0db84,
+      0xd52282be32e1e7, 0x315a02a15ca330, 0x9a57a70867c2fe, 0x55f07650054923 }
+  },
+  {
+    { 0x2d729f6c0cf08f, 0x6b80138ebaf57f, 0x6285bcc0200c25, 0xee845192cd2ac7,
+      0x28fce4d922778a, 0x761325ccd1011c, 0xd01f2475100e47, 0xc7a1665c60d8e1 },
+    { 0x950966d7ceb064, 0x0a88e8578420db, 0x44f2cfce096f29, 0x9d9325f640f1d2,
+      0x6a4a81fd2426f1, 0x3ed6b189c905ac, 0xba3c0e2008854d, 0x1df0bd6a0d321b }
+  },
+  {
+    { 0x0117ad63feb1e7, 0xa058ba2f1ae02f, 0x5eee5aa31b3f06, 0x540d9d4afacd4d,
+      0x38992f41571d91, 0xef2738ebf2c7de, 0x28bfcab92a798d, 0x37c7c5d2286733 },
+    { 0xb99936e6470df0, 0x3d762d58af6a42, 0xa8c357ac74eec5, 0x9917bebf13afbc,
+      0x28f0941f2dc073, 0x306abf36ce7df7, 0xa3c5f6fd6973c8, 0x640209b3677632 }
+  },
+  {
+    { 0xee872a2e23aef7, 0xb497b6feb9b08e, 0xfb94d973f33c63, 0x9ea1ff42b32315,
+      0x537b49249a4166, 0x89c7fe6ab4f8be, 0xf68007fdad8f0f, 0xe56ef0b71b8474 },
+    { 0x478b2e83f333f9, 0x144e718b2607f5, 0x13aa605a4c7ab5, 0xfc1fc991d0730d,
+      0xe7a04375ab3ea1, 0xc59986a306d8d3, 0x24f6111702a8b1, 0x7741394e040ad2 }
+  },
+  {
+    { 0x34c6a2560723a7, 0x8aabd0df4ea691, 0x9d676a55d7497f, 0x12c09577d91fa4,
+      0x581c7a86479284, 0xa54f3daf4fd449, 0x2f89f3c4ef44cf, 0xfc266b5c9ec97c },
+    { 0xfcd3fbe88b142a, 0x9f3109f4bd69c1, 0x08839c0b5f5a6a, 0x63ca8502e68303,
+      0x2f0628dbba0a74, 0x743cccf5d56b54, 0xbd4b06613e09fd, 0x7a8415bde2ba3e }
+  },
+  {
+    { 0x2234a3bc076ab2, 0xd6953e54977a98, 0xc12215831ebe2e, 0x632145fbad78e2,
+      0xd7ba78aa5c4b08, 0x6f4ea71998e32a, 0x25900d23485a63, 0x97ac6286a5176f },
+    { 0x5df91181093f7b, 0x2bf9829c844563, 0x525d99d6272449, 0x4281cb5b5c8a18,
+      0x35df2780544a08, 0xf4c3d2dbaeb8f4, 0xc7ff3175230447, 0x6b4d7645d2fbff }
+  },
+  {
+    { 0x4837f802b0c9cb, 0xb65f8168ce8418, 0xdf66ea99fc1428, 0x9788ee804ea7e8,
+      0x9eae9008334e3c, 0xbc91058d6ba1b6, 0x634aba1d7064b6, 0x12d9bb3397b368 },
+    { 0x0645c85c413aa8, 0xb09dea6ac6b5e3, 0x29a620d289a50b, 0x104db3bbbcceb1,
+      0x42e479287b3309, 0xdfc373eec97f01, 0xe953f94b93f84e, 0x3274b7f052dfbf }
+  },
+  {
+    { 0x9d5670a1bd6fa9, 0xec42fc9db6c4d4, 0xaecd4ed1b42845, 0x4eed90e1b03549,
+      0xeb3225cbbab1fa, 0x5345e1d28a2816, 0x3741cfa0b77d2a, 0x712b19f7ea8caa },
+    { 0x42e6844661853e, 0x4cf4126e4a6e5d, 0x196a9cfc3649f6, 0x06621bcf21b6b1,
+      0x887021c32e29ea, 0x5703aeb8c5680f, 0x974be24660f6d7, 0xaf09badc71864e }
+  }
+},
+{
+  {
+    { 0x3483535a81b6d3, 0x19e7301ca037dc, 0x748cab763ddfeb, 0xe5d87f66f01a38,
+      0xbba4a5c2795cd6, 0x411c5d4615c36c, 0xff48efc706f412, 0x205bafc4b519df },
+    { 0xfcaa5be5227110, 0x7832f463ad0af0, 0x34ef2c42642b1b, 0x7bbef7b072f822,
+      0x93cb0a8923a616, 0x5df02366d91ba7, 0x5da94f142f7d21, 0x3478298a14e891 }
+  },
+  {
+    { 0xad79a0fc831d39, 0x24d19484803c44, 0x4f8a86486aeeb2, 0x0ca284b926f6b9,
+      0x501829c1acd7cd, 0x9f6038b3d12c52, 0x77223abf371ef5, 0x2e0351613bf4de },
+    { 0x7a5a4f2b4468cc, 0xdcea921470ae46, 0xf23b7e811be696, 0xe59ad0d720d6fb,
+      0x9eacac22983469, 0x4dd4110c4397ee, 0x4ef85bdcbe2675, 0xe4999f7aa7c74b }
+  },
+  {
+    { 0x031838c8ea1e98, 0x539b38304d96a2, 0x5fbdef0163956e, 0x6bd4d35ce3f52a,
+      0xe538c2355e897f, 0x6078d3a472dd3f, 0x590241eca9f452, 0x2bc8495fd7fc07 },
+    { 0x23d0c89ead4c8c, 0x1ea55a9601c66e, 0x41493c94f5b833, 0xc49a300aa5a978,
+      0xc98bdc90c69594, 0x4e44cedccbdc8c, 0xb0d4e916adccbf, 0xd56e36b32c37ae }
+  },
+  {
+    { 0x052bd405b93152, 0x688b1d44f1dbfa, 0xe77ba1abe5cc5f, 0x11f8a38a6ac543,
+      0x3355fd6e4bb988, 0xdf29c5af8dffb4, 0x751f58981f20ee, 0x22a0f74da9b7fb },
+    { 0xec8f2bc6397b49, 0xff59fc93639201, 0xb7f130aa048264, 0xe156a63afdc4cc,
+      0x0fd7c34b13acaf, 0x87698d40cb4999, 0x6d6ecae7f26f24, 0xae51fad0f296e2 }
+  },
+  {
+    { 0xd0ad5ebdd0f58d, 0x6ec6a2c5c67880, 0xe1ce0349af1e0f, 0x08014853996d32,
+      0x59af51e5e69d20, 0x0ef743aaa48ecf, 0x8d3d2ea7dafcb0, 0x4ac4fad89189b6 },
+    { 0x92d91c2eae97f1, 0xef5eca262b4662, 0x440b213b38b10a, 0xec90187fc661da,
+      0x85f3f25f64cf8d, 0xcee53ca457ad1b, 0x8deed4bf517672, 0x7706fb34761828 }
+  },
+  {
+    { 0x1577d9117494fe, 0x52d29be2fd7239, 0x9a0eef00186d37, 0x241d0f527fe108,
+      0x42824bae6fb59f, 0xb8d33df0d48c25, 0xfffdb0a47af4b0, 0x534c601073b0b6 },
+    { 0xe6df35951c033b, 0x3e1002b86c0f94, 0xa7cb55548fb9b6, 0x999818ba7bbff8,
+      0xe4ba3d684d8bf2, 0x53dbb326358f0a, 0xeebc1e2f2568e8, 0xc6917ebb3e0f68 }
+  },
+  {
+    { 0xbe1bbfc19f8d13, 0xc3951b62d4795c, 0x9371c49ed535a9, 0x77c389f68cebea,
+      0xfc1a947a141d0e, 0x4b48d7ade44f8b, 0x3db1f058580a26, 0xeed1466258b5fc },
+    { 0x5daa4a19854b21, 0x5bfa46f1ab1ead, 0xc152e3559957eb, 0xdc84277ea48ada,
+      0x68709cffc169b5, 0xde50ce3720e617, 0xe42f262dd9a832, 0xddffd4d2d6ce29 }
+  },
+  {
+    { 0xd5ba5578fa0a56, 0x0d7d0f1fafaf4c, 0x7666e4138b63ed, 0x04e65135d87f02,
+      0xdca8866c958f32, 0xaa8486d3ce2686, 0xe3785caf1cbcd3, 0x8a9b11403c8335 },
+    { 0x5c1dca22e0ef60, 0x775af5b7d3fb20, 0xe690ffc2b373a8, 0x30fe15d28330e6,
+      0x8a1022bdd0f393, 0x6bd7364966a828, 0x8d4b154949208a, 0xfb38c6bb9d9828 }
+  }
+},
+{
+  {
+    { 0x6d197640340ac2, 0x969f473ecab5ff, 0xead46f7c458e42, 0x168646a1d00eed,
+      0xf70c878e0ce0cf, 0xa7291d38d8d15a, 0x92cf916fdd10cc, 0x6d3613424f86d5 },
+    { 0xba50d172d5c4b4, 0xe0af5024626f15, 0x76f3809d76098a, 0x433dc27d6caaa8,
+      0x72dc67a70d97a7, 0x935b360f5c7355, 0xdbaac93179bb31, 0x76738487ed1a33 }
+  },
+  {
+    { 0x8d1ca668f9fa0d, 0x4ed95d8a02f2bf, 0xd19fc79f630d7b, 0x0448ec4f46fa51,
+      0xb371dd8623bf3f, 0xe94fabcd650e94, 0x3af3fcacd90a70, 0x0f720c403ce3b7 },
+    { 0x590814cd636c3b, 0xcf6928d4469945, 0x5843aaf484a4c6, 0xb5a4c1af9b4722,
+      0x25116b36cfb2f9, 0xf248cf032c2640, 0x8cd059e27412a1, 0x866d536862fc5d }
+  },
+  {
+    { 0x156e62f6de4a2e, 0x0365af7aafcc78, 0x65c861819e925e, 0x4db5c01f8b2191,
+      0x1fd26d1ad564fa, 0x16bbc5319c8610, 0x0718eef815f262, 0x8684f4727f83d1 },
+    { 0xa30fd28b0f48db, 0x6fef5066ab8278, 0xd164e771a652df, 0x5a486f3c6ebc8c,
+      0xb68b498dc3132b, 0x264b6efd73323f, 0xc261eb669b2262, 0xd17015f2a35748 }
+  },
+  {
+    { 0x4241f657c4bb1d, 0x5671702f5187c4, 0x8a9449f3973753, 0x272f772cc0c0cd,
+      0x1b7efee58e280c, 0x7b323494b5ee9c, 0xf23af4731142a5, 0x80c0e1dd62cc9e },
+    { 0xcbc05bf675ffe3, 0x66215cf258ce3c, 0xc5d223928c9110, 0x30e12a32a69bc2,
+      0x5ef5e8076a9f48, 0x77964ed2329d5f, 0xdf81ba58a72cf2, 0x38ea70d6e1b365 }
+  },
+  {
+    { 0x1b186802f75c80, 0x0c153a0698665a, 0x6f5a7fe522e8dd, 0x96738668ddfc27,
+      0x7e421d50d3bdce, 0x2d737cf25001b2, 0x568840f0e8490c, 0xea2610be30c8da },
+    { 0xe7b1bc09561fd4, 0xeda786c26decb0, 0x22369906a76160, 0x371c71478a3da3,
+      0x1db8fce2a2d9bf, 0x59d7b843292f92, 0x8097af95a665f9, 0x7cb4662542b7a9 }
+  },
+  {
+    { 0xa5c53aec6b0c2f, 0xc4b87327312d84, 0xfc374cbc732736, 0xa8d78fe9310cc0,
+      0xd980e8665d1752, 0xa62692d6004727, 0x5d079280146220, 0xbd1fedb860fea5 },
+    { 0xcbc4f8ab35d111, 0x5ba8cdf3e32f77, 0xd5b71adb614b93, 0x7b3a2df2f8808d,
+      0x09b89c26ef2721, 0x55a505447c3030, 0x21044312986ae6, 0x427a0112367d4c }
+  },
+  {
+    { 0xe9fe256c1942d8, 0x9e7377d96e3546, 0x43e734cb0c1744, 0x5f46821211fbca,
+      0x44f83dc32b6203, 0x84513086ad1d96, 0x54dd5192fbb455, 0xc2a18222f10089 },
+    { 0x01055a21855bfa, 0x9e6d7b477078b4, 0x3f8df6d30cea0e, 0x81c215032973f7,
+      0x17dd761c0b3d40, 0x040424c50d0abe, 0x5599413783deab, 0xde9271e8f3146f }
+  },
+  {
+    { 0x5edfd25af4a11d, 0x3a3c5307846783, 0xb20086873edd31, 0x74e00ecfe0eef8,
+      0xba65d2f3dd78c7, 0xab1364371999f1, 0xfa9be5dde9a7e8, 0xeb146ce87a8609 },
+    { 0x76afd6565353e9, 0xfa7023dd51ba1c, 0x7a09f2237ede4f, 0xca085760ba7a1b,
+      0xd973882b99950a, 0xe894266ea5057a, 0xd01c4217f55e49, 0x69cfb9c5555679 }
+  }
+},
+{
+  {
+    { 0x67867e7c5d631a, 0x1de88c55bcf47b, 0x8366d06afd1352, 0xd7dbdef6e20337,
+      0xb0f9e2f1253ec7, 0x1be984510ad240, 0x63ec533f4a6118, 0xd5e4c5b96ce633 },
+    { 0x1d0b6c34df4a25, 0xef9486a5a1b554, 0x2f0e59e47b6ef3, 0x4d8042f2ff84d7,
+      0x3e74aa3da359c9, 0x1baa16fd21c160, 0xb4cff210191cba, 0x50032d8ebc6472 }
+  },
+  {
+    { 0xb6833e01fc1b13, 0x8a8b7ba1a5ad8f, 0xc0cafa2622b820, 0xc6663af738ed20,
+      0xd8944868b18f97, 0xcf0c1f9774fbe4, 0xeedd4355be814f, 0xd81c02db57e543 },
+    { 0x5e32afc310bad8, 0x065bc819b813d1, 0x8efc5fc3142795, 0x5006514732d59c,
+      0x91e39df2b5a3ce, 0x2ad4477faf4204, 0x1a96b184d9bd4f, 0xc3fee95a4d9c07 }
+  },
+  {
+    { 0xfac7df06b4ba61, 0xa6ed551061aaef, 0x35aa2d6133f609, 0x420cfba20ed13d,
+      0x861c63eea03d0c, 0x75f0c56f936d6e, 0xa25f68f3d9a3d5, 0xba0b7fecd9f66e },
+    { 0x292e1354680772, 0x6f6a2dba73f405, 0xca6add924ea9e4, 0x81cfd61268daaa,
+      0x7a4cb6ce6f147a, 0x8ec3454bded8f5, 0xc8a893b11d61cb, 0x2256ffc7656022 }
+  },
+  {
+    { 0x6b33271575cb78, 0x560d305adcd23e, 0xeedbd3ad6d834b, 0x614a64a5a31e27,
+      0xe40b47647ee0c8, 0x8ef4ff68bd7c2c, 0xa5297fc0b77727, 0x8759208baf88ad },
+    { 0x86cfe64918df68, 0x9d60a73cdd882e, 0x546b642b953014, 0xbaceae38bbef55,
+      0xdf58e43f1c3467, 0x99a83fee9f9bab, 0xcd52cbf57a4a8b, 0xf744e968ae36ec }
+  },
+  {
+    { 0xb945869a607124, 0x810dbe9440e6f6, 0x9911e60738e381, 0x51df68c343b80b,
+      0xe424336f7a3f39, 0x2d32acb989015c, 0xa69b14931019e8, 0x8a31a38ec12f93 },
+    { 0x0d0d36997c916a, 0xdc95f3b8885372, 0xcf1a2613549040, 0x60f6f5eabe95a2,
+      0xa909e9fe141325, 0x7d598f2355c865, 0x70c6442931a9c9, 0x2354a85b423850 }
+  },
+  {
+    { 0x4cdd22497f9619, 0x4776fffc22162e, 0xee5ec330cd31c2, 0x7c04c10f209bb8,
+      0x35bbfde579e211, 0x0e3832515cdfc2, 0x657e6d3e26ffa7, 0xc66a7c3c65c604 },
+    { 0x322acd7b45e567, 0x1589cf0296db9b, 0x1fd0bd3ba1db73, 0xe8826109337a40,
+      0xf505a50b3035c7, 0x4d5af066ed08d7, 0xb3c376b5eda400, 0x9c7b7001944748 }
+  },
+  {
+    { 0xd76832570c3716, 0xda62af0dd540e0, 0x76b155d6580fea, 0x4f42acc32b5464,
+      0x881bb603f5b72b, 0x09c130ee68b9ba, 0x37ede3b5c50342, 0xce61a9cfd15e7d },
+    { 0xfff1d8572605d0, 0x62ac2d3062abc2, 0xa85e02efbe43dd, 0x859d2baa947020,
+      0x2ebc8a9111c20b, 0x7f590a7a656f66, 0x0e1384316b21a6, 0x29b30c500c7db6 }
+  },
+  {
+    { 0x61e55e2906b8de, 0x6a97e96949974d, 0x24b52b526eef67, 0x512f5361aa595a,
+      0x81cc7b83c48fcb, 0xa64af2328115ad, 0x9edf6f93d44b8e, 0x68d7f7c1fe22e3 },
+    { 0x2b2116a520d151, 0x66a0b7d6aa3efb, 0x48ae70a9b0f791, 0xcf12174037db88,
+      0x36868cd317d9f3, 0xb57305922fc344, 0xbaa852646a5d23, 0xad6569137fc10d }
+  }
+},
+{
+  {
+    { 0xcf8e5f512c78d5, 0xeb94d98805cdbd, 0xad1dcdf2ab50b5, 0xf33c136f33cd31,
+      0x0d6226b10aeff5, 0xf7ff493f2f8fc5, 0x7e520d4df57165, 0x41fbae505271a7 },
+    { 0x72c898776480ba, 0x260835925f4523, 0xed36b8d49f5f01, 0x3bc1dcef3d49eb,
+      0x30c1c1a4940322, 0x78c1cda7e0f731, 0x51f2dc86d05a31, 0x57b0aa807f3522 }
+  },
+  {
+    { 0x7ab628e71f88bc, 0xcf585f38018f21, 0xdbbe3a413d64f6, 0x0f86df1ec493a5,
+      0x8355e6c7725de9, 0x3954ffee00fe1e, 0xbb8978f9924e32, 0x1c192987812714 },
+    { 0x7c4ce3eaabca8b, 0xf861eb59bf7019, 0x31a84fc682e541, 0x2307ca9acd1b92,
+      0x6f8b6ce4bf2842, 0xde252accb9f9a9, 0x7f0611d93c46d1, 0x8e2bd80751dc98 }
+  },
+  {
+    { 0xf2fd8fbe27d54b, 0x2a1e37ec248071, 0x2fcc888ab8f49a, 0x42c62a3c18a9e5,
+      0xe30290870b2446, 0x90277fac5ac55d, 0x8d97d56d6dde41, 0xf4cf8a95db04fe },
+    { 0x3e280f5d30d077, 0x2c903073cb3293, 0xe0be2ac24eb0dd, 0xa2d1a498bcb4f0,
+      0x16db466cd0cd45, 0x3b28aa79a80232, 0xdd7e52f17b008e, 0x20685f2868e4da }
+  },
+  {
+    { 0x0a68c147c7a486, 0xd8ef234c429633, 0x470667bffe7506, 0x55a13c88828d51,
+      0x5f327412e44bef, 0x537d92a5929f92, 0x0a01d5b31c5cd5, 0xb77aa7867eb3d7 },
+    { 0x36ec45f8b82e4d, 0x6821da0b37b199, 0x8af37aad7fa94e, 0xf0206421085010,
+      0x9b886787e56851, 0x35f394452948ce, 0x125c2baafc1361, 0x8a57d0e453e332 }
+  },
+  {
+    { 0xefe99488043664, 0xb8b8509db1aa55, 0x1a2e5a9332523f, 0x5e255dd1045c0f,
+      0xe68dd8a7ae7180, 0x55f1cf345bf532, 0xe00722ee63a716, 0xd1c21386116bac },
+    { 0x626221f1c6d1f4, 0x240b8303773278, 0xe393a0d88def16, 0x229266eca0495c,
+      0x7b5c6c9d3e4608, 0xdc559cb7927190, 0x06afe42c7b3c57, 0x8a2ad0bb439c9b }
+  },
+  {
+    { 0xd7360fbffc3e2f, 0xf721317fbd2e95, 0x8cacbab5748e69, 0x7c89f279054bb9,
+      0xcbe50faaa86881, 0x7aa05d375206e4, 0x1ea01bcc752c66, 0x5968cde1f2c2bc },
+    { 0x487c55f09a853e, 0x82cbef1e09204b, 0xad5c492abd8670, 0x7175963f12dcb3,
+      0x7a85762bf6aa06, 0x02e5697f8d5237, 0xccf7d1937c6157, 0x3b14ca6c2fd59c }
+  },
+  {
+    { 0x5e610d81b9f77f, 0x85876d0051b02f, 0x5d81c63b8020dd, 0xd0b4116d6ce614,
+      0x91810e5aa8bf0c, 0xf27f91fcbf8c66, 0x2e5dc5f38480ae, 0x0a13ffebec7633 },
+    { 0x61ff6492bf6af8, 0xe6aef2d641f827, 0xad5708a5de5f04, 0xe5c3a80cdfee20,
+      0x88466e268fcfa2, 0x8e5bb3ad6e1d7b, 0xa514f06ed236b8, 0x51c9c7ba5f5274 }
+  },
+  {
+    { 0xa19d228f9bc3d8, 0xf89c3f03381069, 0xfee890e5c3f379, 0x3d3ef3d32fb857,
+      0x39988495b418dd, 0x6786f73c46e89a, 0x79691a59e0f12f, 0x76916bf3bc022b },
+    { 0xea073b62cd8a0a, 0x1fbedd4102fdbc, 0x1888b14cb9d015, 0x98f2cfd76655f7,
+      0xb9b591059f0494, 0xa3dbbe1e6986a3, 0xef016a5eaf2b04, 0xf671ba7cd2d876 }
+  }
+},
+{
+  {
+    { 0x1dae3bf1ae05e9, 0x6a029961f21fef, 0x95df2b97aec3c6, 0x9abbc5ad83189b,
+      0xaf994af2d13140, 0xc3f884686aa406, 0xcd77e5075284c5, 0x1c1e13d2a9a4d7 },
+    { 0x7f8815d744b89d, 0xb1891332ba673e, 0x55ea93cd594570, 0x19c8a18d61b041,
+      0x938ebaa8d2c580, 0x9b4344d05ba078, 0x622da438eaf9b7, 0x809b8079fea368 }
+  },
+  {
+    { 0x3780e51c33b7a2, 0xd7a205c387b1c8, 0x79515f84be60e4, 0xde02a8b1e18277,
+      0x4645c96f0d9150, 0x45f8acbe0b3fd1, 0x5d532ba9b53ac3, 0x7984dcdb0557c9 },
+    { 0x5ae5ca68a92f01, 0xd2fbb3c9d569ca, 0x668cc570c297c1, 0xa4829436295e89,
+      0xf646bc1a33ad40, 0x066aaa4c3f425d, 0x23434cdd005de2, 0x5aca9e9db35af4 }
+  },
+  {
+    { 0x2bca35c6877c56, 0xab864b4f0ddd7d, 0x5f6aa74404f46c, 0x72be164539c279,
+      0x1b1d73ee0283cf, 0xe550f46ad583d9, 0x4ac6518e739ad1, 0x6b6def78d42100 },
+    { 0x4d36b8cfa8468d, 0x2cb37735a3d7b8, 0x577f86f5016281, 0xdb6fe5f9124733,
+      0xacb6d2ae29e039, 0x2ab8330580b8a1, 0x130a4ac643b2d0, 0xa7996e35e6884e }
+  },
+  {
+    { 0x6fb627760a0aa8, 0xe046843cbe04f0, 0xc01d120e6ad443, 0xa42a05cabef2fc,
+      0x6b793f112ff09c, 0x5734ea8a3e5854, 0xe482b36775f0ad, 0x2f4f60df864a34 },
+    { 0xf521c5884f2449, 0x58734a99186a71, 0x157f5d5ac5eacc, 0x858d9a4248ee61,
+      0x0727e6d48149c3, 0xd5c3eaaac9ec50, 0xa63a64a20ee9b5, 0x3f0dfc487be9de }
+  },
+  {
+    { 0x836349db13e3f4, 0xebdd0263e9316d, 0x3fd61e8324fd6c, 0x85dddfa0964f41,
+      0x06e72de52add1b, 0xb752cff8c4a9e2, 0x53b0894fdf09f7, 0xd5220ab0bc24fd },
+    { 0x8442b35fb1981a, 0xa733a373edd701, 0x42b60c3d0ef089, 0xa1b16ec46e7bca,
+      0xc0df179a09aaf4, 0xcd4f187638f3a1, 0x9af64f79eab1c2, 0x86fed79d1d78e3 }
+  },
+  {
+    { 0x42c8d86fe29980, 0x6657b816575660, 0x82d52c680f92ca, 0x8587af102d42be,
+      0xb5151316e8bdf0, 0x706e2d9c333495, 0xd53601a9673064, 0x27b1fbb8219099 },
+    { 0x3f0929d705f7c8, 0xff40b10f3d6e6f, 0x673c703026af5c, 0x2c1dce4e25a422,
+      0x5348bd73dad8b6, 0xc39b6b6be2c329, 0x47854ffb921084, 0xb347b8bb391f20 }
+  },
+  {
+    { 0x79fc841eb9b774, 0xf32da25b4b6c1d, 0xcbba76bfe492cb, 0x76c51fcd623903,
+      0x114cf6fcf0705a, 0x6b720497815daf, 0x630b362473382e, 0xbf40c3a9704db5 },
+    { 0xa8a9ddcc5456eb, 0x2b4472a72f2dc1, 0x9874444d6d6ef3, 0x27e8d85a0ba5ed,
+      0x5d225b4194849f, 0xe852cd6ebaa40d, 0xb669c248d4bf3f, 0xa8601eb2343991 }
+  },
+  {
+    { 0x8a0485459502d3, 0xcab27eee269a7b, 0x41793074875ada, 0x179e685e2405f9,
+      0x0d7b6987b28963, 0x80c9db8422a43e, 0xf5ff318a0f43ee, 0x7a928054ba7aa7 },
+    { 0xa5c79fe0c0834e, 0x837ca0d1f849ec, 0xfe0d7fa628ab7b, 0x94bcb956edd19a,
+      0xa18bc932226fbf, 0x2795379aad54a3, 0xceeacf8371129e, 0x65ca57fa588be5 }
+  }
+}
+};
+
+/* Double a point. r = 2.p
+ * Formula from RFC 8032 section 5.2.4.
+ *
+ * r  Point to hold result.
+ * p  Point to double.
+ */
+static void ge448_dbl(ge448_p2* r, const ge448_p2* p)
+{
+    fe448 b, c, d, e, j;
+
+    fe448_add(b, p->X, p->Y);
+    fe448_sqr(b, b);
+    fe448_sqr(c, p->X);
+    fe448_sqr(d, p->Y);
+    fe448_add(e, c, d);
+    fe448_sub(c, c, d);
+    fe448_sqr(j, p->Z);
+    fe448_add(j, j, j);
+    fe448_sub(j, e, j);
+    fe448_sub(b, b, e);
+    fe448_mul(r->X, b, j);
+    fe448_mul(r->Y, e, c);
+    fe448_mul(r->Z, e, j);
+}
+
+/* Add two points given C = X1.X2, D = Y1.Y2, A = Z1.Z2 and
+ * H = (X1+Y1).(X2+Y2).
+ * Formula from RFC 8032 section 5.2.4 with d = -39081.
+ *
+ * r  Point to hold result.
+ * a  Z1.Z2
+ * c  X1.X2
+ * d  Y1.Y2 - overwritten.
+ * h  (X1+Y1).(X2+Y2) - overwritten.
+ * b  A^2
+ */
+static void ge448_add_finish(ge448_p2* r, const fe448 a, const fe448 c,
+                             fe448 d, fe448 h, const fe448 b)
+{
+    fe448 e, f, g;
+
+    /* E = d.C.D = -39081.C.D */
+    fe448_mul(e, c, d);
+    fe448_mul39081(e, e);
+    fe448_add(f, b, e);
+    fe448_sub(g, b, e);
+    fe448_sub(h, h, c);
+    fe448_sub(h, h, d);
+    fe448_sub(d, d, c);
+    fe448_mul(h, h, f);
+    fe448_mul(d, d, g);
+    fe448_mul(r->X, h, a);
+    fe448_mul(r->Y, d, a);
+    fe448_mul(r->Z, f, g);
+}
+
+/* Add two points. r = p + q
+ *
+ * r  Point to hold result.
+ * p  Point to add.
+ * q  Point to add.
+ */
+static void ge448_add(ge448_p2* r, const ge448_p2* p, const ge448_p2* q)
+{
+    fe448 a, b, c, d, h, t;
+
+    fe448_mul(a, p->Z, q->Z);
+    fe448_sqr(b, a);
+    fe448_mul(c, p->X, q->X);
+    fe448_mul(d, p->Y, q->Y);
+    fe448_add(h, p->X, p->Y);
+    fe448_add(t, q->X, q->Y);
+    fe448_mul(h, h, t);
+    ge448_add_finish(r, a, c, d, h, b);
+}
+
+/* Add an affine point to a point. r = p + q
+ *
+ * r  Point to hold result.
+ * p  Point to add.
+ * q  Affine point to add.
+ */
+static void ge448_madd(ge448_p2* r, const ge448_p2* p, const ge448_precomp* q)
+{
+    fe448 a, b, c, d, h, t;
+
+    fe448_copy(a, p->Z);
+    fe448_sqr(b, a);
+    fe448_mul(c, p->X, q->x);
+    fe448_mul(d, p->Y, q->y);
+    fe448_add(h, p->X, p->Y);
+    fe448_add(t, q->x, q->y);
+    fe448_mul(h, h, t);
+    ge448_add_finish(r, a, c, d, h, b);
+}
+
+/* Set the point to the identity - (0, 1).
+ *
+ * r  Point to set.
+ */
+static void ge448_0(ge448_p2* r)
+{
+    fe448_0(r->X);
+    fe448_1(r->Y);
+    fe448_1(r->Z);
+}
+
+/* Constant time, return 1 when b is equal to c and 0 otherwise. */
+static WC_INLINE int equal(signed char b, signed char c)
+{
+    byte  ub = (byte)b;
+    byte  uc = (byte)c;
+    byte  x  = ub ^ uc; /* 0: yes; 1..255: no */
+    word32 y = x;       /* 0: yes; 1..255: no */
+
+    y -= 1;   /* 4294967295: yes; 0..254: no */
+    y >>= 31; /* 1: yes; 0: no */
+
+    return (int)y;
+}
+
+/* Constant time, return 1 when b is negative and 0 otherwise. */
+static WC_INLINE int negative(signed char b)
+{
+    return ((byte)b) >> 7;
+}
+
+/* Select the multiple of the base point from the table in constant time.
+ * r = b.256^pos.B
+ *
+ * r    Affine point to hold selected value.
+ * pos  Row of the table.
+ * b    Multiple to select, -8..8.
+ */
+static void ge448_select(ge448_precomp* r, int pos, signed char b)
+{
+    fe448 nx;
+    int   bnegative = negative(b);
+    signed char babs = (signed char)(b - (((-bnegative) & b) * 2));
+    int   i;
+
+    fe448_0(r->x);
+    fe448_1(r->y);
+    for (i = 0; i < 8; i++) {
+        int eq = equal(babs, (signed char)(i + 1));
+        fe448_cmov(r->x, base[pos][i].x, eq);
+        fe448_cmov(r->y, base[pos][i].y, eq);
+    }
+    fe448_neg(nx, r->x);
+    fe448_cmov(r->x, nx, bnegative);
+}
+
+/* Multiply the base point by the scalar in constant time. r = a.B
+ * Uses 4-bit signed windows with the even and odd windows handled
+ * separately so that one table row serves two windows.
+ *
+ * r  Point to hold result.
+ * a  Scalar to multiply by - must be reduced modulo the order.
+ * returns 0 on success.
+ */
+int ge448_scalarmult_base(ge448_p2* r, const byte* a)
+{
+    signed char   e[112];
+    signed char   carry;
+    ge448_precomp t;
+    int           i;
+
+    for (i = 0; i < 56; i++) {
+        e[2 * i + 0] = (a[i] >> 0) & 15;
+        e[2 * i + 1] = (a[i] >> 4) & 15;
+    }
+    /* each e[i] is between 0 and 15 */
+    /* e[111] is between 0 and 3 */
+
+    carry = 0;
+    for (i = 0; i < 111; i++) {
+        e[i] += carry;
+        carry = (signed char)(e[i] + 8);
+        carry >>= 4;
+        e[i] -= (signed char)(carry << 4);
+    }
+    e[111] += carry;
+    /* each e[i] is between -8 and 8 */
+
+    ge448_0(r);
+    for (i = 1; i < 112; i += 2) {
+        ge448_select(&t, i / 2, e[i]);
+        ge448_madd(r, r, &t);
+    }
+
+    ge448_dbl(r, r);
+    ge448_dbl(r, r);
+    ge448_dbl(r, r);
+    ge448_dbl(r, r);
+
+    for (i = 0; i < 112; i += 2) {
+        ge448_select(&t, i / 2, e[i]);
+        ge448_madd(r, r, &t);
+    }
+
+    ForceZero(e, sizeof(e));
+    ForceZero(&t, sizeof(t));
+
+    return 0;
+}
+
+/* Convert the scalar into signed odd digits with at most one non-zero digit
+ * in any window - sliding window non-adjacent form.
+ *
+ * r    Array of 448 digits.
+ * a    Scalar to convert.
+ * max  Largest digit value allowed - 2^w - 1.
+ */
+static void slide(signed char* r, const byte* a, int max)
+{
+    int i, b, k;
+
+    for (i = 0; i < 448; ++i) {
+        r[i] = 1 & (a[i >> 3] >> (i & 7));
+    }
+
+    for (i = 0; i < 448; ++i) {
+        if (r[i] == 0) {
+            continue;
+        }
+        for (b = 1; b <= 6 && i + b < 448; ++b) {
+            if (r[i + b] == 0) {
+                continue;
+            }
+            if (r[i] + (r[i + b] << b) <= max) {
+                r[i] = (signed char)(r[i] + (r[i + b] << b));
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= -max) {
+                r[i] = (signed char)(r[i] - (r[i + b] << b));
+                for (k = i + b; k < 448; ++k) {
+                    if (r[k] == 0) {
+                        r[k] = 1;
+                        break;
+                    }
+                    r[k] = 0;
+                }
+            }
+            else {
+                break;
+            }
+        }
+    }
+}
+
+/* Calculate r = a.A + b.B where B is the base point.
+ * Not constant time - only used with public values when verifying.
+ *
+ * r  Point to hold result.
+ * a  Scalar to multiply A by.
+ * A  Point to multiply.
+ * b  Scalar to multiply the base point by.
+ * returns 0 on success and MEMORY_E on dynamic memory allocation failure.
+ */
+int ge448_double_scalarmult_vartime(ge448_p2* r, const byte* a,
+                                    const ge448_p2* A, const byte* b)
+{
+#ifdef WOLFSSL_SMALL_STACK
+    signed char*   aslide;
+    signed char*   bslide;
+    ge448_p2*      Ai;
+#else
+    signed char    aslide[448];
+    signed char    bslide[448];
+    ge448_p2       Ai[8]; /* A, 3A, 5A, 7A, 9A, 11A, 13A, 15A */
+#endif
+    ge448_p2       A2;
+    ge448_p2       t;
+    ge448_precomp  q;
+    int            i;
+
+#ifdef WOLFSSL_SMALL_STACK
+    aslide = (signed char*)XMALLOC(2 * 448 + 8 * sizeof(ge448_p2), NULL,
+                                   DYNAMIC_TYPE_TMP_BUFFER);
+    if (aslide == NULL) {
+        return MEMORY_E;
+    }
+    bslide = aslide + 448;
+    Ai = (ge448_p2*)(bslide + 448);
+#endif
+
+    slide(aslide, a, 15);
+    slide(bslide, b, 7);
+
+    XMEMCPY(&Ai[0], A, sizeof(ge448_p2));
+    ge448_dbl(&A2, A);
+    for (i = 1; i < 8; i++) {
+        ge448_add(&Ai[i], &Ai[i - 1], &A2);
+    }
+
+    ge448_0(r);
+
+    for (i = 447; i >= 0; --i) {
+        if (aslide[i] || bslide[i]) {
+            break;
+        }
+    }
+
+    for (; i >= 0; --i) {
+        ge448_dbl(r, r);
+
+        if (aslide[i] > 0) {
+            ge448_add(r, r, &Ai[aslide[i] / 2]);
+        }
+        else if (aslide[i] < 0) {
+            fe448_neg(t.X, Ai[(-aslide[i]) / 2].X);
+            fe448_copy(t.Y, Ai[(-aslide[i]) / 2].Y);
+            fe448_copy(t.Z, Ai[(-aslide[i]) / 2].Z);
+            ge448_add(r, r, &t);
+        }
+
+        if (bslide[i] > 0) {
+            ge448_madd(r, r, &base[0][bslide[i] - 1]);
+        }
+        else if (bslide[i] < 0) {
+            fe448_neg(q.x, base[0][-bslide[i] - 1].x);
+            fe448_copy(q.y, base[0][-bslide[i] - 1].y);
+            ge448_madd(r, r, &q);
+        }
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(aslide, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return 0;
+}
+
+/* Convert the point to the 57 byte encoding: y in little-endian with the
+ * least significant bit of x in the top bit of the last byte.
+ *
+ * b  Array to hold encoding.
+ * p  Point to encode.
+ */
+void ge448_to_bytes(byte* b, const ge448_p2* p)
+{
+    fe448 recip;
+    fe448 x;
+    fe448 y;
+
+    fe448_invert(recip, p->Z);
+    fe448_mul(x, p->X, recip);
+    fe448_mul(y, p->Y, recip);
+    fe448_to_bytes(b, y);
+    b[56] = (byte)(fe448_isnegative(x) << 7);
+}
+
+/* Compress the affine point (x,y), given as big-endian byte arrays, into the
+ * 57 byte encoding.
+ *
+ * out    Array to hold encoding.
+ * xIn    Big-endian x-ordinate.
+ * yIn    Big-endian y-ordinate.
+ * keySz  Length of each ordinate - must be ED448_PUB_KEY_SIZE.
+ * returns 0 on success and BAD_FUNC_ARG when a length or value is invalid.
+ */
+int ge448_compress_key(byte* out, const byte* xIn, const byte* yIn,
+                       word32 keySz)
+{
+    ge448_p2 g;
+    byte     x[ED448_PUB_KEY_SIZE];
+    byte     y[ED448_PUB_KEY_SIZE];
+    word32   i;
+
+    if ((keySz != ED448_PUB_KEY_SIZE) || (xIn[0] != 0) || (yIn[0] != 0)) {
+        return BAD_FUNC_ARG;
+    }
+
+    for (i = 0; i < keySz; i++) {
+        x[keySz - 1 - i] = xIn[i];
+        y[keySz - 1 - i] = yIn[i];
+    }
+
+    fe448_from_bytes(g.X, x);
+    fe448_from_bytes(g.Y, y);
+    fe448_1(g.Z);
+
+    ge448_to_bytes(out, &g);
+
+    return 0;
+}
+
+/* Decode the point and negate it. Not constant time.
+ * Implemented to RFC 8032 section 5.2.3 with the extra negation so that the
+ * result can be added when verifying.
+ *
+ * r  Point to hold result.
+ * b  57 byte encoding of point.
+ * returns 0 on success and -1 when the encoding is not a valid point.
+ */
+int ge448_from_bytes_negate_vartime(ge448_p2* r, const byte* b)
+{
+    byte  check[56];
+    fe448 u, v, t, x;
+    int   sign;
+
+    /* Only the top bit of the last byte is used. */
+    if ((b[56] & 0x7f) != 0) {
+        return -1;
+    }
+    sign = b[56] >> 7;
+
+    fe448_from_bytes(r->Y, b);
+    /* y must be less than the prime. */
+    fe448_to_bytes(check, r->Y);
+    if (XMEMCMP(check, b, sizeof(check)) != 0) {
+        return -1;
+    }
+    fe448_1(r->Z);
+
+    /* u = y^2 - 1, v = d.y^2 - 1 */
+    fe448_sqr(u, r->Y);
+    fe448_mul39081(v, u);
+    fe448_neg(v, v);
+    fe448_sub(u, u, r->Z);
+    fe448_sub(v, v, r->Z);
+
+    /* x = u^3.v.(u^5.v^3)^((p-3)/4) */
+    fe448_sqr(t, u);
+    fe448_mul(x, t, u);
+    fe448_mul(x, x, v);
+    fe448_mul(t, u, v);
+    fe448_sqr(t, t);
+    fe448_mul(t, t, x);
+    fe448_pow_2_446_222_1(t, t);
+    fe448_mul(x, x, t);
+
+    /* Check v.x^2 == u */
+    fe448_sqr(t, x);
+    fe448_mul(t, t, v);
+    fe448_sub(t, t, u);
+    if (fe448_isnonzero(t)) {
+        return -1;
+    }
+    if (!fe448_isnonzero(x) && sign) {
+        return -1;
+    }
+
+    /* Choose the root with the other sign to negate the point. */
+    if (fe448_isnegative(x) == sign) {
+        fe448_neg(r->X, x);
+    }
+    else {
+        fe448_copy(r->X, x);
+    }
+
+    return 0;
+}
+
+#endif /* HAVE_ED448 */
@@ -29,3 +29,5263 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+
+#ifdef HAVE_ED25519
+
+#include <wolfssl/wolfcrypt/ge_operations.h>
+#include <wolfssl/wolfcrypt/ed25519.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+    #define WOLFSSL_MISC_INCLUDED
+    #include <wolfcrypt/src/misc.c>
+
+/*
+ge means group element.
+
+Here the group is the set of pairs (x,y) of field elements (see
+fe_operations.h) satisfying -x^2 + y^2 = 1 + d x^2y^2
+where d = -121665/121666.
+
+Representations:
+  ge_p2 (projective): (X:Y:Z) satisfying x=X/Z, y=Y/Z
+  ge_p3 (extended): (X:Y:Z:T) satisfying x=X/Z, y=Y/Z, XY=ZT
+  ge_p1p1 (completed): ((X:Z),(Y:T)) satisfying x=X/Z, y=Y/T
+  ge_precomp (Duif): (y+x,y-x,2dxy)
+*/
+
+static void ge_p2_0(ge_p2 *h);
+static void ge_p3_0(ge_p3 *h);
+#ifndef CURVED25519_ASM
+static void ge_precomp_0(ge_precomp *h);
+#endif
+static void ge_p3_to_p2(ge_p2 *r,const ge_p3 *p);
+static WC_INLINE void ge_p3_to_cached(ge_cached *r,const ge_p3 *p);
+static WC_INLINE void ge_p1p1_to_p2(ge_p2 *r,const ge_p1p1 *p);
+static WC_INLINE void ge_p1p1_to_p3(ge_p3 *r,const ge_p1p1 *p);
+static WC_INLINE void ge_p2_dbl(ge_p1p1 *r,const ge_p2 *p);
+static void ge_p3_dbl(ge_p1p1 *r,const ge_p3 *p);
+static WC_INLINE void ge_madd(ge_p1p1 *r,const ge_p3 *p,const ge_precomp *q);
+static WC_INLINE void ge_msub(ge_p1p1 *r,const ge_p3 *p,const ge_precomp *q);
+static WC_INLINE void ge_add(ge_p1p1 *r,const ge_p3 *p,const ge_cached *q);
+static WC_INLINE void ge_sub(ge_p1p1 *r,const ge_p3 *p,const ge_cached *q);
+
+/*
+sc means scalar.
+Input:
+  s[0]+256*s[1]+...+256^63*s[63] = s
+
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = s mod l
+  where l = 2^252 + 27742317777372353535851937790883648493.
+
+Scalars are worked on as 21-bit limbs held in signed 64-bit words. A limb at
+position i >= 12 is worth limb * 2^(21*(i-12)) * 2^252 and is folded down
+using 2^252 = -27742317777372353535851937790883648493 (mod l), the negated
+constant being 666643 + 470296*2^21 + 654183*2^42 - 997805*2^63 +
+136657*2^84 - 683901*2^105.
+*/
+
+#define SC_LIMB_MASK    0x1fffff
+
+/* Load the 21-bit limb number i of a little-endian scalar.
+ *
+ * in    Scalar as an array of bytes.
+ * i     Index of limb.
+ * last  Non-zero when the limb is the top one and takes the remaining bits.
+ * returns the limb value.
+ */
+static WC_INLINE sword64 sc_limb(const byte* in, int i, int last)
+{
+    int    bit = 21 * i;
+    const byte* p = in + (bit >> 3);
+    word64 w = ((word64)p[0]      ) | ((word64)p[1] <<  8) |
+               ((word64)p[2] << 16) | ((word64)p[3] << 24);
+
+    w >>= bit & 7;
+    if (!last)
+        w &= SC_LIMB_MASK;
+    return (sword64)w;
+}
+
+/* Fold limb i (>= 12) into limbs i-12 to i-7 and clear it. */
+static WC_INLINE void sc_fold(sword64* t, int i)
+{
+    t[i - 12] += t[i] * 666643;
+    t[i - 11] += t[i] * 470296;
+    t[i - 10] += t[i] * 654183;
+    t[i -  9] -= t[i] * 997805;
+    t[i -  8] += t[i] * 136657;
+    t[i -  7] -= t[i] * 683901;
+    t[i] = 0;
+}
+
+/* Carry limbs from..to-1 into the next limb, leaving values in
+ * [-2^20, 2^20). */
+static WC_INLINE void sc_carry_signed(sword64* t, int from, int to)
+{
+    int i;
+    sword64 c;
+
+    for (i = from; i < to; i++) {
+        c = (t[i] + (1 << 20)) >> 21;
+        t[i + 1] += c;
+        t[i] -= c * ((sword64)1 << 21);
+    }
+}
+
+/* Carry limbs from..to-1 into the next limb, leaving values in [0, 2^21). */
+static WC_INLINE void sc_carry(sword64* t, int from, int to)
+{
+    int i;
+    sword64 c;
+
+    for (i = from; i < to; i++) {
+        c = t[i] >> 21;
+        t[i + 1] += c;
+        t[i] -= c * ((sword64)1 << 21);
+    }
+}
+
+/* Reduce the 24 limb value in t modulo l and store as 32 bytes.
+ *
+ * s  Array of 32 bytes to hold result.
+ * t  24 limbs of about 21 bits each, the top limb may be up to 30 bits.
+ */
+static void sc_reduce_limbs(byte* s, sword64* t)
+{
+    int    i;
+    int    bits = 0;
+    word64 acc = 0;
+
+    for (i = 23; i >= 18; i--)
+        sc_fold(t, i);
+    sc_carry_signed(t, 6, 17);
+
+    for (i = 17; i >= 12; i--)
+        sc_fold(t, i);
+    sc_carry_signed(t, 0, 12);
+
+    sc_fold(t, 12);
+    sc_carry(t, 0, 12);
+
+    sc_fold(t, 12);
+    sc_carry(t, 0, 11);
+
+    for (i = 0; i < 12; i++) {
+        acc |= (word64)t[i] << bits;
+        bits += 21;
+        while (bits >= 8) {
+            *(s++) = (byte)acc;
+            acc >>= 8;
+            bits -= 8;
+        }
+    }
+    *s = (byte)acc;
+}
+
+void sc_reduce(byte* s)
+{
+    sword64 t[24];
+    int     i;
+
+    for (i = 0; i < 24; i++)
+        t[i] = sc_limb(s, i, i == 23);
+
+    sc_reduce_limbs(s, t);
+
+    ForceZero(t, sizeof(t));
+}
+
+/*
+Input:
+  a[0]+256*a[1]+...+256^31*a[31] = a
+  b[0]+256*b[1]+...+256^31*b[31] = b
+  c[0]+256*c[1]+...+256^31*c[31] = c
+
+Output:
+  s[0]+256*s[1]+...+256^31*s[31] = (ab+c) mod l
+  where l = 2^252 + 27742317777372353535851937790883648493.
+*/
+void sc_muladd(byte* s, const byte* a, const byte* b, const byte* c)
+{
+    sword64 al[12];
+    sword64 bl[12];
+    sword64 t[24];
+    int     i;
+    int     j;
+
+    for (i = 0; i < 12; i++) {
+        al[i] = sc_limb(a, i, i == 11);
+        bl[i] = sc_limb(b, i, i == 11);
+        t[i] = sc_limb(c, i, i == 11);
+    }
+    for (i = 12; i < 24; i++)
+        t[i] = 0;
+    for (i = 0; i < 12; i++) {
+        for (j = 0; j < 12; j++)
+            t[i + j] += al[i] * bl[j];
+    }
+    sc_carry_signed(t, 0, 23);
+
+    sc_reduce_limbs(s, t);
+
+    ForceZero(al, sizeof(al));
+    ForceZero(t, sizeof(t));
+}
+
+
+#ifdef CURVED25519_ASM_64BIT
+/* d */
+static const ge d = { 0x75eb4dca135978a3, 0x00700a4d4141d8ab,
+                      -0x7338bf8688861768, 0x52036cee2b6ffe73 };
+
+/* 2 * d */
+static const ge d2 = { -0x1429646bd94d0ea7, 0x00e0149a8283b156,
+                       0x198e80f2eef3d130, 0x2406d9dc56dffce7 };
+
+/* sqrt(-1) */
+static const ge sqrtm1 = { -0x3b11e4d8b5f15f50, 0x2f431806ad2fe478,
+                           0x2b4d00993dfbd7a7, 0x2b8324804fc1df0b };
+
+
+/* base[i][j] = (j+1)*256^i*B */
+static const ge_precomp base[32][8] = {
+  {
+    {
+      { 0x2fbc93c6f58c3b85, -0x306cd2390473f1e7,
+        0x270b4898643d42c2, 0x07cf9d3a33d4ba65 },
+      { -0x62efc6fa28bf6ec2, -0x02c660fa2ebf414d,
+        -0x5a3e7bcb977075f7, 0x44fd2f9298f81267 },
+      { -0x5436edfa78855598, 0x26d9e823ccaac49e,
+        0x5a1b7dcbdd43598c, 0x6f117b689f0c65a8 }
+    },
+    {
+      { -0x6ddb18036cc38e29, -0x60b9626985f00a4b,
+        0x5aa69a65e1d60702, 0x590c063fa87d2e2e },
+      { -0x75665a9fbd4b2a58, -0x70d47ef3b19f530a,
+        -0x1f61dc944e91c856, 0x6bb595a669c92555 },
+      { 0x43faa8b3a59b7a5f, 0x36c16bdd5d9acf78,
+        0x500fa0840b3d6a31, 0x701af5b13ea50b73 }
+    },
+    {
+      { -0x50da4f57b31168d0, 0x025a8430e8864b8a,
+        -0x3ee4affd60fe98ce, 0x7a164e1b9a80f8f4 },
+      { 0x56611fe8a4fcd265, 0x3bd353fde5c1ba7d,
+        -0x7ece0ce5deb42943, 0x2ab91587555bda62 },
+      { 0x14ae933f0dd0d889, 0x589423221c35da62,
+        -0x2e8f1aba730d24b4, 0x5a2826af12b9b4c6 }
+    },
+    {
+      { 0x287351b98efc099f, 0x6765c6f47dfd2538,
+        -0x35cb72c204f56d9b, 0x680e910321e58727 },
+      { -0x6a01faf5fa97e741, 0x327e89715660faa9,
+        -0x3c171c32f95faf8d, 0x27933f4c7445a49a },
+      { 0x5a13fbe9c476ff09, 0x6e9e39457b5cc172,
+        0x5ddbdcf9102b4494, 0x7f9d0cbf63553e2b }
+    },
+    {
+      { -0x5ded43bbf75a44cd, -0x72afb73c38a112fe,
+        -0x22e414f3a54013bc, 0x2945ccf146e206eb },
+      { 0x7f9182c3a447d6ba, -0x2affeb2eb4d8d649,
+        -0x1cc30ee3479b5f79, 0x154a7e73eb1b55f3 },
+      { -0x4344240e7ed57d7b, 0x270e0807d0bdd1fc,
+        -0x4be498f4e44258d3, 0x43aabe696b3bb69a }
+    },
+    {
+      { 0x3a0ceeeb77157131, -0x64d8ea76ff375078,
+        -0x7f9a499725a658ca, 0x51e57bb6a2cc38bd },
+      { 0x499806b67b7d8ca4, 0x575be28427d22739,
+        -0x44f7a318dfbaac47, 0x38b64c41ae417884 },
+      { -0x7a53cd98fd15b48f, -0x418f1ffcbe5e44ff,
+        0x53e4a24b083bc144, 0x10b8e91a9f0d61e3 }
+    },
+    {
+      { 0x6b1a5cd0944ea3bf, 0x7470353ab39dc0d2,
+        0x71b2528228542e49, 0x461bea69283c927e },
+      { -0x4590d36555cdde4f, 0x6ca021533bba23a7,
+        -0x621589b06de6d3c6, 0x1d6edd5d2e5317e0 },
+      { -0x0e7c9237fe474c5e, -0x4cfca0b8fac15b66,
+        0x529c41ba5877adf3, 0x7a9fbb1c6a0f90a7 }
+    },
+    {
+      { 0x59b7596604dd3e8f, 0x6cb30377e288702c,
+        -0x4ecc6399a1263cdd, 0x0915e76061bce52f },
+      { -0x1d58a2120c6dcb27, -0x69c2897f1e4aa707,
+        0x2c2741ac6e3c23fb, 0x3a9024a1320e01c3 },
+      { -0x183e0a26365d6ee6, -0x475c8e8774335829,
+        0x636412190eb62a32, 0x26907c5c2ecc4e95 }
+    }
+  },
+  {
+    {
+      { 0x2eccdd0e632f9c1d, 0x51d0b69676893115,
+        0x52dfb76ba8637a58, 0x6dd37d49a00eef39 },
+      { -0x12a49cabb655aea2, -0x579a3b60f4397dc6,
+        -0x7af3e016a4bd2e3c, 0x30d76d6f03d315b9 },
+      { 0x6c4444172106e4c7, -0x04ac297f6d728097,
+        -0x4b8c615b96b2c0da, 0x10c697112e864bb0 }
+    },
+    {
+      { 0x0ca62aa08358c805, 0x6a3d4ae37a204247,
+        0x7464d3a63b11eddc, 0x03bf9baf550806ef },
+      { 0x6493c4277dbe5fde, 0x265d4fad19ad7ea2,
+        0x0e00dfc846304590, 0x25e61cabed66fe09 },
+      { 0x3f13e128cc586604, 0x6f5873ecb459747e,
+        -0x5f49c21233ed970b, 0x566d78634586e22c }
+    },
+    {
+      { -0x5efabd7a39a5d030, 0x6c64112af31667c3,
+        0x680ae240731aee58, 0x14fba5f34793b22a },
+      { 0x1637a49f9cc10834, -0x4371a92a57643baf,
+        0x1cb5ec0f7f7fd2db, 0x33975bca5ecc35d9 },
+      { 0x3cd746166985f7d4, 0x593e5e84c9c80057,
+        0x2fc3f2b67b61131e, 0x14829cea83fc526c }
+    },
+    {
+      { 0x21e70b2f4e71ecb8, -0x19a92246bf5b881d,
+        -0x409aa93131e2b080, 0x05fc3bc4535d7b7e },
+      { -0x00bc847b68226a3e, 0x6c744e30aa4eb5a7,
+        -0x61f3a29ec37a1775, 0x2fd9c71e5f758173 },
+      { 0x24b8b3ae52afdedd, 0x3495638ced3b30cf,
+        0x33a4bc83a9be8195, 0x373767475c651f04 }
+    },
+    {
+      { 0x634095cb14246590, -0x10edebbfe93eaacb,
+        -0x61c7ebf376ef43a0, 0x6bf5905730907c8c },
+      { 0x2fba99fd40d1add9, -0x4cf8e990690b2fd9,
+        0x4363f05215f03bae, 0x1fbea56c3b18f999 },
+      { 0x0fa778f1e1415b8a, 0x06409ff7bac3a77e,
+        0x6f52d7b89aa29a50, 0x02521cf67a635a56 }
+    },
+    {
+      { -0x4eeb98df88d0a11c, -0x17076b4e69f86532,
+        0x4af8224d00ac824a, 0x001753d9f7cd6cc4 },
+      { 0x513fee0b0a9d5294, -0x706718a3f020a59a,
+        -0x2b9e7977401ef832, 0x3fa00a7e71382ced },
+      { 0x3c69232d963ddb34, 0x1dde87dab4973858,
+        -0x55282e065f6e0d7b, 0x12b5fe2fa048edb6 }
+    },
+    {
+      { -0x20d483d95290e16e, 0x4b66d323504b8913,
+        -0x73bf623f8ae3743d, 0x6f7e93c20796c7b8 },
+      { 0x71f0fbc496fce34d, 0x73b9826badf35bed,
+        -0x2dfb8d9e00d73a9f, 0x749b76f96fb1206f },
+      { 0x1f5af604aea6ae05, -0x3edcae0e411b6367,
+        0x61a808b5eeff6b66, 0x0fcec10f01e02151 }
+    },
+    {
+      { 0x3df2d29dc4244e45, 0x2b020e7493d8de0a,
+        0x6cc8067e820c214d, 0x413779166feab90a },
+      { 0x644d58a649fe1e44, 0x21fcaea231ad777e,
+        0x02441c5a887fd0d2, 0x4901aa7183c511f3 },
+      { 0x08b1b7548c1af8f0, -0x31f08583db9d664c,
+        -0x089f4f06e1f926c7, 0x41bb887b726d1213 }
+    }
+  },
+  {
+    {
+      { 0x7e234c597c6691ae, 0x64889d3d0a85b4c8,
+        -0x251d36f3cab50519, 0x0a871e070c6a9e1d },
+      { 0x40e87d44744346be, 0x1d48dad415b52b25,
+        0x7c3a8a18a13b603e, 0x4eb728c12fcdbdf7 },
+      { 0x3301b5994bbc8989, 0x736bae3a5bdd4260,
+        0x0d61ade219d59e3c, 0x3ee7300f2685d464 }
+    },
+    {
+      { 0x43fa7947841e7518, -0x1a3905a69c63b929,
+        -0x5ef9a1e21cfad48c, 0x7d47c6a2cfb89030 },
+      { -0x0a2daa1b61822949, -0x7fe9eea39ef4e154,
+        0x3c99975d92e187ca, 0x13815762979125c2 },
+      { 0x3fdad0148ef0d6e0, -0x62c18b656eab90c4,
+        0x71ec621026bb8157, 0x148cf58d34c9ec80 }
+    },
+    {
+      { -0x1da8d082651b8a93, 0x56c345bb88f3487f,
+        -0x602ef492969f5773, 0x278febad4eaea1b9 },
+      { 0x46a492f67934f027, 0x469984bef6840aa9,
+        0x5ca1bc2a89611854, 0x3ff2fa1ebd5dbbd4 },
+      { -0x4e5597e0736cc69a, -0x73de6b63dfd6f368,
+        0x39115291219d3c52, 0x4104dd02fe9c677b }
+    },
+    {
+      { -0x7edeb1f924f69548, 0x21a8b6c90ce44f35,
+        0x6524c12a409e2af5, 0x0165b5a48efca481 },
+      { 0x72b2bf5e1124422a, -0x5e05f3cc675cc54b,
+        -0x6b349efe05ad499a, 0x2c863b00afaf53d5 },
+      { -0x0e6f5b8b5f7b958a, 0x12eff984cd2f7cc0,
+        0x695e290658aa2b8f, 0x591b67d9bffec8b8 }
+    },
+    {
+      { -0x66464c8e60e74aa3, -0x1b9a1a055e739be2,
+        0x61081136c29f05ed, 0x489b4f867030128b },
+      { 0x312f0d1c80b49bfa, 0x5979515eabf3ec8a,
+        0x727033c09ef01c88, 0x3de02ec7ca8f7bcb },
+      { -0x2dcdefd2c5146d11, -0x1e9dac4b9ee9579f,
+        0x3d7eabe7190baa24, 0x49f5fbba496cbebf }
+    },
+    {
+      { 0x155d628c1e9c572e, -0x75b279533a77b8bf,
+        -0x6e5cad09aea89c15, 0x06a1a6c28867515b },
+      { 0x30949a108a5bcfd4, -0x23bf228f439b8c15,
+        -0x6d3d6b3ecf83f2e4, 0x5604a86dcbfa6e74 },
+      { 0x7288d1d47c1764b6, 0x72541140e0418b51,
+        -0x60fce59fe753092f, 0x20989e89fe2742c6 }
+    },
+    {
+      { 0x1674278b85eaec2e, 0x5621dc077acb2bdf,
+        0x640a4c1661cbf45a, 0x730b9950f70595d3 },
+      { 0x499777fd3a2dcc7f, 0x32857c2ca54fd892,
+        -0x5d86279b2df81c60, 0x0403ed1d0ca67e29 },
+      { -0x36b4d2ca78b13aae, -0x3a19373067db9073,
+        -0x0834b905e93fca32, 0x5bd7454308303dcc }
+    },
+    {
+      { -0x7a3b6cdeea1886d6, -0x39b3765d42322237,
+        -0x62e1c257525c289e, 0x5bb7db123067f82c },
+      { 0x7f9ad19528b24cc2, 0x7f6b54656335c181,
+        0x66b8b66e4fc07236, 0x133a78007380ad83 },
+      { 0x0961f467c6ca62be, 0x04ec21d6211952ee,
+        0x182360779bd54770, 0x740dca6d58f0e0d2 }
+    }
+  },
+  {
+    {
+      { 0x231a8c570478433c, -0x484ad8f13d7ebc63,
+        -0x245566151c26f861, 0x2c03f5256c2b03d9 },
+      { -0x20b711f8ad3031b2, -0x3c00050cf913f749,
+        0x05710b2ab95459c4, 0x161d25fa963ea38d },
+      { 0x790f18757b53a47d, 0x307b0130cf0c5879,
+        0x31903d77257ef7f9, 0x699468bdbd96bbaf }
+    },
+    {
+      { -0x2722c2199556e6b8, 0x485064c22fc0d2cc,
+        -0x64b7db99cb0215d1, 0x293e1c4e6c4a2e3a },
+      { -0x42e0d0b90b250131, 0x7cef0114a47fd6f7,
+        -0x2ce00225b5b84c81, 0x525219a473905785 },
+      { 0x376e134b925112e1, 0x703778b5dca15da0,
+        -0x4fba7650b9e3ceef, 0x5b605c447f032823 }
+    },
+    {
+      { 0x3be9fec6f0e7f04c, -0x7995a8618a1cb69e,
+        0x5542ef161e1de61a, 0x2f12fef4cc5abdd5 },
+      { -0x469a7fa6df3b8377, -0x180feff36dc47034,
+        0x0001256502e2ef77, 0x24a76dcea8aeb3ee },
+      { 0x0a4522b2dfc0c740, 0x10d06e7f40c9a407,
+        -0x3930ebbe87300998, 0x5e607b2518a43790 }
+    },
+    {
+      { -0x5fd3bce35a6930ec, -0x1c3bd2bf512c1c00,
+        -0x2dbad97fd1f0d925, 0x201f33139e457068 },
+      { 0x58b31d8f6cdf1818, 0x35cfa74fc36258a2,
+        -0x1e4c00b09919e292, 0x5067acab6ccdd5f7 },
+      { -0x02ad8094f7fc62af, 0x18b14964017c0006,
+        -0x2addf14fd1da5b58, 0x397cba8862460375 }
+    },
+    {
+      { 0x7815c3fbc81379e7, -0x599e6bdf221ed50f,
+        -0x00563f077a57022b, 0x771b4022c1e1c252 },
+      { 0x30c13093f05959b2, -0x1dc55e721656868a,
+        0x222fd491721d5e26, 0x2339d320766e6c3a },
+      { -0x27822679aec5d059, -0x0a53648e062b30f8,
+        -0x2f943ce4e15d7c4d, 0x331a189219971a76 }
+    },
+    {
+      { 0x26512f3a9d7572af, 0x5bcbe28868074a9e,
+        -0x7b123e3eee7f083c, 0x1ac9619ff649a67b },
+      { -0x0ae990ba04b07f3a, -0x63c938219e388a31,
+        -0x1c2b17e46fbe26e4, 0x31167c6b83bdfe21 },
+      { -0x0dd4c7bdadb4ef98, 0x5068343bee9ce987,
+        -0x03628e7bb59daf38, 0x612436341f08b111 }
+    },
+    {
+      { -0x749cb61ce5d2d9c8, -0x622048ff642c02cb,
+        0x7f8bf1b8a3a06ba4, 0x1522aa3178d90445 },
+      { -0x2662be2478b17673, 0x09fea5f16c07dc20,
+        0x793d2c67d00f9bbc, 0x46ebe2309e5eff40 },
+      { 0x2c382f5369614938, -0x2501bf6548d292f0,
+        -0x1737cc6e49b90dd9, 0x45fe70f50524306c }
+    },
+    {
+      { 0x62f24920c8951491, 0x05f007c83f630ca2,
+        0x6fbb45d2f5c9d4b8, 0x16619f6db57a2245 },
+      { -0x25b78a5969f3f474, 0x5b68d076ef0e2f20,
+        0x07fb51cf3d0b8fd4, 0x428d1623a0e392d4 },
+      { 0x084f4a4401a308fd, -0x57dde63c895a3554,
+        -0x214721b9bc2e4383, 0x1d81592d60bd38c6 }
+    }
+  },
+  {
+    {
+      { -0x789a4960847a3a18, 0x6ff0678bd168bab2,
+        0x3a70e77c1d330f9b, 0x3a5f6d51b0af8e7c },
+      { 0x61368756a60dac5f, 0x17e02f6aebabdc57,
+        0x7f193f2d4cce0f7d, 0x20234a7789ecdcf0 },
+      { 0x76d20db67178b252, 0x071c34f9d51ed160,
+        -0x09d5b5df4c1bee90, 0x7cd682353cffe366 }
+    },
+    {
+      { -0x599a329f97530b0d, 0x42d92d183cd7e3d3,
+        0x5759389d336025d9, 0x3ef0253b2b2cd8ff },
+      { 0x0be1a45bd887fab6, 0x2a846a32ba403b6e,
+        -0x266defed1691a000, 0x2838c8863bdc0943 },
+      { -0x2e944f30b5b9afd0, -0x05b694beea3a8855,
+        -0x7d3051750b54be63, 0x21dcb8a606a82812 }
+    },
+    {
+      { -0x6572ff054188ce46, -0x7dfc9f819d61e777,
+        -0x4d33fdc8bc0c2681, 0x5d840dbf6c6f678b },
+      { 0x5c6004468c9d9fc8, 0x2540096ed42aa3cb,
+        0x125b4d4c12ee2f9c, 0x0bc3d08194a31dab },
+      { 0x706e380d309fe18b, 0x6eb02da6b9e165c7,
+        0x57bbba997dae20ab, 0x3a4276232ac196dd }
+    },
+    {
+      { 0x3bf8c172db447ecb, 0x5fcfc41fc6282dbd,
+        -0x7f53003f8a55ea02, 0x0770c9e824e1a9f9 },
+      { 0x4b42432c8a7084fa, -0x7675e61c20461abb,
+        -0x4160ffde63a71ba3, 0x1ff177cea16debd1 },
+      { -0x309e2665ba4a4a03, -0x79f67b16e4c586dc,
+        -0x18cff6e6cfc1c177, 0x39f264fd41500b1e }
+    },
+    {
+      { -0x2e64b55401f6841f, -0x5b92031e201fe6d7,
+        -0x3c36f76bd3590e01, 0x65c621272c35f14e },
+      { -0x5852cbe824181d64, -0x426bc895d463ec64,
+        -0x5f16e4716ca68457, 0x1712d73468889840 },
+      { -0x18d4760731ce6c23, 0x4d103356a125c0bb,
+        0x0419a93d2e1cfe83, 0x22f9800ab19ce272 }
+    },
+    {
+      { 0x42029fdd9a6efdac, -0x46ed3141cb5ab6bf,
+        0x640f64b987bdf37b, 0x4171a4d38598cab4 },
+      { 0x605a368a3e9ef8cb, -0x1c163fdd5aafb8eb,
+        0x553d48b05f24248f, 0x13f416cd647626e5 },
+      { -0x05d8a7556636b374, 0x23006f6fb000b807,
+        -0x042d6e225225ac6e, 0x508214fa574bd1ab }
+    },
+    {
+      { 0x461a15bb53d003d6, -0x4defd777430c369b,
+        0x27c576756c683a5a, 0x3a7758a4c86cb447 },
+      { -0x3dfd96eac12901b5, -0x59a598c6aee2883c,
+        -0x3421d9b9d3eb506c, 0x22f960ec6faba74b },
+      { 0x548111f693ae5076, 0x1dae21df1dfd54a6,
+        0x12248c90f3115e65, 0x5d9fd15f8de7f494 }
+    },
+    {
+      { 0x3f244d2aeed7521e, -0x71c56fd7bcd169eb,
+        -0x1e9b4588d163e92c, 0x3bc187fa47eb98d8 },
+      { 0x031408d36d63727f, 0x6a379aefd7c7b533,
+        -0x561e703a33511db5, 0x332f35914f8fbed3 },
+      { 0x6d470115ea86c20c, -0x6675483493b92edb,
+        -0x2887cd4ac599fe78, 0x450d81ce906fba03 }
+    }
+  },
+  {
+    {
+      { -0x2f8b2769e3518bc1, -0x0792e70a11e39c13,
+        -0x68423aa4180b12d7, 0x4cbad279663ab108 },
+      { 0x6e7bb6a1a6205275, -0x55b0de28bec3717d,
+        0x6f56d155e88f5cb2, 0x2de25d4ba6345be1 },
+      { -0x7f2e6fdb5f28e033, -0x3ada3df504d77508,
+        -0x4e5c68b4a0c59be7, 0x7d7fbcefe2007233 }
+    },
+    {
+      { -0x3283a23a0c3d6f6c, -0x387e5d65d56efa55,
+        -0x7f39e2c9bde3cfa8, 0x4f9cd196dcd8d4d7 },
+      { -0x0510e195d994d7ff, -0x7993973b2a8c60ea,
+        -0x0975d043e4fc89d4, 0x5975435e87b75a8d },
+      { 0x199297d86a7b3768, -0x2f2fa7dbe52e859d,
+        -0x45fd6352a3e3f3e9, 0x7ccdd084387a0307 }
+    },
+    {
+      { -0x64f37be7989f336d, -0x3251ff85e54cd567,
+        -0x577213799df425e8, 0x3593ca848190ca44 },
+      { -0x2359bdd392d9fbe9, -0x51eac2af6b7dbf43,
+        -0x563f3e4b04973989, 0x428bd0ed61d0cf53 },
+      { -0x6dece765a17b6559, -0x2b273cca9a270533,
+        -0x73adaba4ac02442f, 0x27398308da2d63e6 }
+    },
+    {
+      { -0x465ef1b3f58fdbad, 0x0fa25866d57d1bde,
+        -0x0046264a32d82509, 0x572c2945492c33fd },
+      { 0x42c38d28435ed413, -0x42af0c9fcd873337,
+        -0x44f854e58625fc11, 0x269597aebe8c3355 },
+      { -0x388038ba2932cf42, -0x1b20172c1c455105,
+        -0x5dd377cf55a225f4, 0x7f985498c05bca80 }
+    },
+    {
+      { -0x2ca9eaadf0409c9d, 0x08045a45cf4dfba6,
+        -0x113db04378c05f3e, 0x30f2653cd69b12e7 },
+      { 0x3849ce889f0be117, -0x7ffa52e484ab5d78,
+        0x3da3c39f23fc921c, 0x76c2ec470a31f304 },
+      { -0x75f736c7553ef37b, 0x46179b60db276bcb,
+        -0x56df3fe1f1905390, 0x2f1273f1596473da }
+    },
+    {
+      { 0x30488bd755a70bc0, 0x06d6b5a4f1d442e7,
+        -0x152e596143a69e9e, 0x38ac1997edc5f784 },
+      { 0x4739fc7c8ae01e11, -0x02ad8b6fb5955461,
+        0x41d98a8287728f2e, 0x5d9e572ad85b69f2 },
+      { 0x0666b517a751b13b, 0x747d06867e9b858c,
+        -0x53533feebab221b7, 0x22dfcd9cbfe9e69c }
+    },
+    {
+      { 0x56ec59b4103be0a1, 0x2ee3baecd259f969,
+        0x797cb29413f5cd32, 0x0fe9877824cde472 },
+      { -0x72242d1f3cf2f327, -0x527199a05344bccd,
+        -0x7094da73cdd569e1, 0x6b2916c05448c1c7 },
+      { 0x7edb34d10aba913b, 0x4ea3cd822e6dac0e,
+        0x66083dff6578f815, 0x4c303f307ff00a17 }
+    },
+    {
+      { 0x29fc03580dd94500, -0x132d855b9044136d,
+        0x130a155fc2e2a7f8, 0x416b151ab706a1d5 },
+      { -0x2cf5c429e84d737b, -0x3a2c8848c688c416,
+        -0x39391873e195a341, 0x0d61b8f78b2ab7c4 },
+      { 0x56a8d7efe9c136b0, -0x42f81a32a71bb4e0,
+        -0x5019d025e4a81f55, 0x191a2af74277e8d2 }
+    }
+  },
+  {
+    {
+      { -0x6019d4bcb0b9f105, -0x212cfc2b59c9f82a,
+        -0x0faddef1485f25dc, 0x237e7dbe00545b93 },
+      { -0x31e908b43ac3ebcf, 0x2b9725ce2072edde,
+        -0x47463c904a4dc119, 0x7e2e0e450b5cc908 },
+      { 0x013575ed6701b430, 0x231094e69f0bfd10,
+        0x75320f1583e47f22, 0x71afa699b11155e3 }
+    },
+    {
+      { -0x15bdc3e3b8c4af2a, 0x51e87a1f3b38ef10,
+        -0x647b40a04d36416b, 0x00731fbc78f89a1c },
+      { 0x65ce6f9b3953b61d, -0x39a7c615505ebe1a,
+        0x0f435ffda9f759fe, 0x021142e9c2b1c28e },
+      { -0x1bcf38e7b707e780, -0x4069f3dda1313ee7,
+        -0x49251f7c9445ea1d, 0x4c4d6f3347e15808 }
+    },
+    {
+      { 0x2f0cddfc988f1970, 0x6b916227b0b9f51b,
+        0x6ec7b6c4779176be, 0x38bf9500a88f9fa8 },
+      { 0x18f7eccfc17d1fc9, 0x6c75f5a651403c14,
+        -0x24218ed40811f321, 0x193fddaaa7e47a22 },
+      { 0x1fd2c93c37e8876f, -0x5d09e1a5e72eb9d4,
+        0x5080f58239241276, 0x6a6fb99ebf0d4969 }
+    },
+    {
+      { -0x114edd4a491bdc3a, -0x6c628fef0d790072,
+        -0x6f56d57ce230a274, 0x136fda9f42c5eb10 },
+      { 0x6a46c1bb560855eb, 0x2416bb38f893f09d,
+        -0x28e2eec8708e533f, 0x75f76914a31896ea },
+      { -0x06b3204e5cfa422f, 0x0f364b9d9ff82c08,
+        0x2a87d8a5c3bb588a, 0x022183510be8dcba }
+    },
+    {
+      { -0x62a58efebccf8581, -0x4f9c21613b825ba1,
+        0x22bbfe52be927ad3, 0x1387c441fd40426c },
+      { 0x4af766385ead2d14, -0x5f71277f3583a7d0,
+        0x0d13a6e610211e3d, 0x6a071ce17b806c03 },
+      { -0x4a2c3c2e78687508, 0x722b5a3d7f0e4413,
+        0x0d7b4848bb477ca0, 0x3171b26aaf1edc92 }
+    },
+    {
+      { -0x59f248274d75b82f, -0x5940eb29e88f5b0f,
+        -0x2b5e076cac2242a8, 0x6c514a63344243e9 },
+      { -0x56d0ce6f68a9b358, -0x008447b3dd8a1ee7,
+        0x4f55fe37a4875150, 0x221fd4873cf0835a },
+      { 0x2322204f3a156341, -0x048c1f1645f5fcd3,
+        -0x031f22b3bef0fcf2, 0x48daa596fb924aaa }
+    },
+    {
+      { 0x14f61d5dc84c9793, -0x66be061c10be7dfa,
+        -0x320a4770cb9d8854, 0x58c837fa0e8a79a9 },
+      { 0x6eca8e665ca59cc7, -0x57b8dab4d1c75360,
+        0x31afc708d21e17ce, 0x676dd6fccad84af7 },
+      { 0x0cf9688596fc9058, 0x1ddcbbf37b56a01b,
+        -0x233d1882b6ca2996, 0x1c4f73f2c6a57f0a }
+    },
+    {
+      { -0x4c918f910383cb7c, 0x73dfc9b4c3c1cf61,
+        -0x14e2863687e3381b, 0x70459adb7daf675c },
+      { 0x0e7a4fbd305fa0bb, -0x7d62b31fab399c53,
+        -0x0bde3c7cd01cc7b8, 0x795ac80d1bf64c42 },
+      { 0x1b91db4991b42bb3, 0x572696234b02dcca,
+        -0x6020611ae0738724, 0x5fe162848ce21fd3 }
+    }
+  },
+  {
+    {
+      { 0x2879852d5d7cb208, -0x4721228f97820d19,
+        -0x23f40054de97876f, 0x2b44c043677daa35 },
+      { 0x4e59214fe194961a, 0x49be7dc70d71cd4f,
+        -0x6cff302dc4af0dd3, 0x4789d446fc917232 },
+      { 0x1a1c87ab074eb78e, -0x05392e7166250b99,
+        0x3eacbbcd484f9067, 0x60c52eef2bb9a4e4 }
+    },
+    {
+      { 0x702bc5c27cae6d11, 0x44c7699b54a48cab,
+        -0x1043bfa945b6d14e, 0x70d77248d9b6676d },
+      { 0x0b5d89bc3bfd8bf1, -0x4f946dc8360caae6,
+        0x0e4c16b0d53028f5, 0x10bc9c312ccfcaab },
+      { -0x557517b4c13d5fa5, -0x6796610b12e87e20,
+        0x794513e4708e85d1, 0x63755bd3a976f413 }
+    },
+    {
+      { 0x3dc7101897f1acb7, 0x5dda7d5ec165bbd8,
+        0x508e5b9c0fa1020f, 0x2763751737c52a56 },
+      { -0x4aa05fc1d52ef7ad, 0x356f75909ee63569,
+        -0x60060e0241964770, 0x0d8cc1c48bc16f84 },
+      { 0x029402d36eb419a9, -0x0f4bb181884b9f5b,
+        -0x30579dcf2bc3b6aa, 0x70c2dd8a7ad166e7 }
+    },
+    {
+      { -0x6e2b6982471281ed, 0x74252f0ad776817a,
+        -0x1bf67d1ff27ada9c, 0x32b8613816a53ce5 },
+      { 0x656194509f6fec0e, -0x11d18156b939ae73,
+        -0x68cc3e0c981f64a4, 0x2e0fac6363948495 },
+      { 0x79e7f7bee448cd64, 0x6ac83a67087886d0,
+        -0x07602b265f1b24d2, 0x4179215c735a4f41 }
+    },
+    {
+      { -0x1b51cc46d79432cc, -0x48108149aa622924,
+        0x278b141fb3d38e1f, 0x31fa85662241c286 },
+      { -0x738f6b18282312d6, -0x6804753cb82c6390,
+        -0x1ec41fcc56f926fe, 0x700344a30cd99d76 },
+      { -0x507d93bdd1c9dd0c, -0x3edfd67867ccafd3,
+        -0x643e481ed4c76edd, 0x24bb2312a9952489 }
+    },
+    {
+      { 0x41f80c2af5f85c6b, 0x687284c304fa6794,
+        -0x76ba20665c45e453, 0x0d1d2af9ffeb5d16 },
+      { -0x4e5712e8cd21983d, 0x3cb49418461b4948,
+        -0x7142bcbc8930432e, 0x0fee3e871e188008 },
+      { -0x5625755ecd9de121, 0x30b822a159226579,
+        0x4004197ba79ac193, 0x16acd79718531d76 }
+    },
+    {
+      { -0x36a6393a87784953, -0x6b1e6152a06f0146,
+        0x16e24e62a342f504, 0x164ed34b18161700 },
+      { 0x72df72af2d9b1d3d, 0x63462a36a432245a,
+        0x3ecea07916b39637, 0x123e0ef6b9302309 },
+      { 0x487ed94c192fe69a, 0x61ae2cea3a911513,
+        -0x7884092c465b21d9, 0x78da0fc61073f3eb }
+    },
+    {
+      { -0x5d607f0e97f3c56c, 0x71f77e151ae9e7e6,
+        0x1100f15848017973, 0x054aa4b316b38ddd },
+      { 0x5bf15d28e52bc66a, 0x2c47e31870f01a8e,
+        0x2419afbc06c28bdd, 0x2d25deeb256b173a },
+      { -0x2037b972e6d98348, 0x0b28789c66e54daf,
+        0x2aeb1d2a666eec17, 0x134610a6ab7da760 }
+    }
+  },
+  {
+    {
+      { -0x32d59a18882e0aeb, 0x548991878faa60f1,
+        -0x4e48c4432543f91b, 0x654878cba97cc9fb },
+      { 0x51138ec78df6b0fe, 0x5397da89e575f51b,
+        0x09207a1d717af1b9, 0x2102fdba2b20d650 },
+      { -0x69611bfafaa3195f, 0x36bca7681251ad29,
+        0x3a1af517aa7da415, 0x0ad725db29ecb2ba }
+    },
+    {
+      { -0x013843f364fa907b, 0x537d5268e7f5ffd7,
+        0x77afc6624312aefa, 0x4f675f5302399fd9 },
+      { -0x23bd984e7cb1dba9, -0x498abb4a8f31e43b,
+        0x1af07a0bf7d15ed7, 0x4aefcffb71a03650 },
+      { -0x3cd2c9c9fbeae8e2, -0x32d410ee7667b7c5,
+        -0x78f591522f6baef0, 0x0bccbb72a2a86561 }
+    },
+    {
+      { 0x186d5e4c50fe1296, -0x1fc6847d01176082,
+        0x3bc7f6c5507031b0, 0x6678fd69108f37c2 },
+      { 0x185e962feab1a9c8, -0x791819ca9aeb8233,
+        -0x4f6d1fce44a4920e, 0x4024f0ab59d6b73e },
+      { 0x1586fa31636863c2, 0x07f68c48572d33f2,
+        0x4f73cc9f789eaefc, 0x2d42e2108ead4701 }
+    },
+    {
+      { 0x21717b0d0f537593, -0x6eb196f4ece1f9b4,
+        0x1bb687ae752ae09f, 0x420bf3a79b423c6e },
+      { -0x680aecea6b202d65, 0x6155985d313f4c6a,
+        -0x145ec0f8f7baaff0, 0x676b2608b8d2d322 },
+      { -0x7ec7459ae3a4d4b9, -0x798e4913cee4e480,
+        0x7bff0cb1bc3135b0, 0x745d2ffa9c0cf1e0 }
+    },
+    {
+      { 0x6036df5721d34e6a, -0x4e2477d866844c30,
+        -0x2c3df63c378a9506, 0x06e15be54c1dc839 },
+      { -0x40ada5e1d4363743, -0x15a4d9f7d9b8627f,
+        -0x2aee38f120feaa25, 0x1ae23ceb960cf5d0 },
+      { 0x5b725d871932994a, 0x32351cb5ceb1dab0,
+        0x7dc41549dab7ca05, 0x58ded861278ec1f7 }
+    },
+    {
+      { 0x2dfb5ba8b6c2c9a8, 0x48eeef8ef52c598c,
+        0x33809107f12d1573, 0x08ba696b531d5bd8 },
+      { -0x27e8c86c0d993aa4, -0x3736893a33bab1b7,
+        0x5ce382f8bc26c3a8, 0x2ff39de85485f6f9 },
+      { 0x77ed3eeec3efc57a, 0x04e05517d4ff4811,
+        -0x15c285c00e598e35, 0x120633b4947cfe54 }
+    },
+    {
+      { -0x7d42ceb8b6edeff6, -0x21dc8492819041fa,
+        -0x1ee189e6ee15863a, 0x07433be3cb393bde },
+      { 0x0b94987891610042, 0x4ee7b13cecebfae8,
+        0x70be739594f0a4c0, 0x35d30a99b4d59185 },
+      { -0x0086bb3fa316680c, 0x575d3de4b05c51a3,
+        0x583381fd5a76847c, 0x2d873ede7af6da9f }
+    },
+    {
+      { -0x559dfd1eb1a2067f, -0x5df2a6e8afea1e0b,
+        0x18a275d3bae21d6c, 0x0543618a01600253 },
+      { 0x157a316443373409, -0x054748110b557e27,
+        -0x4f6c01190a59b7fa, 0x2e773654707fa7b6 },
+      { 0x0deabdf4974c23c1, -0x5590f5da6231b96d,
+        0x04202cb8a29aba2c, 0x4b1443362d07960d }
+    }
+  },
+  {
+    {
+      { -0x6983ab16e3ad6335, 0x30f6269264c635fb,
+        0x2747aff478121965, 0x17038418eaf66f5c },
+      { -0x333b48384991e086, 0x44157e25f50c2f7e,
+        0x3ef06dfc713eaf1c, 0x582f446752da63f7 },
+      { -0x39ce842cdfcdb31c, -0x57efbd175bb7743c,
+        -0x4de10e74b1a5ec9c, 0x0c2a1c4bcda28dc9 }
+    },
+    {
+      { -0x123b7eb7964296bb, 0x0d6d907dbe1c8d22,
+        -0x39c42ded2aa33a55, 0x5a6a9b30a314dc83 },
+      { -0x2db2382f90e0fbb9, -0x4dd961c124783fa7,
+        -0x2ea4fd8d044d2d71, 0x7c558bd1c6f64877 },
+      { -0x2f13eadb2c69b9c3, 0x12bb628ac35a24f0,
+        -0x5af3c586e343a05c, 0x0404a5ca0afbafc3 }
+    },
+    {
+      { 0x62bc9e1b2a416fd1, -0x4a3908d71cafa675,
+        0x04343fd83d5d6967, 0x39527516e7f8ee98 },
+      { -0x73e0bff8f558bc2a, -0x33452f34a4d9a118,
+        0x574b046b668fd2de, 0x46395bfdcadd9633 },
+      { 0x117fdb2d1a5d9a9c, -0x6388ba432effa3d6,
+        -0x102b410eab2a9016, 0x76579a29e822d016 }
+    },
+    {
+      { 0x333cb51352b434f2, -0x27cdd7b66c217f1f,
+        -0x4aaed7788af2ca32, 0x02c514bb2a2777c1 },
+      { 0x45b68e7e49c02a17, 0x23cd51a2bca9a37f,
+        0x3ed65f11ec224c1b, 0x43a384dc9e05bdb1 },
+      { 0x684bd5da8bf1b645, -0x04742c81094ab4ad,
+        0x313916d7a9b0d253, 0x1160920961548059 }
+    },
+    {
+      { 0x7a385616369b4dcd, 0x75c02ca7655c3563,
+        0x7dc21bf9d4f18021, 0x2f637d7491e6e042 },
+      { -0x4bb2e996d6253056, -0x25ad60b37beca671,
+        -0x16109c35bac2aaa7, 0x351e125bc5698e0b },
+      { -0x2b4b64b9e5098442, -0x29fcfc853754769f,
+        0x71dee19ff9a699fb, 0x7f182d06e7ce2a9a }
+    },
+    {
+      { 0x09454b728e217522, -0x55a7170b2b7b4728,
+        -0x2ca7dab280b96fc4, 0x44acc043241c5217 },
+      { 0x7a7c8e64ab0168ec, -0x34a5b5aaea123abd,
+        0x095519d347cd0eda, 0x67d4ac8c343e93b0 },
+      { 0x1c7d6bbb4f7a5777, -0x74ca012b6e7cec1f,
+        0x4adca1c6c96b4684, 0x556d1c8312ad71bd }
+    },
+    {
+      { -0x7e0f98a94ee417df, 0x0faff82310a3f3dd,
+        -0x074d2faa9566b9a3, 0x097abe38cc8c7f05 },
+      { 0x17ef40e30c8d3982, 0x31f7073e15a3fa34,
+        0x4f21f3cb0773646e, 0x746c6c6d1d824eff },
+      { 0x0c49c9877ea52da4, 0x4c4369559bdc1d43,
+        0x022c3809f7ccebd2, 0x577e14a34bee84bd }
+    },
+    {
+      { -0x6b01314142b228d5, -0x0b95b025f9f0ddef,
+        0x124a5977c0c8d1ff, 0x705304b8fb009295 },
+      { -0x0f1d97539e58c4f6, -0x0d0505efc86e5a0b,
+        -0x3e1ec17d9492ff17, 0x60fa7ee96fd78f42 },
+      { -0x49c2e2cab2d6913a, -0x0c3cfac1a052ce28,
+        0x670b958cb4bd42ec, 0x21398e0ca16353fd }
+    }
+  },
+  {
+    {
+      { 0x2798aaf9b4b75601, 0x5eac72135c8dad72,
+        -0x2d31559e9e485fdd, 0x1bbfb284e98f7d4e },
+      { -0x760afa75c7d4cc0d, 0x5ae2ba0bad48c0b4,
+        -0x706c4afc5ac24c92, 0x5aa3ed9d95a232e6 },
+      { 0x656777e9c7d96561, -0x34d4edab8d387fca,
+        0x65053299d9506eee, 0x4a07e14e5e8957cc }
+    },
+    {
+      { 0x240b58cdc477a49b, -0x02c725219bb80fe9,
+        0x19928d32a7c86aad, 0x50af7aed84afa081 },
+      { 0x4ee412cb980df999, -0x5cea2890c391388f,
+        -0x445a12216da38803, 0x3f0bac391d313402 },
+      { 0x6e4fde0115f65be5, 0x29982621216109b2,
+        0x780205810badd6d9, 0x1921a316baebd006 }
+    },
+    {
+      { -0x28a55265260c3e75, 0x566a0eef60b1c19c,
+        0x3e9a0bac255c0ed9, 0x7b049deca062c7f5 },
+      { -0x76bdd08120478f04, 0x2c296beb4f76b3bd,
+        0x0738f1d436c24df7, 0x6458df41e273aeb0 },
+      { -0x23341c85cabbbb7d, 0x758879330fedbe93,
+        0x786004c312c5dd87, 0x6093dccbc2950e64 }
+    },
+    {
+      { 0x6bdeeebe6084034b, 0x3199c2b6780fb854,
+        -0x68cc895449d2f96b, 0x6e3180c98b647d90 },
+      { 0x1ff39a8585e0706d, 0x36d0a5d8b3e73933,
+        0x43b9f2e1718f453b, 0x57d1ea084827a97c },
+      { -0x118549185ed74f8f, -0x5b3ea6926c577456,
+        -0x084b217d4dde9ed0, 0x363e999ddd97bd18 }
+    },
+    {
+      { 0x2f1848dce24baec6, 0x769b7255babcaf60,
+        -0x6f34c391c31016cf, 0x231f979bc6f9b355 },
+      { -0x6957bc3eca11e03c, -0x68914caaf71b3731,
+        -0x4bd097fe4a732cd0, 0x48ee9b78693a052b },
+      { 0x5c31de4bcc2af3c6, -0x4fb44fcf01df72e1,
+        -0x48728ff63eb04b9a, 0x079bfa9b08792413 }
+    },
+    {
+      { -0x0c36127f5d2abdbb, 0x0aa08b7877f63952,
+        -0x2892539c2ef7ab8b, 0x1ef4fb159470636b },
+      { -0x1c6fc5ae25cff20c, -0x7bc69bdcc256a550,
+        -0x12c30ed2f4ca9b80, 0x038c77f684817194 },
+      { -0x7ab1a119a4e98414, 0x59590a4296d0cdc2,
+        0x72b2df3498102199, 0x575ee92a4a0bff56 }
+    },
+    {
+      { 0x5d46bc450aa4d801, -0x3c50edd85acc4628,
+        0x389e3b262b8906c2, 0x200a1e7e382f581b },
+      { -0x2b3f7f6f75e7d031, 0x30e170c299489dbd,
+        0x05babd5752f733de, 0x43d4e7112cd3fd00 },
+      { 0x518db967eaf93ac5, 0x71bc989b056652c0,
+        -0x01d47a26a98e680b, 0x050eca52651e4e38 }
+    },
+    {
+      { -0x6853c6899f199716, -0x64e64401eac54b69,
+        0x4cb179b534eca79f, 0x6151c09fa131ae57 },
+      { -0x3cbce521bac0f364, -0x160afba1008fc465,
+        -0x03268536127b84c3, 0x4b0ee6c21c58f4c6 },
+      { 0x3af55c0dfdf05d96, -0x22d9d11fd54b1186,
+        0x11b2bb8712171709, 0x1fef24fa800f030b }
+    }
+  },
+  {
+    {
+      { 0x22d2aff530976b86, -0x726f47f93d2db9fc,
+        -0x235e7693b21a451b, 0x28005fe6c8340c17 },
+      { 0x37d653fb1aa73196, 0x0f9495303fd76418,
+        -0x52dff4f604c5e84e, 0x544d49292fc8613e },
+      { 0x6aefba9f34528688, 0x5c1bff9425107da1,
+        -0x08a444329926b4ca, 0x72e472930f316dfa }
+    },
+    {
+      { 0x07f3f635d32a7627, 0x7aaa4d865f6566f0,
+        0x3c85e79728d04450, 0x1fee7f000fe06438 },
+      { 0x2695208c9781084f, -0x4eafd5f4dcbaf11f,
+        -0x02625159fc1021fe, 0x5a9d2e8c2733a34c },
+      { 0x765305da03dbf7e5, -0x5b250db6ebcb3243,
+        0x7b4ad5cdd24a88ec, 0x00f94051ee040543 }
+    },
+    {
+      { -0x28106c44f85068ad, 0x583ed0cf3db766a7,
+        -0x3196674091f4e13b, 0x47b7ffd25dd40452 },
+      { -0x72ca94dc3c2ccf4e, -0x0de374644fb8e4fa,
+        -0x4c93ce9391bd47c4, 0x07d79c7e8beab10d },
+      { -0x7804046343f722ee, -0x75f994c51e113d65,
+        0x0d57242bdb1fc1bf, 0x1c3520a35ea64bb6 }
+    },
+    {
+      { -0x325790bfde943fa7, 0x1fbb231d12bcd87e,
+        -0x4b6a9561e838f670, 0x38750c3b66d12e55 },
+      { -0x7f2dac5943345cb6, 0x3e61c3a13838219b,
+        -0x6f3c49fe677d1c6a, 0x1c3d05775d0ee66f },
+      { 0x692ef1409422e51a, -0x343f38c3d4a2098f,
+        0x21014fe7744ce029, 0x0621e2c7d330487c }
+    },
+    {
+      { -0x4851e8694f240f0d, 0x54dfafb9e17ce196,
+        0x25923071e9aaa3b4, 0x5d8e589ca1002e9d },
+      { -0x50679f337da67c73, -0x6f15b73e39606524,
+        0x6526483765581e30, 0x0007d6097bd3a5bc },
+      { -0x3f40e26af7bd56b5, -0x4d2c3c9ca770d1c2,
+        0x0a961438bb51e2ef, 0x1583d7783c1cbf86 }
+    },
+    {
+      { -0x6ffcb8fb3362d739, 0x1d1b679ef72cc58f,
+        0x16e12b5fbe5b8726, 0x4958064e83c5580a },
+      { -0x13115d10a25d851f, 0x597c3a1455670174,
+        -0x3659d5ed99f6e986, 0x252a5f2e81ed8f70 },
+      { 0x0d2894265066e80d, -0x033c087acf837395,
+        0x1b53da780c1112fd, 0x079c170bd843b388 }
+    },
+    {
+      { -0x322932af3f2a2faa, -0x6508979244fca8c5,
+        0x3ca6723ff3c3ef48, 0x6768c0d7317b8acc },
+      { 0x0506ece464fa6fff, -0x411cbce19dfa1add,
+        0x3579422451b8ea42, 0x6dec05e34ac9fb00 },
+      { -0x6b49da1a0eaa3e4d, 0x417bf3a7997b7b91,
+        -0x3dd342239294da00, 0x51445e14ddcd52f4 }
+    },
+    {
+      { -0x76ceb854d4415bab, -0x73ac5db06df86ed7,
+        0x4b49f948be30f7a7, 0x12e990086e4fd43d },
+      { 0x57502b4b3b144951, -0x71980094bbb4434d,
+        -0x474296d8e99c7a25, 0x13186f31e39295c8 },
+      { -0x0ef3694c802044d2, -0x60656ca1ede31507,
+        -0x20eec93bc5a467c1, 0x77b2e3f05d3e99af }
+    }
+  },
+  {
+    {
+      { -0x2a679c63ed224f5c, -0x5a2e60cf3fdb7995,
+        -0x2e83d0fca7031ba0, 0x07a195152e095e8a },
+      { 0x296fa9c59c2ec4de, -0x43749e40b07b0c35,
+        0x1c7706d917a8f908, 0x63b795fc7ad3255d },
+      { -0x57c970fdc761a038, -0x6fbcc4fd30721bc5,
+        -0x505e02a23abed9bd, 0x3e8fe83d032f0137 }
+    },
+    {
+      { 0x08704c8de8efd13c, -0x203ae571cc1fc8cf,
+        -0x5a62a25aed9f321d, 0x22d60899a6258c86 },
+      { 0x2f8b15b90570a294, -0x6b0dbd8f98f7bab7,
+        -0x21e3a51e9e44027c, 0x75ba3b797fac4007 },
+      { 0x6239dbc070cdd196, 0x60fe8a8b6c7d8a9a,
+        -0x4c77b84314bfeda0, 0x0904d07b87779e5e }
+    },
+    {
+      { -0x0bcdd299b706bf47, 0x06952f0cbd2d0c39,
+        0x167697ada081f931, 0x6240aacebaf72a6c },
+      { -0x4b31e02b22456e64, -0x30ce24c138b37256,
+        0x2c63cc63ad86cc51, 0x43e2143fbc1dde07 },
+      { -0x07cb8b63a45d6a60, -0x296b83a435c82da6,
+        0x66f13ba7e7c9316a, 0x56bdaf238db40cac }
+    },
+    {
+      { 0x1310d36cc19d3bb2, 0x062a6bb7622386b9,
+        0x7c9b8591d7a14f5c, 0x03aa31507e1e5754 },
+      { 0x362ab9e3f53533eb, 0x338568d56eb93d40,
+        -0x61f1ebade2a5aa8e, 0x1d24a86d83741318 },
+      { -0x0b1389b7002b31e1, -0x1fba150fab5373e4,
+        -0x772dda7de2f6ca84, 0x43b261dc9aeb4859 }
+    },
+    {
+      { 0x19513d8b6c951364, -0x6b018ed9fff40b85,
+        0x028d10ddd54f9567, 0x02b4d5e242940964 },
+      { -0x1aa4e1e677448645, -0x5f612f823e85ca63,
+        -0x4fd3d11d9fc215cd, 0x326055cf5b276bc2 },
+      { -0x4b5eaa34d72e720e, -0x1533b9b9e7931af8,
+        -0x3b630b6c937dbc77, 0x27a6c809ae5d3410 }
+    },
+    {
+      { -0x32d3d8f53bc296ac, -0x22b5c1a89599354e,
+        0x79fa592469d7036c, 0x221503603d8c2599 },
+      { -0x74591432e0f24e78, 0x37d3d73a675a5be8,
+        -0x0dd1205cea0aa7a6, 0x2cb67174ff60a17e },
+      { 0x59eecdf9390be1d0, -0x56bddfbb8d731c0f,
+        -0x7d76e399856b0f0c, 0x7b1df4b73890f436 }
+    },
+    {
+      { 0x5f2e221807f8f58c, -0x1caaa3602b6bf62c,
+        -0x4d555772e04959d0, 0x68698245d352e03d },
+      { -0x1b6d0d1f4c4d5ddc, 0x7c6c9e062b551160,
+        0x15eb8fe20d7f7b0e, 0x61fcef2658fc5992 },
+      { -0x244ea27ad5e7e786, -0x0c1b552c79225329,
+        0x44bae2810ff6c482, 0x46cf4c473daf01cf }
+    },
+    {
+      { 0x213c6ea7f1498140, 0x7c1e7ef8392b4854,
+        0x2488c38c5629ceba, 0x1065aae50d8cc5bb },
+      { 0x426525ed9ec4e5f9, 0x0e5eda0116903303,
+        0x72b1a7f2cbe5cadc, 0x29387bcd14eb5f40 },
+      { 0x1c2c4525df200d57, 0x5c3b2dd6bfca674a,
+        0x0a07e7b1e1834030, 0x69a198e64f1ce716 }
+    }
+  },
+  {
+    {
+      { -0x1efebbcb233a3513, 0x47ed5d963c84fb33,
+        0x70019576ed86a0e7, 0x25b2697bd267f9e4 },
+      { -0x6f9d4d1f26e58744, 0x47c9889cc8509667,
+        -0x620ab599bfaf8f48, 0x7369e6a92493a1bf },
+      { -0x6298c004ec67979c, 0x3ca5fbd9415dc7b8,
+        -0x1fb133c420d8c4a2, 0x1420683db54e4cd2 }
+    },
+    {
+      { 0x34eebb6fc1cc5ad0, 0x6a1b0ce99646ac8b,
+        -0x2c4f25b6599421ad, 0x31e83b4161d081c1 },
+      { -0x4b8742e1db622e69, 0x620c35005e58c102,
+        -0x04fd2cd0334553a4, 0x60b63bebf508a72d },
+      { -0x681738ed61f9d4b1, 0x49e48f4f29320ad8,
+        0x5bece14b6f18683f, 0x55cf1eb62d550317 }
+    },
+    {
+      { 0x3076b5e37df58c52, -0x28c54622186633ca,
+        -0x427ce31cb6ec11e0, 0x1a56fbaa62ba0133 },
+      { 0x5879101065c23d58, -0x7462f792af6b7e64,
+        -0x1dbfd056ed3aa059, 0x669a6564570891d4 },
+      { -0x6bc194afa3623614, 0x302557bba77c371a,
+        -0x678c51a9becb89af, 0x13c4836799c58a5c }
+    },
+    {
+      { -0x3b230495a2742f80, -0x21143b13a8e5b7be,
+        -0x2b4d177c471aac9b, 0x50bdc87dc8e5b827 },
+      { 0x423a5d465ab3e1b9, -0x03ec3e78380ec09f,
+        0x19f83664ecb5b9b6, 0x66f80c93a637b607 },
+      { 0x606d37836edfe111, 0x32353e15f011abd9,
+        0x64b03ac325b73b96, 0x1dd56444725fd5ae }
+    },
+    {
+      { -0x3d6819fff7453766, 0x7d4cea11eae1c3e0,
+        -0x0c1c741e60186884, 0x3a3a450f63a305cd },
+      { -0x705b8007cc9ded83, -0x4360953b8e3283eb,
+        0x6e71454349220c8b, 0x0e645912219f732e },
+      { 0x078f2f31d8394627, 0x389d3183de94a510,
+        -0x2e1c9392e8669080, 0x318c8d9393a9a87b }
+    },
+    {
+      { 0x5d669e29ab1dd398, -0x036de9a7cbd261c5,
+        0x55851dfdf35973cd, 0x509a41c325950af6 },
+      { -0x0d8ba2fcd50001e7, 0x0c9f3c497f24db66,
+        -0x43672c1c457a6711, 0x224c7c679a1d5314 },
+      { -0x423f91235906da17, 0x793ef3f4641b1f33,
+        -0x7d13ed7f627cc177, 0x05bff02328a11389 }
+    },
+    {
+      { 0x6881a0dd0dc512e4, 0x4fe70dc844a5fafe,
+        0x1f748e6b8f4a5240, 0x576277cdee01a3ea },
+      { 0x3632137023cae00b, 0x544acf0ad1accf59,
+        -0x698befb62de5e378, 0x780b8cc3fa2a44a7 },
+      { 0x1ef38abc234f305f, -0x65a88042ebfa21f8,
+        0x5e82a51434e62a0d, 0x5ff418726271b7a1 }
+    },
+    {
+      { -0x1a24b817ec496ac0, -0x0ca2d5c4bcd9ef1f,
+        -0x53e0d916c787ed8a, 0x29d4db8ca0a0cb69 },
+      { 0x398e080c1789db9d, -0x589fdfda0c18870b,
+        -0x056776b3f942fca3, 0x106a03dc25a966be },
+      { -0x2652f550ccccac30, 0x38669da5acd309e5,
+        0x3c57658ac888f7f0, 0x4ab38a51052cbefa }
+    }
+  },
+  {
+    {
+      { -0x29302e10a0223f64, -0x17d4c10208a8a232,
+        0x25d56b5d201634c2, 0x3041c6bb04ed2b9b },
+      { -0x2583d4da98972a6d, -0x673e3fa8bbdd35ed,
+        -0x0e57f42a35f531e3, 0x29cdd1adc088a690 },
+      { 0x0ff2f2f9d956e148, -0x5218688a60ca94d2,
+        0x1a4698bb5f6c025c, 0x104bbd6814049a7b }
+    },
+    {
+      { -0x56a265a029800e9d, -0x16d41962b338a97f,
+        -0x4807fdb321df0da9, 0x204f2a20fb072df5 },
+      { 0x51f0fd3168f1ed67, 0x2c811dcdd86f3bc2,
+        0x44dc5c4304d2f2de, 0x5be8cc57092a7149 },
+      { -0x37ebc4c2cf144f87, 0x7589155abd652e30,
+        0x653c3c318f6d5c31, 0x2570fb17c279161f }
+    },
+    {
+      { 0x192ea9550bb8245a, -0x37190457706faf2f,
+        0x7986ea2d88a4c935, 0x241c5f91de018668 },
+      { 0x3efa367f2cb61575, -0x0a069089e329fd94,
+        -0x1738ebd59a4ada9e, 0x3dcb65ea53030acd },
+      { 0x28d8172940de6caa, -0x7040d30fdd268cc6,
+        0x16d7fcdd235b01d1, 0x08420edd5fcdf0e5 }
+    },
+    {
+      { 0x0358c34e04f410ce, -0x49eca4a5d891f97b,
+        0x5d9670c7ebb91521, 0x04d654f321db889c },
+      { -0x3200df547c9d05b6, 0x57e118d4e21a3e6e,
+        -0x1ce869e803c619d5, 0x0d9a53efbc1769fd },
+      { 0x5e7dc116ddbdb5d5, 0x2954deb68da5dd2d,
+        0x1cb608173334a292, 0x4a7a4f2618991ad7 }
+    },
+    {
+      { 0x24c3b291af372a4b, -0x6c257d8f8e7eb80e,
+        -0x227b7a9b7976610e, 0x4a96314223e0ee33 },
+      { -0x0b58e7fda04ea06b, 0x3df65f346b5c1b8f,
+        -0x32030f7aff1feeee, 0x11b50c4cddd31848 },
+      { -0x5917d8bbf75b002a, 0x738e177e9c1576d9,
+        0x773348b63d02b3f2, 0x4f4bce4dce6bcc51 }
+    },
+    {
+      { 0x30e2616ec49d0b6f, -0x1ba98e703513dce9,
+        0x48eb409bf26b4fa6, 0x3042cee561595f37 },
+      { -0x58e031a51ddbda7c, 0x26ea725692f58a9e,
+        -0x2de5f628e315c30c, 0x73fcdd14b71c01e6 },
+      { 0x427e7079449bac41, -0x7aa51c92431dcef6,
+        0x4cae76215f841a7c, 0x389e740c9a9ce1d6 }
+    },
+    {
+      { -0x36428709a8f153d8, -0x1aa4f4cdd86e631f,
+        0x65fc3eaba19b91ed, 0x25c425e5d6263690 },
+      { 0x64fcb3ae34dcb9ce, -0x68affcdc1cb72f53,
+        0x45b3f07d62c6381b, 0x61545379465a6788 },
+      { 0x3f3e06a6f1d7de6e, 0x3ef976278e062308,
+        -0x73eb09d9b1759389, 0x6539a08915484759 }
+    },
+    {
+      { -0x223b242beb44b5e7, 0x19b2bc3c98424f8e,
+        0x48a89fd736ca7169, 0x0f65320ef019bd90 },
+      { -0x162de08b3c2d088d, -0x3eafabbeda3b97bb,
+        0x624e5ce8f9b99e33, 0x11c5e4aac5cd186c },
+      { -0x2b792e4e35021f3a, 0x4f3fe6e3163b5181,
+        0x59a8af0dfaf2939a, 0x4cabc7bdec33072a }
+    }
+  },
+  {
+    {
+      { -0x3f708770c0872d77, -0x01cf58d35ebfb261,
+        -0x0d887403309a3363, 0x7ee498165acb2021 },
+      { 0x239e9624089c0a2e, -0x38b73b3fc501b8c8,
+        0x17dbed2a764fa12a, 0x639b93f0321c8582 },
+      { 0x7bd508e39111a1c3, 0x2b2b90d480907489,
+        -0x182d513d518d02e7, 0x0edf493c85b602a6 }
+    },
+    {
+      { 0x6767c4d284764113, -0x5f6fbfc0080a07cb,
+        0x1c8fcffacae6bede, 0x04c00c54d1dfa369 },
+      { -0x51337ea7a664a598, -0x15a8b0f014521df2,
+        0x4fe41d7422b67f07, 0x403b92e3019d4fb4 },
+      { 0x4dc22f818b465cf8, 0x71a0f35a1480eff8,
+        -0x51174052fb3829a9, 0x355bb12ab26176f4 }
+    },
+    {
+      { -0x5cfe2538a5738ce8, -0x126ffc624c3155ef,
+        0x6f077cbf3bae3f2d, 0x7518eaf8e052ad8e },
+      { -0x58e19b338b6c440c, -0x1a427b26135c4f3d,
+        0x0a6bc50cfa05e785, 0x0f9b8132182ec312 },
+      { -0x5b77a63be48093ce, 0x0f2d60bcf4383298,
+        0x1815a929c9b1d1d9, 0x47c3871bbb1755c4 }
+    },
+    {
+      { -0x0419a2af37af9950, 0x62ecc4b0b3a299b0,
+        -0x1ac8ab15bbe51720, 0x08fea02ce8d48d5f },
+      { 0x5144539771ec4f48, -0x07fa4e823673a292,
+        -0x089d3ee5b83c3995, 0x00b89b85764699dc },
+      { -0x7db2228997211530, -0x379bbadfb497a2dd,
+        -0x4aeb3032a276299b, 0x473829a74f75d537 }
+    },
+    {
+      { 0x23d9533aad3902c9, 0x64c2ddceef03588f,
+        0x15257390cfe12fb4, 0x6c668b4d44e4d390 },
+      { -0x7d2d258ab9863be8, -0x19c428274d9e7210,
+        0x355eef24ac47eb0a, 0x2078684c4833c6b4 },
+      { 0x3b48cf217a78820c, -0x0895f54d7ed8c169,
+        -0x56939a5873711285, 0x7411a6054f8a433f }
+    },
+    {
+      { 0x579ae53d18b175b4, 0x68713159f392a102,
+        -0x7baa1345e110ca0b, 0x1ec9a872458c398f },
+      { 0x4d659d32b99dc86d, 0x044cdc75603af115,
+        -0x4cb38ed3233d1b78, 0x7c136574fb8134ff },
+      { -0x47195b2bff5daf65, -0x647e28fdf4377d4c,
+        0x57e7cc9bf1957561, 0x3add88a5c7cd6460 }
+    },
+    {
+      { -0x7a3d672ba6c6cfba, -0x7081ca67a009a614,
+        0x1d2ca22af2f66e3a, 0x61ba1131a406a720 },
+      { -0x5476a88f49ca230e, 0x02dfef6cf66c1fbc,
+        -0x7aacfd9741492e79, 0x249929fccc879e74 },
+      { -0x5c2f5f0ee96a6fd7, 0x023b6b6cba7ebd89,
+        0x7bf15a3e26783307, 0x5620310cbbd8ece7 }
+    },
+    {
+      { 0x6646b5f477e285d6, 0x40e8ff676c8f6193,
+        -0x59138cee544a6b23, 0x7ec846f3658cec4d },
+      { 0x528993434934d643, -0x462407f95aeddd0b,
+        -0x709278703c0be3de, 0x37676a2a4d9d9730 },
+      { -0x64a170c0e25dd139, 0x130f1d776c01cd13,
+        0x214c8fcfa2989fb8, 0x6daaf723399b9dd5 }
+    }
+  },
+  {
+    {
+      { 0x583b04bfacad8ea2, 0x29b743e8148be884,
+        0x2b1e583b0810c5db, 0x2b5449e58eb3bbaa },
+      { 0x5f3a7562eb3dbe47, -0x0815c7ab71425f48,
+        0x00c3e53145747299, 0x1304e9e71627d551 },
+      { 0x789814d26adc9cfe, 0x3c1bab3f8b48dd0b,
+        -0x25f01e00068639f6, 0x4468de2d7c2dd693 }
+    },
+    {
+      { 0x4b9ad8c6f86307ce, 0x21113531435d0c28,
+        -0x2b57993a9a8588d4, 0x5da6427e63247352 },
+      { 0x51bb355e9419469e, 0x33e6dc4c23ddc754,
+        -0x6c5a4929bb80669e, 0x6cce7c6ffb44bd63 },
+      { 0x1a94c688deac22ca, -0x46f991084451e008,
+        -0x775273c772a6a7f1, 0x58f29abfe79f2ca8 }
+    },
+    {
+      { 0x4b5a64bf710ecdf6, -0x4eb31ac7b9d3d6c4,
+        0x3643d056d50b3ab9, 0x6af93724185b4870 },
+      { -0x16f130547218c198, 0x54036f9f377e76a5,
+        -0x0fb6a4f441fea67e, 0x577629c4a7f41e36 },
+      { 0x3220024509c6a888, -0x2d1fc9ecb4aa768d,
+        -0x7c1dc9dcc3ccd761, 0x701f25bb0caec18f }
+    },
+    {
+      { -0x62e7092683413eed, -0x7bb5f9198b40241c,
+        0x20f5b522ac4e60d6, 0x720a5bc050955e51 },
+      { -0x3c574f071b9e9313, -0x08ff99f161da5783,
+        0x61e3061ff4bca59c, 0x2e0c92bfbdc40be9 },
+      { 0x0c3f09439b805a35, -0x17b174c89dbd5404,
+        0x691417f35c229346, 0x0e9b9cbb144ef0ec }
+    },
+    {
+      { -0x7211642aa24e4112, -0x363c54c8f58dc047,
+        0x44a8f1bf1c68d791, 0x366d44191cfd3cde },
+      { -0x04452b7004a8df53, -0x117e6e942406f2f2,
+        -0x2b7ecead9caabc41, 0x221104eb3f337bd8 },
+      { -0x61c3e8bc0d4373ec, 0x2eda26fcb5856c3b,
+        -0x3347d0f197580469, 0x4167a4e6bc593244 }
+    },
+    {
+      { -0x3d41d99a07317012, -0x169800eb177f29d4,
+        -0x0ed19181d0c9b112, 0x34b33370cb7ed2f6 },
+      { 0x643b9d2876f62700, 0x5d1d9d400e7668eb,
+        0x1b4b430321fc0684, 0x7938bb7e2255246a },
+      { -0x323a6e11797e2934, -0x31fdef63127a58ad,
+        -0x128b7a3ea77f777d, 0x1176fc6e2dfe65e4 }
+    },
+    {
+      { -0x246f1d76b688f148, -0x670433d5530bbf5d,
+        0x21354ffeded7879b, 0x1f6a3e54f26906b6 },
+      { -0x4b50932fa4639e65, 0x2ddfc9f4b2a58480,
+        0x3d4fa502ebe94dc4, 0x08fc3a4c677d5f34 },
+      { 0x60a4c199d30734ea, 0x40c085b631165cd6,
+        -0x1dccc1dc08a67d6b, 0x4f2fad0116b900d1 }
+    },
+    {
+      { -0x69d326e248c449c8, -0x19fa885503ed63f8,
+        0x6f619b39f3b61689, 0x3451995f2944ee81 },
+      { 0x44beb24194ae4e54, 0x5f541c511857ef6c,
+        -0x59e194d2c972fb68, 0x445484a4972ef7ab },
+      { -0x6ead032f60158284, 0x4a816c94b0935cf6,
+        0x258e9aaa47285c40, 0x10b89ca6042893b7 }
+    }
+  },
+  {
+    {
+      { 0x753941be5a45f06e, -0x2f8351129263a09b,
+        0x11776b9c72ff51b6, 0x17d2d1d9ef0d4da9 },
+      { 0x3d5947499718289c, 0x12ebf8c524533f26,
+        0x0262bfcb14c3ef15, 0x20b878d577b7518e },
+      { 0x27f2af18073f3e6a, -0x02c01ae628adef97,
+        0x22e3b72c3ca60022, 0x72214f63cc65c6a7 }
+    },
+    {
+      { 0x1d9db7b9f43b29c9, -0x29fa7db5b0ae708b,
+        -0x0d3f8d42ced0623c, 0x1f24ac855a1545b0 },
+      { -0x4b1c80bfacf8596d, -0x5458eb28d0cc986b,
+        -0x29042f588c89ef67, 0x5fdf48c58171cbc9 },
+      { 0x24d608328e9505aa, 0x4748c1d10c1420ee,
+        -0x38001ba3f904da5e, 0x00ba739e2ae395e6 }
+    },
+    {
+      { -0x51bbd90a157744da, 0x360679d984973bfb,
+        0x5c9f030c26694e50, 0x72297de7d518d226 },
+      { 0x592e98de5c8790d6, -0x1a40482cba3d5d21,
+        0x115a3b60f9b49922, 0x03283a3e67ad78f3 },
+      { 0x48241dc7be0cb939, 0x32f19b4d8b633080,
+        -0x2c2036f2fdd76cf8, 0x05e1296846271945 }
+    },
+    {
+      { -0x52404437dbd3bab0, -0x4337f3132fcf7e27,
+        -0x7bca99590a37206e, 0x78cf25d38258ce4c },
+      { -0x457d114cd263b6a6, -0x311037030ed44684,
+        -0x4fd254516c4a2e20, 0x39c00c9c13698d9b },
+      { 0x15ae6b8e31489d68, -0x557ae35463d40f79,
+        -0x3658a5680fb105fb, 0x006b52076b3ff832 }
+    },
+    {
+      { -0x0a3481e94631f7d3, 0x3407f14c417abc29,
+        -0x2b4c9431d40b5855, 0x7de2e9561a9f75ce },
+      { 0x29e0cfe19d95781c, -0x497e20e7699cef1e,
+        0x57df39d370516b39, 0x4d57e3443bc76122 },
+      { -0x218f2b0b495aa135, 0x4801527f5d85db99,
+        -0x24363bbf2c11657f, 0x6b2a90af1a6029ed }
+    },
+    {
+      { 0x77ebf3245bb2d80a, -0x27cfe4b8d046f865,
+        -0x39b8190db3118ccd, 0x465812c8276c2109 },
+      { 0x6923f4fc9ae61e97, 0x5735281de03f5fd1,
+        -0x589b51bc19122ed3, 0x5fd8f4e9d12d3e4a },
+      { 0x4d43beb22a1062d9, 0x7065fb753831dc16,
+        0x180d4a7bde2968d7, 0x05b32c2b1cb16790 }
+    },
+    {
+      { -0x08035bd3852a7e6b, 0x3214286e4333f3cc,
+        -0x493d62f2cbf46863, 0x31771a48567307e1 },
+      { -0x373fa1332db25703, -0x5e30e553fa20107d,
+        -0x2441100d8206329f, 0x3b5556a37b471e99 },
+      { 0x32b0c524e14dd482, -0x124caeabe5d45b4a,
+        -0x5c2e9fb7d7d4a50d, 0x4fc079d27a7336eb }
+    },
+    {
+      { -0x23cb74bbf3793af3, 0x1337cbc9cc94e651,
+        0x6422f74d643e3cb9, 0x241170c2bae3cd08 },
+      { 0x51c938b089bf2f7f, 0x2497bd6502dfe9a7,
+        -0x00003f63877f1bad, 0x124567cecaf98e92 },
+      { 0x3ff9ab860ac473b4, -0x0f6ee211feec1bcb,
+        0x4ae75060ebc6c4af, 0x3f8612966c87000d }
+    }
+  },
+  {
+    {
+      { -0x63e70305c9fb72ed, 0x29159db373899ddd,
+        -0x2360caf4606d2f56, 0x26f57eee878a19d4 },
+      { 0x559a0cc9782a0dde, 0x551dcdb2ea718385,
+        0x7f62865b31ef238c, 0x504aa7767973613d },
+      { 0x0cab2cd55687efb1, 0x5180d162247af17b,
+        -0x7a3ea5cbb0a5db99, 0x4041943d9dba3069 }
+    },
+    {
+      { 0x4b217743a26caadd, 0x47a6b424648ab7ce,
+        -0x34e2b085fc04361d, 0x12d931429800d019 },
+      { -0x3c3f1145bc14336a, -0x728b6363d9156351,
+        -0x26056a11e388333a, 0x1420a1d97684340f },
+      { 0x00c67799d337594f, 0x5e3c5140b23aa47b,
+        0x44182854e35ff395, 0x1b4f92314359a012 }
+    },
+    {
+      { 0x33cf3030a49866b1, 0x251f73d2215f4859,
+        -0x547d55bfae210b0a, 0x5ff191d56f9a23f6 },
+      { 0x3e5c109d89150951, 0x39cefa912de9696a,
+        0x20eae43f975f3020, 0x239b572a7f132dae },
+      { -0x7e612bcc53d26f98, 0x2883ab795fc98523,
+        -0x10ba8d7faa6c14c3, 0x020c526a758f36cb }
+    },
+    {
+      { -0x16ce10a60fbd3377, 0x2c589c9d8e124bb6,
+        -0x52371e755138a669, 0x452cfe0a5602c50c },
+      { 0x779834f89ed8dbbc, -0x370d550623835b94,
+        -0x56adb3235c1e4f8c, 0x02aacc4615313877 },
+      { -0x795f085f9b878821, -0x443b9bd8f19f8361,
+        -0x54e815da0e04ee37, 0x4cfb7d7b304b877b }
+    },
+    {
+      { -0x1d79663d687610ee, 0x2b6ecd71df57190d,
+        -0x3cbc37a813368f30, 0x5b1d4cbc434d3ac5 },
+      { 0x72b43d6cb89b75fe, 0x54c694d99c6adc80,
+        -0x473c55c8c11cb361, 0x14b4622b39075364 },
+      { -0x4904d9ea33f560da, 0x3a4f0e2bb88dcce5,
+        0x1301498b3369a705, 0x2f98f71258592dd1 }
+    },
+    {
+      { 0x2e12ae444f54a701, -0x0301c10f56342822,
+        -0x314076f28a7ca220, 0x1d8062e9e7614554 },
+      { 0x0c94a74cb50f9e56, 0x5b1ff4a98e8e1320,
+        -0x65d533de7dcff099, 0x3a6ae249d806aaf9 },
+      { 0x657ada85a9907c5a, 0x1a0ea8b591b90f62,
+        -0x72f1e20420cb4b17, 0x298b8ce8aef25ff3 }
+    },
+    {
+      { -0x7c858d15f5de9a22, 0x3fab07b40bcf79f6,
+        0x521636c77738ae70, 0x6ba6271803a7d7dc },
+      { 0x2a927953eff70cb2, 0x4b89c92a79157076,
+        -0x6be7ba85cf583096, 0x34b8a8404d5ce485 },
+      { -0x3d91134a7c96cccb, -0x2a57ec209c4a0103,
+        -0x5d6c55655b4dda8d, 0x71d62bdd465e1c6a }
+    },
+    {
+      { -0x32d24a254e08a10b, -0x28806a30e94f9a0b,
+        0x14571fea3f49f085, 0x1c333621262b2b3d },
+      { 0x6533cc28d378df80, -0x0924bc86f5f05b4c,
+        -0x1c9ba00608fe25a6, 0x74d5f317f3172ba4 },
+      { -0x57901aab9826357f, 0x398b7c752b298c37,
+        -0x2592f76d1c539dc5, 0x4aebcc4547e9d98c }
+    }
+  },
+  {
+    {
+      { 0x0b408d9e7354b610, -0x7f94cdaca457a492,
+        -0x2419c5fcb5a75df9, 0x173bd9ddc9a1df2c },
+      { 0x12f0071b276d01c9, -0x1847453a793b7390,
+        0x5308129b71d6fba9, 0x5d88fbf95a3db792 },
+      { 0x2b500f1efe5872df, 0x58d6582ed43918c1,
+        -0x1912d8713698c520, 0x06e1cd13b19ea319 }
+    },
+    {
+      { 0x472baf629e5b0353, 0x3baa0b90278d0447,
+        0x0c785f469643bf27, 0x7f3a6a1a8d837b13 },
+      { 0x40d0ad516f166f23, 0x118e32931fab6abe,
+        0x3fe35e14a04d088e, 0x3080603526e16266 },
+      { -0x0819bbc6a2c27ff5, -0x6a572aaa36fe120a,
+        0x68cd7830592c6339, 0x30d0fded2e51307e }
+    },
+    {
+      { -0x634b68e19747b8b0, -0x5f6a8dd6999b4431,
+        0x5c8de72672fa412b, 0x4615084351c589d9 },
+      { -0x1fa6b2e50dedcc4d, 0x1bdbe78ef0cc4d9c,
+        0x6965187f8f499a77, 0x0a9214202c099868 },
+      { -0x436fe63f51465fd2, 0x55c7110d16034cae,
+        0x0e6df501659932ec, 0x3bca0d2895ca5dfe }
+    },
+    {
+      { -0x639771496133fe41, -0x0f437c5259bb7691,
+        -0x35d26aa0a085601e, 0x4ea8b4038df28241 },
+      { 0x40f031bc3c5d62a4, 0x19fc8b3ecff07a60,
+        -0x67e7c25decf04abb, 0x5631deddae8f13cd },
+      { 0x2aed460af1cad202, 0x46305305a48cee83,
+        -0x6ede88bab60ee5a1, 0x24ce0930542ca463 }
+    },
+    {
+      { 0x3fcfa155fdf30b85, -0x2d08e971c9c8d15c,
+        -0x4d1f9b219b6d07bc, 0x549928a7324f4280 },
+      { 0x1fe890f5fd06c106, -0x4a3b97caa277ef0e,
+        -0x7d87f701917350c2, 0x41d4e3c28a06d74b },
+      { -0x0d91cd589c11e5d2, -0x516e1b482da00216,
+        -0x43c42cc42e80b297, 0x491b66dec0dcff6a }
+    },
+    {
+      { 0x75f04a8ed0da64a1, -0x12ddd350981dd7b5,
+        -0x7dcb5c86e084845c, 0x4cf6b8b0b7018b67 },
+      { -0x670a4ec23815cd59, -0x1c2a073381e92468,
+        -0x53f540ad340726b9, 0x08f338d0c85ee4ac },
+      { -0x3c7c57de66e58c43, -0x54d843fe20cdf386,
+        -0x3ec2cce47b888f9d, 0x530d4a82eb078a99 }
+    },
+    {
+      { 0x6d6973456c9abf9e, 0x257fb2fc4900a880,
+        0x2bacf412c8cfb850, 0x0db3e7e00cbfbd5b },
+      { 0x004c3630e1f94825, 0x7e2d78268cab535a,
+        -0x38b7dcdc337b0075, 0x65ea753f101770b9 },
+      { 0x3d66fc3ee2096363, -0x7e29d3809e4a3495,
+        0x0fbe044213443b1a, 0x02a4ec1921e1a1db }
+    },
+    {
+      { -0x0a379e9d0e3086a1, 0x118c861926ee57f2,
+        0x172124851c063578, 0x36d12b5dec067fcf },
+      { 0x5ce6259a3b24b8a2, -0x47a88533ba505f48,
+        -0x33341917745f8fc9, 0x3d143c51127809bf },
+      { 0x126d279179154557, -0x2a1b70a30387c5f6,
+        0x36bdb6e8df179bac, 0x2ef517885ba82859 }
+    }
+  },
+  {
+    {
+      { -0x69114004cfa4d0af, -0x2c06c752776a6948,
+        -0x0f0ad238b92a22db, 0x57968290bb3a0095 },
+      { 0x4637974e8c58aedc, -0x4610dd04540fbe5c,
+        -0x1e7a26a9167f8e76, 0x2f1b78fab143a8a6 },
+      { -0x08e547bcf5df1eff, -0x0c6c9a72db0f13b9,
+        -0x308af657911d112f, 0x7dc43e35dc2aa3e1 }
+    },
+    {
+      { 0x5a782a5c273e9718, 0x3576c6995e4efd94,
+        0x0f2ed8051f237d3e, 0x044fb81d82d50a99 },
+      { -0x7a69999a7782263d, -0x36f064ceb44facab,
+        -0x391f720710df864f, 0x7ef72016758cc12f },
+      { -0x3e20e73a56f81c27, 0x57b3371dce4c6359,
+        -0x358fbacb4dfe44b7, 0x7f79823f9c30dd2e }
+    },
+    {
+      { 0x6a9c1ff068f587ba, 0x0827894e0050c8de,
+        0x3cbf99557ded5be7, 0x64a9b0431c06d6f0 },
+      { -0x7ccb2dc65c4aec18, -0x3ec98f2b46e05728,
+        0x12b54136f590bd33, 0x0a4e0373d784d9b4 },
+      { 0x2eb3d6a15b7d2919, -0x4f4b095f2ac57dcb,
+        0x7156ce4389a45d47, 0x071a7d0ace18346c }
+    },
+    {
+      { -0x33f3caaddf1ebbcf, 0x0d65950709b15141,
+        -0x650a9de4df62a0ca, 0x7c69bcf7617755d3 },
+      { -0x2cf8d255377845f5, 0x01262905bfa562ee,
+        -0x30abcffd3f108975, 0x2c3bcc7146ea7e9c },
+      { 0x07f0d7eb04e8295f, 0x10db18252f50f37d,
+        -0x16ae565ce8e86729, 0x6f5a9a7322aca51d }
+    },
+    {
+      { -0x18d62b145c26bb42, -0x7261f6bf7f875062,
+        0x4525567a47869c03, 0x02ab9680ee8d3b24 },
+      { -0x745efff3d0be393b, -0x3b60863ef3010465,
+        0x4efa47703cc51c9f, 0x494e21a2e147afca },
+      { -0x105b757a221af266, 0x219a224e0fb9a249,
+        -0x05f6e0e226e10927, 0x6b5d76cbea46bb34 }
+    },
+    {
+      { -0x1f06bee8e187dade, -0x0e19518bfc96c92d,
+        0x408b3ea2d0fcc746, 0x16fb869c03dd313e },
+      { -0x77a8aa9313f3266c, 0x6472dc6f5cd01dba,
+        -0x50fe96eb70bd4b89, 0x0ae333f685277354 },
+      { 0x288e199733b60962, 0x24fc72b4d8abe133,
+        0x4811f7ed0991d03e, 0x3f81e38b8f70d075 }
+    },
+    {
+      { 0x0adb7f355f17c824, 0x74b923c3d74299a4,
+        -0x2a83c17434071509, 0x0ad3e2d34cdedc3d },
+      { 0x7f910fcc7ed9affe, 0x545cb8a12465874b,
+        -0x57c6812db4f3b8fc, 0x50510fc104f50993 },
+      { 0x6f0c0fc5336e249d, 0x745ede19c331cfd9,
+        -0x0d2902fff61101e4, 0x127c158bf0fa1ebe }
+    },
+    {
+      { -0x215d703b51ae468c, 0x1d9973d3744dfe96,
+        0x6240680b873848a8, 0x4ed82479d167df95 },
+      { -0x09e683bdd167865e, -0x5bb5222bad35c9b9,
+        -0x64bec03eb4b15335, 0x354ef87d07ef4f68 },
+      { -0x011c4add9f3a268b, 0x50352efceb41b0b8,
+        -0x77f753cf56099ac4, 0x302d92d20539236d }
+    }
+  },
+  {
+    {
+      { 0x2dbc6fb6e4e0f177, 0x04e1bf29a4bd6a93,
+        0x5e1966d4787af6e8, 0x0edc5f5eb426d060 },
+      { 0x7813c1a2bca4283d, -0x129d0f6e5e79c227,
+        -0x513843473d97057a, 0x10e5d3b76f1cae4c },
+      { 0x5453bfd653da8e67, -0x1623e113db5609bf,
+        -0x4078d9c4fca875dd, 0x45b46c51361cba72 }
+    },
+    {
+      { -0x3162b22275801c1c, -0x54ec9ba9899df1d0,
+        0x4b594f7bb30e9958, 0x5c1c0aef321229df },
+      { -0x56bfd540ceb0805f, -0x1da80e2371730bb0,
+        0x1dbbd54b23a8be84, 0x2177bfa36dcb713b },
+      { 0x37081bbcfa79db8f, 0x6048811ec25f59b3,
+        0x087a76659c832487, 0x4ae619387d8ab5bb }
+    },
+    {
+      { 0x61117e44985bfb83, -0x031fb9d58e69ceca,
+        -0x7c53cbb72bda6fb5, 0x75685abe5ba43d64 },
+      { -0x72240955acbb5cd2, 0x7d88eab4b41b4078,
+        0x5eb0eb974a130d60, 0x1a00d91b17bf3e03 },
+      { 0x6e960933eb61f2b2, 0x543d0fa8c9ff4952,
+        -0x208d8aef85099a97, 0x135529b623b0e6aa }
+    },
+    {
+      { -0x0a38e9431dd17c02, -0x4bd414e617f67a3f,
+        -0x136259c8ebdab552, 0x5972ea051590a613 },
+      { 0x18f0dbd7add1d518, -0x68608777303ee0ef,
+        -0x78cd1e0f8eeb8a65, 0x79b5b81a65ca3a01 },
+      { 0x0fd4ac20dc8f7811, -0x65652d6b53b2b058,
+        -0x3fe4d29b4cc9fbcc, 0x4f7e9c95905f3bdb }
+    },
+    {
+      { 0x71c8443d355299fe, -0x7432c4e324141529,
+        -0x7f6db6610e5b6b9a, 0x1942eec4a144adc8 },
+      { 0x62674bbc5781302e, -0x27adf0c6765223f1,
+        -0x73d66651ac04263a, 0x31993ad92e638e4c },
+      { 0x7dac5319ae234992, 0x2c1b3d910cea3e92,
+        0x553ce494253c1122, 0x2a0a65314ef9ca75 }
+    },
+    {
+      { -0x30c9e532c3e386c6, 0x2f9ebcac5a35bc3b,
+        0x60e860e9a8cda6ab, 0x055dc39b6dea1a13 },
+      { 0x2db7937ff7f927c2, -0x248be0f9e82f59cb,
+        0x5982f3a21155af76, 0x4cf6e218647c2ded },
+      { -0x4ee6dd833d72a44a, 0x07e24ebc774dffab,
+        -0x57c387311b5cd377, 0x121a307710aa24b6 }
+    },
+    {
+      { -0x29a68ec1388b7c37, -0x77401f8847d46951,
+        0x289e28231097bcd3, 0x527bb94a6ced3a9b },
+      { -0x1b24a2a160fcb569, -0x1eac03f6cfcb43d3,
+        0x460546919551d3b1, 0x333fc76c7a40e52d },
+      { 0x563d992a995b482e, 0x3405d07c6e383801,
+        0x485035de2f64d8e5, 0x6b89069b20a7a9f7 }
+    },
+    {
+      { 0x4082fa8cb5c7db77, 0x068686f8c734c155,
+        0x29e6c8d9f6e7a57e, 0x0473d308a7639bcf },
+      { -0x7ed55fbe9d8fddf3, -0x66a5760506dba4b2,
+        -0x00523b31af8d10fb, 0x23bc2103aa73eb73 },
+      { -0x351186d9fca761fb, 0x2b4b421246dcc492,
+        0x02a1ef74e601a94f, 0x102f73bfde04341a }
+    }
+  },
+  {
+    {
+      { -0x5d4b251f4aaee366, 0x7ac860292bffff06,
+        -0x67e0c8a20aafbdcc, 0x3f6bd725da4ea12d },
+      { -0x14e7465480a8ba3a, 0x023a8aee5787c690,
+        -0x48d8ed25d2085057, 0x36597d25ea5c013d },
+      { 0x734d8d7b106058ac, -0x26bfa86190396fa1,
+        0x6466f8f99202932d, 0x7b7ecc19da60d6d0 }
+    },
+    {
+      { 0x6dae4a51a77cfa9b, -0x7dd9c9ab185c79b0,
+        0x09bbffcd8f2d82db, 0x03bedc661bf5caba },
+      { 0x78c2373c695c690d, -0x22dad199f9bd6f92,
+        -0x6ae2bbbbb51ed42e, 0x4235ad7601743956 },
+      { 0x6258cb0d078975f5, 0x492942549189f298,
+        -0x5f354bdc1d1c911c, 0x0e7ce2b0cdf066a1 }
+    },
+    {
+      { -0x0159012026b48f07, -0x0ecf3fae3e0345d3,
+        0x4882d47e7f2fab89, 0x615256138aeceeb5 },
+      { -0x3b6b9bc53b737a5d, -0x02c9e20bc39ec653,
+        0x09db17dd3ae94d48, 0x666e0a5d8fb4674a },
+      { 0x2abbf64e4870cb0d, -0x329a430f55ba7495,
+        -0x6541b1458a1767a3, 0x7f0bc810d514dee4 }
+    },
+    {
+      { -0x7c5362528c8dec60, -0x60090745d108d168,
+        0x311e2edd43ec6957, 0x1d3a907ddec5ab75 },
+      { -0x46ff945bd90bec91, -0x7298c961a81fcfcb,
+        -0x34372026b0b9c3d8, 0x0d1f8dbcf8eedbf5 },
+      { -0x45e96ccec12f7e24, 0x29329fad851b3480,
+        0x0128013c030321cb, 0x00011b44a31bfde3 }
+    },
+    {
+      { 0x16561f696a0aa75c, -0x3e408da3a7ad4296,
+        0x11a8dd7f9a7966ad, 0x63d988a2d2851026 },
+      { 0x3fdfa06c3fc66c0c, 0x5d40e38e4dd60dd2,
+        0x7ae38b38268e4d71, 0x3ac48d916e8357e1 },
+      { 0x00120753afbd232e, -0x16d431470227097d,
+        -0x07e9964c7b18d46f, 0x33fad52b2368a066 }
+    },
+    {
+      { -0x72d3372f3bdd3018, 0x072b4f7b05a13acb,
+        -0x5c01491913095a91, 0x3cc355ccb90a71e2 },
+      { 0x540649c6c5e41e16, 0x0af86430333f7735,
+        -0x4d53032d0cfa18ba, 0x16c0f429a256dca7 },
+      { -0x16496bbc6fc16ecf, -0x475b6b3485a9c832,
+        -0x37832e5b45456dbc, 0x631eaf426bae7568 }
+    },
+    {
+      { 0x47d975b9a3700de8, 0x7280c5fbe2f80552,
+        0x53658f2732e45de1, 0x431f2c7f665f80b5 },
+      { -0x4c16fbef25990161, -0x7a22b4ad93e91a5a,
+        -0x43c2689ee106407d, 0x5599648b1ea919b5 },
+      { -0x29fd9cbb7a7084e7, 0x14ab352fa1ea514a,
+        -0x76ffbbe5df6f5629, 0x7b04715f91253b26 }
+    },
+    {
+      { -0x4c893d7f3b19453a, -0x68f12c2292e264f5,
+        -0x4f656aa7baf406bc, 0x48d0acfa57cde223 },
+      { -0x7c1242d7530951bd, -0x79ca837482a3854c,
+        -0x3fbfb8964814d3bc, 0x59b37bf5c2f6583f },
+      { -0x49f0d91b8254198f, -0x0e2e5e689dd0c5c9,
+        0x4208ce7ee9960394, 0x16234191336d3bdb }
+    }
+  },
+  {
+    {
+      { -0x22b66329e00c79c0, 0x29cd9bc3063625a0,
+        0x51e2d8023dd73dc3, 0x4a25707a203b9231 },
+      { -0x461b662109d9800a, 0x7772ca7b742c0843,
+        0x23a0153fe9a4f2b1, 0x2cdfdfecd5d05006 },
+      { 0x2ab7668a53f6ed6a, 0x304242581dd170a1,
+        0x4000144c3ae20161, 0x5721896d248e49fc }
+    },
+    {
+      { 0x285d5091a1d0da4e, 0x4baa6fa7b5fe3e08,
+        0x63e5177ce19393b3, 0x03c935afc4b030fd },
+      { 0x0b6e5517fd181bae, -0x6fdd9d60d4469c4c,
+        0x5509bce932064625, 0x578edd74f63c13da },
+      { -0x668d8939b6d4f3c3, 0x47ccc2c4dfe205fc,
+        -0x232d647b229dc5c4, 0x3ec2ab590288c7a2 }
+    },
+    {
+      { -0x58dec5f651cd2e35, 0x0f2b87df40f5c2d5,
+        0x0baea4c6e81eab29, 0x0e1bf66c6adbac5e },
+      { -0x5e5f2d841b278447, -0x5674b2149ec6e513,
+        -0x665f222f8c34647d, 0x2dd5c25a200fcace },
+      { -0x1d542a1686d37782, 0x1a020018cb926d5d,
+        -0x404596324551a0e2, 0x730548b35ae88f5f }
+    },
+    {
+      { -0x7fa4f6b45e291ccc, -0x40c10e88f6cac0e7,
+        0x423f06cb0622702b, 0x585a2277d87845dd },
+      { -0x3bcaae5c34574712, 0x65a26f1db2115f16,
+        0x760f4f52ab8c3850, 0x3043443b411db8ca },
+      { -0x5e75a07dcc2b769e, 0x6698c4b5ec78257f,
+        -0x5871905ac8c1be01, 0x7656278950ef981f }
+    },
+    {
+      { -0x1e8f8c5c15793063, 0x3a8cfbb707155fdc,
+        0x4853e7fc31838a8e, 0x28bbf484b613f616 },
+      { 0x38c3cf59d51fc8c0, -0x64122d02faf9490e,
+        0x26bf109fab570e8f, 0x3f4160a8c1b846a6 },
+      { -0x0d9ed0a390ec9384, -0x50152ef80922ee42,
+        0x527e9ad213de6f33, 0x1e79cb358188f75d }
+    },
+    {
+      { 0x77e953d8f5e08181, -0x7b5af3bbd6622127,
+        -0x2393d2f379bada1b, 0x478ab52d39d1f2f4 },
+      { 0x013436c3eef7e3f1, -0x7d7495800161ef08,
+        0x7ff908e5bcf9defc, 0x65d7951b3a3b3831 },
+      { 0x66a6a4d39252d159, -0x1a221e4378e537f9,
+        -0x47d394bf593e3691, 0x16d87a411a212214 }
+    },
+    {
+      { -0x045b2a1d2ab1fa7d, -0x1de05028d1426606,
+        0x497ac2736ee9778f, 0x1f990b577a5a6dde },
+      { -0x4c4281a5bdf99deb, -0x78641c32f3a5db3f,
+        0x57c05db1d6f994b7, 0x28f87c8165f38ca6 },
+      { -0x5ccbb152e417082a, 0x7d1e50ebacea798f,
+        0x77c6569e520de052, 0x45882fe1534d6d3e }
+    },
+    {
+      { -0x275366d66bc3901c, -0x4a060e9e5c7c6d5e,
+        0x2699db13bec89af3, 0x7dcf843ce405f074 },
+      { 0x6669345d757983d6, 0x62b6ed1117aa11a6,
+        0x7ddd1857985e128f, 0x688fe5b8f626f6dd },
+      { 0x6c90d6484a4732c0, -0x2adebc0235a9cd67,
+        -0x4c41d73c6ea2391f, 0x6739687e7327191b }
+    }
+  },
+  {
+    {
+      { -0x5992336237f3e540, -0x685fa30be4c75bca,
+        -0x58140c416a24283a, 0x7da0b8f68d7e7dab },
+      { -0x1087dfebc7a98a5a, -0x5d9b60cf55025618,
+        0x4cd1eb505cdfa8cb, 0x46115aba1d4dc0b3 },
+      { -0x2bf0e6ac3c4a258a, 0x1dac6f7321119e9b,
+        0x03cc6021feb25960, 0x5a5f887e83674b4b }
+    },
+    {
+      { -0x6169d72c5f59bc47, -0x4a3c34ff193cdf9c,
+        -0x64acfd7683d213ce, 0x43e37ae2d5d1c70c },
+      { -0x709cfe308f5ec2ef, -0x303147eacaf22f3c,
+        -0x08fd682b5b435b82, 0x3669b656e44d1434 },
+      { 0x387e3f06eda6e133, 0x67301d5199a13ac0,
+        -0x42a52707c9d9c7ef, 0x6a21e6cd4fd5e9be }
+    },
+    {
+      { -0x10bed6ed99664d1d, 0x71d30847708d1301,
+        0x325432d01182b0bd, 0x45371b07001e8b36 },
+      { -0x0e39e8f5cfb919a1, 0x58712a2a00d23524,
+        0x69dbbd3c8c82b755, 0x586bf9f1a195ff57 },
+      { -0x5924f772a10786f5, 0x5278f0dc610937e5,
+        -0x53fcb62d9e5e9148, 0x0eafb03790e52179 }
+    },
+    {
+      { 0x5140805e0f75ae1d, -0x13fd041cd99d33d0,
+        0x2cebdf1eea92396d, 0x44ae3344c5435bb3 },
+      { -0x69faaa3ec8b7fbd1, 0x219a41e6820baa11,
+        0x1c81f73873486d0c, 0x309acc675a02c661 },
+      { -0x630d7646445abc12, -0x0c89f162a5368ebe,
+        0x1d82e5c64f9360aa, 0x62d5221b7f94678f }
+    },
+    {
+      { 0x7585d4263af77a3c, -0x205184ee0116ebb3,
+        -0x5af98f7fa608e6c3, 0x14f29a5383922037 },
+      { 0x524c299c18d0936d, -0x37944a9375f3e5f4,
+        -0x5c8afad124b579cf, 0x5c0efde4bc754562 },
+      { -0x208e8123da4d280b, 0x21f970db99b53040,
+        -0x256dcb483c12b39e, 0x5e72365c7bee093e }
+    },
+    {
+      { 0x7d9339062f08b33e, 0x5b9659e5df9f32be,
+        -0x5300c252e0614203, 0x70b20555cb7349b7 },
+      { 0x575bfc074571217f, 0x3779675d0694d95b,
+        -0x65f5c8440be6e1cd, 0x77f1104c47b4eabc },
+      { -0x41aeec3aaaeed3b4, 0x6688423a9a881fcd,
+        0x446677855e503b47, 0x0e34398f4a06404a }
+    },
+    {
+      { 0x18930b093e4b1928, 0x7de3e10e73f3f640,
+        -0x0bcde8258cc6a291, 0x6f8aded6ca379c3e },
+      { -0x4982dd26c1314218, 0x09b3e84127822f07,
+        0x743fa61fb05b6d8d, 0x5e5405368a362372 },
+      { -0x1cbfedc202484d66, 0x487b97e1a21ab291,
+        -0x066982fd02196b62, 0x780de72ec8d3de97 }
+    },
+    {
+      { 0x671feaf300f42772, -0x708d14d5d573be56,
+        0x29a17fd797373292, 0x1defc6ad32b587a6 },
+      { 0x0ae28545089ae7bc, 0x388ddecf1c7f4d06,
+        0x38ac15510a4811b8, 0x0eb28bf671928ce4 },
+      { -0x50a441e510ae6a59, 0x148c1277917b15ed,
+        0x2991f7fb7ae5da2e, 0x467d201bf8dd2867 }
+    }
+  },
+  {
+    {
+      { -0x43e10b42a9851857, 0x3f624cb2d64498bd,
+        -0x1bef9b2dd3e0b138, 0x2ef9c5a5ba384001 },
+      { -0x6a016e658b10b053, 0x3a827becf6a308a2,
+        -0x69b1fe2cf65b84ff, 0x71c43c4f5ba3c797 },
+      { -0x4902920905618b33, -0x0e7d87431b50d986,
+        -0x7daa4c2f0e1066f2, 0x5a758ca390c5f293 }
+    },
+    {
+      { -0x731f6e74e29e236c, -0x7212c9b9657ecf9a,
+        -0x2b1957d65017552d, 0x0a738027f639d43f },
+      { -0x5d48d8ef26b9db6b, 0x3aa8c6d2d57d5003,
+        -0x1c2bff405f4b7836, 0x2dbae244b3eb72ec },
+      { -0x67f0b5d0a8001e34, 0x00670d0de1839843,
+        0x105c3f4a49fb15fd, 0x2698ca635126a69c }
+    },
+    {
+      { 0x2e3d702f5e3dd90e, -0x61c0f6e71b2dac7a,
+        0x5e773ef6024da96a, 0x3c004b0c4afa3332 },
+      { -0x189ace77cd4f4588, 0x381831f7925cff8b,
+        0x08a81b91a0291fcc, 0x1fb43dcc49caeb07 },
+      { -0x6556b953f90b47d5, 0x1ca284a5a806c4f3,
+        0x3ed3265fc6cd4787, 0x6b43fd01cd1fd217 }
+    },
+    {
+      { -0x4a38bda7c189f10d, 0x75dc52b9ee0ab990,
+        -0x40ebd83df8d46dc1, 0x73420b2d6ff0d9f0 },
+      { -0x3858a2b4b9683abc, 0x15fdf848df0fffbf,
+        0x2868b9ebaa46785a, 0x5a68d7105b52f714 },
+      { -0x50d30934617ae1fa, -0x70a6c6ec39ddc73c,
+        -0x2575476966040c8d, 0x3db5632fea34bc9e }
+    },
+    {
+      { 0x2e4990b1829825d5, -0x12151478c165766f,
+        -0x110fc2c6b38fb508, 0x59197ea495df2b0e },
+      { -0x0b9111d408a22628, 0x0d17b1f6396759a5,
+        0x1bf2d131499e7273, 0x04321adf49d75f13 },
+      { 0x04e16019e4e55aae, -0x1884bc8581d06d17,
+        -0x3831d23e90ea655c, 0x45eafdc1f4d70cc0 }
+    },
+    {
+      { -0x49f1b9db30334e13, 0x59dbc292bd5c0395,
+        0x31a09d1ddc0481c9, 0x3f73ceea5d56d940 },
+      { 0x698401858045d72b, 0x4c22faa2cf2f0651,
+        -0x6be5c99a94ddd23a, 0x5a5eebc80362dade },
+      { -0x4858402ef5b1723a, -0x41a8ff81bb364cc7,
+        0x60c1207f1557aefa, 0x26058891266218db }
+    },
+    {
+      { 0x4c818e3cc676e542, 0x5e422c9303ceccad,
+        -0x13f833354bed60f8, 0x0dedfa10b24443b8 },
+      { 0x59f704a68360ff04, -0x3c26c021899e190c,
+        -0x7ce4d58ced78caaf, 0x54ad0c2e4e615d57 },
+      { -0x11c4982a47d4add6, 0x36f163469fa5c1eb,
+        -0x5a4b2d0d913e602d, 0x62ecb2baa77a9408 }
+    },
+    {
+      { -0x6df8d7c95049d78c, 0x5fcd5e8579e104a5,
+        0x5aad01adc630a14a, 0x61913d5075663f98 },
+      { -0x1a1286ad9eead4c3, 0x4962357d0eddd7d1,
+        0x7482c8d0b96b4c71, 0x2e59f919a966d8be },
+      { 0x0dc62d361a3231da, -0x05b8a7cd6bdffd90,
+        0x02d801513f9594ce, 0x3ddbc2a131c05d5c }
+    }
+  },
+  {
+    {
+      { -0x0c55a85dd86944ec, -0x77c5454864f825df,
+        -0x1ab41de7ce5fc6e4, 0x5ee7fb38d83205f9 },
+      { -0x6523f00631a13ab5, 0x039c2a6b8c2f130d,
+        0x028007c7f0f89515, 0x78968314ac04b36b },
+      { 0x538dfdcb41446a8e, -0x5a530256bcb6c807,
+        0x46af908d263c8c78, 0x61d0633c9bca0d09 }
+    },
+    {
+      { -0x525cd74307038c21, -0x117b96a2590fc804,
+        0x637fb4db38c2a909, 0x5b23ac2df8067bdc },
+      { 0x63744935ffdb2566, -0x3a42947687f49745,
+        0x6f1b3280553eec03, 0x6e965fd847aed7f5 },
+      { -0x652d46ac117fad85, -0x1770e65505219273,
+        0x0e711704150e82cf, 0x79b9bbb9dd95dedc }
+    },
+    {
+      { -0x2e66825171608c8c, -0x5fcd5d073044f7ea,
+        -0x329345ed92bba0f6, 0x1ba811460accb834 },
+      { -0x144caabf95ced93e, -0x2d9c7c5797373c6d,
+        0x6c0c6429e5b97a82, 0x5065f158c9fd2147 },
+      { 0x708169fb0c429954, -0x1eb9ff5328913099,
+        0x2eaab98a70e645ba, 0x3981f39e58a4faf2 }
+    },
+    {
+      { -0x37ba205a92199022, -0x1ead5affd3bfb7c6,
+        -0x162d1e9c384b09ce, 0x30f4452edcbc1b65 },
+      { 0x18fb8a7559230a93, 0x1d168f6960e6f45d,
+        0x3a85a94514a93cb5, 0x38dc083705acd0fd },
+      { -0x7a92d87d3a8a68c0, -0x05ecba9606634134,
+        -0x77bb038c3f15b18f, 0x632d9a1a593f2469 }
+    },
+    {
+      { -0x40f602ee12f37b59, 0x63f071810d9f693a,
+        0x21908c2d57cf8779, 0x3a5a7df28af64ba2 },
+      { -0x094494ea47f8345a, 0x1823c7dfbc54f0d7,
+        -0x44e268fc91d698f5, 0x0b24f48847ed4a57 },
+      { -0x23252b41aee41539, -0x5bac7f8a12d9330e,
+        -0x1e630060ffa0659b, 0x34fcf74475481f63 }
+    },
+    {
+      { -0x5a44e25487305568, 0x5ceda267190b72f2,
+        -0x6cf636eef56d9f72, 0x0119a3042fb374b0 },
+      { -0x3e681fb387689836, -0x478eb234c726b983,
+        0x55de888283f95fa8, 0x3d3bdc164dfa63f7 },
+      { 0x67a2d89ce8c2177d, 0x669da5f66895d0c1,
+        -0x0a9a671a4d7d5d50, 0x56c088f1ede20a73 }
+    },
+    {
+      { 0x581b5fac24f38f02, -0x56f41601451cf343,
+        -0x65de96fd75306d10, 0x038b7ea48359038f },
+      { 0x336d3d1110a86e17, -0x280c77cdf48a4d06,
+        -0x06eacc89daf8d678, 0x09674c6b99108b87 },
+      { -0x60b107de66ce9008, 0x2f49d282eaa78d4f,
+        0x0971a5ab5aef3174, 0x6e5e31025969eb65 }
+    },
+    {
+      { 0x3304fb0e63066222, -0x04caf976785345c1,
+        -0x42e6db8873ef9e5d, 0x3058ad43d1838620 },
+      { -0x4e939d0a781a6c05, 0x4999eddeca5d3e71,
+        -0x4b6e3e1feb33c193, 0x08f5114789a8dba8 },
+      { 0x323c0ffde57663d0, 0x05c3df38a22ea610,
+        -0x423875425366b066, 0x26549fa4efe3dc99 }
+    }
+  },
+  {
+    {
+      { -0x24b97ab650c09992, -0x288030fb0eb5f15b,
+        0x3df23ff7a4ba0c47, 0x3a10dfe132ce3c85 },
+      { 0x741d5a461e6bf9d6, 0x2305b3fc7777a581,
+        -0x2baa8b5d9b8b2c27, 0x1926e1dc6401e0ff },
+      { -0x1f80b17515e83160, 0x2fd515463a1fc1fd,
+        0x175322fd31f2c0f1, 0x1fa1d01d861e5d15 }
+    },
+    {
+      { 0x38dcac00d1df94ab, 0x2e712bddd1080de9,
+        0x7f13e93efdd5e262, 0x73fced18ee9a01e5 },
+      { -0x337faa6b82a667ce, 0x1e4656da37f15520,
+        -0x6609088bb1fa6ce0, 0x773563bc6a75cf33 },
+      { 0x06b1e90863139cb3, -0x5b6c25983a5fc133,
+        -0x72883137529c76ce, 0x1f426b701b864f44 }
+    },
+    {
+      { -0x0e81ca376e5edaae, -0x48947eaca8a1638a,
+        -0x057cbf90f2648dc2, 0x0b76bb1b3fa7e438 },
+      { -0x1036d9b3be6ee3ff, -0x0e5c4847e85dd3db,
+        0x5875da6bf30f1447, 0x4e1af5271d31b090 },
+      { 0x08b8c1f97f92939b, -0x41988e342bbb5492,
+        0x22e5646399bb8017, 0x7b6dd61eb772a955 }
+    },
+    {
+      { 0x5730abf9ab01d2c7, 0x16fb76dc40143b18,
+        -0x7993419a5f344d7f, 0x53fa9b659bff6afe },
+      { -0x48523e17af0cc26e, 0x7998fa4f608cd5cf,
+        -0x5269d2427203a425, 0x703e9bceaf1d2f4f },
+      { 0x6c14c8e994885455, -0x7bc5a2999a512b1b,
+        0x181bb73ebcd65af1, 0x398d93e5c4c61f50 }
+    },
+    {
+      { -0x3c78839f2d181c0e, 0x3b34aaa030828bb1,
+        0x283e26e7739ef138, 0x699c9c9002c30577 },
+      { 0x1c4bd16733e248f3, -0x4261ed78ea40f5a1,
+        -0x2bc0730f5ef4fc8a, 0x53b09b5ddf191b13 },
+      { -0x0cf958dca6b90e34, -0x6de8e74a331a2683,
+        0x28cdd24781b4e975, 0x51caf30c6fcdd907 }
+    },
+    {
+      { 0x737af99a18ac54c7, -0x6fcc87233ae34cf1,
+        0x2b89bc334ce10cc7, 0x12ae29c189f8e99a },
+      { -0x59f458bd898b1ff6, 0x630e8570a17a7bf3,
+        0x3758563dcf3324cc, 0x5504aa292383fdaa },
+      { -0x56613f34e0f2fe31, 0x0dd1efcc3a34f7ae,
+        0x55ca7521d09c4e22, 0x5fd14fe958eba5ea }
+    },
+    {
+      { 0x3c42fe5ebf93cb8e, -0x412057aec92ba9a1,
+        -0x1f0f7a6177bddf18, 0x7dd73f960725d128 },
+      { -0x4a23d220d7ba54d4, 0x069491b10a7fe993,
+        0x4daaf3d64002e346, 0x093ff26e586474d1 },
+      { -0x4ef2db0197fa67d7, 0x75730672dbaf23e5,
+        0x1367253ab457ac29, 0x2f59bcbc86b470a4 }
+    },
+    {
+      { 0x7041d560b691c301, -0x7adfe4c0522818e2,
+        0x16c2e16311335585, 0x2aa55e3d010828b1 },
+      { -0x7c7b82bd66e8eca1, -0x52e46ee0a982fc29,
+        0x7e7748d9be77aad1, 0x5458b42e2e51af4a },
+      { -0x12ae6d19f3f8bbb1, 0x42c54e2d74421d10,
+        0x352b4c82fdb5c864, 0x13e9004a8a768664 }
+    }
+  },
+  {
+    {
+      { -0x44d1ff36e6c47881, -0x131c576f1f23af95,
+        -0x130c483fc9219b61, 0x5f46040898de9e1a },
+      { 0x739d8845832fcedb, -0x05c729365194079d,
+        0x32bc0dcab74ffef7, 0x73937e8814bce45e },
+      { -0x46fc8ee9d6840b73, -0x562ec4dd2b0f97cc,
+        -0x1e68eaa8b969423a, 0x2cf8a4e891d5e835 }
+    },
+    {
+      { 0x2cb5487e17d06ba2, 0x24d2381c3950196b,
+        -0x289a637e7a6875d0, 0x7a6f7f2891d6a4f6 },
+      { 0x6d93fd8707110f67, -0x22b3f62c83c74ab7,
+        0x7cb16a4cc2736a86, 0x2049bd6e58252a09 },
+      { 0x7d09fd8d6a9aef49, -0x0f119f41a4c246f5,
+        0x4c21b52c519ebfd4, 0x6011aadfc545941d }
+    },
+    {
+      { 0x63ded0c802cbf890, -0x042f6735f2009556,
+        0x624d0afdb9b6ed99, 0x69ce18b779340b1e },
+      { 0x5f67926dcf95f83c, 0x7c7e856171289071,
+        -0x295e180c667085a5, 0x6fc5cc1b0b62f9e0 },
+      { -0x2e10aad74d678635, -0x22e551c32b816f6e,
+        0x127e0442189f2352, 0x15596b3ae57101f1 }
+    },
+    {
+      { 0x09ff31167e5124ca, 0x0be4158bd9c745df,
+        0x292b7d227ef556e5, 0x3aa4e241afb6d138 },
+      { 0x462739d23f9179a2, -0x007cedce68292231,
+        0x1307deb553f2148a, 0x0d2237687b5f4dda },
+      { 0x2cc138bf2a3305f5, 0x48583f8fa2e926c3,
+        0x083ab1a25549d2eb, 0x32fcaa6e4687a36c }
+    },
+    {
+      { 0x3207a4732787ccdf, 0x17e31908f213e3f8,
+        -0x2a4d132809f269b2, 0x746f6336c2600be9 },
+      { 0x7bc56e8dc57d9af5, 0x3e0bd2ed9df0bdf2,
+        -0x553feb21dd101b5d, 0x4627e9cefebd6a5c },
+      { 0x3f4af345ab6c971c, -0x1d77148d66bc8ce1,
+        0x33596a8a0344186d, 0x7b4917007ed66293 }
+    },
+    {
+      { 0x54341b28dd53a2dd, -0x55e86fa420bd03c1,
+        0x0ff592d94dd2f8f4, 0x1d03620fe08cd37d },
+      { 0x2d85fb5cab84b064, 0x497810d289f3bc14,
+        0x476adc447b15ce0c, 0x122ba376f844fd7b },
+      { -0x3dfdcd325d4b1aac, -0x612f02bdeea2e781,
+        0x2eabb4be7dd479d9, 0x02c70bf52b68ec4c }
+    },
+    {
+      { -0x531acd40ba728d1f, 0x5be768e07cb73cb5,
+        0x56cf7d94ee8bbde7, 0x6b0697e3feb43a03 },
+      { -0x5d7813b4a2f4d045, 0x415c5790074882ca,
+        -0x1fbb59e13e2f7ea4, 0x26334f0a409ef5e0 },
+      { -0x49370fb5209d5c40, 0x3ef000ef076da45d,
+        -0x636346a7b60f2d57, 0x1cc37f43441b2fae }
+    },
+    {
+      { -0x2899a90e36315147, 0x1c5b15f818e5656a,
+        0x26e72832844c2334, 0x3a346f772f196838 },
+      { 0x508f565a5cc7324f, -0x2f9e3b3f1af956de,
+        -0x04e75424a3ba53e7, 0x6c6809c10380314a },
+      { -0x2d2aaeed1d259538, -0x1642fcce4e17ae13,
+        -0x69f8b92271398d9e, 0x05911b9f6ef7c5d0 }
+    }
+  },
+  {
+    {
+      { 0x5349acf3512eeaef, 0x20c141d31cc1cb49,
+        0x24180c07a99a688d, 0x555ef9d1c64b2d17 },
+      { -0x3ecc667c0a20f145, -0x3f0c8a70aed3b354,
+        0x2cf1130a0bb398e1, 0x6b3cecf9aa270c62 },
+      { 0x36a770ba3b73bd08, 0x624aef08a3afbf0c,
+        0x5737ff98b40946f2, 0x675f4de13381749d }
+    },
+    {
+      { -0x5ed00926c4254ce3, 0x0725d80f9d652dfe,
+        0x019c4ff39abe9487, 0x60f450b882cd3c43 },
+      { 0x0e2c52036b1782fc, 0x64816c816cad83b4,
+        -0x2f234226969bf8c2, 0x13d99df70164c520 },
+      { 0x014b5ec321e5c0ca, 0x4fcb69c9d719bfa2,
+        0x4e5f1c18750023a0, 0x1c06de9e55edac80 }
+    },
+    {
+      { -0x002ad4bf00929656, 0x34530b18dc4049bb,
+        0x5e4a5c2fa34d9897, 0x78096f8e7d32ba2d },
+      { -0x66f085295cc13b1e, 0x6608f938be2ee08e,
+        -0x635ebc3a9cd7baeb, 0x4cf38a1fec2db60d },
+      { -0x5f55559af205a319, -0x063b61d5b74ab874,
+        0x4f09cc7d7003725b, 0x373cad3a26091abe }
+    },
+    {
+      { -0x0e41570476224453, 0x3bcb2cbc61aeaecb,
+        -0x70a75844e0647263, 0x21547eda5112a686 },
+      { -0x4d6b9cb27d360a84, 0x1fcbfde124934536,
+        -0x6163b24cbe7324a6, 0x0040f3d9454419fc },
+      { -0x210216c602a6792d, -0x0bd8d376aef5c7f4,
+        -0x48d45bf844cee647, 0x63550a334a254df4 }
+    },
+    {
+      { -0x6445a7ba8dab84b7, -0x0cfa39051d3bf720,
+        0x60e8fa69c734f18d, 0x39a92bafaa7d767a },
+      { 0x6507d6edb569cf37, 0x178429b00ca52ee1,
+        -0x1583ff6f149429a3, 0x3eea62c7daf78f51 },
+      { -0x62db38ec196cd8b2, 0x5f63857768dbd375,
+        0x70525560eb8ab39a, 0x68436a0665c9c4cd }
+    },
+    {
+      { 0x1e56d317e820107c, -0x3ad997bb7bf5169b,
+        -0x3e1f5e39cdf00386, 0x5373669c91611472 },
+      { -0x43fdca17dfd0c0d9, -0x38a3ff1d9b068a50,
+        -0x6e5b162a5c73dbea, 0x17b6e7f68ab789f9 },
+      { 0x5d2814ab9a0e5257, -0x6f70df7b36354c04,
+        -0x50350a77a4d2e136, 0x1cb4b5a678f87d11 }
+    },
+    {
+      { 0x6b74aa62a2a007e7, -0x0cee1f4f0f8e384f,
+        0x5707e438000be223, 0x2dc0fd2d82ef6eac },
+      { -0x499b3f94c6b50394, 0x0c88de2498da5fb1,
+        0x4f8d03164bcad834, 0x330bca78de7434a2 },
+      { -0x67d1007beee68bb2, -0x0696a169d4f8b8dc,
+        -0x3a753eb04036ac05, 0x3c31be1b369f1cf5 }
+    },
+    {
+      { -0x3e97436c0634bd8e, -0x51478ee038312468,
+        0x7f0e52aa34ac8d7a, 0x41cec1097e7d55bb },
+      { -0x4f0b79b2f76b7512, 0x07dc19ee91ba1c6f,
+        0x7975cdaea6aca158, 0x330b61134262d4bb },
+      { -0x0869e6285d927f76, -0x44e02b61e261ea93,
+        0x73d7c36cdba1df27, 0x26b44cd91f28777d }
+    }
+  },
+  {
+    {
+      { -0x1e480d6c9d8cfc7d, 0x4b5279ffebca8a2c,
+        -0x25038875402becec, 0x7deb10149c72610f },
+      { 0x51f048478f387475, -0x4da2430b634134c4,
+        -0x6554edbb2660dfab, 0x2c709e6c1c10a5d6 },
+      { -0x349d509578991186, 0x66cbec045553cd0e,
+        0x588001380f0be4b5, 0x08e68e9ff62ce2ea }
+    },
+    {
+      { 0x2f2d09d50ab8f2f9, -0x5346de723aa6dc21,
+        0x4a8f342673766cb9, 0x4cb13bd738f719f5 },
+      { 0x34ad500a4bc130ad, -0x72c724b6c2f42b64,
+        -0x5da3c267aff57642, 0x2f1f3f87eeba3b09 },
+      { -0x087b738a1aea49b6, -0x5a6afe4524b56fc8,
+        -0x3df2cec0c08ae4b0, 0x19a1e353c0ae2ee8 }
+    },
+    {
+      { -0x4bde8d322a694243, -0x6c1fbabc671103c0,
+        -0x604eacb84bbef64b, 0x736bd3990266ae34 },
+      { 0x7d1c7560bafa05c3, -0x4c1e5f5f391aa19f,
+        -0x1cad68e73f299b8d, 0x41546b11c20c3486 },
+      { -0x7aacd2af6ccb4c4c, 0x46fd114b60816573,
+        -0x33a0a0cfbda37c8b, 0x412295a2b87fab5c }
+    },
+    {
+      { 0x2e655261e293eac6, -0x7ba56dfcdecc5325,
+        0x460975cb7900996b, 0x0760bb8d195add80 },
+      { 0x19c99b88f57ed6e9, 0x5393cb266df8c825,
+        0x5cee3213b30ad273, 0x14e153ebb52d2e34 },
+      { 0x413e1a17cde6818a, 0x57156da9ed69a084,
+        0x2cbf268f46caccb1, 0x6b34be9bc33ac5f2 }
+    },
+    {
+      { 0x11fc69656571f2d3, -0x393617baacf18c86,
+        -0x1cc5185d2b01afcb, 0x01b9c7b62e6dd30b },
+      { -0x0c20d09bc5873f4e, 0x4c3e971ef22e027c,
+        -0x1382e3a1b63e4a5d, 0x2012c18f0922dd2d },
+      { -0x77f4aa1aa53762d7, 0x1483241f45a0a763,
+        0x3d36efdfc2e76c1f, 0x08af5b784e4bade8 }
+    },
+    {
+      { -0x1d8ceb2d7633d3b5, 0x4be4bd11a287178d,
+        0x18d528d6fa3364ce, 0x6423c1d5afd9826e },
+      { 0x283499dc881f2533, -0x62fada25886cdc4a,
+        -0x7685220498cbbe0c, 0x32b79d71163a168d },
+      { -0x337a072612034c96, 0x22bcc28f3746e5f9,
+        -0x1b621cc7061a2c33, 0x480a5efbc13e2dcc }
+    },
+    {
+      { -0x499eb31bbd31dde1, 0x6e199dcc4c053928,
+        0x663fb4a4dc1cbe03, 0x24b31d47691c8e06 },
+      { 0x0b51e70b01622071, 0x06b505cf8b1dafc5,
+        0x2c6bb061ef5aabcd, 0x47aa27600cb7bf31 },
+      { 0x2a541eedc015f8c3, 0x11a4fe7e7c693f7c,
+        -0x0f5099ecb15d872a, 0x545b585d14dda094 }
+    },
+    {
+      { 0x6204e4d0e3b321e1, 0x3baa637a28ff1e95,
+        0x0b0ccffd5b99bd9e, 0x4d22dc3e64c8d071 },
+      { 0x67bf275ea0d43a0f, -0x521971cbf7641142,
+        0x4289134cd479e72e, 0x0f62f9c332ba5454 },
+      { -0x034b9a7629c4a0c7, 0x5cae6a3f57cbcf61,
+        -0x01453d2d6ac505fb, 0x1c0fa01a36371436 }
+    }
+  },
+  {
+    {
+      { 0x69082b0e8c936a50, -0x06365fca3e253a4a,
+        0x6fb73e54c4dfb634, 0x4005419b1d2bc140 },
+      { -0x2d39fb49dd6bc201, -0x43734131bb304c60,
+        0x5d254ff397808678, 0x0fa3614f3b1ca6bf },
+      { -0x5ffc014246417d10, 0x2089c1af3a44ac90,
+        -0x07b6606ee6ab0572, 0x1fba218aef40ab42 }
+    },
+    {
+      { 0x4f3e57043e7b0194, -0x57e2c111f7255081,
+        -0x37c639546623210f, 0x6c535d13ff7761d5 },
+      { -0x54ab6bb705370ac2, -0x7e0917658459c8bf,
+        0x74fd6c7d6c2b5e01, 0x392e3acaa8c86e42 },
+      { 0x4cbd34e93e8a35af, 0x2e0781445887e816,
+        0x19319c76f29ab0ab, 0x25e17fe4d50ac13b }
+    },
+    {
+      { -0x6ea0800a890ede59, -0x3cb5cdd8d032781d,
+        -0x3345d021b2e41ada, 0x6bba828f8969899b },
+      { 0x0a289bd71e04f676, 0x208e1c52d6420f95,
+        0x5186d8b034691fab, 0x255751442a9fb351 },
+      { -0x1d2e43996f01c6ff, 0x4cb54a18a0997ad5,
+        -0x68e296eb507b9f2c, 0x559d504f7f6b7be4 }
+    },
+    {
+      { -0x63b76e18092d9903, 0x0744a19b0307781b,
+        -0x77c770e29f9e1dc5, 0x123ea6a3354bd50e },
+      { -0x588c7c874c14ab2b, 0x1d69d366a5553c7c,
+        0x0a26cf62f92800ba, 0x01ab12d5807e3217 },
+      { 0x118d189041e32d96, -0x46121c3d27cea7b8,
+        0x1eab4271d83245d9, 0x4a3961e2c918a154 }
+    },
+    {
+      { 0x0327d644f3233f1e, 0x499a260e34fcf016,
+        -0x7c4a58e90d254687, 0x68aceead9bd4111f },
+      { 0x71dc3be0f8e6bba0, -0x293107cb81001cf6,
+        -0x566dbda01ec5b896, 0x2cd6bce3fb1db763 },
+      { 0x38b4c90ef3d7c210, 0x308e6e24b7ad040c,
+        0x3860d9f1b7e73e23, 0x595760d5b508f597 }
+    },
+    {
+      { -0x77d5341402fdd870, -0x7650ccfa3beea8a0,
+        0x65f492e37d3473f4, 0x2cb2c5df54515a2b },
+      { 0x6129bfe104aa6397, -0x7069fff75b580335,
+        0x3f8bc0897d909458, 0x709fa43edcb291a9 },
+      { -0x14f5a2739c02d536, -0x2dd43e99d196b101,
+        0x2723f36ef8cbb03a, 0x70f029ecf0c8131f }
+    },
+    {
+      { 0x2a6aafaa5e10b0b9, 0x78f0a370ef041aa9,
+        0x773efb77aa3ad61f, 0x44eca5a2a74bd9e1 },
+      { 0x461307b32eed3e33, -0x51fbd0cc5baa7e19,
+        -0x36bbb62ce6a0fc9a, 0x0b7d5d8a6c314858 },
+      { 0x25d448327b95d543, 0x70d38300a3340f1d,
+        -0x21e3ace39f1e3ad5, 0x272224512c7de9e4 }
+    },
+    {
+      { -0x40844475bd568a04, -0x73a3c68869525ca8,
+        -0x1d803890321255b8, 0x19735fd7f6bc20a6 },
+      { 0x1abc92af49c5342e, -0x001127ee4d190530,
+        -0x105d73720337b1d7, 0x11b5df18a44cc543 },
+      { -0x1c546f2fbd37bd9a, -0x147b71f080e6ab82,
+        0x2503a1d065a497b9, 0x0fef911191df895f }
+    }
+  }
+};
+
+/* Bi[i] = (2*i+1)*B */
+static const ge_precomp Bi[8] = {
+  {
+    { 0x2fbc93c6f58c3b85, -0x306cd2390473f1e7,
+      0x270b4898643d42c2, 0x07cf9d3a33d4ba65 },
+    { -0x62efc6fa28bf6ec2, -0x02c660fa2ebf414d,
+      -0x5a3e7bcb977075f7, 0x44fd2f9298f81267 },
+    { -0x5436edfa78855598, 0x26d9e823ccaac49e,
+      0x5a1b7dcbdd43598c, 0x6f117b689f0c65a8 }
+  },
+  {
+    { -0x50da4f57b31168d0, 0x025a8430e8864b8a,
+      -0x3ee4affd60fe98ce, 0x7a164e1b9a80f8f4 },
+    { 0x56611fe8a4fcd265, 0x3bd353fde5c1ba7d,
+      -0x7ece0ce5deb42943, 0x2ab91587555bda62 },
+    { 0x14ae933f0dd0d889, 0x589423221c35da62,
+      -0x2e8f1aba730d24b4, 0x5a2826af12b9b4c6 }
+  },
+  {
+    { -0x5ded43bbf75a44cd, -0x72afb73c38a112fe,
+      -0x22e414f3a54013bc, 0x2945ccf146e206eb },
+    { 0x7f9182c3a447d6ba, -0x2affeb2eb4d8d649,
+      -0x1cc30ee3479b5f79, 0x154a7e73eb1b55f3 },
+    { -0x4344240e7ed57d7b, 0x270e0807d0bdd1fc,
+      -0x4be498f4e44258d3, 0x43aabe696b3bb69a }
+  },
+  {
+    { 0x6b1a5cd0944ea3bf, 0x7470353ab39dc0d2,
+      0x71b2528228542e49, 0x461bea69283c927e },
+    { -0x4590d36555cdde4f, 0x6ca021533bba23a7,
+      -0x621589b06de6d3c6, 0x1d6edd5d2e5317e0 },
+    { -0x0e7c9237fe474c5e, -0x4cfca0b8fac15b66,
+      0x529c41ba5877adf3, 0x7a9fbb1c6a0f90a7 }
+  },
+  {
+    { -0x64d1987559579cd1, -0x59af6190ae43b93b,
+      -0x314dcc3639790a4b, 0x34b9ed338add7f59 },
+    { -0x0c91de81fc627f9c, -0x675f7e490adfbe65,
+      -0x693439f718a14fbc, 0x49c05a51fadc9c8f },
+    { 0x06b4e8bf9045af1b, -0x1d007c1758e62dd1,
+      -0x550903d66c2b30ea, 0x73c172021b008b06 }
+  },
+  {
+    { 0x2fbf00848a802ade, -0x1a260130fdcfd1d9,
+      0x113e847117703406, 0x4275aae2546d8faf },
+    { 0x315f5b0249864348, 0x3ed6b36977088381,
+      -0x5c5f8aaa9572146b, 0x18ab598029d5c77f },
+    { -0x27d4d33a029f7617, 0x031eb4a13282e4a4,
+      0x44311199b51a8622, 0x3dc65522b53df948 }
+  },
+  {
+    { -0x408f3ddd5dff8093, -0x407b4c654a432125,
+      0x537a0e12fb07ba07, 0x234fd7eec346f241 },
+    { 0x506f013b327fbf93, -0x5103143664889095,
+      -0x62ed4dcd5552a698, 0x0267882d176024a7 },
+    { 0x5360a119732ea378, 0x2437e6b1df8dd471,
+      -0x5d10c8076e581acd, 0x497ba6fdaa097863 }
+  },
+  {
+    { 0x24cecc0313cfeaa0, -0x79b73d72e763db93,
+      0x2dbdbdfac1f2d4d0, 0x61e22917f12de72b },
+    { 0x040bcd86468ccf0b, -0x2c7d645bd566ef2a,
+      0x7508300807b25192, 0x43b5cd4218d05ebf },
+    { 0x5d9a762f9bd0b516, -0x14c750b1c8c02112,
+      0x032e5a7d93d64270, 0x511d61210ae4d842 }
+  }
+};
+#else
+/* d */
+static const ge d = { 0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029,
+                      0x739c663a03cbb, 0x52036cee2b6ff };
+
+/* 2 * d */
+static const ge d2 = { 0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052,
+                       0x6738cc7407977, 0x2406d9dc56dff };
+
+/* sqrt(-1) */
+static const ge sqrtm1 = { 0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60,
+                           0x78595a6804c9e, 0x2b8324804fc1d };
+
+
+/* base[i][j] = (j+1)*256^i*B */
+static const ge_precomp base[32][8] = {
+  {
+    {
+      { 0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7,
+        0x5329385a44c32, 0x07cf9d3a33d4b },
+      { 0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c,
+        0x133d2e0c21a34, 0x44fd2f9298f81 },
+      { 0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0,
+        0x2d42d0dbee5ee, 0x6f117b689f0c6 }
+    },
+    {
+      { 0x4e7fc933c71d7, 0x2cf41feb6b244, 0x7581c0a7d1a76,
+        0x7172d534d32f0, 0x590c063fa87d2 },
+      { 0x1a56042b4d5a8, 0x189cc159ed153, 0x5b8deaa3cae04,
+        0x2aaf04f11b5d8, 0x6bb595a669c92 },
+      { 0x2a8b3a59b7a5f, 0x3abb359ef087f, 0x4f5a8c4db05af,
+        0x5b9a807d04205, 0x701af5b13ea50 }
+    },
+    {
+      { 0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10,
+        0x47a608da8014f, 0x7a164e1b9a80f },
+      { 0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f,
+        0x5314098f98d10, 0x2ab91587555bd },
+      { 0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c,
+        0x26368b872a2c6, 0x5a2826af12b9b }
+    },
+    {
+      { 0x351b98efc099f, 0x68fbfa4a7050e, 0x42a49959d971b,
+        0x393e51a469efd, 0x680e910321e58 },
+      { 0x6050a056818bf, 0x62acc1f5532bf, 0x28141ccc9fa25,
+        0x24d61f471e683, 0x27933f4c7445a },
+      { 0x3fbe9c476ff09, 0x0af6b982e4b42, 0x0ad1251ba78e5,
+        0x715aeedee7c88, 0x7f9d0cbf63553 }
+    },
+    {
+      { 0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123,
+        0x375ee8df5862d, 0x2945ccf146e20 },
+      { 0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053,
+        0x2f9f19e788e5c, 0x154a7e73eb1b5 },
+      { 0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820,
+        0x34d5a0db3858d, 0x43aabe696b3bb }
+    },
+    {
+      { 0x4eeeb77157131, 0x1201915f10741, 0x1669cda6c9c56,
+        0x45ec032db346d, 0x51e57bb6a2cc3 },
+      { 0x006b67b7d8ca4, 0x084fa44e72933, 0x1154ee55d6f8a,
+        0x4425d842e7390, 0x38b64c41ae417 },
+      { 0x4326702ea4b71, 0x06834376030b5, 0x0ef0512f9c380,
+        0x0f1a9f2512584, 0x10b8e91a9f0d6 }
+    },
+    {
+      { 0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4,
+        0x13f38d9294114, 0x461bea69283c9 },
+      { 0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085,
+        0x3f04ef53b27c9, 0x1d6edd5d2e531 },
+      { 0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d,
+        0x053a94e20dd2c, 0x7a9fbb1c6a0f9 }
+    },
+    {
+      { 0x7596604dd3e8f, 0x6fc510e058b36, 0x3670c8db2cc0d,
+        0x297d899ce332f, 0x0915e76061bce },
+      { 0x75dedf39234d9, 0x01c36ab1f3c54, 0x0f08fee58f5da,
+        0x0e19613a0d637, 0x3a9024a1320e0 },
+      { 0x1f5d9c9a2911a, 0x7117994fafcf8, 0x2d8a8cae28dc5,
+        0x74ab1b2090c87, 0x26907c5c2ecc4 }
+    }
+  },
+  {
+    {
+      { 0x4dd0e632f9c1d, 0x2ced12622a5d9, 0x18de9614742da,
+        0x79ca96fdbb5d4, 0x6dd37d49a00ee },
+      { 0x3635449aa515e, 0x3e178d0475dab, 0x50b4712a19712,
+        0x2dcc2860ff4ad, 0x30d76d6f03d31 },
+      { 0x444172106e4c7, 0x01251afed2d88, 0x534fc9bed4f5a,
+        0x5d85a39cf5234, 0x10c697112e864 }
+    },
+    {
+      { 0x62aa08358c805, 0x46f440848e194, 0x447b771a8f52b,
+        0x377ba3269d31d, 0x03bf9baf55080 },
+      { 0x3c4277dbe5fde, 0x5a335afd44c92, 0x0c1164099753e,
+        0x70487006fe423, 0x25e61cabed66f },
+      { 0x3e128cc586604, 0x5968b2e8fc7e2, 0x049a3d5bd61cf,
+        0x116505b1ef6e6, 0x566d78634586e }
+    },
+    {
+      { 0x54285c65a2fd0, 0x55e62ccf87420, 0x46bb961b19044,
+        0x1153405712039, 0x14fba5f34793b },
+      { 0x7a49f9cc10834, 0x2b513788a22c6, 0x5ff4b6ef2395b,
+        0x2ec8e5af607bf, 0x33975bca5ecc3 },
+      { 0x746166985f7d4, 0x09939000ae79a, 0x5844c7964f97a,
+        0x13617e1f95b3d, 0x14829cea83fc5 }
+    },
+    {
+      { 0x70b2f4e71ecb8, 0x728148efc643c, 0x0753e03995b76,
+        0x5bf5fb2ab6767, 0x05fc3bc4535d7 },
+      { 0x37b8497dd95c2, 0x61549d6b4ffe8, 0x217a22db1d138,
+        0x0b9cf062eb09e, 0x2fd9c71e5f758 },
+      { 0x0b3ae52afdedd, 0x19da76619e497, 0x6fa0654d2558e,
+        0x78219d25e41d4, 0x373767475c651 }
+    },
+    {
+      { 0x095cb14246590, 0x002d82aa6ac68, 0x442f183bc4851,
+        0x6464f1c0a0644, 0x6bf5905730907 },
+      { 0x299fd40d1add9, 0x5f2de9a04e5f7, 0x7c0eebacc1c59,
+        0x4cca1b1f8290a, 0x1fbea56c3b18f },
+      { 0x778f1e1415b8a, 0x6f75874efc1f4, 0x28a694019027f,
+        0x52b37a96bdc4d, 0x02521cf67a635 }
+    },
+    {
+      { 0x46720772f5ee4, 0x632c0f359d622, 0x2b2092ba3e252,
+        0x662257c112680, 0x001753d9f7cd6 },
+      { 0x7ee0b0a9d5294, 0x381fbeb4cca27, 0x7841f3a3e639d,
+        0x676ea30c3445f, 0x3fa00a7e71382 },
+      { 0x1232d963ddb34, 0x35692e70b078d, 0x247ca14777a1f,
+        0x6db556be8fcd0, 0x12b5fe2fa048e }
+    },
+    {
+      { 0x37c26ad6f1e92, 0x46a0971227be5, 0x4722f0d2d9b4c,
+        0x3dc46204ee03a, 0x6f7e93c20796c },
+      { 0x0fbc496fce34d, 0x575be6b7dae3e, 0x4a31585cee609,
+        0x037e9023930ff, 0x749b76f96fb12 },
+      { 0x2f604aea6ae05, 0x637dc939323eb, 0x3fdad9b048d47,
+        0x0a8b0d4045af7, 0x0fcec10f01e02 }
+    },
+    {
+      { 0x2d29dc4244e45, 0x6927b1bc147be, 0x0308534ac0839,
+        0x4853664033f41, 0x413779166feab },
+      { 0x558a649fe1e44, 0x44635aeefcc89, 0x1ff434887f2ba,
+        0x0f981220e2d44, 0x4901aa7183c51 },
+      { 0x1b7548c1af8f0, 0x7848c53368116, 0x01b64e7383de9,
+        0x109fbb0587c8f, 0x41bb887b726d1 }
+    }
+  },
+  {
+    {
+      { 0x34c597c6691ae, 0x7a150b6990fc4, 0x52beb9d922274,
+        0x70eed7164861a, 0x0a871e070c6a9 },
+      { 0x07d44744346be, 0x282b6a564a81d, 0x4ed80f875236b,
+        0x6fbbe1d450c50, 0x4eb728c12fcdb },
+      { 0x1b5994bbc8989, 0x74b7ba84c0660, 0x75678f1cdaeb8,
+        0x23206b0d6f10c, 0x3ee7300f2685d }
+    },
+    {
+      { 0x27947841e7518, 0x32c7388dae87f, 0x414add3971be9,
+        0x01850832f0ef1, 0x7d47c6a2cfb89 },
+      { 0x255e49e7dd6b7, 0x38c2163d59eba, 0x3861f2a005845,
+        0x2e11e4ccbaec9, 0x1381576297912 },
+      { 0x2d0148ef0d6e0, 0x3522a8de787fb, 0x2ee055e74f9d2,
+        0x64038f6310813, 0x148cf58d34c9e }
+    },
+    {
+      { 0x72f7d9ae4756d, 0x7711e690ffc4a, 0x582a2355b0d16,
+        0x0dccfe885b6b4, 0x278febad4eaea },
+      { 0x492f67934f027, 0x7ded0815528d4, 0x58461511a6612,
+        0x5ea2e50de1544, 0x3ff2fa1ebd5db },
+      { 0x2681f8c933966, 0x3840521931635, 0x674f14a308652,
+        0x3bd9c88a94890, 0x4104dd02fe9c6 }
+    },
+    {
+      { 0x14e06db096ab8, 0x1219c89e6b024, 0x278abd486a2db,
+        0x240b292609520, 0x0165b5a48efca },
+      { 0x2bf5e1124422a, 0x673146756ae56, 0x14ad99a87e830,
+        0x1eaca65b080fd, 0x2c863b00afaf5 },
+      { 0x0a474a0846a76, 0x099a5ef981e32, 0x2a8ae3c4bbfe6,
+        0x45c34af14832c, 0x591b67d9bffec }
+    },
+    {
+      { 0x1b3719f18b55d, 0x754318c83d337, 0x27c17b7919797,
+        0x145b084089b61, 0x489b4f8670301 },
+      { 0x70d1c80b49bfa, 0x3d57e7d914625, 0x3c0722165e545,
+        0x5e5b93819e04f, 0x3de02ec7ca8f7 },
+      { 0x2102d3aeb92ef, 0x68c22d50c3a46, 0x42ea89385894e,
+        0x75f9ebf55f38c, 0x49f5fbba496cb }
+    },
+    {
+      { 0x5628c1e9c572e, 0x598b108e822ab, 0x55d8fae29361a,
+        0x0adc8d1a97b28, 0x06a1a6c288675 },
+      { 0x49a108a5bcfd4, 0x6178c8e7d6612, 0x1f03473710375,
+        0x73a49614a6098, 0x5604a86dcbfa6 },
+      { 0x0d1d47c1764b6, 0x01c08316a2e51, 0x2b3db45c95045,
+        0x1634f818d300c, 0x20989e89fe274 }
+    },
+    {
+      { 0x4278b85eaec2e, 0x0ef59657be2ce, 0x72fd169588770,
+        0x2e9b205260b30, 0x730b9950f7059 },
+      { 0x777fd3a2dcc7f, 0x594a9fb124932, 0x01f8e80ca15f0,
+        0x714d13cec3269, 0x0403ed1d0ca67 },
+      { 0x32d35874ec552, 0x1f3048df1b929, 0x300d73b179b23,
+        0x6e67be5a37d0b, 0x5bd7454308303 }
+    },
+    {
+      { 0x4932115e7792a, 0x457b9bbb930b8, 0x68f5d8b193226,
+        0x4164e8f1ed456, 0x5bb7db123067f },
+      { 0x2d19528b24cc2, 0x4ac66b8302ff3, 0x701c8d9fdad51,
+        0x6c1b35c5b3727, 0x133a78007380a },
+      { 0x1f467c6ca62be, 0x2c4232a5dc12c, 0x7551dc013b087,
+        0x0690c11b03bcd, 0x740dca6d58f0e }
+    }
+  },
+  {
+    {
+      { 0x28c570478433c, 0x1d8502873a463, 0x7641e7eded49c,
+        0x1ecedd54cf571, 0x2c03f5256c2b0 },
+      { 0x0ee0752cfce4e, 0x660dd8116fbe9, 0x55167130fffeb,
+        0x1c682b885955c, 0x161d25fa963ea },
+      { 0x718757b53a47d, 0x619e18b0f2f21, 0x5fbdfe4c1ec04,
+        0x5d798c81ebb92, 0x699468bdbd96b }
+    },
+    {
+      { 0x53de66aa91948, 0x045f81a599b1b, 0x3f7a8bd214193,
+        0x71d4da412331a, 0x293e1c4e6c4a2 },
+      { 0x72f46f4dafecf, 0x2948ffadef7a3, 0x11ecdfdf3bc04,
+        0x3c2e98ffeed25, 0x525219a473905 },
+      { 0x6134b925112e1, 0x6bb942bb406ed, 0x070c445c0dde2,
+        0x411d822c4d7a3, 0x5b605c447f032 }
+    },
+    {
+      { 0x1fec6f0e7f04c, 0x3cebc692c477d, 0x077986a19a95e,
+        0x6eaaaa1778b0f, 0x2f12fef4cc5ab },
+      { 0x5805920c47c89, 0x1924771f9972c, 0x38bbddf9fc040,
+        0x1f7000092b281, 0x24a76dcea8aeb },
+      { 0x522b2dfc0c740, 0x7e8193480e148, 0x33fd9a04341b9,
+        0x3c863678a20bc, 0x5e607b2518a43 }
+    },
+    {
+      { 0x4431ca596cf14, 0x015da7c801405, 0x03c9b6f8f10b5,
+        0x0346922934017, 0x201f33139e457 },
+      { 0x31d8f6cdf1818, 0x1f86c4b144b16, 0x39875b8d73e9d,
+        0x2fbf0d9ffa7b3, 0x5067acab6ccdd },
+      { 0x27f6b08039d51, 0x4802f8000dfaa, 0x09692a062c525,
+        0x1baea91075817, 0x397cba8862460 }
+    },
+    {
+      { 0x5c3fbc81379e7, 0x41bbc255e2f02, 0x6a3f756998650,
+        0x1297fd4e07c42, 0x771b4022c1e1c },
+      { 0x13093f05959b2, 0x1bd352f2ec618, 0x075789b88ea86,
+        0x61d1117ea48b9, 0x2339d320766e6 },
+      { 0x5d986513a2fa7, 0x63f3a99e11b0f, 0x28a0ecfd6b26d,
+        0x53b6835e18d8f, 0x331a189219971 }
+    },
+    {
+      { 0x12f3a9d7572af, 0x10d00e953c4ca, 0x603df116f2f8a,
+        0x33dc276e0e088, 0x1ac9619ff649a },
+      { 0x66f45fb4f80c6, 0x3cc38eeb9fea2, 0x107647270db1f,
+        0x710f1ea740dc8, 0x31167c6b83bdf },
+      { 0x33842524b1068, 0x77dd39d30fe45, 0x189432141a0d0,
+        0x088fe4eb8c225, 0x612436341f08b }
+    },
+    {
+      { 0x349e31a2d2638, 0x0137a7fa6b16c, 0x681ae92777edc,
+        0x222bfc5f8dc51, 0x1522aa3178d90 },
+      { 0x541db874e898d, 0x62d80fb841b33, 0x03e6ef027fa97,
+        0x7a03c9e9633e8, 0x46ebe2309e5ef },
+      { 0x02f5369614938, 0x356e5ada20587, 0x11bc89f6bf902,
+        0x036746419c8db, 0x45fe70f505243 }
+    },
+    {
+      { 0x24920c8951491, 0x107ec61944c5e, 0x72752e017c01f,
+        0x122b7dda2e97a, 0x16619f6db57a2 },
+      { 0x075a6960c0b8c, 0x6dde1c5e41b49, 0x42e3f516da341,
+        0x16a03fda8e79e, 0x428d1623a0e39 },
+      { 0x74a4401a308fd, 0x06ed4b9558109, 0x746f1f6a08867,
+        0x4636f5c6f2321, 0x1d81592d60bd3 }
+    }
+  },
+  {
+    {
+      { 0x5b69f7b85c5e8, 0x17a2d175650ec, 0x4cc3e6dbfc19e,
+        0x73e1d3873be0e, 0x3a5f6d51b0af8 },
+      { 0x68756a60dac5f, 0x55d757b8aec26, 0x3383df45f80bd,
+        0x6783f8c9f96a6, 0x20234a7789ecd },
+      { 0x20db67178b252, 0x73aa3da2c0eda, 0x79045c01c70d3,
+        0x1b37b15251059, 0x7cd682353cffe }
+    },
+    {
+      { 0x5cd6068acf4f3, 0x3079afc7a74cc, 0x58097650b64b4,
+        0x47fabac9c4e99, 0x3ef0253b2b2cd },
+      { 0x1a45bd887fab6, 0x65748076dc17c, 0x5b98000aa11a8,
+        0x4a1ecc9080974, 0x2838c8863bdc0 },
+      { 0x3b0cf4a465030, 0x022b8aef57a2d, 0x2ad0677e925ad,
+        0x4094167d7457a, 0x21dcb8a606a82 }
+    },
+    {
+      { 0x500fabe7731ba, 0x7cc53c3113351, 0x7cf65fe080d81,
+        0x3c5d966011ba1, 0x5d840dbf6c6f6 },
+      { 0x004468c9d9fc8, 0x5da8554796b8c, 0x3b8be70950025,
+        0x6d5892da6a609, 0x0bc3d08194a31 },
+      { 0x6380d309fe18b, 0x4d73c2cb8ee0d, 0x6b882adbac0b6,
+        0x36eabdddd4cbe, 0x3a4276232ac19 }
+    },
+    {
+      { 0x0c172db447ecb, 0x3f8c505b7a77f, 0x6a857f97f3f10,
+        0x4fcc0567fe03a, 0x0770c9e824e1a },
+      { 0x2432c8a7084fa, 0x47bf73ca8a968, 0x1639176262867,
+        0x5e8df4f8010ce, 0x1ff177cea16de },
+      { 0x1d99a45b5b5fd, 0x523674f2499ec, 0x0f8fa26182613,
+        0x58f7398048c98, 0x39f264fd41500 }
+    },
+    {
+      { 0x34aabfe097be1, 0x43bfc03253a33, 0x29bc7fe91b7f3,
+        0x0a761e4844a16, 0x65c621272c35f },
+      { 0x53417dbe7e29c, 0x54573827394f5, 0x565eea6f650dd,
+        0x42050748dc749, 0x1712d73468889 },
+      { 0x389f8ce3193dd, 0x2d424b8177ce5, 0x073fa0d3440cd,
+        0x139020cd49e97, 0x22f9800ab19ce }
+    },
+    {
+      { 0x29fdd9a6efdac, 0x7c694a9282840, 0x6f7cdeee44b3a,
+        0x55a3207b25cc3, 0x4171a4d38598c },
+      { 0x2368a3e9ef8cb, 0x454aa08e2ac0b, 0x490923f8fa700,
+        0x372aa9ea4582f, 0x13f416cd64762 },
+      { 0x758aa99c94c8c, 0x5f6001700ff44, 0x7694e488c01bd,
+        0x0d5fde948eed6, 0x508214fa574bd }
+    },
+    {
+      { 0x215bb53d003d6, 0x1179e792ca8c3, 0x1a0e96ac840a2,
+        0x22393e2bb3ab6, 0x3a7758a4c86cb },
+      { 0x269153ed6fe4b, 0x72a23aef89840, 0x052be5299699c,
+        0x3a5e5ef132316, 0x22f960ec6faba },
+      { 0x111f693ae5076, 0x3e3bfaa94ca90, 0x445799476b887,
+        0x24a0912464879, 0x5d9fd15f8de7f }
+    },
+    {
+      { 0x44d2aeed7521e, 0x50865d2c2a7e4, 0x2705b5238ea40,
+        0x46c70b25d3b97, 0x3bc187fa47eb9 },
+      { 0x408d36d63727f, 0x5faf8f6a66062, 0x2bb892da8de6b,
+        0x769d4f0c7e2e6, 0x332f35914f8fb },
+      { 0x70115ea86c20c, 0x16d88da24ada8, 0x1980622662adf,
+        0x501ebbc195a9d, 0x450d81ce906fb }
+    }
+  },
+  {
+    {
+      { 0x4d8961cae743f, 0x6bdc38c7dba0e, 0x7d3b4a7e1b463,
+        0x0844bdee2adf3, 0x4cbad279663ab },
+      { 0x3b6a1a6205275, 0x2e82791d06dcf, 0x23d72caa93c87,
+        0x5f0b7ab68aaf4, 0x2de25d4ba6345 },
+      { 0x19024a0d71fcd, 0x15f65115f101a, 0x4e99067149708,
+        0x119d8d1cba5af, 0x7d7fbcefe2007 }
+    },
+    {
+      { 0x45dc5f3c29094, 0x3455220b579af, 0x070c1631e068a,
+        0x26bc0630e9b21, 0x4f9cd196dcd8d },
+      { 0x71e6a266b2801, 0x09aae73e2df5d, 0x40dd8b219b1a3,
+        0x546fb4517de0d, 0x5975435e87b75 },
+      { 0x297d86a7b3768, 0x4835a2f4c6332, 0x070305f434160,
+        0x183dd014e56ae, 0x7ccdd084387a0 }
+    },
+    {
+      { 0x484186760cc93, 0x7435665533361, 0x02f686336b801,
+        0x5225446f64331, 0x3593ca848190c },
+      { 0x6422c6d260417, 0x212904817bb94, 0x5a319deb854f5,
+        0x7a9d4e060da7d, 0x428bd0ed61d0c },
+      { 0x3189a5e849aa7, 0x6acbb1f59b242, 0x7f6ef4753630c,
+        0x1f346292a2da9, 0x27398308da2d6 }
+    },
+    {
+      { 0x10e4c0a702453, 0x4daafa37bd734, 0x49f6bdc3e8961,
+        0x1feffdcecdae6, 0x572c2945492c3 },
+      { 0x38d28435ed413, 0x4064f19992858, 0x7680fbef543cd,
+        0x1aadd83d58d3c, 0x269597aebe8c3 },
+      { 0x7c745d6cd30be, 0x27c7755df78ef, 0x1776833937fa3,
+        0x5405116441855, 0x7f985498c05bc }
+    },
+    {
+      { 0x615520fbf6363, 0x0b9e9bf74da6a, 0x4fe8308201169,
+        0x173f76127de43, 0x30f2653cd69b1 },
+      { 0x1ce889f0be117, 0x36f6a94510709, 0x7f248720016b4,
+        0x1821ed1e1cf91, 0x76c2ec470a31f },
+      { 0x0c938aac10c85, 0x41b64ed797141, 0x1beb1c1185e6d,
+        0x1ed5490600f07, 0x2f1273f159647 }
+    },
+    {
+      { 0x08bd755a70bc0, 0x49e3a885ce609, 0x16585881b5ad6,
+        0x3c27568d34f5e, 0x38ac1997edc5f },
+      { 0x1fc7c8ae01e11, 0x2094d5573e8e7, 0x5ca3cbbf549d2,
+        0x4f920ecc54143, 0x5d9e572ad85b6 },
+      { 0x6b517a751b13b, 0x0cfd370b180cc, 0x5377925d1f41a,
+        0x34e56566008a2, 0x22dfcd9cbfe9e }
+    },
+    {
+      { 0x459b4103be0a1, 0x59a4b3f2d2add, 0x7d734c8bb8eeb,
+        0x2393cbe594a09, 0x0fe9877824cde },
+      { 0x3d2e0c30d0cd9, 0x3f597686671bb, 0x0aa587eb63999,
+        0x0e3c7b592c619, 0x6b2916c05448c },
+      { 0x334d10aba913b, 0x045cdb581cfdb, 0x5e3e0553a8f36,
+        0x50bb3041effb2, 0x4c303f307ff00 }
+    },
+    {
+      { 0x403580dd94500, 0x48df77d92653f, 0x38a9fe3b349ea,
+        0x0ea89850aafe1, 0x416b151ab706a },
+      { 0x23bd617b28c85, 0x6e72ee77d5a61, 0x1a972ff174dde,
+        0x3e2636373c60f, 0x0d61b8f78b2ab },
+      { 0x0d7efe9c136b0, 0x1ab1c89640ad5, 0x55f82aef41f97,
+        0x46957f317ed0d, 0x191a2af74277e }
+    }
+  },
+  {
+    {
+      { 0x62b434f460efb, 0x294c6c0fad3fc, 0x68368937b4c0f,
+        0x5c9f82910875b, 0x237e7dbe00545 },
+      { 0x6f74bc53c1431, 0x1c40e5dbbd9c2, 0x6c8fb9cae5c97,
+        0x4845c5ce1b7da, 0x7e2e0e450b5cc },
+      { 0x575ed6701b430, 0x4d3e17fa20026, 0x791fc888c4253,
+        0x2f1ba99078ac1, 0x71afa699b1115 }
+    },
+    {
+      { 0x23c1c473b50d6, 0x3e7671de21d48, 0x326fa5547a1e8,
+        0x50e4dc25fafd9, 0x00731fbc78f89 },
+      { 0x66f9b3953b61d, 0x555f4283cccb9, 0x7dd67fb1960e7,
+        0x14707a1affed4, 0x021142e9c2b1c },
+      { 0x0c71848f81880, 0x44bd9d8233c86, 0x6e8578efe5830,
+        0x4045b6d7041b5, 0x4c4d6f3347e15 }
+    },
+    {
+      { 0x4ddfc988f1970, 0x4f6173ea365e1, 0x645daf9ae4588,
+        0x7d43763db623b, 0x38bf9500a88f9 },
+      { 0x7eccfc17d1fc9, 0x4ca280782831e, 0x7b8337db1d7d6,
+        0x5116def3895fb, 0x193fddaaa7e47 },
+      { 0x2c93c37e8876f, 0x3431a28c583fa, 0x49049da8bd879,
+        0x4b4a8407ac11c, 0x6a6fb99ebf0d4 }
+    },
+    {
+      { 0x122b5b6e423c6, 0x21e50dff1ddd6, 0x73d76324e75c0,
+        0x588485495418e, 0x136fda9f42c5e },
+      { 0x6c1bb560855eb, 0x71f127e13ad48, 0x5c6b304905aec,
+        0x3756b8e889bc7, 0x75f76914a3189 },
+      { 0x4dfb1a305bdd1, 0x3b3ff05811f29, 0x6ed62283cd92e,
+        0x65d1543ec52e1, 0x022183510be8d }
+    },
+    {
+      { 0x2710143307a7f, 0x3d88fb48bf3ab, 0x249eb4ec18f7a,
+        0x136115dff295f, 0x1387c441fd404 },
+      { 0x766385ead2d14, 0x0194f8b06095e, 0x08478f6823b62,
+        0x6018689d37308, 0x6a071ce17b806 },
+      { 0x3c3d187978af8, 0x7afe1c88276ba, 0x51df281c8ad68,
+        0x64906bda4245d, 0x3171b26aaf1ed }
+    },
+    {
+      { 0x5b7d8b28a47d1, 0x2c2ee149e34c1, 0x776f5629afc53,
+        0x1f4ea50fc49a9, 0x6c514a6334424 },
+      { 0x7319097564ca8, 0x1844ebc233525, 0x21d4543fdeee1,
+        0x1ad27aaff1bd2, 0x221fd4873cf08 },
+      { 0x2204f3a156341, 0x537414065a464, 0x43c0c3bedcf83,
+        0x5557e706ea620, 0x48daa596fb924 }
+    },
+    {
+      { 0x61d5dc84c9793, 0x47de83040c29e, 0x189deb26507e7,
+        0x4d4e6fadc479a, 0x58c837fa0e8a7 },
+      { 0x28e665ca59cc7, 0x165c715940dd9, 0x0785f3aa11c95,
+        0x57b98d7e38469, 0x676dd6fccad84 },
+      { 0x1688596fc9058, 0x66f6ad403619f, 0x4d759a87772ef,
+        0x7856e6173bea4, 0x1c4f73f2c6a57 }
+    },
+    {
+      { 0x6706efc7c3484, 0x6987839ec366d, 0x0731f95cf7f26,
+        0x3ae758ebce4bc, 0x70459adb7daf6 },
+      { 0x24fbd305fa0bb, 0x40a98cc75a1cf, 0x78ce1220a7533,
+        0x6217a10e1c197, 0x795ac80d1bf64 },
+      { 0x1db4991b42bb3, 0x469605b994372, 0x631e3715c9a58,
+        0x7e9cfefcf728f, 0x5fe162848ce21 }
+    }
+  },
+  {
+    {
+      { 0x1852d5d7cb208, 0x60d0fbe5ce50f, 0x5a1e246e37b75,
+        0x51aee05ffd590, 0x2b44c043677da },
+      { 0x1214fe194961a, 0x0e1ae39a9e9cb, 0x543c8b526f9f7,
+        0x119498067e91d, 0x4789d446fc917 },
+      { 0x487ab074eb78e, 0x1d33b5e8ce343, 0x13e419feb1b46,
+        0x2721f565de6a4, 0x60c52eef2bb9a }
+    },
+    {
+      { 0x3c5c27cae6d11, 0x36a9491956e05, 0x124bac9131da6,
+        0x3b6f7de202b5d, 0x70d77248d9b66 },
+      { 0x589bc3bfd8bf1, 0x6f93e6aa3416b, 0x4c0a3d6c1ae48,
+        0x55587260b586a, 0x10bc9c312ccfc },
+      { 0x2e84b3ec2a05b, 0x69da2f03c1551, 0x23a174661a67b,
+        0x209bca289f238, 0x63755bd3a976f }
+    },
+    {
+      { 0x7101897f1acb7, 0x3d82cb77b07b8, 0x684083d7769f5,
+        0x52b28472dce07, 0x2763751737c52 },
+      { 0x7a03e2ad10853, 0x213dcc6ad36ab, 0x1a6e240d5bdd6,
+        0x7c24ffcf8fedf, 0x0d8cc1c48bc16 },
+      { 0x402d36eb419a9, 0x7cef68c14a052, 0x0f1255bc2d139,
+        0x373e7d431186a, 0x70c2dd8a7ad16 }
+    },
+    {
+      { 0x4967db8ed7e13, 0x15aeed02f523a, 0x6149591d094bc,
+        0x672f204c17006, 0x32b8613816a53 },
+      { 0x194509f6fec0e, 0x528d8ca31acac, 0x7826d73b8b9fa,
+        0x24acb99e0f9b3, 0x2e0fac6363948 },
+      { 0x7f7bee448cd64, 0x4e10f10da0f3c, 0x3936cb9ab20e9,
+        0x7a0fc4fea6cd0, 0x4179215c735a4 }
+    },
+    {
+      { 0x633b9286bcd34, 0x6cab3badb9c95, 0x74e387edfbdfa,
+        0x14313c58a0fd9, 0x31fa85662241c },
+      { 0x094e7d7dced2a, 0x068fa738e118e, 0x41b640a5fee2b,
+        0x6bb709df019d4, 0x700344a30cd99 },
+      { 0x26c422e3622f4, 0x0f3066a05b5f0, 0x4e2448f0480a6,
+        0x244cde0dbf095, 0x24bb2312a9952 }
+    },
+    {
+      { 0x00c2af5f85c6b, 0x0609f4cf2883f, 0x6e86eb5a1ca13,
+        0x68b44a2efccd1, 0x0d1d2af9ffeb5 },
+      { 0x0ed1732de67c3, 0x308c369291635, 0x33ef348f2d250,
+        0x004475ea1a1bb, 0x0fee3e871e188 },
+      { 0x28aa132621edf, 0x42b244caf353b, 0x66b064cc2e08a,
+        0x6bb20020cbdd3, 0x16acd79718531 }
+    },
+    {
+      { 0x1c6c57887b6ad, 0x5abf21fd7592b, 0x50bd41253867a,
+        0x3800b71273151, 0x164ed34b18161 },
+      { 0x772af2d9b1d3d, 0x6d486448b4e5b, 0x2ce58dd8d18a8,
+        0x1849f67503c8b, 0x123e0ef6b9302 },
+      { 0x6d94c192fe69a, 0x5475222a2690f, 0x693789d86b8b3,
+        0x1f5c3bdfb69dc, 0x78da0fc61073f }
+    },
+    {
+      { 0x780f1680c3a94, 0x2a35d3cfcd453, 0x005e5cdc7ddf8,
+        0x6ee888078ac24, 0x054aa4b316b38 },
+      { 0x15d28e52bc66a, 0x30e1e0351cb7e, 0x30a2f74b11f8c,
+        0x39d120cd7de03, 0x2d25deeb256b1 },
+      { 0x0468d19267cb8, 0x38cdca9b5fbf9, 0x1bbb05c2ca1e2,
+        0x3b015758e9533, 0x134610a6ab7da }
+    }
+  },
+  {
+    {
+      { 0x265e777d1f515, 0x0f1f54c1e39a5, 0x2f01b95522646,
+        0x4fdd8db9dde6d, 0x654878cba97cc },
+      { 0x38ec78df6b0fe, 0x13caebea36a22, 0x5ebc6e54e5f6a,
+        0x32804903d0eb8, 0x2102fdba2b20d },
+      { 0x6e405055ce6a1, 0x5024a35a532d3, 0x1f69054daf29d,
+        0x15d1d0d7a8bd5, 0x0ad725db29ecb }
+    },
+    {
+      { 0x7bc0c9b056f85, 0x51cfebffaffd8, 0x44abbe94df549,
+        0x7ecbbd7e33121, 0x4f675f5302399 },
+      { 0x267b1834e2457, 0x6ae19c378bb88, 0x7457b5ed9d512,
+        0x3280d783d05fb, 0x4aefcffb71a03 },
+      { 0x536360415171e, 0x2313309077865, 0x251444334afbc,
+        0x2b0c3853756e8, 0x0bccbb72a2a86 }
+    },
+    {
+      { 0x55e4c50fe1296, 0x05fdd13efc30d, 0x1c0c6c380e5ee,
+        0x3e11de3fb62a8, 0x6678fd69108f3 },
+      { 0x6962feab1a9c8, 0x6aca28fb9a30b, 0x56db7ca1b9f98,
+        0x39f58497018dd, 0x4024f0ab59d6b },
+      { 0x6fa31636863c2, 0x10ae5a67e42b0, 0x27abbf01fda31,
+        0x380a7b9e64fbc, 0x2d42e2108ead4 }
+    },
+    {
+      { 0x17b0d0f537593, 0x16263c0c9842e, 0x4ab827e4539a4,
+        0x6370ddb43d73a, 0x420bf3a79b423 },
+      { 0x5131594dfd29b, 0x3a627e98d52fe, 0x1154041855661,
+        0x19175d09f8384, 0x676b2608b8d2d },
+      { 0x0ba651c5b2b47, 0x5862363701027, 0x0c4d6c219c6db,
+        0x0f03dff8658de, 0x745d2ffa9c0cf }
+    },
+    {
+      { 0x6df5721d34e6a, 0x4f32f767a0c06, 0x1d5abeac76e20,
+        0x41ce9e104e1e4, 0x06e15be54c1dc },
+      { 0x25a1e2bc9c8bd, 0x104c8f3b037ea, 0x405576fa96c98,
+        0x2e86a88e3876f, 0x1ae23ceb960cf },
+      { 0x25d871932994a, 0x6b9d63b560b6e, 0x2df2814c8d472,
+        0x0fbbee20aa4ed, 0x58ded861278ec }
+    },
+    {
+      { 0x35ba8b6c2c9a8, 0x1dea58b3185bf, 0x4b455cd23bbbe,
+        0x5ec19c04883f8, 0x08ba696b531d5 },
+      { 0x73793f266c55c, 0x0b988a9c93b02, 0x09b0ea32325db,
+        0x37cae71c17c5e, 0x2ff39de85485f },
+      { 0x53eeec3efc57a, 0x2fa9fe9022efd, 0x699c72c138154,
+        0x72a751ebd1ff8, 0x120633b4947cf }
+    },
+    {
+      { 0x531474912100a, 0x5afcdf7c0d057, 0x7a9e71b788ded,
+        0x5ef708f3b0c88, 0x07433be3cb393 },
+      { 0x4987891610042, 0x79d9d7f5d0172, 0x3c293013b9ec4,
+        0x0c2b85f39caca, 0x35d30a99b4d59 },
+      { 0x144c05ce997f4, 0x4960b8a347fef, 0x1da11f15d74f7,
+        0x54fac19c0fead, 0x2d873ede7af6d }
+    },
+    {
+      { 0x202e14e5df981, 0x2ea02bc3eb54c, 0x38875b2883564,
+        0x1298c513ae9dd, 0x0543618a01600 },
+      { 0x2316443373409, 0x5de95503b22af, 0x699201beae2df,
+        0x3db5849ff737a, 0x2e773654707fa },
+      { 0x2bdf4974c23c1, 0x4b3b9c8d261bd, 0x26ae8b2a9bc28,
+        0x3068210165c51, 0x4b1443362d079 }
+    }
+  },
+  {
+    {
+      { 0x454e91c529ccb, 0x24c98c6bf72cf, 0x0486594c3d89a,
+        0x7ae13a3d7fa3c, 0x17038418eaf66 },
+      { 0x4b7c7b66e1f7a, 0x4bea185efd998, 0x4fabc711055f8,
+        0x1fb9f7836fe38, 0x582f446752da6 },
+      { 0x17bd320324ce4, 0x51489117898c6, 0x1684d92a0410b,
+        0x6e4d90f78c5a7, 0x0c2a1c4bcda28 }
+    },
+    {
+      { 0x4814869bd6945, 0x7b7c391a45db8, 0x57316ac35b641,
+        0x641e31de9096a, 0x5a6a9b30a314d },
+      { 0x5c7d06f1f0447, 0x7db70f80b3a49, 0x6cb4a3ec89a78,
+        0x43be8ad81397d, 0x7c558bd1c6f64 },
+      { 0x41524d396463d, 0x1586b449e1a1d, 0x2f17e904aed8a,
+        0x7e1d2861d3c8e, 0x0404a5ca0afba }
+    },
+    {
+      { 0x49e1b2a416fd1, 0x51c6a0b316c57, 0x575a59ed71bdc,
+        0x74c021a1fec1e, 0x39527516e7f8e },
+      { 0x740070aa743d6, 0x16b64cbdd1183, 0x23f4b7b32eb43,
+        0x319aba58235b3, 0x46395bfdcadd9 },
+      { 0x7db2d1a5d9a9c, 0x79a200b85422f, 0x355bfaa71dd16,
+        0x00b77ea5f78aa, 0x76579a29e822d }
+    },
+    {
+      { 0x4b51352b434f2, 0x1327bd01c2667, 0x434d73b60c8a1,
+        0x3e0daa89443ba, 0x02c514bb2a277 },
+      { 0x68e7e49c02a17, 0x45795346fe8b6, 0x089306c8f3546,
+        0x6d89f6b2f88f6, 0x43a384dc9e05b },
+      { 0x3d5da8bf1b645, 0x7ded6a96a6d09, 0x6c3494fee2f4d,
+        0x02c989c8b6bd4, 0x1160920961548 }
+    },
+    {
+      { 0x05616369b4dcd, 0x4ecab86ac6f47, 0x3c60085d700b2,
+        0x0213ee10dfcea, 0x2f637d7491e6e },
+      { 0x5166929dacfaa, 0x190826b31f689, 0x4f55567694a7d,
+        0x705f4f7b1e522, 0x351e125bc5698 },
+      { 0x49b461af67bbe, 0x75915712c3a96, 0x69a67ef580c0d,
+        0x54d38ef70cffc, 0x7f182d06e7ce2 }
+    },
+    {
+      { 0x54b728e217522, 0x69a90971b0128, 0x51a40f2a963a3,
+        0x10be9ac12a6bf, 0x44acc043241c5 },
+      { 0x48e64ab0168ec, 0x2a2bdb8a86f4f, 0x7343b6b2d6929,
+        0x1d804aa8ce9a3, 0x67d4ac8c343e9 },
+      { 0x56bbb4f7a5777, 0x29230627c238f, 0x5ad1a122cd7fb,
+        0x0dea56e50e364, 0x556d1c8312ad7 }
+    },
+    {
+      { 0x06756b11be821, 0x462147e7bb03e, 0x26519743ebfe0,
+        0x782fc59682ab5, 0x097abe38cc8c7 },
+      { 0x740e30c8d3982, 0x7c2b47f4682fd, 0x5cd91b8c7dc1c,
+        0x77fa790f9e583, 0x746c6c6d1d824 },
+      { 0x1c9877ea52da4, 0x2b37b83a86189, 0x733af49310da5,
+        0x25e81161c04fb, 0x577e14a34bee8 }
+    },
+    {
+      { 0x6cebebd4dd72b, 0x340c1e442329f, 0x32347ffd1a93f,
+        0x14a89252cbbe0, 0x705304b8fb009 },
+      { 0x268ac61a73b0a, 0x206f234bebe1c, 0x5b403a7cbebe8,
+        0x7a160f09f4135, 0x60fa7ee96fd78 },
+      { 0x51d354d296ec6, 0x7cbf5a63b16c7, 0x2f50bb3cf0c14,
+        0x1feb385cac65a, 0x21398e0ca1635 }
+    }
+  },
+  {
+    {
+      { 0x0aaf9b4b75601, 0x26b91b5ae44f3, 0x6de808d7ab1c8,
+        0x6a769675530b0, 0x1bbfb284e98f7 },
+      { 0x5058a382b33f3, 0x175a91816913e, 0x4f6cdb96b8ae8,
+        0x17347c9da81d2, 0x5aa3ed9d95a23 },
+      { 0x777e9c7d96561, 0x28e58f006ccac, 0x541bbbb2cac49,
+        0x3e63282994cec, 0x4a07e14e5e895 }
+    },
+    {
+      { 0x358cdc477a49b, 0x3cc88fe02e481, 0x721aab7f4e36b,
+        0x0408cc9469953, 0x50af7aed84afa },
+      { 0x412cb980df999, 0x5e78dd8ee29dc, 0x171dff68c575d,
+        0x2015dd2f6ef49, 0x3f0bac391d313 },
+      { 0x7de0115f65be5, 0x4242c21364dc9, 0x6b75b64a66098,
+        0x0033c0102c085, 0x1921a316baebd }
+    },
+    {
+      { 0x2ad9ad9f3c18b, 0x5ec1638339aeb, 0x5703b6559a83b,
+        0x3fa9f4d05d612, 0x7b049deca062c },
+      { 0x22f7edfb870fc, 0x569eed677b128, 0x30937dcb0a5af,
+        0x758039c78ea1b, 0x6458df41e273a },
+      { 0x3e37a35444483, 0x661fdb7d27b99, 0x317761dd621e4,
+        0x7323c30026189, 0x6093dccbc2950 }
+    },
+    {
+      { 0x6eebe6084034b, 0x6cf01f70a8d7b, 0x0b41a54c6670a,
+        0x6c84b99bb55db, 0x6e3180c98b647 },
+      { 0x39a8585e0706d, 0x3167ce72663fe, 0x63d14ecdb4297,
+        0x4be21dcf970b8, 0x57d1ea084827a },
+      { 0x2b6e7a128b071, 0x5b27511755dcf, 0x08584c2930565,
+        0x68c7bda6f4159, 0x363e999ddd97b }
+    },
+    {
+      { 0x048dce24baec6, 0x2b75795ec05e3, 0x3bfa4c5da6dc9,
+        0x1aac8659e371e, 0x231f979bc6f9b },
+      { 0x043c135ee1fc4, 0x2a11c9919f2d5, 0x6334cc25dbacd,
+        0x295da17b400da, 0x48ee9b78693a0 },
+      { 0x1de4bcc2af3c6, 0x61fc411a3eb86, 0x53ed19ac12ec0,
+        0x209dbc6b804e0, 0x079bfa9b08792 }
+    },
+    {
+      { 0x1ed80a2d54245, 0x70efec72a5e79, 0x42151d42a822d,
+        0x1b5ebb6d631e8, 0x1ef4fb1594706 },
+      { 0x03a51da300df4, 0x467b52b561c72, 0x4d5920210e590,
+        0x0ca769e789685, 0x038c77f684817 },
+      { 0x65ee65b167bec, 0x052da19b850a9, 0x0408665656429,
+        0x7ab39596f9a4c, 0x575ee92a4a0bf }
+    },
+    {
+      { 0x6bc450aa4d801, 0x4f4a6773b0ba8, 0x6241b0b0ebc48,
+        0x40d9c4f1d9315, 0x200a1e7e382f5 },
+      { 0x080908a182fcf, 0x0532913b7ba98, 0x3dccf78c385c3,
+        0x68002dd5eaba9, 0x43d4e7112cd3f },
+      { 0x5b967eaf93ac5, 0x360acca580a31, 0x1c65fd5c6f262,
+        0x71c7f15c2ecab, 0x050eca52651e4 }
+    },
+    {
+      { 0x4397660e668ea, 0x7c2a75692f2f5, 0x3b29e7e6c66ef,
+        0x72ba658bcda9a, 0x6151c09fa131a },
+      { 0x31ade453f0c9c, 0x3dfee07737868, 0x611ecf7a7d411,
+        0x2637e6cbd64f6, 0x4b0ee6c21c58f },
+      { 0x55c0dfdf05d96, 0x405569dcf475e, 0x05c5c277498bb,
+        0x18588d95dc389, 0x1fef24fa800f0 }
+    }
+  },
+  {
+    {
+      { 0x2aff530976b86, 0x0d85a48c0845a, 0x796eb963642e0,
+        0x60bee50c4b626, 0x28005fe6c8340 },
+      { 0x653fb1aa73196, 0x607faec8306fa, 0x4e85ec83e5254,
+        0x09f56900584fd, 0x544d49292fc86 },
+      { 0x7ba9f34528688, 0x284a20fb42d5d, 0x3652cd9706ffe,
+        0x6fd7baddde6b3, 0x72e472930f316 }
+    },
+    {
+      { 0x3f635d32a7627, 0x0cbecacde00fe, 0x3411141eaa936,
+        0x21c1e42f3cb94, 0x1fee7f000fe06 },
+      { 0x5208c9781084f, 0x16468a1dc24d2, 0x7bf780ac540a8,
+        0x1a67eced75301, 0x5a9d2e8c2733a },
+      { 0x305da03dbf7e5, 0x1228699b7aeca, 0x12a23b2936bc9,
+        0x2a1bda56ae6e9, 0x00f94051ee040 }
+    },
+    {
+      { 0x793bb07af9753, 0x1e7b6ecd4fafd, 0x02c7b1560fb43,
+        0x2296734cc5fb7, 0x47b7ffd25dd40 },
+      { 0x56b23c3d330b2, 0x37608e360d1a6, 0x10ae0f3c8722e,
+        0x086d9b618b637, 0x07d79c7e8beab },
+      { 0x3fb9cbc08dd12, 0x75c3dd85370ff, 0x47f06fe2819ac,
+        0x5db06ab9215ed, 0x1c3520a35ea64 }
+    },
+    {
+      { 0x06f40216bc059, 0x3a2579b0fd9b5, 0x71c26407eec8c,
+        0x72ada4ab54f0b, 0x38750c3b66d12 },
+      { 0x253a6bccba34a, 0x427070433701a, 0x20b8e58f9870e,
+        0x337c861db00cc, 0x1c3d05775d0ee },
+      { 0x6f1409422e51a, 0x7856bbece2d25, 0x13380a72f031c,
+        0x43e1080a7f3ba, 0x0621e2c7d3304 }
+    },
+    {
+      { 0x61796b0dbf0f3, 0x73c2f9c32d6f5, 0x6aa8ed1537ebe,
+        0x74e92c91838f4, 0x5d8e589ca1002 },
+      { 0x060cc8259838d, 0x038d3f35b95f3, 0x56078c243a923,
+        0x2de3293241bb2, 0x0007d6097bd3a },
+      { 0x71d950842a94b, 0x46b11e5c7d817, 0x5478bbecb4f0d,
+        0x7c3054b0a1c5d, 0x1583d7783c1cb }
+    },
+    {
+      { 0x34704cc9d28c7, 0x3dee598b1f200, 0x16e1c98746d9e,
+        0x4050b7095afdf, 0x4958064e83c55 },
+      { 0x6a2ef5da27ae1, 0x28aace02e9d9d, 0x02459e965f0e8,
+        0x7b864d3150933, 0x252a5f2e81ed8 },
+      { 0x094265066e80d, 0x0a60f918d61a5, 0x0444bf7f30fde,
+        0x1c40da9ed3c06, 0x079c170bd843b }
+    },
+    {
+      { 0x6cd50c0d5d056, 0x5b7606ae779ba, 0x70fbd226bdda1,
+        0x5661e53391ff9, 0x6768c0d7317b8 },
+      { 0x6ece464fa6fff, 0x3cc40bca460a0, 0x6e3a90afb8d0c,
+        0x5801abca11228, 0x6dec05e34ac9f },
+      { 0x625e5f155c1b3, 0x4f32f6f723296, 0x5ac980105efce,
+        0x17a61165eee36, 0x51445e14ddcd5 }
+    },
+    {
+      { 0x147ab2bbea455, 0x1f240f2253126, 0x0c3de9e314e89,
+        0x21ea5a4fca45f, 0x12e990086e4fd },
+      { 0x02b4b3b144951, 0x5688977966aea, 0x18e176e399ffd,
+        0x2e45c5eb4938b, 0x13186f31e3929 },
+      { 0x496b37fdfbb2e, 0x3c2439d5f3e21, 0x16e60fe7e6a4d,
+        0x4d7ef889b621d, 0x77b2e3f05d3e9 }
+    }
+  },
+  {
+    {
+      { 0x0639c12ddb0a4, 0x6180490cd7ab3, 0x3f3918297467c,
+        0x74568be1781ac, 0x07a195152e095 },
+      { 0x7a9c59c2ec4de, 0x7e9f09e79652d, 0x6a3e422f22d86,
+        0x2ae8e3b836c8b, 0x63b795fc7ad32 },
+      { 0x68f02389e5fc8, 0x059f1bc877506, 0x504990e410cec,
+        0x09bd7d0feaee2, 0x3e8fe83d032f0 }
+    },
+    {
+      { 0x04c8de8efd13c, 0x1c67c06e6210e, 0x183378f7f146a,
+        0x64352ceaed289, 0x22d60899a6258 },
+      { 0x315b90570a294, 0x60ce108a925f1, 0x6eff61253c909,
+        0x003ef0e2d70b0, 0x75ba3b797fac4 },
+      { 0x1dbc070cdd196, 0x16d8fb1534c47, 0x500498183fa2a,
+        0x72f59c423de75, 0x0904d07b87779 }
+    },
+    {
+      { 0x22d6648f940b9, 0x197a5a1873e86, 0x207e4c41a54bc,
+        0x5360b3b4bd6d0, 0x6240aacebaf72 },
+      { 0x61fd4ddba919c, 0x7d8e991b55699, 0x61b31473cc76c,
+        0x7039631e631d6, 0x43e2143fbc1dd },
+      { 0x4749c5ba295a0, 0x37946fa4b5f06, 0x724c5ab5a51f1,
+        0x65633789dd3f3, 0x56bdaf238db40 }
+    },
+    {
+      { 0x0d36cc19d3bb2, 0x6ec4470d72262, 0x6853d7018a9ae,
+        0x3aa3e4dc2c8eb, 0x03aa31507e1e5 },
+      { 0x2b9e3f53533eb, 0x2add727a806c5, 0x56955c8ce15a3,
+        0x18c4f070a290e, 0x1d24a86d83741 },
+      { 0x47648ffd4ce1f, 0x60a9591839e9d, 0x424d5f38117ab,
+        0x42cc46912c10e, 0x43b261dc9aeb4 }
+    },
+    {
+      { 0x13d8b6c951364, 0x4c0017e8f632a, 0x53e559e53f9c4,
+        0x4b20146886eea, 0x02b4d5e242940 },
+      { 0x31e1988bb79bb, 0x7b82f46b3bcab, 0x0f7a8ce827b41,
+        0x5e15816177130, 0x326055cf5b276 },
+      { 0x155cb28d18df2, 0x0c30d9ca11694, 0x2090e27ab3119,
+        0x208624e7a49b6, 0x27a6c809ae5d3 }
+    },
+    {
+      { 0x4270ac43d6954, 0x2ed4cd95659a5, 0x75c0db37528f9,
+        0x2ccbcfd2c9234, 0x221503603d8c2 },
+      { 0x6ebcd1f0db188, 0x74ceb4b7d1174, 0x7d56168df4f5c,
+        0x0bf79176fd18a, 0x2cb67174ff60a },
+      { 0x6cdf9390be1d0, 0x08e519c7e2b3d, 0x253c3d2a50881,
+        0x21b41448e333d, 0x7b1df4b73890f }
+    },
+    {
+      { 0x6221807f8f58c, 0x3fa92813a8be5, 0x6da98c38d5572,
+        0x01ed95554468f, 0x68698245d352e },
+      { 0x2f2e0b3b2a224, 0x0c56aa22c1c92, 0x5fdec39f1b278,
+        0x4c90af5c7f106, 0x61fcef2658fc5 },
+      { 0x15d852a18187a, 0x270dbb59afb76, 0x7db120bcf92ab,
+        0x0e7a25d714087, 0x46cf4c473daf0 }
+    },
+    {
+      { 0x46ea7f1498140, 0x70725690a8427, 0x0a73ae9f079fb,
+        0x2dd924461c62b, 0x1065aae50d8cc },
+      { 0x525ed9ec4e5f9, 0x022d20660684c, 0x7972b70397b68,
+        0x7a03958d3f965, 0x29387bcd14eb5 },
+      { 0x44525df200d57, 0x2d7f94ce94385, 0x60d00c170ecb7,
+        0x38b0503f3d8f0, 0x69a198e64f1ce }
+    }
+  },
+  {
+    {
+      { 0x14434dcc5caed, 0x2c7909f667c20, 0x61a839d1fb576,
+        0x4f23800cabb76, 0x25b2697bd267f },
+      { 0x2b2e0d91a78bc, 0x3990a12ccf20c, 0x141c2e11f2622,
+        0x0dfcefaa53320, 0x7369e6a92493a },
+      { 0x73ffb13986864, 0x3282bb8f713ac, 0x49ced78f297ef,
+        0x6697027661def, 0x1420683db54e4 }
+    },
+    {
+      { 0x6bb6fc1cc5ad0, 0x532c8d591669d, 0x1af794da86c33,
+        0x0e0e9d86d24d3, 0x31e83b4161d08 },
+      { 0x0bd1e249dd197, 0x00bcb1820568f, 0x2eab1718830d4,
+        0x396fd816997e6, 0x60b63bebf508a },
+      { 0x0c7129e062b4f, 0x1e526415b12fd, 0x461a0fd27923d,
+        0x18badf670a5b7, 0x55cf1eb62d550 }
+    },
+    {
+      { 0x6b5e37df58c52, 0x3bcf33986c60e, 0x44fb8835ceae7,
+        0x099dec18e71a4, 0x1a56fbaa62ba0 },
+      { 0x1101065c23d58, 0x5aa1290338b0f, 0x3157e9e2e7421,
+        0x0ea712017d489, 0x669a656457089 },
+      { 0x66b505c9dc9ec, 0x774ef86e35287, 0x4d1d944c0955e,
+        0x52e4c39d72b20, 0x13c4836799c58 }
+    },
+    {
+      { 0x4fb6a5d8bd080, 0x58ae34908589b, 0x3954d977baf13,
+        0x413ea597441dc, 0x50bdc87dc8e5b },
+      { 0x25d465ab3e1b9, 0x0f8fe27ec2847, 0x2d6e6dbf04f06,
+        0x3038cfc1b3276, 0x66f80c93a637b },
+      { 0x537836edfe111, 0x2be02357b2c0d, 0x6dcee58c8d4f8,
+        0x2d732581d6192, 0x1dd56444725fd }
+    },
+    {
+      { 0x7e60008bac89a, 0x23d5c387c1852, 0x79e5df1f533a8,
+        0x2e6f9f1c5f0cf, 0x3a3a450f63a30 },
+      { 0x47ff83362127d, 0x08e39af82b1f4, 0x488322ef27dab,
+        0x1973738a2a1a4, 0x0e645912219f7 },
+      { 0x72f31d8394627, 0x07bd294a200f1, 0x665be00e274c6,
+        0x43de8f1b6368b, 0x318c8d9393a9a }
+    },
+    {
+      { 0x69e29ab1dd398, 0x30685b3c76bac, 0x565cf37f24859,
+        0x57b2ac28efef9, 0x509a41c325950 },
+      { 0x45d032afffe19, 0x12fe49b6cde4e, 0x21663bc327cf1,
+        0x18a5e4c69f1dd, 0x224c7c679a1d5 },
+      { 0x06edca6f925e9, 0x68c8363e677b8, 0x60cfa25e4fbcf,
+        0x1c4c17609404e, 0x05bff02328a11 }
+    },
+    {
+      { 0x1a0dd0dc512e4, 0x10894bf5fcd10, 0x52949013f9c37,
+        0x1f50fba4735c7, 0x576277cdee01a },
+      { 0x2137023cae00b, 0x15a3599eb26c6, 0x0687221512b3c,
+        0x253cb3a0824e9, 0x780b8cc3fa2a4 },
+      { 0x38abc234f305f, 0x7a280bbc103de, 0x398a836695dfe,
+        0x3d0af41528a1a, 0x5ff418726271b }
+    },
+    {
+      { 0x347e813b69540, 0x76864c21c3cbb, 0x1e049dbcd74a8,
+        0x5b4d60f93749c, 0x29d4db8ca0a0c },
+      { 0x6080c1789db9d, 0x4be7cef1ea731, 0x2f40d769d8080,
+        0x35f7d4c44a603, 0x106a03dc25a96 },
+      { 0x50aaf333353d0, 0x4b59a613cbb35, 0x223dfc0e19a76,
+        0x77d1e2bb2c564, 0x4ab38a51052cb }
+    }
+  },
+  {
+    {
+      { 0x7d1ef5fddc09c, 0x7beeaebb9dad9, 0x058d30ba0acfb,
+        0x5cd92eab5ae90, 0x3041c6bb04ed2 },
+      { 0x42b256768d593, 0x2e88459427b4f, 0x02b3876630701,
+        0x34878d405eae5, 0x29cdd1adc088a },
+      { 0x2f2f9d956e148, 0x6b3e6ad65c1fe, 0x5b00972b79e5d,
+        0x53d8d234c5daf, 0x104bbd6814049 }
+    },
+    {
+      { 0x59a5fd67ff163, 0x3a998ead0352b, 0x083c95fa4af9a,
+        0x6fadbfc01266f, 0x204f2a20fb072 },
+      { 0x0fd3168f1ed67, 0x1bb0de7784a3e, 0x34bcb78b20477,
+        0x0a4a26e2e2182, 0x5be8cc57092a7 },
+      { 0x43b3d30ebb079, 0x357aca5c61902, 0x5b570c5d62455,
+        0x30fb29e1e18c7, 0x2570fb17c2791 }
+    },
+    {
+      { 0x6a9550bb8245a, 0x511f20a1a2325, 0x29324d7239bee,
+        0x3343cc37516c4, 0x241c5f91de018 },
+      { 0x2367f2cb61575, 0x6c39ac04d87df, 0x6d4958bd7e5bd,
+        0x566f4638a1532, 0x3dcb65ea53030 },
+      { 0x0172940de6caa, 0x6045b2e67451b, 0x56c07463efcb3,
+        0x0728b6bfe6e91, 0x08420edd5fcdf }
+    },
+    {
+      { 0x0c34e04f410ce, 0x344edc0d0a06b, 0x6e45486d84d6d,
+        0x44e2ecb3863f5, 0x04d654f321db8 },
+      { 0x720ab8362fa4a, 0x29c4347cdd9bf, 0x0e798ad5f8463,
+        0x4fef18bcb0bfe, 0x0d9a53efbc176 },
+      { 0x5c116ddbdb5d5, 0x6d1b4bba5abcf, 0x4d28a48a5537a,
+        0x56b8e5b040b99, 0x4a7a4f2618991 }
+    },
+    {
+      { 0x3b291af372a4b, 0x60e3028fe4498, 0x2267bca4f6a09,
+        0x719eec242b243, 0x4a96314223e0e },
+      { 0x718025fb15f95, 0x68d6b8371fe94, 0x3804448f7d97c,
+        0x42466fe784280, 0x11b50c4cddd31 },
+      { 0x0274408a4ffd6, 0x7d382aedb34dd, 0x40acfc9ce385d,
+        0x628bb99a45b1e, 0x4f4bce4dce6bc }
+    },
+    {
+      { 0x2616ec49d0b6f, 0x1f95d8462e61c, 0x1ad3e9b9159c6,
+        0x79ba475a04df9, 0x3042cee561595 },
+      { 0x7ce5ae2242584, 0x2d25eb153d4e3, 0x3a8f3d09ba9c9,
+        0x0f3690d04eb8e, 0x73fcdd14b71c0 },
+      { 0x67079449bac41, 0x5b79c4621484f, 0x61069f2156b8d,
+        0x0eb26573b10af, 0x389e740c9a9ce }
+    },
+    {
+      { 0x578f6570eac28, 0x644f2339c3937, 0x66e47b7956c2c,
+        0x34832fe1f55d0, 0x25c425e5d6263 },
+      { 0x4b3ae34dcb9ce, 0x47c691a15ac9f, 0x318e06e5d400c,
+        0x3c422d9f83eb1, 0x61545379465a6 },
+      { 0x606a6f1d7de6e, 0x4f1c0c46107e7, 0x229b1dcfbe5d8,
+        0x3acc60a7b1327, 0x6539a08915484 }
+    },
+    {
+      { 0x4dbd414bb4a19, 0x7930849f1dbb8, 0x329c5a466caf0,
+        0x6c824544feb9b, 0x0f65320ef019b },
+      { 0x21f74c3d2f773, 0x024b88d08bd3a, 0x6e678cf054151,
+        0x43631272e747c, 0x11c5e4aac5cd1 },
+      { 0x6d1b1cafde0c6, 0x462c76a303a90, 0x3ca4e693cff9b,
+        0x3952cd45786fd, 0x4cabc7bdec330 }
+    }
+  },
+  {
+    {
+      { 0x7788f3f78d289, 0x5942809b3f811, 0x5973277f8c29c,
+        0x010f93bc5fe67, 0x7ee498165acb2 },
+      { 0x69624089c0a2e, 0x0075fc8e70473, 0x13e84ab1d2313,
+        0x2c10bedf6953b, 0x639b93f0321c8 },
+      { 0x508e39111a1c3, 0x290120e912f7a, 0x1cbf464acae43,
+        0x15373e9576157, 0x0edf493c85b60 }
+    },
+    {
+      { 0x7c4d284764113, 0x7fefebf06acec, 0x39afb7a824100,
+        0x1b48e47e7fd65, 0x04c00c54d1dfa },
+      { 0x48158599b5a68, 0x1fd75bc41d5d9, 0x2d9fc1fa95d3c,
+        0x7da27f20eba11, 0x403b92e3019d4 },
+      { 0x22f818b465cf8, 0x342901dff09b8, 0x31f595dc683cd,
+        0x37a57745fd682, 0x355bb12ab2617 }
+    },
+    {
+      { 0x1dac75a8c7318, 0x3b679d5423460, 0x6b8fcb7b6400e,
+        0x6c73783be5f9d, 0x7518eaf8e052a },
+      { 0x664cc7493bbf4, 0x33d94761874e3, 0x0179e1796f613,
+        0x1890535e2867d, 0x0f9b8132182ec },
+      { 0x059c41b7f6c32, 0x79e8706531491, 0x6c747643cb582,
+        0x2e20c0ad494e4, 0x47c3871bbb175 }
+    },
+    {
+      { 0x65d50c85066b0, 0x6167453361f7c, 0x06ba3818bb312,
+        0x6aff29baa7522, 0x08fea02ce8d48 },
+      { 0x4539771ec4f48, 0x7b9318badca28, 0x70f19afe016c5,
+        0x4ee7bb1608d23, 0x00b89b8576469 },
+      { 0x5dd7668deead0, 0x4096d0ba47049, 0x6275997219114,
+        0x29bda8a67e6ae, 0x473829a74f75d }
+    },
+    {
+      { 0x1533aad3902c9, 0x1dde06b11e47b, 0x784bed1930b77,
+        0x1c80a92b9c867, 0x6c668b4d44e4d },
+      { 0x2da754679c418, 0x3164c31be105a, 0x11fac2b98ef5f,
+        0x35a1aaf779256, 0x2078684c4833c },
+      { 0x0cf217a78820c, 0x65024e7d2e769, 0x23bb5efdda82a,
+        0x19fd4b632d3c6, 0x7411a6054f8a4 }
+    },
+    {
+      { 0x2e53d18b175b4, 0x33e7254204af3, 0x3bcd7d5a1c4c5,
+        0x4c7c22af65d0f, 0x1ec9a872458c3 },
+      { 0x59d32b99dc86d, 0x6ac075e22a9ac, 0x30b9220113371,
+        0x27fd9a638966e, 0x7c136574fb813 },
+      { 0x6a4d400a2509b, 0x041791056971c, 0x655d5866e075c,
+        0x2302bf3e64df8, 0x3add88a5c7cd6 }
+    },
+    {
+      { 0x298d459393046, 0x30bfecb3d90b8, 0x3d9b8ea3df8d6,
+        0x3900e96511579, 0x61ba1131a406a },
+      { 0x15770b635dcf2, 0x59ecd83f79571, 0x2db461c0b7fbd,
+        0x73a42a981345f, 0x249929fccc879 },
+      { 0x0a0f116959029, 0x5974fd7b1347a, 0x1e0cc1c08edad,
+        0x673bdf8ad1f13, 0x5620310cbbd8e }
+    },
+    {
+      { 0x6b5f477e285d6, 0x4ed91ec326cc8, 0x6d6537503a3fd,
+        0x626d3763988d5, 0x7ec846f3658ce },
+      { 0x193434934d643, 0x0d4a2445eaa51, 0x7d0708ae76fe0,
+        0x39847b6c3c7e1, 0x37676a2a4d9d9 },
+      { 0x68f3f1da22ec7, 0x6ed8039a2736b, 0x2627ee04c3c75,
+        0x6ea90a647e7d1, 0x6daaf723399b9 }
+    }
+  },
+  {
+    {
+      { 0x304bfacad8ea2, 0x502917d108b07, 0x043176ca6dd0f,
+        0x5d5158f2c1d84, 0x2b5449e58eb3b },
+      { 0x27562eb3dbe47, 0x291d7b4170be7, 0x5d1ca67dfa8e1,
+        0x2a88061f298a2, 0x1304e9e71627d },
+      { 0x014d26adc9cfe, 0x7f1691ba16f13, 0x5e71828f06eac,
+        0x349ed07f0fffc, 0x4468de2d7c2dd }
+    },
+    {
+      { 0x2d8c6f86307ce, 0x6286ba1850973, 0x5e9dcb08444d4,
+        0x1a96a543362b2, 0x5da6427e63247 },
+      { 0x3355e9419469e, 0x1847bb8ea8a37, 0x1fe6588cf9b71,
+        0x6b1c9d2db6b22, 0x6cce7c6ffb44b },
+      { 0x4c688deac22ca, 0x6f775c3ff0352, 0x565603ee419bb,
+        0x6544456c61c46, 0x58f29abfe79f2 }
+    },
+    {
+      { 0x264bf710ecdf6, 0x708c58527896b, 0x42ceae6c53394,
+        0x4381b21e82b6a, 0x6af93724185b4 },
+      { 0x6cfab8de73e68, 0x3e6efced4bd21, 0x0056609500dbe,
+        0x71b7824ad85df, 0x577629c4a7f41 },
+      { 0x0024509c6a888, 0x2696ab12e6644, 0x0cca27f4b80d8,
+        0x0c7c1f11b119e, 0x701f25bb0caec }
+    },
+    {
+      { 0x0f6d97cbec113, 0x4ce97fb7c93a3, 0x139835a11281b,
+        0x728907ada9156, 0x720a5bc050955 },
+      { 0x0b0f8e4616ced, 0x1d3c4b50fb875, 0x2f29673dc0198,
+        0x5f4b0f1830ffa, 0x2e0c92bfbdc40 },
+      { 0x709439b805a35, 0x6ec48557f8187, 0x08a4d1ba13a2c,
+        0x076348a0bf9ae, 0x0e9b9cbb144ef }
+    },
+    {
+      { 0x69bd55db1beee, 0x6e14e47f731bd, 0x1a35e47270eac,
+        0x66f225478df8e, 0x366d44191cfd3 },
+      { 0x2d48ffb5720ad, 0x57b7f21a1df77, 0x5550effba0645,
+        0x5ec6a4098a931, 0x221104eb3f337 },
+      { 0x41743f2bc8c14, 0x796b0ad8773c7, 0x29fee5cbb689b,
+        0x122665c178734, 0x4167a4e6bc593 }
+    },
+    {
+      { 0x62665f8ce8fee, 0x29d101ac59857, 0x4d93bbba59ffc,
+        0x17b7897373f17, 0x34b33370cb7ed },
+      { 0x39d2876f62700, 0x001cecd1d6c87, 0x7f01a11747675,
+        0x2350da5a18190, 0x7938bb7e22552 },
+      { 0x591ee8681d6cc, 0x39db0b4ea79b8, 0x202220f380842,
+        0x2f276ba42e0ac, 0x1176fc6e2dfe6 }
+    },
+    {
+      { 0x0e28949770eb8, 0x5559e88147b72, 0x35e1e6e63ef30,
+        0x35b109aa7ff6f, 0x1f6a3e54f2690 },
+      { 0x76cd05b9c619b, 0x69654b0901695, 0x7a53710b77f27,
+        0x79a1ea7d28175, 0x08fc3a4c677d5 },
+      { 0x4c199d30734ea, 0x6c622cb9acc14, 0x5660a55030216,
+        0x068f1199f11fb, 0x4f2fad0116b90 }
+    },
+    {
+      { 0x4d91db73bb638, 0x55f82538112c5, 0x6d85a279815de,
+        0x740b7b0cd9cf9, 0x3451995f2944e },
+      { 0x6b24194ae4e54, 0x2230afded8897, 0x23412617d5071,
+        0x3d5d30f35969b, 0x445484a4972ef },
+      { 0x2fcd09fea7d7c, 0x296126b9ed22a, 0x4a171012a05b2,
+        0x1db92c74d5523, 0x10b89ca604289 }
+    }
+  },
+  {
+    {
+      { 0x141be5a45f06e, 0x5adb38becaea7, 0x3fd46db41f2bb,
+        0x6d488bbb5ce39, 0x17d2d1d9ef0d4 },
+      { 0x147499718289c, 0x0a48a67e4c7ab, 0x30fbc544bafe3,
+        0x0c701315fe58a, 0x20b878d577b75 },
+      { 0x2af18073f3e6a, 0x33aea420d24fe, 0x298008bf4ff94,
+        0x3539171db961e, 0x72214f63cc65c }
+    },
+    {
+      { 0x5b7b9f43b29c9, 0x149ea31eea3b3, 0x4be7713581609,
+        0x2d87960395e98, 0x1f24ac855a154 },
+      { 0x37f405307a693, 0x2e5e66cf2b69c, 0x5d84266ae9c53,
+        0x5e4eb7de853b9, 0x5fdf48c58171c },
+      { 0x608328e9505aa, 0x22182841dc49a, 0x3ec96891d2307,
+        0x2f363fff22e03, 0x00ba739e2ae39 }
+    },
+    {
+      { 0x426f5ea88bb26, 0x33092e77f75c8, 0x1a53940d819e7,
+        0x1132e4f818613, 0x72297de7d518d },
+      { 0x698de5c8790d6, 0x268b8545beb25, 0x6d2648b96fedf,
+        0x47988ad1db07c, 0x03283a3e67ad7 },
+      { 0x41dc7be0cb939, 0x1b16c66100904, 0x0a24c20cbc66d,
+        0x4a2e9efe48681, 0x05e1296846271 }
+    },
+    {
+      { 0x7bbc8242c4550, 0x59a06103b35b7, 0x7237e4af32033,
+        0x726421ab3537a, 0x78cf25d38258c },
+      { 0x2eeb32d9c495a, 0x79e25772f9750, 0x6d747833bbf23,
+        0x6cdd816d5d749, 0x39c00c9c13698 },
+      { 0x66b8e31489d68, 0x573857e10e2b5, 0x13be816aa1472,
+        0x41964d3ad4bf8, 0x006b52076b3ff }
+    },
+    {
+      { 0x37e16b9ce082d, 0x1882f57853eb9, 0x7d29eacd01fc5,
+        0x2e76a59b5e715, 0x7de2e9561a9f7 },
+      { 0x0cfe19d95781c, 0x312cc621c453c, 0x145ace6da077c,
+        0x0912bef9ce9b8, 0x4d57e3443bc76 },
+      { 0x0d4f4b6a55ecb, 0x7ebb0bb733bce, 0x7ba6a05200549,
+        0x4f6ede4e22069, 0x6b2a90af1a602 }
+    },
+    {
+      { 0x3f3245bb2d80a, 0x0e5f720f36efd, 0x3b9cccf60c06d,
+        0x084e323f37926, 0x465812c8276c2 },
+      { 0x3f4fc9ae61e97, 0x3bc07ebfa2d24, 0x3b744b55cd4a0,
+        0x72553b25721f3, 0x5fd8f4e9d12d3 },
+      { 0x3beb22a1062d9, 0x6a7063b82c9a8, 0x0a5a35dc197ed,
+        0x3c80c06a53def, 0x05b32c2b1cb16 }
+    },
+    {
+      { 0x4a42c7ad58195, 0x5c8667e799eff, 0x02e5e74c850a1,
+        0x3f0db614e869a, 0x31771a4856730 },
+      { 0x05eccd24da8fd, 0x580bbfdf07918, 0x7e73586873c6a,
+        0x74ceddf77f93e, 0x3b5556a37b471 },
+      { 0x0c524e14dd482, 0x283457496c656, 0x0ad6bcfb6cd45,
+        0x375d1e8b02414, 0x4fc079d27a733 }
+    },
+    {
+      { 0x48b440c86c50d, 0x139929cca3b86, 0x0f8f2e44cdf2f,
+        0x68432117ba6b2, 0x241170c2bae3c },
+      { 0x138b089bf2f7f, 0x4a05bfd34ea39, 0x203914c925ef5,
+        0x7497fffe04e3c, 0x124567cecaf98 },
+      { 0x1ab860ac473b4, 0x5c0227c86a7ff, 0x71b12bfc24477,
+        0x006a573a83075, 0x3f8612966c870 }
+    }
+  },
+  {
+    {
+      { 0x0fcfa36048d13, 0x66e7133bbb383, 0x64b42a8a45676,
+        0x4ea6e4f9a85cf, 0x26f57eee878a1 },
+      { 0x20cc9782a0dde, 0x65d4e3070aab3, 0x7bc8e31547736,
+        0x09ebfb1432d98, 0x504aa77679736 },
+      { 0x32cd55687efb1, 0x4448f5e2f6195, 0x568919d460345,
+        0x034c2e0ad1a27, 0x4041943d9dba3 }
+    },
+    {
+      { 0x17743a26caadd, 0x48c9156f9c964, 0x7ef278d1e9ad0,
+        0x00ce58ea7bd01, 0x12d931429800d },
+      { 0x0eeba43ebcc96, 0x384dd5395f878, 0x1df331a35d272,
+        0x207ecfd4af70e, 0x1420a1d976843 },
+      { 0x67799d337594f, 0x01647548f6018, 0x57fce5578f145,
+        0x009220c142a71, 0x1b4f92314359a }
+    },
+    {
+      { 0x73030a49866b1, 0x2442be90b2679, 0x77bd3d8947dcf,
+        0x1fb55c1552028, 0x5ff191d56f9a2 },
+      { 0x4109d89150951, 0x225bd2d2d47cb, 0x57cc080e73bea,
+        0x6d71075721fcb, 0x239b572a7f132 },
+      { 0x6d433ac2d9068, 0x72bf930a47033, 0x64facf4a20ead,
+        0x365f7a2b9402a, 0x020c526a758f3 }
+    },
+    {
+      { 0x1ef59f042cc89, 0x3b1c24976dd26, 0x31d665cb16272,
+        0x28656e470c557, 0x452cfe0a5602c },
+      { 0x034f89ed8dbbc, 0x73b8f948d8ef3, 0x786c1d323caab,
+        0x43bd4a9266e51, 0x02aacc4615313 },
+      { 0x0f7a0647877df, 0x4e1cc0f93f0d4, 0x7ec4726ef1190,
+        0x3bdd58bf512f8, 0x4cfb7d7b304b8 }
+    },
+    {
+      { 0x699c29789ef12, 0x63beae321bc50, 0x325c340adbb35,
+        0x562e1a1e42bf6, 0x5b1d4cbc434d3 },
+      { 0x43d6cb89b75fe, 0x3338d5b900e56, 0x38d327d531a53,
+        0x1b25c61d51b9f, 0x14b4622b39075 },
+      { 0x32615cc0a9f26, 0x57711b99cb6df, 0x5a69c14e93c38,
+        0x6e88980a4c599, 0x2f98f71258592 }
+    },
+    {
+      { 0x2ae444f54a701, 0x615397afbc5c2, 0x60d7783f3f8fb,
+        0x2aa675fc486ba, 0x1d8062e9e7614 },
+      { 0x4a74cb50f9e56, 0x531d1c2640192, 0x0c03d9d6c7fd2,
+        0x57ccd156610c1, 0x3a6ae249d806a },
+      { 0x2da85a9907c5a, 0x6b23721ec4caf, 0x4d2d3a4683aa2,
+        0x7f9c6870efdef, 0x298b8ce8aef25 }
+    },
+    {
+      { 0x272ea0a2165de, 0x68179ef3ed06f, 0x4e2b9c0feac1e,
+        0x3ee290b1b63bb, 0x6ba6271803a7d },
+      { 0x27953eff70cb2, 0x54f22ae0ec552, 0x29f3da92e2724,
+        0x242ca0c22bd18, 0x34b8a8404d5ce },
+      { 0x6ecb583693335, 0x3ec76bfdfb84d, 0x2c895cf56a04f,
+        0x6355149d54d52, 0x71d62bdd465e1 }
+    },
+    {
+      { 0x5b5dab1f75ef5, 0x1e2d60cbeb9a5, 0x527c2175dfe57,
+        0x59e8a2b8ff51f, 0x1c333621262b2 },
+      { 0x3cc28d378df80, 0x72141f4968ca6, 0x407696bdb6d0d,
+        0x5d271b22ffcfb, 0x74d5f317f3172 },
+      { 0x7e55467d9ca81, 0x6a5653186f50d, 0x6b188ece62df1,
+        0x4c66d36844971, 0x4aebcc4547e9d }
+    }
+  },
+  {
+    {
+      { 0x08d9e7354b610, 0x26b750b6dc168, 0x162881e01acc9,
+        0x7966df31d01a5, 0x173bd9ddc9a1d },
+      { 0x0071b276d01c9, 0x0b0d8918e025e, 0x75beea79ee2eb,
+        0x3c92984094db8, 0x5d88fbf95a3db },
+      { 0x00f1efe5872df, 0x5da872318256a, 0x59ceb81635960,
+        0x18cf37693c764, 0x06e1cd13b19ea }
+    },
+    {
+      { 0x3af629e5b0353, 0x204f1a088e8e5, 0x10efc9ceea82e,
+        0x589863c2fa34b, 0x7f3a6a1a8d837 },
+      { 0x0ad516f166f23, 0x263f56d57c81a, 0x13422384638ca,
+        0x1331ff1af0a50, 0x3080603526e16 },
+      { 0x644395d3d800b, 0x2b9203dbedefc, 0x4b18ce656a355,
+        0x03f3466bc182c, 0x30d0fded2e513 }
+    },
+    {
+      { 0x4971e68b84750, 0x52ccc9779f396, 0x3e904ae8255c8,
+        0x4ecae46f39339, 0x4615084351c58 },
+      { 0x14d1af21233b3, 0x1de1989b39c0b, 0x52669dc6f6f9e,
+        0x43434b28c3fc7, 0x0a9214202c099 },
+      { 0x019c0aeb9a02e, 0x1a2c06995d792, 0x664cbb1571c44,
+        0x6ff0736fa80b2, 0x3bca0d2895ca5 }
+    },
+    {
+      { 0x08eb69ecc01bf, 0x5b4c8912df38d, 0x5ea7f8bc2f20e,
+        0x120e516caafaf, 0x4ea8b4038df28 },
+      { 0x031bc3c5d62a4, 0x7d9fe0f4c081e, 0x43ed51467f22c,
+        0x1e6cc0c1ed109, 0x5631deddae8f1 },
+      { 0x5460af1cad202, 0x0b4919dd0655d, 0x7c4697d18c14c,
+        0x231c890bba2a4, 0x24ce0930542ca }
+    },
+    {
+      { 0x7a155fdf30b85, 0x1c6c6e5d487f9, 0x24be1134bdc5a,
+        0x1405970326f32, 0x549928a7324f4 },
+      { 0x090f5fd06c106, 0x6abb1021e43fd, 0x232bcfad711a0,
+        0x3a5c13c047f37, 0x41d4e3c28a06d },
+      { 0x632a763ee1a2e, 0x6fa4bffbd5e4d, 0x5fd35a6ba4792,
+        0x7b55e1de99de8, 0x491b66dec0dcf }
+    },
+    {
+      { 0x04a8ed0da64a1, 0x5ecfc45096ebe, 0x5edee93b488b2,
+        0x5b3c11a51bc8f, 0x4cf6b8b0b7018 },
+      { 0x5b13dc7ea32a7, 0x18fc2db73131e, 0x7e3651f8f57e3,
+        0x25656055fa965, 0x08f338d0c85ee },
+      { 0x3a821991a73bd, 0x03be6418f5870, 0x1ddc18eac9ef0,
+        0x54ce09e998dc2, 0x530d4a82eb078 }
+    },
+    {
+      { 0x173456c9abf9e, 0x7892015100dad, 0x33ee14095fecb,
+        0x6ad95d67a0964, 0x0db3e7e00cbfb },
+      { 0x43630e1f94825, 0x4d1956a6b4009, 0x213fe2df8b5e0,
+        0x05ce3a41191e6, 0x65ea753f10177 },
+      { 0x6fc3ee2096363, 0x7ec36b96d67ac, 0x510ec6a0758b1,
+        0x0ed87df022109, 0x02a4ec1921e1a }
+    },
+    {
+      { 0x06162f1cf795f, 0x324ddcafe5eb9, 0x018d5e0463218,
+        0x7e78b9092428e, 0x36d12b5dec067 },
+      { 0x6259a3b24b8a2, 0x188b5f4170b9c, 0x681c0dee15deb,
+        0x4dfe665f37445, 0x3d143c5112780 },
+      { 0x5279179154557, 0x39f8f0741424d, 0x45e6eb357923d,
+        0x42c9b5edb746f, 0x2ef517885ba82 }
+    }
+  },
+  {
+    {
+      { 0x6bffb305b2f51, 0x5b112b2d712dd, 0x35774974fe4e2,
+        0x04af87a96e3a3, 0x57968290bb3a0 },
+      { 0x7974e8c58aedc, 0x7757e083488c6, 0x601c62ae7bc8b,
+        0x45370c2ecab74, 0x2f1b78fab143a },
+      { 0x2b8430a20e101, 0x1a49e1d88fee3, 0x38bbb47ce4d96,
+        0x1f0e7ba84d437, 0x7dc43e35dc2aa }
+    },
+    {
+      { 0x02a5c273e9718, 0x32bc9dfb28b4f, 0x48df4f8d5db1a,
+        0x54c87976c028f, 0x044fb81d82d50 },
+      { 0x66665887dd9c3, 0x629760a6ab0b2, 0x481e6c7243e6c,
+        0x097e37046fc77, 0x7ef72016758cc },
+      { 0x718c5a907e3d9, 0x3b9c98c6b383b, 0x006ed255eccdc,
+        0x6976538229a59, 0x7f79823f9c30d }
+    },
+    {
+      { 0x41ff068f587ba, 0x1c00a191bcd53, 0x7b56f9c209e25,
+        0x3781e5fccaabe, 0x64a9b0431c06d },
+      { 0x4d239a3b513e8, 0x29723f51b1066, 0x642f4cf04d9c3,
+        0x4da095aa09b7a, 0x0a4e0373d784d },
+      { 0x3d6a15b7d2919, 0x41aa75046a5d6, 0x691751ec2d3da,
+        0x23638ab6721c4, 0x071a7d0ace183 }
+    },
+    {
+      { 0x4355220e14431, 0x0e1362a283981, 0x2757cd8359654,
+        0x2e9cd7ab10d90, 0x7c69bcf761775 },
+      { 0x72daac887ba0b, 0x0b7f4ac5dda60, 0x3bdda2c0498a4,
+        0x74e67aa180160, 0x2c3bcc7146ea7 },
+      { 0x0d7eb04e8295f, 0x4a5ea1e6fa0fe, 0x45e635c436c60,
+        0x28ef4a8d4d18b, 0x6f5a9a7322aca }
+    },
+    {
+      { 0x1d4eba3d944be, 0x0100f15f3dce5, 0x61a700e367825,
+        0x5922292ab3d23, 0x02ab9680ee8d3 },
+      { 0x1000c2f41c6c5, 0x0219fdf737174, 0x314727f127de7,
+        0x7e5277d23b81e, 0x494e21a2e147a },
+      { 0x48a85dde50d9a, 0x1c1f734493df4, 0x47bdb64866889,
+        0x59a7d048f8eec, 0x6b5d76cbea46b }
+    },
+    {
+      { 0x141171e782522, 0x6806d26da7c1f, 0x3f31d1bc79ab9,
+        0x09f20459f5168, 0x16fb869c03dd3 },
+      { 0x7556cec0cd994, 0x5eb9a03b7510a, 0x50ad1dd91cb71,
+        0x1aa5780b48a47, 0x0ae333f685277 },
+      { 0x6199733b60962, 0x69b157c266511, 0x64740f893f1ca,
+        0x03aa408fbf684, 0x3f81e38b8f70d }
+    },
+    {
+      { 0x37f355f17c824, 0x07ae85334815b, 0x7e3abddd2e48f,
+        0x61eeabe1f45e5, 0x0ad3e2d34cded },
+      { 0x10fcc7ed9affe, 0x4248cb0e96ff2, 0x4311c115172e2,
+        0x4c9d41cbf6925, 0x50510fc104f50 },
+      { 0x40fc5336e249d, 0x3386639fb2de1, 0x7bbf871d17b78,
+        0x75f796b7e8004, 0x127c158bf0fa1 }
+    },
+    {
+      { 0x28fc4ae51b974, 0x26e89bfd2dbd4, 0x4e122a07665cf,
+        0x7cab1203405c3, 0x4ed82479d167d },
+      { 0x17c422e9879a2, 0x28a5946c8fec3, 0x53ab32e912b77,
+        0x7b44da09fe0a5, 0x354ef87d07ef4 },
+      { 0x3b52260c5d975, 0x79d6836171fdc, 0x7d994f140d4bb,
+        0x1b6c404561854, 0x302d92d205392 }
+    }
+  },
+  {
+    {
+      { 0x46fb6e4e0f177, 0x53497ad5265b7, 0x1ebdba01386fc,
+        0x0302f0cb36a3c, 0x0edc5f5eb426d },
+      { 0x3c1a2bca4283d, 0x23430c7bb2f02, 0x1a3ea1bb58bc2,
+        0x7265763de5c61, 0x10e5d3b76f1ca },
+      { 0x3bfd653da8e67, 0x584953ec82a8a, 0x55e288fa7707b,
+        0x5395fc3931d81, 0x45b46c51361cb }
+    },
+    {
+      { 0x54ddd8a7fe3e4, 0x2cecc41c619d3, 0x43a6562ac4d91,
+        0x4efa5aca7bdd9, 0x5c1c0aef32122 },
+      { 0x02abf314f7fa1, 0x391d19e8a1528, 0x6a2fa13895fc7,
+        0x09d8eddeaa591, 0x2177bfa36dcb7 },
+      { 0x01bbcfa79db8f, 0x3d84beb3666e1, 0x20c921d812204,
+        0x2dd843d3b32ce, 0x4ae619387d8ab }
+    },
+    {
+      { 0x17e44985bfb83, 0x54e32c626cc22, 0x096412ff38118,
+        0x6b241d61a246a, 0x75685abe5ba43 },
+      { 0x3f6aa5344a32e, 0x69683680f11bb, 0x04c3581f623aa,
+        0x701af5875cba5, 0x1a00d91b17bf3 },
+      { 0x60933eb61f2b2, 0x5193fe92a4dd2, 0x3d995a550f43e,
+        0x3556fb93a883d, 0x135529b623b0e }
+    },
+    {
+      { 0x716bce22e83fe, 0x33d0130b83eb8, 0x0952abad0afac,
+        0x309f64ed31b8a, 0x5972ea051590a },
+      { 0x0dbd7add1d518, 0x119f823e2231e, 0x451d66e5e7de2,
+        0x500c39970f838, 0x79b5b81a65ca3 },
+      { 0x4ac20dc8f7811, 0x29589a9f501fa, 0x4d810d26a6b4a,
+        0x5ede00d96b259, 0x4f7e9c95905f3 }
+    },
+    {
+      { 0x0443d355299fe, 0x39b7d7d5aee39, 0x692519a2f34ec,
+        0x6e4404924cf78, 0x1942eec4a144a },
+      { 0x74bbc5781302e, 0x73135bb81ec4c, 0x7ef671b61483c,
+        0x7264614ccd729, 0x31993ad92e638 },
+      { 0x45319ae234992, 0x2219d47d24fb5, 0x4f04488b06cf6,
+        0x53aaa9e724a12, 0x2a0a65314ef9c }
+    },
+    {
+      { 0x61acd3c1c793a, 0x58b46b78779e6, 0x3369aacbe7af2,
+        0x509b0743074d4, 0x055dc39b6dea1 },
+      { 0x7937ff7f927c2, 0x0c2fa14c6a5b6, 0x556bddb6dd07c,
+        0x6f6acc179d108, 0x4cf6e218647c2 },
+      { 0x1227cc28d5bb6, 0x78ee9bff57623, 0x28cb2241f893a,
+        0x25b541e3c6772, 0x121a307710aa2 }
+    },
+    {
+      { 0x1713ec77483c9, 0x6f70572d5facb, 0x25ef34e22ff81,
+        0x54d944f141188, 0x527bb94a6ced3 },
+      { 0x35d5e9f034a97, 0x126069785bc9b, 0x5474ec7854ff0,
+        0x296a302a348ca, 0x333fc76c7a40e },
+      { 0x5992a995b482e, 0x78dc707002ac7, 0x5936394d01741,
+        0x4fba4281aef17, 0x6b89069b20a7a }
+    },
+    {
+      { 0x2fa8cb5c7db77, 0x718e6982aa810, 0x39e95f81a1a1b,
+        0x5e794f3646cfb, 0x0473d308a7639 },
+      { 0x2a0416270220d, 0x75f248b69d025, 0x1cbbc16656a27,
+        0x5b9ffd6e26728, 0x23bc2103aa73e },
+      { 0x6792603589e05, 0x248db9892595d, 0x006a53cad2d08,
+        0x20d0150f7ba73, 0x102f73bfde043 }
+    }
+  },
+  {
+    {
+      { 0x4dae0b5511c9a, 0x5257fffe0d456, 0x54108d1eb2180,
+        0x096cc0f9baefa, 0x3f6bd725da4ea },
+      { 0x0b9ab7f5745c6, 0x5caf0f8d21d63, 0x7debea408ea2b,
+        0x09edb93896d16, 0x36597d25ea5c0 },
+      { 0x58d7b106058ac, 0x3cdf8d20bee69, 0x00a4cb765015e,
+        0x36832337c7cc9, 0x7b7ecc19da60d }
+    },
+    {
+      { 0x64a51a77cfa9b, 0x29cf470ca0db5, 0x4b60b6e0898d9,
+        0x55d04ddffe6c7, 0x03bedc661bf5c },
+      { 0x2373c695c690d, 0x4c0c8520dcf18, 0x384af4b7494b9,
+        0x4ab4a8ea22225, 0x4235ad7601743 },
+      { 0x0cb0d078975f5, 0x292313e530c4b, 0x38dbb9124a509,
+        0x350d0655a11f1, 0x0e7ce2b0cdf06 }
+    },
+    {
+      { 0x6fedfd94b70f9, 0x2383f9745bfd4, 0x4beae27c4c301,
+        0x75aa4416a3f3f, 0x615256138aece },
+      { 0x4643ac48c85a3, 0x6878c2735b892, 0x3a53523f4d877,
+        0x3a504ed8bee9d, 0x666e0a5d8fb46 },
+      { 0x3f64e4870cb0d, 0x61548b16d6557, 0x7a261773596f3,
+        0x7724d5f275d3a, 0x7f0bc810d514d }
+    },
+    {
+      { 0x49dad737213a0, 0x745dee5d31075, 0x7b1a55e7fdbe2,
+        0x5ba988f176ea1, 0x1d3a907ddec5a },
+      { 0x06ba426f4136f, 0x3cafc0606b720, 0x518f0a2359cda,
+        0x5fae5e46feca7, 0x0d1f8dbcf8eed },
+      { 0x693313ed081dc, 0x5b0a366901742, 0x40c872ca4ca7e,
+        0x6f18094009e01, 0x00011b44a31bf }
+    },
+    {
+      { 0x61f696a0aa75c, 0x38b0a57ad42ca, 0x1e59ab706fdc9,
+        0x01308d46ebfcd, 0x63d988a2d2851 },
+      { 0x7a06c3fc66c0c, 0x1c9bac1ba47fb, 0x23935c575038e,
+        0x3f0bd71c59c13, 0x3ac48d916e835 },
+      { 0x20753afbd232e, 0x71fbb1ed06002, 0x39cae47a4af3a,
+        0x0337c0b34d9c2, 0x33fad52b2368a }
+    },
+    {
+      { 0x4c8d0c422cfe8, 0x760b4275971a5, 0x3da95bc1cad3d,
+        0x0f151ff5b7376, 0x3cc355ccb90a7 },
+      { 0x649c6c5e41e16, 0x60667eee6aa80, 0x4179d182be190,
+        0x653d9567e6979, 0x16c0f429a256d },
+      { 0x69443903e9131, 0x16f4ac6f9dd36, 0x2ea4912e29253,
+        0x2b4643e68d25d, 0x631eaf426bae7 }
+    },
+    {
+      { 0x175b9a3700de8, 0x77c5f00aa48fb, 0x3917785ca0317,
+        0x05aa9b2c79399, 0x431f2c7f665f8 },
+      { 0x10410da66fe9f, 0x24d82dcb4d67d, 0x3e6fe0e17752d,
+        0x4dade1ecbb08f, 0x5599648b1ea91 },
+      { 0x26344858f7b19, 0x5f43d4a295ac0, 0x242a75c52acd4,
+        0x5934480220d10, 0x7b04715f91253 }
+    },
+    {
+      { 0x6c280c4e6bac6, 0x3ada3b361766e, 0x42fe5125c3b4f,
+        0x111d84d4aac22, 0x48d0acfa57cde },
+      { 0x5bd28acf6ae43, 0x16fab8f56907d, 0x7acb11218d5f2,
+        0x41fe02023b4db, 0x59b37bf5c2f65 },
+      { 0x726e47dabe671, 0x2ec45e746f6c1, 0x6580e53c74686,
+        0x5eda104673f74, 0x16234191336d3 }
+    }
+  },
+  {
+    {
+      { 0x19cd61ff38640, 0x060c6c4b41ba9, 0x75cf70ca7366f,
+        0x118a8f16c011e, 0x4a25707a203b9 },
+      { 0x499def6267ff6, 0x76e858108773c, 0x693cac5ddcb29,
+        0x00311d00a9ff4, 0x2cdfdfecd5d05 },
+      { 0x7668a53f6ed6a, 0x303ba2e142556, 0x3880584c10909,
+        0x4fe20000a261d, 0x5721896d248e4 }
+    },
+    {
+      { 0x55091a1d0da4e, 0x4f6bfc7c1050b, 0x64e4ecd2ea9be,
+        0x07eb1f28bbe70, 0x03c935afc4b03 },
+      { 0x65517fd181bae, 0x3e5772c76816d, 0x019189640898a,
+        0x1ed2a84de7499, 0x578edd74f63c1 },
+      { 0x276c6492b0c3d, 0x09bfc40bf932e, 0x588e8f11f330b,
+        0x3d16e694dc26e, 0x3ec2ab590288c }
+    },
+    {
+      { 0x13a09ae32d1cb, 0x3e81eb85ab4e4, 0x07aaca43cae1f,
+        0x62f05d7526374, 0x0e1bf66c6adba },
+      { 0x0d27be4d87bb9, 0x56c27235db434, 0x72e6e0ea62d37,
+        0x5674cd06ee839, 0x2dd5c25a200fc },
+      { 0x3d5e9792c887e, 0x319724dabbc55, 0x2b97c78680800,
+        0x7afdfdd34e6dd, 0x730548b35ae88 }
+    },
+    {
+      { 0x3094ba1d6e334, 0x6e126a7e3300b, 0x089c0aefcfbc5,
+        0x2eea11f836583, 0x585a2277d8784 },
+      { 0x551a3cba8b8ee, 0x3b6422be2d886, 0x630e1419689bc,
+        0x4653b07a7a955, 0x3043443b411db },
+      { 0x25f8233d48962, 0x6bd8f04aff431, 0x4f907fd9a6312,
+        0x40fd3c737d29b, 0x7656278950ef9 }
+    },
+    {
+      { 0x073a3ea86cf9d, 0x6e0e2abfb9c2e, 0x60e2a38ea33ee,
+        0x30b2429f3fe18, 0x28bbf484b613f },
+      { 0x3cf59d51fc8c0, 0x7a0a0d6de4718, 0x55c3a3e6fb74b,
+        0x353135f884fd5, 0x3f4160a8c1b84 },
+      { 0x12f5c6f136c7c, 0x0fedba237de4c, 0x779bccebfab44,
+        0x3aea93f4d6909, 0x1e79cb358188f }
+    },
+    {
+      { 0x153d8f5e08181, 0x08533bbdb2efd, 0x1149796129431,
+        0x17a6e36168643, 0x478ab52d39d1f },
+      { 0x436c3eef7e3f1, 0x7ffd3c21f0026, 0x3e77bf20a2da9,
+        0x418bffc8472de, 0x65d7951b3a3b3 },
+      { 0x6a4d39252d159, 0x790e35900ecd4, 0x30725bf977786,
+        0x10a5c1635a053, 0x16d87a411a212 }
+    },
+    {
+      { 0x4d5e2d54e0583, 0x2e5d7b33f5f74, 0x3a5de3f887ebf,
+        0x6ef24bd6139b7, 0x1f990b577a5a6 },
+      { 0x57e5a42066215, 0x1a18b44983677, 0x3e652de1e6f8f,
+        0x6532be02ed8eb, 0x28f87c8165f38 },
+      { 0x44ead1be8f7d6, 0x5759d4f31f466, 0x0378149f47943,
+        0x69f3be32b4f29, 0x45882fe1534d6 }
+    },
+    {
+      { 0x49929943c6fe4, 0x4347072545b15, 0x3226bced7e7c5,
+        0x03a134ced89df, 0x7dcf843ce405f },
+      { 0x1345d757983d6, 0x222f54234cccd, 0x1784a3d8adbb4,
+        0x36ebeee8c2bcc, 0x688fe5b8f626f },
+      { 0x0d6484a4732c0, 0x7b94ac6532d92, 0x5771b8754850f,
+        0x48dd9df1461c8, 0x6739687e73271 }
+    }
+  },
+  {
+    {
+      { 0x5cc9dc80c1ac0, 0x683671486d4cd, 0x76f5f1a5e8173,
+        0x6d5d3f5f9df4a, 0x7da0b8f68d7e7 },
+      { 0x02014385675a6, 0x6155fb53d1def, 0x37ea32e89927c,
+        0x059a668f5a82e, 0x46115aba1d4dc },
+      { 0x71953c3b5da76, 0x6642233d37a81, 0x2c9658076b1bd,
+        0x5a581e63010ff, 0x5a5f887e83674 }
+    },
+    {
+      { 0x628d3a0a643b9, 0x01cd8640c93d2, 0x0b7b0cad70f2c,
+        0x3864da98144be, 0x43e37ae2d5d1c },
+      { 0x301cf70a13d11, 0x2a6a1ba1891ec, 0x2f291fb3f3ae0,
+        0x21a7b814bea52, 0x3669b656e44d1 },
+      { 0x63f06eda6e133, 0x233342758070f, 0x098e0459cc075,
+        0x4df5ead6c7c1b, 0x6a21e6cd4fd5e }
+    },
+    {
+      { 0x129126699b2e3, 0x0ee11a2603de8, 0x60ac2f5c74c21,
+        0x59b192a196808, 0x45371b07001e8 },
+      { 0x6170a3046e65f, 0x5401a46a49e38, 0x20add5561c4a8,
+        0x7abb4edde9e46, 0x586bf9f1a195f },
+      { 0x3088d5ef8790b, 0x38c2126fcb4db, 0x685bae149e3c3,
+        0x0bcd601a4e930, 0x0eafb03790e52 }
+    },
+    {
+      { 0x0805e0f75ae1d, 0x464cc59860a28, 0x248e5b7b00bef,
+        0x5d99675ef8f75, 0x44ae3344c5435 },
+      { 0x555c13748042f, 0x4d041754232c0, 0x521b430866907,
+        0x3308e40fb9c39, 0x309acc675a02c },
+      { 0x289b9bba543ee, 0x3ab592e28539e, 0x64d82abcdd83a,
+        0x3c78ec172e327, 0x62d5221b7f946 }
+    },
+    {
+      { 0x5d4263af77a3c, 0x23fdd2289aeb0, 0x7dc64f77eb9ec,
+        0x01bd28338402c, 0x14f29a5383922 },
+      { 0x4299c18d0936d, 0x5914183418a49, 0x52a18c721aed5,
+        0x2b151ba82976d, 0x5c0efde4bc754 },
+      { 0x17edc25b2d7f5, 0x37336a6081bee, 0x7b5318887e5c3,
+        0x49f6d491a5be1, 0x5e72365c7bee0 }
+    },
+    {
+      { 0x339062f08b33e, 0x4bbf3e657cfb2, 0x67af7f56e5967,
+        0x4dbd67f9ed68f, 0x70b20555cb734 },
+      { 0x3fc074571217f, 0x3a0d29b2b6aeb, 0x06478ccdde59d,
+        0x55e4d051bddfa, 0x77f1104c47b4e },
+      { 0x113c555112c4c, 0x7535103f9b7ca, 0x140ed1d9a2108,
+        0x02522333bc2af, 0x0e34398f4a064 }
+    },
+    {
+      { 0x30b093e4b1928, 0x1ce7e7ec80312, 0x4e575bdf78f84,
+        0x61f7a190bed39, 0x6f8aded6ca379 },
+      { 0x522d93ecebde8, 0x024f045e0f6cf, 0x16db63426cfa1,
+        0x1b93a1fd30fd8, 0x5e5405368a362 },
+      { 0x0123dfdb7b29a, 0x4344356523c68, 0x79a527921ee5f,
+        0x74bfccb3e817e, 0x780de72ec8d3d }
+    },
+    {
+      { 0x7eaf300f42772, 0x5455188354ce3, 0x4dcca4a3dcbac,
+        0x3d314d0bfebcb, 0x1defc6ad32b58 },
+      { 0x28545089ae7bc, 0x1e38fe9a0c15c, 0x12046e0e2377b,
+        0x6721c560aa885, 0x0eb28bf671928 },
+      { 0x3be1aef5195a7, 0x6f22f62bdb5eb, 0x39768b8523049,
+        0x43394c8fbfdbd, 0x467d201bf8dd2 }
+    }
+  },
+  {
+    {
+      { 0x6f4bd567ae7a9, 0x65ac89317b783, 0x07d3b20fd8932,
+        0x000f208326916, 0x2ef9c5a5ba384 },
+      { 0x6919a74ef4fad, 0x59ed4611452bf, 0x691ec04ea09ef,
+        0x3cbcb2700e984, 0x71c43c4f5ba3c },
+      { 0x56df6fa9e74cd, 0x79c95e4cf56df, 0x7be643bc609e2,
+        0x149c12ad9e878, 0x5a758ca390c5f }
+    },
+    {
+      { 0x0918b1d61dc94, 0x0d350260cd19c, 0x7a2ab4e37b4d9,
+        0x21fea735414d7, 0x0a738027f639d },
+      { 0x72710d9462495, 0x25aafaa007456, 0x2d21f28eaa31b,
+        0x17671ea005fd0, 0x2dbae244b3eb7 },
+      { 0x74a2f57ffe1cc, 0x1bc3073087301, 0x7ec57f4019c34,
+        0x34e082e1fa524, 0x2698ca635126a }
+    },
+    {
+      { 0x5702f5e3dd90e, 0x31c9a4a70c5c7, 0x136a5aa78fc24,
+        0x1992f3b9f7b01, 0x3c004b0c4afa3 },
+      { 0x5318832b0ba78, 0x6f24b9ff17cec, 0x0a47f30e060c7,
+        0x58384540dc8d0, 0x1fb43dcc49cae },
+      { 0x146ac06f4b82b, 0x4b500d89e7355, 0x3351e1c728a12,
+        0x10b9f69932fe3, 0x6b43fd01cd1fd }
+    },
+    {
+      { 0x742583e760ef3, 0x73dc1573216b8, 0x4ae48fdd7714a,
+        0x4f85f8a13e103, 0x73420b2d6ff0d },
+      { 0x75d4b4697c544, 0x11be1fff7f8f4, 0x119e16857f7e1,
+        0x38a14345cf5d5, 0x5a68d7105b52f },
+      { 0x4f6cb9e851e06, 0x278c4471895e5, 0x7efcdce3d64e4,
+        0x64f6d455c4b4c, 0x3db5632fea34b }
+    },
+    {
+      { 0x190b1829825d5, 0x0e7d3513225c9, 0x1c12be3b7abae,
+        0x58777781e9ca6, 0x59197ea495df2 },
+      { 0x6ee2bf75dd9d8, 0x6c72ceb34be8d, 0x679c9cc345ec7,
+        0x7898df96898a4, 0x04321adf49d75 },
+      { 0x16019e4e55aae, 0x74fc5f25d209c, 0x4566a939ded0d,
+        0x66063e716e0b7, 0x45eafdc1f4d70 }
+    },
+    {
+      { 0x64624cfccb1ed, 0x257ab8072b6c1, 0x0120725676f0a,
+        0x4a018d04e8eee, 0x3f73ceea5d56d },
+      { 0x401858045d72b, 0x459e5e0ca2d30, 0x488b719308bea,
+        0x56f4a0d1b32b5, 0x5a5eebc80362d },
+      { 0x7bfd10a4e8dc6, 0x7c899366736f4, 0x55ebbeaf95c01,
+        0x46db060903f8a, 0x2605889126621 }
+    },
+    {
+      { 0x18e3cc676e542, 0x26079d995a990, 0x04a7c217908b2,
+        0x1dc7603e6655a, 0x0dedfa10b2444 },
+      { 0x704a68360ff04, 0x3cecc3cde8b3e, 0x21cd5470f64ff,
+        0x6abc18d953989, 0x54ad0c2e4e615 },
+      { 0x367d5b82b522a, 0x0d3f4b83d7dc7, 0x3067f4cdbc58d,
+        0x20452da697937, 0x62ecb2baa77a9 }
+    },
+    {
+      { 0x72836afb62874, 0x0af3c2094b240, 0x0c285297f357a,
+        0x7cc2d5680d6e3, 0x61913d5075663 },
+      { 0x5795261152b3d, 0x7a1dbbafa3cbd, 0x5ad31c52588d5,
+        0x45f3a4164685c, 0x2e59f919a966d },
+      { 0x62d361a3231da, 0x65284004e01b8, 0x656533be91d60,
+        0x6ae016c00a89f, 0x3ddbc2a131c05 }
+    }
+  },
+  {
+    {
+      { 0x257a22796bb14, 0x6f360fb443e75, 0x680e47220eaea,
+        0x2fcf2a5f10c18, 0x5ee7fb38d8320 },
+      { 0x40ff9ce5ec54b, 0x57185e261b35b, 0x3e254540e70a9,
+        0x1b5814003e3f8, 0x78968314ac04b },
+      { 0x5fdcb41446a8e, 0x5286926ff2a71, 0x0f231e296b3f6,
+        0x684a357c84693, 0x61d0633c9bca0 }
+    },
+    {
+      { 0x328bcf8fc73df, 0x3b4de06ff95b4, 0x30aa427ba11a5,
+        0x5ee31bfda6d9c, 0x5b23ac2df8067 },
+      { 0x44935ffdb2566, 0x12f016d176c6e, 0x4fbb00f16f5ae,
+        0x3fab78d99402a, 0x6e965fd847aed },
+      { 0x2b953ee80527b, 0x55f5bcdb1b35a, 0x43a0b3fa23c66,
+        0x76e07388b820a, 0x79b9bbb9dd95d }
+    },
+    {
+      { 0x17dae8e9f7374, 0x719f76102da33, 0x5117c2a80ca8b,
+        0x41a66b65d0936, 0x1ba811460accb },
+      { 0x355406a3126c2, 0x50d1918727d76, 0x6e5ea0b498e0e,
+        0x0a3b6063214f2, 0x5065f158c9fd2 },
+      { 0x169fb0c429954, 0x59aedd9ecee10, 0x39916eb851802,
+        0x57917555cc538, 0x3981f39e58a4f }
+    },
+    {
+      { 0x5dfa56de66fde, 0x0058809075908, 0x6d3d8cb854a94,
+        0x5b2f4e970b1e3, 0x30f4452edcbc1 },
+      { 0x38a7559230a93, 0x52c1cde8ba31f, 0x2a4f2d4745a3d,
+        0x07e9d42d4a28a, 0x38dc083705acd },
+      { 0x52782c5759740, 0x53f3397d990ad, 0x3a939c7e84d15,
+        0x234c4227e39e0, 0x632d9a1a593f2 }
+    },
+    {
+      { 0x1fd11ed0c84a7, 0x021b3ed2757e1, 0x73e1de58fc1c6,
+        0x5d110c84616ab, 0x3a5a7df28af64 },
+      { 0x36b15b807cba6, 0x3f78a9e1afed7, 0x0a59c2c608f1f,
+        0x52bdd8ecb81b7, 0x0b24f48847ed4 },
+      { 0x2d4be511beac7, 0x6bda4d99e5b9b, 0x17e6996914e01,
+        0x7b1f0ce7fcf80, 0x34fcf74475481 }
+    },
+    {
+      { 0x31dab78cfaa98, 0x4e3216e5e54b7, 0x249823973b689,
+        0x2584984e48885, 0x0119a3042fb37 },
+      { 0x7e04c789767ca, 0x1671b28cfb832, 0x7e57ea2e1c537,
+        0x1fbaaef444141, 0x3d3bdc164dfa6 },
+      { 0x2d89ce8c2177d, 0x6cd12ba182cf4, 0x20a8ac19a7697,
+        0x539fab2cc72d9, 0x56c088f1ede20 }
+    },
+    {
+      { 0x35fac24f38f02, 0x7d75c6197ab03, 0x33e4bc2a42fa7,
+        0x1c7cd10b48145, 0x038b7ea483590 },
+      { 0x53d1110a86e17, 0x6416eb65f466d, 0x41ca6235fce20,
+        0x5c3fc8a99bb12, 0x09674c6b99108 },
+      { 0x6f82199316ff8, 0x05d54f1a9f3e9, 0x3bcc5d0bd274a,
+        0x5b284b8d2d5ad, 0x6e5e31025969e }
+    },
+    {
+      { 0x4fb0e63066222, 0x130f59747e660, 0x041868fecd41a,
+        0x3105e8c923bc6, 0x3058ad43d1838 },
+      { 0x462f587e593fb, 0x3d94ba7ce362d, 0x330f9b52667b7,
+        0x5d45a48e0f00a, 0x08f5114789a8d },
+      { 0x40ffde57663d0, 0x71445d4c20647, 0x2653e68170f7c,
+        0x64cdee3c55ed6, 0x26549fa4efe3d }
+    }
+  },
+  {
+    {
+      { 0x68549af3f666e, 0x09e2941d4bb68, 0x2e8311f5dff3c,
+        0x6429ef91ffbd2, 0x3a10dfe132ce3 },
+      { 0x55a461e6bf9d6, 0x78eeef4b02e83, 0x1d34f648c16cf,
+        0x07fea2aba5132, 0x1926e1dc6401e },
+      { 0x74e8aea17cea0, 0x0c743f83fbc0f, 0x7cb03c4bf5455,
+        0x68a8ba9917e98, 0x1fa1d01d861e5 }
+    },
+    {
+      { 0x4ac00d1df94ab, 0x3ba2101bd271b, 0x7578988b9c4af,
+        0x0f2bf89f49f7e, 0x73fced18ee9a0 },
+      { 0x055947d599832, 0x346fe2aa41990, 0x0164c8079195b,
+        0x799ccfb7bba27, 0x773563bc6a75c },
+      { 0x1e90863139cb3, 0x4f8b407d9a0d6, 0x58e24ca924f69,
+        0x7a246bbe76456, 0x1f426b701b864 }
+    },
+    {
+      { 0x635c891a12552, 0x26aebd38ede2f, 0x66dc8faddae05,
+        0x21c7d41a03786, 0x0b76bb1b3fa7e },
+      { 0x1264c41911c01, 0x702f44584bdf9, 0x43c511fc68ede,
+        0x0482c3aed35f9, 0x4e1af5271d31b },
+      { 0x0c1f97f92939b, 0x17a88956dc117, 0x6ee005ef99dc7,
+        0x4aa9172b231cc, 0x7b6dd61eb772a }
+    },
+    {
+      { 0x0abf9ab01d2c7, 0x3880287630ae6, 0x32eca045beddb,
+        0x57f43365f32d0, 0x53fa9b659bff6 },
+      { 0x5c1e850f33d92, 0x1ec119ab9f6f5, 0x7f16f6de663e9,
+        0x7a7d6cb16dec6, 0x703e9bceaf1d2 },
+      { 0x4c8e994885455, 0x4ccb5da9cad82, 0x3596bc610e975,
+        0x7a80c0ddb9f5e, 0x398d93e5c4c61 }
+    },
+    {
+      { 0x77c60d2e7e3f2, 0x4061051763870, 0x67bc4e0ecd2aa,
+        0x2bb941f1373b9, 0x699c9c9002c30 },
+      { 0x3d16733e248f3, 0x0e2b7e14be389, 0x42c0ddaf6784a,
+        0x589ea1fc67850, 0x53b09b5ddf191 },
+      { 0x6a7235946f1cc, 0x6b99cbb2fbe60, 0x6d3a5d6485c62,
+        0x4839466e923c0, 0x51caf30c6fcdd }
+    },
+    {
+      { 0x2f99a18ac54c7, 0x398a39661ee6f, 0x384331e40cde3,
+        0x4cd15c4de19a6, 0x12ae29c189f8e },
+      { 0x3a7427674e00a, 0x6142f4f7e74c1, 0x4cc93318c3a15,
+        0x6d51bac2b1ee7, 0x5504aa292383f },
+      { 0x6c0cb1f0d01cf, 0x187469ef5d533, 0x27138883747bf,
+        0x2f52ae53a90e8, 0x5fd14fe958eba }
+    },
+    {
+      { 0x2fe5ebf93cb8e, 0x226da8acbe788, 0x10883a2fb7ea1,
+        0x094707842cf44, 0x7dd73f960725d },
+      { 0x42ddf2845ab2c, 0x6214ffd3276bb, 0x00b8d181a5246,
+        0x268a6d579eb20, 0x093ff26e58647 },
+      { 0x524fe68059829, 0x65b75e47cb621, 0x15eb0a5d5cc19,
+        0x05209b3929d5a, 0x2f59bcbc86b47 }
+    },
+    {
+      { 0x1d560b691c301, 0x7f5bafce3ce08, 0x4cd561614806c,
+        0x4588b6170b188, 0x2aa55e3d01082 },
+      { 0x47d429917135f, 0x3eacfa07af070, 0x1deab46b46e44,
+        0x7a53f3ba46cdf, 0x5458b42e2e51a },
+      { 0x192e60c07444f, 0x5ae8843a21daa, 0x6d721910b1538,
+        0x3321a95a6417e, 0x13e9004a8a768 }
+    }
+  },
+  {
+    {
+      { 0x600c9193b877f, 0x21c1b8a0d7765, 0x379927fb38ea2,
+        0x70d7679dbe01b, 0x5f46040898de9 },
+      { 0x58845832fcedb, 0x135cd7f0c6e73, 0x53ffbdfe8e35b,
+        0x22f195e06e55b, 0x73937e8814bce },
+      { 0x37116297bf48d, 0x45a9e0d069720, 0x25af71aa744ec,
+        0x41af0cb8aaba3, 0x2cf8a4e891d5e }
+    },
+    {
+      { 0x5487e17d06ba2, 0x3872a032d6596, 0x65e28c09348e0,
+        0x27b6bb2ce40c2, 0x7a6f7f2891d6a },
+      { 0x3fd8707110f67, 0x26f8716a92db2, 0x1cdaa1b753027,
+        0x504be58b52661, 0x2049bd6e58252 },
+      { 0x1fd8d6a9aef49, 0x7cb67b7216fa1, 0x67aff53c3b982,
+        0x20ea610da9628, 0x6011aadfc5459 }
+    },
+    {
+      { 0x6d0c802cbf890, 0x141bfed554c7b, 0x6dbb667ef4263,
+        0x58f3126857edc, 0x69ce18b779340 },
+      { 0x7926dcf95f83c, 0x42e25120e2bec, 0x63de96df1fa15,
+        0x4f06b50f3f9cc, 0x6fc5cc1b0b62f },
+      { 0x75528b29879cb, 0x79a8fd2125a3d, 0x27c8d4b746ab8,
+        0x0f8893f02210c, 0x15596b3ae5710 }
+    },
+    {
+      { 0x731167e5124ca, 0x17b38e8bbe13f, 0x3d55b942f9056,
+        0x09c1495be913f, 0x3aa4e241afb6d },
+      { 0x739d23f9179a2, 0x632fadbb9e8c4, 0x7c8522bfe0c48,
+        0x6ed0983ef5aa9, 0x0d2237687b5f4 },
+      { 0x138bf2a3305f5, 0x1f45d24d86598, 0x5274bad2160fe,
+        0x1b6041d58d12a, 0x32fcaa6e4687a }
+    },
+    {
+      { 0x7a4732787ccdf, 0x11e427c7f0640, 0x03659385f8c64,
+        0x5f4ead9766bfb, 0x746f6336c2600 },
+      { 0x56e8dc57d9af5, 0x5b3be17be4f78, 0x3bf928cf82f4b,
+        0x52e55600a6f11, 0x4627e9cefebd6 },
+      { 0x2f345ab6c971c, 0x653286e63e7e9, 0x51061b78a23ad,
+        0x14999acb54501, 0x7b4917007ed66 }
+    },
+    {
+      { 0x41b28dd53a2dd, 0x37be85f87ea86, 0x74be3d2a85e41,
+        0x1be87fac96ca6, 0x1d03620fe08cd },
+      { 0x5fb5cab84b064, 0x2513e778285b0, 0x457383125e043,
+        0x6bda3b56e223d, 0x122ba376f844f },
+      { 0x232cda2b4e554, 0x0422ba30ff840, 0x751e7667b43f5,
+        0x6261755da5f3e, 0x02c70bf52b68e }
+    },
+    {
+      { 0x532bf458d72e1, 0x40f96e796b59c, 0x22ef79d6f9da3,
+        0x501ab67beca77, 0x6b0697e3feb43 },
+      { 0x7ec4b5d0b2fbb, 0x200e910595450, 0x742057105715e,
+        0x2f07022530f60, 0x26334f0a409ef },
+      { 0x0f04adf62a3c0, 0x5e0edb48bb6d9, 0x7c34aa4fbc003,
+        0x7d74e4e5cac24, 0x1cc37f43441b2 }
+    },
+    {
+      { 0x656f1c9ceaeb9, 0x7031cacad5aec, 0x1308cd0716c57,
+        0x41c1373941942, 0x3a346f772f196 },
+      { 0x7565a5cc7324f, 0x01ca0d5244a11, 0x116b067418713,
+        0x0a57d8c55edae, 0x6c6809c103803 },
+      { 0x55112e2da6ac8, 0x6363d0a3dba5a, 0x319c98ba6f40c,
+        0x2e84b03a36ec7, 0x05911b9f6ef7c }
+    }
+  },
+  {
+    {
+      { 0x1acf3512eeaef, 0x2639839692a69, 0x669a234830507,
+        0x68b920c0603d4, 0x555ef9d1c64b2 },
+      { 0x39983f5df0ebb, 0x1ea2589959826, 0x6ce638703cdd6,
+        0x6311678898505, 0x6b3cecf9aa270 },
+      { 0x770ba3b73bd08, 0x11475f7e186d4, 0x0251bc9892bbc,
+        0x24eab9bffcc5a, 0x675f4de133817 }
+    },
+    {
+      { 0x7f6d93bdab31d, 0x1f3aca5bfd425, 0x2fa521c1c9760,
+        0x62180ce27f9cd, 0x60f450b882cd3 },
+      { 0x452036b1782fc, 0x02d95b07681c5, 0x5901cf99205b2,
+        0x290686e5eecb4, 0x13d99df70164c },
+      { 0x35ec321e5c0ca, 0x13ae337f44029, 0x4008e813f2da7,
+        0x640272f8e0c3a, 0x1c06de9e55eda }
+    },
+    {
+      { 0x52b40ff6d69aa, 0x31b8809377ffa, 0x536625cd14c2c,
+        0x516af252e17d1, 0x78096f8e7d32b },
+      { 0x77ad6a33ec4e2, 0x717c5dc11d321, 0x4a114559823e4,
+        0x306ce50a1e2b1, 0x4cf38a1fec2db },
+      { 0x2aa650dfa5ce7, 0x54916a8f19415, 0x00dc96fe71278,
+        0x55f2784e63eb8, 0x373cad3a26091 }
+    },
+    {
+      { 0x6a8fb89ddbbad, 0x78c35d5d97e37, 0x66e3674ef2cb2,
+        0x34347ac53dd8f, 0x21547eda5112a },
+      { 0x4634d82c9f57c, 0x4249268a6d652, 0x6336d687f2ff7,
+        0x4fe4f4e26d9a0, 0x0040f3d945441 },
+      { 0x5e939fd5986d3, 0x12a2147019bdf, 0x4c466e7d09cb2,
+        0x6fa5b95d203dd, 0x63550a334a254 }
+    },
+    {
+      { 0x2584572547b49, 0x75c58811c1377, 0x4d3c637cc171b,
+        0x33d30747d34e3, 0x39a92bafaa7d7 },
+      { 0x7d6edb569cf37, 0x60194a5dc2ca0, 0x5af59745e10a6,
+        0x7a8f53e004875, 0x3eea62c7daf78 },
+      { 0x4c713e693274e, 0x6ed1b7a6eb3a4, 0x62ace697d8e15,
+        0x266b8292ab075, 0x68436a0665c9c }
+    },
+    {
+      { 0x6d317e820107c, 0x090815d2ca3ca, 0x03ff1eb1499a1,
+        0x23960f050e319, 0x5373669c91611 },
+      { 0x235e8202f3f27, 0x44c9f2eb61780, 0x630905b1d7003,
+        0x4fcc8d274ead1, 0x17b6e7f68ab78 },
+      { 0x014ab9a0e5257, 0x09939567f8ba5, 0x4b47b2a423c82,
+        0x688d7e57ac42d, 0x1cb4b5a678f87 }
+    },
+    {
+      { 0x4aa62a2a007e7, 0x61e0e38f62d6e, 0x02f888fcc4782,
+        0x7562b83f21c00, 0x2dc0fd2d82ef6 },
+      { 0x4c06b394afc6c, 0x4931b4bf636cc, 0x72b60d0322378,
+        0x25127c6818b25, 0x330bca78de743 },
+      { 0x6ff841119744e, 0x2c560e8e49305, 0x7254fefe5a57a,
+        0x67ae2c560a7df, 0x3c31be1b369f1 }
+    },
+    {
+      { 0x0bc93f9cb4272, 0x3f8f9db73182d, 0x2b235eabae1c4,
+        0x2ddbf8729551a, 0x41cec1097e7d5 },
+      { 0x4864d08948aee, 0x5d237438df61e, 0x2b285601f7067,
+        0x25dbcbae6d753, 0x330b61134262d },
+      { 0x619d7a26d808a, 0x3c3b3c2adbef2, 0x6877c9eec7f52,
+        0x3beb9ebe1b66d, 0x26b44cd91f287 }
+    }
+  },
+  {
+    {
+      { 0x7f29362730383, 0x7fd7951459c36, 0x7504c512d49e7,
+        0x087ed7e3bc55f, 0x7deb10149c726 },
+      { 0x048478f387475, 0x69397d9678a3e, 0x67c8156c976f3,
+        0x2eb4d5589226c, 0x2c709e6c1c10a },
+      { 0x2af6a8766ee7a, 0x08aaa79a1d96c, 0x42f92d59b2fb0,
+        0x1752c40009c07, 0x08e68e9ff62ce }
+    },
+    {
+      { 0x509d50ab8f2f9, 0x1b8ab247be5e5, 0x5d9b2e6b2e486,
+        0x4faa5479a1339, 0x4cb13bd738f71 },
+      { 0x5500a4bc130ad, 0x127a17a938695, 0x02a26fa34e36d,
+        0x584d12e1ecc28, 0x2f1f3f87eeba3 },
+      { 0x48c75e515b64a, 0x75b6952071ef0, 0x5d46d42965406,
+        0x7746106989f9f, 0x19a1e353c0ae2 }
+    },
+    {
+      { 0x172cdd596bdbd, 0x0731ddf881684, 0x10426d64f8115,
+        0x71a4fd8a9a3da, 0x736bd3990266a },
+      { 0x47560bafa05c3, 0x418dcabcc2fa3, 0x35991cecf8682,
+        0x24371a94b8c60, 0x41546b11c20c3 },
+      { 0x32d509334b3b4, 0x16c102cae70aa, 0x1720dd51bf445,
+        0x5ae662faf9821, 0x412295a2b87fa }
+    },
+    {
+      { 0x55261e293eac6, 0x06426759b65cc, 0x40265ae116a48,
+        0x6c02304bae5bc, 0x0760bb8d195ad },
+      { 0x19b88f57ed6e9, 0x4cdbf1904a339, 0x42b49cd4e4f2c,
+        0x71a2e771909d9, 0x14e153ebb52d2 },
+      { 0x61a17cde6818a, 0x53dad34108827, 0x32b32c55c55b6,
+        0x2f9165f9347a3, 0x6b34be9bc33ac }
+    },
+    {
+      { 0x469656571f2d3, 0x0aa61ce6f423f, 0x3f940d71b27a1,
+        0x185f19d73d16a, 0x01b9c7b62e6dd },
+      { 0x72f643a78c0b2, 0x3de45c04f9e7b, 0x706d68d30fa5c,
+        0x696f63e8e2f24, 0x2012c18f0922d },
+      { 0x355e55ac89d29, 0x3e8b414ec7101, 0x39db07c520c90,
+        0x6f41e9b77efe1, 0x08af5b784e4ba }
+    },
+    {
+      { 0x314d289cc2c4b, 0x23450e2f1bc4e, 0x0cd93392f92f4,
+        0x1370c6a946b7d, 0x6423c1d5afd98 },
+      { 0x499dc881f2533, 0x34ef26476c506, 0x4d107d2741497,
+        0x346c4bd6efdb3, 0x32b79d71163a1 },
+      { 0x5f8d9edfcb36a, 0x1e6e8dcbf3990, 0x7974f348af30a,
+        0x6e6724ef19c7c, 0x480a5efbc13e2 }
+    },
+    {
+      { 0x14ce442ce221f, 0x18980a72516cc, 0x072f80db86677,
+        0x703331fda526e, 0x24b31d47691c8 },
+      { 0x1e70b01622071, 0x1f163b5f8a16a, 0x56aaf341ad417,
+        0x7989635d830f7, 0x47aa27600cb7b },
+      { 0x41eedc015f8c3, 0x7cf8d27ef854a, 0x289e3584693f9,
+        0x04a7857b309a7, 0x545b585d14dda }
+    },
+    {
+      { 0x4e4d0e3b321e1, 0x7451fe3d2ac40, 0x666f678eea98d,
+        0x038858667fead, 0x4d22dc3e64c8d },
+      { 0x7275ea0d43a0f, 0x681137dd7ccf7, 0x1e79cbab79a38,
+        0x22a214489a66a, 0x0f62f9c332ba5 },
+      { 0x46589d63b5f39, 0x7eaf979ec3f96, 0x4ebe81572b9a8,
+        0x21b7f5d61694a, 0x1c0fa01a36371 }
+    }
+  },
+  {
+    {
+      { 0x02b0e8c936a50, 0x6b83b58b6cd21, 0x37ed8d3e72680,
+        0x0a037db9f2a62, 0x4005419b1d2bc },
+      { 0x604b622943dff, 0x1c899f6741a58, 0x60219e2f232fb,
+        0x35fae92a7f9cb, 0x0fa3614f3b1ca },
+      { 0x3febdb9be82f0, 0x5e74895921400, 0x553ea38822706,
+        0x5a17c24cfc88c, 0x1fba218aef40a }
+    },
+    {
+      { 0x657043e7b0194, 0x5c11b55efe9e7, 0x7737bc6a074fb,
+        0x0eae41ce355cc, 0x6c535d13ff776 },
+      { 0x49448fac8f53e, 0x34f74c6e8356a, 0x0ad780607dba2,
+        0x7213a7eb63eb6, 0x392e3acaa8c86 },
+      { 0x534e93e8a35af, 0x08b10fd02c997, 0x26ac2acb81e05,
+        0x09d8c98ce3b79, 0x25e17fe4d50ac }
+    },
+    {
+      { 0x77ff576f121a7, 0x4e5f9b0fc722b, 0x46f949b0d28c8,
+        0x4cde65d17ef26, 0x6bba828f89698 },
+      { 0x09bd71e04f676, 0x25ac841f2a145, 0x1a47eac823871,
+        0x1a8a8c36c581a, 0x255751442a9fb },
+      { 0x1bc6690fe3901, 0x314132f5abc5a, 0x611835132d528,
+        0x5f24b8eb48a57, 0x559d504f7f6b7 }
+    },
+    {
+      { 0x091e7f6d266fd, 0x36060ef037389, 0x18788ec1d1286,
+        0x287441c478eb0, 0x123ea6a3354bd },
+      { 0x38378b3eb54d5, 0x4d4aaa78f94ee, 0x4a002e875a74d,
+        0x10b851367b17c, 0x01ab12d5807e3 },
+      { 0x5189041e32d96, 0x05b062b090231, 0x0c91766e7b78f,
+        0x0aa0f55a138ec, 0x4a3961e2c918a }
+    },
+    {
+      { 0x7d644f3233f1e, 0x1c69f9e02c064, 0x36ae5e5266898,
+        0x08fc1dad38b79, 0x68aceead9bd41 },
+      { 0x43be0f8e6bba0, 0x68fdffc614e3b, 0x4e91dab5b3be0,
+        0x3b1d4c9212ff0, 0x2cd6bce3fb1db },
+      { 0x4c90ef3d7c210, 0x496f5a0818716, 0x79cf88cc239b8,
+        0x2cb9c306cf8db, 0x595760d5b508f }
+    },
+    {
+      { 0x2cbebfd022790, 0x0b8822aec1105, 0x4d1cfd226bccc,
+        0x515b2fa4971be, 0x2cb2c5df54515 },
+      { 0x1bfe104aa6397, 0x11494ff996c25, 0x64251623e5800,
+        0x0d49fc5e044be, 0x709fa43edcb29 },
+      { 0x25d8c63fd2aca, 0x4c5cd29dffd61, 0x32ec0eb48af05,
+        0x18f9391f9b77c, 0x70f029ecf0c81 }
+    },
+    {
+      { 0x2afaa5e10b0b9, 0x61de08355254d, 0x0eb587de3c28d,
+        0x4f0bb9f7dbbd5, 0x44eca5a2a74bd },
+      { 0x307b32eed3e33, 0x6748ab03ce8c2, 0x57c0d9ab810bc,
+        0x42c64a224e98c, 0x0b7d5d8a6c314 },
+      { 0x448327b95d543, 0x0146681e3a4ba, 0x38714adc34e0c,
+        0x4f26f0e298e30, 0x272224512c7de }
+    },
+    {
+      { 0x3bb8a42a975fc, 0x6f2d5b46b17ef, 0x7b6a9223170e5,
+        0x053713fe3b7e6, 0x19735fd7f6bc2 },
+      { 0x492af49c5342e, 0x2365cdf5a0357, 0x32138a7ffbb60,
+        0x2a1f7d14646fe, 0x11b5df18a44cc },
+      { 0x390d042c84266, 0x1efe32a8fdc75, 0x6925ee7ae1238,
+        0x4af9281d0e832, 0x0fef911191df8 }
+    }
+  }
+};
+
+/* Bi[i] = (2*i+1)*B */
+static const ge_precomp Bi[8] = {
+  {
+    { 0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7,
+      0x5329385a44c32, 0x07cf9d3a33d4b },
+    { 0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c,
+      0x133d2e0c21a34, 0x44fd2f9298f81 },
+    { 0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0,
+      0x2d42d0dbee5ee, 0x6f117b689f0c6 }
+  },
+  {
+    { 0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10,
+      0x47a608da8014f, 0x7a164e1b9a80f },
+    { 0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f,
+      0x5314098f98d10, 0x2ab91587555bd },
+    { 0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c,
+      0x26368b872a2c6, 0x5a2826af12b9b }
+  },
+  {
+    { 0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123,
+      0x375ee8df5862d, 0x2945ccf146e20 },
+    { 0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053,
+      0x2f9f19e788e5c, 0x154a7e73eb1b5 },
+    { 0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820,
+      0x34d5a0db3858d, 0x43aabe696b3bb }
+  },
+  {
+    { 0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4,
+      0x13f38d9294114, 0x461bea69283c9 },
+    { 0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085,
+      0x3f04ef53b27c9, 0x1d6edd5d2e531 },
+    { 0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d,
+      0x053a94e20dd2c, 0x7a9fbb1c6a0f9 }
+  },
+  {
+    { 0x6678aa6a8632f, 0x5ea3788d8b365, 0x21bd6d6994279,
+      0x7ace75919e4e3, 0x34b9ed338add7 },
+    { 0x6217e039d8064, 0x6dea408337e6d, 0x57ac112628206,
+      0x647cb65e30473, 0x49c05a51fadc9 },
+    { 0x4e8bf9045af1b, 0x514e33a45e0d6, 0x7533c5b8bfe0f,
+      0x583557b7e14c9, 0x73c172021b008 }
+  },
+  {
+    { 0x700848a802ade, 0x1e04605c4e5f7, 0x5c0d01b9767fb,
+      0x7d7889f42388b, 0x4275aae2546d8 },
+    { 0x75b0249864348, 0x52ee11070262b, 0x237ae54fb5acd,
+      0x3bfd1d03aaab5, 0x18ab598029d5c },
+    { 0x32cc5fd6089e9, 0x426505c949b05, 0x46a18880c7ad2,
+      0x4a4221888ccda, 0x3dc65522b53df }
+  },
+  {
+    { 0x0c222a2007f6d, 0x356b79bdb77ee, 0x41ee81efe12ce,
+      0x120a9bd07097d, 0x234fd7eec346f },
+    { 0x7013b327fbf93, 0x1336eeded6a0d, 0x2b565a2bbf3af,
+      0x253ce89591955, 0x0267882d17602 },
+    { 0x0a119732ea378, 0x63bf1ba8e2a6c, 0x69f94cc90df9a,
+      0x431d1779bfc48, 0x497ba6fdaa097 }
+  },
+  {
+    { 0x6cc0313cfeaa0, 0x1a313848da499, 0x7cb534219230a,
+      0x39596dedefd60, 0x61e22917f12de },
+    { 0x3cd86468ccf0b, 0x48553221ac081, 0x6c9464b4e0a6e,
+      0x75fba84180403, 0x43b5cd4218d05 },
+    { 0x2762f9bd0b516, 0x1c6e7fbddcbb3, 0x75909c3ace2bd,
+      0x42101972d3ec9, 0x511d61210ae4d }
+  }
+};
+#endif /* CURVED25519_ASM_64BIT */
+
+#ifndef CURVED25519_ASM
+static void ge_precomp_0(ge_precomp *h)
+{
+    fe_1(h->yplusx);
+    fe_1(h->yminusx);
+    fe_0(h->xy2d);
+}
+#endif
+
+static void ge_p2_0(ge_p2 *h)
+{
+    fe_0(h->X);
+    fe_1(h->Y);
+    fe_1(h->Z);
+}
+
+static void ge_p3_0(ge_p3 *h)
+{
+    fe_0(h->X);
+    fe_1(h->Y);
+    fe_1(h->Z);
+    fe_0(h->T);
+}
+
+/* r = p */
+static void ge_p3_to_p2(ge_p2 *r,const ge_p3 *p)
+{
+    fe_copy(r->X,p->X);
+    fe_copy(r->Y,p->Y);
+    fe_copy(r->Z,p->Z);
+}
+
+/* r = p */
+static WC_INLINE void ge_p3_to_cached(ge_cached *r,const ge_p3 *p)
+{
+    fe_add(r->YplusX,p->Y,p->X);
+    fe_sub(r->YminusX,p->Y,p->X);
+    fe_copy(r->Z,p->Z);
+    fe_mul(r->T2d,p->T,d2);
+}
+
+/* r = p */
+static WC_INLINE void ge_p1p1_to_p2(ge_p2 *r,const ge_p1p1 *p)
+{
+#ifndef CURVED25519_ASM
+    fe_mul(r->X,p->X,p->T);
+    fe_mul(r->Y,p->Y,p->Z);
+    fe_mul(r->Z,p->Z,p->T);
+#else
+    fe_ge_to_p2(r->X, r->Y, r->Z, p->X, p->Y, p->Z, p->T);
+#endif
+}
+
+/* r = p */
+static WC_INLINE void ge_p1p1_to_p3(ge_p3 *r,const ge_p1p1 *p)
+{
+#ifndef CURVED25519_ASM
+    fe_mul(r->X,p->X,p->T);
+    fe_mul(r->Y,p->Y,p->Z);
+    fe_mul(r->Z,p->Z,p->T);
+    fe_mul(r->T,p->X,p->Y);
+#else
+    fe_ge_to_p3(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z, p->T);
+#endif
+}
+
+/* r = 2 * p */
+static WC_INLINE void ge_p2_dbl(ge_p1p1 *r,const ge_p2 *p)
+{
+#ifndef CURVED25519_ASM
+    ge t0;
+    fe_sq(r->X,p->X);
+    fe_sq(r->Z,p->Y);
+    fe_sq2(r->T,p->Z);
+    fe_add(r->Y,p->X,p->Y);
+    fe_sq(t0,r->Y);
+    fe_add(r->Y,r->Z,r->X);
+    fe_sub(r->Z,r->Z,r->X);
+    fe_sub(r->X,t0,r->Y);
+    fe_sub(r->T,r->T,r->Z);
+#else
+    fe_ge_dbl(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z);
+#endif
+}
+
+/* r = 2 * p */
+static void ge_p3_dbl(ge_p1p1 *r,const ge_p3 *p)
+{
+    ge_p2 q;
+    ge_p3_to_p2(&q,p);
+    ge_p2_dbl(r,&q);
+}
+
+/* r = p + q */
+static WC_INLINE void ge_madd(ge_p1p1 *r,const ge_p3 *p,const ge_precomp *q)
+{
+#ifndef CURVED25519_ASM
+    ge t0;
+    fe_add(r->X,p->Y,p->X);
+    fe_sub(r->Y,p->Y,p->X);
+    fe_mul(r->Z,r->X,q->yplusx);
+    fe_mul(r->Y,r->Y,q->yminusx);
+    fe_mul(r->T,q->xy2d,p->T);
+    fe_add(t0,p->Z,p->Z);
+    fe_sub(r->X,r->Z,r->Y);
+    fe_add(r->Y,r->Z,r->Y);
+    fe_add(r->Z,t0,r->T);
+    fe_sub(r->T,t0,r->T);
+#else
+    fe_ge_madd(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z, p->T, q->xy2d,
+               q->yplusx, q->yminusx);
+#endif
+}
+
+/* r = p - q */
+static WC_INLINE void ge_msub(ge_p1p1 *r,const ge_p3 *p,const ge_precomp *q)
+{
+#ifndef CURVED25519_ASM
+    ge t0;
+    fe_add(r->X,p->Y,p->X);
+    fe_sub(r->Y,p->Y,p->X);
+    fe_mul(r->Z,r->X,q->yminusx);
+    fe_mul(r->Y,r->Y,q->yplusx);
+    fe_mul(r->T,q->xy2d,p->T);
+    fe_add(t0,p->Z,p->Z);
+    fe_sub(r->X,r->Z,r->Y);
+    fe_add(r->Y,r->Z,r->Y);
+    fe_sub(r->Z,t0,r->T);
+    fe_add(r->T,t0,r->T);
+#else
+    fe_ge_msub(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z, p->T, q->xy2d,
+               q->yplusx, q->yminusx);
+#endif
+}
+
+/* r = p + q */
+static WC_INLINE void ge_add(ge_p1p1 *r,const ge_p3 *p,const ge_cached *q)
+{
+#ifndef CURVED25519_ASM
+    ge t0;
+    fe_add(r->X,p->Y,p->X);
+    fe_sub(r->Y,p->Y,p->X);
+    fe_mul(r->Z,r->X,q->YplusX);
+    fe_mul(r->Y,r->Y,q->YminusX);
+    fe_mul(r->T,q->T2d,p->T);
+    fe_mul(r->X,p->Z,q->Z);
+    fe_add(t0,r->X,r->X);
+    fe_sub(r->X,r->Z,r->Y);
+    fe_add(r->Y,r->Z,r->Y);
+    fe_add(r->Z,t0,r->T);
+    fe_sub(r->T,t0,r->T);
+#else
+    fe_ge_add(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z, p->T, q->Z, q->T2d,
+              q->YplusX, q->YminusX);
+#endif
+}
+
+/* r = p - q */
+static WC_INLINE void ge_sub(ge_p1p1 *r,const ge_p3 *p,const ge_cached *q)
+{
+#ifndef CURVED25519_ASM
+    ge t0;
+    fe_add(r->X,p->Y,p->X);
+    fe_sub(r->Y,p->Y,p->X);
+    fe_mul(r->Z,r->X,q->YminusX);
+    fe_mul(r->Y,r->Y,q->YplusX);
+    fe_mul(r->T,q->T2d,p->T);
+    fe_mul(r->X,p->Z,q->Z);
+    fe_add(t0,r->X,r->X);
+    fe_sub(r->X,r->Z,r->Y);
+    fe_add(r->Y,r->Z,r->Y);
+    fe_sub(r->Z,t0,r->T);
+    fe_add(r->T,t0,r->T);
+#else
+    fe_ge_sub(r->X, r->Y, r->Z, r->T, p->X, p->Y, p->Z, p->T, q->Z, q->T2d,
+              q->YplusX, q->YminusX);
+#endif
+}
+
+#ifndef CURVED25519_ASM
+static unsigned char equal(signed char b,signed char c)
+{
+    unsigned char ub = (unsigned char)b;
+    unsigned char uc = (unsigned char)c;
+    unsigned char x = ub ^ uc;  /* 0: yes; 1..255: no */
+    word32 y = x;               /* 0: yes; 1..255: no */
+    y -= 1;                     /* 4294967295: yes; 0..254: no */
+    y >>= 31;                   /* 1: yes; 0: no */
+    return (unsigned char)y;
+}
+
+static unsigned char negative(signed char b)
+{
+    return ((unsigned char)b) >> 7;
+}
+
+static WC_INLINE void cmov(ge_precomp *t,const ge_precomp *u,unsigned char b)
+{
+    fe_cmov(t->yplusx,u->yplusx,b);
+    fe_cmov(t->yminusx,u->yminusx,b);
+    fe_cmov(t->xy2d,u->xy2d,b);
+}
+#endif
+
+/* Constant time select of entry |b| from base[pos], negated when b < 0. */
+static void ge_select(ge_precomp *t,int pos,signed char b)
+{
+#ifndef CURVED25519_ASM
+    ge_precomp minust;
+    unsigned char bnegative = negative(b);
+    unsigned char babs = (unsigned char)(b - (((-bnegative) & b) * 2));
+
+    ge_precomp_0(t);
+    cmov(t,&base[pos][0],equal((signed char)babs,1));
+    cmov(t,&base[pos][1],equal((signed char)babs,2));
+    cmov(t,&base[pos][2],equal((signed char)babs,3));
+    cmov(t,&base[pos][3],equal((signed char)babs,4));
+    cmov(t,&base[pos][4],equal((signed char)babs,5));
+    cmov(t,&base[pos][5],equal((signed char)babs,6));
+    cmov(t,&base[pos][6],equal((signed char)babs,7));
+    cmov(t,&base[pos][7],equal((signed char)babs,8));
+    fe_copy(minust.yplusx,t->yminusx);
+    fe_copy(minust.yminusx,t->yplusx);
+    fe_neg(minust.xy2d,t->xy2d);
+    cmov(t,&minust,bnegative);
+#else
+    fe_cmov_table((fe*)t, (fe*)base[pos], b);
+#endif
+}
+
+/*
+h = a * B
+where a = a[0]+256*a[1]+...+256^31 a[31]
+B is the Ed25519 base point (x,4/5) with x positive.
+
+Preconditions:
+  a[31] <= 127
+*/
+void ge_scalarmult_base(ge_p3 *h,const unsigned char *a)
+{
+    signed char e[64];
+    signed char carry;
+    ge_p1p1 r;
+    ge_p2 s;
+    ge_precomp t;
+    int i;
+
+    for (i = 0;i < 32;++i) {
+        e[2 * i + 0] = (a[i] >> 0) & 15;
+        e[2 * i + 1] = (a[i] >> 4) & 15;
+    }
+    /* each e[i] is between 0 and 15 */
+    /* e[63] is between 0 and 7 */
+
+    carry = 0;
+    for (i = 0;i < 63;++i) {
+        e[i] += carry;
+        carry = e[i] + 8;
+        carry >>= 4;
+        e[i] -= carry << 4;
+    }
+    e[63] += carry;
+    /* each e[i] is between -8 and 8 */
+
+    ge_p3_0(h);
+    for (i = 1;i < 64;i += 2) {
+        ge_select(&t,i / 2,e[i]);
+        ge_madd(&r,h,&t); ge_p1p1_to_p3(h,&r);
+    }
+
+    ge_p3_dbl(&r,h);  ge_p1p1_to_p2(&s,&r);
+    ge_p2_dbl(&r,&s); ge_p1p1_to_p2(&s,&r);
+    ge_p2_dbl(&r,&s); ge_p1p1_to_p2(&s,&r);
+    ge_p2_dbl(&r,&s); ge_p1p1_to_p3(h,&r);
+
+    for (i = 0;i < 64;i += 2) {
+        ge_select(&t,i / 2,e[i]);
+        ge_madd(&r,h,&t); ge_p1p1_to_p3(h,&r);
+    }
+
+    ForceZero(e, sizeof(e));
+}
+
+/* Convert the scalar to signed odd digits, at most 15 in magnitude, with at
+ * least six zeros between non-zero digits where possible.
+ */
+static void slide(signed char *r,const unsigned char *a)
+{
+    int i;
+    int b;
+    int k;
+
+    for (i = 0;i < 256;++i)
+        r[i] = 1 & (a[i >> 3] >> (i & 7));
+
+    for (i = 0;i < 256;++i) {
+        if (r[i]) {
+            for (b = 1;b <= 6 && i + b < 256;++b) {
+                if (r[i + b]) {
+                    if (r[i] + (r[i + b] << b) <= 15) {
+                        r[i] += r[i + b] << b; r[i + b] = 0;
+                    } else if (r[i] - (r[i + b] << b) >= -15) {
+                        r[i] -= r[i + b] << b;
+                        for (k = i + b;k < 256;++k) {
+                            if (!r[k]) {
+                                r[k] = 1;
+                                break;
+                            }
+                            r[k] = 0;
+                        }
+                    } else
+                        break;
+                }
+            }
+        }
+    }
+}
+
+/*
+r = a * A + b * B
+where a = a[0]+256*a[1]+...+256^31 a[31].
+and b = b[0]+256*b[1]+...+256^31 b[31].
+B is the Ed25519 base point (x,4/5) with x positive.
+
+Not constant time - only used with public values.
+*/
+int ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a,
+                                 const ge_p3 *A, const unsigned char *b)
+{
+    signed char aslide[256];
+    signed char bslide[256];
+    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+    ge_p1p1 t;
+    ge_p3 u;
+    ge_p3 A2;
+    int i;
+
+    slide(aslide,a);
+    slide(bslide,b);
+
+    ge_p3_to_cached(&Ai[0],A);
+    ge_p3_dbl(&t,A); ge_p1p1_to_p3(&A2,&t);
+    for (i = 0; i < 7; i++) {
+        ge_add(&t,&A2,&Ai[i]); ge_p1p1_to_p3(&u,&t);
+        ge_p3_to_cached(&Ai[i + 1],&u);
+    }
+
+    ge_p2_0(r);
+
+    for (i = 255;i >= 0;--i) {
+        if (aslide[i] || bslide[i]) break;
+    }
+
+    for (;i >= 0;--i) {
+        ge_p2_dbl(&t,r);
+
+        if (aslide[i] > 0) {
+            ge_p1p1_to_p3(&u,&t);
+            ge_add(&t,&u,&Ai[aslide[i]/2]);
+        } else if (aslide[i] < 0) {
+            ge_p1p1_to_p3(&u,&t);
+            ge_sub(&t,&u,&Ai[(-aslide[i])/2]);
+        }
+
+        if (bslide[i] > 0) {
+            ge_p1p1_to_p3(&u,&t);
+            ge_madd(&t,&u,&Bi[bslide[i]/2]);
+        } else if (bslide[i] < 0) {
+            ge_p1p1_to_p3(&u,&t);
+            ge_msub(&t,&u,&Bi[(-bslide[i])/2]);
+        }
+
+        ge_p1p1_to_p2(r,&t);
+    }
+
+    return 0;
+}
+
+#ifdef HAVE_ED25519_VERIFY
+
+#ifndef GE_MSM_MAX_WINDOW
+    /* Largest window in bits: 2^(w-1) buckets are kept. */
+    #define GE_MSM_MAX_WINDOW 10
+#endif
+
+/* Get the c bits of the 256-bit little-endian scalar a starting at bit i.
+ * Bits beyond the end of the scalar are zero.
+ */
+static WC_INLINE int ge_msm_bits(const unsigned char *a, int i, int c)
+{
+    int    j = i >> 3;
+    word32 v = 0;
+
+    if (j < 32)
+        v = a[j];
+    if (j + 1 < 32)
+        v |= (word32)a[j + 1] << 8;
+    if (j + 2 < 32)
+        v |= (word32)a[j + 2] << 16;
+
+    return (int)((v >> (i & 7)) & ((1U << c) - 1));
+}
+
+/* Pick the window size with the fewest point additions for n points:
+ * each window costs one addition per point and two per bucket.
+ */
+static int ge_msm_window(int n)
+{
+    int  c;
+    int  best = 2;
+    long bestCost = 0;
+
+    for (c = 2; c <= GE_MSM_MAX_WINDOW; c++) {
+        long cost = (long)(256 / c + 1) * (n + (1L << c));
+        if (c == 2 || cost < bestCost) {
+            best = c;
+            bestCost = cost;
+        }
+    }
+
+    return best;
+}
+
+/*
+r = s[0] * P[0] + s[1] * P[1] + ... + s[n-1] * P[n-1]
+where s[i] is the 32 byte little-endian scalar at s + 32 * i.
+
+Pippenger's bucket method: the scalars are recoded into signed c-bit digits
+and, for each window from the top, the points are sorted into 2^(c-1)
+buckets by digit magnitude. The buckets are summed with running sums so
+that bucket k is counted k times.
+
+Not constant time - only used with public values.
+
+returns 0 on success and MEMORY_E when the work space can't be allocated.
+*/
+int ge_multi_scalarmult_vartime(ge_p3 *r, const unsigned char *s,
+                                const ge_p3 *P, int n, void* heap)
+{
+    int        c = ge_msm_window(n);
+    int        nwin = 256 / c + 2;
+    int        nb = 1 << (c - 1);
+    ge_cached* Pc;
+    ge_p3*     bucket;
+    sword16*   digit;
+    byte*      used;
+    ge_cached  q;
+    ge_p1p1    t;
+    ge_p3      run;
+    ge_p2      p2;
+    int        rSet = 0;
+    int        runSet;
+    int        i;
+    int        j;
+    int        k;
+
+    Pc = (ge_cached*)XMALLOC(sizeof(ge_cached) * n + sizeof(ge_p3) * nb +
+                             sizeof(sword16) * n * nwin + nb, heap,
+                             DYNAMIC_TYPE_TMP_BUFFER);
+    if (Pc == NULL)
+        return MEMORY_E;
+    bucket = (ge_p3*)(Pc + n);
+    digit = (sword16*)(bucket + nb);
+    used = (byte*)(digit + n * nwin);
+    (void)heap;
+
+    /* Signed digits in [-2^(c-1), 2^(c-1)) with the carry moved up. */
+    for (i = 0; i < n; i++) {
+        int carry = 0;
+
+        for (j = 0; j < nwin; j++) {
+            int v = ge_msm_bits(s + 32 * i, j * c, c) + carry;
+
+            carry = (v >= nb);
+            digit[i * nwin + j] = (sword16)(v - (carry << c));
+        }
+        ge_p3_to_cached(&Pc[i], &P[i]);
+    }
+
+    ge_p3_0(r);
+
+    for (j = nwin - 1; j >= 0; j--) {
+        if (rSet) {
+            ge_p3_to_p2(&p2, r);
+            for (k = 1; k < c; k++) {
+                ge_p2_dbl(&t, &p2);
+                ge_p1p1_to_p2(&p2, &t);
+            }
+            ge_p2_dbl(&t, &p2);
+            ge_p1p1_to_p3(r, &t);
+        }
+
+        XMEMSET(used, 0, nb);
+        for (i = 0; i < n; i++) {
+            int dig = digit[i * nwin + j];
+
+            if (dig > 0) {
+                k = dig - 1;
+                if (used[k]) {
+                    ge_add(&t, &bucket[k], &Pc[i]);
+                    ge_p1p1_to_p3(&bucket[k], &t);
+                }
+                else {
+                    bucket[k] = P[i];
+                    used[k] = 1;
+                }
+            }
+            else if (dig < 0) {
+                k = -dig - 1;
+                if (used[k]) {
+                    ge_sub(&t, &bucket[k], &Pc[i]);
+                    ge_p1p1_to_p3(&bucket[k], &t);
+                }
+                else {
+                    bucket[k] = P[i];
+                    fe_neg(bucket[k].X, bucket[k].X);
+                    fe_neg(bucket[k].T, bucket[k].T);
+                    used[k] = 1;
+                }
+            }
+        }
+
+        /* r += 1 * bucket[0] + 2 * bucket[1] + ... + nb * bucket[nb-1] */
+        runSet = 0;
+        for (k = nb - 1; k >= 0; k--) {
+            if (used[k]) {
+                if (runSet) {
+                    ge_p3_to_cached(&q, &bucket[k]);
+                    ge_add(&t, &run, &q);
+                    ge_p1p1_to_p3(&run, &t);
+                }
+                else {
+                    run = bucket[k];
+                    runSet = 1;
+                }
+            }
+            if (runSet) {
+                if (rSet) {
+                    ge_p3_to_cached(&q, &run);
+                    ge_add(&t, r, &q);
+                    ge_p1p1_to_p3(r, &t);
+                }
+                else {
+                    *r = run;
+                    rSet = 1;
+                }
+            }
+        }
+    }
+
+    XFREE(Pc, heap, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return 0;
+}
+#endif /* HAVE_ED25519_VERIFY */
+
+/* Decode the encoded point s into h and negate it.
+ *
+ * returns 0 on success and -1 when s is not the encoding of a point.
+ */
+int ge_frombytes_negate_vartime(ge_p3 *h,const unsigned char *s)
+{
+    ge u;
+    ge v;
+    ge v3;
+    ge vxx;
+    ge check;
+
+    fe_frombytes(h->Y,s);
+    fe_1(h->Z);
+    fe_sq(u,h->Y);
+    fe_mul(v,u,d);
+    fe_sub(u,u,h->Z);       /* u = y^2-1 */
+    fe_add(v,v,h->Z);       /* v = dy^2+1 */
+
+    fe_sq(v3,v);
+    fe_mul(v3,v3,v);        /* v3 = v^3 */
+    fe_sq(h->X,v3);
+    fe_mul(h->X,h->X,v);
+    fe_mul(h->X,h->X,u);    /* x = uv^7 */
+
+    fe_pow22523(h->X,h->X); /* x = (uv^7)^((q-5)/8) */
+    fe_mul(h->X,h->X,v3);
+    fe_mul(h->X,h->X,u);    /* x = uv^3(uv^7)^((q-5)/8) */
+
+    fe_sq(vxx,h->X);
+    fe_mul(vxx,vxx,v);
+    fe_sub(check,vxx,u);    /* vx^2-u */
+    if (fe_isnonzero(check)) {
+        fe_add(check,vxx,u);  /* vx^2+u */
+        if (fe_isnonzero(check))
+            return -1;
+        fe_mul(h->X,h->X,sqrtm1);
+    }
+
+    if (fe_isnegative(h->X) == (s[31] >> 7))
+        fe_neg(h->X,h->X);
+
+    fe_mul(h->T,h->X,h->Y);
+    return 0;
+}
+
+/* Encode the point h into 32 bytes. */
+void ge_tobytes(unsigned char *s,const ge_p2 *h)
+{
+    ge recip;
+    ge x;
+    ge y;
+
+    fe_invert(recip,h->Z);
+    fe_mul(x,h->X,recip);
+    fe_mul(y,h->Y,recip);
+    fe_tobytes(s,y);
+    s[31] ^= (unsigned char)(fe_isnegative(x) << 7);
+}
+
+/* Encode the point h into 32 bytes. */
+void ge_p3_tobytes(unsigned char *s,const ge_p3 *h)
+{
+    ge recip;
+    ge x;
+    ge y;
+
+    fe_invert(recip,h->Z);
+    fe_mul(x,h->X,recip);
+    fe_mul(y,h->Y,recip);
+    fe_tobytes(s,y);
+    s[31] ^= (unsigned char)(fe_isnegative(x) << 7);
+}
+
+/* Compress the affine point (x,y), given as big-endian byte arrays, into the
+ * 32 byte little-endian encoding.
+ *
+ * returns 0 on success.
+ */
+int ge_compress_key(byte* out, const byte* xIn, const byte* yIn, word32 keySz)
+{
+    ge_p2  g;
+    byte   x[ED25519_PUB_KEY_SIZE];
+    byte   y[ED25519_PUB_KEY_SIZE];
+    word32 i;
+
+    if (keySz != ED25519_PUB_KEY_SIZE)
+        return BAD_FUNC_ARG;
+
+    for (i = 0; i < keySz; i++) {
+        x[keySz - 1 - i] = xIn[i];
+        y[keySz - 1 - i] = yIn[i];
+    }
+
+    fe_frombytes(g.X, x);
+    fe_frombytes(g.Y, y);
+    fe_1(g.Z);
+
+    ge_tobytes(out, &g);
+
+    return 0;
+}
+
+#endif /* HAVE_ED25519 */
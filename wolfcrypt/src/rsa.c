@@ -2444,6 +2444,56 @@ int wc_RsaSSL_VerifyInline(byte* in, word32 inLen, byte** out, RsaKey* key)
     return ret;
 }
 
+#ifndef WOLF_CRYPTO_CB_ONLY_RSA
+/* Verify a PKCS #1 v1.5 signature in place like wc_RsaSSL_VerifyInline().
+ *
+ * The key's state and data fields are not used, only n and e are read, so a
+ * decoded public key can be shared by threads verifying at the same time.
+ * Not for keys that need asynchronous, non-blocking or device operations.
+ *
+ * in     Signature to decrypt and unpad in place.
+ * inLen  Length of signature in bytes.
+ * out    Pointer to the unpadded data in in.
+ * key    Public key.
+ * returns length of unpadded data on success, otherwise a negative error.
+ */
+int wc_RsaSSL_VerifyInlineShared(byte* in, word32 inLen, byte** out,
+                                 RsaKey* key)
+{
+    int    ret;
+    word32 len = inLen;
+    byte*  pad = NULL;
+
+    if (in == NULL || inLen == 0 || out == NULL || key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    SAVE_VECTOR_REGISTERS(return _svr_ret;);
+    ret = wc_RsaFunctionSync(in, inLen, in, &len, RSA_PUBLIC_DECRYPT, key,
+                             NULL);
+    RESTORE_VECTOR_REGISTERS();
+    if (ret >= 0) {
+        ret = wc_RsaUnPad_ex(in, len, &pad, RSA_BLOCK_TYPE_1,
+                             WC_RSA_PKCSV15_PAD, WC_HASH_TYPE_NONE,
+                             WC_MGF1NONE, NULL, 0, 0, mp_count_bits(&key->n),
+                             key->heap);
+    }
+    if (ret > (int)inLen) {
+        ret = RSA_BUFFER_E;
+    }
+#ifndef WOLFSSL_RSA_DECRYPT_TO_0_LEN
+    else if (ret == 0) {
+        ret = RSA_BUFFER_E;
+    }
+#endif
+    else if (ret > 0) {
+        *out = pad;
+    }
+
+    return ret;
+}
+#endif /* !WOLF_CRYPTO_CB_ONLY_RSA */
+
 #ifndef WOLFSSL_RSA_VERIFY_ONLY
 int wc_RsaSSL_Verify(const byte* in, word32 inLen, byte* out, word32 outLen,
                                                                  RsaKey* key)
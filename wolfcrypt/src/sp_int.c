@@ -4586,6 +4586,51 @@ int sp_exch(sp_int* a, sp_int* b)
     return err;
 }
 
+/* Conditionally swap the values in a and b in constant time.
+ *
+ * The same memory is accessed whether or not the swap takes place.
+ *
+ * @param  [in,out]  a  SP integer to swap.
+ * @param  [in,out]  b  SP integer to swap.
+ * @param  [in]      c  Count of digits to swap.
+ * @param  [in]      m  Swap when 1, leave unchanged when 0.
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_VAL when a or b is NULL or c is larger than either size.
+ */
+int sp_cond_swap_ct(sp_int* a, sp_int* b, int c, int m)
+{
+    int err = MP_OKAY;
+    int i;
+    sp_int_digit mask = (sp_int_digit)0 - (sp_int_digit)m;
+    sp_int_digit t;
+
+    if ((a == NULL) || (b == NULL)) {
+        err = MP_VAL;
+    }
+    if ((err == MP_OKAY) && ((c < 0) || (a->size < c) || (b->size < c))) {
+        err = MP_VAL;
+    }
+
+    if (err == MP_OKAY) {
+        t = ((sp_int_digit)a->used ^ (sp_int_digit)b->used) & mask;
+        a->used ^= (int)t;
+        b->used ^= (int)t;
+    #ifdef WOLFSSL_SP_INT_NEGATIVE
+        t = ((sp_int_digit)a->sign ^ (sp_int_digit)b->sign) & mask;
+        a->sign ^= (int)t;
+        b->sign ^= (int)t;
+    #endif
+        for (i = 0; i < c; i++) {
+            t = (a->dp[i] ^ b->dp[i]) & mask;
+            a->dp[i] ^= t;
+            b->dp[i] ^= t;
+        }
+    }
+
+    return err;
+}
+
 
 #ifdef WOLFSSL_SP_INT_NEGATIVE
 /* Calculate the absolute value of the multi-precision number.
@@ -5095,6 +5140,14 @@ int sp_cmp_d(sp_int* a, sp_int_digit d)
 #if defined(WOLFSSL_SP_MATH_ALL)
 #define WOLFSSL_SP_INVMOD_MONT_CT
 #endif
+#if defined(WOLFSSL_SP_MATH_ALL) && (SP_WORD_SIZE == 64) && \
+    !defined(WOLFSSL_SP_NO_DIVSTEP)
+#define WOLFSSL_SP_INVMOD_DIVSTEP
+#endif
+#if defined(WOLFSSL_SP_MATH_ALL) && !defined(WOLFSSL_SP_SMALL) && \
+    !defined(WOLFSSL_SP_NO_KARATSUBA)
+#define WOLFSSL_SP_KARATSUBA
+#endif
 #if (defined(WOLFSSL_SP_MATH_ALL) && !defined(WOLFSSL_RSA_VERIFY_ONLY) &&  !defined(WOLFSSL_RSA_PUBLIC_ONLY)) || defined(WOLFSSL_HAVE_SP_DH) ||  defined(WOLFSSL_KEY_GEN)
 #define WOLFSSL_SP_PRIME_GEN
 #endif
@@ -9592,6 +9645,210 @@ static int _sp_mul_96(sp_int* a, sp_int* b, sp_int* r)
 #endif /* SQR_MUL_ASM && WOLFSSL_SP_INT_LARGE_COMBA */
 #endif /* !WOLFSSL_SP_SMALL */
 
+#ifdef WOLFSSL_SP_KARATSUBA
+/* Minimum number of digits in each operand before multiplication splits the
+ * operands in half with Karatsuba. Below this the comba code is faster.
+ */
+#ifndef SP_KARATSUBA_MUL_MIN
+    #define SP_KARATSUBA_MUL_MIN    (2048 / SP_WORD_SIZE)
+#endif
+/* Minimum number of digits before squaring is done with Karatsuba. */
+#ifndef SP_KARATSUBA_SQR_MIN
+    #define SP_KARATSUBA_SQR_MIN    (3072 / SP_WORD_SIZE)
+#endif
+
+/* Subtract b from a, each with n digits, and store the absolute value in r.
+ *
+ * Constant time.
+ *
+ * @param  [out]  r   Array of n digits to hold |a - b|.
+ * @param  [in]   a   Array of digits.
+ * @param  [in]   an  Number of digits in a. No more than n.
+ * @param  [in]   b   Array of n digits.
+ * @param  [in]   n   Number of digits.
+ *
+ * @return  All bits set when a is less than b, 0 otherwise.
+ */
+static sp_int_digit _sp_kara_sub_abs(sp_int_digit* r, const sp_int_digit* a,
+    int an, const sp_int_digit* b, int n)
+{
+    int i;
+    sp_int_digit neg;
+    sp_int_digit c = 0;
+
+    /* r = a - b, borrow into c. */
+    for (i = 0; i < n; i++) {
+        sp_int_digit ad = (i < an) ? a[i] : 0;
+        sp_int_sword t = (sp_int_sword)ad - b[i] - c;
+
+        r[i] = (sp_int_digit)t;
+        c = (sp_int_digit)0 - (sp_int_digit)(t >> SP_WORD_SIZE);
+    }
+    neg = (sp_int_digit)0 - c;
+    /* Negate when borrowed: r = (r ^ neg) + 1 */
+    c = neg & 1;
+    for (i = 0; i < n; i++) {
+        sp_int_word t = (sp_int_word)(r[i] ^ neg) + c;
+
+        r[i] = (sp_int_digit)t;
+        c = (sp_int_digit)(t >> SP_WORD_SIZE);
+    }
+
+    return neg;
+}
+
+/* Add a, n digits, into r at offset and propagate the carry up to rn digits.
+ *
+ * Constant time.
+ *
+ * @param  [in, out]  r   Array of rn digits.
+ * @param  [in]       rn  Number of digits in r.
+ * @param  [in]       a   Array of n digits to add.
+ * @param  [in]       n   Number of digits in a.
+ * @param  [in]       o   Offset into r to add a at.
+ */
+static void _sp_kara_add(sp_int_digit* r, int rn, const sp_int_digit* a,
+    int n, int o)
+{
+    int i;
+    sp_int_digit c = 0;
+
+    for (i = 0; i < n; i++) {
+        sp_int_word t = (sp_int_word)r[o + i] + a[i] + c;
+
+        r[o + i] = (sp_int_digit)t;
+        c = (sp_int_digit)(t >> SP_WORD_SIZE);
+    }
+    for (i += o; i < rn; i++) {
+        sp_int_word t = (sp_int_word)r[i] + c;
+
+        r[i] = (sp_int_digit)t;
+        c = (sp_int_digit)(t >> SP_WORD_SIZE);
+    }
+}
+
+/* Calculate middle term of Karatsuba: z1 = z0 + z2 - p, or + p when add is
+ * all bits set. Result is stored in p.
+ *
+ * Constant time. z1 is a non-negative number of n digits and n is large enough
+ * that two's complement arithmetic modulo 2^(n*SP_WORD_SIZE) is exact.
+ *
+ * @param  [in, out]  p    Array of n digits. Product of differences.
+ * @param  [in]       z0   Array of digits. Product of low halves.
+ * @param  [in]       z0n  Number of digits in z0.
+ * @param  [in]       z2   Array of digits. Product of high halves.
+ * @param  [in]       z2n  Number of digits in z2.
+ * @param  [in]       n    Number of digits in the result.
+ * @param  [in]       add  All bits set to add p, 0 to subtract p.
+ */
+static void _sp_kara_mid(sp_int_digit* p, const sp_int_digit* z0, int z0n,
+    const sp_int_digit* z2, int z2n, int n, sp_int_digit add)
+{
+    int i;
+    sp_int_digit sub = ~add;
+    sp_int_digit c0 = sub & 1;
+    sp_int_digit c1 = 0;
+
+    /* p = z0 + z2 + (add ? p : ~p + 1) */
+    for (i = 0; i < n; i++) {
+        sp_int_digit d0 = (i < z0n) ? z0[i] : 0;
+        sp_int_digit d2 = (i < z2n) ? z2[i] : 0;
+        sp_int_word t = (sp_int_word)(p[i] ^ sub) + c0 + d0;
+
+        c0 = (sp_int_digit)(t >> SP_WORD_SIZE);
+        t = (sp_int_word)(sp_int_digit)t + d2 + c1;
+        c1 = (sp_int_digit)(t >> SP_WORD_SIZE);
+        p[i] = (sp_int_digit)t;
+    }
+}
+
+/* Multiply a by b into r using Karatsuba: r = a * b
+ *
+ * a and b have the same number of digits, n. With a = a1.B^h + a0 and
+ * b = b1.B^h + b0:
+ *   z0 = a0.b0, z2 = a1.b1, z1 = z0 + z2 - (a0 - a1).(b0 - b1)
+ *   r  = z2.B^2h + z1.B^h + z0
+ * The three products are calculated with sp_mul() so the comba code is used
+ * for the halves. Digit counts depend only on n so timing does not depend on
+ * the values.
+ *
+ * @param  [in]   a  SP integer to multiply.
+ * @param  [in]   b  SP integer to multiply.
+ * @param  [out]  r  SP integer result.
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_MEM when dynamic memory allocation fails.
+ */
+static int _sp_mul_karatsuba(sp_int* a, sp_int* b, sp_int* r)
+{
+    int err = MP_OKAY;
+    int n = a->used;
+    int h = n / 2;
+    int hh = n - h;
+    sp_int_digit neg;
+    sp_int* x = NULL;
+    sp_int* y = NULL;
+    sp_int* z0 = NULL;
+    sp_int* z2 = NULL;
+    sp_int* p = NULL;
+    DECL_SP_INT_ARRAY(t, 2 * hh + 1, 5);
+
+    ALLOC_SP_INT_ARRAY(t, 2 * hh + 1, 5, err, NULL);
+    if (err == MP_OKAY) {
+        x = t[0];
+        y = t[1];
+        z0 = t[2];
+        z2 = t[3];
+        p = t[4];
+        sp_init_size(x, 2 * hh + 1);
+        sp_init_size(y, 2 * hh + 1);
+        sp_init_size(z0, 2 * hh + 1);
+        sp_init_size(z2, 2 * hh + 1);
+        sp_init_size(p, 2 * hh + 1);
+
+        /* z0 = a0 * b0 */
+        XMEMCPY(x->dp, a->dp, h * sizeof(sp_int_digit));
+        XMEMCPY(y->dp, b->dp, h * sizeof(sp_int_digit));
+        x->used = h;
+        y->used = h;
+        err = sp_mul(x, y, z0);
+    }
+    if (err == MP_OKAY) {
+        /* z2 = a1 * b1 */
+        XMEMCPY(x->dp, a->dp + h, hh * sizeof(sp_int_digit));
+        XMEMCPY(y->dp, b->dp + h, hh * sizeof(sp_int_digit));
+        x->used = hh;
+        y->used = hh;
+        err = sp_mul(x, y, z2);
+    }
+    if (err == MP_OKAY) {
+        /* p = |a0 - a1| * |b0 - b1| */
+        neg  = _sp_kara_sub_abs(x->dp, a->dp, h, a->dp + h, hh);
+        neg ^= _sp_kara_sub_abs(y->dp, b->dp, h, b->dp + h, hh);
+        x->used = hh;
+        y->used = hh;
+        err = sp_mul(x, y, p);
+    }
+    if (err == MP_OKAY) {
+        /* Products have all digits set before clamping - use full lengths.
+         * p = z0 + z2 - (a0 - a1) * (b0 - b1) */
+        p->dp[2 * hh] = 0;
+        _sp_kara_mid(p->dp, z0->dp, 2 * h, z2->dp, 2 * hh, 2 * hh + 1,
+            neg);
+
+        /* a and b no longer needed - r may be either. */
+        XMEMCPY(r->dp, z0->dp, 2 * h * sizeof(sp_int_digit));
+        XMEMCPY(r->dp + 2 * h, z2->dp, 2 * hh * sizeof(sp_int_digit));
+        _sp_kara_add(r->dp, 2 * n, p->dp, 2 * hh + 1, h);
+        r->used = 2 * n;
+        sp_clamp(r);
+    }
+
+    FREE_SP_INT_ARRAY(t, NULL);
+    return err;
+}
+#endif /* WOLFSSL_SP_KARATSUBA */
+
 /* Multiply a by b and store in r: r = a * b
  *
  * @param  [in]   a  SP integer to multiply.
@@ -9706,6 +9963,12 @@ int sp_mul(sp_int* a, sp_int* b, sp_int* r)
 #endif /* SQR_MUL_ASM && WOLFSSL_SP_INT_LARGE_COMBA */
 #endif /* !WOLFSSL_SP_SMALL */
 
+#ifdef WOLFSSL_SP_KARATSUBA
+        if ((a->used == b->used) && (a->used >= SP_KARATSUBA_MUL_MIN)) {
+            err = _sp_mul_karatsuba(a, b, r);
+        }
+        else
+#endif
 #ifdef SQR_MUL_ASM
         if (a->used == b->used) {
             err = _sp_mul_nxn(a, b, r);
@@ -9929,8 +10192,491 @@ int sp_invmod(sp_int* a, sp_int* m, sp_int* r)
     return err;
 }
 
+#ifdef WOLFSSL_SP_INVMOD_DIVSTEP
+
+/* Number of divsteps performed per batch and bits in a limb. */
+#define SP_DS_BITS          62
+/* Mask for a limb. */
+#define SP_DS_MASK          ((sp_uint64)0x3fffffffffffffffUL)
+/* Limbs needed for values in the range (-2m, m) of the largest modulus. */
+#define SP_DS_MAX_LIMBS     ((SP_INT_DIGITS * SP_WORD_SIZE / 2) / SP_DS_BITS + 1)
+
+/* Transition matrix of a batch of divsteps, scaled by 2^62. */
+typedef struct sp_ds_trans {
+    sp_int64 u;
+    sp_int64 v;
+    sp_int64 q;
+    sp_int64 r;
+} sp_ds_trans;
+
+/* Convert the bottom bits of an SP integer into signed 62-bit limbs.
+ *
+ * @param  [out]  r    Array of limbs.
+ * @param  [in]   len  Number of limbs to fill.
+ * @param  [in]   a    SP integer to convert. Must be non-negative.
+ */
+static void _sp_ds_from_sp(sp_int64* r, int len, const sp_int* a)
+{
+    int i;
+
+    for (i = 0; i < len; i++) {
+        int w = (i * SP_DS_BITS) / SP_WORD_SIZE;
+        int o = (i * SP_DS_BITS) % SP_WORD_SIZE;
+        sp_uint64 v = 0;
+
+        if (w < a->used) {
+            v = a->dp[w] >> o;
+        }
+        if ((o > SP_WORD_SIZE - SP_DS_BITS) && (w + 1 < a->used)) {
+            v |= a->dp[w + 1] << (SP_WORD_SIZE - o);
+        }
+        r[i] = (sp_int64)(v & SP_DS_MASK);
+    }
+}
+
+/* Convert normalized limbs, all non-negative, into an SP integer.
+ *
+ * @param  [out]  r    SP integer to hold result.
+ * @param  [in]   a    Array of limbs.
+ * @param  [in]   len  Number of limbs.
+ */
+static void _sp_ds_to_sp(sp_int* r, const sp_int64* a, int len)
+{
+    int i;
+    int used = (len * SP_DS_BITS + SP_WORD_SIZE - 1) / SP_WORD_SIZE;
+
+    for (i = 0; i < used; i++) {
+        r->dp[i] = 0;
+    }
+    for (i = 0; i < len; i++) {
+        int w = (i * SP_DS_BITS) / SP_WORD_SIZE;
+        int o = (i * SP_DS_BITS) % SP_WORD_SIZE;
+
+        r->dp[w] |= (sp_int_digit)a[i] << o;
+        if (o > SP_WORD_SIZE - SP_DS_BITS) {
+            r->dp[w + 1] |= (sp_int_digit)a[i] >> (SP_WORD_SIZE - o);
+        }
+    }
+    r->used = used;
+#ifdef WOLFSSL_SP_INT_NEGATIVE
+    r->sign = MP_ZPOS;
+#endif
+    sp_clamp(r);
+}
+
+/* Perform a batch of divsteps on the bottom bits of f and g.
+ *
+ * divstep(delta, f, g) with eta = -delta:
+ *   eta < 0 and g odd: (-eta - 1, g, (g - f) / 2)
+ *   otherwise:         (eta - 1,  f, (g + (g & 1) * f) / 2)
+ *
+ * @param  [in]   eta  Negated delta.
+ * @param  [in]   f    Bottom bits of f. Always odd.
+ * @param  [in]   g    Bottom bits of g.
+ * @param  [out]  t    Transition matrix that was applied, scaled by 2^62.
+ *
+ * @return  New value of eta.
+ */
+static sp_int64 _sp_ds_divsteps(sp_int64 eta, sp_uint64 f, sp_uint64 g,
+    sp_ds_trans* t)
+{
+    sp_uint64 u = 1;
+    sp_uint64 v = 0;
+    sp_uint64 q = 0;
+    sp_uint64 r = 1;
+    int i;
+
+    for (i = 0; i < SP_DS_BITS; i++) {
+        /* Masks: eta is negative and g is odd. */
+        sp_uint64 c1 = (sp_uint64)(eta >> 63);
+        sp_uint64 c2 = (sp_uint64)0 - (g & 1);
+        /* When g is odd, subtract f when eta < 0 otherwise add f. */
+        sp_uint64 x = (f ^ c1) - c1;
+        sp_uint64 y = (u ^ c1) - c1;
+        sp_uint64 z = (v ^ c1) - c1;
+
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+        /* When both, f becomes old g and eta becomes -eta - 1. */
+        c1 &= c2;
+        eta = (eta ^ (sp_int64)c1) - ((sp_int64)c1 + 1);
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        /* g is even - halve it and double the scale of f. */
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (sp_int64)u;
+    t->v = (sp_int64)v;
+    t->q = (sp_int64)q;
+    t->r = (sp_int64)r;
+
+    return eta;
+}
+
+/* Apply the transition matrix to f and g: [f, g] = t.[f, g] / 2^62
+ *
+ * Division is exact as the divsteps cleared the bottom bits.
+ *
+ * @param  [in, out]  f    Limbs of f.
+ * @param  [in, out]  g    Limbs of g.
+ * @param  [in]       len  Number of limbs.
+ * @param  [in]       t    Transition matrix.
+ */
+static void _sp_ds_update_fg(sp_int64* f, sp_int64* g, int len,
+    const sp_ds_trans* t)
+{
+    int i;
+    sp_int_sword cf;
+    sp_int_sword cg;
+
+    cf = (sp_int_sword)t->u * f[0] + (sp_int_sword)t->v * g[0];
+    cg = (sp_int_sword)t->q * f[0] + (sp_int_sword)t->r * g[0];
+    cf >>= SP_DS_BITS;
+    cg >>= SP_DS_BITS;
+    for (i = 1; i < len; i++) {
+        cf += (sp_int_sword)t->u * f[i] + (sp_int_sword)t->v * g[i];
+        cg += (sp_int_sword)t->q * f[i] + (sp_int_sword)t->r * g[i];
+        f[i - 1] = (sp_int64)((sp_uint64)cf & SP_DS_MASK);
+        g[i - 1] = (sp_int64)((sp_uint64)cg & SP_DS_MASK);
+        cf >>= SP_DS_BITS;
+        cg >>= SP_DS_BITS;
+    }
+    f[len - 1] = (sp_int64)cf;
+    g[len - 1] = (sp_int64)cg;
+}
+
+/* Apply the transition matrix to d and e modulo m:
+ *   [d, e] = (t.[d, e] + m.[md, me]) / 2^62
+ *
+ * md and me are chosen to make the division exact and keep d and e in the
+ * range (-2m, m).
+ *
+ * @param  [in, out]  d     Limbs of d.
+ * @param  [in, out]  e     Limbs of e.
+ * @param  [in]       len   Number of limbs.
+ * @param  [in]       t     Transition matrix.
+ * @param  [in]       m     Limbs of modulus.
+ * @param  [in]       mInv  Inverse of modulus mod 2^64.
+ */
+static void _sp_ds_update_de(sp_int64* d, sp_int64* e, int len,
+    const sp_ds_trans* t, const sp_int64* m, sp_uint64 mInv)
+{
+    int i;
+    sp_int64 sd = d[len - 1] >> 63;
+    sp_int64 se = e[len - 1] >> 63;
+    sp_int64 md;
+    sp_int64 me;
+    sp_int_sword cd;
+    sp_int_sword ce;
+
+    /* Add in multiples of m for the negative values. */
+    md = (t->u & sd) + (t->v & se);
+    me = (t->q & sd) + (t->r & se);
+    cd = (sp_int_sword)t->u * d[0] + (sp_int_sword)t->v * e[0];
+    ce = (sp_int_sword)t->q * d[0] + (sp_int_sword)t->r * e[0];
+    /* Take off multiples of m so that the bottom 62 bits are zero. */
+    md -= (sp_int64)((mInv * (sp_uint64)cd + (sp_uint64)md) & SP_DS_MASK);
+    me -= (sp_int64)((mInv * (sp_uint64)ce + (sp_uint64)me) & SP_DS_MASK);
+    cd += (sp_int_sword)m[0] * md;
+    ce += (sp_int_sword)m[0] * me;
+    cd >>= SP_DS_BITS;
+    ce >>= SP_DS_BITS;
+    for (i = 1; i < len; i++) {
+        cd += (sp_int_sword)t->u * d[i] + (sp_int_sword)t->v * e[i];
+        ce += (sp_int_sword)t->q * d[i] + (sp_int_sword)t->r * e[i];
+        cd += (sp_int_sword)m[i] * md;
+        ce += (sp_int_sword)m[i] * me;
+        d[i - 1] = (sp_int64)((sp_uint64)cd & SP_DS_MASK);
+        e[i - 1] = (sp_int64)((sp_uint64)ce & SP_DS_MASK);
+        cd >>= SP_DS_BITS;
+        ce >>= SP_DS_BITS;
+    }
+    d[len - 1] = (sp_int64)cd;
+    e[len - 1] = (sp_int64)ce;
+}
+
+/* Propagate carries so that all limbs but the top are in [0, 2^62).
+ *
+ * @param  [in, out]  a    Limbs.
+ * @param  [in]       len  Number of limbs.
+ */
+static void _sp_ds_carry(sp_int64* a, int len)
+{
+    int i;
+
+    for (i = 0; i < len - 1; i++) {
+        a[i + 1] += a[i] >> SP_DS_BITS;
+        a[i] &= (sp_int64)SP_DS_MASK;
+    }
+}
+
+/* Negate the value when mask is all bits set.
+ *
+ * @param  [in, out]  a    Limbs.
+ * @param  [in]       len  Number of limbs.
+ * @param  [in]       neg  Mask: 0 or all bits set.
+ */
+static void _sp_ds_cond_neg(sp_int64* a, int len, sp_int64 neg)
+{
+    int i;
+
+    for (i = 0; i < len; i++) {
+        a[i] = (a[i] ^ neg) - neg;
+    }
+    _sp_ds_carry(a, len);
+}
+
+/* Add the modulus when the value is negative.
+ *
+ * @param  [in, out]  a    Limbs.
+ * @param  [in]       m    Limbs of modulus.
+ * @param  [in]       len  Number of limbs.
+ */
+static void _sp_ds_add_if_neg(sp_int64* a, const sp_int64* m, int len)
+{
+    int i;
+    sp_int64 neg = a[len - 1] >> 63;
+
+    for (i = 0; i < len; i++) {
+        a[i] += m[i] & neg;
+    }
+    _sp_ds_carry(a, len);
+}
+
+/* Calculates the multiplicative inverse using divsteps - constant time.
+ *
+ * Bernstein-Yang "safegcd": the number of divsteps is fixed by the size of the
+ * modulus.
+ *
+ * @param  [in]   a  SP integer to find inverse of. Must be less than m.
+ * @param  [in]   m  SP integer that is the modulus. Must be odd.
+ * @param  [out]  r  SP integer to hold result.
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_VAL when m is too large or a is not invertible.
+ */
+static int _sp_invmod_ds(const sp_int* a, const sp_int* m, sp_int* r)
+{
+    int i;
+    int bits;
+    int len;
+    int steps;
+    sp_int64 f[SP_DS_MAX_LIMBS];
+    sp_int64 g[SP_DS_MAX_LIMBS];
+    sp_int64 d[SP_DS_MAX_LIMBS];
+    sp_int64 e[SP_DS_MAX_LIMBS];
+    sp_int64 mm[SP_DS_MAX_LIMBS];
+    sp_int64 eta = -1;
+    sp_int64 fNeg;
+    sp_int64 bad;
+    sp_uint64 mInv;
+    sp_ds_trans t;
+
+    bits = sp_count_bits(m);
+    len = bits / SP_DS_BITS + 1;
+    if ((len > SP_DS_MAX_LIMBS) ||
+            ((len * SP_DS_BITS + SP_WORD_SIZE - 1) / SP_WORD_SIZE > r->size)) {
+        return MP_VAL;
+    }
+
+    _sp_ds_from_sp(mm, len, m);
+    _sp_ds_from_sp(g, len, a);
+    XMEMCPY(f, mm, sizeof(sp_int64) * len);
+    XMEMSET(d, 0, sizeof(sp_int64) * len);
+    XMEMSET(e, 0, sizeof(sp_int64) * len);
+    e[0] = 1;
+
+    /* Inverse of m mod 2^64: each Newton step doubles the correct bits. */
+    mInv = (sp_uint64)mm[0];
+    for (i = 0; i < 5; i++) {
+        mInv *= (sp_uint64)2 - (sp_uint64)mm[0] * mInv;
+    }
+
+    /* Divsteps needed for values of this size - Bernstein-Yang Thm 11.2. */
+    steps = (49 * bits + ((bits < 46) ? 57 : 80) + 16) / 17;
+    for (i = 0; i < steps; i += SP_DS_BITS) {
+        eta = _sp_ds_divsteps(eta, (sp_uint64)f[0], (sp_uint64)g[0], &t);
+        _sp_ds_update_de(d, e, len, &t, mm, mInv);
+        _sp_ds_update_fg(f, g, len, &t);
+    }
+
+    /* g is zero and f is +/- gcd(a, m). */
+    fNeg = f[len - 1] >> 63;
+    _sp_ds_cond_neg(f, len, fNeg);
+    bad = f[0] ^ 1;
+    for (i = 1; i < len; i++) {
+        bad |= f[i];
+    }
+    for (i = 0; i < len; i++) {
+        bad |= g[i];
+    }
+    if (bad != 0) {
+        return MP_VAL;
+    }
+
+    /* Inverse is d times sign of f: (-2m, m) -> (-m, m) -> [0, m). */
+    _sp_ds_add_if_neg(d, mm, len);
+    _sp_ds_cond_neg(d, len, fNeg);
+    _sp_ds_add_if_neg(d, mm, len);
+    _sp_ds_to_sp(r, d, len);
+
+    return MP_OKAY;
+}
+#endif /* WOLFSSL_SP_INVMOD_DIVSTEP */
+
+#ifdef WOLFSSL_SP_INVMOD_MONT_CT
+/* Calculates the multiplicative inverse in the field - constant time.
+ *
+ * Modulus (m) must be a prime and greater than 2.
+ *
+ * @param  [in]   a  SP integer to find inverse of.
+ * @param  [in]   m  SP integer this is the modulus.
+ * @param  [out]  r  SP integer to hold result.
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_VAL when a, m or r is NULL; a is 0 mod m or m is less than 3.
+ * @return  MP_MEM when dynamic memory allocation fails.
+ */
+int sp_invmod_ct(sp_int* a, sp_int* m, sp_int* r)
+{
+    int err = MP_OKAY;
+    DECL_SP_INT(t, (m == NULL) ? 1 : m->used + 1);
+
+    if ((a == NULL) || (m == NULL) || (r == NULL)) {
+        err = MP_VAL;
+    }
+    if ((err == MP_OKAY) && (sp_iseven(m) || (m->used == 1 && m->dp[0] < 3))) {
+        err = MP_VAL;
+    }
+#ifdef WOLFSSL_SP_INT_NEGATIVE
+    if ((err == MP_OKAY) && (m->sign == MP_NEG)) {
+        err = MP_VAL;
+    }
+#endif
+
+    ALLOC_SP_INT(t, m->used + 1, err, NULL);
+    if (err == MP_OKAY) {
+        sp_init_size(t, m->used + 1);
+        if (_sp_cmp_abs(a, m) != MP_LT) {
+            err = sp_mod(a, m, t);
+        }
+    #ifdef WOLFSSL_SP_INT_NEGATIVE
+        else if (a->sign == MP_NEG) {
+            err = sp_add(m, a, t);
+        }
+    #endif
+        else {
+            err = sp_copy(a, t);
+        }
+    }
+    if ((err == MP_OKAY) && sp_iszero(t)) {
+        err = MP_VAL;
+    }
+#ifdef WOLFSSL_SP_INVMOD_DIVSTEP
+    if (err == MP_OKAY) {
+        err = _sp_invmod_ds(t, m, r);
+    }
+#else
+    /* Fermat: 1/a = a^(m-2) mod m */
+    if (err == MP_OKAY) {
+        DECL_SP_INT(e, m->used);
+
+        ALLOC_SP_INT(e, m->used, err, NULL);
+        if (err == MP_OKAY) {
+            sp_init_size(e, m->used);
+            _sp_sub_d(m, 2, e);
+            err = sp_exptmod(t, e, m, r);
+        }
+        FREE_SP_INT(e, NULL);
+    }
+#endif
+
+    FREE_SP_INT(t, NULL);
+    return err;
+}
+#endif /* WOLFSSL_SP_INVMOD_MONT_CT */
+
 #ifdef WOLFSSL_SP_INVMOD_MONT_CT
 
+#ifdef WOLFSSL_SP_INVMOD_DIVSTEP
+/* Calculates the multiplicative inverse in the field - constant time.
+ *
+ * Modulus (m) must be a prime and greater than 2.
+ * Converts out of Montgomery form, inverts using divsteps and converts back.
+ *
+ * @param  [in]   a   SP integer, Montgomery form, to find inverse of.
+ * @param  [in]   m   SP integer this is the modulus.
+ * @param  [out]  r   SP integer to hold result.
+ * @param  [in]   mp  SP integer digit that is the bottom digit of inv(-m).
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_VAL when a, m or r is NULL; a is 0 or m is less than 3.
+ * @return  MP_MEM when dynamic memory allocation fails.
+ */
+int sp_invmod_mont_ct(sp_int* a, sp_int* m, sp_int* r, sp_int_digit mp)
+{
+    int err = MP_OKAY;
+    sp_int* t = NULL;
+    sp_int* n = NULL;
+    DECL_SP_INT_ARRAY(tmp, (m == NULL) ? 1 : m->used * 2 + 1, 2);
+
+    if ((a == NULL) || (m == NULL) || (r == NULL)) {
+        err = MP_VAL;
+    }
+
+    /* 0 != n*m + 1 (+ve m), r*a mod 0 is always 0 (never 1) */
+    if ((err == MP_OKAY) && (sp_iszero(a) || sp_iszero(m) ||
+                                              (m->used == 1 && m->dp[0] < 3))) {
+        err = MP_VAL;
+    }
+
+    ALLOC_SP_INT_ARRAY(tmp, m->used * 2 + 1, 2, err, NULL);
+    if (err == MP_OKAY) {
+        t = tmp[0];
+        n = tmp[1];
+        sp_init_size(t, m->used * 2 + 1);
+        sp_init_size(n, m->used * 2 + 1);
+
+        /* aR -> a */
+        err = sp_copy(a, t);
+    }
+    if (err == MP_OKAY) {
+        err = _sp_mont_red(t, m, mp);
+    }
+    if ((err == MP_OKAY) && (_sp_cmp_abs(t, m) != MP_LT)) {
+        err = sp_mod(t, m, t);
+    }
+    /* 0 mod m has no inverse - result is 0 as with exponentiation. */
+    if ((err == MP_OKAY) && sp_iszero(t)) {
+        _sp_zero(r);
+    }
+    else if (err == MP_OKAY) {
+        /* a -> 1/a */
+        err = sp_invmod_ct(t, m, t);
+        /* 1/a -> R/a by multiplying by R^2 and reducing. */
+        if (err == MP_OKAY) {
+            err = sp_mont_norm(n, m);
+        }
+        if (err == MP_OKAY) {
+            err = sp_sqrmod(n, m, n);
+        }
+        if (err == MP_OKAY) {
+            err = sp_mul(t, n, r);
+        }
+        if (err == MP_OKAY) {
+            err = _sp_mont_red(r, m, mp);
+        }
+    }
+
+    FREE_SP_INT_ARRAY(tmp, NULL);
+    return err;
+}
+#else
+
 #define CT_INV_MOD_PRE_CNT      8
 
 /* Calculates the multiplicative inverse in the field - constant time.
@@ -10032,6 +10778,7 @@ int sp_invmod_mont_ct(sp_int* a, sp_int* m, sp_int* r, sp_int_digit mp)
     FREE_SP_INT_ARRAY(pre, NULL);
     return err;
 }
+#endif /* WOLFSSL_SP_INVMOD_DIVSTEP */
 
 #endif /* WOLFSSL_SP_INVMOD_MONT_CT */
 
@@ -13277,6 +14024,80 @@ static int _sp_sqr_96(sp_int* a, sp_int* r)
 #endif /* SQR_MUL_ASM && WOLFSSL_SP_INT_LARGE_COMBA */
 #endif /* !WOLFSSL_SP_SMALL */
 
+#ifdef WOLFSSL_SP_KARATSUBA
+/* Square a into r using Karatsuba: r = a * a
+ *
+ * With a = a1.B^h + a0:
+ *   z0 = a0^2, z2 = a1^2, z1 = z0 + z2 - (a0 - a1)^2
+ *   r  = z2.B^2h + z1.B^h + z0
+ * The three squares are calculated with sp_sqr() so the comba code is used
+ * for the halves. Digit counts depend only on the length of a.
+ *
+ * @param  [in]   a  SP integer to square.
+ * @param  [out]  r  SP integer result.
+ *
+ * @return  MP_OKAY on success.
+ * @return  MP_MEM when dynamic memory allocation fails.
+ */
+static int _sp_sqr_karatsuba(sp_int* a, sp_int* r)
+{
+    int err = MP_OKAY;
+    int n = a->used;
+    int h = n / 2;
+    int hh = n - h;
+    sp_int* x = NULL;
+    sp_int* z0 = NULL;
+    sp_int* z2 = NULL;
+    sp_int* p = NULL;
+    DECL_SP_INT_ARRAY(t, 2 * hh + 1, 4);
+
+    ALLOC_SP_INT_ARRAY(t, 2 * hh + 1, 4, err, NULL);
+    if (err == MP_OKAY) {
+        x = t[0];
+        z0 = t[1];
+        z2 = t[2];
+        p = t[3];
+        sp_init_size(x, 2 * hh + 1);
+        sp_init_size(z0, 2 * hh + 1);
+        sp_init_size(z2, 2 * hh + 1);
+        sp_init_size(p, 2 * hh + 1);
+
+        /* z0 = a0 ^ 2 */
+        XMEMCPY(x->dp, a->dp, h * sizeof(sp_int_digit));
+        x->used = h;
+        err = sp_sqr(x, z0);
+    }
+    if (err == MP_OKAY) {
+        /* z2 = a1 ^ 2 */
+        XMEMCPY(x->dp, a->dp + h, hh * sizeof(sp_int_digit));
+        x->used = hh;
+        err = sp_sqr(x, z2);
+    }
+    if (err == MP_OKAY) {
+        /* p = (a0 - a1) ^ 2 */
+        (void)_sp_kara_sub_abs(x->dp, a->dp, h, a->dp + h, hh);
+        x->used = hh;
+        err = sp_sqr(x, p);
+    }
+    if (err == MP_OKAY) {
+        /* p = z0 + z2 - (a0 - a1) ^ 2 */
+        p->dp[2 * hh] = 0;
+        _sp_kara_mid(p->dp, z0->dp, 2 * h, z2->dp, 2 * hh, 2 * hh + 1,
+            0);
+
+        /* a no longer needed - r may be a. */
+        XMEMCPY(r->dp, z0->dp, 2 * h * sizeof(sp_int_digit));
+        XMEMCPY(r->dp + 2 * h, z2->dp, 2 * hh * sizeof(sp_int_digit));
+        _sp_kara_add(r->dp, 2 * n, p->dp, 2 * hh + 1, h);
+        r->used = 2 * n;
+        sp_clamp(r);
+    }
+
+    FREE_SP_INT_ARRAY(t, NULL);
+    return err;
+}
+#endif /* WOLFSSL_SP_KARATSUBA */
+
 /* Square a and store in r. r = a * a
  *
  * @param  [in]   a  SP integer to square.
@@ -13380,6 +14201,12 @@ int sp_sqr(sp_int* a, sp_int* r)
     #endif /* SP_INT_DIGITS >= 192 */
 #endif /* SQR_MUL_ASM && WOLFSSL_SP_INT_LARGE_COMBA */
 #endif /* !WOLFSSL_SP_SMALL */
+#ifdef WOLFSSL_SP_KARATSUBA
+        if (a->used >= SP_KARATSUBA_SQR_MIN) {
+            err = _sp_sqr_karatsuba(a, r);
+        }
+        else
+#endif
         {
             err = _sp_sqr(a, r);
         }
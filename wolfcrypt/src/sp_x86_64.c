@@ -27,7 +27,8 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
-#if defined(WOLFSSL_HAVE_SP_RSA) || defined(WOLFSSL_HAVE_SP_DH)
+#if defined(WOLFSSL_HAVE_SP_RSA) || defined(WOLFSSL_HAVE_SP_DH) || \
+    defined(WOLFSSL_HAVE_SP_ECC)
 
 #include <wolfssl/wolfcrypt/error-crypt.h>
 #include <wolfssl/wolfcrypt/cpuid.h>
@@ -7176,5 +7177,8010 @@ int sp_DhExp_4096(const mp_int* base, const byte* exp, word32 expLen,
 #endif /* WOLFSSL_SP_4096 */
 
 #endif /* WOLFSSL_HAVE_SP_RSA | WOLFSSL_HAVE_SP_DH */
+#ifdef WOLFSSL_HAVE_SP_ECC
+#ifndef SP_ECC_MAX_SIG_GEN
+/* Maximum number of attempts at generating a non-zero r and s. */
+#define SP_ECC_MAX_SIG_GEN  64
+#endif
+
+#ifndef WOLFSSL_SP_NO_256
+
+/* Point structure to use. */
+typedef struct sp_point_256 {
+    /* X ordinate of point. */
+    sp_digit x[2 * 4];
+    /* Y ordinate of point. */
+    sp_digit y[2 * 4];
+    /* Z ordinate of point. */
+    sp_digit z[2 * 4];
+    /* Indicates point is at infinity. */
+    int infinity;
+} sp_point_256;
+
+/* Affine point in Montgomery form. */
+typedef struct sp_table_entry_256 {
+    /* X ordinate of point. */
+    sp_digit x[4];
+    /* Y ordinate of point. */
+    sp_digit y[4];
+} sp_table_entry_256;
+
+/* Number of teeth in the comb used to multiply the base point. */
+#define P256_COMB_TEETH     7
+/* Distance in bits between teeth: ceil(259 / 7). The recoded odd scalar
+ * needs 259 bits. */
+#define P256_COMB_SPACING   37
+
+/* The modulus (prime) of the curve P256. */
+static const sp_digit p256_mod[4] = {
+    0xffffffffffffffffL, 0x00000000ffffffffL, 0x0000000000000000L,
+    0xffffffff00000001L
+};
+
+/* The Montgomery normalizer for modulus of the curve P256. */
+static const sp_digit p256_norm_mod[4] = {
+    0x0000000000000001L, 0xffffffff00000000L, 0xffffffffffffffffL,
+    0x00000000fffffffeL
+};
+
+/* The Montgomery normalizer squared for modulus of the curve P256. */
+static const sp_digit p256_r2_mod[4] = {
+    0x0000000000000003L, 0xfffffffbffffffffL, 0xfffffffffffffffeL,
+    0x00000004fffffffdL
+};
+
+/* The order of the curve P256. */
+static const sp_digit p256_order[4] = {
+    0xf3b9cac2fc632551L, 0xbce6faada7179e84L, 0xffffffffffffffffL,
+    0xffffffff00000000L
+};
+
+/* The order of the curve P256 minus 2. */
+static const sp_digit p256_order2[4] = {
+    0xf3b9cac2fc63254fL, 0xbce6faada7179e84L, 0xffffffffffffffffL,
+    0xffffffff00000000L
+};
+
+/* The Montgomery normalizer squared for order of the curve P256. */
+static const sp_digit p256_r2_order[4] = {
+    0x83244c95be79eea2L, 0x4699799c49bd6fa6L, 0x2845b2392b6bec59L,
+    0x66e12d94f3d95620L
+};
+
+/* The Montgomery multiplier for order of the curve P256. */
+static const sp_digit p256_mp_order = 0xccd1c8aaee00bc4fL;
+
+/* The Montgomery multiplier for modulus of the curve P256. */
+static const sp_digit p256_mp_mod = 0x0000000000000001L;
+
+/* Base point table for the signed comb: entry i + 1 is the affine point in
+ * Montgomery form 2^222.G + sum over teeth j < 6 of +/-2^(37j).G with the sign
+ * of tooth j given by bit j of i. Entry 0 is not used.
+ */
+static const sp_table_entry_256 p256_table[65] = {
+    /* 0 - not used */
+    { { 0x00, 0x00, 0x00, 0x00 },
+      { 0x00, 0x00, 0x00, 0x00 } },
+    /* 1 */
+    { { 0x788ad5d4bcdd9c5fL, 0x09dc5a2df962589bL,
+        0x5ffb7546fa5210deL, 0x53dc1f85171598e6L },
+      { 0x7126d48673b18725L, 0x52e3618a4e77528eL,
+        0x75558b31971174abL, 0xc8c554b2273e048cL } },
+    /* 2 */
+    { { 0xf4545ac5f97a9fffL, 0x11e94b041c7e31c2L,
+        0x6e5573dffb7fd1d7L, 0xcc18fd32d0a56c09L },
+      { 0xb825272c2508c178L, 0x6d45c087bed0905bL,
+        0xbc464d58b10d5fb3L, 0x190b0d8303d2f490L } },
+    /* 3 */
+    { { 0x8d7baede4ccf44b1L, 0xdd143fb96fee9ad0L,
+        0x26d623485c0fd8ceL, 0xe1cf8a66f028bc41L },
+      { 0xabce8f6fd0bdef0cL, 0x0b17ee4d85f8a635L,
+        0xa222fb969a831b12L, 0x948764fd1bc29df8L } },
+    /* 4 */
+    { { 0xae2a0e15a7d5e183L, 0xccab7dcc0df80409L,
+        0xa9419fd12bef5871L, 0x0277d500d56bedffL },
+      { 0xda03d1d4e454977fL, 0x3c304cffcfbf8c3bL,
+        0xf2c4f9bc48b71d05L, 0x0655e7d9de3adc46L } },
+    /* 5 */
+    { { 0x1e3dd55e7650cd94L, 0xb6214d3da82f0d7bL,
+        0xcb91b5cd376d950dL, 0x0cdb35428d2867ecL },
+      { 0x237f7b42d905d402L, 0x34e6dca01a81036bL,
+        0x61e16d89867c9fb3L, 0xf7526ed9283b950dL } },
+    /* 6 */
+    { { 0x2ff1643e9bc2556eL, 0x42df49dd1fde14bcL,
+        0x4d11bc5f85b263dfL, 0xf429ce7639dcafe0L },
+      { 0xaff5d8ec8fb73e8dL, 0xbb2ce85a3ea4f56aL,
+        0xa90d52a4027a720fL, 0xad5efb267f6a5625L } },
+    /* 7 */
+    { { 0x0c74e10648f6d6caL, 0x9e886df2ca312306L,
+        0x7edba37f55bf516eL, 0x60940516512c3696L },
+      { 0xbd0e475b2a508304L, 0x0bd8b31eb7b1cbf5L,
+        0xc2f3ae11b969825eL, 0x5ea03511296979a4L } },
+    /* 8 */
+    { { 0x5070d138cc719132L, 0xd8d76914050365daL,
+        0x5b8f5511d924727dL, 0xddc80ec1f0320c14L },
+      { 0x335c9acce71d6d38L, 0x011516cc9a0afec1L,
+        0xebfd08e43ab3711dL, 0xa9381f8288a17900L } },
+    /* 9 */
+    { { 0xf1ec17c33ee3b206L, 0x8ef7fbff0fcac175L,
+        0x6be66cd620c8e7c4L, 0xcc27d5c9a432edf4L },
+      { 0x965a1d45996e2899L, 0x417ebe9c6a0b317aL,
+        0xca0d0e66485f0453L, 0xdd7805a25105b215L } },
+    /* 10 */
+    { { 0xe4d0bd774b1ae07bL, 0xa2752121195c9d78L,
+        0x58c741e593496182L, 0x1442e217d9852dabL },
+      { 0x7031ac9e92a6eb0cL, 0x937210fd89078deaL,
+        0x485f64a5afbc63d8L, 0x8e50756f6932ee28L } },
+    /* 11 */
+    { { 0xe5e8230544733fe8L, 0x1f09be2ede0bcca4L,
+        0xc8fe17fba1953a62L, 0x4fd82a8b07c9d995L },
+      { 0x119613ba8a33bbedL, 0xfaf58a44c7e43fc6L,
+        0x670e588e09b310ddL, 0x01ef828a0f1fd5d5L } },
+    /* 12 */
+    { { 0x2676f27f3ebc4defL, 0x6ce080f12ec615fcL,
+        0xd1238084d85ab53cL, 0xbc04cfa758d22306L },
+      { 0x1ada7fde73241720L, 0xac83f5be2c870f2fL,
+        0x1ed31e1747d7fa66L, 0xff9e16edd93a4478L } },
+    /* 13 */
+    { { 0xdcfa166b620addffL, 0xec46bf345c501e54L,
+        0x264ee74648f0a2a3L, 0x752a8658ac67b953L },
+      { 0x29500bb75f5ff058L, 0x40ccae99cc196cf7L,
+        0xfc3a2a896a41ca66L, 0xa88368b4f7db825fL } },
+    /* 14 */
+    { { 0x11827999c7b4fb68L, 0x04315f1683b8b46bL,
+        0xe79f0805885a7736L, 0x7ceab7973220c92bL },
+      { 0x87664042dcacebdbL, 0x3c41a7e606a5fd4fL,
+        0xccfc4f01f9dfb018L, 0x96fe92bd648771dbL } },
+    /* 15 */
+    { { 0x36f7c580ebc1a150L, 0x06032288cdd145e6L,
+        0xdb2e00f027dc48f2L, 0x929eed6f3c497079L },
+      { 0xbc589ef8fc2c99e0L, 0x5cb203e6878d8224L,
+        0xbe6e24c3623f0187L, 0xcb66e8eaefd49d33L } },
+    /* 16 */
+    { { 0x9cc116077d8d8bd6L, 0x1e1b9fb6b85c0776L,
+        0xb9ae4d72afbc6bb5L, 0xa102c2e3ec01a02dL },
+      { 0x50213594883c949dL, 0x81b9056e976c8dadL,
+        0xe49e106187e4ce3bL, 0xd1a74854816c208bL } },
+    /* 17 */
+    { { 0x51534026b927ecc8L, 0x54e8148f2283af33L,
+        0x75af3957f7321ce7L, 0x1a482229e2051bd5L },
+      { 0x6a0ff0aa8eeb21cfL, 0x1cdfdd1df4f79a30L,
+        0x20a292f612a57238L, 0xbfac3124f60f5160L } },
+    /* 18 */
+    { { 0xaca626b173cd2112L, 0x11032965a19f7b65L,
+        0x366d32dd5126d4f3L, 0x9c6e2c17bf08f15eL },
+      { 0x76338fc47c062702L, 0xf97e60b1a0c6a6acL,
+        0x07fda6bba6dd87bbL, 0x175fd9d50eac493eL } },
+    /* 19 */
+    { { 0x8398acfd6c7bbaecL, 0x915aca4d53c521a2L,
+        0xdc98600037068d5aL, 0xad2bc8c4ba779a2cL },
+      { 0x19ee18462ba8f6f0L, 0x58f58a82cbeed66eL,
+        0x6ef73aa7ab341523L, 0xd3c2406f8355ec86L } },
+    /* 20 */
+    { { 0xba3aef80470dea0bL, 0xb7b596a9c4ef64d3L,
+        0xe810571abce3223fL, 0x8e9531c1208e9856L },
+      { 0x3ced8d317c337f64L, 0x2193ab3c79008e56L,
+        0x9694f370b85c2e5aL, 0x1504e194e5126ddbL } },
+    /* 21 */
+    { { 0xb88cdf1e4149d861L, 0x32e198508ba6d1b2L,
+        0xac5e0ad743f64520L, 0xb5151b431ad93d4bL },
+      { 0x7c9ac992b2622d35L, 0x062a921db722d431L,
+        0x76c079d69ab67f0fL, 0x7055354fd1accdefL } },
+    /* 22 */
+    { { 0x2dfa90cd9359921eL, 0x1e46eefadc42def1L,
+        0x3426dc530147028bL, 0x4f1370a8ea05ca23L },
+      { 0x07bd23944e71613cL, 0x05a49083d962a722L,
+        0xf98d9c02cfaf772cL, 0x6d1fc229399f5261L } },
+    /* 23 */
+    { { 0xa2b7c8fc998c946dL, 0x5f12b9dfeb0c999bL,
+        0xf7c040c61745c13aL, 0xc82b3d23c1b98d41L },
+      { 0xf99cc2164bac7019L, 0x52a29b053aa670efL,
+        0x0535c2af41393e34L, 0xdeb664de377942d6L } },
+    /* 24 */
+    { { 0x38fb730ad54c4124L, 0x8d73154cf45376f3L,
+        0x0c7333fe2327b20dL, 0x8e6dc9fc48e56c89L },
+      { 0xa94de0d8f28a54c4L, 0xfd072bf8bd96d0deL,
+        0xa35a02653407c3e0L, 0xff890f7719e2b9bdL } },
+    /* 25 */
+    { { 0x3f288d84b07a7cd4L, 0x5abc46a4a7ffe463L,
+        0xafd0f4b461f52fd9L, 0x6864157b28650857L },
+      { 0xfcd61fed4933ee0eL, 0x8adcbaab34e882aeL,
+        0x9bdf3670c43a357eL, 0x6187629bc5582acfL } },
+    /* 26 */
+    { { 0xa2bf475c0ba9a959L, 0x84843ebd3fdb4574L,
+        0xf24db01c70f3d31cL, 0xd276d0c6bc06bddfL },
+      { 0x25dbf275f1d00df1L, 0x97ebcb1ee82f1ce7L,
+        0xd122479af372f8ceL, 0xf7adf429e8c5d322L } },
+    /* 27 */
+    { { 0x47a8aefc48ba04b0L, 0xbbc00cd23cdb4588L,
+        0x75f1e47c78ce641fL, 0x4e277723356b0ae2L },
+      { 0x6d7c8abfdb822aeaL, 0xb75e0f9e1447de9fL,
+        0x9e7ff7d1e4b781f0L, 0x630662796d249118L } },
+    /* 28 */
+    { { 0x1af6c5a834249c5fL, 0x356a288ba9a175e1L,
+        0x86fba64c5aee4dbcL, 0x75f400000e187f61L },
+      { 0x4695b9bb6912a890L, 0xb3ddb039ec0f7cadL,
+        0xce43eb974ca11c28L, 0x4d18ea16a5f82358L } },
+    /* 29 */
+    { { 0x26264fb41e97bc80L, 0x97ee36f46c7f35ebL,
+        0x9242e5c1e4fca595L, 0xa65c15996bf2c810L },
+      { 0x202de38fb9ba9533L, 0x8b00a712382a69e5L,
+        0x8fb6cd7bc9be895fL, 0xa1a55e9a4bd42a7fL } },
+    /* 30 */
+    { { 0xd47e2e7adb5de352L, 0x016b85ddec20b563L,
+        0xef449d097f8b2b35L, 0x2f1ea7a2c8cb7c84L },
+      { 0xfdbe9807f6cd9eb9L, 0x93d0a6520ff2f5fbL,
+        0xf3dde266ccfb6905L, 0x5a6ff24fa826abaeL } },
+    /* 31 */
+    { { 0x533032b4131b1e04L, 0x7b4947a577c84784L,
+        0xc92b2db29335ecbaL, 0x384bd756ac8cffc6L },
+      { 0x6b5def8e576d7070L, 0xf61d30c1c35b6360L,
+        0xd0fb68041f23d9e9L, 0x7167ef92adcfa848L } },
+    /* 32 */
+    { { 0x476d44b22c4b7a56L, 0x77b4738d8284b672L,
+        0xc5e71c2afd1a3130L, 0x6fb9fd81b998623fL },
+      { 0x48a6d77caa985425L, 0xb91a5200ab5f1838L,
+        0xab6ccfea5af0a7cdL, 0xd270e5410297eb2bL } },
+    /* 33 */
+    { { 0x381321c62c2685edL, 0x2d9549917a2f4d0aL,
+        0x4108dfb121a0f876L, 0x5d52323ac0af0a6aL },
+      { 0x70cf1eef4eb7d8ecL, 0x2b04caa7a380ef3bL,
+        0xa2221eee8cb8eb29L, 0x2eb8508e41b50a0fL } },
+    /* 34 */
+    { { 0x25e1d9abe99eacc8L, 0xb37b8aa28e714449L,
+        0xc6ab8013307e3587L, 0x2b86705e92a869b0L },
+      { 0xd05315d2b1a830c3L, 0x6ed91efe71f2e45bL,
+        0x5b7666d93318f923L, 0xbf79a7eeb21ecc38L } },
+    /* 35 */
+    { { 0x9f16ba91059e16abL, 0xc92b67286d15b0d7L,
+        0x5f773a97a70a43d0L, 0x07fe24914c4ea011L },
+      { 0x70bb2b70cfb1d395L, 0xa9cab9dfb7e7f7cdL,
+        0x2afeafeaf2dd35f8L, 0x777bad898245b799L } },
+    /* 36 */
+    { { 0x39c8c4b8a4a9efcaL, 0xd0a330deb2faee1dL,
+        0xdc65335ba4b61d68L, 0xdd3f2c2f58288a86L },
+      { 0x4ba3fe028867a386L, 0xa11cff9bb107d942L,
+        0xad27e7f7c6031048L, 0x49d106a967393a01L } },
+    /* 37 */
+    { { 0xe2b9f33b6d00c455L, 0x69ee6eb58514d8aeL,
+        0xb3086ecb3eb016abL, 0xade5479aa2d6a4cdL },
+      { 0x1c2d9b5dd893f38cL, 0x22823642d4a2c30bL,
+        0x643506e52dff4bb7L, 0x83682420f355929fL } },
+    /* 38 */
+    { { 0x131c1bc60f06a59dL, 0xa9a495dd190e211eL,
+        0x13ae64af5559e3f8L, 0xba05cfa2b539b523L },
+      { 0x136b95797a29516dL, 0x14ef8ae9b46470bfL,
+        0x4f09be0767094a07L, 0x9f396b2d0a50682bL } },
+    /* 39 */
+    { { 0xa9a493da06f88b62L, 0x5ed1904de0062139L,
+        0x4a854ca1579b835cL, 0x9693e884ff99b298L },
+      { 0xc4dc64bae1e6ef2aL, 0x4a27b93dbe0ecb75L,
+        0xbc51897440981a8cL, 0x9b871470417b3adfL } },
+    /* 40 */
+    { { 0x9b0d0c9fe6677dadL, 0x83d8f2001741af5fL,
+        0x3cff641f92a3495bL, 0x3d16978883273067L },
+      { 0x4fb7b0ac238bd5a3L, 0x469cc9ccf9fb5249L,
+        0xb54fcfde0b597c03L, 0x2dcb6496a93e2557L } },
+    /* 41 */
+    { { 0x7893a52e3fe84ca6L, 0x7bf7d92215480ac2L,
+        0x6846b784457c52ffL, 0xd41b2af6ffe47ef8L },
+      { 0xbec2eefdf254aebbL, 0x379262c589d56bfdL,
+        0x80aa9859c0d7dc72L, 0xb035b7dba36207c9L } },
+    /* 42 */
+    { { 0xbcb4e14a09cc8722L, 0x0e4b5bbffbd03922L,
+        0x2fbab0d822d8fcdeL, 0xb2290d62aee41339L },
+      { 0xff0e593f18191a05L, 0x1db4cf4d40b84ac8L,
+        0xd0e6f3b9ab1f4609L, 0x3ede4ce6598f7636L } },
+    /* 43 */
+    { { 0x079ab69863356698L, 0x5eb4319fdc1c5651L,
+        0xbcbe41539e7f063dL, 0x357cc736106da648L },
+      { 0x4d54a67e578e744eL, 0x60f55d3989fa9ea5L,
+        0x1b6dd51b9440011dL, 0xc827e08cafe3806cL } },
+    /* 44 */
+    { { 0xd53df0027e6e6996L, 0xa81c4c22defa1b7cL,
+        0xb68e08a219059d5aL, 0x98d8ee658c028152L },
+      { 0x4cbdfb48d8da75cdL, 0x7ed8c08babbddc60L,
+        0xbcbc86aabc3cd661L, 0x9e535b6abc041d57L } },
+    /* 45 */
+    { { 0x66c8e9d5ae968af2L, 0xa7eb0c782977d6a1L,
+        0x5210ea0eba2a5d4dL, 0xbdfb36b4a28c6a9aL },
+      { 0xcfdd1f4dead04a15L, 0xa8219f0e7173885fL,
+        0x2db37487b83f77acL, 0x5ba70194089d6c2eL } },
+    /* 46 */
+    { { 0xbd8f4c9bac3c2464L, 0xb2f411d0199d9453L,
+        0x89a84e2666d1136eL, 0xae047570a93c31c9L },
+      { 0xcbfe27104056173cL, 0x2d42dca1716fec5dL,
+        0x6923662a786a03c1L, 0x01a144793cda08a3L } },
+    /* 47 */
+    { { 0xcb525e011654310aL, 0x35e274ba0a6ca094L,
+        0xee0bec5bd51d7b82L, 0x033c4081a81c8bf3L },
+      { 0x79c20dca31b99f34L, 0x697d81ee4a0dd73dL,
+        0x059746ec73e65797L, 0xba09d71559cfb9c2L } },
+    /* 48 */
+    { { 0xcdea45e4be6a7bfcL, 0xce46415d473b0be4L,
+        0xa85a9b8d0a14def8L, 0xebb31332d7f6ddc8L },
+      { 0xef778b79944ea052L, 0x1f380a989443bd18L,
+        0x972347c4051ae0bfL, 0x504aeb7fe1b6419bL } },
+    /* 49 */
+    { { 0xd8d536647c1b1ad1L, 0x78c3a95f758e12bfL,
+        0x3a4f07fb103b1502L, 0x281408543ea1e9a5L },
+      { 0x56821daa157ca827L, 0x6efb8d0a6bbed2dfL,
+        0x4eb81f86b70f1adcL, 0x4206c3f70f08dd81L } },
+    /* 50 */
+    { { 0x612c174410e0ab77L, 0x6de1428fbd2ada21L,
+        0x4b723b0093021c08L, 0x17fa27786a741ac0L },
+      { 0x3d1dbe114c4adc52L, 0xce82885513b8ade2L,
+        0x6d684ed533c7335dL, 0xe20514514adb12b7L } },
+    /* 51 */
+    { { 0xbf28a82dbd8c91a4L, 0x7fcd70d27904d18aL,
+        0xe5280058f00d831cL, 0x50fe86471e06f7d6L },
+      { 0xcb9143810db9cbf4L, 0x91ac08f3ca96801aL,
+        0x3cfe210aa49f6906L, 0xa6729cc89adb6db3L } },
+    /* 52 */
+    { { 0xea104fced2f697caL, 0x970940260bcdc86eL,
+        0x7c622bae26643ceeL, 0x67712917b76ceca8L },
+      { 0x7bd4af198fc0a2a0L, 0x5708fe87640689bcL,
+        0xd88ab6c26f0362abL, 0x7d71d624e4f437c8L } },
+    /* 53 */
+    { { 0x7d6a4f9e4da949f1L, 0x968b04dde014f72fL,
+        0xb475d5a5e48cacfdL, 0x98fccb0d1339f5efL },
+      { 0xb6efd4764af36bdeL, 0xf3598e060896dee2L,
+        0x93aa79bc8985e93bL, 0x85e12d0046355a24L } },
+    /* 54 */
+    { { 0x4001f52205623a97L, 0x7e63c9d9187e3d12L,
+        0x68340323ba88c726L, 0x63adfd079daef411L },
+      { 0x4ecd3069f1907b82L, 0xcadd4a4104debc28L,
+        0x65e72677484ccefeL, 0x35e35d21e9556bcbL } },
+    /* 55 */
+    { { 0xbbe64e419803f9e4L, 0xb4c6b3b612a25e3bL,
+        0x2d7359e3cf476c85L, 0x6c2d5f90fb92d3a9L },
+      { 0xd59995f34096ad4dL, 0xdd40f89ff9d8e485L,
+        0xd0ac633827444cffL, 0xf17a8d2e12c02f5aL } },
+    /* 56 */
+    { { 0x3c99666f3841409bL, 0x6e7f40394e535095L,
+        0x9632c4849f026609L, 0xafc27bbd1c1058c8L },
+      { 0xb3d15eae4dc01c20L, 0x122fb5d85e529c27L,
+        0xaebac64f4b79b6efL, 0x7408dd300fa18049L } },
+    /* 57 */
+    { { 0x71f79b0384a56bdcL, 0xf519bc8e116b2f18L,
+        0x6d923b5a9523dcdeL, 0x86abb9f266d8ac55L },
+      { 0x44f02da1d0795a33L, 0x0f37e5cf4f11374dL,
+        0xa928904b1bde2feaL, 0xb9d99fe48dab310bL } },
+    /* 58 */
+    { { 0x65f4d5963bf35b60L, 0x719899052d9707eeL,
+        0xe7f8d7bd75b16396L, 0xfd35cfb2441cebe2L },
+      { 0xc70668abd012abdcL, 0x7e285e7b7762c2ebL,
+        0xdaf03de086974cdfL, 0xd6bffa9a4434fa60L } },
+    /* 59 */
+    { { 0xcb32bb10809c3c03L, 0xe79a0751749c80d8L,
+        0x152d8bef17473145L, 0xd537da70904ad2c5L },
+      { 0x97ee243474936030L, 0xfcaeadd8a5dd501fL,
+        0xcc75fd8c809aa16fL, 0xbbe998264a0267e6L } },
+    /* 60 */
+    { { 0x8c3b4836c923a501L, 0xf29f76ec7ca46353L,
+        0xca956b76f4bd88a2L, 0x68da9443f80d20dbL },
+      { 0xf53024388a412329L, 0xed7a0a6439c5b1e6L,
+        0x05a9efed112d66a2L, 0xda766a139274fc4fL } },
+    /* 61 */
+    { { 0x70ee9d1a314a445bL, 0xf9fd188098bda88fL,
+        0x256a0e1f0b4a2baeL, 0x2f2bcfc08d9eab03L },
+      { 0xf64b2ccf149ee22eL, 0xe7c3b0aeb4fefb78L,
+        0xddb2c3d07cf411f9L, 0x3a1a3792d89c2b81L } },
+    /* 62 */
+    { { 0x1e3ce67849c5f415L, 0x9f100d252e63a9b1L,
+        0x21da502bbbd04919L, 0xf668cb46cc3f743aL },
+      { 0x5e8d376222b80e73L, 0xf5808ea23cd7d252L,
+        0x08e7adc518d3fbd6L, 0x1ca0de69e0759b3cL } },
+    /* 63 */
+    { { 0x86aa35294aede486L, 0x500da3d3a3abd5adL,
+        0x9aa293f761e3611dL, 0xb14f9f0359d2650eL },
+      { 0xbca821d890e5a400L, 0x2fcacbb0f28c656aL,
+        0xdca86517335ce83dL, 0x780839348291f37aL } },
+    /* 64 */
+    { { 0xafe8710121ba5326L, 0x93fe9e8bc2e9d908L,
+        0xfb5e356d4a06cce9L, 0x4814cd5a590423fbL },
+      { 0x45360dbddb4ad306L, 0x6d8d6e4907e88a5fL,
+        0xe57c8cd2ba0b66a0L, 0x35ad6289719a0552L } }
+};
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mul_4(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_sqr_4(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_256_add_4(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_256_sub_4(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_cond_copy_4(sp_digit* r, const sp_digit* a, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_mul_4(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_sqr_4(sp_digit* r, const sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_int64 sp_256_cmp_4(const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_256_cond_sub_4(sp_digit* r, const sp_digit* a, const sp_digit* b, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_reduce_order_4(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_add_4(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_dbl_4(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_tpl_4(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_sub_4(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_div2_4(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifndef WC_NO_CACHE_RESISTANT
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_get_point_33_4(sp_point_256* r, const sp_point_256* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_get_entry_65_4(sp_point_256* r, const sp_table_entry_256* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#else
+/* Copy the point at index idx of the table into r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of points.
+ * idx    Index of point to copy.
+ */
+static void sp_256_get_point_33_4(sp_point_256* r, const sp_point_256* table,
+        int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(r->x));
+    XMEMCPY(r->y, table[idx].y, sizeof(r->y));
+    XMEMCPY(r->z, table[idx].z, sizeof(r->z));
+}
+
+/* Copy the table entry at index idx into the point r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of affine points.
+ * idx    Index of entry to copy.
+ */
+static void sp_256_get_entry_65_4(sp_point_256* r,
+        const sp_table_entry_256* table, int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(table[idx].x));
+    XMEMCPY(r->y, table[idx].y, sizeof(table[idx].y));
+}
+#endif /* !WC_NO_CACHE_RESISTANT */
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int sp_256_mod_inv_4(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_add_one_4(sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_from_bin_bswap(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_from_bin_movbe(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_to_bin_bswap_4(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_to_bin_movbe_4(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef HAVE_INTEL_AVX2
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_mul_avx2_4(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_sqr_avx2_4(sp_digit* r, const sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_mul_order_avx2_4(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_256_mont_sqr_order_avx2_4(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Read big endian unsigned byte array into r.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  Byte array.
+ * n  Number of bytes in array to read.
+ */
+static void sp_256_from_bin(sp_digit* r, int size, const byte* a, int n)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_256_from_bin_movbe(r, size, a, n);
+    }
+    else
+#endif
+    {
+        sp_256_from_bin_bswap(r, size, a, n);
+    }
+}
+
+/* Write r as big endian to byte array.
+ * Fixed length number of bytes written: 32
+ *
+ * r  A single precision integer.
+ * a  Byte array.
+ */
+static void sp_256_to_bin_4(sp_digit* r, byte* a)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_256_to_bin_movbe_4(r, a);
+    }
+    else
+#endif
+    {
+        sp_256_to_bin_bswap_4(r, a);
+    }
+}
+
+/* Convert an mp_int to an array of sp_digit.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  A multi-precision integer.
+ */
+static void sp_256_from_mp(sp_digit* r, int size, const mp_int* a)
+{
+#if DIGIT_BIT == 64
+    int j;
+
+    XMEMCPY(r, a->dp, sizeof(sp_digit) * a->used);
+
+    for (j = a->used; j < size; j++) {
+        r[j] = 0;
+    }
+#elif DIGIT_BIT > 64
+    int i;
+    int j = 0;
+    word32 s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i] << s);
+        r[j] &= 0xffffffffffffffffl;
+        s = 64U - s;
+        if (j + 1 >= size) {
+            break;
+        }
+        /* lint allow cast of mismatch word32 and mp_digit */
+        r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+        while ((s + 64U) <= (word32)DIGIT_BIT) {
+            s += 64U;
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            if (s < (word32)DIGIT_BIT) {
+                /* lint allow cast of mismatch word32 and mp_digit */
+                r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+            }
+            else {
+                r[++j] = (sp_digit)0;
+            }
+        }
+        s = (word32)DIGIT_BIT - s;
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#else
+    int i;
+    int j = 0;
+    int s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i]) << s;
+        if (s + DIGIT_BIT >= 64) {
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            s = 64 - s;
+            if (s == DIGIT_BIT) {
+                r[++j] = 0;
+                s = 0;
+            }
+            else {
+                r[++j] = a->dp[i] >> s;
+                s = DIGIT_BIT - s;
+            }
+        }
+        else {
+            s += DIGIT_BIT;
+        }
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#endif
+}
+
+/* Convert an array of sp_digit to an mp_int.
+ *
+ * a  A single precision integer.
+ * r  A multi-precision integer.
+ */
+static int sp_256_to_mp(const sp_digit* a, mp_int* r)
+{
+    int err;
+
+    err = mp_grow(r, (256 + DIGIT_BIT - 1) / DIGIT_BIT);
+    if (err == MP_OKAY) { /*lint !e774 case where err is always MP_OKAY*/
+#if DIGIT_BIT == 64
+        XMEMCPY(r->dp, a, sizeof(sp_digit) * 4);
+        r->used = 4;
+        mp_clamp(r);
+#elif DIGIT_BIT < 64
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 4; i++) {
+            r->dp[j] |= (mp_digit)(a[i] << s);
+            r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+            s = DIGIT_BIT - s;
+            r->dp[++j] = (mp_digit)(a[i] >> s);
+            while (s + DIGIT_BIT <= 64) {
+                s += DIGIT_BIT;
+                r->dp[j++] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+                if (s == SP_WORD_SIZE) {
+                    r->dp[j] = 0;
+                }
+                else {
+                    r->dp[j] = (mp_digit)(a[i] >> s);
+                }
+            }
+            s = 64 - s;
+        }
+        r->used = (256 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#else
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 4; i++) {
+            r->dp[j] |= ((mp_digit)a[i]) << s;
+            if (s + 64 >= DIGIT_BIT) {
+    #if DIGIT_BIT != 32 && DIGIT_BIT != 64
+                r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+    #endif
+                s = DIGIT_BIT - s;
+                r->dp[++j] = a[i] >> s;
+                s = 64 - s;
+            }
+            else {
+                s += 64;
+            }
+        }
+        r->used = (256 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#endif
+    }
+
+    return err;
+}
+
+
+/* Convert a point of type ecc_point to type sp_point_256.
+ *
+ * p   Point of type sp_point_256 (result).
+ * pm  Point of type ecc_point.
+ */
+static void sp_256_point_from_ecc_point_4(sp_point_256* p,
+        const ecc_point* pm)
+{
+    XMEMSET(p->x, 0, sizeof(p->x));
+    XMEMSET(p->y, 0, sizeof(p->y));
+    XMEMSET(p->z, 0, sizeof(p->z));
+    sp_256_from_mp(p->x, 4, pm->x);
+    sp_256_from_mp(p->y, 4, pm->y);
+    sp_256_from_mp(p->z, 4, pm->z);
+    p->infinity = 0;
+}
+
+/* Convert a point of type sp_point_256 to type ecc_point.
+ *
+ * p   Point of type sp_point_256.
+ * pm  Point of type ecc_point (result).
+ * returns MEMORY_E when allocation of memory in ecc_point fails otherwise
+ * MP_OKAY.
+ */
+static int sp_256_point_to_ecc_point_4(const sp_point_256* p, ecc_point* pm)
+{
+    int err;
+
+    err = sp_256_to_mp(p->x, pm->x);
+    if (err == MP_OKAY) {
+        err = sp_256_to_mp(p->y, pm->y);
+    }
+    if (err == MP_OKAY) {
+        err = sp_256_to_mp(p->z, pm->z);
+    }
+
+    return err;
+}
+
+/* Copy the point p into r unless they are the same.
+ *
+ * r  Point to copy into.
+ * p  Point to copy.
+ */
+static void sp_256_point_copy_4(sp_point_256* r, const sp_point_256* p)
+{
+    if (r != p) {
+        XMEMCPY(r, p, sizeof(sp_point_256));
+    }
+}
+
+/* Set the point to infinity.
+ *
+ * r  Point to set.
+ */
+static void sp_256_point_set_inf_4(sp_point_256* r)
+{
+    XMEMSET(r, 0, sizeof(sp_point_256));
+    r->infinity = 1;
+}
+
+/* Check whether a is zero.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_256_iszero_4(const sp_digit* a)
+{
+    return (a[0] | a[1] | a[2] | a[3]) == 0;
+}
+
+/* Reduce a, which is less than 2^256, into the range 0..m-1 where m is
+ * greater than 2^255.
+ *
+ * a  A single precision integer to reduce in place.
+ * m  Modulus.
+ */
+static void sp_256_norm_mod_4(sp_digit* a, const sp_digit* m)
+{
+    (void)sp_256_cond_sub_4(a, a, m,
+                                  ~(sp_digit)(sp_256_cmp_4(a, m) >> 63));
+}
+
+/* Check whether a is zero modulo the prime. The Montgomery form operations
+ * return values less than 2^256, so zero may also be represented by p.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_256_iszero_mod_4(const sp_digit* a)
+{
+    sp_digit t[4];
+
+    XMEMCPY(t, a, sizeof(t));
+    sp_256_norm_mod_4(t, p256_mod);
+    return sp_256_iszero_4(t);
+}
+
+/* Negate the point's y ordinate when sign is 1.
+ * Constant time.
+ *
+ * p     Point to conditionally negate.
+ * sign  1 to negate and 0 to leave unchanged.
+ */
+static void sp_256_point_cond_neg_4(sp_point_256* p, sp_digit sign)
+{
+    sp_digit t[4];
+
+    sp_256_mont_sub_4(t, p256_mod, p->y, p256_mod);
+    sp_256_cond_copy_4(p->y, t, (sp_digit)0 - sign);
+}
+
+/* Convert the point's ordinates to Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_256_point_to_mont_4(sp_point_256* p)
+{
+    sp_256_mont_mul_4(p->x, p->x, p256_r2_mod, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(p->y, p->y, p256_r2_mod, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(p->z, p->z, p256_r2_mod, p256_mod, p256_mp_mod);
+}
+
+/* Convert the point's ordinates from Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_256_point_from_mont_4(sp_point_256* p)
+{
+    static const sp_digit one[4] = { 1, 0, 0, 0 };
+
+    sp_256_mont_mul_4(p->x, p->x, one, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(p->y, p->y, one, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(p->z, p->z, one, p256_mod, p256_mp_mod);
+    sp_256_norm_mod_4(p->x, p256_mod);
+    sp_256_norm_mod_4(p->y, p256_mod);
+    sp_256_norm_mod_4(p->z, p256_mod);
+}
+
+/* Make the scalar odd by replacing even k with order - k. The order is odd.
+ * Constant time.
+ *
+ * u  Odd scalar (result).
+ * k  Scalar less than the order.
+ * returns 1 when k was replaced and the result must be negated, 0 otherwise.
+ */
+static sp_digit sp_256_ecc_odd_4(sp_digit* u, const sp_digit* k)
+{
+    sp_digit t[4];
+    sp_digit neg = (k[0] & 1) ^ 1;
+
+    XMEMCPY(u, k, sizeof(t));
+    (void)sp_256_sub_4(t, p256_order, k);
+    sp_256_cond_copy_4(u, t, (sp_digit)0 - neg);
+    ForceZero(t, sizeof(t));
+
+    return neg;
+}
+
+/* Get the signed odd digit of window i of the odd scalar u as an index into
+ * the table of odd multiples.
+ * The digit is 2.b + 1 - 64 where b is bits 6i+1..6i+6 of u.
+ *
+ * u     Odd scalar.
+ * i     Window index.
+ * sign  1 when the digit is negative (result).
+ * returns the table index of the digit's magnitude.
+ */
+static int sp_256_ecc_window_4(const sp_digit* u, int i, sp_digit* sign)
+{
+    int pos = 6 * i + 1;
+    int o = pos & 63;
+    sp_digit b = u[pos >> 6] >> o;
+
+    if (o > 58) {
+        b |= u[(pos >> 6) + 1] << (64 - o);
+    }
+    b &= 0x3f;
+    *sign = ((b >> 5) & 1) ^ 1;
+
+    return (int)((b & 0x1f) ^ (((sp_digit)0 - *sign) & 0x1f)) + 1;
+}
+
+/* Get bit j of the recoded scalar s = (u >> 1) + 2^258 whose bits select
+ * +1 (set) or -1 (clear) for each bit position of the odd scalar u.
+ *
+ * u  Odd scalar.
+ * j  Bit index.
+ * returns the bit.
+ */
+static sp_digit sp_256_ecc_comb_bit_4(const sp_digit* u, int j)
+{
+    j++;
+    if (j == P256_COMB_TEETH * P256_COMB_SPACING) {
+        return 1;
+    }
+    if (j >= 256) {
+        return 0;
+    }
+    return (u[j >> 6] >> (j & 63)) & 1;
+}
+
+/* Get the index into the base point table for column c of the comb.
+ * Entries have the top tooth positive; when its bit is clear the column is
+ * the negation of the entry with all other teeth flipped.
+ *
+ * u     Odd scalar.
+ * c     Column.
+ * sign  1 when the entry is to be negated (result).
+ * returns the table index.
+ */
+static int sp_256_ecc_comb_4(const sp_digit* u, int c, sp_digit* sign)
+{
+    sp_digit idx = 0;
+    sp_digit top;
+    int i;
+
+    for (i = 0; i < P256_COMB_TEETH - 1; i++) {
+        idx |= sp_256_ecc_comb_bit_4(u, c + i * P256_COMB_SPACING) << i;
+    }
+    top = sp_256_ecc_comb_bit_4(u, c + i * P256_COMB_SPACING);
+    idx ^= (top - 1) & ((1 << (P256_COMB_TEETH - 1)) - 1);
+    *sign = top ^ 1;
+
+    return (int)idx + 1;
+}
+
+/* Add two numbers less than the order modulo the order. (r = a + b mod n)
+ * Constant time.
+ *
+ * r  Result of addition.
+ * a  First number to add.
+ * b  Second number to add.
+ */
+static void sp_256_add_mod_order_4(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit c;
+
+    c = sp_256_add_4(r, a, b);
+    (void)sp_256_cond_sub_4(r, r, p256_order, ((sp_digit)0 - c) |
+                            ~(sp_digit)(sp_256_cmp_4(r, p256_order) >> 63));
+}
+
+/* Multiply two numbers in Montgomery form modulo the order of the P256 curve.
+ * (r = a * b mod order)
+ *
+ * r  Result of the multiplication.
+ * a  First operand of the multiplication.
+ * b  Second operand of the multiplication.
+ */
+static void sp_256_mont_mul_order_4(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit t[2 * 4];
+
+    sp_256_mul_4(t, a, b);
+    sp_256_mont_reduce_order_4(t, p256_order, p256_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 4);
+}
+
+/* Square number in Montgomery form modulo the order of the P256 curve.
+ * (r = a * a mod order)
+ *
+ * r  Result of the squaring.
+ * a  Number to square.
+ */
+static void sp_256_mont_sqr_order_4(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[2 * 4];
+
+    sp_256_sqr_4(t, a);
+    sp_256_mont_reduce_order_4(t, p256_order, p256_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 4);
+}
+
+/* Generate a random number k in the range 1..order-1.
+ *
+ * rng  Random number generator.
+ * k    Scalar value (result).
+ * returns RNG failures and MP_OKAY on success.
+ */
+static int sp_256_ecc_gen_k_4(WC_RNG* rng, sp_digit* k)
+{
+    byte buf[32];
+    int err;
+
+    do {
+        err = wc_RNG_GenerateBlock(rng, buf, sizeof(buf));
+        if (err == 0) {
+            sp_256_from_bin(k, 4, buf, (int)sizeof(buf));
+            if (sp_256_cmp_4(k, p256_order2) <= 0) {
+                sp_256_add_one_4(k);
+                break;
+            }
+        }
+    }
+    while (err == 0);
+
+    ForceZero(buf, sizeof(buf));
+
+    return err;
+}
+
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_256_mont_sqr_n_4(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_256_mont_sqr_4(r, a, p256_mod, p256_mp_mod);
+    for (; n > 1; n--) {
+        sp_256_mont_sqr_4(r, r, p256_mod, p256_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P256 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_256_mont_inv_4(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[4];
+    sp_digit x4[4];
+    sp_digit x8[4];
+    sp_digit x30[4];
+    sp_digit x32[4];
+    sp_digit t[4];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_256_mont_sqr_4(t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(x2, t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, x2, 2);
+    sp_256_mont_mul_4(x4, t, x2, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, x4, 4);
+    sp_256_mont_mul_4(x8, t, x4, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, x8, 8);
+    sp_256_mont_mul_4(t, t, x8, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 8);
+    sp_256_mont_mul_4(t, t, x8, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 4);
+    sp_256_mont_mul_4(t, t, x4, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 2);
+    sp_256_mont_mul_4(x30, t, x2, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, x30, 2);
+    sp_256_mont_mul_4(x32, t, x2, p256_mod, p256_mp_mod);
+    /* p - 2 = ffffffff 00000001 00000000 00000000 00000000 ffffffff ffffffff
+     *         fffffffd */
+    sp_256_mont_sqr_n_4(t, x32, 32);
+    sp_256_mont_mul_4(t, t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 128);
+    sp_256_mont_mul_4(t, t, x32, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 32);
+    sp_256_mont_mul_4(t, t, x32, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 30);
+    sp_256_mont_mul_4(t, t, x30, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_4(t, t, 2);
+    sp_256_mont_mul_4(r, t, a, p256_mod, p256_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_256_map_4(sp_point_256* r, const sp_point_256* p)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+
+    sp_256_mont_inv_4(t1, p->z);
+    sp_256_mont_sqr_4(t2, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t1, t2, t1, p256_mod, p256_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_256_mont_mul_4(r->x, p->x, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(r->y, p->y, t1, p256_mod, p256_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_256_mont_mul_4(r->x, r->x, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(r->y, r->y, t2, p256_mod, p256_mp_mod);
+    sp_256_norm_mod_4(r->x, p256_mod);
+    sp_256_norm_mod_4(r->y, p256_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_256_proj_point_dbl_4(sp_point_256* r, const sp_point_256* p)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+
+    if (p->infinity) {
+        sp_256_point_copy_4(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_256_mont_sqr_4(t1, p->z, p256_mod, p256_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_256_mont_mul_4(t4, p->y, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_dbl_4(r->z, t4, p256_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_256_mont_sub_4(t2, p->x, t1, p256_mod);
+    sp_256_mont_add_4(t1, p->x, t1, p256_mod);
+    sp_256_mont_mul_4(t2, t1, t2, p256_mod, p256_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_256_mont_tpl_4(t1, t2, p256_mod);
+    /* T3 = 4 * Y * Y */
+    sp_256_mont_dbl_4(t3, p->y, p256_mod);
+    sp_256_mont_sqr_4(t3, t3, p256_mod, p256_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_256_mont_mul_4(t4, t3, p->x, p256_mod, p256_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_256_mont_sqr_4(t3, t3, p256_mod, p256_mp_mod);
+    sp_256_div2_4(t3, t3, p256_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_256_mont_sqr_4(t2, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t2, t2, t4, p256_mod);
+    sp_256_mont_sub_4(r->x, t2, t4, p256_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_256_mont_sub_4(t4, t4, r->x, p256_mod);
+    sp_256_mont_mul_4(t4, t4, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t4, t3, p256_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_256_proj_point_dbl_n_4(sp_point_256* r, const sp_point_256* p,
+        int n)
+{
+    sp_256_proj_point_dbl_4(r, p);
+    for (; n > 1; n--) {
+        sp_256_proj_point_dbl_4(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_256_proj_point_add_4(sp_point_256* r, const sp_point_256* p,
+        const sp_point_256* q)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+    sp_digit t5[4];
+    sp_digit t6[4];
+
+    if (q->infinity) {
+        sp_256_point_copy_4(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_256_point_copy_4(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_256_mont_sqr_4(t1, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t3, t1, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t1, t1, p->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t3, t3, p->y, p256_mod, p256_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_256_mont_sqr_4(t2, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t4, t2, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t2, t2, q->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t4, t4, q->y, p256_mod, p256_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_256_mont_sub_4(t2, t2, t1, p256_mod);
+    sp_256_mont_sub_4(t4, t4, t3, p256_mod);
+    if (sp_256_iszero_mod_4(t2)) {
+        if (sp_256_iszero_mod_4(t4)) {
+            sp_256_proj_point_dbl_4(r, p);
+        }
+        else {
+            sp_256_point_set_inf_4(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_256_mont_mul_4(t5, p->z, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(r->z, t5, t2, p256_mod, p256_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_256_mont_sqr_4(t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t6, t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t1, t1, t5, p256_mod, p256_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_256_mont_sqr_4(t5, t4, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t5, t5, t6, p256_mod);
+    sp_256_mont_sub_4(t5, t5, t1, p256_mod);
+    sp_256_mont_sub_4(r->x, t5, t1, p256_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_256_mont_sub_4(t1, t1, r->x, p256_mod);
+    sp_256_mont_mul_4(t1, t1, t4, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t6, t6, t3, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t1, t6, p256_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_256_proj_point_add_qz1_4(sp_point_256* r,
+        const sp_point_256* p, const sp_point_256* q)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+    sp_digit t5[4];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p256_norm_mod, sizeof(p256_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_256_mont_sqr_4(t1, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t2, t1, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t1, t1, q->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t2, t2, q->y, p256_mod, p256_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_256_mont_sub_4(t1, t1, p->x, p256_mod);
+    sp_256_mont_sub_4(t2, t2, p->y, p256_mod);
+    if (sp_256_iszero_mod_4(t1)) {
+        if (sp_256_iszero_mod_4(t2)) {
+            sp_256_proj_point_dbl_4(r, p);
+        }
+        else {
+            sp_256_point_set_inf_4(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_256_mont_mul_4(r->z, p->z, t1, p256_mod, p256_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_256_mont_sqr_4(t3, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t4, t3, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t3, t3, p->x, p256_mod, p256_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_256_mont_sqr_4(t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t5, t5, t4, p256_mod);
+    sp_256_mont_sub_4(t5, t5, t3, p256_mod);
+    sp_256_mont_sub_4(r->x, t5, t3, p256_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_256_mont_sub_4(t3, t3, r->x, p256_mod);
+    sp_256_mont_mul_4(t3, t3, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_4(t4, t4, p->y, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t3, t4, p256_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_256_ecc_mulmod_4(sp_point_256* r, const sp_point_256* g,
+        const sp_digit* k, int map)
+{
+    sp_point_256 t[33];
+    sp_point_256 p;
+    sp_point_256 p2;
+    sp_digit u[4];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_256_point_copy_4(&t[1], g);
+    sp_256_proj_point_dbl_4(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_256_proj_point_add_4(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_256_ecc_odd_4(u, k);
+
+    /* Top window: digit 1 + 2 * u[255..253] */
+    sp_256_get_point_33_4(r, t, (int)(u[3] >> 61) + 1);
+    r->infinity = 0;
+    for (i = 41; i >= 0; i--) {
+        idx = sp_256_ecc_window_4(u, i, &sign);
+        sp_256_proj_point_dbl_n_4(r, r, 6);
+        sp_256_get_point_33_4(&p, t, idx);
+        p.infinity = 0;
+        sp_256_point_cond_neg_4(&p, sign);
+        sp_256_proj_point_add_4(r, r, &p);
+    }
+
+    if (map) {
+        sp_256_map_4(r, r);
+    }
+    sp_256_point_cond_neg_4(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P256 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_256_ecc_mulmod_base_4(sp_point_256* r, const sp_digit* k,
+        int map)
+{
+    sp_point_256 p;
+    sp_digit u[4];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_256_ecc_odd_4(u, k);
+
+    for (c = P256_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_256_ecc_comb_4(u, c, &sign);
+        sp_256_get_entry_65_4(&p, p256_table, idx);
+        sp_256_point_cond_neg_4(&p, sign ^ neg);
+        if (c == P256_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p256_norm_mod, sizeof(p256_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_256_proj_point_dbl_4(r, r);
+            sp_256_proj_point_add_qz1_4(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_256_map_4(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P256 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_256_mont_inv_order_4(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][4];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_256_mont_mul_order_4(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p256_order2[3] >> 60], sizeof(t[0]));
+    for (i = 3; i >= 0; i--) {
+        for (j = (i == 3) ? 56 : 60; j >= 0; j -= 4) {
+            sp_256_mont_sqr_order_4(r, r);
+            sp_256_mont_sqr_order_4(r, r);
+            sp_256_mont_sqr_order_4(r, r);
+            sp_256_mont_sqr_order_4(r, r);
+            y = (p256_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_256_mont_mul_order_4(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P256 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_256_ecc_sign_4(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_256 point;
+    sp_digit k[4];
+    sp_digit x[4];
+    sp_digit t[4];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_256_from_mp(k, 4, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_256_ecc_gen_k_4(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_256_ecc_mulmod_base_4(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 4);
+        sp_256_norm_mod_4(r, p256_order);
+        if (sp_256_iszero_4(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_256_mont_mul_order_4(x, d, p256_r2_order);
+        sp_256_mont_mul_order_4(x, x, r);
+        sp_256_norm_mod_4(x, p256_order);
+        sp_256_add_mod_order_4(x, x, e);
+        sp_256_mont_mul_order_4(k, k, p256_r2_order);
+        sp_256_mont_inv_order_4(t, k);
+        sp_256_mont_mul_order_4(s, t, x);
+        sp_256_norm_mod_4(s, p256_order);
+        if (!sp_256_iszero_4(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P256 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_256_ecc_verify_4(const sp_digit* e, const sp_point_256* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_256 p1;
+    sp_point_256 p2;
+    sp_digit w[4];
+    sp_digit u1[4];
+    sp_digit u2[4];
+
+    /* w = 1 / s in Montgomery form */
+    (void)sp_256_mod_inv_4(w, s, p256_order);
+    sp_256_mont_mul_order_4(w, w, p256_r2_order);
+    /* u1 = e.w, u2 = r.w */
+    sp_256_mont_mul_order_4(u1, e, w);
+    sp_256_norm_mod_4(u1, p256_order);
+    sp_256_mont_mul_order_4(u2, r, w);
+    sp_256_norm_mod_4(u2, p256_order);
+
+    /* u1.G + u2.Q */
+    if (sp_256_iszero_4(u1)) {
+        sp_256_point_set_inf_4(&p1);
+    }
+    else {
+        sp_256_ecc_mulmod_base_4(&p1, u1, 0);
+    }
+    sp_256_ecc_mulmod_4(&p2, q, u2, 0);
+    sp_256_proj_point_add_4(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_256_map_4(&p1, &p1);
+    sp_256_norm_mod_4(p1.x, p256_order);
+    return sp_256_cmp_4(p1.x, r) == 0;
+}
+
+#ifdef HAVE_INTEL_AVX2
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_256_mont_sqr_n_avx2_4(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_256_mont_sqr_avx2_4(r, a, p256_mod, p256_mp_mod);
+    for (; n > 1; n--) {
+        sp_256_mont_sqr_avx2_4(r, r, p256_mod, p256_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P256 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_256_mont_inv_avx2_4(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[4];
+    sp_digit x4[4];
+    sp_digit x8[4];
+    sp_digit x30[4];
+    sp_digit x32[4];
+    sp_digit t[4];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_256_mont_sqr_avx2_4(t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(x2, t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, x2, 2);
+    sp_256_mont_mul_avx2_4(x4, t, x2, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, x4, 4);
+    sp_256_mont_mul_avx2_4(x8, t, x4, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, x8, 8);
+    sp_256_mont_mul_avx2_4(t, t, x8, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 8);
+    sp_256_mont_mul_avx2_4(t, t, x8, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 4);
+    sp_256_mont_mul_avx2_4(t, t, x4, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 2);
+    sp_256_mont_mul_avx2_4(x30, t, x2, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, x30, 2);
+    sp_256_mont_mul_avx2_4(x32, t, x2, p256_mod, p256_mp_mod);
+    /* p - 2 = ffffffff 00000001 00000000 00000000 00000000 ffffffff ffffffff
+     *         fffffffd */
+    sp_256_mont_sqr_n_avx2_4(t, x32, 32);
+    sp_256_mont_mul_avx2_4(t, t, a, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 128);
+    sp_256_mont_mul_avx2_4(t, t, x32, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 32);
+    sp_256_mont_mul_avx2_4(t, t, x32, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 30);
+    sp_256_mont_mul_avx2_4(t, t, x30, p256_mod, p256_mp_mod);
+    sp_256_mont_sqr_n_avx2_4(t, t, 2);
+    sp_256_mont_mul_avx2_4(r, t, a, p256_mod, p256_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_256_map_avx2_4(sp_point_256* r, const sp_point_256* p)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+
+    sp_256_mont_inv_avx2_4(t1, p->z);
+    sp_256_mont_sqr_avx2_4(t2, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t1, t2, t1, p256_mod, p256_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_256_mont_mul_avx2_4(r->x, p->x, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(r->y, p->y, t1, p256_mod, p256_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_256_mont_mul_avx2_4(r->x, r->x, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(r->y, r->y, t2, p256_mod, p256_mp_mod);
+    sp_256_norm_mod_4(r->x, p256_mod);
+    sp_256_norm_mod_4(r->y, p256_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_256_proj_point_dbl_avx2_4(sp_point_256* r, const sp_point_256* p)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+
+    if (p->infinity) {
+        sp_256_point_copy_4(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_256_mont_sqr_avx2_4(t1, p->z, p256_mod, p256_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_256_mont_mul_avx2_4(t4, p->y, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_dbl_4(r->z, t4, p256_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_256_mont_sub_4(t2, p->x, t1, p256_mod);
+    sp_256_mont_add_4(t1, p->x, t1, p256_mod);
+    sp_256_mont_mul_avx2_4(t2, t1, t2, p256_mod, p256_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_256_mont_tpl_4(t1, t2, p256_mod);
+    /* T3 = 4 * Y * Y */
+    sp_256_mont_dbl_4(t3, p->y, p256_mod);
+    sp_256_mont_sqr_avx2_4(t3, t3, p256_mod, p256_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_256_mont_mul_avx2_4(t4, t3, p->x, p256_mod, p256_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_256_mont_sqr_avx2_4(t3, t3, p256_mod, p256_mp_mod);
+    sp_256_div2_4(t3, t3, p256_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_256_mont_sqr_avx2_4(t2, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t2, t2, t4, p256_mod);
+    sp_256_mont_sub_4(r->x, t2, t4, p256_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_256_mont_sub_4(t4, t4, r->x, p256_mod);
+    sp_256_mont_mul_avx2_4(t4, t4, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t4, t3, p256_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_256_proj_point_dbl_n_avx2_4(sp_point_256* r,
+        const sp_point_256* p, int n)
+{
+    sp_256_proj_point_dbl_avx2_4(r, p);
+    for (; n > 1; n--) {
+        sp_256_proj_point_dbl_avx2_4(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_256_proj_point_add_avx2_4(sp_point_256* r, const sp_point_256* p,
+        const sp_point_256* q)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+    sp_digit t5[4];
+    sp_digit t6[4];
+
+    if (q->infinity) {
+        sp_256_point_copy_4(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_256_point_copy_4(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_256_mont_sqr_avx2_4(t1, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t3, t1, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t1, t1, p->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t3, t3, p->y, p256_mod, p256_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_256_mont_sqr_avx2_4(t2, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t4, t2, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t2, t2, q->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t4, t4, q->y, p256_mod, p256_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_256_mont_sub_4(t2, t2, t1, p256_mod);
+    sp_256_mont_sub_4(t4, t4, t3, p256_mod);
+    if (sp_256_iszero_mod_4(t2)) {
+        if (sp_256_iszero_mod_4(t4)) {
+            sp_256_proj_point_dbl_avx2_4(r, p);
+        }
+        else {
+            sp_256_point_set_inf_4(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_256_mont_mul_avx2_4(t5, p->z, q->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(r->z, t5, t2, p256_mod, p256_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_256_mont_sqr_avx2_4(t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t6, t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t1, t1, t5, p256_mod, p256_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_256_mont_sqr_avx2_4(t5, t4, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t5, t5, t6, p256_mod);
+    sp_256_mont_sub_4(t5, t5, t1, p256_mod);
+    sp_256_mont_sub_4(r->x, t5, t1, p256_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_256_mont_sub_4(t1, t1, r->x, p256_mod);
+    sp_256_mont_mul_avx2_4(t1, t1, t4, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t6, t6, t3, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t1, t6, p256_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_256_proj_point_add_qz1_avx2_4(sp_point_256* r,
+        const sp_point_256* p, const sp_point_256* q)
+{
+    sp_digit t1[4];
+    sp_digit t2[4];
+    sp_digit t3[4];
+    sp_digit t4[4];
+    sp_digit t5[4];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p256_norm_mod, sizeof(p256_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_256_mont_sqr_avx2_4(t1, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t2, t1, p->z, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t1, t1, q->x, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t2, t2, q->y, p256_mod, p256_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_256_mont_sub_4(t1, t1, p->x, p256_mod);
+    sp_256_mont_sub_4(t2, t2, p->y, p256_mod);
+    if (sp_256_iszero_mod_4(t1)) {
+        if (sp_256_iszero_mod_4(t2)) {
+            sp_256_proj_point_dbl_avx2_4(r, p);
+        }
+        else {
+            sp_256_point_set_inf_4(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_256_mont_mul_avx2_4(r->z, p->z, t1, p256_mod, p256_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_256_mont_sqr_avx2_4(t3, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t4, t3, t1, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t3, t3, p->x, p256_mod, p256_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_256_mont_sqr_avx2_4(t5, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(t5, t5, t4, p256_mod);
+    sp_256_mont_sub_4(t5, t5, t3, p256_mod);
+    sp_256_mont_sub_4(r->x, t5, t3, p256_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_256_mont_sub_4(t3, t3, r->x, p256_mod);
+    sp_256_mont_mul_avx2_4(t3, t3, t2, p256_mod, p256_mp_mod);
+    sp_256_mont_mul_avx2_4(t4, t4, p->y, p256_mod, p256_mp_mod);
+    sp_256_mont_sub_4(r->y, t3, t4, p256_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_256_ecc_mulmod_avx2_4(sp_point_256* r, const sp_point_256* g,
+        const sp_digit* k, int map)
+{
+    sp_point_256 t[33];
+    sp_point_256 p;
+    sp_point_256 p2;
+    sp_digit u[4];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_256_point_copy_4(&t[1], g);
+    sp_256_proj_point_dbl_avx2_4(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_256_proj_point_add_avx2_4(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_256_ecc_odd_4(u, k);
+
+    /* Top window: digit 1 + 2 * u[255..253] */
+    sp_256_get_point_33_4(r, t, (int)(u[3] >> 61) + 1);
+    r->infinity = 0;
+    for (i = 41; i >= 0; i--) {
+        idx = sp_256_ecc_window_4(u, i, &sign);
+        sp_256_proj_point_dbl_n_avx2_4(r, r, 6);
+        sp_256_get_point_33_4(&p, t, idx);
+        p.infinity = 0;
+        sp_256_point_cond_neg_4(&p, sign);
+        sp_256_proj_point_add_avx2_4(r, r, &p);
+    }
+
+    if (map) {
+        sp_256_map_avx2_4(r, r);
+    }
+    sp_256_point_cond_neg_4(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P256 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_256_ecc_mulmod_base_avx2_4(sp_point_256* r, const sp_digit* k,
+        int map)
+{
+    sp_point_256 p;
+    sp_digit u[4];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_256_ecc_odd_4(u, k);
+
+    for (c = P256_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_256_ecc_comb_4(u, c, &sign);
+        sp_256_get_entry_65_4(&p, p256_table, idx);
+        sp_256_point_cond_neg_4(&p, sign ^ neg);
+        if (c == P256_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p256_norm_mod, sizeof(p256_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_256_proj_point_dbl_avx2_4(r, r);
+            sp_256_proj_point_add_qz1_avx2_4(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_256_map_avx2_4(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P256 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_256_mont_inv_order_avx2_4(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][4];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_256_mont_mul_order_avx2_4(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p256_order2[3] >> 60], sizeof(t[0]));
+    for (i = 3; i >= 0; i--) {
+        for (j = (i == 3) ? 56 : 60; j >= 0; j -= 4) {
+            sp_256_mont_sqr_order_avx2_4(r, r);
+            sp_256_mont_sqr_order_avx2_4(r, r);
+            sp_256_mont_sqr_order_avx2_4(r, r);
+            sp_256_mont_sqr_order_avx2_4(r, r);
+            y = (p256_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_256_mont_mul_order_avx2_4(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P256 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_256_ecc_sign_avx2_4(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_256 point;
+    sp_digit k[4];
+    sp_digit x[4];
+    sp_digit t[4];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_256_from_mp(k, 4, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_256_ecc_gen_k_4(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_256_ecc_mulmod_base_avx2_4(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 4);
+        sp_256_norm_mod_4(r, p256_order);
+        if (sp_256_iszero_4(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_256_mont_mul_order_avx2_4(x, d, p256_r2_order);
+        sp_256_mont_mul_order_avx2_4(x, x, r);
+        sp_256_norm_mod_4(x, p256_order);
+        sp_256_add_mod_order_4(x, x, e);
+        sp_256_mont_mul_order_avx2_4(k, k, p256_r2_order);
+        sp_256_mont_inv_order_avx2_4(t, k);
+        sp_256_mont_mul_order_avx2_4(s, t, x);
+        sp_256_norm_mod_4(s, p256_order);
+        if (!sp_256_iszero_4(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P256 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_256_ecc_verify_avx2_4(const sp_digit* e, const sp_point_256* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_256 p1;
+    sp_point_256 p2;
+    sp_digit w[4];
+    sp_digit u1[4];
+    sp_digit u2[4];
+
+    /* w = 1 / s in Montgomery form */
+    (void)sp_256_mod_inv_4(w, s, p256_order);
+    sp_256_mont_mul_order_avx2_4(w, w, p256_r2_order);
+    /* u1 = e.w, u2 = r.w */
+    sp_256_mont_mul_order_avx2_4(u1, e, w);
+    sp_256_norm_mod_4(u1, p256_order);
+    sp_256_mont_mul_order_avx2_4(u2, r, w);
+    sp_256_norm_mod_4(u2, p256_order);
+
+    /* u1.G + u2.Q */
+    if (sp_256_iszero_4(u1)) {
+        sp_256_point_set_inf_4(&p1);
+    }
+    else {
+        sp_256_ecc_mulmod_base_avx2_4(&p1, u1, 0);
+    }
+    sp_256_ecc_mulmod_avx2_4(&p2, q, u2, 0);
+    sp_256_proj_point_add_avx2_4(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_256_map_avx2_4(&p1, &p1);
+    sp_256_norm_mod_4(p1.x, p256_order);
+    return sp_256_cmp_4(p1.x, r) == 0;
+}
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Multiply the base point of P256 by the scalar and return the result.
+ * If map is true then convert result to affine coordinates.
+ *
+ * km    Scalar to multiply by.
+ * r     Resulting point.
+ * map   Indicates whether to convert result to affine.
+ * heap  Heap to use for allocation.
+ * returns ECC_OUT_OF_RANGE_E when the scalar is larger than 256 bits,
+ * ECC_INF_E when the scalar is a multiple of the order and MP_OKAY on
+ * success.
+ */
+int sp_ecc_mulmod_base_256(const mp_int* km, ecc_point* r, int map, void* heap)
+{
+    sp_point_256 point;
+    sp_digit k[4];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(km) > 256) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_256_from_mp(k, 4, km);
+        sp_256_norm_mod_4(k, p256_order);
+        if (sp_256_iszero_4(k)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_256_ecc_mulmod_base_avx2_4(&point, k, map);
+        else
+#endif
+            sp_256_ecc_mulmod_base_4(&point, k, map);
+        if (!map) {
+            sp_256_point_from_mont_4(&point);
+        }
+        err = sp_256_point_to_ecc_point_4(&point, r);
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Multiply the point by the scalar and serialize the X ordinate.
+ * The number is 0 padded to maximum size on output.
+ *
+ * priv    Scalar to multiply the point by.
+ * pub     Point to multiply.
+ * out     Buffer to hold X ordinate.
+ * outLen  On entry, size of the buffer in bytes.
+ *         On exit, length of data in buffer in bytes.
+ * heap    Heap to use for allocation.
+ * returns BUFFER_E if the buffer is to small for output size,
+ * ECC_OUT_OF_RANGE_E when the scalar is larger than 256 bits, ECC_INF_E when
+ * a point is at infinity and MP_OKAY on success.
+ */
+int sp_ecc_secret_gen_256(const mp_int* priv, const ecc_point* pub, byte* out,
+                          word32* outLen, void* heap)
+{
+    sp_point_256 point;
+    sp_digit k[4];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (*outLen < 32U) {
+        err = BUFFER_E;
+    }
+    else if (mp_count_bits(priv) > 256) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_256_from_mp(k, 4, priv);
+        sp_256_norm_mod_4(k, p256_order);
+        sp_256_point_from_ecc_point_4(&point, pub);
+        if (sp_256_iszero_4(k) || sp_256_iszero_4(point.z)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_256_point_to_mont_4(&point);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_256_ecc_mulmod_avx2_4(&point, &point, k, 1);
+        else
+#endif
+            sp_256_ecc_mulmod_4(&point, &point, k, 1);
+        if (point.infinity) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_256_to_bin_4(point.x, out);
+        *outLen = 32;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Sign the hash using the private key.
+ *   e = [hash, 256 bits] from binary
+ *   r = (k.G)->x mod order
+ *   s = (r * x + e) / k mod order
+ * The hash is truncated to the first 256 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * rng      Random number generator.
+ * priv     Private part of key - scalar.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * km       Optional fixed k, zeroized once used.
+ * heap     Heap to use for allocation.
+ * returns RNG failures, ECC_OUT_OF_RANGE_E when the private key is larger
+ * than 256 bits and MP_OKAY on success.
+ */
+int sp_ecc_sign_256(const byte* hash, word32 hashLen, WC_RNG* rng,
+                    const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+                    void* heap)
+{
+    sp_digit e[4];
+    sp_digit d[4];
+    sp_digit r[4];
+    sp_digit s[4];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(priv) > 256) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        if (hashLen > 32U) {
+            hashLen = 32U;
+        }
+        sp_256_from_bin(e, 4, hash, (int)hashLen);
+        sp_256_norm_mod_4(e, p256_order);
+        sp_256_from_mp(d, 4, priv);
+
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            err = sp_256_ecc_sign_avx2_4(e, d, rng, km, r, s);
+        else
+#endif
+            err = sp_256_ecc_sign_4(e, d, rng, km, r, s);
+    }
+    if (err == MP_OKAY) {
+        err = sp_256_to_mp(r, rm);
+    }
+    if (err == MP_OKAY) {
+        err = sp_256_to_mp(s, sm);
+    }
+
+    ForceZero(d, sizeof(d));
+    ForceZero(e, sizeof(e));
+
+    return err;
+}
+
+/* Verify the signature values with the hash and public key.
+ *   e = Truncate(hash, 256)
+ *   u1 = e/s mod order
+ *   u2 = r/s mod order
+ *   r == (u1.G + u2.Q)->x mod order
+ * The hash is truncated to the first 256 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * pX       X ordinate of the public key.
+ * pY       Y ordinate of the public key.
+ * pZ       Z ordinate of the public key.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * res      1 when the signature is valid and 0 otherwise.
+ * heap     Heap to use for allocation.
+ * returns ECC_INF_E when the public key is at infinity and MP_OKAY on
+ * success, including when the signature is not valid.
+ */
+int sp_ecc_verify_256(const byte* hash, word32 hashLen, const mp_int* pX,
+    const mp_int* pY, const mp_int* pZ, const mp_int* rm, const mp_int* sm,
+    int* res, void* heap)
+{
+    sp_point_256 q;
+    sp_digit e[4];
+    sp_digit r[4];
+    sp_digit s[4];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    *res = 0;
+
+    /* r and s must be between 1 and order - 1 */
+    if (mp_count_bits(rm) > 256 || mp_count_bits(sm) > 256) {
+        return MP_OKAY;
+    }
+    sp_256_from_mp(r, 4, rm);
+    sp_256_from_mp(s, 4, sm);
+    if (sp_256_iszero_4(r) || sp_256_iszero_4(s) ||
+            sp_256_cmp_4(r, p256_order) >= 0 ||
+            sp_256_cmp_4(s, p256_order) >= 0) {
+        return MP_OKAY;
+    }
+
+    if (hashLen > 32U) {
+        hashLen = 32U;
+    }
+    sp_256_from_bin(e, 4, hash, (int)hashLen);
+    sp_256_norm_mod_4(e, p256_order);
+
+    XMEMSET(q.x, 0, sizeof(q.x));
+    XMEMSET(q.y, 0, sizeof(q.y));
+    XMEMSET(q.z, 0, sizeof(q.z));
+    sp_256_from_mp(q.x, 4, pX);
+    sp_256_from_mp(q.y, 4, pY);
+    sp_256_from_mp(q.z, 4, pZ);
+    q.infinity = 0;
+    if (sp_256_iszero_4(q.z)) {
+        err = ECC_INF_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_256_point_to_mont_4(&q);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            *res = sp_256_ecc_verify_avx2_4(e, &q, r, s);
+        else
+#endif
+            *res = sp_256_ecc_verify_4(e, &q, r, s);
+    }
+
+    return err;
+}
+
+#endif /* !WOLFSSL_SP_NO_256 */
+
+#ifdef WOLFSSL_SP_384
+
+/* Point structure to use. */
+typedef struct sp_point_384 {
+    /* X ordinate of point. */
+    sp_digit x[2 * 6];
+    /* Y ordinate of point. */
+    sp_digit y[2 * 6];
+    /* Z ordinate of point. */
+    sp_digit z[2 * 6];
+    /* Indicates point is at infinity. */
+    int infinity;
+} sp_point_384;
+
+/* Affine point in Montgomery form. */
+typedef struct sp_table_entry_384 {
+    /* X ordinate of point. */
+    sp_digit x[6];
+    /* Y ordinate of point. */
+    sp_digit y[6];
+} sp_table_entry_384;
+
+/* Number of teeth in the comb used to multiply the base point. */
+#define P384_COMB_TEETH     7
+/* Distance in bits between teeth: ceil(384 / 7). */
+#define P384_COMB_SPACING   55
+
+/* The modulus (prime) of the curve P384. */
+static const sp_digit p384_mod[6] = {
+    0x00000000ffffffffL, 0xffffffff00000000L, 0xfffffffffffffffeL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0xffffffffffffffffL
+};
+
+/* The Montgomery normalizer for modulus of the curve P384. */
+static const sp_digit p384_norm_mod[6] = {
+    0xffffffff00000001L, 0x00000000ffffffffL, 0x0000000000000001L,
+    0x0000000000000000L, 0x0000000000000000L, 0x0000000000000000L
+};
+
+/* The Montgomery normalizer squared for modulus of the curve P384. */
+static const sp_digit p384_r2_mod[6] = {
+    0xfffffffe00000001L, 0x0000000200000000L, 0xfffffffe00000000L,
+    0x0000000200000000L, 0x0000000000000001L, 0x0000000000000000L
+};
+
+/* The order of the curve P384. */
+static const sp_digit p384_order[6] = {
+    0xecec196accc52973L, 0x581a0db248b0a77aL, 0xc7634d81f4372ddfL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0xffffffffffffffffL
+};
+
+/* The order of the curve P384 minus 2. */
+static const sp_digit p384_order2[6] = {
+    0xecec196accc52971L, 0x581a0db248b0a77aL, 0xc7634d81f4372ddfL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0xffffffffffffffffL
+};
+
+/* The Montgomery normalizer squared for order of the curve P384. */
+static const sp_digit p384_r2_order[6] = {
+    0x2d319b2419b409a9L, 0xff3d81e5df1aa419L, 0xbc3e483afcb82947L,
+    0xd40d49174aab1cc5L, 0x3fb05b7a28266895L, 0x0c84ee012b39bf21L
+};
+
+/* The Montgomery multiplier for order of the curve P384. */
+static const sp_digit p384_mp_order = 0x6ed46089e88fdc45L;
+
+/* The Montgomery multiplier for modulus of the curve P384. */
+static const sp_digit p384_mp_mod = 0x0000000100000001L;
+
+/* Base point table for the signed comb: entry i + 1 is the affine point in
+ * Montgomery form 2^330.G + sum over teeth j < 6 of +/-2^(55j).G with the sign
+ * of tooth j given by bit j of i. Entry 0 is not used.
+ */
+static const sp_table_entry_384 p384_table[65] = {
+    /* 0 - not used */
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    /* 1 */
+    { { 0x98993f1e748023f5L, 0x4182a81eb9aadd80L,
+        0x1cba5cd8aeee5153L, 0x67c64d97effee25bL,
+        0xd171fbcfe1ec47edL, 0x3cd9fb828c85cf18L },
+      { 0xe762684bbc85c78aL, 0xb22680b1644cf3c9L,
+        0xeb27cef674fe8d3eL, 0xb0cf1d022a692a2eL,
+        0x23b5af149067add0L, 0x9ce9dc8b18ea6c68L } },
+    /* 2 */
+    { { 0xed51494c8f46e8eeL, 0x647e83b0c799401eL,
+        0xc8b1837627cab341L, 0x05ee5bb5470da2c1L,
+        0xdc843aaf7a17df0fL, 0x3402bb670957dc20L },
+      { 0x90dce48e84ac4aebL, 0xf6f69f5db64351b7L,
+        0x888bbb80bdea2049L, 0x62d19b27c789031bL,
+        0xfcde7ac1d2117e33L, 0xd7f83c88afa42969L } },
+    /* 3 */
+    { { 0xfc2cd34efefdef4cL, 0x7a7580386c2fd85cL,
+        0xeb646a7321823234L, 0x7df02530a125a66dL,
+        0xcc9497ba74b96759L, 0x18ddd052f55c6b58L },
+      { 0x8873b8264f16688cL, 0x094502f3aa5dfbc5L,
+        0x4f3ccc2010055b83L, 0xd0c3b88260080874L,
+        0x45b102d815932e57L, 0xd4a361101bad7f6bL } },
+    /* 4 */
+    { { 0x17287a721fdbab11L, 0xb7368646c90760b9L,
+        0x02e927f7f4376158L, 0x600d77a29fd11b59L,
+        0x3e13dfd6a040e8faL, 0x5a9f62396ba6791aL },
+      { 0x6d6780900d228202L, 0x59934b7b9f15ef56L,
+        0xb3f7dfaa6b4bf6c6L, 0x24d472f0455bbf6eL,
+        0x5b3f73ccd6b27771L, 0xb5b168bdd22e63b7L } },
+    /* 5 */
+    { { 0xf93590d692c504a4L, 0x882245b474ac9fc5L,
+        0x3cc70d0682b0c1d3L, 0xf33d8246e4019acfL,
+        0x055dc496a893d139L, 0x6f424b52cdf85ea0L },
+      { 0x0a4842c091876529L, 0xe138c8936d0ad42cL,
+        0xd727fe4d399fd2abL, 0x2e4f9996db41ff71L,
+        0x1bfadff80e112aa0L, 0x3351a996c6eebaeeL } },
+    /* 6 */
+    { { 0xcc8e244bff0e57e9L, 0xc0c0d44a2a044e60L,
+        0xa3b8e6dab5f85b8aL, 0x0502348677ba78fcL,
+        0xf3a9535b10d3a105L, 0xaa4f702dc349dae2L },
+      { 0xdf98f6b621072fb7L, 0xfd6528209a7dcedfL,
+        0xd064865fd0738d08L, 0x875bd6b19434d12aL,
+        0x90e401dd03fa8c4dL, 0xd80be59402139d0bL } },
+    /* 7 */
+    { { 0x6e61d49c0c50b53fL, 0xd5e887610befa2d6L,
+        0x48a5be756c1be920L, 0xc5de771f4b2a4695L,
+        0x94f9a75fc567d24cL, 0x85e6e69313da21e7L },
+      { 0xbc84d08df00210d6L, 0x6be246735a471acbL,
+        0x265b25b3bc3185fdL, 0x7280009cba1b3619L,
+        0x0f82de8402d9646eL, 0x37dee7a1f9833befL } },
+    /* 8 */
+    { { 0xead594ada6d7901cL, 0xe0864b3a9f26c654L,
+        0xaad22bf326c4e855L, 0xd29a924e8e0888d8L,
+        0xa7f925a32c67edecL, 0xdbc1df3484288cd5L },
+      { 0x60d7755e0e22e37eL, 0x0c6c48f4bcc5e40eL,
+        0x5d0e7e22227b1c08L, 0xd7563e62a62f651bL,
+        0x2d5b8a1fec2b1b26L, 0x3c2831676c3777a9L } },
+    /* 9 */
+    { { 0x08746d34af6bf0ddL, 0x344597d3b59b0f85L,
+        0x8ce346cec3f0d600L, 0x7b788427bc61ab3cL,
+        0x9e30e46b1cef5ae0L, 0x321f2beb6b88e1adL },
+      { 0xbc2e903d2ba2eccfL, 0x161773820de6c0f4L,
+        0x663561a1f5884e53L, 0xbb5072ea9064332aL,
+        0xefb304b9dea807edL, 0x938290bf6bb4fb55L } },
+    /* 10 */
+    { { 0xd868a616488f4d10L, 0x66a7e2222b5dd3b3L,
+        0x304cf108bb779dc7L, 0x0ab31ff7b8d9e3c0L,
+        0x8f95c86388042cb3L, 0xcd8f41bace927a43L },
+      { 0xe3a9cada409bd664L, 0x3f46bb5cc57b9799L,
+        0x7cde6736bf70560dL, 0xf7f9054714b52e9fL,
+        0xa483e87048ce5622L, 0x79cb63be8b911a8eL } },
+    /* 11 */
+    { { 0x6f6389736a508880L, 0x4aa6617e3f024972L,
+        0xd1295b879b3fe4f4L, 0xfb0bb8dc301b721fL,
+        0xf4589e53898db4e5L, 0x14e628ad1f5da52aL },
+      { 0x3bbe769019d4cabaL, 0x411ec7f5b2e92c1cL,
+        0xf1d00fe7298b2fcbL, 0xf535c9ce5e17d7dfL,
+        0x4348b09595889db5L, 0x99d98465bf3837ceL } },
+    /* 12 */
+    { { 0xb960dc59117988d0L, 0xdbe6bff5c5f8161fL,
+        0x2f3fce3993350bcdL, 0x174ac4b520d7eef7L,
+        0x3ee7b15404dd77c1L, 0x48602df365a974c4L },
+      { 0xcc815470ebb5e9ffL, 0x9a6cfe6e94285fe9L,
+        0xa1c652375c87bb48L, 0x86f62f2473e205dfL,
+        0x4fb3b6567a43c1e5L, 0xfd8c0379ee763420L } },
+    /* 13 */
+    { { 0x20a69757c04253e7L, 0x8f8fe269caf833abL,
+        0xd7adb328df04c093L, 0x11d01e72924843baL,
+        0x856093c8164d1a2aL, 0xe445c156b426b4a6L },
+      { 0xdefe11edc06a4f25L, 0x9e977df349072f20L,
+        0x99e447ce171fad64L, 0x910827633a93898bL,
+        0x41e26111aec60444L, 0xc7e1efdb98c032baL } },
+    /* 14 */
+    { { 0x272dde7032fd47cdL, 0x78201fff1f2a3c6fL,
+        0x2b54b19629051dddL, 0x90c79b7de63228fbL,
+        0x11f059eb520cc4bdL, 0xde331ea0f597e0c9L },
+      { 0x0cfee9ad5bb8367aL, 0x814d8354a47f5f05L,
+        0x3ed297880fd4cd71L, 0xf73659c4e69b3f0aL,
+        0xddbd57a09d5af9d3L, 0x4e2f8361ac16f4eeL } },
+    /* 15 */
+    { { 0x7617d89e17c13080L, 0x3fd5fbe0b26a0542L,
+        0x4247f1f2fb0d66a9L, 0xeeaa22606c002c2dL,
+        0x056a9078186f662fL, 0xa8af23af1de2e533L },
+      { 0x30306ad85f5e76b7L, 0xe7a33f1228deb2f6L,
+        0x49c5c09c23548745L, 0x44159323ded4af8aL,
+        0x21209293176822bdL, 0x475a75a36f35cbf3L } },
+    /* 16 */
+    { { 0x64fceafa03584b6fL, 0x55452824e8322a22L,
+        0xbe653fc3aad88686L, 0xa2cf58327742fefbL,
+        0x1d77bd7474ae1133L, 0x962dd2c95a7e0839L },
+      { 0xef339f693a9d964dL, 0x3ff3b106b5029a5cL,
+        0x8519ecf56deb8a20L, 0x91e1a2afba40b53bL,
+        0x12c4d8e97a0f4948L, 0x3a140d78e8c157fbL } },
+    /* 17 */
+    { { 0x5265aa0b21fa9b64L, 0xaa5c29204b3bad43L,
+        0x64ddfbda3e9fa615L, 0xf70c0b713bbf2f6fL,
+        0xd03d29e757a2e829L, 0x559d15dd44daf95dL },
+      { 0xed48b117ec0ecaf0L, 0x94c39a81044a9a19L,
+        0x7a7321cf451af89cL, 0x9e95810f07edf1d3L,
+        0xbc1720e96bfd2d3aL, 0x8800fcb0bc678304L } },
+    /* 18 */
+    { { 0x2e4fc9b7a2c1d956L, 0x5e887945e13ac733L,
+        0x6b744635dd72f165L, 0x95446a637dc1e145L,
+        0xcc53b23d4138336eL, 0x2aec4390dc13a39cL },
+      { 0xc1e735c19129240fL, 0xe0f53c9cfbe3184fL,
+        0x040ca46adcf037c8L, 0x492dba2a9268869eL,
+        0xc304199b1ced3400L, 0x30d0711a399581bcL } },
+    /* 19 */
+    { { 0xae7675c0338572e2L, 0xca696a1b7222095dL,
+        0xfa61aaebd124139dL, 0x6b5df3f7d3b7e769L,
+        0xc18820b9a6cca5f3L, 0xdc3fa12824ffc599L },
+      { 0x6a1bec49920d67eaL, 0x5d8e3fe62eb50c19L,
+        0xacb929dfff8b27e5L, 0x9e15c0eb6063c7c5L,
+        0x1b0e8a2b9fdb432bL, 0xe7531bd382ca53d2L } },
+    /* 20 */
+    { { 0x548a037603a9dc28L, 0xd182a68cf3e55610L,
+        0xe30d8940c8ae98ccL, 0x148fd96410ab3942L,
+        0xf26b1a334f8594faL, 0x1d4a4717cab825f7L },
+      { 0x1b59e5b1a6263c2eL, 0x097791c68ad4ae26L,
+        0x15e01dcf5d0e5a52L, 0xfce869ea35f1ca99L,
+        0xacc6d34abcf6c8a5L, 0xf29ae57629c273a4L } },
+    /* 21 */
+    { { 0xaa7f81cc8086d10bL, 0x20c54e0febbd392cL,
+        0x7f70aff437edc643L, 0xc0f1c5e69ae933dbL,
+        0x1e95ceb785fcfa4aL, 0x5d54a718ec38dbd9L },
+      { 0xcf47573b554cbb2eL, 0x4168973af6c30052L,
+        0x57b37c8a76084ddeL, 0x3fcd2a466f1f1a04L,
+        0xeac4ee865196d4b9L, 0x54fbb76d404ea28eL } },
+    /* 22 */
+    { { 0xfcaf89d3db34b9e0L, 0x6e16286fa4946978L,
+        0xea771bb9758bfacdL, 0xd5c0d19fb2d1386bL,
+        0x480b1f9ebf60d55eL, 0x90d7701e17f45030L },
+      { 0x1701e3af11d85d97L, 0xfd2c997ccba6f918L,
+        0xcad4168472d47f63L, 0x6175e6687a9130e4L,
+        0x7f555ca07ab47a5fL, 0x13ebbd381b5130c4L } },
+    /* 23 */
+    { { 0x30e42ae74d96314cL, 0xb48a3c5d237a88f7L,
+        0x18ea6470b0dfff30L, 0x082110af6bd49c69L,
+        0x48a92ad10cdf9072L, 0x22a8bb3cc0e49123L },
+      { 0x0046f93e91edf891L, 0x212b5d06592ce7baL,
+        0xbf4c5baebd7b2665L, 0x2d2ebe43d576505bL,
+        0x0e53c8eee168641aL, 0x785198df10c24926L } },
+    /* 24 */
+    { { 0xa5ea735af0827dfdL, 0x23bbabb07b3a7891L,
+        0x3aba475257012472L, 0xa1ad37a530cc5b7eL,
+        0x09d1d3167bcb311dL, 0x4c946801ced8dd48L },
+      { 0x41c109ac4f828557L, 0x48b9bfe7c9eac340L,
+        0x6fb2317175dca3daL, 0xf0fa38f6b39f508fL,
+        0x5cf330f745ff16d4L, 0x0af7122787c98c4eL } },
+    /* 25 */
+    { { 0xa9ebe5ed62c0e9d8L, 0x622e4ead30abaaebL,
+        0xec2a97c08c14a81eL, 0x0e76a332172511e8L,
+        0x01bd6aa72332e149L, 0xf7df291c0d50c6b4L },
+      { 0xc0fbaa41d52c80e2L, 0xcc29f38ad2847acdL,
+        0x204122cde06509d5L, 0x4a9a3d1b381a9527L,
+        0x7e62cffb3de4c0adL, 0x7f8c3099f41bbdedL } },
+    /* 26 */
+    { { 0xf218cd6ae776d891L, 0xa61250e2afff4b71L,
+        0x5b7a5018e2d5b99dL, 0x51dc15e44dff8f9cL,
+        0xa3078772ab04cd29L, 0x35171d4ff11a796bL },
+      { 0xc53dd10ef68b30edL, 0x55eaa6fcb8a7d076L,
+        0x762f9daf93080d43L, 0x9268492fbae7a952L,
+        0x4c9f90d6af944c80L, 0x336e0f29e8f1b503L } },
+    /* 27 */
+    { { 0xbe05aa4457314de0L, 0x068d09ed59358543L,
+        0x198dc3de24092a2bL, 0x78571a1557069ae7L,
+        0xa8108b02a1bfc6bdL, 0x6bb0ffe0468e6142L },
+      { 0x85d2a4a9f24dfbd0L, 0x20826c114afd348bL,
+        0xd1ff05193513d028L, 0xa46de017d19d35b1L,
+        0x2145168b9881be80L, 0xb6d31a077cb4c864L } },
+    /* 28 */
+    { { 0x16fb6ca22f2d86f5L, 0x69a5115a8a4104b8L,
+        0x27818a57b75ffc28L, 0x78638465920e3f90L,
+        0x019f98cae699b7d4L, 0x25606742113fa7c3L },
+      { 0x7ebd68f1ca0dc05bL, 0xcf38397943da675cL,
+        0x7586bfc98e6d6508L, 0x45508b29b883a067L,
+        0xe88fcf9e341848f1L, 0x60f1dcbc3919e826L } },
+    /* 29 */
+    { { 0x6384fcb192d5f51eL, 0x547c2bcdd5beac07L,
+        0x78a429b9996886c1L, 0x72d41e2e776ee156L,
+        0x4d2bbf707722a5ceL, 0xb7378682e80cb78dL },
+      { 0x41a12ca672629e27L, 0x05952572838f671dL,
+        0x1468543ac06f4b32L, 0x0e2be61a4648ac16L,
+        0x8044dc6075cb5866L, 0x6c5cbc1012753d45L } },
+    /* 30 */
+    { { 0x2f1af52f47eddc6cL, 0x68c328e0a2768a5fL,
+        0x01d0773536ae9f4bL, 0xcd26bc4be1dc99bdL,
+        0xc90be6617c52e080L, 0xa52c4916e809aff3L },
+      { 0xa7cea39461bd22b5L, 0x313013d3d6f14787L,
+        0xe932d1a7c3779365L, 0x41f8d8ec202d236fL,
+        0xeb5e476f7e7b53e6L, 0x495e2a3aff1de7d0L } },
+    /* 31 */
+    { { 0x0fa1efc87bb1e314L, 0x3f067fd888008423L,
+        0x5c62d82d6e5eee5fL, 0x55d7712802b35f83L,
+        0xed81a13e6e9330abL, 0xdaf95bdf5bad2ebeL },
+      { 0x84e664ab11ab8956L, 0x47eee49bba6ea167L,
+        0x8397f46dc54d7640L, 0x521f61e2b91c2074L,
+        0xe9b46bc45a2b4098L, 0x7a79838a96df6013L } },
+    /* 32 */
+    { { 0x083c9e14b85fe602L, 0xba79486f8ef1d179L,
+        0x38cf6f721ba04c5eL, 0x08980629fb286c49L,
+        0xf3ec5f91cdef1d87L, 0x585a622ecf910116L },
+      { 0x92c8af2b2aab8f2aL, 0xff55360093f96650L,
+        0x9483713ee76b5a9eL, 0xaf12bb36d7e6191bL,
+        0x449e7ecdcbf1358dL, 0x55ca597e5b09c33aL } },
+    /* 33 */
+    { { 0x12aa1e1f901f124aL, 0xd0f04256a696dfb2L,
+        0x828c067ca97302dcL, 0x1584fadfbd8e1a4eL,
+        0xc5769283b6f36723L, 0xfa8e5a1e0e76ddceL },
+      { 0x98871fefc1a136a6L, 0x675daee2220db25eL,
+        0x9566e9a81c9cf740L, 0xf685d50116eb178aL,
+        0xa301510109ab438cL, 0x280efb35cdcb7e64L } },
+    /* 34 */
+    { { 0xaccaf7c972a1557aL, 0xb6d33e57acacc301L,
+        0x0e78d0cef5166215L, 0xcfa361eed0308e89L,
+        0x1c254c1518b33d1aL, 0x887ac83d0bcf54bbL },
+      { 0x95384b343bc0a24cL, 0x4422bb4090c0ee6fL,
+        0x249583b0059a7157L, 0xdf83d8a3cc56715cL,
+        0x2bbb1e19467de872L, 0x9bfb6189fe99b0bcL } },
+    /* 35 */
+    { { 0xa448d5cdd4d2178dL, 0xd70f40af4c9e7dc4L,
+        0xf21175deb717a8b1L, 0xc137eb2c56d53acfL,
+        0xab24639be01a7628L, 0xca85051f917deec6L },
+      { 0x90eadba406fefb07L, 0x5d0006cf4f2d5baeL,
+        0x9162f1b06096032fL, 0x5a95dcd8ce076137L,
+        0xe41beb17ed81a230L, 0xaa2545fb9e50c436L } },
+    /* 36 */
+    { { 0xf555998aa548fb08L, 0x5b603c5170da8731L,
+        0x31ff448d6a05edb6L, 0xe960d09f701842bdL,
+        0x751e78289b893cc7L, 0x807a7ca15b07a545L },
+      { 0xbbdb7167197d3c22L, 0xa0f3def4783da090L,
+        0x9ec19d05c46fc7b4L, 0xcd0ea3a854cccdc3L,
+        0x64a3f9a11ed168b8L, 0x8c7da2c366f19930L } },
+    /* 37 */
+    { { 0x28735f0599df77d6L, 0x25f34fb1addee8b3L,
+        0x57b065d0f161c674L, 0xef187cc92fb4f427L,
+        0x28485d5a9dd07bdfL, 0xfe6d4bcec4630fc0L },
+      { 0x6db74b8ead334bfaL, 0x77926d63c02afd76L,
+        0x5e6735bff02e8336L, 0x4d0f6c683fb9686cL,
+        0x1684c4d04898dc64L, 0x771f0793184dcf23L } },
+    /* 38 */
+    { { 0xe0de13ef2cc8c6f7L, 0x78f6c14cbce5ea11L,
+        0x787bca96ddc18a34L, 0x03f4251cb9468ce3L,
+        0xdcc675b58debdf2eL, 0x4eda7e3457fcdfc2L },
+      { 0x6f0d8c0f1e509fa0L, 0x8913affcbfc2d93cL,
+        0x6e6d6fa5148a4518L, 0x7a4fe5b5b85b041dL,
+        0xfc50b1376bf08409L, 0xb9411a7be2692e81L } },
+    /* 39 */
+    { { 0x0f23bbb2ea02381eL, 0x1b49043ab9af2749L,
+        0x251f29b623044fd6L, 0x667377d3b183e655L,
+        0xf3c5d0bdd8d9ad1dL, 0xf42bc1bc1d4310d7L },
+      { 0xf771a37620a0047cL, 0x8d951cffe0a21a9fL,
+        0x4900b11af3b2bce7L, 0x15142ec778e15dd2L,
+        0x1cb138d8f5305545L, 0x5f54fa2cd024edddL } },
+    /* 40 */
+    { { 0x6c63d4413756fb20L, 0x3afcca6c8b0f8f5eL,
+        0xd372d2379116c834L, 0x0582b966af913bfcL,
+        0xdc74ddb9f27ccc43L, 0x62892dda81b2b04bL },
+      { 0x2a946870a8816af0L, 0x7f01a4d8517380fbL,
+        0x68d0b25ecc486c8aL, 0x3b8e445b07af1d24L,
+        0x5e555cd849071990L, 0xabf72a1f8c2647bcL } },
+    /* 41 */
+    { { 0x315bd3ca05859860L, 0x5a03fbab804cd0eaL,
+        0x0c4782215e30ebfaL, 0x51342df541c1e84aL,
+        0xdf65f37c69978b77L, 0x4f3c1aed1501d86fL },
+      { 0xd1bad6452cdcd417L, 0x9e8b79774163800cL,
+        0x7f8b25ed0b0fef68L, 0x5e97158ee62ccc9aL,
+        0xaacccb42e37b2a45L, 0x3e42dfab4cd5be88L } },
+    /* 42 */
+    { { 0x0e36a488d6c801ccL, 0xea37eb999fbf8ab1L,
+        0xb938716d015b293eL, 0xe04c812af96cb12eL,
+        0xd6db7e672150bb39L, 0xf48833eb189d998cL },
+      { 0xb945b8986b935556L, 0x097adc2e6b5b9179L,
+        0x64369e5fa8a22191L, 0x8b03da57171669fcL,
+        0x39161ddd9752b143L, 0x1e0393fbfa5dc882L } },
+    /* 43 */
+    { { 0xc4e9da3529fbb19eL, 0xf4efd1c8fa5ce40bL,
+        0xb135bad7f5e1d8ddL, 0x633f4eb9d32eb97aL,
+        0x74798972eeb11bc0L, 0x8fe8ec25ebf4d6e9L },
+      { 0x3a61b7a0399e129fL, 0xbcc971b6883bf6eeL,
+        0x707f3fa23183ea8aL, 0xa29f695fac5509bbL,
+        0x0d80b8896d4a87f8L, 0x0e00ed3070533f30L } },
+    /* 44 */
+    { { 0xde06d4cdc84ef659L, 0xc75070e17ad833c1L,
+        0x09de72bf895c1237L, 0xaa209d67c92987d7L,
+        0x7faeb18fdca34eaaL, 0xd269d7736ac50997L },
+      { 0xff5441876cb75d63L, 0x9b84f7b417574694L,
+        0x1a66aebbdad6769dL, 0xd0632a980e09f3c5L,
+        0xe0a38a3e8b28ebb2L, 0x5d37adf611845df0L } },
+    /* 45 */
+    { { 0xdeae9f74e8e460e5L, 0xebfd2e22badb0d51L,
+        0x95b44af17dcfbf59L, 0x6a5771f571010408L,
+        0xa115aec42699cf89L, 0x528a19875ac9bc6fL },
+      { 0x618c9514f5d924e6L, 0x3bed795327356452L,
+        0x6f539582eeb8ceebL, 0x7f5bd643c08e1125L,
+        0x7235513f0d6b05e8L, 0x2060277838c4fe03L } },
+    /* 46 */
+    { { 0x4f2e5fb4a900f1c1L, 0x064abe6f92a4d18bL,
+        0xb191cf5f98bf469dL, 0x36223970ae5da651L,
+        0x9a5cd5a07e21b961L, 0xfd6ba2025c45a82bL },
+      { 0x4673f4f528e141a3L, 0x92be7af0755d048cL,
+        0xb836cb9c4921b278L, 0xbcb5a0e2a3aece44L,
+        0x8b1a06e85585b421L, 0x892ba43cc3a27eceL } },
+    /* 47 */
+    { { 0x9e73b04a9447309aL, 0x22ba6f0f415a5411L,
+        0xd7aad0342d7e4b28L, 0x720a21605fd9e584L,
+        0xb0c9b2a8123ad99fL, 0x42c9f3948b4078d8L },
+      { 0x647b45e3f2623f6fL, 0xc658a01b1b828863L,
+        0x845026a7fb424c8eL, 0x219327ad0dbf6f3bL,
+        0x871751187d204f62L, 0x2d2e10b35345ed03L } },
+    /* 48 */
+    { { 0x524137c02a5ad314L, 0x832faa299e538fa4L,
+        0xc91cee6daf269709L, 0x23ac8b5c474546e2L,
+        0x30ed919daf461df1L, 0x9430d3a077a467e5L },
+      { 0x9fb217027c03c6d6L, 0x0b4739cba5d27743L,
+        0x297a74647b034339L, 0x88e8a2230acdced9L,
+        0x658a43d515dde985L, 0x702c35f995d98983L } },
+    /* 49 */
+    { { 0xe0fa78d3c072fc7eL, 0x4cdac149b57597f2L,
+        0x77d782b7a9b4ab96L, 0x7ae25f69c7d68f90L,
+        0x2f0f8d5d1064e1dcL, 0xc10396b5fd6bbb04L },
+      { 0x1504a75c2828ab59L, 0x2ac47f52db7fc4ddL,
+        0xcfa5dd7923425bbfL, 0xdae9a5522f9def57L,
+        0x14e1c7b308ece4e8L, 0x8d75262ce6c76052L } },
+    /* 50 */
+    { { 0x91fa332d7d0e4cfeL, 0x3d210a37f65b36d9L,
+        0x52d991fb6011e1b2L, 0xad23fbc7e97fbefdL,
+        0xfeb70107348c61afL, 0xc0332a4e9dbf546bL },
+      { 0x3f1d5af89e1c1718L, 0x56cad9a4831d204fL,
+        0x4d6b1dfb350876b6L, 0xef73b101e3f51998L,
+        0x8f23b47386d51cccL, 0x273e7bbd95a9cf3bL } },
+    /* 51 */
+    { { 0xa453545bea04a312L, 0xecb95d984b255ce7L,
+        0xdfc6d68076725555L, 0x502124d913f3e935L,
+        0x5a4ee39cb28a2ae8L, 0xe75249b702119928L },
+      { 0x1c3c33558ea5f26bL, 0x3838b99399e0a948L,
+        0xa838368f5fcb95bbL, 0x8282bf15ad3d68adL,
+        0x67fe6110f6137d77L, 0xe416fbae3e95e89eL } },
+    /* 52 */
+    { { 0x8a22b72466c08c61L, 0xd9ba71e071bdb5f2L,
+        0x1a53a86eaa1144a1L, 0x7759f608fb3ce7bfL,
+        0x326352dacd6f278bL, 0xcbbfb490b34987efL },
+      { 0x0cfadba313eafd12L, 0xd798340f669b8edfL,
+        0xb3826ad41564a5a5L, 0x9e6871f1fcb0a887L,
+        0x5f12746ba57fdfa0L, 0x18beb94548b228b2L } },
+    /* 53 */
+    { { 0xe5e9c60bb99c2c9fL, 0x08d9dcb868ada453L,
+        0xda2b37d079a0902dL, 0x233cda91150e9240L,
+        0x497a3adcf514bdfdL, 0xc7da2c4bd9912a61L },
+      { 0x72d310ebc81d8e58L, 0x4281cb54a0ff46cbL,
+        0x35a00121bff709f5L, 0x2ebb3c62f1350e7cL,
+        0x2e5bf9ca46690154L, 0xc68f5ddd153d32a9L } },
+    /* 54 */
+    { { 0x756530aec3b44e3fL, 0x13614ee4c167b1abL,
+        0x8679f373c77d437cL, 0xdc4205f2e27bd502L,
+        0x36d6a2d9e176f061L, 0xf17637906b7514beL },
+      { 0x37c57ce0b7e5a42aL, 0x9b502b884c123381L,
+        0xd2b3ea5d98739336L, 0xaff3f56bc7863c1dL,
+        0x94e752ca6eccdfdcL, 0x38c52501816ee600L } },
+    /* 55 */
+    { { 0x323ba2023344f637L, 0x74131dc7fdcbe083L,
+        0xeb63c1b9ba427a9cL, 0xcfafa16170e623bdL,
+        0x057677da16d23cccL, 0x3ee24376e0766d1dL },
+      { 0x2778a160a38d2174L, 0x04f32d92beb5e896L,
+        0x4dfb5512435cc3ddL, 0xc77f46bd672930c6L,
+        0x7003966f7b7a0d9bL, 0xcd48029c9c8c5807L } },
+    /* 56 */
+    { { 0x9dcddcd1012eabc8L, 0x4594f19f6b728345L,
+        0x9f74b805655b83b9L, 0xd3eb835cd79903c6L,
+        0x13573acb58cf22c8L, 0x5a53ed8bda372c91L },
+      { 0x4309de522d960967L, 0xaa6b77c10bd541dfL,
+        0x1a69781cf8d94ab7L, 0xb5b3a765272b831cL,
+        0xb63a88a830b96f27L, 0x31c055d03f9ba90aL } },
+    /* 57 */
+    { { 0x4bcd622baab1972cL, 0x4b09c104db367e8bL,
+        0xe7b7651418e18d2fL, 0x97bdf14918b6c02cL,
+        0x3a853c7e3a3da2f7L, 0x742eb2b206068d62L },
+      { 0xd9e599f5c29f7806L, 0x1bc15cf27d0c4413L,
+        0x3e615ff81084f094L, 0x8fe3d79be64d909bL,
+        0x2c5862caf0c0ce5eL, 0x6d15b869839445e8L } },
+    /* 58 */
+    { { 0xcc6679529e074e99L, 0x8596e4726bce7cedL,
+        0xaa7259df8fbede9dL, 0x6a392ee186b5303eL,
+        0xc96d91155ba9b2b6L, 0xd86d169bba8b1d58L },
+      { 0xc18c5a7bb960e454L, 0xa41f1966357fee72L,
+        0x2ec9dcc575b88e5dL, 0x58d12b3bcab8f259L,
+        0x0a9a56d763217168L, 0xff36e4b917fe29f9L } },
+    /* 59 */
+    { { 0x7ec7868d873b81c3L, 0xb35dc46ac7be14ccL,
+        0x07c363e038b7da9cL, 0xdf72c96ec9b71fd1L,
+        0x5df8eb0101fdfe4eL, 0x4478fcd913b7e6d2L },
+      { 0x7fee14b2f07946b1L, 0xec4ec5dc0052b0ebL,
+        0x8c5e55daf0858019L, 0x18e253a4dbac25bdL,
+        0xc12ad1b082f9f8d9L, 0x4cb778e2d3ef52f6L } },
+    /* 60 */
+    { { 0xa78c1142c341d900L, 0x746b8bf3469163f8L,
+        0x43b606b401212825L, 0x5d93849dfbb8bf23L,
+        0x6df4490aa2bd18f8L, 0x91f9b73bcc60bfabL },
+      { 0x98fd9b84842671f4L, 0x1973d40f193752eaL,
+        0xf1a01a3f90e332f7L, 0x2688c3ae38d317c3L,
+        0xae7e556d0e98b39cL, 0x11144d94a416bdbfL } },
+    /* 61 */
+    { { 0xb392926be3cd0e51L, 0x3cb1bac04770a5c3L,
+        0xba8b93ac74dd6bceL, 0x3f67881785caddb7L,
+        0x5223f470e8554d49L, 0x6a72dd48ce1a1f0fL },
+      { 0xde609a440c310a28L, 0x0984e0803d9c658dL,
+        0xe9844b391396540aL, 0xa130261832c1c9a8L,
+        0xc98eac9fe668932fL, 0x5ed21bc477ee9117L } },
+    /* 62 */
+    { { 0xd9d2761c52588530L, 0x4512e1de9eda9703L,
+        0xfb8af68ddb0dfb00L, 0xad9d85dcdfb50685L,
+        0xc8090f0f47af43bbL, 0xb04060f8ee60464eL },
+      { 0x3d5fc0832c772763L, 0xe04c7c0221037ceeL,
+        0xf38a17f40e2177f7L, 0xa51ac8be6c76f4e1L,
+        0xe022ab3c6ae38858L, 0x86960d88925c2bafL } },
+    /* 63 */
+    { { 0x976fc0e3ce012dcfL, 0x7efa8724e959ea3aL,
+        0x15b628d749596cd6L, 0xa9275f0a3b71406dL,
+        0xff17f240b8e4ce0eL, 0xf463ef55ef16c83bL },
+      { 0x7cf6401a4c280d1bL, 0x485a95ddaa92a3a9L,
+        0x53dc1a0c07c53c39L, 0x91293e7f56cb2af7L,
+        0xed39310a6eae16a5L, 0x4d5b5ed34e3a0d09L } },
+    /* 64 */
+    { { 0x7d7e6e267653e62eL, 0xd2110e1262c43f1bL,
+        0x9f7f959bae96e4d7L, 0x53095665ec0b319eL,
+        0x6735c313defe2db6L, 0xe7ab17721f463b99L },
+      { 0xe9102f9dd6d70cb1L, 0x4605e73e9f7cea27L,
+        0x500ab62649f6e883L, 0x1d681b0f379f79bcL,
+        0x384f33376e6b0b9cL, 0xd231172d91bb38d9L } }
+};
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mul_6(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_sqr_6(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_384_add_6(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_384_sub_6(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_cond_copy_6(sp_digit* r, const sp_digit* a, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_reduce_6(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_int64 sp_384_cmp_6(const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_384_cond_sub_6(sp_digit* r, const sp_digit* a, const sp_digit* b, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_reduce_order_6(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_add_6(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_dbl_6(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_tpl_6(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_sub_6(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_div2_6(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifndef WC_NO_CACHE_RESISTANT
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_get_point_33_6(sp_point_384* r, const sp_point_384* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_get_entry_65_6(sp_point_384* r, const sp_table_entry_384* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#else
+/* Copy the point at index idx of the table into r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of points.
+ * idx    Index of point to copy.
+ */
+static void sp_384_get_point_33_6(sp_point_384* r, const sp_point_384* table,
+        int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(r->x));
+    XMEMCPY(r->y, table[idx].y, sizeof(r->y));
+    XMEMCPY(r->z, table[idx].z, sizeof(r->z));
+}
+
+/* Copy the table entry at index idx into the point r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of affine points.
+ * idx    Index of entry to copy.
+ */
+static void sp_384_get_entry_65_6(sp_point_384* r,
+        const sp_table_entry_384* table, int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(table[idx].x));
+    XMEMCPY(r->y, table[idx].y, sizeof(table[idx].y));
+}
+#endif /* !WC_NO_CACHE_RESISTANT */
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_add_one_6(sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_from_bin_bswap(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_from_bin_movbe(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_to_bin_bswap_6(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_to_bin_movbe_6(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef HAVE_INTEL_AVX2
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mul_avx2_6(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_sqr_avx2_6(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_384_mont_reduce_order_avx2_6(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Read big endian unsigned byte array into r.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  Byte array.
+ * n  Number of bytes in array to read.
+ */
+static void sp_384_from_bin(sp_digit* r, int size, const byte* a, int n)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_384_from_bin_movbe(r, size, a, n);
+    }
+    else
+#endif
+    {
+        sp_384_from_bin_bswap(r, size, a, n);
+    }
+}
+
+/* Write r as big endian to byte array.
+ * Fixed length number of bytes written: 48
+ *
+ * r  A single precision integer.
+ * a  Byte array.
+ */
+static void sp_384_to_bin_6(sp_digit* r, byte* a)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_384_to_bin_movbe_6(r, a);
+    }
+    else
+#endif
+    {
+        sp_384_to_bin_bswap_6(r, a);
+    }
+}
+
+/* Multiply two Montgomery form numbers mod the modulus (prime).
+ * (r = a * b mod m)
+ * The reduction uses the special form of the P384 prime so that the
+ * multiplications by the modulus are shifts and adds.
+ *
+ * r   Result of multiplication.
+ * a   First number to multiply in Montgomery form.
+ * b   Second number to multiply in Montgomery form.
+ * m   Modulus (prime).
+ * mp  Montgomery multiplier.
+ */
+static void sp_384_mont_mul_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* b, const sp_digit* m, sp_digit mp)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_mul_6(t, a, b);
+    sp_384_mont_reduce_6(t, m, mp);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Square the Montgomery form number mod the modulus (prime).
+ * (r = a * a mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * m   Modulus (prime).
+ * mp  Montgomery multiplier.
+ */
+static void sp_384_mont_sqr_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* m, sp_digit mp)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_sqr_6(t, a);
+    sp_384_mont_reduce_6(t, m, mp);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Convert an mp_int to an array of sp_digit.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  A multi-precision integer.
+ */
+static void sp_384_from_mp(sp_digit* r, int size, const mp_int* a)
+{
+#if DIGIT_BIT == 64
+    int j;
+
+    XMEMCPY(r, a->dp, sizeof(sp_digit) * a->used);
+
+    for (j = a->used; j < size; j++) {
+        r[j] = 0;
+    }
+#elif DIGIT_BIT > 64
+    int i;
+    int j = 0;
+    word32 s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i] << s);
+        r[j] &= 0xffffffffffffffffl;
+        s = 64U - s;
+        if (j + 1 >= size) {
+            break;
+        }
+        /* lint allow cast of mismatch word32 and mp_digit */
+        r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+        while ((s + 64U) <= (word32)DIGIT_BIT) {
+            s += 64U;
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            if (s < (word32)DIGIT_BIT) {
+                /* lint allow cast of mismatch word32 and mp_digit */
+                r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+            }
+            else {
+                r[++j] = (sp_digit)0;
+            }
+        }
+        s = (word32)DIGIT_BIT - s;
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#else
+    int i;
+    int j = 0;
+    int s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i]) << s;
+        if (s + DIGIT_BIT >= 64) {
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            s = 64 - s;
+            if (s == DIGIT_BIT) {
+                r[++j] = 0;
+                s = 0;
+            }
+            else {
+                r[++j] = a->dp[i] >> s;
+                s = DIGIT_BIT - s;
+            }
+        }
+        else {
+            s += DIGIT_BIT;
+        }
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#endif
+}
+
+/* Convert an array of sp_digit to an mp_int.
+ *
+ * a  A single precision integer.
+ * r  A multi-precision integer.
+ */
+static int sp_384_to_mp(const sp_digit* a, mp_int* r)
+{
+    int err;
+
+    err = mp_grow(r, (384 + DIGIT_BIT - 1) / DIGIT_BIT);
+    if (err == MP_OKAY) { /*lint !e774 case where err is always MP_OKAY*/
+#if DIGIT_BIT == 64
+        XMEMCPY(r->dp, a, sizeof(sp_digit) * 6);
+        r->used = 6;
+        mp_clamp(r);
+#elif DIGIT_BIT < 64
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 6; i++) {
+            r->dp[j] |= (mp_digit)(a[i] << s);
+            r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+            s = DIGIT_BIT - s;
+            r->dp[++j] = (mp_digit)(a[i] >> s);
+            while (s + DIGIT_BIT <= 64) {
+                s += DIGIT_BIT;
+                r->dp[j++] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+                if (s == SP_WORD_SIZE) {
+                    r->dp[j] = 0;
+                }
+                else {
+                    r->dp[j] = (mp_digit)(a[i] >> s);
+                }
+            }
+            s = 64 - s;
+        }
+        r->used = (384 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#else
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 6; i++) {
+            r->dp[j] |= ((mp_digit)a[i]) << s;
+            if (s + 64 >= DIGIT_BIT) {
+    #if DIGIT_BIT != 32 && DIGIT_BIT != 64
+                r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+    #endif
+                s = DIGIT_BIT - s;
+                r->dp[++j] = a[i] >> s;
+                s = 64 - s;
+            }
+            else {
+                s += 64;
+            }
+        }
+        r->used = (384 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#endif
+    }
+
+    return err;
+}
+
+
+/* Convert a point of type ecc_point to type sp_point_384.
+ *
+ * p   Point of type sp_point_384 (result).
+ * pm  Point of type ecc_point.
+ */
+static void sp_384_point_from_ecc_point_6(sp_point_384* p,
+        const ecc_point* pm)
+{
+    XMEMSET(p->x, 0, sizeof(p->x));
+    XMEMSET(p->y, 0, sizeof(p->y));
+    XMEMSET(p->z, 0, sizeof(p->z));
+    sp_384_from_mp(p->x, 6, pm->x);
+    sp_384_from_mp(p->y, 6, pm->y);
+    sp_384_from_mp(p->z, 6, pm->z);
+    p->infinity = 0;
+}
+
+/* Convert a point of type sp_point_384 to type ecc_point.
+ *
+ * p   Point of type sp_point_384.
+ * pm  Point of type ecc_point (result).
+ * returns MEMORY_E when allocation of memory in ecc_point fails otherwise
+ * MP_OKAY.
+ */
+static int sp_384_point_to_ecc_point_6(const sp_point_384* p, ecc_point* pm)
+{
+    int err;
+
+    err = sp_384_to_mp(p->x, pm->x);
+    if (err == MP_OKAY) {
+        err = sp_384_to_mp(p->y, pm->y);
+    }
+    if (err == MP_OKAY) {
+        err = sp_384_to_mp(p->z, pm->z);
+    }
+
+    return err;
+}
+
+/* Copy the point p into r unless they are the same.
+ *
+ * r  Point to copy into.
+ * p  Point to copy.
+ */
+static void sp_384_point_copy_6(sp_point_384* r, const sp_point_384* p)
+{
+    if (r != p) {
+        XMEMCPY(r, p, sizeof(sp_point_384));
+    }
+}
+
+/* Set the point to infinity.
+ *
+ * r  Point to set.
+ */
+static void sp_384_point_set_inf_6(sp_point_384* r)
+{
+    XMEMSET(r, 0, sizeof(sp_point_384));
+    r->infinity = 1;
+}
+
+/* Check whether a is zero.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_384_iszero_6(const sp_digit* a)
+{
+    return (a[0] | a[1] | a[2] | a[3] | a[4] | a[5]) == 0;
+}
+
+/* Reduce a, which is less than 2^384, into the range 0..m-1 where m is
+ * greater than 2^383.
+ *
+ * a  A single precision integer to reduce in place.
+ * m  Modulus.
+ */
+static void sp_384_norm_mod_6(sp_digit* a, const sp_digit* m)
+{
+    (void)sp_384_cond_sub_6(a, a, m,
+                                  ~(sp_digit)(sp_384_cmp_6(a, m) >> 63));
+}
+
+/* Check whether a is zero modulo the prime. The Montgomery form operations
+ * return values less than 2^384, so zero may also be represented by p.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_384_iszero_mod_6(const sp_digit* a)
+{
+    sp_digit t[6];
+
+    XMEMCPY(t, a, sizeof(t));
+    sp_384_norm_mod_6(t, p384_mod);
+    return sp_384_iszero_6(t);
+}
+
+/* Negate the point's y ordinate when sign is 1.
+ * Constant time.
+ *
+ * p     Point to conditionally negate.
+ * sign  1 to negate and 0 to leave unchanged.
+ */
+static void sp_384_point_cond_neg_6(sp_point_384* p, sp_digit sign)
+{
+    sp_digit t[6];
+
+    sp_384_mont_sub_6(t, p384_mod, p->y, p384_mod);
+    sp_384_cond_copy_6(p->y, t, (sp_digit)0 - sign);
+}
+
+/* Convert the point's ordinates to Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_384_point_to_mont_6(sp_point_384* p)
+{
+    sp_384_mont_mul_6(p->x, p->x, p384_r2_mod, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(p->y, p->y, p384_r2_mod, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(p->z, p->z, p384_r2_mod, p384_mod, p384_mp_mod);
+}
+
+/* Convert the point's ordinates from Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_384_point_from_mont_6(sp_point_384* p)
+{
+    static const sp_digit one[6] = { 1, 0, 0, 0, 0, 0 };
+
+    sp_384_mont_mul_6(p->x, p->x, one, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(p->y, p->y, one, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(p->z, p->z, one, p384_mod, p384_mp_mod);
+    sp_384_norm_mod_6(p->x, p384_mod);
+    sp_384_norm_mod_6(p->y, p384_mod);
+    sp_384_norm_mod_6(p->z, p384_mod);
+}
+
+/* Make the scalar odd by replacing even k with order - k. The order is odd.
+ * Constant time.
+ *
+ * u  Odd scalar (result).
+ * k  Scalar less than the order.
+ * returns 1 when k was replaced and the result must be negated, 0 otherwise.
+ */
+static sp_digit sp_384_ecc_odd_6(sp_digit* u, const sp_digit* k)
+{
+    sp_digit t[6];
+    sp_digit neg = (k[0] & 1) ^ 1;
+
+    XMEMCPY(u, k, sizeof(t));
+    (void)sp_384_sub_6(t, p384_order, k);
+    sp_384_cond_copy_6(u, t, (sp_digit)0 - neg);
+    ForceZero(t, sizeof(t));
+
+    return neg;
+}
+
+/* Get the signed odd digit of window i of the odd scalar u as an index into
+ * the table of odd multiples.
+ * The digit is 2.b + 1 - 64 where b is bits 6i+1..6i+6 of u.
+ *
+ * u     Odd scalar.
+ * i     Window index.
+ * sign  1 when the digit is negative (result).
+ * returns the table index of the digit's magnitude.
+ */
+static int sp_384_ecc_window_6(const sp_digit* u, int i, sp_digit* sign)
+{
+    int pos = 6 * i + 1;
+    int o = pos & 63;
+    sp_digit b = u[pos >> 6] >> o;
+
+    if (o > 58) {
+        b |= u[(pos >> 6) + 1] << (64 - o);
+    }
+    b &= 0x3f;
+    *sign = ((b >> 5) & 1) ^ 1;
+
+    return (int)((b & 0x1f) ^ (((sp_digit)0 - *sign) & 0x1f)) + 1;
+}
+
+/* Get bit j of the recoded scalar s = (u >> 1) + 2^384 whose bits select
+ * +1 (set) or -1 (clear) for each bit position of the odd scalar u.
+ *
+ * u  Odd scalar.
+ * j  Bit index.
+ * returns the bit.
+ */
+static sp_digit sp_384_ecc_comb_bit_6(const sp_digit* u, int j)
+{
+    j++;
+    if (j == P384_COMB_TEETH * P384_COMB_SPACING) {
+        return 1;
+    }
+    if (j >= 384) {
+        return 0;
+    }
+    return (u[j >> 6] >> (j & 63)) & 1;
+}
+
+/* Get the index into the base point table for column c of the comb.
+ * Entries have the top tooth positive; when its bit is clear the column is
+ * the negation of the entry with all other teeth flipped.
+ *
+ * u     Odd scalar.
+ * c     Column.
+ * sign  1 when the entry is to be negated (result).
+ * returns the table index.
+ */
+static int sp_384_ecc_comb_6(const sp_digit* u, int c, sp_digit* sign)
+{
+    sp_digit idx = 0;
+    sp_digit top;
+    int i;
+
+    for (i = 0; i < P384_COMB_TEETH - 1; i++) {
+        idx |= sp_384_ecc_comb_bit_6(u, c + i * P384_COMB_SPACING) << i;
+    }
+    top = sp_384_ecc_comb_bit_6(u, c + i * P384_COMB_SPACING);
+    idx ^= (top - 1) & ((1 << (P384_COMB_TEETH - 1)) - 1);
+    *sign = top ^ 1;
+
+    return (int)idx + 1;
+}
+
+/* Add two numbers less than the order modulo the order. (r = a + b mod n)
+ * Constant time.
+ *
+ * r  Result of addition.
+ * a  First number to add.
+ * b  Second number to add.
+ */
+static void sp_384_add_mod_order_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit c;
+
+    c = sp_384_add_6(r, a, b);
+    (void)sp_384_cond_sub_6(r, r, p384_order, ((sp_digit)0 - c) |
+                            ~(sp_digit)(sp_384_cmp_6(r, p384_order) >> 63));
+}
+
+/* Multiply two numbers in Montgomery form modulo the order of the P384 curve.
+ * (r = a * b mod order)
+ *
+ * r  Result of the multiplication.
+ * a  First operand of the multiplication.
+ * b  Second operand of the multiplication.
+ */
+static void sp_384_mont_mul_order_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_mul_6(t, a, b);
+    sp_384_mont_reduce_order_6(t, p384_order, p384_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Square number in Montgomery form modulo the order of the P384 curve.
+ * (r = a * a mod order)
+ *
+ * r  Result of the squaring.
+ * a  Number to square.
+ */
+static void sp_384_mont_sqr_order_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_sqr_6(t, a);
+    sp_384_mont_reduce_order_6(t, p384_order, p384_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Generate a random number k in the range 1..order-1.
+ *
+ * rng  Random number generator.
+ * k    Scalar value (result).
+ * returns RNG failures and MP_OKAY on success.
+ */
+static int sp_384_ecc_gen_k_6(WC_RNG* rng, sp_digit* k)
+{
+    byte buf[48];
+    int err;
+
+    do {
+        err = wc_RNG_GenerateBlock(rng, buf, sizeof(buf));
+        if (err == 0) {
+            sp_384_from_bin(k, 6, buf, (int)sizeof(buf));
+            if (sp_384_cmp_6(k, p384_order2) <= 0) {
+                sp_384_add_one_6(k);
+                break;
+            }
+        }
+    }
+    while (err == 0);
+
+    ForceZero(buf, sizeof(buf));
+
+    return err;
+}
+
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_384_mont_sqr_n_6(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_384_mont_sqr_6(r, a, p384_mod, p384_mp_mod);
+    for (; n > 1; n--) {
+        sp_384_mont_sqr_6(r, r, p384_mod, p384_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P384 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_384_mont_inv_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[6];
+    sp_digit x3[6];
+    sp_digit x15[6];
+    sp_digit x30[6];
+    sp_digit x32[6];
+    sp_digit x60[6];
+    sp_digit x120[6];
+    sp_digit t[6];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_384_mont_sqr_6(t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(x2, t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_6(t, x2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(x3, t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x3, 3);
+    sp_384_mont_mul_6(t, t, x3, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(x15, t, 6);
+    sp_384_mont_mul_6(x15, x15, t, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(x15, x15, 3);
+    sp_384_mont_mul_6(x15, x15, x3, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x15, 15);
+    sp_384_mont_mul_6(x30, t, x15, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x30, 2);
+    sp_384_mont_mul_6(x32, t, x2, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x30, 30);
+    sp_384_mont_mul_6(x60, t, x30, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x60, 60);
+    sp_384_mont_mul_6(x120, t, x60, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, x120, 120);
+    sp_384_mont_mul_6(t, t, x120, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, t, 15);
+    sp_384_mont_mul_6(t, t, x15, p384_mod, p384_mp_mod);
+    /* p - 2 = [255 ones] 0 [32 ones] [64 zeros] fffffffd */
+    sp_384_mont_sqr_n_6(t, t, 33);
+    sp_384_mont_mul_6(t, t, x32, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, t, 94);
+    sp_384_mont_mul_6(t, t, x30, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_6(t, t, 2);
+    sp_384_mont_mul_6(r, t, a, p384_mod, p384_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_384_map_6(sp_point_384* r, const sp_point_384* p)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+
+    sp_384_mont_inv_6(t1, p->z);
+    sp_384_mont_sqr_6(t2, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t1, t2, t1, p384_mod, p384_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_384_mont_mul_6(r->x, p->x, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(r->y, p->y, t1, p384_mod, p384_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_384_mont_mul_6(r->x, r->x, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(r->y, r->y, t2, p384_mod, p384_mp_mod);
+    sp_384_norm_mod_6(r->x, p384_mod);
+    sp_384_norm_mod_6(r->y, p384_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_384_proj_point_dbl_6(sp_point_384* r, const sp_point_384* p)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+
+    if (p->infinity) {
+        sp_384_point_copy_6(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_384_mont_sqr_6(t1, p->z, p384_mod, p384_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_384_mont_mul_6(t4, p->y, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_dbl_6(r->z, t4, p384_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_384_mont_sub_6(t2, p->x, t1, p384_mod);
+    sp_384_mont_add_6(t1, p->x, t1, p384_mod);
+    sp_384_mont_mul_6(t2, t1, t2, p384_mod, p384_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_384_mont_tpl_6(t1, t2, p384_mod);
+    /* T3 = 4 * Y * Y */
+    sp_384_mont_dbl_6(t3, p->y, p384_mod);
+    sp_384_mont_sqr_6(t3, t3, p384_mod, p384_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_384_mont_mul_6(t4, t3, p->x, p384_mod, p384_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_384_mont_sqr_6(t3, t3, p384_mod, p384_mp_mod);
+    sp_384_div2_6(t3, t3, p384_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_384_mont_sqr_6(t2, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t2, t2, t4, p384_mod);
+    sp_384_mont_sub_6(r->x, t2, t4, p384_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_384_mont_sub_6(t4, t4, r->x, p384_mod);
+    sp_384_mont_mul_6(t4, t4, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t4, t3, p384_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_384_proj_point_dbl_n_6(sp_point_384* r, const sp_point_384* p,
+        int n)
+{
+    sp_384_proj_point_dbl_6(r, p);
+    for (; n > 1; n--) {
+        sp_384_proj_point_dbl_6(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_384_proj_point_add_6(sp_point_384* r, const sp_point_384* p,
+        const sp_point_384* q)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+    sp_digit t5[6];
+    sp_digit t6[6];
+
+    if (q->infinity) {
+        sp_384_point_copy_6(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_384_point_copy_6(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_384_mont_sqr_6(t1, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t3, t1, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t1, t1, p->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t3, t3, p->y, p384_mod, p384_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_384_mont_sqr_6(t2, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t4, t2, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t2, t2, q->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t4, t4, q->y, p384_mod, p384_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_384_mont_sub_6(t2, t2, t1, p384_mod);
+    sp_384_mont_sub_6(t4, t4, t3, p384_mod);
+    if (sp_384_iszero_mod_6(t2)) {
+        if (sp_384_iszero_mod_6(t4)) {
+            sp_384_proj_point_dbl_6(r, p);
+        }
+        else {
+            sp_384_point_set_inf_6(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_384_mont_mul_6(t5, p->z, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(r->z, t5, t2, p384_mod, p384_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_384_mont_sqr_6(t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t6, t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t1, t1, t5, p384_mod, p384_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_384_mont_sqr_6(t5, t4, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t5, t5, t6, p384_mod);
+    sp_384_mont_sub_6(t5, t5, t1, p384_mod);
+    sp_384_mont_sub_6(r->x, t5, t1, p384_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_384_mont_sub_6(t1, t1, r->x, p384_mod);
+    sp_384_mont_mul_6(t1, t1, t4, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t6, t6, t3, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t1, t6, p384_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_384_proj_point_add_qz1_6(sp_point_384* r,
+        const sp_point_384* p, const sp_point_384* q)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+    sp_digit t5[6];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p384_norm_mod, sizeof(p384_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_384_mont_sqr_6(t1, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t2, t1, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t1, t1, q->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t2, t2, q->y, p384_mod, p384_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_384_mont_sub_6(t1, t1, p->x, p384_mod);
+    sp_384_mont_sub_6(t2, t2, p->y, p384_mod);
+    if (sp_384_iszero_mod_6(t1)) {
+        if (sp_384_iszero_mod_6(t2)) {
+            sp_384_proj_point_dbl_6(r, p);
+        }
+        else {
+            sp_384_point_set_inf_6(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_384_mont_mul_6(r->z, p->z, t1, p384_mod, p384_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_384_mont_sqr_6(t3, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t4, t3, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t3, t3, p->x, p384_mod, p384_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_384_mont_sqr_6(t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t5, t5, t4, p384_mod);
+    sp_384_mont_sub_6(t5, t5, t3, p384_mod);
+    sp_384_mont_sub_6(r->x, t5, t3, p384_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_384_mont_sub_6(t3, t3, r->x, p384_mod);
+    sp_384_mont_mul_6(t3, t3, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_6(t4, t4, p->y, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t3, t4, p384_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_384_ecc_mulmod_6(sp_point_384* r, const sp_point_384* g,
+        const sp_digit* k, int map)
+{
+    sp_point_384 t[33];
+    sp_point_384 p;
+    sp_point_384 p2;
+    sp_digit u[6];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_384_point_copy_6(&t[1], g);
+    sp_384_proj_point_dbl_6(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_384_proj_point_add_6(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_384_ecc_odd_6(u, k);
+
+    /* Top window: digit 1 + 2 * u[383..379] */
+    sp_384_get_point_33_6(r, t, (int)(u[5] >> 59) + 1);
+    r->infinity = 0;
+    for (i = 62; i >= 0; i--) {
+        idx = sp_384_ecc_window_6(u, i, &sign);
+        sp_384_proj_point_dbl_n_6(r, r, 6);
+        sp_384_get_point_33_6(&p, t, idx);
+        p.infinity = 0;
+        sp_384_point_cond_neg_6(&p, sign);
+        sp_384_proj_point_add_6(r, r, &p);
+    }
+
+    if (map) {
+        sp_384_map_6(r, r);
+    }
+    sp_384_point_cond_neg_6(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P384 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_384_ecc_mulmod_base_6(sp_point_384* r, const sp_digit* k,
+        int map)
+{
+    sp_point_384 p;
+    sp_digit u[6];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_384_ecc_odd_6(u, k);
+
+    for (c = P384_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_384_ecc_comb_6(u, c, &sign);
+        sp_384_get_entry_65_6(&p, p384_table, idx);
+        sp_384_point_cond_neg_6(&p, sign ^ neg);
+        if (c == P384_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p384_norm_mod, sizeof(p384_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_384_proj_point_dbl_6(r, r);
+            sp_384_proj_point_add_qz1_6(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_384_map_6(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P384 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_384_mont_inv_order_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][6];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_384_mont_mul_order_6(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p384_order2[5] >> 60], sizeof(t[0]));
+    for (i = 5; i >= 0; i--) {
+        for (j = (i == 5) ? 56 : 60; j >= 0; j -= 4) {
+            sp_384_mont_sqr_order_6(r, r);
+            sp_384_mont_sqr_order_6(r, r);
+            sp_384_mont_sqr_order_6(r, r);
+            sp_384_mont_sqr_order_6(r, r);
+            y = (p384_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_384_mont_mul_order_6(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P384 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_384_ecc_sign_6(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_384 point;
+    sp_digit k[6];
+    sp_digit x[6];
+    sp_digit t[6];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_384_from_mp(k, 6, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_384_ecc_gen_k_6(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_384_ecc_mulmod_base_6(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 6);
+        sp_384_norm_mod_6(r, p384_order);
+        if (sp_384_iszero_6(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_384_mont_mul_order_6(x, d, p384_r2_order);
+        sp_384_mont_mul_order_6(x, x, r);
+        sp_384_norm_mod_6(x, p384_order);
+        sp_384_add_mod_order_6(x, x, e);
+        sp_384_mont_mul_order_6(k, k, p384_r2_order);
+        sp_384_mont_inv_order_6(t, k);
+        sp_384_mont_mul_order_6(s, t, x);
+        sp_384_norm_mod_6(s, p384_order);
+        if (!sp_384_iszero_6(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P384 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_384_ecc_verify_6(const sp_digit* e, const sp_point_384* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_384 p1;
+    sp_point_384 p2;
+    sp_digit w[6];
+    sp_digit u1[6];
+    sp_digit u2[6];
+
+    /* w = 1 / s in Montgomery form */
+    sp_384_mont_mul_order_6(w, s, p384_r2_order);
+    sp_384_mont_inv_order_6(w, w);
+    /* u1 = e.w, u2 = r.w */
+    sp_384_mont_mul_order_6(u1, e, w);
+    sp_384_norm_mod_6(u1, p384_order);
+    sp_384_mont_mul_order_6(u2, r, w);
+    sp_384_norm_mod_6(u2, p384_order);
+
+    /* u1.G + u2.Q */
+    if (sp_384_iszero_6(u1)) {
+        sp_384_point_set_inf_6(&p1);
+    }
+    else {
+        sp_384_ecc_mulmod_base_6(&p1, u1, 0);
+    }
+    sp_384_ecc_mulmod_6(&p2, q, u2, 0);
+    sp_384_proj_point_add_6(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_384_map_6(&p1, &p1);
+    sp_384_norm_mod_6(p1.x, p384_order);
+    return sp_384_cmp_6(p1.x, r) == 0;
+}
+
+#ifdef HAVE_INTEL_AVX2
+/* Multiply two Montgomery form numbers mod the modulus (prime).
+ * (r = a * b mod m)
+ *
+ * r   Result of multiplication.
+ * a   First number to multiply in Montgomery form.
+ * b   Second number to multiply in Montgomery form.
+ * m   Modulus (prime).
+ * mp  Montgomery multiplier.
+ */
+static void sp_384_mont_mul_avx2_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* b, const sp_digit* m, sp_digit mp)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_mul_avx2_6(t, a, b);
+    sp_384_mont_reduce_6(t, m, mp);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Square the Montgomery form number mod the modulus (prime).
+ * (r = a * a mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * m   Modulus (prime).
+ * mp  Montgomery multiplier.
+ */
+static void sp_384_mont_sqr_avx2_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* m, sp_digit mp)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_sqr_avx2_6(t, a);
+    sp_384_mont_reduce_6(t, m, mp);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Multiply two numbers in Montgomery form modulo the order of the P384 curve.
+ * (r = a * b mod order)
+ *
+ * r  Result of the multiplication.
+ * a  First operand of the multiplication.
+ * b  Second operand of the multiplication.
+ */
+static void sp_384_mont_mul_order_avx2_6(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_mul_avx2_6(t, a, b);
+    sp_384_mont_reduce_order_avx2_6(t, p384_order, p384_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Square number in Montgomery form modulo the order of the P384 curve.
+ * (r = a * a mod order)
+ *
+ * r  Result of the squaring.
+ * a  Number to square.
+ */
+static void sp_384_mont_sqr_order_avx2_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[2 * 6];
+
+    sp_384_sqr_avx2_6(t, a);
+    sp_384_mont_reduce_order_avx2_6(t, p384_order, p384_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 6);
+}
+
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_384_mont_sqr_n_avx2_6(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_384_mont_sqr_avx2_6(r, a, p384_mod, p384_mp_mod);
+    for (; n > 1; n--) {
+        sp_384_mont_sqr_avx2_6(r, r, p384_mod, p384_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P384 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_384_mont_inv_avx2_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[6];
+    sp_digit x3[6];
+    sp_digit x15[6];
+    sp_digit x30[6];
+    sp_digit x32[6];
+    sp_digit x60[6];
+    sp_digit x120[6];
+    sp_digit t[6];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_384_mont_sqr_avx2_6(t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(x2, t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_avx2_6(t, x2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(x3, t, a, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x3, 3);
+    sp_384_mont_mul_avx2_6(t, t, x3, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(x15, t, 6);
+    sp_384_mont_mul_avx2_6(x15, x15, t, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(x15, x15, 3);
+    sp_384_mont_mul_avx2_6(x15, x15, x3, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x15, 15);
+    sp_384_mont_mul_avx2_6(x30, t, x15, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x30, 2);
+    sp_384_mont_mul_avx2_6(x32, t, x2, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x30, 30);
+    sp_384_mont_mul_avx2_6(x60, t, x30, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x60, 60);
+    sp_384_mont_mul_avx2_6(x120, t, x60, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, x120, 120);
+    sp_384_mont_mul_avx2_6(t, t, x120, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, t, 15);
+    sp_384_mont_mul_avx2_6(t, t, x15, p384_mod, p384_mp_mod);
+    /* p - 2 = [255 ones] 0 [32 ones] [64 zeros] fffffffd */
+    sp_384_mont_sqr_n_avx2_6(t, t, 33);
+    sp_384_mont_mul_avx2_6(t, t, x32, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, t, 94);
+    sp_384_mont_mul_avx2_6(t, t, x30, p384_mod, p384_mp_mod);
+    sp_384_mont_sqr_n_avx2_6(t, t, 2);
+    sp_384_mont_mul_avx2_6(r, t, a, p384_mod, p384_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_384_map_avx2_6(sp_point_384* r, const sp_point_384* p)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+
+    sp_384_mont_inv_avx2_6(t1, p->z);
+    sp_384_mont_sqr_avx2_6(t2, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t1, t2, t1, p384_mod, p384_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_384_mont_mul_avx2_6(r->x, p->x, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(r->y, p->y, t1, p384_mod, p384_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_384_mont_mul_avx2_6(r->x, r->x, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(r->y, r->y, t2, p384_mod, p384_mp_mod);
+    sp_384_norm_mod_6(r->x, p384_mod);
+    sp_384_norm_mod_6(r->y, p384_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_384_proj_point_dbl_avx2_6(sp_point_384* r, const sp_point_384* p)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+
+    if (p->infinity) {
+        sp_384_point_copy_6(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_384_mont_sqr_avx2_6(t1, p->z, p384_mod, p384_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_384_mont_mul_avx2_6(t4, p->y, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_dbl_6(r->z, t4, p384_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_384_mont_sub_6(t2, p->x, t1, p384_mod);
+    sp_384_mont_add_6(t1, p->x, t1, p384_mod);
+    sp_384_mont_mul_avx2_6(t2, t1, t2, p384_mod, p384_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_384_mont_tpl_6(t1, t2, p384_mod);
+    /* T3 = 4 * Y * Y */
+    sp_384_mont_dbl_6(t3, p->y, p384_mod);
+    sp_384_mont_sqr_avx2_6(t3, t3, p384_mod, p384_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_384_mont_mul_avx2_6(t4, t3, p->x, p384_mod, p384_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_384_mont_sqr_avx2_6(t3, t3, p384_mod, p384_mp_mod);
+    sp_384_div2_6(t3, t3, p384_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_384_mont_sqr_avx2_6(t2, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t2, t2, t4, p384_mod);
+    sp_384_mont_sub_6(r->x, t2, t4, p384_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_384_mont_sub_6(t4, t4, r->x, p384_mod);
+    sp_384_mont_mul_avx2_6(t4, t4, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t4, t3, p384_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_384_proj_point_dbl_n_avx2_6(sp_point_384* r,
+        const sp_point_384* p, int n)
+{
+    sp_384_proj_point_dbl_avx2_6(r, p);
+    for (; n > 1; n--) {
+        sp_384_proj_point_dbl_avx2_6(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_384_proj_point_add_avx2_6(sp_point_384* r, const sp_point_384* p,
+        const sp_point_384* q)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+    sp_digit t5[6];
+    sp_digit t6[6];
+
+    if (q->infinity) {
+        sp_384_point_copy_6(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_384_point_copy_6(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_384_mont_sqr_avx2_6(t1, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t3, t1, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t1, t1, p->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t3, t3, p->y, p384_mod, p384_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_384_mont_sqr_avx2_6(t2, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t4, t2, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t2, t2, q->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t4, t4, q->y, p384_mod, p384_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_384_mont_sub_6(t2, t2, t1, p384_mod);
+    sp_384_mont_sub_6(t4, t4, t3, p384_mod);
+    if (sp_384_iszero_mod_6(t2)) {
+        if (sp_384_iszero_mod_6(t4)) {
+            sp_384_proj_point_dbl_avx2_6(r, p);
+        }
+        else {
+            sp_384_point_set_inf_6(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_384_mont_mul_avx2_6(t5, p->z, q->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(r->z, t5, t2, p384_mod, p384_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_384_mont_sqr_avx2_6(t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t6, t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t1, t1, t5, p384_mod, p384_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_384_mont_sqr_avx2_6(t5, t4, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t5, t5, t6, p384_mod);
+    sp_384_mont_sub_6(t5, t5, t1, p384_mod);
+    sp_384_mont_sub_6(r->x, t5, t1, p384_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_384_mont_sub_6(t1, t1, r->x, p384_mod);
+    sp_384_mont_mul_avx2_6(t1, t1, t4, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t6, t6, t3, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t1, t6, p384_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_384_proj_point_add_qz1_avx2_6(sp_point_384* r,
+        const sp_point_384* p, const sp_point_384* q)
+{
+    sp_digit t1[6];
+    sp_digit t2[6];
+    sp_digit t3[6];
+    sp_digit t4[6];
+    sp_digit t5[6];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p384_norm_mod, sizeof(p384_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_384_mont_sqr_avx2_6(t1, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t2, t1, p->z, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t1, t1, q->x, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t2, t2, q->y, p384_mod, p384_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_384_mont_sub_6(t1, t1, p->x, p384_mod);
+    sp_384_mont_sub_6(t2, t2, p->y, p384_mod);
+    if (sp_384_iszero_mod_6(t1)) {
+        if (sp_384_iszero_mod_6(t2)) {
+            sp_384_proj_point_dbl_avx2_6(r, p);
+        }
+        else {
+            sp_384_point_set_inf_6(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_384_mont_mul_avx2_6(r->z, p->z, t1, p384_mod, p384_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_384_mont_sqr_avx2_6(t3, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t4, t3, t1, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t3, t3, p->x, p384_mod, p384_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_384_mont_sqr_avx2_6(t5, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(t5, t5, t4, p384_mod);
+    sp_384_mont_sub_6(t5, t5, t3, p384_mod);
+    sp_384_mont_sub_6(r->x, t5, t3, p384_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_384_mont_sub_6(t3, t3, r->x, p384_mod);
+    sp_384_mont_mul_avx2_6(t3, t3, t2, p384_mod, p384_mp_mod);
+    sp_384_mont_mul_avx2_6(t4, t4, p->y, p384_mod, p384_mp_mod);
+    sp_384_mont_sub_6(r->y, t3, t4, p384_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_384_ecc_mulmod_avx2_6(sp_point_384* r, const sp_point_384* g,
+        const sp_digit* k, int map)
+{
+    sp_point_384 t[33];
+    sp_point_384 p;
+    sp_point_384 p2;
+    sp_digit u[6];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_384_point_copy_6(&t[1], g);
+    sp_384_proj_point_dbl_avx2_6(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_384_proj_point_add_avx2_6(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_384_ecc_odd_6(u, k);
+
+    /* Top window: digit 1 + 2 * u[383..379] */
+    sp_384_get_point_33_6(r, t, (int)(u[5] >> 59) + 1);
+    r->infinity = 0;
+    for (i = 62; i >= 0; i--) {
+        idx = sp_384_ecc_window_6(u, i, &sign);
+        sp_384_proj_point_dbl_n_avx2_6(r, r, 6);
+        sp_384_get_point_33_6(&p, t, idx);
+        p.infinity = 0;
+        sp_384_point_cond_neg_6(&p, sign);
+        sp_384_proj_point_add_avx2_6(r, r, &p);
+    }
+
+    if (map) {
+        sp_384_map_avx2_6(r, r);
+    }
+    sp_384_point_cond_neg_6(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P384 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_384_ecc_mulmod_base_avx2_6(sp_point_384* r, const sp_digit* k,
+        int map)
+{
+    sp_point_384 p;
+    sp_digit u[6];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_384_ecc_odd_6(u, k);
+
+    for (c = P384_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_384_ecc_comb_6(u, c, &sign);
+        sp_384_get_entry_65_6(&p, p384_table, idx);
+        sp_384_point_cond_neg_6(&p, sign ^ neg);
+        if (c == P384_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p384_norm_mod, sizeof(p384_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_384_proj_point_dbl_avx2_6(r, r);
+            sp_384_proj_point_add_qz1_avx2_6(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_384_map_avx2_6(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P384 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_384_mont_inv_order_avx2_6(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][6];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_384_mont_mul_order_avx2_6(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p384_order2[5] >> 60], sizeof(t[0]));
+    for (i = 5; i >= 0; i--) {
+        for (j = (i == 5) ? 56 : 60; j >= 0; j -= 4) {
+            sp_384_mont_sqr_order_avx2_6(r, r);
+            sp_384_mont_sqr_order_avx2_6(r, r);
+            sp_384_mont_sqr_order_avx2_6(r, r);
+            sp_384_mont_sqr_order_avx2_6(r, r);
+            y = (p384_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_384_mont_mul_order_avx2_6(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P384 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_384_ecc_sign_avx2_6(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_384 point;
+    sp_digit k[6];
+    sp_digit x[6];
+    sp_digit t[6];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_384_from_mp(k, 6, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_384_ecc_gen_k_6(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_384_ecc_mulmod_base_avx2_6(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 6);
+        sp_384_norm_mod_6(r, p384_order);
+        if (sp_384_iszero_6(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_384_mont_mul_order_avx2_6(x, d, p384_r2_order);
+        sp_384_mont_mul_order_avx2_6(x, x, r);
+        sp_384_norm_mod_6(x, p384_order);
+        sp_384_add_mod_order_6(x, x, e);
+        sp_384_mont_mul_order_avx2_6(k, k, p384_r2_order);
+        sp_384_mont_inv_order_avx2_6(t, k);
+        sp_384_mont_mul_order_avx2_6(s, t, x);
+        sp_384_norm_mod_6(s, p384_order);
+        if (!sp_384_iszero_6(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P384 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_384_ecc_verify_avx2_6(const sp_digit* e, const sp_point_384* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_384 p1;
+    sp_point_384 p2;
+    sp_digit w[6];
+    sp_digit u1[6];
+    sp_digit u2[6];
+
+    /* w = 1 / s in Montgomery form */
+    sp_384_mont_mul_order_avx2_6(w, s, p384_r2_order);
+    sp_384_mont_inv_order_avx2_6(w, w);
+    /* u1 = e.w, u2 = r.w */
+    sp_384_mont_mul_order_avx2_6(u1, e, w);
+    sp_384_norm_mod_6(u1, p384_order);
+    sp_384_mont_mul_order_avx2_6(u2, r, w);
+    sp_384_norm_mod_6(u2, p384_order);
+
+    /* u1.G + u2.Q */
+    if (sp_384_iszero_6(u1)) {
+        sp_384_point_set_inf_6(&p1);
+    }
+    else {
+        sp_384_ecc_mulmod_base_avx2_6(&p1, u1, 0);
+    }
+    sp_384_ecc_mulmod_avx2_6(&p2, q, u2, 0);
+    sp_384_proj_point_add_avx2_6(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_384_map_avx2_6(&p1, &p1);
+    sp_384_norm_mod_6(p1.x, p384_order);
+    return sp_384_cmp_6(p1.x, r) == 0;
+}
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Multiply the base point of P384 by the scalar and return the result.
+ * If map is true then convert result to affine coordinates.
+ *
+ * km    Scalar to multiply by.
+ * r     Resulting point.
+ * map   Indicates whether to convert result to affine.
+ * heap  Heap to use for allocation.
+ * returns ECC_OUT_OF_RANGE_E when the scalar is larger than 384 bits,
+ * ECC_INF_E when the scalar is a multiple of the order and MP_OKAY on
+ * success.
+ */
+int sp_ecc_mulmod_base_384(const mp_int* km, ecc_point* r, int map, void* heap)
+{
+    sp_point_384 point;
+    sp_digit k[6];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(km) > 384) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_384_from_mp(k, 6, km);
+        sp_384_norm_mod_6(k, p384_order);
+        if (sp_384_iszero_6(k)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_384_ecc_mulmod_base_avx2_6(&point, k, map);
+        else
+#endif
+            sp_384_ecc_mulmod_base_6(&point, k, map);
+        if (!map) {
+            sp_384_point_from_mont_6(&point);
+        }
+        err = sp_384_point_to_ecc_point_6(&point, r);
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Multiply the point by the scalar and serialize the X ordinate.
+ * The number is 0 padded to maximum size on output.
+ *
+ * priv    Scalar to multiply the point by.
+ * pub     Point to multiply.
+ * out     Buffer to hold X ordinate.
+ * outLen  On entry, size of the buffer in bytes.
+ *         On exit, length of data in buffer in bytes.
+ * heap    Heap to use for allocation.
+ * returns BUFFER_E if the buffer is to small for output size,
+ * ECC_OUT_OF_RANGE_E when the scalar is larger than 384 bits, ECC_INF_E when
+ * a point is at infinity and MP_OKAY on success.
+ */
+int sp_ecc_secret_gen_384(const mp_int* priv, const ecc_point* pub, byte* out,
+                          word32* outLen, void* heap)
+{
+    sp_point_384 point;
+    sp_digit k[6];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (*outLen < 48U) {
+        err = BUFFER_E;
+    }
+    else if (mp_count_bits(priv) > 384) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_384_from_mp(k, 6, priv);
+        sp_384_norm_mod_6(k, p384_order);
+        sp_384_point_from_ecc_point_6(&point, pub);
+        if (sp_384_iszero_6(k) || sp_384_iszero_6(point.z)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_384_point_to_mont_6(&point);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_384_ecc_mulmod_avx2_6(&point, &point, k, 1);
+        else
+#endif
+            sp_384_ecc_mulmod_6(&point, &point, k, 1);
+        if (point.infinity) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_384_to_bin_6(point.x, out);
+        *outLen = 48;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Sign the hash using the private key.
+ *   e = [hash, 384 bits] from binary
+ *   r = (k.G)->x mod order
+ *   s = (r * x + e) / k mod order
+ * The hash is truncated to the first 384 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * rng      Random number generator.
+ * priv     Private part of key - scalar.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * km       Optional fixed k, zeroized once used.
+ * heap     Heap to use for allocation.
+ * returns RNG failures, ECC_OUT_OF_RANGE_E when the private key is larger
+ * than 384 bits and MP_OKAY on success.
+ */
+int sp_ecc_sign_384(const byte* hash, word32 hashLen, WC_RNG* rng,
+                    const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+                    void* heap)
+{
+    sp_digit e[6];
+    sp_digit d[6];
+    sp_digit r[6];
+    sp_digit s[6];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(priv) > 384) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        if (hashLen > 48U) {
+            hashLen = 48U;
+        }
+        sp_384_from_bin(e, 6, hash, (int)hashLen);
+        sp_384_norm_mod_6(e, p384_order);
+        sp_384_from_mp(d, 6, priv);
+
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            err = sp_384_ecc_sign_avx2_6(e, d, rng, km, r, s);
+        else
+#endif
+            err = sp_384_ecc_sign_6(e, d, rng, km, r, s);
+    }
+    if (err == MP_OKAY) {
+        err = sp_384_to_mp(r, rm);
+    }
+    if (err == MP_OKAY) {
+        err = sp_384_to_mp(s, sm);
+    }
+
+    ForceZero(d, sizeof(d));
+    ForceZero(e, sizeof(e));
+
+    return err;
+}
+
+/* Verify the signature values with the hash and public key.
+ *   e = Truncate(hash, 384)
+ *   u1 = e/s mod order
+ *   u2 = r/s mod order
+ *   r == (u1.G + u2.Q)->x mod order
+ * The hash is truncated to the first 384 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * pX       X ordinate of the public key.
+ * pY       Y ordinate of the public key.
+ * pZ       Z ordinate of the public key.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * res      1 when the signature is valid and 0 otherwise.
+ * heap     Heap to use for allocation.
+ * returns ECC_INF_E when the public key is at infinity and MP_OKAY on
+ * success, including when the signature is not valid.
+ */
+int sp_ecc_verify_384(const byte* hash, word32 hashLen, const mp_int* pX,
+    const mp_int* pY, const mp_int* pZ, const mp_int* rm, const mp_int* sm,
+    int* res, void* heap)
+{
+    sp_point_384 q;
+    sp_digit e[6];
+    sp_digit r[6];
+    sp_digit s[6];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    *res = 0;
+
+    /* r and s must be between 1 and order - 1 */
+    if (mp_count_bits(rm) > 384 || mp_count_bits(sm) > 384) {
+        return MP_OKAY;
+    }
+    sp_384_from_mp(r, 6, rm);
+    sp_384_from_mp(s, 6, sm);
+    if (sp_384_iszero_6(r) || sp_384_iszero_6(s) ||
+            sp_384_cmp_6(r, p384_order) >= 0 ||
+            sp_384_cmp_6(s, p384_order) >= 0) {
+        return MP_OKAY;
+    }
+
+    if (hashLen > 48U) {
+        hashLen = 48U;
+    }
+    sp_384_from_bin(e, 6, hash, (int)hashLen);
+    sp_384_norm_mod_6(e, p384_order);
+
+    XMEMSET(q.x, 0, sizeof(q.x));
+    XMEMSET(q.y, 0, sizeof(q.y));
+    XMEMSET(q.z, 0, sizeof(q.z));
+    sp_384_from_mp(q.x, 6, pX);
+    sp_384_from_mp(q.y, 6, pY);
+    sp_384_from_mp(q.z, 6, pZ);
+    q.infinity = 0;
+    if (sp_384_iszero_6(q.z)) {
+        err = ECC_INF_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_384_point_to_mont_6(&q);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            *res = sp_384_ecc_verify_avx2_6(e, &q, r, s);
+        else
+#endif
+            *res = sp_384_ecc_verify_6(e, &q, r, s);
+    }
+
+    return err;
+}
+
+#endif /* WOLFSSL_SP_384 */
+
+#ifdef WOLFSSL_SP_521
+
+/* Point structure to use. */
+typedef struct sp_point_521 {
+    /* X ordinate of point. */
+    sp_digit x[2 * 9];
+    /* Y ordinate of point. */
+    sp_digit y[2 * 9];
+    /* Z ordinate of point. */
+    sp_digit z[2 * 9];
+    /* Indicates point is at infinity. */
+    int infinity;
+} sp_point_521;
+
+/* Affine point in Montgomery form. */
+typedef struct sp_table_entry_521 {
+    /* X ordinate of point. */
+    sp_digit x[9];
+    /* Y ordinate of point. */
+    sp_digit y[9];
+} sp_table_entry_521;
+
+/* Number of teeth in the comb used to multiply the base point. */
+#define P521_COMB_TEETH     7
+/* Distance in bits between teeth: ceil(521 / 7). */
+#define P521_COMB_SPACING   75
+
+/* The modulus (prime) of the curve P521. */
+static const sp_digit p521_mod[9] = {
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0xffffffffffffffffL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0xffffffffffffffffL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0x00000000000001ffL
+};
+
+/* The Montgomery normalizer for modulus of the curve P521. */
+static const sp_digit p521_norm_mod[9] = {
+    0x0000000000000001L, 0x0000000000000000L, 0x0000000000000000L,
+    0x0000000000000000L, 0x0000000000000000L, 0x0000000000000000L,
+    0x0000000000000000L, 0x0000000000000000L, 0x0000000000000000L
+};
+
+/* The Montgomery normalizer squared for modulus of the curve P521. */
+static const sp_digit p521_r2_mod[9] = {
+    0x0000000000000001L, 0x0000000000000000L, 0x0000000000000000L,
+    0x0000000000000000L, 0x0000000000000000L, 0x0000000000000000L,
+    0x0000000000000000L, 0x0000000000000000L, 0x0000000000000000L
+};
+
+/* The order of the curve P521. */
+static const sp_digit p521_order[9] = {
+    0xbb6fb71e91386409L, 0x3bb5c9b8899c47aeL, 0x7fcc0148f709a5d0L,
+    0x51868783bf2f966bL, 0xfffffffffffffffaL, 0xffffffffffffffffL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0x00000000000001ffL
+};
+
+/* The order of the curve P521 minus 2. */
+static const sp_digit p521_order2[9] = {
+    0xbb6fb71e91386407L, 0x3bb5c9b8899c47aeL, 0x7fcc0148f709a5d0L,
+    0x51868783bf2f966bL, 0xfffffffffffffffaL, 0xffffffffffffffffL,
+    0xffffffffffffffffL, 0xffffffffffffffffL, 0x00000000000001ffL
+};
+
+/* The Montgomery normalizer squared for order of the curve P521. */
+static const sp_digit p521_r2_order[9] = {
+    0xe06b3dda1d070851L, 0x1a3b8f1d34c4028cL, 0x5b7af2f36f2b21d6L,
+    0xe957b70d566936e6L, 0xb586a3959ef33fceL, 0x0f4524b435156f31L,
+    0xebfa3110e0f4b638L, 0x47a80e468e696d68L, 0x0000000000000020L
+};
+
+/* The Montgomery multiplier for order of the curve P521. */
+static const sp_digit p521_mp_order = 0x1d2f5ccd79a995c7L;
+
+/* The Montgomery multiplier for modulus of the curve P521. */
+static const sp_digit p521_mp_mod = 0x0000000000000001L;
+
+/* Base point table for the signed comb: entry i + 1 is the affine point in
+ * Montgomery form 2^450.G + sum over teeth j < 6 of +/-2^(75j).G with the sign
+ * of tooth j given by bit j of i. Entry 0 is not used.
+ */
+static const sp_table_entry_521 p521_table[65] = {
+    /* 0 - not used */
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    /* 1 */
+    { { 0x5f939b2dbb075096L, 0xb3fff80cd5a710d0L,
+        0xa00631efb045f27bL, 0x261f56680ef1da71L,
+        0xa5b38946ea31ae9bL, 0x505adec745ec4231L,
+        0xf585c7dad0b68c84L, 0xb05fe06d6334b005L,
+        0x0000000000000129L },
+      { 0x7df41fa0387b536aL, 0x95cb368eedff881eL,
+        0x0e9b6d971dabe80dL, 0xb4a8c4e2e63c4543L,
+        0xbcfdcda26ba7607eL, 0x134ed6702a80de5dL,
+        0xf13e0b9b7a676215L, 0xac6e353f30b7c928L,
+        0x0000000000000150L } },
+    /* 2 */
+    { { 0x7afecd062eea5bccL, 0xdb7525c0bfcba1ebL,
+        0xfc92d52601e558eaL, 0x4e7d47f41c63e10dL,
+        0x34e987620cfb8753L, 0xb80c75b0535ccfdaL,
+        0xffbf1a70c6ac53d0L, 0x20d6c85b1631f0c4L,
+        0x0000000000000065L },
+      { 0x6cc324705a507e1cL, 0xc8420cc98256362aL,
+        0xb0d0c8272c265ab6L, 0x6d5c8e2078e887c8L,
+        0x4d8b9549ceff569bL, 0xaa30beeb4a510a80L,
+        0x9fc7e9ff4b823c85L, 0x6bdbe7d057d7dc91L,
+        0x000000000000019eL } },
+    /* 3 */
+    { { 0x371a691f0f9d4b5fL, 0x8a6088507f042ecaL,
+        0xf3bc07eb7b2bcbe2L, 0xe582b119d7ece600L,
+        0x09b7de16dd3c0cb7L, 0xd1d32a424e724fb3L,
+        0x68a385337c45b74bL, 0x19d79bd5759149d5L,
+        0x000000000000016aL },
+      { 0xc9533ad079e9b224L, 0xcdcac49da1ecbcfcL,
+        0x245571d645b4974eL, 0x50c442ed146e9281L,
+        0xe3388a9072704cb2L, 0xb5cc6603dca87d67L,
+        0x20b834d1160f82f8L, 0xf9e9437d2794a37bL,
+        0x000000000000015cL } },
+    /* 4 */
+    { { 0x57189e3e66b310fdL, 0x31fe2feafd3ee937L,
+        0x0aad80a23b9440b2L, 0x27eb852c478dd468L,
+        0x969709cd5a7356a0L, 0x8cccafa0c4520062L,
+        0xf816e7826483ac4aL, 0xb98ba638ba26ce16L,
+        0x0000000000000186L },
+      { 0x16ffa89a29e8b2eaL, 0x0eaab394d305f3deL,
+        0xc883923859aa231eL, 0xb3c885eb30c1e546L,
+        0xf8f595b9d73ce229L, 0x3f951eb8e0b2e968L,
+        0x6689a32fe9cd7b17L, 0x00f97e1602b9edf7L,
+        0x0000000000000125L } },
+    /* 5 */
+    { { 0x4fa81a7919c0492cL, 0xe9413ac5cf64347fL,
+        0x1d49e394b1eb7918L, 0x7497b813c1f60532L,
+        0xc9fbef0d0c19e30aL, 0xcc987cacf3d7114bL,
+        0x3618bdb04d90c892L, 0x53f864ef217c98f4L,
+        0x0000000000000126L },
+      { 0x6980e45a900bce37L, 0x16afd97ee411d2c8L,
+        0xc072c2ed0198cae0L, 0x41f8286e8c8d8b8dL,
+        0x4a4b4fe30832501bL, 0x5872408ce60f9018L,
+        0xc06406de83dc8493L, 0x44f30e8655ae8750L,
+        0x0000000000000037L } },
+    /* 6 */
+    { { 0xe3a329e134493ee2L, 0x4046ae3b159c6abfL,
+        0xaa7c2994d113878cL, 0x521d84bff527d80aL,
+        0x7498884b47d69d04L, 0xbb420a580d63afe8L,
+        0xa80cfbcd876550daL, 0xf187dbef80367343L,
+        0x0000000000000127L },
+      { 0x786aa38d2b9dffe5L, 0xa5a5f9fdf700a1d9L,
+        0x92b05db50ef115fcL, 0xdffaf3d29baa653aL,
+        0x956737e3af73cd27L, 0x5a53caa03e7422acL,
+        0x5116c55550dfc04eL, 0xbf4909f731d7b851L,
+        0x00000000000001f8L } },
+    /* 7 */
+    { { 0x4b29544b4bb7c0ebL, 0xc0e9df1983dadaf1L,
+        0x14972678009583f2L, 0x1294bfd08306679cL,
+        0x5c2f2d114201ca9aL, 0x2113b70757e200b9L,
+        0xac22a52b959e29f3L, 0xfeb4eb9b6c73b20cL,
+        0x00000000000001afL },
+      { 0x4b287de8e0516693L, 0xf11a3dbd229fdb4eL,
+        0x1867a2cbdbd88a8eL, 0x25f6bf00167ede86L,
+        0x2ab1c414dce9fa5bL, 0x22671f14341ab129L,
+        0x23d5dbe6c8b6eca0L, 0x303c58eb8ea125a0L,
+        0x00000000000000e0L } },
+    /* 8 */
+    { { 0xb49ca1b838800188L, 0x8439c713c27bbc61L,
+        0xcabb9defddcb96d4L, 0x0a9e6fc6f6235f91L,
+        0x9c35a3d0cf20bc0fL, 0x1ac1c37d5de906a8L,
+        0x7397b32684388d68L, 0xf575e0947dfb3f3aL,
+        0x0000000000000192L },
+      { 0x86b4c84a43a8cc55L, 0xaf6f14573624d298L,
+        0x5501dc3f2d858353L, 0x0b92c2274be58d77L,
+        0x5ffae65e58f1cba4L, 0x0462c79825f44c57L,
+        0x00c7b26b782cb811L, 0xd8a6937c971c864cL,
+        0x000000000000012cL } },
+    /* 9 */
+    { { 0xcac9f9b8c835568fL, 0xd7da4331d755a76fL,
+        0x414e5b2109fd77a8L, 0x03726b2968c27fe1L,
+        0xd1744adc0032403dL, 0x0abb8aa0f68b3a14L,
+        0xca3054d15fedc185L, 0xcbd0f387ac02c8b0L,
+        0x000000000000003cL },
+      { 0xf0eccfb8cdfa5e88L, 0x01f2697d8f36d931L,
+        0x28883c18f81436e5L, 0x57ff90da143f6db5L,
+        0x59f119b9615123e3L, 0x90f08f7b72f87bc3L,
+        0x3c66f17139b5dee5L, 0xf3e64aed505fde78L,
+        0x0000000000000196L } },
+    /* 10 */
+    { { 0x9789765d96036d91L, 0xb1c40dd42cb159c4L,
+        0x698e2bb83c5872b5L, 0x5c3c2fe01474297bL,
+        0x8e071aed49e913b1L, 0xf67ad85c12beeb2cL,
+        0xa7a6031cc7375028L, 0x17d6f961bc4e936fL,
+        0x0000000000000003L },
+      { 0x7f09d4c19260e023L, 0x8c8229e2b82cd2b3L,
+        0x4f1adf481dda2b54L, 0x1068ae834ccac20fL,
+        0x632698929f8e79cdL, 0x7f30d44381abf0e0L,
+        0xeada6d80ede9237eL, 0xcc6fae762a6af2e5L,
+        0x00000000000001e0L } },
+    /* 11 */
+    { { 0x447c7fe06ff7580aL, 0x86507f7f51edc9d0L,
+        0x677fc5151ddef6e9L, 0x770e52e40085ccfaL,
+        0xa70550194bbdecc8L, 0x54f1f8fcab16809cL,
+        0xe8ba44018fd21a6fL, 0xf636d91b4054d486L,
+        0x000000000000008bL },
+      { 0x3aa0843866307312L, 0x2a073947875f4dcfL,
+        0xac49c804c16f2e99L, 0x1c08ef965374e983L,
+        0x267e4a01c50a9633L, 0x3238cf343aa23ca0L,
+        0x55bb70b293e62426L, 0xc5760c6beb0f204aL,
+        0x0000000000000035L } },
+    /* 12 */
+    { { 0x2c2817b1722c978eL, 0x01c2740d94a8f5faL,
+        0x6b9d1613ca950d93L, 0xdcbb496a7ec8f72cL,
+        0xeda524765559e21eL, 0x9b392f24a2d18b68L,
+        0x3674f7d4e6d59185L, 0x358e61126dca14f6L,
+        0x00000000000001baL },
+      { 0x833d4cb9489c84d8L, 0xecec238ae97ae695L,
+        0xffa51b1300f4c0b3L, 0xdb6810edc076fa5dL,
+        0x7c6b261c95b98f85L, 0x1215f20215ddcc58L,
+        0x729f9267da4f2d7eL, 0x5cab653240aec359L,
+        0x000000000000011dL } },
+    /* 13 */
+    { { 0x179403c1b8f8d1f9L, 0xe45eeeb5d750d988L,
+        0xe486e3fa1f13f03fL, 0xb73a5dba6f81f052L,
+        0xc8e3a53d93a25128L, 0xdb373dd488b54c98L,
+        0xb1324e6094787909L, 0xb5dda65d658c6b7aL,
+        0x00000000000001ebL },
+      { 0xcbfa5377fe8c6c35L, 0x6787d522f641d683L,
+        0xd2974dac0a6f00efL, 0xaeaf47ef3fb8d770L,
+        0xb6ede430611f3585L, 0x5317e2bb371d5bb1L,
+        0x50c95182ea620a60L, 0x6a23fc108ca82210L,
+        0x0000000000000173L } },
+    /* 14 */
+    { { 0x797a95cc0a410837L, 0x288b4704125057a8L,
+        0xd67044a953892075L, 0xf957018c110a8ebaL,
+        0xbf8978ec2d0fbb35L, 0x498c5d69a548bbe0L,
+        0x746fcf4233e370f9L, 0x0e3d55a240bf83deL,
+        0x000000000000019bL },
+      { 0xc3342678b06ef63cL, 0x31d86e1590baea2fL,
+        0x83a52da5db02be0aL, 0xd22c2943bf30b39bL,
+        0x5c87987b2466d669L, 0x29e969f74e7d4746L,
+        0xa7548152fbccc203L, 0x5296eb5eea91d7a5L,
+        0x0000000000000153L } },
+    /* 15 */
+    { { 0x653152dafff6fea6L, 0x6efa44f10f7f3af2L,
+        0x94aa5e75bcd3f9d6L, 0x0c7b3c9d89c0738aL,
+        0xdb782158b6b076e7L, 0xada5ad63ac434df7L,
+        0xc83c1c2c0b7362c2L, 0xded456f7792efa21L,
+        0x0000000000000028L },
+      { 0xfcc3bfa4e07b870dL, 0x9ad0a2dde08b2892L,
+        0x94f079a6ecd8fb46L, 0xe31f5b0b38c9964fL,
+        0xd93523f1e5455fadL, 0x42219d7644ca6770L,
+        0x5152001daec78711L, 0x3ad714a79479a987L,
+        0x00000000000001e1L } },
+    /* 16 */
+    { { 0x5a40141b21a2d253L, 0x76cdabc5fb36b875L,
+        0x259c38d5b119cb71L, 0x002ccb8fa753990dL,
+        0xd3e576b8e2d057d0L, 0xb5889622b747049fL,
+        0x2a3effced2c0cdc6L, 0x9cd94033c3884589L,
+        0x000000000000001bL },
+      { 0x4220b64e7c42ab32L, 0x41d1fec716406e6aL,
+        0x7ece93b0a1060d89L, 0x95f77c75642d2230L,
+        0x696fa43842a2cdb7L, 0x36066e85411b0b68L,
+        0x01e96b029f75464eL, 0xe1bcb78086939610L,
+        0x00000000000001c7L } },
+    /* 17 */
+    { { 0x20eaa584aa017e00L, 0x749df0ea4ac02d2eL,
+        0x6964cf9b82e2c461L, 0x3eda64c2be3471d1L,
+        0x920f22d45d4d6375L, 0xf10da7439a861c8cL,
+        0x4fcb042f121625deL, 0x0e8d9de0c88f5952L,
+        0x000000000000019fL },
+      { 0xbc5ff2ffe5ae728fL, 0x477f5cb2c2ed59daL,
+        0x84476818f3710f59L, 0x51a988ceffcabac8L,
+        0xba63f2efdcc92e2bL, 0x8a293e6768d46420L,
+        0x67aa750326a2832eL, 0xce84d1411b75af20L,
+        0x00000000000000f9L } },
+    /* 18 */
+    { { 0xc6e69adbc9d57504L, 0x35d194b0fd454f89L,
+        0x1fba9f9d8dd6c3f3L, 0xff7c002b6c177799L,
+        0x3ea73e237be1ccb6L, 0x4c8a051fdcd8e7b6L,
+        0x03c03e8efb4ca8f2L, 0x507dbf5af32f70c3L,
+        0x000000000000018fL },
+      { 0xbffcd1b4941efdeaL, 0xc0225b74b09c93a1L,
+        0xb3f1c98360496aefL, 0x1eb0f81d36b0693dL,
+        0xeb9a6f261f9faaf2L, 0x132f47aab990ac31L,
+        0xfd3d90234c49513dL, 0x47f9d59a42afd144L,
+        0x00000000000000d9L } },
+    /* 19 */
+    { { 0xf408fe200b76fc50L, 0x08c93375b2d4fb0aL,
+        0xcd608126a0b6cffcL, 0x79e8269a5167a9c2L,
+        0x55575a6e9a1a1106L, 0x2b7741839df09616L,
+        0x5293f7d65989b989L, 0x99f11a95ac4da40cL,
+        0x00000000000001bfL },
+      { 0x824d75ead652eca0L, 0x6bdeeaf7e8e4b287L,
+        0xc2882363ae0ce4c2L, 0x6a6958d4e0a40543L,
+        0x81bc805af0e45980L, 0xb554b02a8b6a1a3fL,
+        0xd658536dd592eccaL, 0x354680a42c309e9aL,
+        0x000000000000017aL } },
+    /* 20 */
+    { { 0xee80468946eb43d0L, 0x850588757afb8a19L,
+        0x90cb1da632744a9fL, 0xecf175692e41543cL,
+        0x758dd5fd3f7e89ebL, 0xf02dc56d71efb50eL,
+        0x3f72340ab48f276bL, 0x55160d2d7afa9b82L,
+        0x0000000000000171L },
+      { 0x9a89043d66685e2cL, 0xd55d97a09a984dc9L,
+        0x5307ec710781c08fL, 0x5341ea21dba52cacL,
+        0x28bdd25071d9d1d2L, 0x7472efeb4b11ef99L,
+        0xe464c609d03c7701L, 0x2728de1a88c17b46L,
+        0x000000000000013dL } },
+    /* 21 */
+    { { 0x44a7bf712f541ac4L, 0x198c944f7f8ed27eL,
+        0x7ee32b62c0de866aL, 0x541c13267a759312L,
+        0x733afd9efb9927fcL, 0xf116e871137f4a45L,
+        0xaefd7d23d840e762L, 0x0482a3583d8f5327L,
+        0x0000000000000163L },
+      { 0x16bbc29e85a78796L, 0x3909aa6ec4fa36a6L,
+        0x607fcb305433e51fL, 0x05afd292f3748b3aL,
+        0x29921087e2b2af49L, 0xed7d7c915348e684L,
+        0x720ba03fdbf29836L, 0x2348455c2f060ce8L,
+        0x00000000000000b4L } },
+    /* 22 */
+    { { 0x07c5d393904e2349L, 0x3c458149406ff59aL,
+        0x190170eec85fc3eeL, 0x8361b5d019d124f2L,
+        0x9ec9ffe3fbb4a349L, 0x062ffb87c9bdc4c6L,
+        0xaf45ef0e0728b196L, 0xc1f9576f87a2169eL,
+        0x000000000000007aL },
+      { 0x6c6623993b8fd642L, 0xfb8e79a26ae4797eL,
+        0x14a029e1925e11eeL, 0x8559a9e2cbd11810L,
+        0x49049cec08f0a58dL, 0x95c0298911148411L,
+        0x051fad9178dab356L, 0xf368991545392c54L,
+        0x000000000000008aL } },
+    /* 23 */
+    { { 0x60def6f6d34d9c1fL, 0x649f0d9d988dce7cL,
+        0xa57fee09fd098843L, 0xc9a6b272af9c52a0L,
+        0xda0127640f9ddee6L, 0x0ab01600f65a8f8dL,
+        0x5e83d9f7671cba92L, 0x24a22a51fbe5d385L,
+        0x0000000000000044L },
+      { 0x539caf75d6319d95L, 0x5afa7bbf7fdf3a9bL,
+        0x02bf33eb044de1e8L, 0x3caecfe1c1d87016L,
+        0x6d8672ac9f2682b8L, 0x11bc44b7776dec98L,
+        0x7ae2ce8f18e57436L, 0x50cfd62566a0d1adL,
+        0x000000000000017bL } },
+    /* 24 */
+    { { 0x8689e39a706a481eL, 0x97929697531860d2L,
+        0x77d5cd11ec50c039L, 0x7476271fd3d662afL,
+        0xf8c879d7ecffb1baL, 0xf59f8ad52cb8e657L,
+        0x3be5320677da5eadL, 0xf6ab7b6803ab003bL,
+        0x00000000000000e6L },
+      { 0x1311688393b3b2adL, 0x4cfa2c90656e74a8L,
+        0x58651f9c84841cf2L, 0x46fd5ee56db5f40aL,
+        0x7cf2e9afc9d576c2L, 0x2a8616dede1ad4beL,
+        0xe6cc2ec31053a055L, 0xf1194576ae284dceL,
+        0x00000000000001c0L } },
+    /* 25 */
+    { { 0x1191d5e22faf43b4L, 0x71d775c8b6b3a56dL,
+        0x7c9186f341399333L, 0x6f99952403fd8f61L,
+        0x293070241a5c4f6cL, 0xb7225c0eb9e580ddL,
+        0xa0f96ab17ebc4ddfL, 0xfab04b8943ab449fL,
+        0x0000000000000041L },
+      { 0x9ffbfb3a4d4e17f1L, 0xc772234df6d15404L,
+        0xf6d2b1d5386cb570L, 0xcae270593c344bd7L,
+        0xcc0018c110d6236bL, 0x7e16412ba7e48f24L,
+        0x9d86c0d7822b7e3aL, 0xd376268f990aba21L,
+        0x00000000000001d5L } },
+    /* 26 */
+    { { 0x51b5cb0870e02f77L, 0xa743cef91d7a4e7cL,
+        0x6f3b75252e9a03d5L, 0x9571298632c7bfa9L,
+        0x7093d40df6ae994bL, 0xf28932e56d07cef8L,
+        0x92ab4649d6dfae89L, 0xff23e9be70bd945fL,
+        0x000000000000017cL },
+      { 0xef27398abb098dd7L, 0x2fc7b3f61ffe745aL,
+        0x0f52ad51674cb767L, 0x58d89395833bc11fL,
+        0x1fba3390ad6cab57L, 0x7b858f74dce90bbcL,
+        0x464ce41425f8832aL, 0x453c8e802578f554L,
+        0x00000000000001dcL } },
+    /* 27 */
+    { { 0x31f8055965e059d0L, 0xd2a0035026cf6163L,
+        0x9fd2b05649b93b35L, 0xb568a265f03e7daaL,
+        0x26eebaf25235f236L, 0x6b5866de17a80e23L,
+        0x1f292e427404e541L, 0x7a0cec4644de7c58L,
+        0x000000000000007dL },
+      { 0xeee2f6e5548eaea2L, 0x7d7b096e0dadb319L,
+        0x54250c4bd2195d83L, 0x57004cd3c897f118L,
+        0xe33e7beb058b6fa8L, 0xda65f68431c2f07bL,
+        0x71cf883ade7509bdL, 0x8fe7b6e8f51d5fa2L,
+        0x0000000000000168L } },
+    /* 28 */
+    { { 0x54f3815bcb7d90b6L, 0x4d0b5d3665c6e674L,
+        0xe987b46a06e56940L, 0x046c1466240e414dL,
+        0x004735bb16ed9ab1L, 0x97e482e6f068f798L,
+        0xb33da6b177b7511cL, 0xf599d90faa7ee4e5L,
+        0x0000000000000159L },
+      { 0x5ad2886e5b39e166L, 0x455474a835e85c8fL,
+        0x421caed40d76d6c7L, 0xe9f98bbb162e2bdaL,
+        0x1910cc420049fb7fL, 0x49e4cc5840bff12cL,
+        0x0d2d5a3653f89630L, 0x91780b91082938cfL,
+        0x000000000000016eL } },
+    /* 29 */
+    { { 0x33861b5d35403b3bL, 0x2fe1185c4a4e4d2eL,
+        0x7405e32c0ac3c36dL, 0x98367c589dd207a4L,
+        0xdca9611e6b21d98dL, 0xdad207b6cd2b5ae4L,
+        0x68ee32e6e803ca7cL, 0xf5a27672668ab12aL,
+        0x0000000000000122L },
+      { 0xa4ad1c44dbd1ac4dL, 0x000e1421fe4c51e3L,
+        0x3735c5b028f5b333L, 0x44726f40cd6f27abL,
+        0x4e40c1b1c523e929L, 0x03b389f8dfb8092eL,
+        0x4ecee5f18ab06c96L, 0xaf1558a8ae0e7d1cL,
+        0x000000000000016aL } },
+    /* 30 */
+    { { 0xcfda2c34d5efa8e8L, 0x208a186f34af64f8L,
+        0x286ce650a1de53d0L, 0x98fb8c8024e2ae28L,
+        0x6db03a785ef2e393L, 0x96fa447846d48c96L,
+        0xe4a0c2899adb06f8L, 0x76479a85cd34cd34L,
+        0x000000000000005dL },
+      { 0xb2eabf58d3b44babL, 0x692c7821a2ccce0fL,
+        0x349d1d20e81fb239L, 0x024cf810e3d9b389L,
+        0x03b1537816f13657L, 0x58ddab9b99f8210dL,
+        0xd8022f34d255b7b9L, 0x660665d7a02d7ed4L,
+        0x000000000000002bL } },
+    /* 31 */
+    { { 0x0e6ed128ecf211b3L, 0x9a342bce7b62cf6fL,
+        0x8ec32e38077e9699L, 0xbd8260a947ccc07fL,
+        0x07207fc3b75827f0L, 0x58f132bc75e6dbc7L,
+        0xa9c5d101999ebcd9L, 0xc3d9ce62e34a7e9bL,
+        0x0000000000000171L },
+      { 0x3f779a2439f61e3fL, 0xe6504ae771722d72L,
+        0x42a61a2a554603d7L, 0x558ea94fdcabc438L,
+        0x57790b37416d0e10L, 0xd2d387abf8fa848eL,
+        0xc1314fd714833cedL, 0xdd1b6e3a9d0550a3L,
+        0x00000000000001c8L } },
+    /* 32 */
+    { { 0x3afa7c27390aa533L, 0x3f7a366cd4d77bc8L,
+        0xf6c48a789b4bc324L, 0x4d41c5cff929394dL,
+        0xa1131b3ff1dca288L, 0xe216fbb0e0b0986dL,
+        0xa4d8f291c22b13e1L, 0x9a2611878c3d0cbfL,
+        0x0000000000000180L },
+      { 0x01e51cea3913cbb0L, 0x68720c430238e795L,
+        0xba24676c89cedbb5L, 0x28904fcf2ce91789L,
+        0x7800f21b47ace81aL, 0x818d0bb61623c5f8L,
+        0x81dda38a799dfa60L, 0x52022d0ecf39c015L,
+        0x0000000000000059L } },
+    /* 33 */
+    { { 0x4454fe1a38eaa60dL, 0xe511f9c2f1db20a7L,
+        0x762e62a1787f2dd2L, 0x155ac6e8bd4a9fd9L,
+        0x045b06c3c28b7203L, 0x826d2478f2d548e9L,
+        0xd874f57efdeceab5L, 0x6645b8955bd55e50L,
+        0x00000000000000faL },
+      { 0x4c69aa2e4a5889dbL, 0xd6935d16f271b691L,
+        0xfb2414994e50f45fL, 0x533c2a36895d512fL,
+        0x719904dd8837a886L, 0x898d75848db6379cL,
+        0x07d8516be7d8de81L, 0xad87f06b43aa771fL,
+        0x00000000000001c8L } },
+    /* 34 */
+    { { 0x3e6c54f6e721f209L, 0x514dc0bacfeda8adL,
+        0xbfc573fd2c15fdc2L, 0x337f8fe2d5475790L,
+        0xd1b9017d34f96104L, 0x0509066070a280caL,
+        0x5b28394a6fbc6b52L, 0xdee4c01fae300ddfL,
+        0x000000000000015cL },
+      { 0x2b35e91191026172L, 0x515c59f38ec709feL,
+        0xb1052f6aad7764a5L, 0x5b09bc160409ac8eL,
+        0x8b19dc29850120dbL, 0x061b86da73545b7bL,
+        0xd6fc0a5189df9c36L, 0x82e3d87284f048edL,
+        0x00000000000000c8L } },
+    /* 35 */
+    { { 0x14d805c21045f52cL, 0xe5e08f8e40cd7928L,
+        0xc741705fdc794002L, 0xdc7d3fad369caed8L,
+        0xf1114c5e1f90275aL, 0x990896797fd16923L,
+        0xe899c0b9d85600d7L, 0x6d835b1fa7cedeadL,
+        0x00000000000000faL },
+      { 0x309abbcb564679edL, 0xf74f03563af5a93cL,
+        0x2eddcba611a811edL, 0x164471d6fa8f9ca4L,
+        0x44875c20567036f5L, 0x63720f68865f5882L,
+        0x3823b76c4038d84dL, 0x0ff413af8f1f8b75L,
+        0x000000000000008fL } },
+    /* 36 */
+    { { 0x54092d7d7af5629fL, 0x93c1dd935d908542L,
+        0xc4d8e9fc273d7f74L, 0xbc9acb41e442b402L,
+        0x43b2f7b7f329e20fL, 0x481d7a87a087a0adL,
+        0x10afcfef11fb3452L, 0xee4176c8c1d3d6f5L,
+        0x0000000000000017L },
+      { 0xa7cbccca52ded444L, 0xe296015039c67214L,
+        0x02f9ff943d2d991dL, 0xc6e6835aafb74e75L,
+        0xe83c00bed763f609L, 0x29fd18a97a61be01L,
+        0xebbdf82ec93a7f14L, 0xce2a48e0adc40afdL,
+        0x00000000000001ffL } },
+    /* 37 */
+    { { 0xdf678f236baddb65L, 0xed6f74636e6c1bd1L,
+        0xd8f18cad26259af3L, 0x944fd5a884a235fbL,
+        0x244e1df9d919cdd2L, 0x4e4df98303cd74f7L,
+        0x2f4475cd27735178L, 0xc19d79174e548604L,
+        0x000000000000006eL },
+      { 0xe6aebd57f39af930L, 0xd3a5d4e4674298adL,
+        0xf5b56cd4afb86bacL, 0x829e12634cf5efc3L,
+        0x83e643f9f48d805dL, 0x18a18fcd86abe920L,
+        0x6f52ccd4f460025fL, 0x57e2fbbb227e0458L,
+        0x0000000000000159L } },
+    /* 38 */
+    { { 0x7afcfc8c96bcdc93L, 0x0392a9c805e95cf1L,
+        0xfbcac2ea11a310dbL, 0xac20ff790a731bfbL,
+        0x6c9c6e48354bb5c5L, 0xab524798d4f0ec08L,
+        0x942354f2d375d7f6L, 0xb9f6a88b4c762bb9L,
+        0x00000000000000c1L },
+      { 0x8c7b3ecfc6d48d93L, 0x147ae1573132cc7fL,
+        0xa99d50cb01b61eb8L, 0x41ea1b4dde39cac5L,
+        0xcafee52449d9412fL, 0xca82405173e2ae19L,
+        0x75f4550682669ecbL, 0x607d539ce4de9281L,
+        0x0000000000000076L } },
+    /* 39 */
+    { { 0x85582e5e834d2963L, 0xa583158cb7ccb91cL,
+        0x39dbc4f3017cc238L, 0xad9a51c284dfaf69L,
+        0x3de12a521831653dL, 0xaf4dcae6819f5513L,
+        0x831f376028a97afeL, 0x7dff6fdff3753f22L,
+        0x000000000000009fL },
+      { 0x33b27469ef0bffd5L, 0xb916037e513fcebcL,
+        0xe404c0452b45df9eL, 0x55da3f00be69109eL,
+        0x61752e4227b610fbL, 0x8856c955e27309adL,
+        0xa31e01c6da50e22aL, 0xb80f5555ab8e52e1L,
+        0x00000000000000acL } },
+    /* 40 */
+    { { 0x53fca5854363898aL, 0x62faf173e7bd4f21L,
+        0xda73d5d254baa68aL, 0xa0a24229aad14715L,
+        0x3dab76347188e8b9L, 0x0ea7c8118d471dbeL,
+        0x43413478802a8d55L, 0x7f62d52ba124039cL,
+        0x00000000000001c9L },
+      { 0x7495f1993e59ed46L, 0xdda45e04c16dc4f3L,
+        0xe53b8380e10efb4fL, 0x4cfc3086d27405f6L,
+        0xb8b1606bf0b3d2b9L, 0xaaed67b200b35121L,
+        0x0b6244c1da4833b8L, 0x9ab9cdec8dc66fcbL,
+        0x00000000000000d6L } },
+    /* 41 */
+    { { 0x4b035db407709c98L, 0xfa3ca1852ad5454bL,
+        0x740c4300aacb5c53L, 0x784e2c938c415c39L,
+        0x71da412340fb5f80L, 0xe4be58e7b0b70861L,
+        0x60c022a05c67bf9aL, 0x46b5da548b8b07f6L,
+        0x0000000000000016L },
+      { 0xfc85a6a5459734b8L, 0x4cb7741a29c2dfe4L,
+        0xf4f744abbd1d3bf5L, 0xce0f5ac55385b6e5L,
+        0x8139148d293bdee3L, 0x330f0b9c677b4a9eL,
+        0x8cab4788baf3c18cL, 0x3b14718a28cac49fL,
+        0x00000000000000deL } },
+    /* 42 */
+    { { 0xf0b26e284c87a066L, 0x0c98625232c6130eL,
+        0xe7f16af5410e9105L, 0xd869fbc08abcfc4aL,
+        0x2e04e89d5002600dL, 0xedc8da7d32e45f10L,
+        0x3a236efa03405968L, 0x4408daf2d5aff27aL,
+        0x00000000000001ceL },
+      { 0xad1a5ef96ac4f3c9L, 0x59e93c50b2a80904L,
+        0x43606864470358b8L, 0xcc4a714c5a4ea3feL,
+        0xa1a335cbf7f0d5a9L, 0x5e41b2e37d28fe24L,
+        0x3436ec275373a8b3L, 0xae44954fda0ec954L,
+        0x00000000000001f2L } },
+    /* 43 */
+    { { 0x0d05e40164c6ae72L, 0x0ed9ca5f0df3a8aeL,
+        0x40e4683ff611e120L, 0xc61c3e145ba7fcd5L,
+        0x1c53fec4963bb390L, 0x61e8172d0681d102L,
+        0xffcf1bab05c6a36dL, 0x8e9c0832969abf73L,
+        0x00000000000000bcL },
+      { 0x3811e32c74a71f22L, 0x976fae5e02b96bbeL,
+        0x854cafcbce8f2476L, 0x6052c293e6e4166aL,
+        0x0533392fef19178cL, 0xd98eea9dfe75d6fbL,
+        0xa5497bab8e5bd380L, 0x1d6c32740b7ead95L,
+        0x000000000000000bL } },
+    /* 44 */
+    { { 0xf2d2ba4ce46cc66dL, 0x70c90273472324c6L,
+        0xa5b9f61253ce66eeL, 0x82db90572ee9ef20L,
+        0x8dc6831a63f7049bL, 0x67f55bc7ba4acb31L,
+        0xe4aa261035bd0231L, 0xe37b727dca578f84L,
+        0x00000000000000e0L },
+      { 0x59ef435f3614b768L, 0xeb6c6e8a82dd3d64L,
+        0xafc7729a237ced62L, 0xb19c513b1bd54bd9L,
+        0xc443013353371798L, 0xe0fea1406429008dL,
+        0xca922e9ce79215adL, 0x77eed896c7f57a31L,
+        0x000000000000003dL } },
+    /* 45 */
+    { { 0x81b94dd9db3ceb0bL, 0x4bd9d0adb4ad7e05L,
+        0xa033e8c8c6740652L, 0x537937b50f6f1348L,
+        0x16d31238df74487dL, 0xbbc2e3c6fd7327f7L,
+        0xbf51abdff4ad29ceL, 0x4cbcb683e7724b8dL,
+        0x000000000000007cL },
+      { 0x589c4b70d68e34b0L, 0x21f269bdbe1b928dL,
+        0x04dcd90dc02322a7L, 0x47a19f8d89c4dddeL,
+        0xd0e19677ebe04b28L, 0xdae511ea009293c6L,
+        0x8d32b6358b25bad2L, 0xaa7a012d8c68c27bL,
+        0x0000000000000143L } },
+    /* 46 */
+    { { 0x0469ebfd1319a4e2L, 0x8698037cf7d2e157L,
+        0x2b6a3898ce06550fL, 0x4789a88bc0865881L,
+        0xc802e7b6aba22b0cL, 0x63067694821841dcL,
+        0x40d63fd69f34c194L, 0x93505c95eda04c6eL,
+        0x0000000000000185L },
+      { 0xaaf6df46381d00c8L, 0x1b590efd91f76bc4L,
+        0x566e3b6292fdabacL, 0x9b3afc7f106a7953L,
+        0x939fc4214da52a2eL, 0x60f8b96df22f21b8L,
+        0x0b0280b4843b78d9L, 0xd7350e36e2e52a79L,
+        0x00000000000001f5L } },
+    /* 47 */
+    { { 0xf21620508442bc7eL, 0xb7c24047012eb56fL,
+        0xa8c742e3a640e99dL, 0x95ecd6fc8b4de7d9L,
+        0x38c1ace06d5b0ca7L, 0x603aef4e785fdcd8L,
+        0x93468c76f9343edeL, 0x5d6e85e346fa3a63L,
+        0x0000000000000011L },
+      { 0x525396e5ffca1df3L, 0xd939d25d55bd89cbL,
+        0xf115dfb7499ef237L, 0x06a89595f326bae0L,
+        0x3518fb3d3fc73db8L, 0x0c2489806b34e676L,
+        0x4d08c34b8b9642efL, 0x9b9e67af4d3f07e5L,
+        0x0000000000000046L } },
+    /* 48 */
+    { { 0x50aa208cb4f89a90L, 0x92922df19ad01689L,
+        0x3e1cf84d83d2855bL, 0x0d781c3f57723dd9L,
+        0xb8abdf72eeb7101bL, 0xe3b1effa48b48458L,
+        0xc4b3aebb6b2c2ce3L, 0x86ece92be7a3036fL,
+        0x000000000000010eL },
+      { 0x3432c6976a4acbf0L, 0xe626677b8acf7116L,
+        0x5faeab7f32340361L, 0x2c74446b5a62f6bdL,
+        0xe5e19ded85977280L, 0x88c23a809f27cc20L,
+        0x62f8ce9aac1f17a0L, 0xbbd7836f8787f13fL,
+        0x00000000000001aeL } },
+    /* 49 */
+    { { 0x170338f3cc34b49cL, 0xe7d130c336f73838L,
+        0xa2dcfc5ebd591443L, 0xcac6169773a47ab6L,
+        0x34243d6391acef03L, 0x7365eb86c04b3007L,
+        0xbc54cae42c6823d5L, 0xc9bcf706c5f3e9faL,
+        0x000000000000016dL },
+      { 0x125321b90902bd6fL, 0x8610c6a74f42af48L,
+        0x92a219c6d9405464L, 0x7cbbd5399b0d2ca9L,
+        0x2e7ecbde7aea9768L, 0xc63b96236d27b944L,
+        0x83989ca4d5bfa14cL, 0x4f42455bbaa0c33eL,
+        0x00000000000000f2L } },
+    /* 50 */
+    { { 0xff482b1553403b5bL, 0xdbd3be992072a220L,
+        0xfbe4db435d647185L, 0x42d4ffa7bbb2f893L,
+        0xe48942d1e20eeb3bL, 0x226fd9c4ea876aa9L,
+        0xf10fd1af4ed33789L, 0xf889b9be8e7acbd2L,
+        0x000000000000000cL },
+      { 0x383b1ba68c5ba2faL, 0x9112c9e83648c57bL,
+        0xeffbbc9f7178de64L, 0x158e1b6892d92a20L,
+        0x9b8cf5ce8ec06502L, 0xb7ec949724cc85e6L,
+        0x3588f2872a987b6fL, 0x614c1ae5a9ac4b94L,
+        0x00000000000000baL } },
+    /* 51 */
+    { { 0x2352a274f55f4d2bL, 0x9d8b5416fac3efe9L,
+        0x3f7f5c3965d31962L, 0xf1c7a15050c9ac54L,
+        0x97878d34e318a13bL, 0xe965f1959ab0afbeL,
+        0x199045307a86e6fcL, 0xf4736c5263c48814L,
+        0x00000000000001dbL },
+      { 0x79120f4415cd2e95L, 0x3a304e94194abc0aL,
+        0x31f236a186e0670bL, 0x2ae8d65261d360b3L,
+        0x940b837c372713d5L, 0x84b17a764d2af4adL,
+        0x978e311bd3d0b527L, 0xb8ac602c0ac18c7fL,
+        0x00000000000000f4L } },
+    /* 52 */
+    { { 0x2763e84240449cd7L, 0x15eeb7d7f6e28cceL,
+        0x6b5869ce31e50d23L, 0xdbd35e5866f7bcbfL,
+        0x7477f489d8aa8500L, 0x23d950a20d3864e4L,
+        0x56fa81145d0881b5L, 0x83730801f70073e9L,
+        0x00000000000001feL },
+      { 0xe7119b8fe4f491e7L, 0x69f5af0da83b15e2L,
+        0x62a9e0a13bc05844L, 0x8112a1f10510d0adL,
+        0xcf2b021ca33504e4L, 0xc94e0a24e3eb5a5eL,
+        0xb1eb5d56d24de6a9L, 0xd194dc994f47bc2eL,
+        0x00000000000000caL } },
+    /* 53 */
+    { { 0x3d79b34a0bbba4acL, 0x3ff668ade3bf74fbL,
+        0x296db55996175f86L, 0xb566beca65947e8dL,
+        0x7fe870278b02cb68L, 0x322f70044e389bb6L,
+        0x27c3f09dd91f5652L, 0x650dcbb7c740e994L,
+        0x0000000000000196L },
+      { 0x93e75f658e5ecfb8L, 0x2656af697f9bd78dL,
+        0x924c452d4cec5118L, 0xcda334b49bc0e5a4L,
+        0xf1741428e5c187d6L, 0x64bfad6bb130e9a4L,
+        0x16c1f033fa9410ffL, 0x384cea3f5ee959a3L,
+        0x000000000000000eL } },
+    /* 54 */
+    { { 0x63f01b8a072bbda8L, 0x6a017dc238e03473L,
+        0xfb103e4158a5d181L, 0x18bbeb66849f796aL,
+        0xbce3974a40cd4ee4L, 0x954b35aa6e05cb29L,
+        0xad8cfe6ac5043079L, 0xdadadf7a089cf88bL,
+        0x0000000000000082L },
+      { 0x6b9e5dd05774851dL, 0xe0c2fedd33cea3f0L,
+        0x9b7ba7db44e80624L, 0xd8ee97acf1b23247L,
+        0xca15807203b1fd6fL, 0x20e1e88fb051492bL,
+        0x39193e37244e5833L, 0x607ab1e0c3091423L,
+        0x0000000000000142L } },
+    /* 55 */
+    { { 0xc362b028794e8872L, 0x44fde0489c846d21L,
+        0xaf45a8f52e06abfeL, 0xb99f8a7574439387L,
+        0x17ba51c7e20d2ea7L, 0xc102db7da929ec1dL,
+        0x0ffcfdf7f3cc8279L, 0x426e0abb4a932e41L,
+        0x000000000000014dL },
+      { 0xee25c6862ab53ba3L, 0xc420fb12db720ed6L,
+        0x9df6765f895ac98eL, 0xc59464a6ee56c846L,
+        0xf85855ad9e387339L, 0x34c78c9f6f04a62cL,
+        0xe4b0258d3ef8e9c3L, 0x1ed6009a4ec6485dL,
+        0x0000000000000180L } },
+    /* 56 */
+    { { 0x9599d56777b97c27L, 0x81a87b08f0eb28d5L,
+        0xbfcfceb28986ddfeL, 0xf47d04e69dced4b0L,
+        0x653d438e840d9551L, 0xef87cb7c9114128cL,
+        0x35f7ab4eee5518ceL, 0x4c174cc088d04017L,
+        0x000000000000019cL },
+      { 0xc3a9823b09366b07L, 0xa1063268830720deL,
+        0xfe1ab63347c323f2L, 0xe2623273f79273c6L,
+        0x47e8bf77b89f551eL, 0xdc863471242baef2L,
+        0xa91889726554a124L, 0x66c89efe1c79ada6L,
+        0x000000000000015aL } },
+    /* 57 */
+    { { 0x8187e396eb7558edL, 0xc5a9d7d9d8326a5bL,
+        0xc546fd50e8499890L, 0xfd1090ce0304dd53L,
+        0xf3d51be273607ad6L, 0xd1b3c84f2b597d03L,
+        0x6eb56e7be10a9be1L, 0x60d21cc5ad8cd50dL,
+        0x0000000000000131L },
+      { 0x99531b254ac19552L, 0x6ace0878357c5498L,
+        0xc0ce77b27185eba9L, 0xb7546a093f45c208L,
+        0xb81a55d885946de0L, 0x5b3a66ccacad87c5L,
+        0x15baef02c64485d5L, 0xcbf27d8825045b58L,
+        0x000000000000005aL } },
+    /* 58 */
+    { { 0xa3e6806291a63b7bL, 0x8db05eefa94ca4bcL,
+        0x7e66d78a8aa2713cL, 0x24daea3025d3d307L,
+        0x71a6721ae23b2f2eL, 0xa6faeecf5c1983bfL,
+        0xb4bc595bfe454e98L, 0x3494e207b0057c28L,
+        0x000000000000017dL },
+      { 0xdba3967c8e10f91dL, 0x301f73af67536b32L,
+        0x1191261a426604abL, 0xb947da2cabf5b466L,
+        0x9287bbcd3e41bf53L, 0x5b97153787b1a79eL,
+        0xe0ebac148ff6fc9eL, 0xf214b82112fb5781L,
+        0x00000000000000f0L } },
+    /* 59 */
+    { { 0x7d85d5039982e19aL, 0xb68493a2f8284decL,
+        0xa83e9a3df0745da1L, 0x58b14ae7bea903e4L,
+        0x0de16f49c60da928L, 0x50f20d6a978ce3f6L,
+        0xbcb3a6899de5f68eL, 0x2389cebeb8851551L,
+        0x0000000000000037L },
+      { 0xecefdac78c1fb78cL, 0xb8b31f708e8237edL,
+        0x809cedb96b22288dL, 0x09d12a2c75af3aa4L,
+        0xa0427b160dc5d93dL, 0xb2d126f27eebd007L,
+        0x39897e570070bf8cL, 0x3cd94992f69de319L,
+        0x00000000000001adL } },
+    /* 60 */
+    { { 0xac9272a178a6763bL, 0x40461d9dc19f36afL,
+        0xfb3490f7525643e1L, 0x20154078b51f4020L,
+        0x8ac8f2f29ff21762L, 0xda54f57c650147b1L,
+        0x7bfbd1b562501eadL, 0x3d210d826629e8e8L,
+        0x0000000000000096L },
+      { 0xade4bc68123e8f60L, 0xea6c7909b051ea16L,
+        0x54fcd8bf287d9338L, 0x2bf5c22e0f2c982dL,
+        0xe92e053b477ae5b7L, 0x50647a1ff54699abL,
+        0x7c05ceb455dbe7aaL, 0x072fed7934848c8fL,
+        0x00000000000001adL } },
+    /* 61 */
+    { { 0x280893d551e090d8L, 0x7f9f4c7c5839f6d8L,
+        0x9b37d8c8ceeff244L, 0x01cb0a376e1adc5cL,
+        0x15fad8d9bf260c0eL, 0x7ece0d304c5b1169L,
+        0xca7c37f2afc3d449L, 0x18e7e77b085a8dc9L,
+        0x00000000000001e0L },
+      { 0xa7d22e2498f55a07L, 0x5491096d3ab02b07L,
+        0x8103c1ea3fd8538dL, 0xbfd3cb1d5b768bf6L,
+        0x7374669e7db98b05L, 0x2fe2a52b05f03105L,
+        0x5990b2c701b05e41L, 0xfcf87cbdad756fd5L,
+        0x0000000000000020L } },
+    /* 62 */
+    { { 0x499fb7ea3e8d07b7L, 0x86f0d36ea21d2ebdL,
+        0x943c22dd5dcb381dL, 0x67aadc9bedc8cfd8L,
+        0x53c82d905941790fL, 0xa0c072e45fe6825fL,
+        0x4a2455fa7b3a454dL, 0x6e57d0b2b63a8c46L,
+        0x0000000000000078L },
+      { 0x882109edca618048L, 0x00736e72a71ef827L,
+        0x267e314eefd25eceL, 0x6334747f9eac7e13L,
+        0x34b1e2fe0d0481eaL, 0xd22092dac3bb94cfL,
+        0xfe0f016232b91f2dL, 0x547ce3287f8cc764L,
+        0x0000000000000124L } },
+    /* 63 */
+    { { 0x50c698fab9f48c55L, 0xe0ba2f7a26a584b1L,
+        0x7c6e93470d63da1dL, 0xa202fd8515adaa1fL,
+        0xf96404a35d9feb3fL, 0x6a364df72dc4cce2L,
+        0xf66f8c2e1fa0fa39L, 0x6f8f2d98b709433fL,
+        0x00000000000000f3L },
+      { 0x76e095490cff711aL, 0x27393d265ed4634dL,
+        0x9c6168e341112ec4L, 0x89fcb1af2c0264b0L,
+        0xaadb4ad8807c7a1aL, 0x67965bb703e95e89L,
+        0x3e207cd11a9a34deL, 0x8dd82f8d49e64dcaL,
+        0x000000000000009aL } },
+    /* 64 */
+    { { 0xa13610ef269a23acL, 0x04ee8a4f91e97777L,
+        0x86a6fd60d1c61412L, 0xb6ae1e2d125070feL,
+        0xa588dd557fd25e59L, 0x7141fdefb1ee5586L,
+        0x97117854da0ce1f7L, 0xac7bd00f6a54acf7L,
+        0x000000000000013aL },
+      { 0x246d1c9f7ef6a94fL, 0x37fc15b61823bde0L,
+        0x50155a7cb7eaee3aL, 0x0213e47884569edcL,
+        0x9f0ece8288c7fa7fL, 0xaaaa777a81761551L,
+        0xe1154f8ab9422206L, 0xd6c5b7b79a8bb368L,
+        0x0000000000000063L } }
+};
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mul_9(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_sqr_9(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_521_add_9(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_521_sub_9(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_cond_copy_9(sp_digit* r, const sp_digit* a, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_mul_9(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_sqr_9(sp_digit* r, const sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_int64 sp_521_cmp_9(const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern sp_digit sp_521_cond_sub_9(sp_digit* r, const sp_digit* a, const sp_digit* b, sp_digit m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_reduce_order_9(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_add_9(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_dbl_9(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_tpl_9(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_sub_9(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_div2_9(sp_digit* r, const sp_digit* a, const sp_digit* m);
+#ifdef __cplusplus
+}
+#endif
+#ifndef WC_NO_CACHE_RESISTANT
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_get_point_33_9(sp_point_521* r, const sp_point_521* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_get_entry_65_9(sp_point_521* r, const sp_table_entry_521* table, int idx);
+#ifdef __cplusplus
+}
+#endif
+#else
+/* Copy the point at index idx of the table into r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of points.
+ * idx    Index of point to copy.
+ */
+static void sp_521_get_point_33_9(sp_point_521* r, const sp_point_521* table,
+        int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(r->x));
+    XMEMCPY(r->y, table[idx].y, sizeof(r->y));
+    XMEMCPY(r->z, table[idx].z, sizeof(r->z));
+}
+
+/* Copy the table entry at index idx into the point r.
+ * Not constant time: only used when cache attack resistance is disabled.
+ *
+ * r      Point to copy into.
+ * table  Table of affine points.
+ * idx    Index of entry to copy.
+ */
+static void sp_521_get_entry_65_9(sp_point_521* r,
+        const sp_table_entry_521* table, int idx)
+{
+    XMEMCPY(r->x, table[idx].x, sizeof(table[idx].x));
+    XMEMCPY(r->y, table[idx].y, sizeof(table[idx].y));
+}
+#endif /* !WC_NO_CACHE_RESISTANT */
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_add_one_9(sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_rshift_9(sp_digit* r, const sp_digit* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_from_bin_bswap(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_from_bin_movbe(sp_digit* r, int size, const byte* a, int n);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_to_bin_bswap_9(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_to_bin_movbe_9(sp_digit* r, byte* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef HAVE_INTEL_AVX2
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_mul_avx2_9(sp_digit* r, const sp_digit* a, const sp_digit* b, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_sqr_avx2_9(sp_digit* r, const sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mul_avx2_9(sp_digit* r, const sp_digit* a, const sp_digit* b);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_sqr_avx2_9(sp_digit* r, const sp_digit* a);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sp_521_mont_reduce_order_avx2_9(sp_digit* a, const sp_digit* m, sp_digit mp);
+#ifdef __cplusplus
+}
+#endif
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Read big endian unsigned byte array into r.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  Byte array.
+ * n  Number of bytes in array to read.
+ */
+static void sp_521_from_bin(sp_digit* r, int size, const byte* a, int n)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_521_from_bin_movbe(r, size, a, n);
+    }
+    else
+#endif
+    {
+        sp_521_from_bin_bswap(r, size, a, n);
+    }
+}
+
+/* Write r as big endian to byte array.
+ * Fixed length number of bytes written: 66
+ *
+ * r  A single precision integer.
+ * a  Byte array.
+ */
+static void sp_521_to_bin_9(sp_digit* r, byte* a)
+{
+#ifndef NO_MOVBE_SUPPORT
+    word32 cpuid_flags = cpuid_get_flags();
+
+    if (IS_INTEL_MOVBE(cpuid_flags)) {
+        sp_521_to_bin_movbe_9(r, a);
+    }
+    else
+#endif
+    {
+        sp_521_to_bin_bswap_9(r, a);
+    }
+}
+
+/* Convert an mp_int to an array of sp_digit.
+ *
+ * r  A single precision integer.
+ * size  Maximum number of bytes to convert
+ * a  A multi-precision integer.
+ */
+static void sp_521_from_mp(sp_digit* r, int size, const mp_int* a)
+{
+#if DIGIT_BIT == 64
+    int j;
+
+    XMEMCPY(r, a->dp, sizeof(sp_digit) * a->used);
+
+    for (j = a->used; j < size; j++) {
+        r[j] = 0;
+    }
+#elif DIGIT_BIT > 64
+    int i;
+    int j = 0;
+    word32 s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i] << s);
+        r[j] &= 0xffffffffffffffffl;
+        s = 64U - s;
+        if (j + 1 >= size) {
+            break;
+        }
+        /* lint allow cast of mismatch word32 and mp_digit */
+        r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+        while ((s + 64U) <= (word32)DIGIT_BIT) {
+            s += 64U;
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            if (s < (word32)DIGIT_BIT) {
+                /* lint allow cast of mismatch word32 and mp_digit */
+                r[++j] = (sp_digit)(a->dp[i] >> s); /*lint !e9033*/
+            }
+            else {
+                r[++j] = (sp_digit)0;
+            }
+        }
+        s = (word32)DIGIT_BIT - s;
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#else
+    int i;
+    int j = 0;
+    int s = 0;
+
+    r[0] = 0;
+    for (i = 0; i < a->used && j < size; i++) {
+        r[j] |= ((sp_digit)a->dp[i]) << s;
+        if (s + DIGIT_BIT >= 64) {
+            r[j] &= 0xffffffffffffffffl;
+            if (j + 1 >= size) {
+                break;
+            }
+            s = 64 - s;
+            if (s == DIGIT_BIT) {
+                r[++j] = 0;
+                s = 0;
+            }
+            else {
+                r[++j] = a->dp[i] >> s;
+                s = DIGIT_BIT - s;
+            }
+        }
+        else {
+            s += DIGIT_BIT;
+        }
+    }
+
+    for (j++; j < size; j++) {
+        r[j] = 0;
+    }
+#endif
+}
+
+/* Convert an array of sp_digit to an mp_int.
+ *
+ * a  A single precision integer.
+ * r  A multi-precision integer.
+ */
+static int sp_521_to_mp(const sp_digit* a, mp_int* r)
+{
+    int err;
+
+    err = mp_grow(r, (521 + DIGIT_BIT - 1) / DIGIT_BIT);
+    if (err == MP_OKAY) { /*lint !e774 case where err is always MP_OKAY*/
+#if DIGIT_BIT == 64
+        XMEMCPY(r->dp, a, sizeof(sp_digit) * 9);
+        r->used = 9;
+        mp_clamp(r);
+#elif DIGIT_BIT < 64
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 9; i++) {
+            r->dp[j] |= (mp_digit)(a[i] << s);
+            r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+            s = DIGIT_BIT - s;
+            r->dp[++j] = (mp_digit)(a[i] >> s);
+            while (s + DIGIT_BIT <= 64) {
+                s += DIGIT_BIT;
+                r->dp[j++] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+                if (s == SP_WORD_SIZE) {
+                    r->dp[j] = 0;
+                }
+                else {
+                    r->dp[j] = (mp_digit)(a[i] >> s);
+                }
+            }
+            s = 64 - s;
+        }
+        r->used = (521 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#else
+        int i;
+        int j = 0;
+        int s = 0;
+
+        r->dp[0] = 0;
+        for (i = 0; i < 9; i++) {
+            r->dp[j] |= ((mp_digit)a[i]) << s;
+            if (s + 64 >= DIGIT_BIT) {
+    #if DIGIT_BIT != 32 && DIGIT_BIT != 64
+                r->dp[j] &= ((sp_digit)1 << DIGIT_BIT) - 1;
+    #endif
+                s = DIGIT_BIT - s;
+                r->dp[++j] = a[i] >> s;
+                s = 64 - s;
+            }
+            else {
+                s += 64;
+            }
+        }
+        r->used = (521 + DIGIT_BIT - 1) / DIGIT_BIT;
+        mp_clamp(r);
+#endif
+    }
+
+    return err;
+}
+
+
+/* Convert a point of type ecc_point to type sp_point_521.
+ *
+ * p   Point of type sp_point_521 (result).
+ * pm  Point of type ecc_point.
+ */
+static void sp_521_point_from_ecc_point_9(sp_point_521* p,
+        const ecc_point* pm)
+{
+    XMEMSET(p->x, 0, sizeof(p->x));
+    XMEMSET(p->y, 0, sizeof(p->y));
+    XMEMSET(p->z, 0, sizeof(p->z));
+    sp_521_from_mp(p->x, 9, pm->x);
+    sp_521_from_mp(p->y, 9, pm->y);
+    sp_521_from_mp(p->z, 9, pm->z);
+    p->infinity = 0;
+}
+
+/* Convert a point of type sp_point_521 to type ecc_point.
+ *
+ * p   Point of type sp_point_521.
+ * pm  Point of type ecc_point (result).
+ * returns MEMORY_E when allocation of memory in ecc_point fails otherwise
+ * MP_OKAY.
+ */
+static int sp_521_point_to_ecc_point_9(const sp_point_521* p, ecc_point* pm)
+{
+    int err;
+
+    err = sp_521_to_mp(p->x, pm->x);
+    if (err == MP_OKAY) {
+        err = sp_521_to_mp(p->y, pm->y);
+    }
+    if (err == MP_OKAY) {
+        err = sp_521_to_mp(p->z, pm->z);
+    }
+
+    return err;
+}
+
+/* Copy the point p into r unless they are the same.
+ *
+ * r  Point to copy into.
+ * p  Point to copy.
+ */
+static void sp_521_point_copy_9(sp_point_521* r, const sp_point_521* p)
+{
+    if (r != p) {
+        XMEMCPY(r, p, sizeof(sp_point_521));
+    }
+}
+
+/* Set the point to infinity.
+ *
+ * r  Point to set.
+ */
+static void sp_521_point_set_inf_9(sp_point_521* r)
+{
+    XMEMSET(r, 0, sizeof(sp_point_521));
+    r->infinity = 1;
+}
+
+/* Check whether a is zero.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_521_iszero_9(const sp_digit* a)
+{
+    return (a[0] | a[1] | a[2] | a[3] | a[4] | a[5] | a[6] | a[7] | a[8]) == 0;
+}
+
+/* Reduce a, which is less than 2^521, into the range 0..m-1 where m is
+ * greater than 2^520.
+ *
+ * a  A single precision integer to reduce in place.
+ * m  Modulus.
+ */
+static void sp_521_norm_mod_9(sp_digit* a, const sp_digit* m)
+{
+    (void)sp_521_cond_sub_9(a, a, m,
+                                  ~(sp_digit)(sp_521_cmp_9(a, m) >> 63));
+}
+
+/* Check whether a is zero modulo the prime. The Montgomery form operations
+ * return values less than 2^521, so zero may also be represented by p.
+ *
+ * a  A single precision integer.
+ * returns 1 when zero and 0 otherwise.
+ */
+static int sp_521_iszero_mod_9(const sp_digit* a)
+{
+    sp_digit t[9];
+
+    XMEMCPY(t, a, sizeof(t));
+    sp_521_norm_mod_9(t, p521_mod);
+    return sp_521_iszero_9(t);
+}
+
+/* Negate the point's y ordinate when sign is 1.
+ * Constant time.
+ *
+ * p     Point to conditionally negate.
+ * sign  1 to negate and 0 to leave unchanged.
+ */
+static void sp_521_point_cond_neg_9(sp_point_521* p, sp_digit sign)
+{
+    sp_digit t[9];
+
+    sp_521_mont_sub_9(t, p521_mod, p->y, p521_mod);
+    sp_521_cond_copy_9(p->y, t, (sp_digit)0 - sign);
+}
+
+/* Convert the point's ordinates to Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_521_point_to_mont_9(sp_point_521* p)
+{
+    sp_521_mont_mul_9(p->x, p->x, p521_r2_mod, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(p->y, p->y, p521_r2_mod, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(p->z, p->z, p521_r2_mod, p521_mod, p521_mp_mod);
+}
+
+/* Convert the point's ordinates from Montgomery form.
+ *
+ * p  Point to convert in place.
+ */
+static void sp_521_point_from_mont_9(sp_point_521* p)
+{
+    static const sp_digit one[9] = { 1, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    sp_521_mont_mul_9(p->x, p->x, one, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(p->y, p->y, one, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(p->z, p->z, one, p521_mod, p521_mp_mod);
+    sp_521_norm_mod_9(p->x, p521_mod);
+    sp_521_norm_mod_9(p->y, p521_mod);
+    sp_521_norm_mod_9(p->z, p521_mod);
+}
+
+/* Make the scalar odd by replacing even k with order - k. The order is odd.
+ * Constant time.
+ *
+ * u  Odd scalar (result).
+ * k  Scalar less than the order.
+ * returns 1 when k was replaced and the result must be negated, 0 otherwise.
+ */
+static sp_digit sp_521_ecc_odd_9(sp_digit* u, const sp_digit* k)
+{
+    sp_digit t[9];
+    sp_digit neg = (k[0] & 1) ^ 1;
+
+    XMEMCPY(u, k, sizeof(t));
+    (void)sp_521_sub_9(t, p521_order, k);
+    sp_521_cond_copy_9(u, t, (sp_digit)0 - neg);
+    ForceZero(t, sizeof(t));
+
+    return neg;
+}
+
+/* Get the signed odd digit of window i of the odd scalar u as an index into
+ * the table of odd multiples.
+ * The digit is 2.b + 1 - 64 where b is bits 6i+1..6i+6 of u.
+ *
+ * u     Odd scalar.
+ * i     Window index.
+ * sign  1 when the digit is negative (result).
+ * returns the table index of the digit's magnitude.
+ */
+static int sp_521_ecc_window_9(const sp_digit* u, int i, sp_digit* sign)
+{
+    int pos = 6 * i + 1;
+    int o = pos & 63;
+    sp_digit b = u[pos >> 6] >> o;
+
+    if (o > 58) {
+        b |= u[(pos >> 6) + 1] << (64 - o);
+    }
+    b &= 0x3f;
+    *sign = ((b >> 5) & 1) ^ 1;
+
+    return (int)((b & 0x1f) ^ (((sp_digit)0 - *sign) & 0x1f)) + 1;
+}
+
+/* Get bit j of the recoded scalar s = (u >> 1) + 2^524 whose bits select
+ * +1 (set) or -1 (clear) for each bit position of the odd scalar u.
+ *
+ * u  Odd scalar.
+ * j  Bit index.
+ * returns the bit.
+ */
+static sp_digit sp_521_ecc_comb_bit_9(const sp_digit* u, int j)
+{
+    j++;
+    if (j == P521_COMB_TEETH * P521_COMB_SPACING) {
+        return 1;
+    }
+    if (j >= 521) {
+        return 0;
+    }
+    return (u[j >> 6] >> (j & 63)) & 1;
+}
+
+/* Get the index into the base point table for column c of the comb.
+ * Entries have the top tooth positive; when its bit is clear the column is
+ * the negation of the entry with all other teeth flipped.
+ *
+ * u     Odd scalar.
+ * c     Column.
+ * sign  1 when the entry is to be negated (result).
+ * returns the table index.
+ */
+static int sp_521_ecc_comb_9(const sp_digit* u, int c, sp_digit* sign)
+{
+    sp_digit idx = 0;
+    sp_digit top;
+    int i;
+
+    for (i = 0; i < P521_COMB_TEETH - 1; i++) {
+        idx |= sp_521_ecc_comb_bit_9(u, c + i * P521_COMB_SPACING) << i;
+    }
+    top = sp_521_ecc_comb_bit_9(u, c + i * P521_COMB_SPACING);
+    idx ^= (top - 1) & ((1 << (P521_COMB_TEETH - 1)) - 1);
+    *sign = top ^ 1;
+
+    return (int)idx + 1;
+}
+
+/* Add two numbers less than the order modulo the order. (r = a + b mod n)
+ * Constant time.
+ *
+ * r  Result of addition.
+ * a  First number to add.
+ * b  Second number to add.
+ */
+static void sp_521_add_mod_order_9(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit c;
+
+    c = sp_521_add_9(r, a, b);
+    (void)sp_521_cond_sub_9(r, r, p521_order, ((sp_digit)0 - c) |
+                            ~(sp_digit)(sp_521_cmp_9(r, p521_order) >> 63));
+}
+
+/* Multiply two numbers in Montgomery form modulo the order of the P521 curve.
+ * (r = a * b mod order)
+ *
+ * r  Result of the multiplication.
+ * a  First operand of the multiplication.
+ * b  Second operand of the multiplication.
+ */
+static void sp_521_mont_mul_order_9(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit t[2 * 9];
+
+    sp_521_mul_9(t, a, b);
+    sp_521_mont_reduce_order_9(t, p521_order, p521_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 9);
+}
+
+/* Square number in Montgomery form modulo the order of the P521 curve.
+ * (r = a * a mod order)
+ *
+ * r  Result of the squaring.
+ * a  Number to square.
+ */
+static void sp_521_mont_sqr_order_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[2 * 9];
+
+    sp_521_sqr_9(t, a);
+    sp_521_mont_reduce_order_9(t, p521_order, p521_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 9);
+}
+
+/* Generate a random number k in the range 1..order-1.
+ *
+ * rng  Random number generator.
+ * k    Scalar value (result).
+ * returns RNG failures and MP_OKAY on success.
+ */
+static int sp_521_ecc_gen_k_9(WC_RNG* rng, sp_digit* k)
+{
+    byte buf[66];
+    int err;
+
+    do {
+        err = wc_RNG_GenerateBlock(rng, buf, sizeof(buf));
+        if (err == 0) {
+            sp_521_from_bin(k, 9, buf, (int)sizeof(buf));
+            k[8] &= 0x1ff;
+            if (sp_521_cmp_9(k, p521_order2) <= 0) {
+                sp_521_add_one_9(k);
+                break;
+            }
+        }
+    }
+    while (err == 0);
+
+    ForceZero(buf, sizeof(buf));
+
+    return err;
+}
+
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_521_mont_sqr_n_9(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_521_mont_sqr_9(r, a, p521_mod, p521_mp_mod);
+    for (; n > 1; n--) {
+        sp_521_mont_sqr_9(r, r, p521_mod, p521_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P521 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_521_mont_inv_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[9];
+    sp_digit x3[9];
+    sp_digit x4[9];
+    sp_digit x7[9];
+    sp_digit x8[9];
+    sp_digit t[9];
+    sp_digit t2[9];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_521_mont_sqr_9(t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(x2, t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_9(t, x2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(x3, t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t, x2, 2);
+    sp_521_mont_mul_9(x4, t, x2, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t, x4, 3);
+    sp_521_mont_mul_9(x7, t, x3, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t, x4, 4);
+    sp_521_mont_mul_9(x8, t, x4, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t, x8, 8);
+    sp_521_mont_mul_9(t, t, x8, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t2, t, 16);
+    sp_521_mont_mul_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t2, t, 32);
+    sp_521_mont_mul_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t2, t, 64);
+    sp_521_mont_mul_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t2, t, 128);
+    sp_521_mont_mul_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t2, t, 256);
+    sp_521_mont_mul_9(t, t2, t, p521_mod, p521_mp_mod);
+    /* p - 2 = [519 ones] 01 */
+    sp_521_mont_sqr_n_9(t, t, 7);
+    sp_521_mont_mul_9(t, t, x7, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_9(t, t, 2);
+    sp_521_mont_mul_9(r, t, a, p521_mod, p521_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_521_map_9(sp_point_521* r, const sp_point_521* p)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+
+    sp_521_mont_inv_9(t1, p->z);
+    sp_521_mont_sqr_9(t2, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t1, t2, t1, p521_mod, p521_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_521_mont_mul_9(r->x, p->x, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(r->y, p->y, t1, p521_mod, p521_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_521_mont_mul_9(r->x, r->x, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(r->y, r->y, t2, p521_mod, p521_mp_mod);
+    sp_521_norm_mod_9(r->x, p521_mod);
+    sp_521_norm_mod_9(r->y, p521_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_521_proj_point_dbl_9(sp_point_521* r, const sp_point_521* p)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+
+    if (p->infinity) {
+        sp_521_point_copy_9(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_521_mont_sqr_9(t1, p->z, p521_mod, p521_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_521_mont_mul_9(t4, p->y, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_dbl_9(r->z, t4, p521_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_521_mont_sub_9(t2, p->x, t1, p521_mod);
+    sp_521_mont_add_9(t1, p->x, t1, p521_mod);
+    sp_521_mont_mul_9(t2, t1, t2, p521_mod, p521_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_521_mont_tpl_9(t1, t2, p521_mod);
+    /* T3 = 4 * Y * Y */
+    sp_521_mont_dbl_9(t3, p->y, p521_mod);
+    sp_521_mont_sqr_9(t3, t3, p521_mod, p521_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_521_mont_mul_9(t4, t3, p->x, p521_mod, p521_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_521_mont_sqr_9(t3, t3, p521_mod, p521_mp_mod);
+    sp_521_div2_9(t3, t3, p521_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_521_mont_sqr_9(t2, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t2, t2, t4, p521_mod);
+    sp_521_mont_sub_9(r->x, t2, t4, p521_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_521_mont_sub_9(t4, t4, r->x, p521_mod);
+    sp_521_mont_mul_9(t4, t4, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t4, t3, p521_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_521_proj_point_dbl_n_9(sp_point_521* r, const sp_point_521* p,
+        int n)
+{
+    sp_521_proj_point_dbl_9(r, p);
+    for (; n > 1; n--) {
+        sp_521_proj_point_dbl_9(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_521_proj_point_add_9(sp_point_521* r, const sp_point_521* p,
+        const sp_point_521* q)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+    sp_digit t5[9];
+    sp_digit t6[9];
+
+    if (q->infinity) {
+        sp_521_point_copy_9(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_521_point_copy_9(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_521_mont_sqr_9(t1, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t3, t1, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t1, t1, p->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t3, t3, p->y, p521_mod, p521_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_521_mont_sqr_9(t2, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t4, t2, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t2, t2, q->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t4, t4, q->y, p521_mod, p521_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_521_mont_sub_9(t2, t2, t1, p521_mod);
+    sp_521_mont_sub_9(t4, t4, t3, p521_mod);
+    if (sp_521_iszero_mod_9(t2)) {
+        if (sp_521_iszero_mod_9(t4)) {
+            sp_521_proj_point_dbl_9(r, p);
+        }
+        else {
+            sp_521_point_set_inf_9(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_521_mont_mul_9(t5, p->z, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(r->z, t5, t2, p521_mod, p521_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_521_mont_sqr_9(t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t6, t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t1, t1, t5, p521_mod, p521_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_521_mont_sqr_9(t5, t4, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t5, t5, t6, p521_mod);
+    sp_521_mont_sub_9(t5, t5, t1, p521_mod);
+    sp_521_mont_sub_9(r->x, t5, t1, p521_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_521_mont_sub_9(t1, t1, r->x, p521_mod);
+    sp_521_mont_mul_9(t1, t1, t4, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t6, t6, t3, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t1, t6, p521_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_521_proj_point_add_qz1_9(sp_point_521* r,
+        const sp_point_521* p, const sp_point_521* q)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+    sp_digit t5[9];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p521_norm_mod, sizeof(p521_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_521_mont_sqr_9(t1, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t2, t1, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t1, t1, q->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t2, t2, q->y, p521_mod, p521_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_521_mont_sub_9(t1, t1, p->x, p521_mod);
+    sp_521_mont_sub_9(t2, t2, p->y, p521_mod);
+    if (sp_521_iszero_mod_9(t1)) {
+        if (sp_521_iszero_mod_9(t2)) {
+            sp_521_proj_point_dbl_9(r, p);
+        }
+        else {
+            sp_521_point_set_inf_9(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_521_mont_mul_9(r->z, p->z, t1, p521_mod, p521_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_521_mont_sqr_9(t3, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t4, t3, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t3, t3, p->x, p521_mod, p521_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_521_mont_sqr_9(t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t5, t5, t4, p521_mod);
+    sp_521_mont_sub_9(t5, t5, t3, p521_mod);
+    sp_521_mont_sub_9(r->x, t5, t3, p521_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_521_mont_sub_9(t3, t3, r->x, p521_mod);
+    sp_521_mont_mul_9(t3, t3, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_9(t4, t4, p->y, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t3, t4, p521_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_521_ecc_mulmod_9(sp_point_521* r, const sp_point_521* g,
+        const sp_digit* k, int map)
+{
+    sp_point_521 t[33];
+    sp_point_521 p;
+    sp_point_521 p2;
+    sp_digit u[9];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_521_point_copy_9(&t[1], g);
+    sp_521_proj_point_dbl_9(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_521_proj_point_add_9(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_521_ecc_odd_9(u, k);
+
+    /* Top window: digit 1 + 2 * u[520..517] */
+    sp_521_get_point_33_9(r, t, (int)(u[8] >> 5) + 1);
+    r->infinity = 0;
+    for (i = 85; i >= 0; i--) {
+        idx = sp_521_ecc_window_9(u, i, &sign);
+        sp_521_proj_point_dbl_n_9(r, r, 6);
+        sp_521_get_point_33_9(&p, t, idx);
+        p.infinity = 0;
+        sp_521_point_cond_neg_9(&p, sign);
+        sp_521_proj_point_add_9(r, r, &p);
+    }
+
+    if (map) {
+        sp_521_map_9(r, r);
+    }
+    sp_521_point_cond_neg_9(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P521 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_521_ecc_mulmod_base_9(sp_point_521* r, const sp_digit* k,
+        int map)
+{
+    sp_point_521 p;
+    sp_digit u[9];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_521_ecc_odd_9(u, k);
+
+    for (c = P521_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_521_ecc_comb_9(u, c, &sign);
+        sp_521_get_entry_65_9(&p, p521_table, idx);
+        sp_521_point_cond_neg_9(&p, sign ^ neg);
+        if (c == P521_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p521_norm_mod, sizeof(p521_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_521_proj_point_dbl_9(r, r);
+            sp_521_proj_point_add_qz1_9(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_521_map_9(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P521 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_521_mont_inv_order_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][9];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_521_mont_mul_order_9(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p521_order2[8] >> 8], sizeof(t[0]));
+    for (i = 8; i >= 0; i--) {
+        for (j = (i == 8) ? 4 : 60; j >= 0; j -= 4) {
+            sp_521_mont_sqr_order_9(r, r);
+            sp_521_mont_sqr_order_9(r, r);
+            sp_521_mont_sqr_order_9(r, r);
+            sp_521_mont_sqr_order_9(r, r);
+            y = (p521_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_521_mont_mul_order_9(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P521 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_521_ecc_sign_9(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_521 point;
+    sp_digit k[9];
+    sp_digit x[9];
+    sp_digit t[9];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_521_from_mp(k, 9, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_521_ecc_gen_k_9(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_521_ecc_mulmod_base_9(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 9);
+        sp_521_norm_mod_9(r, p521_order);
+        if (sp_521_iszero_9(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_521_mont_mul_order_9(x, d, p521_r2_order);
+        sp_521_mont_mul_order_9(x, x, r);
+        sp_521_norm_mod_9(x, p521_order);
+        sp_521_add_mod_order_9(x, x, e);
+        sp_521_mont_mul_order_9(k, k, p521_r2_order);
+        sp_521_mont_inv_order_9(t, k);
+        sp_521_mont_mul_order_9(s, t, x);
+        sp_521_norm_mod_9(s, p521_order);
+        if (!sp_521_iszero_9(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P521 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_521_ecc_verify_9(const sp_digit* e, const sp_point_521* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_521 p1;
+    sp_point_521 p2;
+    sp_digit w[9];
+    sp_digit u1[9];
+    sp_digit u2[9];
+
+    /* w = 1 / s in Montgomery form */
+    sp_521_mont_mul_order_9(w, s, p521_r2_order);
+    sp_521_mont_inv_order_9(w, w);
+    /* u1 = e.w, u2 = r.w */
+    sp_521_mont_mul_order_9(u1, e, w);
+    sp_521_norm_mod_9(u1, p521_order);
+    sp_521_mont_mul_order_9(u2, r, w);
+    sp_521_norm_mod_9(u2, p521_order);
+
+    /* u1.G + u2.Q */
+    if (sp_521_iszero_9(u1)) {
+        sp_521_point_set_inf_9(&p1);
+    }
+    else {
+        sp_521_ecc_mulmod_base_9(&p1, u1, 0);
+    }
+    sp_521_ecc_mulmod_9(&p2, q, u2, 0);
+    sp_521_proj_point_add_9(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_521_map_9(&p1, &p1);
+    sp_521_norm_mod_9(p1.x, p521_order);
+    return sp_521_cmp_9(p1.x, r) == 0;
+}
+
+#ifdef HAVE_INTEL_AVX2
+/* Multiply two numbers in Montgomery form modulo the order of the P521 curve.
+ * (r = a * b mod order)
+ *
+ * r  Result of the multiplication.
+ * a  First operand of the multiplication.
+ * b  Second operand of the multiplication.
+ */
+static void sp_521_mont_mul_order_avx2_9(sp_digit* r, const sp_digit* a,
+        const sp_digit* b)
+{
+    sp_digit t[2 * 9];
+
+    sp_521_mul_avx2_9(t, a, b);
+    sp_521_mont_reduce_order_avx2_9(t, p521_order, p521_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 9);
+}
+
+/* Square number in Montgomery form modulo the order of the P521 curve.
+ * (r = a * a mod order)
+ *
+ * r  Result of the squaring.
+ * a  Number to square.
+ */
+static void sp_521_mont_sqr_order_avx2_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[2 * 9];
+
+    sp_521_sqr_avx2_9(t, a);
+    sp_521_mont_reduce_order_avx2_9(t, p521_order, p521_mp_order);
+    XMEMCPY(r, t, sizeof(sp_digit) * 9);
+}
+
+/* Square the Montgomery form number a number of times. (r = a ^ (2 ^ n) mod m)
+ *
+ * r   Result of squaring.
+ * a   Number to square in Montgomery form.
+ * n   Number of times to square.
+ */
+static void sp_521_mont_sqr_n_avx2_9(sp_digit* r, const sp_digit* a, int n)
+{
+    sp_521_mont_sqr_avx2_9(r, a, p521_mod, p521_mp_mod);
+    for (; n > 1; n--) {
+        sp_521_mont_sqr_avx2_9(r, r, p521_mod, p521_mp_mod);
+    }
+}
+
+/* Invert the number, in Montgomery form, modulo the modulus (prime) of the
+ * P521 curve. (r = 1 / a mod m)
+ * Raises to the power p - 2 with a fixed addition chain.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_521_mont_inv_avx2_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit x2[9];
+    sp_digit x3[9];
+    sp_digit x4[9];
+    sp_digit x7[9];
+    sp_digit x8[9];
+    sp_digit t[9];
+    sp_digit t2[9];
+
+    /* xn = a ^ (2^n - 1) */
+    sp_521_mont_sqr_avx2_9(t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(x2, t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_avx2_9(t, x2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(x3, t, a, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t, x2, 2);
+    sp_521_mont_mul_avx2_9(x4, t, x2, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t, x4, 3);
+    sp_521_mont_mul_avx2_9(x7, t, x3, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t, x4, 4);
+    sp_521_mont_mul_avx2_9(x8, t, x4, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t, x8, 8);
+    sp_521_mont_mul_avx2_9(t, t, x8, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t2, t, 16);
+    sp_521_mont_mul_avx2_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t2, t, 32);
+    sp_521_mont_mul_avx2_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t2, t, 64);
+    sp_521_mont_mul_avx2_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t2, t, 128);
+    sp_521_mont_mul_avx2_9(t, t2, t, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t2, t, 256);
+    sp_521_mont_mul_avx2_9(t, t2, t, p521_mod, p521_mp_mod);
+    /* p - 2 = [519 ones] 01 */
+    sp_521_mont_sqr_n_avx2_9(t, t, 7);
+    sp_521_mont_mul_avx2_9(t, t, x7, p521_mod, p521_mp_mod);
+    sp_521_mont_sqr_n_avx2_9(t, t, 2);
+    sp_521_mont_mul_avx2_9(r, t, a, p521_mod, p521_mp_mod);
+}
+
+/* Map the Montgomery form projective coordinate point to an affine point
+ * with ordinates in normal form.
+ *
+ * r  Resulting affine coordinate point.
+ * p  Montgomery form projective coordinate point.
+ */
+static void sp_521_map_avx2_9(sp_point_521* r, const sp_point_521* p)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+
+    sp_521_mont_inv_avx2_9(t1, p->z);
+    sp_521_mont_sqr_avx2_9(t2, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t1, t2, t1, p521_mod, p521_mp_mod);
+
+    /* x /= z^2, y /= z^3 and multiply by 1 to leave Montgomery form */
+    sp_521_mont_mul_avx2_9(r->x, p->x, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(r->y, p->y, t1, p521_mod, p521_mp_mod);
+    XMEMSET(t2, 0, sizeof(t2));
+    t2[0] = 1;
+    sp_521_mont_mul_avx2_9(r->x, r->x, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(r->y, r->y, t2, p521_mod, p521_mp_mod);
+    sp_521_norm_mod_9(r->x, p521_mod);
+    sp_521_norm_mod_9(r->y, p521_mod);
+
+    XMEMSET(r->z, 0, sizeof(r->z));
+    r->z[0] = 1;
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p. (r = 2.p)
+ * Curve parameter a is -3.
+ *
+ * r  Result of doubling point.
+ * p  Point to double.
+ */
+static void sp_521_proj_point_dbl_avx2_9(sp_point_521* r, const sp_point_521* p)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+
+    if (p->infinity) {
+        sp_521_point_copy_9(r, p);
+        return;
+    }
+
+    /* T1 = Z * Z */
+    sp_521_mont_sqr_avx2_9(t1, p->z, p521_mod, p521_mp_mod);
+    /* Z = 2 * Y * Z */
+    sp_521_mont_mul_avx2_9(t4, p->y, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_dbl_9(r->z, t4, p521_mod);
+    /* T2 = (X - T1) * (X + T1) */
+    sp_521_mont_sub_9(t2, p->x, t1, p521_mod);
+    sp_521_mont_add_9(t1, p->x, t1, p521_mod);
+    sp_521_mont_mul_avx2_9(t2, t1, t2, p521_mod, p521_mp_mod);
+    /* T1 = 3 * T2 */
+    sp_521_mont_tpl_9(t1, t2, p521_mod);
+    /* T3 = 4 * Y * Y */
+    sp_521_mont_dbl_9(t3, p->y, p521_mod);
+    sp_521_mont_sqr_avx2_9(t3, t3, p521_mod, p521_mp_mod);
+    /* T4 = 4 * X * Y * Y */
+    sp_521_mont_mul_avx2_9(t4, t3, p->x, p521_mod, p521_mp_mod);
+    /* T3 = 8 * Y * Y * Y * Y */
+    sp_521_mont_sqr_avx2_9(t3, t3, p521_mod, p521_mp_mod);
+    sp_521_div2_9(t3, t3, p521_mod);
+    /* X = T1 * T1 - 2 * T4 */
+    sp_521_mont_sqr_avx2_9(t2, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t2, t2, t4, p521_mod);
+    sp_521_mont_sub_9(r->x, t2, t4, p521_mod);
+    /* Y = T1 * (T4 - X) - T3 */
+    sp_521_mont_sub_9(t4, t4, r->x, p521_mod);
+    sp_521_mont_mul_avx2_9(t4, t4, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t4, t3, p521_mod);
+    r->infinity = 0;
+}
+
+/* Double the Montgomery form projective point p a number of times.
+ *
+ * r  Result of repeated doubling of point.
+ * p  Point to double.
+ * n  Number of times to double
+ */
+static void sp_521_proj_point_dbl_n_avx2_9(sp_point_521* r,
+        const sp_point_521* p, int n)
+{
+    sp_521_proj_point_dbl_avx2_9(r, p);
+    for (; n > 1; n--) {
+        sp_521_proj_point_dbl_avx2_9(r, r);
+    }
+}
+
+/* Add two Montgomery form projective points. (r = p + q)
+ * Equal points are doubled and opposite points give infinity; these cases
+ * only occur for special scalars.
+ *
+ * r  Result of addition.
+ * p  First point to add.
+ * q  Second point to add.
+ */
+static void sp_521_proj_point_add_avx2_9(sp_point_521* r, const sp_point_521* p,
+        const sp_point_521* q)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+    sp_digit t5[9];
+    sp_digit t6[9];
+
+    if (q->infinity) {
+        sp_521_point_copy_9(r, p);
+        return;
+    }
+    if (p->infinity) {
+        sp_521_point_copy_9(r, q);
+        return;
+    }
+
+    /* U1 = X1 * Z2^2, S1 = Y1 * Z2^3 */
+    sp_521_mont_sqr_avx2_9(t1, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t3, t1, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t1, t1, p->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t3, t3, p->y, p521_mod, p521_mp_mod);
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_521_mont_sqr_avx2_9(t2, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t4, t2, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t2, t2, q->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t4, t4, q->y, p521_mod, p521_mp_mod);
+    /* H = U2 - U1, R = S2 - S1 */
+    sp_521_mont_sub_9(t2, t2, t1, p521_mod);
+    sp_521_mont_sub_9(t4, t4, t3, p521_mod);
+    if (sp_521_iszero_mod_9(t2)) {
+        if (sp_521_iszero_mod_9(t4)) {
+            sp_521_proj_point_dbl_avx2_9(r, p);
+        }
+        else {
+            sp_521_point_set_inf_9(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 * Z2 */
+    sp_521_mont_mul_avx2_9(t5, p->z, q->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(r->z, t5, t2, p521_mod, p521_mp_mod);
+    /* T5 = H^2, T6 = H^3, T1 = U1 * H^2 */
+    sp_521_mont_sqr_avx2_9(t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t6, t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t1, t1, t5, p521_mod, p521_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * U1 * H^2 */
+    sp_521_mont_sqr_avx2_9(t5, t4, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t5, t5, t6, p521_mod);
+    sp_521_mont_sub_9(t5, t5, t1, p521_mod);
+    sp_521_mont_sub_9(r->x, t5, t1, p521_mod);
+    /* Y3 = R * (U1 * H^2 - X3) - S1 * H^3 */
+    sp_521_mont_sub_9(t1, t1, r->x, p521_mod);
+    sp_521_mont_mul_avx2_9(t1, t1, t4, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t6, t6, t3, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t1, t6, p521_mod);
+    r->infinity = 0;
+}
+
+/* Add a Montgomery form projective point and an affine point, q, whose Z
+ * ordinate is one. (r = p + q)
+ *
+ * r  Result of addition.
+ * p  Projective point to add.
+ * q  Affine point to add.
+ */
+static void sp_521_proj_point_add_qz1_avx2_9(sp_point_521* r,
+        const sp_point_521* p, const sp_point_521* q)
+{
+    sp_digit t1[9];
+    sp_digit t2[9];
+    sp_digit t3[9];
+    sp_digit t4[9];
+    sp_digit t5[9];
+
+    if (p->infinity) {
+        XMEMCPY(r->x, q->x, sizeof(r->x));
+        XMEMCPY(r->y, q->y, sizeof(r->y));
+        XMEMCPY(r->z, p521_norm_mod, sizeof(p521_norm_mod));
+        r->infinity = 0;
+        return;
+    }
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    sp_521_mont_sqr_avx2_9(t1, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t2, t1, p->z, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t1, t1, q->x, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t2, t2, q->y, p521_mod, p521_mp_mod);
+    /* H = U2 - X1, R = S2 - Y1 */
+    sp_521_mont_sub_9(t1, t1, p->x, p521_mod);
+    sp_521_mont_sub_9(t2, t2, p->y, p521_mod);
+    if (sp_521_iszero_mod_9(t1)) {
+        if (sp_521_iszero_mod_9(t2)) {
+            sp_521_proj_point_dbl_avx2_9(r, p);
+        }
+        else {
+            sp_521_point_set_inf_9(r);
+        }
+        return;
+    }
+
+    /* Z3 = H * Z1 */
+    sp_521_mont_mul_avx2_9(r->z, p->z, t1, p521_mod, p521_mp_mod);
+    /* T3 = X1 * H^2, T4 = H^3 */
+    sp_521_mont_sqr_avx2_9(t3, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t4, t3, t1, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t3, t3, p->x, p521_mod, p521_mp_mod);
+    /* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+    sp_521_mont_sqr_avx2_9(t5, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(t5, t5, t4, p521_mod);
+    sp_521_mont_sub_9(t5, t5, t3, p521_mod);
+    sp_521_mont_sub_9(r->x, t5, t3, p521_mod);
+    /* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+    sp_521_mont_sub_9(t3, t3, r->x, p521_mod);
+    sp_521_mont_mul_avx2_9(t3, t3, t2, p521_mod, p521_mp_mod);
+    sp_521_mont_mul_avx2_9(t4, t4, p->y, p521_mod, p521_mp_mod);
+    sp_521_mont_sub_9(r->y, t3, t4, p521_mod);
+    r->infinity = 0;
+}
+
+/* Multiply the point by the scalar and return the result. (r = k * g)
+ * Constant time: the scalar is made odd and recoded into signed odd 6-bit
+ * windows so that every window adds a point from the table of odd multiples.
+ *
+ * r    Resulting point.
+ * g    Point to multiply in Montgomery form.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_521_ecc_mulmod_avx2_9(sp_point_521* r, const sp_point_521* g,
+        const sp_digit* k, int map)
+{
+    sp_point_521 t[33];
+    sp_point_521 p;
+    sp_point_521 p2;
+    sp_digit u[9];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int i;
+
+    /* t[i] = (2i - 1).g */
+    XMEMSET(&t[0], 0, sizeof(t[0]));
+    sp_521_point_copy_9(&t[1], g);
+    sp_521_proj_point_dbl_avx2_9(&p2, g);
+    for (i = 2; i < 33; i++) {
+        sp_521_proj_point_add_avx2_9(&t[i], &t[i - 1], &p2);
+    }
+
+    neg = sp_521_ecc_odd_9(u, k);
+
+    /* Top window: digit 1 + 2 * u[520..517] */
+    sp_521_get_point_33_9(r, t, (int)(u[8] >> 5) + 1);
+    r->infinity = 0;
+    for (i = 85; i >= 0; i--) {
+        idx = sp_521_ecc_window_9(u, i, &sign);
+        sp_521_proj_point_dbl_n_avx2_9(r, r, 6);
+        sp_521_get_point_33_9(&p, t, idx);
+        p.infinity = 0;
+        sp_521_point_cond_neg_9(&p, sign);
+        sp_521_proj_point_add_avx2_9(r, r, &p);
+    }
+
+    if (map) {
+        sp_521_map_avx2_9(r, r);
+    }
+    sp_521_point_cond_neg_9(r, neg);
+
+    ForceZero(t, sizeof(t));
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Multiply the base point of P521 by the scalar and return the result.
+ * (r = k * G)
+ * Constant time signed comb with 7 teeth: the scalar is made odd so every
+ * column is a non-zero combination of teeth held in the static table.
+ *
+ * r    Resulting point.
+ * k    Scalar to multiply by, less than the order.
+ * map  Indicates whether to convert result to affine.
+ */
+static void sp_521_ecc_mulmod_base_avx2_9(sp_point_521* r, const sp_digit* k,
+        int map)
+{
+    sp_point_521 p;
+    sp_digit u[9];
+    sp_digit neg;
+    sp_digit sign;
+    int idx;
+    int c;
+
+    neg = sp_521_ecc_odd_9(u, k);
+
+    for (c = P521_COMB_SPACING - 1; c >= 0; c--) {
+        idx = sp_521_ecc_comb_9(u, c, &sign);
+        sp_521_get_entry_65_9(&p, p521_table, idx);
+        sp_521_point_cond_neg_9(&p, sign ^ neg);
+        if (c == P521_COMB_SPACING - 1) {
+            XMEMCPY(r->x, p.x, sizeof(p.x));
+            XMEMCPY(r->y, p.y, sizeof(p.y));
+            XMEMCPY(r->z, p521_norm_mod, sizeof(p521_norm_mod));
+            r->infinity = 0;
+        }
+        else {
+            sp_521_proj_point_dbl_avx2_9(r, r);
+            sp_521_proj_point_add_qz1_avx2_9(r, r, &p);
+        }
+    }
+
+    if (map) {
+        sp_521_map_avx2_9(r, r);
+    }
+
+    ForceZero(&p, sizeof(p));
+    ForceZero(u, sizeof(u));
+}
+
+/* Invert the number, in Montgomery form, modulo the order of the P521 curve.
+ * (r = 1 / a mod order)
+ * Raises to the power order - 2 with a fixed 4-bit window; the exponent is
+ * public so the sequence of operations is fixed.
+ *
+ * r  Inverse result.
+ * a  Number to invert.
+ */
+static void sp_521_mont_inv_order_avx2_9(sp_digit* r, const sp_digit* a)
+{
+    sp_digit t[16][9];
+    sp_digit y;
+    int i;
+    int j;
+
+    XMEMCPY(t[1], a, sizeof(t[1]));
+    for (i = 2; i < 16; i++) {
+        sp_521_mont_mul_order_avx2_9(t[i], t[i - 1], a);
+    }
+
+    XMEMCPY(r, t[p521_order2[8] >> 8], sizeof(t[0]));
+    for (i = 8; i >= 0; i--) {
+        for (j = (i == 8) ? 4 : 60; j >= 0; j -= 4) {
+            sp_521_mont_sqr_order_avx2_9(r, r);
+            sp_521_mont_sqr_order_avx2_9(r, r);
+            sp_521_mont_sqr_order_avx2_9(r, r);
+            sp_521_mont_sqr_order_avx2_9(r, r);
+            y = (p521_order2[i] >> j) & 0xf;
+            if (y != 0) {
+                sp_521_mont_mul_order_avx2_9(r, r, t[y]);
+            }
+        }
+    }
+
+    ForceZero(t, sizeof(t));
+}
+
+/* Sign the hash with the private key using the P521 curve.
+ *
+ * e     Hash as a number, less than the order.
+ * d     Private key.
+ * rng   Random number generator.
+ * km    Optional fixed k, zeroized when used.
+ * r     Signature r.
+ * s     Signature s.
+ * returns RNG failures, RNG_FAILURE_E if k generation fails too many times
+ * and MP_OKAY on success.
+ */
+static int sp_521_ecc_sign_avx2_9(const sp_digit* e, const sp_digit* d,
+        WC_RNG* rng, mp_int* km, sp_digit* r, sp_digit* s)
+{
+    sp_point_521 point;
+    sp_digit k[9];
+    sp_digit x[9];
+    sp_digit t[9];
+    int err = MP_OKAY;
+    int i;
+
+    for (i = SP_ECC_MAX_SIG_GEN; i > 0; i--) {
+        if (km != NULL && !mp_iszero(km)) {
+            sp_521_from_mp(k, 9, km);
+            mp_forcezero(km);
+        }
+        else {
+            err = sp_521_ecc_gen_k_9(rng, k);
+        }
+        if (err != MP_OKAY) {
+            break;
+        }
+
+        /* r = (k.G).x mod order */
+        sp_521_ecc_mulmod_base_avx2_9(&point, k, 1);
+        XMEMCPY(r, point.x, sizeof(sp_digit) * 9);
+        sp_521_norm_mod_9(r, p521_order);
+        if (sp_521_iszero_9(r)) {
+            continue;
+        }
+
+        /* s = (e + r.d) / k mod order */
+        sp_521_mont_mul_order_avx2_9(x, d, p521_r2_order);
+        sp_521_mont_mul_order_avx2_9(x, x, r);
+        sp_521_norm_mod_9(x, p521_order);
+        sp_521_add_mod_order_9(x, x, e);
+        sp_521_mont_mul_order_avx2_9(k, k, p521_r2_order);
+        sp_521_mont_inv_order_avx2_9(t, k);
+        sp_521_mont_mul_order_avx2_9(s, t, x);
+        sp_521_norm_mod_9(s, p521_order);
+        if (!sp_521_iszero_9(s)) {
+            break;
+        }
+    }
+    if (err == MP_OKAY && i == 0) {
+        err = RNG_FAILURE_E;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(x, sizeof(x));
+    ForceZero(t, sizeof(t));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Verify the signature values with the public key using the P521 curve.
+ *
+ * e    Hash as a number, less than the order.
+ * q    Public key point in Montgomery form.
+ * r    Signature r, between 1 and order - 1.
+ * s    Signature s, between 1 and order - 1.
+ * returns 1 when the signature is valid and 0 otherwise.
+ */
+static int sp_521_ecc_verify_avx2_9(const sp_digit* e, const sp_point_521* q,
+        const sp_digit* r, const sp_digit* s)
+{
+    sp_point_521 p1;
+    sp_point_521 p2;
+    sp_digit w[9];
+    sp_digit u1[9];
+    sp_digit u2[9];
+
+    /* w = 1 / s in Montgomery form */
+    sp_521_mont_mul_order_avx2_9(w, s, p521_r2_order);
+    sp_521_mont_inv_order_avx2_9(w, w);
+    /* u1 = e.w, u2 = r.w */
+    sp_521_mont_mul_order_avx2_9(u1, e, w);
+    sp_521_norm_mod_9(u1, p521_order);
+    sp_521_mont_mul_order_avx2_9(u2, r, w);
+    sp_521_norm_mod_9(u2, p521_order);
+
+    /* u1.G + u2.Q */
+    if (sp_521_iszero_9(u1)) {
+        sp_521_point_set_inf_9(&p1);
+    }
+    else {
+        sp_521_ecc_mulmod_base_avx2_9(&p1, u1, 0);
+    }
+    sp_521_ecc_mulmod_avx2_9(&p2, q, u2, 0);
+    sp_521_proj_point_add_avx2_9(&p1, &p1, &p2);
+    if (p1.infinity) {
+        return 0;
+    }
+
+    /* x mod order == r */
+    sp_521_map_avx2_9(&p1, &p1);
+    sp_521_norm_mod_9(p1.x, p521_order);
+    return sp_521_cmp_9(p1.x, r) == 0;
+}
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Multiply the base point of P521 by the scalar and return the result.
+ * If map is true then convert result to affine coordinates.
+ *
+ * km    Scalar to multiply by.
+ * r     Resulting point.
+ * map   Indicates whether to convert result to affine.
+ * heap  Heap to use for allocation.
+ * returns ECC_OUT_OF_RANGE_E when the scalar is larger than 521 bits,
+ * ECC_INF_E when the scalar is a multiple of the order and MP_OKAY on
+ * success.
+ */
+int sp_ecc_mulmod_base_521(const mp_int* km, ecc_point* r, int map, void* heap)
+{
+    sp_point_521 point;
+    sp_digit k[9];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(km) > 521) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_521_from_mp(k, 9, km);
+        sp_521_norm_mod_9(k, p521_order);
+        if (sp_521_iszero_9(k)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_521_ecc_mulmod_base_avx2_9(&point, k, map);
+        else
+#endif
+            sp_521_ecc_mulmod_base_9(&point, k, map);
+        if (!map) {
+            sp_521_point_from_mont_9(&point);
+        }
+        err = sp_521_point_to_ecc_point_9(&point, r);
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Multiply the point by the scalar and serialize the X ordinate.
+ * The number is 0 padded to maximum size on output.
+ *
+ * priv    Scalar to multiply the point by.
+ * pub     Point to multiply.
+ * out     Buffer to hold X ordinate.
+ * outLen  On entry, size of the buffer in bytes.
+ *         On exit, length of data in buffer in bytes.
+ * heap    Heap to use for allocation.
+ * returns BUFFER_E if the buffer is to small for output size,
+ * ECC_OUT_OF_RANGE_E when the scalar is larger than 521 bits, ECC_INF_E when
+ * a point is at infinity and MP_OKAY on success.
+ */
+int sp_ecc_secret_gen_521(const mp_int* priv, const ecc_point* pub, byte* out,
+                          word32* outLen, void* heap)
+{
+    sp_point_521 point;
+    sp_digit k[9];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (*outLen < 66U) {
+        err = BUFFER_E;
+    }
+    else if (mp_count_bits(priv) > 521) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_521_from_mp(k, 9, priv);
+        sp_521_norm_mod_9(k, p521_order);
+        sp_521_point_from_ecc_point_9(&point, pub);
+        if (sp_521_iszero_9(k) || sp_521_iszero_9(point.z)) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_521_point_to_mont_9(&point);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            sp_521_ecc_mulmod_avx2_9(&point, &point, k, 1);
+        else
+#endif
+            sp_521_ecc_mulmod_9(&point, &point, k, 1);
+        if (point.infinity) {
+            err = ECC_INF_E;
+        }
+    }
+    if (err == MP_OKAY) {
+        sp_521_to_bin_9(point.x, out);
+        *outLen = 66;
+    }
+
+    ForceZero(k, sizeof(k));
+    ForceZero(&point, sizeof(point));
+
+    return err;
+}
+
+/* Sign the hash using the private key.
+ *   e = [hash, 521 bits] from binary
+ *   r = (k.G)->x mod order
+ *   s = (r * x + e) / k mod order
+ * The hash is truncated to the first 521 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * rng      Random number generator.
+ * priv     Private part of key - scalar.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * km       Optional fixed k, zeroized once used.
+ * heap     Heap to use for allocation.
+ * returns RNG failures, ECC_OUT_OF_RANGE_E when the private key is larger
+ * than 521 bits and MP_OKAY on success.
+ */
+int sp_ecc_sign_521(const byte* hash, word32 hashLen, WC_RNG* rng,
+                    const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+                    void* heap)
+{
+    sp_digit e[9];
+    sp_digit d[9];
+    sp_digit r[9];
+    sp_digit s[9];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    if (mp_count_bits(priv) > 521) {
+        err = ECC_OUT_OF_RANGE_E;
+    }
+
+    if (err == MP_OKAY) {
+        if (hashLen > 66U) {
+            hashLen = 66U;
+        }
+        sp_521_from_bin(e, 9, hash, (int)hashLen);
+        if (hashLen == 66U) {
+            sp_521_rshift_9(e, e, 7);
+        }
+        sp_521_norm_mod_9(e, p521_order);
+        sp_521_from_mp(d, 9, priv);
+
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            err = sp_521_ecc_sign_avx2_9(e, d, rng, km, r, s);
+        else
+#endif
+            err = sp_521_ecc_sign_9(e, d, rng, km, r, s);
+    }
+    if (err == MP_OKAY) {
+        err = sp_521_to_mp(r, rm);
+    }
+    if (err == MP_OKAY) {
+        err = sp_521_to_mp(s, sm);
+    }
+
+    ForceZero(d, sizeof(d));
+    ForceZero(e, sizeof(e));
+
+    return err;
+}
+
+/* Verify the signature values with the hash and public key.
+ *   e = Truncate(hash, 521)
+ *   u1 = e/s mod order
+ *   u2 = r/s mod order
+ *   r == (u1.G + u2.Q)->x mod order
+ * The hash is truncated to the first 521 bits.
+ *
+ * hash     Hash to sign.
+ * hashLen  Length of the hash data.
+ * pX       X ordinate of the public key.
+ * pY       Y ordinate of the public key.
+ * pZ       Z ordinate of the public key.
+ * rm       First part of result as an mp_int.
+ * sm       Second part of result as an mp_int.
+ * res      1 when the signature is valid and 0 otherwise.
+ * heap     Heap to use for allocation.
+ * returns ECC_INF_E when the public key is at infinity and MP_OKAY on
+ * success, including when the signature is not valid.
+ */
+int sp_ecc_verify_521(const byte* hash, word32 hashLen, const mp_int* pX,
+    const mp_int* pY, const mp_int* pZ, const mp_int* rm, const mp_int* sm,
+    int* res, void* heap)
+{
+    sp_point_521 q;
+    sp_digit e[9];
+    sp_digit r[9];
+    sp_digit s[9];
+    int err = MP_OKAY;
+#ifdef HAVE_INTEL_AVX2
+    word32 cpuid_flags = cpuid_get_flags();
+#endif
+
+    (void)heap;
+
+    *res = 0;
+
+    /* r and s must be between 1 and order - 1 */
+    if (mp_count_bits(rm) > 521 || mp_count_bits(sm) > 521) {
+        return MP_OKAY;
+    }
+    sp_521_from_mp(r, 9, rm);
+    sp_521_from_mp(s, 9, sm);
+    if (sp_521_iszero_9(r) || sp_521_iszero_9(s) ||
+            sp_521_cmp_9(r, p521_order) >= 0 ||
+            sp_521_cmp_9(s, p521_order) >= 0) {
+        return MP_OKAY;
+    }
+
+    if (hashLen > 66U) {
+        hashLen = 66U;
+    }
+    sp_521_from_bin(e, 9, hash, (int)hashLen);
+    if (hashLen == 66U) {
+        sp_521_rshift_9(e, e, 7);
+    }
+    sp_521_norm_mod_9(e, p521_order);
+
+    XMEMSET(q.x, 0, sizeof(q.x));
+    XMEMSET(q.y, 0, sizeof(q.y));
+    XMEMSET(q.z, 0, sizeof(q.z));
+    sp_521_from_mp(q.x, 9, pX);
+    sp_521_from_mp(q.y, 9, pY);
+    sp_521_from_mp(q.z, 9, pZ);
+    q.infinity = 0;
+    if (sp_521_iszero_9(q.z)) {
+        err = ECC_INF_E;
+    }
+
+    if (err == MP_OKAY) {
+        sp_521_point_to_mont_9(&q);
+#ifdef HAVE_INTEL_AVX2
+        if (IS_INTEL_BMI2(cpuid_flags) && IS_INTEL_ADX(cpuid_flags))
+            *res = sp_521_ecc_verify_avx2_9(e, &q, r, s);
+        else
+#endif
+            *res = sp_521_ecc_verify_9(e, &q, r, s);
+    }
+
+    return err;
+}
+
+#endif /* WOLFSSL_SP_521 */
+#endif /* WOLFSSL_HAVE_SP_ECC */
 #endif /* WOLFSSL_SP_X86_64_ASM */
 #endif /* WOLFSSL_HAVE_SP_RSA | WOLFSSL_HAVE_SP_DH | WOLFSSL_HAVE_SP_ECC */
@@ -1222,11 +1222,343 @@ top:
   return FP_OKAY;
 }
 
+#ifdef FP_64BIT
+/* Constant time inversion using divsteps (Bernstein-Yang "safegcd").
+ *
+ * Values are held in signed 62-bit limbs. Each batch runs 62 divsteps on the
+ * bottom limbs only, producing a 2x2 transition matrix scaled by 2^62, that is
+ * then applied to the full values. The number of divsteps depends only on the
+ * size of the modulus.
+ */
+#define FP_DS_BITS        62
+#define FP_DS_MASK        ((word64)0x3fffffffffffffffULL)
+/* Limbs needed for values in the range (-2b, b) of the largest modulus. */
+#define FP_DS_MAX_LIMBS   ((FP_MAX_BITS / 2) / FP_DS_BITS + 1)
+
+/* Transition matrix of 62 divsteps, scaled by 2^62. */
+typedef struct fp_ds_trans {
+  sword64 u, v;
+  sword64 q, r;
+} fp_ds_trans;
+
+/* Convert the bottom len*62 bits of a into limbs. */
+static void fp_ds_from_fp(sword64* r, int len, fp_int* a)
+{
+  int i, w, o;
+  word64 v;
+
+  for (i = 0; i < len; i++) {
+    w = (i * FP_DS_BITS) / DIGIT_BIT;
+    o = (i * FP_DS_BITS) % DIGIT_BIT;
+    v = (w < a->used) ? (word64)(a->dp[w] >> o) : 0;
+    if ((o > DIGIT_BIT - FP_DS_BITS) && (w + 1 < a->used)) {
+      v |= (word64)(a->dp[w + 1] << (DIGIT_BIT - o));
+    }
+    r[i] = (sword64)(v & FP_DS_MASK);
+  }
+}
+
+/* Convert normalized limbs back into an fp_int. */
+static void fp_ds_to_fp(fp_int* r, const sword64* a, int len)
+{
+  int i, w, o;
+
+  fp_zero(r);
+  for (i = 0; i < len; i++) {
+    w = (i * FP_DS_BITS) / DIGIT_BIT;
+    o = (i * FP_DS_BITS) % DIGIT_BIT;
+    r->dp[w] |= (fp_digit)a[i] << o;
+    if (o > DIGIT_BIT - FP_DS_BITS) {
+      r->dp[w + 1] |= (fp_digit)a[i] >> (DIGIT_BIT - o);
+    }
+  }
+  r->used = (len * FP_DS_BITS + DIGIT_BIT - 1) / DIGIT_BIT;
+  fp_clamp(r);
+}
+
+/* 62 divsteps on the bottom bits of f and g.
+ *
+ * eta is -delta. Returns the new eta.
+ */
+static sword64 fp_ds_divsteps(sword64 eta, word64 f, word64 g, fp_ds_trans* t)
+{
+  word64 u = 1, v = 0, q = 0, r = 1;
+  word64 c1, c2, x, y, z;
+  int i;
+
+  for (i = 0; i < FP_DS_BITS; i++) {
+    /* c1 all set when eta < 0, c2 all set when g is odd */
+    c1 = (word64)(eta >> 63);
+    c2 = (word64)0 - (g & 1);
+    /* g odd: g = g - f when eta < 0, otherwise g = g + f */
+    x = (f ^ c1) - c1;
+    y = (u ^ c1) - c1;
+    z = (v ^ c1) - c1;
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+    /* Swap when eta < 0 and g odd: f = old g and eta = -eta - 1 */
+    c1 &= c2;
+    eta = (eta ^ (sword64)c1) - ((sword64)c1 + 1);
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+  t->u = (sword64)u;
+  t->v = (sword64)v;
+  t->q = (sword64)q;
+  t->r = (sword64)r;
+
+  return eta;
+}
+
+/* [f, g] = t * [f, g] / 2^62 - division is exact. */
+static void fp_ds_update_fg(sword64* f, sword64* g, int len,
+                            const fp_ds_trans* t)
+{
+  fp_sword cf, cg;
+  int i;
+
+  cf = (fp_sword)t->u * f[0] + (fp_sword)t->v * g[0];
+  cg = (fp_sword)t->q * f[0] + (fp_sword)t->r * g[0];
+  cf >>= FP_DS_BITS;
+  cg >>= FP_DS_BITS;
+  for (i = 1; i < len; i++) {
+    cf += (fp_sword)t->u * f[i] + (fp_sword)t->v * g[i];
+    cg += (fp_sword)t->q * f[i] + (fp_sword)t->r * g[i];
+    f[i - 1] = (sword64)((word64)cf & FP_DS_MASK);
+    g[i - 1] = (sword64)((word64)cg & FP_DS_MASK);
+    cf >>= FP_DS_BITS;
+    cg >>= FP_DS_BITS;
+  }
+  f[len - 1] = (sword64)cf;
+  g[len - 1] = (sword64)cg;
+}
+
+/* [d, e] = (t * [d, e] + m * [md, me]) / 2^62 with md and me chosen to make
+ * the division exact. Keeps d and e in the range (-2m, m).
+ */
+static void fp_ds_update_de(sword64* d, sword64* e, int len,
+                            const fp_ds_trans* t, const sword64* m,
+                            word64 mInv)
+{
+  sword64 sd, se, md, me;
+  fp_sword cd, ce;
+  int i;
+
+  /* Add in m times the matrix entries applied to negative values. */
+  sd = d[len - 1] >> 63;
+  se = e[len - 1] >> 63;
+  md = (t->u & sd) + (t->v & se);
+  me = (t->q & sd) + (t->r & se);
+  cd = (fp_sword)t->u * d[0] + (fp_sword)t->v * e[0];
+  ce = (fp_sword)t->q * d[0] + (fp_sword)t->r * e[0];
+  /* Subtract enough multiples of m to clear the bottom 62 bits. */
+  md -= (sword64)((mInv * (word64)cd + (word64)md) & FP_DS_MASK);
+  me -= (sword64)((mInv * (word64)ce + (word64)me) & FP_DS_MASK);
+  cd += (fp_sword)m[0] * md;
+  ce += (fp_sword)m[0] * me;
+  cd >>= FP_DS_BITS;
+  ce >>= FP_DS_BITS;
+  for (i = 1; i < len; i++) {
+    cd += (fp_sword)t->u * d[i] + (fp_sword)t->v * e[i];
+    ce += (fp_sword)t->q * d[i] + (fp_sword)t->r * e[i];
+    cd += (fp_sword)m[i] * md;
+    ce += (fp_sword)m[i] * me;
+    d[i - 1] = (sword64)((word64)cd & FP_DS_MASK);
+    e[i - 1] = (sword64)((word64)ce & FP_DS_MASK);
+    cd >>= FP_DS_BITS;
+    ce >>= FP_DS_BITS;
+  }
+  d[len - 1] = (sword64)cd;
+  e[len - 1] = (sword64)ce;
+}
+
+/* Carry each limb into the next so that all but the top are in [0, 2^62). */
+static void fp_ds_carry(sword64* a, int len)
+{
+  int i;
+
+  for (i = 0; i < len - 1; i++) {
+    a[i + 1] += a[i] >> FP_DS_BITS;
+    a[i] &= (sword64)FP_DS_MASK;
+  }
+}
+
+/* Negate a when neg is all set. */
+static void fp_ds_cond_neg(sword64* a, int len, sword64 neg)
+{
+  int i;
+
+  for (i = 0; i < len; i++) {
+    a[i] = (a[i] ^ neg) - neg;
+  }
+  fp_ds_carry(a, len);
+}
+
+/* Add m to a when a is negative. */
+static void fp_ds_add_if_neg(sword64* a, const sword64* m, int len)
+{
+  sword64 neg = a[len - 1] >> 63;
+  int i;
+
+  for (i = 0; i < len; i++) {
+    a[i] += m[i] & neg;
+  }
+  fp_ds_carry(a, len);
+}
+
+/* c = 1/a (mod b) - constant time using divsteps. b must be odd. */
+static int fp_invmod_ds(fp_int *a, fp_int *b, fp_int *c)
+{
+  sword64 f[FP_DS_MAX_LIMBS], g[FP_DS_MAX_LIMBS];
+  sword64 d[FP_DS_MAX_LIMBS], e[FP_DS_MAX_LIMBS];
+  sword64 m[FP_DS_MAX_LIMBS];
+  sword64 eta = -1;
+  sword64 fNeg, bad;
+  fp_ds_trans t;
+  word64 mInv;
+  int bits, len, steps, i;
+
+  bits = fp_count_bits(b);
+  len = bits / FP_DS_BITS + 1;
+  if (len > FP_DS_MAX_LIMBS) {
+    return FP_VAL;
+  }
+
+  fp_ds_from_fp(m, len, b);
+  fp_ds_from_fp(g, len, a);
+  XMEMCPY(f, m, sizeof(sword64) * len);
+  XMEMSET(d, 0, sizeof(sword64) * len);
+  XMEMSET(e, 0, sizeof(sword64) * len);
+  e[0] = 1;
+
+  /* 1/m mod 2^64 - Newton's iteration doubles the correct bits each time. */
+  mInv = (word64)m[0];
+  for (i = 0; i < 5; i++) {
+    mInv *= (word64)2 - (word64)m[0] * mInv;
+  }
+
+  /* Bound on divsteps for values of this size (Bernstein-Yang Thm 11.2). */
+  steps = (49 * bits + ((bits < 46) ? 57 : 80) + 16) / 17;
+  for (i = 0; i < steps; i += FP_DS_BITS) {
+    eta = fp_ds_divsteps(eta, (word64)f[0], (word64)g[0], &t);
+    fp_ds_update_de(d, e, len, &t, m, mInv);
+    fp_ds_update_fg(f, g, len, &t);
+  }
+
+  /* g is 0 and f is +/-gcd(a, b) - only invertible when gcd is 1. */
+  fNeg = f[len - 1] >> 63;
+  fp_ds_cond_neg(f, len, fNeg);
+  bad = f[0] ^ 1;
+  for (i = 1; i < len; i++) {
+    bad |= f[i];
+  }
+  for (i = 0; i < len; i++) {
+    bad |= g[i];
+  }
+  if (bad != 0) {
+    return FP_VAL;
+  }
+
+  /* 1/a = d * f: (-2b, b) -> (-b, b) -> [0, b) */
+  fp_ds_add_if_neg(d, m, len);
+  fp_ds_cond_neg(d, len, fNeg);
+  fp_ds_add_if_neg(d, m, len);
+  fp_ds_to_fp(c, d, len);
+
+  return FP_OKAY;
+}
+#endif /* FP_64BIT */
+
+/* c = 1/a (mod b) - constant time. Modulus (b) must be an odd prime. */
+int fp_invmod_ct(fp_int *a, fp_int *b, fp_int *c)
+{
+  int err = FP_OKAY;
+  fp_int t[1];
+
+  if (b->sign == FP_NEG || fp_iseven(b) == FP_YES ||
+      fp_cmp_d(b, 2) != FP_GT) {
+    return FP_VAL;
+  }
+
+  fp_init(t);
+  if (a->sign == FP_NEG || fp_cmp(a, b) != FP_LT) {
+    err = fp_mod(a, b, t);
+  }
+  else {
+    fp_copy(a, t);
+  }
+  if (err == FP_OKAY && fp_iszero(t) == FP_YES) {
+    err = FP_VAL;
+  }
+#ifdef FP_64BIT
+  if (err == FP_OKAY) {
+    err = fp_invmod_ds(t, b, c);
+  }
+#else
+  /* Fermat: 1/a = a^(b-2) mod b */
+  if (err == FP_OKAY) {
+    fp_int e[1];
+
+    fp_init(e);
+    err = fp_sub_d(b, 2, e);
+    if (err == FP_OKAY) {
+      err = fp_exptmod(t, e, b, c);
+    }
+  }
+#endif
+
+  return err;
+}
+
 #define CT_INV_MOD_PRE_CNT      8
 
 /* modulus (b) must be greater than 2 and a prime */
 int fp_invmod_mont_ct(fp_int *a, fp_int *b, fp_int *c, fp_digit mp)
 {
+#ifdef FP_64BIT
+  int err;
+  fp_int t[1], n[1];
+
+  if ((a->used * 2 > FP_SIZE) || (b->used * 2 > FP_SIZE)) {
+    return FP_VAL;
+  }
+
+  /* 1/(aR) -> 1/a -> R/a: out of Montgomery form, invert, multiply by R^2 */
+  fp_init(t);
+  fp_init(n);
+  fp_copy(a, t);
+  err = fp_montgomery_reduce(t, b, mp);
+  if (err == FP_OKAY && fp_cmp(t, b) != FP_LT) {
+    err = fp_mod(t, b, t);
+  }
+  /* 0 mod b has no inverse - result is 0 as with exponentiation. */
+  if (err == FP_OKAY && fp_iszero(t) == FP_YES) {
+    fp_zero(c);
+    return FP_OKAY;
+  }
+  if (err == FP_OKAY) {
+    err = fp_invmod_ct(t, b, t);
+  }
+  if (err == FP_OKAY) {
+    err = fp_montgomery_calc_normalization(n, b);
+  }
+  if (err == FP_OKAY) {
+    err = fp_sqrmod(n, b, n);
+  }
+  if (err == FP_OKAY) {
+    err = fp_mul(t, n, c);
+  }
+  if (err == FP_OKAY) {
+    err = fp_montgomery_reduce(c, b, mp);
+  }
+
+  return err;
+#else
   int i, j, err = FP_OKAY;
   fp_int t[1], e[1];
   fp_int pre[CT_INV_MOD_PRE_CNT];
@@ -1280,6 +1612,7 @@ int fp_invmod_mont_ct(fp_int *a, fp_int *b, fp_int *c, fp_digit mp)
 
 
   return err;
+#endif /* FP_64BIT */
 }
 
 /* d = a * b (mod c) */
@@ -3808,6 +4141,12 @@ int mp_invmod_mont_ct (mp_int * a, mp_int * b, mp_int * c, mp_digit mp)
   return fp_invmod_mont_ct(a, b, c, mp);
 }
 
+/* c = 1/a (mod b) - constant time, b an odd prime */
+int mp_invmod_ct (mp_int * a, mp_int * b, mp_int * c)
+{
+  return fp_invmod_ct(a, b, c);
+}
+
 /* this is a shell function that calls either the normal or Montgomery
  * exptmod functions.  Originally the call to the montgomery code was
  * embedded in the normal function but that wasted a lot of stack space
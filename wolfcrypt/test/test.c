@@ -246,6 +246,9 @@
 #include <wolfssl/wolfcrypt/error-crypt.h>
 #ifdef HAVE_ECC
     #include <wolfssl/wolfcrypt/ecc.h>
+    #ifdef WOLFSSL_SP_X86_64_ASM
+        #include <wolfssl/wolfcrypt/cpuid.h>
+    #endif
 #endif
 #ifdef HAVE_CURVE25519
     #include <wolfssl/wolfcrypt/curve25519.h>
@@ -12202,6 +12205,94 @@ done:
     return ret;
 }
 
+#if defined(WOLFSSL_LAZY_CERT_DECODE) && !defined(NO_FILESYSTEM)
+/* Parse a certificate eagerly and lazily and check that the lazy parse leaves
+ * the deferred parts undecoded. */
+static int cert_lazy_test_der(byte* der, word32 derSz)
+{
+    int ret;
+    DecodedCert eager;
+    DecodedCert lazy;
+
+    InitDecodedCert(&eager, der, derSz, 0);
+    InitDecodedCert(&lazy, der, derSz, 0);
+    lazy.decodeLazy = 1;
+    ret = ParseCert(&eager, CERT_TYPE, NO_VERIFY, NULL);
+    if (ret != 0) {
+        ERROR_OUT(-7408, done);
+    }
+    ret = ParseCert(&lazy, CERT_TYPE, NO_VERIFY, NULL);
+    if (ret != 0) {
+        ERROR_OUT(-7409, done);
+    }
+
+    /* Only the issuer hash is there until the rest is asked for. */
+    if (lazy.lazyExtPending == 0 || lazy.altNames != NULL ||
+            lazy.extCrlInfo != NULL || lazy.extExtKeyUsage != 0 ||
+            (lazy.issuer != NULL && lazy.issuer[0] != '\0')) {
+        ERROR_OUT(-7410, done);
+    }
+    if (XMEMCMP(lazy.issuerHash, eager.issuerHash, KEYID_SIZE) != 0) {
+        ERROR_OUT(-7411, done);
+    }
+
+    /* A malformed deferred extension doesn't fail the lazy parse. */
+    if (eager.altNames != NULL) {
+        der[lazy.lazyExtIdx[CERT_LAZY_ALT_NAMES]] = ASN_OCTET_STRING;
+        FreeDecodedCert(&eager);
+        FreeDecodedCert(&lazy);
+        InitDecodedCert(&eager, der, derSz, 0);
+        InitDecodedCert(&lazy, der, derSz, 0);
+        lazy.decodeLazy = 1;
+        if (ParseCert(&eager, CERT_TYPE, NO_VERIFY, NULL) == 0) {
+            ERROR_OUT(-7412, done);
+        }
+        ret = ParseCert(&lazy, CERT_TYPE, NO_VERIFY, NULL);
+        if (ret != 0) {
+            ERROR_OUT(-7413, done);
+        }
+    }
+
+done:
+    FreeDecodedCert(&lazy);
+    FreeDecodedCert(&eager);
+    return ret;
+}
+
+static int cert_lazy_test(void)
+{
+    int   ret = 0;
+    int   i;
+    byte* tmp;
+    size_t bytes;
+    XFILE file;
+    static const char* certs[] = {
+        CERT_ROOT "server-cert.der",
+        CERT_ROOT "test" CERT_PATH_SEP "cert-ext-multiple.der",
+    };
+
+    tmp = (byte*)XMALLOC(FOURK_BUF, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (tmp == NULL)
+        return -7414;
+
+    for (i = 0; i < (int)(sizeof(certs) / sizeof(*certs)); i++) {
+        file = XFOPEN(certs[i], "rb");
+        if (!file) {
+            ERROR_OUT(-7415, done);
+        }
+        bytes = XFREAD(tmp, 1, FOURK_BUF, file);
+        XFCLOSE(file);
+        ret = cert_lazy_test_der(tmp, (word32)bytes);
+        if (ret != 0)
+            break;
+    }
+
+done:
+    XFREE(tmp, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    return ret;
+}
+#endif /* WOLFSSL_LAZY_CERT_DECODE && !NO_FILESYSTEM */
+
 WOLFSSL_TEST_SUBROUTINE int cert_test(void)
 {
 #if !defined(NO_FILESYSTEM)
@@ -12270,6 +12361,10 @@ done:
 
     if (ret == 0)
         ret = cert_asn1_test();
+#if defined(WOLFSSL_LAZY_CERT_DECODE) && !defined(NO_FILESYSTEM)
+    if (ret == 0)
+        ret = cert_lazy_test();
+#endif
 
     return ret;
 }
@@ -22121,6 +22216,366 @@ done:
 #endif /* HAVE_ECC_CDH */
 #endif /* HAVE_ECC_VECTOR_TEST */
 
+#if (defined(WOLFSSL_SP_ECC_384) || defined(WOLFSSL_SP_ECC_521)) && \
+    defined(HAVE_ECC_SIGN) && !defined(WOLFSSL_ASYNC_CRYPT)
+#define HAVE_ECC_SP_VECTOR_TEST
+
+/* SHA-256("sample") */
+static const byte ecc_sp_hash[] = {
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf
+};
+
+#ifdef WOLFSSL_SP_ECC_384
+/* RFC 6979 A.2.6 key, SHA-256 "sample" signature */
+static const byte ecc_sp384_d[] = {
+    0x6b, 0x9d, 0x3d, 0xad, 0x2e, 0x1b, 0x8c, 0x1c,
+    0x05, 0xb1, 0x98, 0x75, 0xb6, 0x65, 0x9f, 0x4d,
+    0xe2, 0x3c, 0x3b, 0x66, 0x7b, 0xf2, 0x97, 0xba,
+    0x9a, 0xa4, 0x77, 0x40, 0x78, 0x71, 0x37, 0xd8,
+    0x96, 0xd5, 0x72, 0x4e, 0x4c, 0x70, 0xa8, 0x25,
+    0xf8, 0x72, 0xc9, 0xea, 0x60, 0xd2, 0xed, 0xf5
+};
+static const byte ecc_sp384_pub[] = {
+    0x04, 0xec, 0x3a, 0x4e, 0x41, 0x5b, 0x4e, 0x19,
+    0xa4, 0x56, 0x86, 0x18, 0x02, 0x9f, 0x42, 0x7f,
+    0xa5, 0xda, 0x9a, 0x8b, 0xc4, 0xae, 0x92, 0xe0,
+    0x2e, 0x06, 0xaa, 0xe5, 0x28, 0x6b, 0x30, 0x0c,
+    0x64, 0xde, 0xf8, 0xf0, 0xea, 0x90, 0x55, 0x86,
+    0x60, 0x64, 0xa2, 0x54, 0x51, 0x54, 0x80, 0xbc,
+    0x13, 0x80, 0x15, 0xd9, 0xb7, 0x2d, 0x7d, 0x57,
+    0x24, 0x4e, 0xa8, 0xef, 0x9a, 0xc0, 0xc6, 0x21,
+    0x89, 0x67, 0x08, 0xa5, 0x93, 0x67, 0xf9, 0xdf,
+    0xb9, 0xf5, 0x4c, 0xa8, 0x4b, 0x3f, 0x1c, 0x9d,
+    0xb1, 0x28, 0x8b, 0x23, 0x1c, 0x3a, 0xe0, 0xd4,
+    0xfe, 0x73, 0x44, 0xfd, 0x25, 0x33, 0x26, 0x47,
+    0x20
+};
+static const byte ecc_sp384_k[] = {
+    0x18, 0x0a, 0xe9, 0xf9, 0xae, 0xc5, 0x43, 0x8a,
+    0x44, 0xbc, 0x15, 0x9a, 0x1f, 0xcb, 0x27, 0x7c,
+    0x7b, 0xe5, 0x4f, 0xa2, 0x0e, 0x7c, 0xf4, 0x04,
+    0xb4, 0x90, 0x65, 0x0a, 0x8a, 0xcc, 0x41, 0x4e,
+    0x37, 0x55, 0x72, 0x34, 0x28, 0x63, 0xc8, 0x99,
+    0xf9, 0xf2, 0xed, 0xf9, 0x74, 0x7a, 0x9b, 0x60
+};
+static const byte ecc_sp384_r[] = {
+    0x21, 0xb1, 0x3d, 0x1e, 0x01, 0x3c, 0x7f, 0xa1,
+    0x39, 0x2d, 0x03, 0xc5, 0xf9, 0x9a, 0xf8, 0xb3,
+    0x0c, 0x57, 0x0c, 0x6f, 0x98, 0xd4, 0xea, 0x8e,
+    0x35, 0x4b, 0x63, 0xa2, 0x1d, 0x3d, 0xaa, 0x33,
+    0xbd, 0xe1, 0xe8, 0x88, 0xe6, 0x33, 0x55, 0xd9,
+    0x2f, 0xa2, 0xb3, 0xc3, 0x6d, 0x8f, 0xb2, 0xcd
+};
+static const byte ecc_sp384_s[] = {
+    0xf3, 0xaa, 0x44, 0x3f, 0xb1, 0x07, 0x74, 0x5b,
+    0xf4, 0xbd, 0x77, 0xcb, 0x38, 0x91, 0x67, 0x46,
+    0x32, 0x06, 0x8a, 0x10, 0xca, 0x67, 0xe3, 0xd4,
+    0x5d, 0xb2, 0x26, 0x6f, 0xa7, 0xd1, 0xfe, 0xeb,
+    0xef, 0xdc, 0x63, 0xec, 0xcd, 0x1a, 0xc4, 0x2e,
+    0xc0, 0xcb, 0x86, 0x68, 0xa4, 0xfa, 0x0a, 0xb0
+};
+/* Peer public key and shared secret (x coordinate of d * peer) */
+static const byte ecc_sp384_peer[] = {
+    0x04, 0xbd, 0xff, 0xf4, 0xe9, 0x22, 0x29, 0x15,
+    0x30, 0x65, 0xbb, 0x9b, 0xd2, 0xa2, 0x80, 0x99,
+    0x2c, 0xce, 0xd9, 0x27, 0xad, 0xbf, 0xf5, 0x3d,
+    0x75, 0xb2, 0x42, 0x41, 0x50, 0xec, 0x7d, 0x61,
+    0x7d, 0x13, 0x5d, 0xb1, 0x4e, 0xe1, 0x81, 0x02,
+    0x6c, 0xda, 0xd2, 0xc7, 0xfa, 0x6b, 0x2d, 0x27,
+    0xef, 0xbd, 0x26, 0x77, 0x49, 0x95, 0xb2, 0xb6,
+    0x28, 0xb2, 0x99, 0x13, 0x1a, 0xf8, 0x9c, 0x4b,
+    0x55, 0x7d, 0xc6, 0x0a, 0x2c, 0x5f, 0xfa, 0x64,
+    0x7d, 0x9e, 0x39, 0x06, 0x38, 0x26, 0x6d, 0x7a,
+    0xf8, 0x59, 0x48, 0x9c, 0x85, 0x41, 0xa7, 0xb9,
+    0xc0, 0xf0, 0xbf, 0xd9, 0xd2, 0xe2, 0x15, 0x21,
+    0x33
+};
+static const byte ecc_sp384_z[] = {
+    0xbd, 0x38, 0xc1, 0xe4, 0xac, 0xa6, 0x16, 0xcd,
+    0xec, 0x62, 0xdd, 0x61, 0xb5, 0xda, 0x61, 0xd0,
+    0xd5, 0x3e, 0xe2, 0x78, 0x38, 0x71, 0xf8, 0x21,
+    0xb4, 0x4f, 0xc2, 0x34, 0x28, 0x3b, 0x45, 0xda,
+    0x4d, 0x00, 0x84, 0xc5, 0x0a, 0xbc, 0x35, 0x38,
+    0x6c, 0x8b, 0x55, 0x9c, 0x58, 0xc6, 0x82, 0x99
+};
+#endif /* WOLFSSL_SP_ECC_384 */
+
+#ifdef WOLFSSL_SP_ECC_521
+/* RFC 6979 A.2.7 key, SHA-256 "sample" signature */
+static const byte ecc_sp521_d[] = {
+    0x00, 0xfa, 0xd0, 0x6d, 0xaa, 0x62, 0xba, 0x3b,
+    0x25, 0xd2, 0xfb, 0x40, 0x13, 0x3d, 0xa7, 0x57,
+    0x20, 0x5d, 0xe6, 0x7f, 0x5b, 0xb0, 0x01, 0x8f,
+    0xee, 0x8c, 0x86, 0xe1, 0xb6, 0x8c, 0x7e, 0x75,
+    0xca, 0xa8, 0x96, 0xeb, 0x32, 0xf1, 0xf4, 0x7c,
+    0x70, 0x85, 0x58, 0x36, 0xa6, 0xd1, 0x6f, 0xcc,
+    0x14, 0x66, 0xf6, 0xd8, 0xfb, 0xec, 0x67, 0xdb,
+    0x89, 0xec, 0x0c, 0x08, 0xb0, 0xe9, 0x96, 0xb8,
+    0x35, 0x38
+};
+static const byte ecc_sp521_pub[] = {
+    0x04, 0x01, 0x89, 0x45, 0x50, 0xd0, 0x78, 0x59,
+    0x32, 0xe0, 0x0e, 0xaa, 0x23, 0xb6, 0x94, 0xf2,
+    0x13, 0xf8, 0xc3, 0x12, 0x1f, 0x86, 0xdc, 0x97,
+    0xa0, 0x4e, 0x5a, 0x71, 0x67, 0xdb, 0x4e, 0x5b,
+    0xcd, 0x37, 0x11, 0x23, 0xd4, 0x6e, 0x45, 0xdb,
+    0x6b, 0x5d, 0x53, 0x70, 0xa7, 0xf2, 0x0f, 0xb6,
+    0x33, 0x15, 0x5d, 0x38, 0xff, 0xa1, 0x6d, 0x2b,
+    0xd7, 0x61, 0xdc, 0xac, 0x47, 0x4b, 0x9a, 0x2f,
+    0x50, 0x23, 0xa4, 0x00, 0x49, 0x31, 0x01, 0xc9,
+    0x62, 0xcd, 0x4d, 0x2f, 0xdd, 0xf7, 0x82, 0x28,
+    0x5e, 0x64, 0x58, 0x41, 0x39, 0xc2, 0xf9, 0x1b,
+    0x47, 0xf8, 0x7f, 0xf8, 0x23, 0x54, 0xd6, 0x63,
+    0x0f, 0x74, 0x6a, 0x28, 0xa0, 0xdb, 0x25, 0x74,
+    0x1b, 0x5b, 0x34, 0xa8, 0x28, 0x00, 0x8b, 0x22,
+    0xac, 0xc2, 0x3f, 0x92, 0x4f, 0xaa, 0xfb, 0xd4,
+    0xd3, 0x3f, 0x81, 0xea, 0x66, 0x95, 0x6d, 0xfe,
+    0xaa, 0x2b, 0xfd, 0xfc, 0xf5
+};
+static const byte ecc_sp521_k[] = {
+    0x00, 0xed, 0xf3, 0x8a, 0xfc, 0xaa, 0xec, 0xab,
+    0x43, 0x83, 0x35, 0x8b, 0x34, 0xd6, 0x7c, 0x9f,
+    0x22, 0x16, 0xc8, 0x38, 0x2a, 0xae, 0xa4, 0x4a,
+    0x3d, 0xad, 0x5f, 0xdc, 0x9c, 0x32, 0x57, 0x57,
+    0x61, 0x79, 0x3f, 0xef, 0x24, 0xeb, 0x0f, 0xc2,
+    0x76, 0xdf, 0xc4, 0xf6, 0xe3, 0xec, 0x47, 0x67,
+    0x52, 0xf0, 0x43, 0xcf, 0x01, 0x41, 0x53, 0x87,
+    0x47, 0x0b, 0xcb, 0xd8, 0x67, 0x8e, 0xd2, 0xc7,
+    0xe1, 0xa0
+};
+static const byte ecc_sp521_r[] = {
+    0x01, 0x51, 0x1b, 0xb4, 0xd6, 0x75, 0x11, 0x4f,
+    0xe2, 0x66, 0xfc, 0x43, 0x72, 0xb8, 0x76, 0x82,
+    0xba, 0xec, 0xc0, 0x1d, 0x3c, 0xc6, 0x2c, 0xf2,
+    0x30, 0x3c, 0x92, 0xb3, 0x52, 0x60, 0x12, 0x65,
+    0x9d, 0x16, 0x87, 0x6e, 0x25, 0xc7, 0xc1, 0xe5,
+    0x76, 0x48, 0xf2, 0x3b, 0x73, 0x56, 0x4d, 0x67,
+    0xf6, 0x1c, 0x6f, 0x14, 0xd5, 0x27, 0xd5, 0x49,
+    0x72, 0x81, 0x04, 0x21, 0xe7, 0xd8, 0x75, 0x89,
+    0xe1, 0xa7
+};
+static const byte ecc_sp521_s[] = {
+    0x00, 0x4a, 0x17, 0x11, 0x43, 0xa8, 0x31, 0x63,
+    0xd6, 0xdf, 0x46, 0x0a, 0xaf, 0x61, 0x52, 0x26,
+    0x95, 0xf2, 0x07, 0xa5, 0x8b, 0x95, 0xc0, 0x64,
+    0x4d, 0x87, 0xe5, 0x2a, 0xa1, 0xa3, 0x47, 0x91,
+    0x6e, 0x4f, 0x7a, 0x72, 0x93, 0x0b, 0x1b, 0xc0,
+    0x6d, 0xbe, 0x22, 0xce, 0x3f, 0x58, 0x26, 0x4a,
+    0xfd, 0x23, 0x70, 0x4c, 0xbb, 0x63, 0xb2, 0x9b,
+    0x93, 0x1f, 0x7d, 0xe6, 0xc9, 0xd9, 0x49, 0xa7,
+    0xec, 0xfc
+};
+/* Peer public key and shared secret (x coordinate of d * peer) */
+static const byte ecc_sp521_peer[] = {
+    0x04, 0x00, 0xe1, 0xf0, 0x02, 0x31, 0xe5, 0xd1,
+    0xed, 0xc1, 0xbd, 0x1c, 0xf0, 0x82, 0xd1, 0xba,
+    0xc5, 0x29, 0xb4, 0x24, 0x47, 0x51, 0xcb, 0x53,
+    0x27, 0xcb, 0x6f, 0xa4, 0x42, 0x5c, 0xdf, 0xd2,
+    0x7b, 0x08, 0x6e, 0x9e, 0x74, 0x91, 0x6e, 0x2a,
+    0x6d, 0xe7, 0xd1, 0x5f, 0x9f, 0x10, 0xa5, 0x06,
+    0xbe, 0x24, 0x85, 0xef, 0x65, 0xca, 0x9d, 0x49,
+    0xae, 0x8c, 0x27, 0xcb, 0xc2, 0x0d, 0x68, 0x09,
+    0x53, 0x9a, 0x8a, 0x01, 0x98, 0x10, 0xc0, 0x12,
+    0x40, 0x2d, 0xd7, 0x7e, 0x46, 0xc3, 0x1b, 0xbf,
+    0xce, 0xb5, 0x5b, 0xdc, 0x98, 0x6d, 0x0c, 0x3f,
+    0x4c, 0x03, 0x55, 0x59, 0x17, 0xf3, 0x4a, 0x11,
+    0xbb, 0x94, 0xc4, 0xee, 0x0c, 0x95, 0xac, 0xd8,
+    0xa1, 0xb1, 0x11, 0xfe, 0x5f, 0x7e, 0x8f, 0xb9,
+    0x9e, 0x6f, 0x3a, 0x30, 0x10, 0x9c, 0x1b, 0x5c,
+    0x92, 0xd1, 0x18, 0xb8, 0xaa, 0x81, 0x92, 0x92,
+    0x2b, 0x1d, 0x2e, 0x7d, 0x10
+};
+static const byte ecc_sp521_z[] = {
+    0x00, 0x88, 0x22, 0xc1, 0x2f, 0xbb, 0x4c, 0x28,
+    0xa0, 0xa1, 0x0c, 0x8c, 0xd4, 0x23, 0xef, 0xc8,
+    0x9b, 0xa9, 0xb3, 0x2f, 0x01, 0x66, 0xd0, 0xab,
+    0x18, 0x96, 0xcd, 0x1a, 0x6a, 0x72, 0x15, 0x29,
+    0xf8, 0x95, 0x07, 0x27, 0xd3, 0x19, 0xde, 0xda,
+    0x21, 0xfc, 0x98, 0x44, 0x0a, 0xd7, 0x77, 0x0a,
+    0xf9, 0x5a, 0x3a, 0x56, 0x17, 0x76, 0x1f, 0xae,
+    0x13, 0xad, 0xf9, 0xb5, 0xba, 0xae, 0x0b, 0xf6,
+    0xdb, 0x15
+};
+#endif /* WOLFSSL_SP_ECC_521 */
+
+typedef struct eccSpVector {
+    int         curveId;
+    word32      keySz;
+    const byte* d;
+    const byte* pub;
+    const byte* k;
+    const byte* r;
+    const byte* s;
+    const byte* peer;
+    const byte* z;
+} eccSpVector;
+
+static const eccSpVector ecc_sp_vectors[] = {
+#ifdef WOLFSSL_SP_ECC_384
+    { ECC_SECP384R1, 48, ecc_sp384_d, ecc_sp384_pub, ecc_sp384_k,
+      ecc_sp384_r, ecc_sp384_s, ecc_sp384_peer, ecc_sp384_z },
+#endif
+#ifdef WOLFSSL_SP_ECC_521
+    { ECC_SECP521R1, 66, ecc_sp521_d, ecc_sp521_pub, ecc_sp521_k,
+      ecc_sp521_r, ecc_sp521_s, ecc_sp521_peer, ecc_sp521_z },
+#endif
+};
+
+/* Key generation, ECDH, verify and sign against fixed values on one curve. */
+static int ecc_test_sp_vector(WC_RNG* rng, const eccSpVector* vec)
+{
+    int ret;
+#ifdef WOLFSSL_SMALL_STACK
+    ecc_key* key = NULL;
+    ecc_key* peer = NULL;
+#else
+    ecc_key key[1];
+    ecc_key peer[1];
+#endif
+    int keyInit = 0;
+    int peerInit = 0;
+    int verify = 0;
+    byte buf[1 + 2 * MAX_ECC_BYTES];
+    byte sig[ECC_MAX_SIG_SIZE];
+    byte expSig[ECC_MAX_SIG_SIZE];
+    byte hash[sizeof(ecc_sp_hash)];
+    word32 bufSz;
+    word32 sigSz;
+    word32 expSigSz;
+
+#ifdef WOLFSSL_SMALL_STACK
+    key = (ecc_key*)XMALLOC(sizeof(*key), HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    peer = (ecc_key*)XMALLOC(sizeof(*peer), HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (key == NULL || peer == NULL)
+        ERROR_OUT(MEMORY_E, done);
+#endif
+
+    ret = wc_ecc_init_ex(key, HEAP_HINT, devId);
+    if (ret != 0)
+        goto done;
+    keyInit = 1;
+    ret = wc_ecc_init_ex(peer, HEAP_HINT, devId);
+    if (ret != 0)
+        goto done;
+    peerInit = 1;
+
+    /* Public key from private key (fixed base point multiply). */
+    ret = wc_ecc_import_private_key_ex(vec->d, vec->keySz, NULL, 0, key,
+        vec->curveId);
+    if (ret != 0)
+        goto done;
+    ret = wc_ecc_make_pub(key, NULL);
+    if (ret != 0)
+        goto done;
+    bufSz = sizeof(buf);
+    ret = wc_ecc_export_x963(key, buf, &bufSz);
+    if (ret != 0)
+        goto done;
+    if (bufSz != 1 + 2 * vec->keySz || XMEMCMP(buf, vec->pub, bufSz) != 0)
+        ERROR_OUT(-9880, done);
+
+    /* Shared secret with the peer public key (point multiply). */
+    ret = wc_ecc_import_x963_ex(vec->peer, 1 + 2 * vec->keySz, peer,
+        vec->curveId);
+    if (ret != 0)
+        goto done;
+    bufSz = sizeof(buf);
+    ret = wc_ecc_shared_secret(key, peer, buf, &bufSz);
+    if (ret != 0)
+        goto done;
+    if (bufSz != vec->keySz || XMEMCMP(buf, vec->z, bufSz) != 0)
+        ERROR_OUT(-9881, done);
+
+    /* Verify the known signature, then with the hash changed. */
+    expSigSz = sizeof(expSig);
+    ret = wc_ecc_rs_raw_to_sig(vec->r, vec->keySz, vec->s, vec->keySz,
+        expSig, &expSigSz);
+    if (ret != 0)
+        goto done;
+    XMEMCPY(hash, ecc_sp_hash, sizeof(hash));
+    ret = wc_ecc_verify_hash(expSig, expSigSz, hash, sizeof(hash), &verify,
+        key);
+    if (ret != 0)
+        goto done;
+    if (verify != 1)
+        ERROR_OUT(-9882, done);
+    hash[0] ^= 0x01;
+    ret = wc_ecc_verify_hash(expSig, expSigSz, hash, sizeof(hash), &verify,
+        key);
+    if (ret != 0)
+        goto done;
+    if (verify != 0)
+        ERROR_OUT(-9883, done);
+    hash[0] ^= 0x01;
+
+    /* Sign: with a set k the signature must be the known one. */
+#ifdef WOLFSSL_ECDSA_SET_K
+    ret = wc_ecc_sign_set_k(vec->k, vec->keySz, key);
+    if (ret != 0)
+        goto done;
+#endif
+    sigSz = sizeof(sig);
+    ret = wc_ecc_sign_hash(hash, sizeof(hash), sig, &sigSz, rng, key);
+    if (ret != 0)
+        goto done;
+#ifdef WOLFSSL_ECDSA_SET_K
+    if (sigSz != expSigSz || XMEMCMP(sig, expSig, sigSz) != 0)
+        ERROR_OUT(-9884, done);
+#endif
+    ret = wc_ecc_verify_hash(sig, sigSz, hash, sizeof(hash), &verify, key);
+    if (ret != 0)
+        goto done;
+    if (verify != 1)
+        ERROR_OUT(-9885, done);
+
+done:
+    if (peerInit)
+        wc_ecc_free(peer);
+    if (keyInit)
+        wc_ecc_free(key);
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(peer, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+
+static int ecc_test_sp_vectors(WC_RNG* rng)
+{
+    int ret = 0;
+    int i;
+#ifdef HAVE_CPUID_INTEL
+    word32 flags;
+#endif
+
+    for (i = 0; ret == 0 && i < (int)(sizeof(ecc_sp_vectors) /
+                                      sizeof(ecc_sp_vectors[0])); i++) {
+        ret = ecc_test_sp_vector(rng, &ecc_sp_vectors[i]);
+    }
+
+#ifdef HAVE_CPUID_INTEL
+    /* Run again without MULX/ADCX/ADOX when the CPU has them so that both
+     * the BMI2/ADX and the plain assembly are checked. */
+    flags = cpuid_get_flags();
+    if (ret == 0 && IS_INTEL_BMI2(flags) && IS_INTEL_ADX(flags)) {
+        cpuid_clear_flag(CPUID_BMI2 | CPUID_ADX);
+        for (i = 0; ret == 0 && i < (int)(sizeof(ecc_sp_vectors) /
+                                          sizeof(ecc_sp_vectors[0])); i++) {
+            ret = ecc_test_sp_vector(rng, &ecc_sp_vectors[i]);
+        }
+        cpuid_select_flags(flags);
+    }
+#endif
+
+    return ret;
+}
+#endif /* HAVE_ECC_SP_VECTOR_TEST */
+
 #ifdef HAVE_ECC_KEY_IMPORT
 /* returns 0 on success */
 static int ecc_test_make_pub(WC_RNG* rng)
@@ -24337,8 +24792,7 @@ exit:
 /* Requires SP math and supports P384 or P256 */
 /* ./configure --enable-ecc=nonblock --enable-sp=yes,nonblock CFLAGS="-DWOLFSSL_PUBLIC_MP" */
 #if defined(WC_ECC_NONBLOCK) && defined(WOLFSSL_PUBLIC_MP) && \
-    defined(HAVE_ECC_SIGN) && defined(HAVE_ECC_VERIFY) && \
-    defined(WOLFSSL_HAVE_SP_ECC)
+    defined(HAVE_ECC_SIGN) && defined(HAVE_ECC_VERIFY)
 /* Test Data - Random */
 static const uint8_t kMsg[] = {
     0x69, 0xbc, 0x9f, 0xce, 0x68, 0x17, 0xc2, 0x10, 0xea, 0xfc, 0x10, 0x65, 0x67, 0x52, 0xed, 0x78,
@@ -24854,6 +25308,77 @@ static int crypto_ecc_sign(const uint8_t *key, uint32_t keySz,
     return ret;
 }
 
+#ifdef HAVE_ECC_DHE
+/* generate two keys and agree on a secret with non-blocking calls, checking
+ * the result against the blocking shared secret */
+static int crypto_ecc_shared_secret_nb(WC_RNG* rng, int curveId)
+{
+    int ret, count = 0;
+    ecc_key keyA, keyB;
+    ecc_nb_ctx_t nb_ctx;
+    byte secretA[MAX_ECC_BYTES];
+    byte secretB[MAX_ECC_BYTES];
+    word32 secretASz = sizeof(secretA);
+    word32 secretBSz = sizeof(secretB);
+
+    ret = wc_ecc_init(&keyA);
+    if (ret != 0) {
+        return ret;
+    }
+    ret = wc_ecc_init(&keyB);
+    if (ret != 0) {
+        wc_ecc_free(&keyA);
+        return ret;
+    }
+
+    /* key generation, few steps per call to exercise resume */
+    ret = wc_ecc_set_nonblock(&keyA, &nb_ctx);
+    if (ret == 0) {
+        nb_ctx.maxSteps = 4;
+        do {
+            ret = wc_ecc_make_key_ex(rng, 0, &keyA, curveId);
+            count++;
+        } while (ret == FP_WOULDBLOCK);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_make_key_ex(rng, 0, &keyB, curveId);
+    }
+#ifdef ECC_TIMING_RESISTANT
+    if (ret == 0) {
+        ret = wc_ecc_set_rng(&keyA, rng);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_set_rng(&keyB, rng);
+    }
+#endif
+
+    /* shared secret */
+    if (ret == 0) {
+        do {
+            ret = wc_ecc_shared_secret(&keyA, &keyB, secretA, &secretASz);
+            count++;
+        } while (ret == FP_WOULDBLOCK);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_shared_secret(&keyB, &keyA, secretB, &secretBSz);
+    }
+    if (ret == 0 && (secretASz != secretBSz ||
+                                XMEMCMP(secretA, secretB, secretASz) != 0)) {
+        ret = ECC_BAD_ARG_E;
+    }
+#ifdef DEBUG_WOLFSSL
+    printf("ECC non-block make key and shared secret: %d times\n", count);
+#endif
+
+    wc_ecc_free(&keyB);
+    wc_ecc_free(&keyA);
+
+    (void)count;
+
+    return ret;
+}
+#endif /* HAVE_ECC_DHE */
+
 static int ecc_test_nonblock(WC_RNG* rng)
 {
     int ret;
@@ -24892,6 +25417,12 @@ static int ecc_test_nonblock(WC_RNG* rng)
         );
     }
 
+#ifdef HAVE_ECC_DHE
+    if (ret == 0) {
+        ret = crypto_ecc_shared_secret_nb(rng, ECC_CURVE_ID);
+    }
+#endif
+
     return ret;
 }
 #endif /* WC_ECC_NONBLOCK && WOLFSSL_PUBLIC_MP && HAVE_ECC_SIGN && HAVE_ECC_VERIFY */
@@ -25056,6 +25587,13 @@ WOLFSSL_TEST_SUBROUTINE int ecc_test(void)
 #elif defined(HAVE_ECC_KEY_IMPORT)
     (void)ecc_test_make_pub; /* for compiler warning */
 #endif
+#ifdef HAVE_ECC_SP_VECTOR_TEST
+    ret = ecc_test_sp_vectors(&rng);
+    if (ret != 0) {
+        printf("ecc_test_sp_vectors failed!: %d\n", ret);
+        goto done;
+    }
+#endif
 #ifdef WOLFSSL_CERT_GEN
     ret = ecc_test_cert_gen(&rng);
     if (ret != 0) {
@@ -37925,11 +38463,214 @@ static int mp_test_mul_sqr(mp_int* a, mp_int* b, mp_int* r1, mp_int* r2,
     return 0;
 }
 
+#if defined(WOLFSSL_SP_MATH_ALL) && !defined(WOLFSSL_RSA_VERIFY_ONLY)
+/* Set a to a random number of exactly digits digits. */
+static int mp_test_rand_digits(mp_int* a, int digits, WC_RNG* rng)
+{
+    int ret;
+
+    mp_zero(a);
+    ret = wc_RNG_GenerateBlock(rng, (byte*)a->dp,
+                               (word32)(digits * sizeof(mp_digit)));
+    if (ret != 0)
+        return ret;
+    a->used = digits;
+    a->dp[digits - 1] |= (mp_digit)1 << (SP_WORD_SIZE - 1);
+
+    return 0;
+}
+
+/* Compute r = a * b one digit of b at a time - independent of mp_mul. */
+static int mp_test_mul_ref(mp_int* a, mp_int* b, mp_int* r, mp_int* t)
+{
+    int ret;
+    int i;
+
+    mp_zero(r);
+    for (i = b->used - 1; i >= 0; i--) {
+        ret = mp_mul_2d(r, SP_WORD_SIZE, r);
+        if (ret == MP_OKAY)
+            ret = mp_mul_d(a, b->dp[i], t);
+        if (ret == MP_OKAY)
+            ret = mp_add(r, t, r);
+        if (ret != MP_OKAY)
+            return ret;
+    }
+
+    return MP_OKAY;
+}
+
+/* Check mp_mul and mp_sqr against the reference product for every operand
+ * size - covers both sides of the Karatsuba thresholds, odd lengths and
+ * results that overwrite an operand.
+ */
+static int mp_test_mul_sqr_big(mp_int* a, mp_int* b, mp_int* r1, mp_int* r2,
+                               mp_int* t, WC_RNG* rng)
+{
+    int ret;
+    int i;
+
+    for (i = 1; i <= SP_INT_DIGITS / 2; i++) {
+        ret = mp_test_rand_digits(a, i, rng);
+        if (ret == 0)
+            ret = mp_test_rand_digits(b, i, rng);
+        if (ret != 0)
+            return -13161;
+
+        ret = mp_test_mul_ref(a, b, r2, t);
+        if (ret != MP_OKAY)
+            return -13162;
+        ret = mp_mul(a, b, r1);
+        if (ret != MP_OKAY)
+            return -13163;
+        if (mp_cmp(r1, r2) != MP_EQ)
+            return -13164;
+
+        /* Result in place of either operand. */
+        ret = mp_copy(a, r1);
+        if (ret == MP_OKAY)
+            ret = mp_mul(r1, b, r1);
+        if (ret != MP_OKAY || mp_cmp(r1, r2) != MP_EQ)
+            return -13165;
+        ret = mp_copy(b, r1);
+        if (ret == MP_OKAY)
+            ret = mp_mul(a, r1, r1);
+        if (ret != MP_OKAY || mp_cmp(r1, r2) != MP_EQ)
+            return -13166;
+
+        ret = mp_test_mul_ref(a, a, r2, t);
+        if (ret != MP_OKAY)
+            return -13167;
+        ret = mp_sqr(a, r1);
+        if (ret != MP_OKAY || mp_cmp(r1, r2) != MP_EQ)
+            return -13168;
+        ret = mp_copy(a, r1);
+        if (ret == MP_OKAY)
+            ret = mp_sqr(r1, r1);
+        if (ret != MP_OKAY || mp_cmp(r1, r2) != MP_EQ)
+            return -13169;
+    }
+
+    return 0;
+}
+
+#ifdef HAVE_ECC
+/* Integers sized for a field, as ECC temporaries are, hold the product of two
+ * field elements and its Montgomery reduction but nothing bigger.
+ */
+static int mp_test_size(mp_int* m, mp_int* r1, mp_int* r2, WC_RNG* rng)
+{
+    static const int bits[] = { 256, 384, 521 };
+    DECL_MP_INT_SIZE(a, MAX_ECC_BITS);
+    DECL_MP_INT_SIZE(b, MAX_ECC_BITS);
+    DECL_MP_INT_SIZE(t, MAX_ECC_BITS);
+    mp_digit mp;
+    int ret;
+    int digits;
+    int i;
+    int j;
+
+    for (i = 0; i < (int)(sizeof(bits) / sizeof(*bits)); i++) {
+        /* Size would be limited to the maximum. */
+        if ((bits[i] > MAX_ECC_BITS) ||
+                (MP_BITS_CNT_NO_LIMIT(bits[i]) > SP_INT_DIGITS)) {
+            continue;
+        }
+        digits = (bits[i] + SP_WORD_SIZE - 1) / SP_WORD_SIZE;
+
+        /* Odd modulus of exactly bits[i] bits. */
+        ret = mp_test_rand_digits(m, digits, rng);
+        if (ret == 0)
+            ret = mp_mod_2d(m, bits[i], m);
+        if (ret == 0)
+            ret = mp_set_bit(m, bits[i] - 1);
+        if (ret == 0)
+            ret = mp_set_bit(m, 0);
+        if (ret == 0)
+            ret = mp_montgomery_setup(m, &mp);
+        if (ret != 0)
+            return -13250;
+
+        ret = INIT_MP_INT_SIZE(a, bits[i]);
+        if (ret == 0)
+            ret = INIT_MP_INT_SIZE(b, bits[i]);
+        if (ret == 0)
+            ret = INIT_MP_INT_SIZE(t, bits[i]);
+        if (ret != 0)
+            return -13251;
+
+        for (j = 0; j < 8; j++) {
+            /* Largest field element first and then random ones. */
+            if (j == 0) {
+                ret = mp_sub_d(m, 1, a);
+                if (ret == 0)
+                    ret = mp_copy(a, b);
+            }
+            else {
+                ret = mp_test_rand_digits(r1, digits, rng);
+                if (ret == 0)
+                    ret = mp_mod(r1, m, a);
+                if (ret == 0)
+                    ret = mp_test_rand_digits(r1, digits, rng);
+                if (ret == 0)
+                    ret = mp_mod(r1, m, b);
+            }
+            if (ret != 0)
+                return -13252;
+
+            ret = mp_mul(a, b, t);
+            if (ret == 0)
+                ret = mp_mul(a, b, r2);
+            if (ret != 0 || mp_cmp(t, r2) != MP_EQ)
+                return -13253;
+            ret = mp_montgomery_reduce(t, m, mp);
+            if (ret == 0)
+                ret = mp_montgomery_reduce(r2, m, mp);
+            if (ret != 0 || mp_cmp(t, r2) != MP_EQ)
+                return -13254;
+
+            ret = mp_sqr(a, t);
+            if (ret == 0)
+                ret = mp_sqr(a, r2);
+            if (ret != 0 || mp_cmp(t, r2) != MP_EQ)
+                return -13255;
+            ret = mp_montgomery_reduce(t, m, mp);
+            if (ret == 0)
+                ret = mp_montgomery_reduce(r2, m, mp);
+            if (ret != 0 || mp_cmp(t, r2) != MP_EQ)
+                return -13256;
+        }
+
+        /* Product of three field elements doesn't fit. */
+        ret = mp_sub_d(m, 1, a);
+        if (ret == 0)
+            ret = mp_mul(a, a, t);
+        if (ret != 0)
+            return -13257;
+        if (mp_mul(t, a, t) != MP_VAL)
+            return -13258;
+        if (mp_mul(t, a, b) != MP_VAL)
+            return -13259;
+
+        mp_clear(t);
+        mp_clear(b);
+        mp_clear(a);
+    }
+
+    return 0;
+}
+#endif /* HAVE_ECC */
+#endif
+
 #if !defined(NO_RSA) || defined(HAVE_ECC) || !defined(NO_DSA) || \
     defined(OPENSSL_EXTRA)
 static int mp_test_invmod(mp_int* a, mp_int* m, mp_int* r)
 {
     int ret;
+#if defined(HAVE_ECC) && (defined(USE_FAST_MATH) || \
+    defined(WOLFSSL_SP_MATH_ALL))
+    mp_digit mp;
+#endif
 
     mp_set(a, 0);
     mp_set(m, 1);
@@ -38021,6 +38762,85 @@ static int mp_test_invmod(mp_int* a, mp_int* m, mp_int* r)
         return -13194;
 #endif
 
+#if defined(HAVE_ECC) && (defined(USE_FAST_MATH) || \
+    defined(WOLFSSL_SP_MATH_ALL))
+    mp_set(a, 0);
+    mp_set(m, 7);
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_VAL)
+        return -13181;
+    mp_set(a, 1);
+    mp_set(m, 8);
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_VAL)
+        return -13182;
+    mp_set(a, 3);
+    mp_set(m, 7);
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_OKAY)
+        return -13183;
+    if (mp_cmp_d(r, 5) != MP_EQ)
+        return -13184;
+
+    /* P-256 order: compare with the variable time inversion. */
+    ret = mp_read_radix(m,
+        "FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551",
+        MP_RADIX_HEX);
+    if (ret != MP_OKAY)
+        return -13185;
+    ret = mp_read_radix(a,
+        "E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B7852B855",
+        MP_RADIX_HEX);
+    if (ret != MP_OKAY)
+        return -13186;
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_OKAY)
+        return -13187;
+    ret = mp_invmod(a, m, a);
+    if (ret != MP_OKAY)
+        return -13188;
+    if (mp_cmp(r, a) != MP_EQ)
+        return -13189;
+
+    /* Zero, as 0 and as m, has no inverse. */
+    mp_zero(a);
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_VAL)
+        return -13161;
+    ret = mp_copy(m, a);
+    if (ret == MP_OKAY)
+        ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_VAL)
+        return -13162;
+    /* One, as 1 and as m + 1, is its own inverse. */
+    mp_set(a, 1);
+    ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_OKAY || !mp_isone(r))
+        return -13163;
+    ret = mp_add_d(m, 1, a);
+    if (ret == MP_OKAY)
+        ret = mp_invmod_ct(a, m, r);
+    if (ret != MP_OKAY || !mp_isone(r))
+        return -13164;
+
+    /* Montgomery form: zero mod m gives 0, one (R mod m) gives one. */
+    ret = mp_montgomery_setup(m, &mp);
+    if (ret != MP_OKAY)
+        return -13165;
+    ret = mp_copy(m, a);
+    if (ret == MP_OKAY)
+        ret = mp_invmod_mont_ct(a, m, r, mp);
+    if (ret != MP_OKAY || !mp_iszero(r))
+        return -13166;
+    ret = mp_montgomery_calc_normalization(a, m);
+    if (ret == MP_OKAY)
+        ret = mp_invmod_mont_ct(a, m, r, mp);
+    if (ret != MP_OKAY)
+        return -13167;
+    if (mp_cmp(r, a) != MP_EQ)
+        return -13168;
+#endif
+
     return 0;
 }
 #endif /* !NO_RSA || HAVE_ECC || !NO_DSA || OPENSSL_EXTRA */
@@ -38490,6 +39310,14 @@ WOLFSSL_TEST_SUBROUTINE int mp_test(void)
 #endif
     if ((ret = mp_test_mul_sqr(&a, &b, &r1, &r2, &rng)) != 0)
         return ret;
+#if defined(WOLFSSL_SP_MATH_ALL) && !defined(WOLFSSL_RSA_VERIFY_ONLY)
+    if ((ret = mp_test_mul_sqr_big(&a, &b, &r1, &r2, &p, &rng)) != 0)
+        return ret;
+#ifdef HAVE_ECC
+    if ((ret = mp_test_size(&p, &r1, &r2, &rng)) != 0)
+        return ret;
+#endif
+#endif
 #if !defined(NO_RSA) || defined(HAVE_ECC) || !defined(NO_DSA) || \
     defined(OPENSSL_EXTRA)
     if ((ret = mp_test_invmod(&a, &b, &r1)) != 0)
@@ -46,6 +46,12 @@
     #include <wolfssl/wolfcrypt/rsa.h>
     #include <wolfssl/wolfcrypt/ecc.h>
     #include <wolfssl/wolfcrypt/dh.h>
+#ifdef HAVE_CURVE25519
+    #include <wolfssl/wolfcrypt/curve25519.h>
+#endif
+#ifdef HAVE_CURVE448
+    #include <wolfssl/wolfcrypt/curve448.h>
+#endif
 #ifdef HAVE_HKDF
     #include <wolfssl/wolfcrypt/kdf.h>
 #endif
@@ -57,6 +63,12 @@
 
 #include <wolfssl/wolfcrypt/wc_encrypt.h>
 #include <wolfssl/wolfcrypt/hash.h>
+#ifdef HAVE_CRL
+    #include <wolfssl/crl.h>
+#endif
+#ifdef HAVE_OCSP
+    #include <wolfssl/ocsp.h>
+#endif
 
 
 #if defined(THREADX)
@@ -1108,9 +1120,18 @@ struct WOLFSSL_CIPHER {
 
 
 
+#ifndef HAVE_OCSP
     typedef struct WOLFSSL_OCSP WOLFSSL_OCSP;
+#endif
 
 /* wolfSSL OCSP controller */
+#ifdef HAVE_OCSP
+struct WOLFSSL_OCSP {
+    WOLFSSL_CERT_MANAGER* cm;            /* pointer back to cert manager */
+    OcspEntry*            ocspList;      /* OCSP response list */
+    wolfSSL_Mutex         ocspLock;      /* OCSP list lock */
+};
+#endif
 
 #ifndef MAX_DATE_SIZE
 #define MAX_DATE_SIZE 32
@@ -1125,30 +1146,18 @@ typedef struct CRL_Entry CRL_Entry;
 struct CRL_Entry {
     CRL_Entry* next;                      /* next entry */
     byte    issuerHash[CRL_DIGEST_SIZE];  /* issuer hash                 */
-    /* byte    crlHash[CRL_DIGEST_SIZE];      raw crl data hash           */
-    /* restore the hash here if needed for optimized comparisons */
     byte    lastDate[MAX_DATE_SIZE]; /* last date updated  */
     byte    nextDate[MAX_DATE_SIZE]; /* next update date   */
     byte    lastDateFormat;          /* last date format */
     byte    nextDateFormat;          /* next date format */
-    RevokedCert* certs;              /* revoked cert list  */
+    RevokedCert* certs;              /* revoked serials, sorted */
     int          totalCerts;         /* number on list     */
-    int     verified;
-    byte*   toBeSigned;
-    word32  tbsSz;
-    byte*   signature;
-    word32  signatureSz;
-    word32  signatureOID;
-#if !defined(NO_SKID)
-    byte    extAuthKeyIdSet;
-    byte    extAuthKeyId[KEYID_SIZE];
-#endif
 };
 
 
 typedef struct CRL_Monitor CRL_Monitor;
 
-/* CRL directory monitor */
+/* CRL directory monitor, also the directories read again on reload */
 struct CRL_Monitor {
     char* path;      /* full dir path, if valid pointer we're using */
     int   type;      /* PEM or ASN1 type */
@@ -1159,7 +1168,7 @@ struct CRL_Monitor {
 /* wolfSSL CRL controller */
 struct WOLFSSL_CRL {
     WOLFSSL_CERT_MANAGER* cm;            /* pointer back to cert manager */
-    CRL_Entry*            crlList;       /* our CRL list */
+    CRL_Entry*            crlList;       /* our CRL list, swapped on reload */
 #ifdef HAVE_CRL_IO
     CbCrlIO               crlIOCb;
 #endif
@@ -1178,19 +1187,208 @@ struct WOLFSSL_CRL {
 
 
 #ifndef CA_TABLE_SIZE
-    #define CA_TABLE_SIZE 11
-#endif
+    #define CA_TABLE_SIZE 11 /* rows of CA index for TSIP/SCE */
+#endif
+#ifndef CA_TABLE_MIN_SLOTS
+    #define CA_TABLE_MIN_SLOTS 32 /* initial slots, power of 2 */
+#endif
+
+/* CA signer table, open addressed with linear probing.
+ * Written only with caLock held. Slots are filled but never cleared, and a
+ * full table is replaced by a larger copy, so lookups need no lock. Replaced
+ * tables stay on the retired list until the signers are freed. */
+typedef struct SignerTable {
+    struct SignerTable* retired; /* replaced table, may still be in use */
+    word32              size;    /* number of slots, power of 2 */
+    word32              used;    /* number of slots filled */
+    word32              keyOffset; /* offset of hash in Signer to index by */
+    Signer*             slot[1]; /* size slots */
+} SignerTable;
 #ifdef WOLFSSL_TRUST_PEER_CERT
     #define TP_TABLE_SIZE 11
 #endif
 
+#if !defined(NO_FILESYSTEM) && !defined(NO_WOLFSSL_DIR) && \
+    !defined(NO_WOLFSSL_CA_HASH_DIR)
+    #define WOLFSSL_CA_HASH_DIR
+#endif
+#ifdef WOLFSSL_CA_HASH_DIR
+    #ifndef CA_HASH_DIR_MAX_SUFFIX
+        #define CA_HASH_DIR_MAX_SUFFIX 16 /* files per name hash */
+    #endif
+    /* Name hashes with no file are remembered for a while so lookups of
+     * unknown issuers don't search the directories each time */
+    #if !defined(NO_ASN_TIME) && !defined(NO_CA_HASH_DIR_MISS)
+        #define WOLFSSL_CA_HASH_DIR_MISS
+        #ifndef CA_HASH_DIR_MISS_SZ
+            #define CA_HASH_DIR_MISS_SZ      32 /* misses remembered */
+        #endif
+        #ifndef CA_HASH_DIR_MISS_TIMEOUT
+            #define CA_HASH_DIR_MISS_TIMEOUT 60 /* seconds, then searched */
+        #endif
+    #endif
+
+/* Directory of CA files named by subject name hash, read on lookup */
+typedef struct CAHashDir {
+    struct CAHashDir* next;
+    int               verify;  /* verify setting to add CAs with */
+    char              path[1]; /* NUL terminated */
+} CAHashDir;
+
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+/* Name hash not found in any hashed directory */
+typedef struct CAHashDirMiss {
+    word32 hash;    /* file name hash */
+    word32 time;    /* LowResTimer() at the miss, 0 when unused */
+} CAHashDirMiss;
+#endif
+#endif
+
+#if !defined(NO_FILESYSTEM) && !defined(WOLFSSL_NO_MMAP) && \
+    !defined(USE_WINDOWS_API) && (defined(__linux__) || \
+    defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || \
+    defined(__NetBSD__))
+    #define WOLFSSL_HAVE_MMAP
+#endif
+
+/* Parse PEM CA bundles on a pool of threads, WOLFSSL_LOAD_FLAG_PARALLEL */
+#if defined(WOLFSSL_PTHREADS) && !defined(SINGLE_THREADED) && \
+    !defined(NO_FILESYSTEM) && defined(WOLFSSL_PEM_TO_DER) && \
+    !defined(NO_WOLFSSL_PARALLEL_CA_LOAD) && \
+    !defined(WOLFSSL_RENESAS_TSIP_TLS) && !defined(WOLFSSL_RENESAS_SCEPROTECT)
+    #define WOLFSSL_PARALLEL_CA_LOAD
+    #ifndef CA_LOAD_MAX_THREADS
+        #define CA_LOAD_MAX_THREADS 8  /* including the calling thread */
+    #endif
+    #ifndef CA_LOAD_BATCH
+        #define CA_LOAD_BATCH       16 /* certs taken by a worker at once */
+    #endif
+#endif
+
+/* Ephemeral ECDHE keys made ahead of client handshakes by a thread per
+ * WOLFSSL_CTX, wolfSSL_CTX_UseEphemeralKeyPool() */
+#if defined(WOLFSSL_PTHREADS) && !defined(SINGLE_THREADED) && \
+    defined(HAVE_ECC) && !defined(WC_NO_RNG) && \
+    !defined(NO_WOLFSSL_EPH_KEY_POOL)
+    #define WOLFSSL_EPH_KEY_POOL
+    #include <unistd.h>     /* getpid() */
+    #ifndef EPH_KEY_POOL_MAX_CURVES
+        #define EPH_KEY_POOL_MAX_CURVES 6
+    #endif
+    #ifndef EPH_KEY_POOL_MAX_DEPTH
+        #define EPH_KEY_POOL_MAX_DEPTH  64  /* keys kept per curve */
+    #endif
+
+/* Exported private and public key of one pooled key pair */
+typedef struct EphKey {
+    byte   priv[MAX_ECC_BYTES];
+    byte   pub[1 + 2 * MAX_ECC_BYTES];
+    word16 privSz;
+    word16 pubSz;
+} EphKey;
+
+/* Key pairs ready to use for one curve */
+typedef struct EphKeyCurve {
+    word32  oid;                /* curve OID sum, as ssl->ecdhCurveOID */
+    word32  count;              /* number of keys ready */
+    word32  taken;              /* number of keys used by handshakes */
+    EphKey* keys;               /* depth entries */
+} EphKeyCurve;
+
+typedef struct EphKeyPool {
+    EphKeyCurve    curves[EPH_KEY_POOL_MAX_CURVES];
+    int            curveCount;
+    word32         depth;       /* keys kept per curve */
+    int            stop;        /* generator thread to exit */
+    int            refCount;    /* CTX and handshakes taking a key */
+    pid_t          pid;         /* process the keys were made for */
+    void*          heap;
+    wolfSSL_Mutex  lock;
+    pthread_cond_t cond;        /* signals the generator a key was taken */
+    pthread_t      tid;         /* generator thread */
+} EphKeyPool;
+
+WOLFSSL_LOCAL int  InitEphKeyPool(WOLFSSL_CTX* ctx, word32 depth);
+WOLFSSL_LOCAL void FreeEphKeyPool(WOLFSSL_CTX* ctx);
+WOLFSSL_LOCAL int  EphKeyPoolStats(WOLFSSL_CTX* ctx, int group, word32* ready,
+                                   word32* taken);
+#endif /* WOLFSSL_EPH_KEY_POOL */
+
+#ifdef PERSIST_CERT_CACHE
+    #ifdef WOLFSSL_HAVE_MMAP
+        #define WOLFSSL_CERT_CACHE_MMAP
+    #endif
+
+enum CertCacheImageType {
+    CERT_CACHE_IMAGE_USER = 0,  /* caller keeps image valid */
+    CERT_CACHE_IMAGE_HEAP = 1,  /* copy owned by store */
+    CERT_CACHE_IMAGE_MMAP = 2   /* mapped file owned by store */
+};
+
+/* CA signers restored from a cert cache image. The signers are one
+ * allocation and their key and name point into the image, so restoring
+ * copies only the fixed fields and indexes them. */
+typedef struct CertCacheStore {
+    struct CertCacheStore* next;
+    Signer*     signers;     /* count signers */
+    word32      count;
+    const byte* image;       /* cert cache image */
+    word32      imageSz;
+    byte        imageType;   /* CertCacheImageType */
+} CertCacheStore;
+#endif /* PERSIST_CERT_CACHE */
+
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+    #ifdef NO_SHA256
+        #error WOLFSSL_CERT_VERIFY_CACHE requires SHA-256
+    #endif
+    /* number of rows in verified certificate cache */
+    #ifndef WOLFSSL_CERT_VERIFY_CACHE_ROWS
+        #define WOLFSSL_CERT_VERIFY_CACHE_ROWS 256
+    #endif
+    /* number of entries per row */
+    #ifndef WOLFSSL_CERT_VERIFY_CACHE_WAYS
+        #define WOLFSSL_CERT_VERIFY_CACHE_WAYS 4
+    #endif
+    #define CERT_VERIFY_ID_SZ WC_SHA256_DIGEST_SIZE
+
+/* A certificate whose signature was verified with an issuer's public key */
+typedef struct CertVerifyCacheEntry {
+    byte certId[CERT_VERIFY_ID_SZ];   /* hash of TBS and signature */
+    byte issuerId[CERT_VERIFY_ID_SZ]; /* hash of issuer public key */
+} CertVerifyCacheEntry;
+
+typedef struct CertVerifyCacheRow {
+    CertVerifyCacheEntry entry[WOLFSSL_CERT_VERIFY_CACHE_WAYS];
+    byte                 used;        /* number of entries in use */
+    byte                 next;        /* next entry to replace when full */
+} CertVerifyCacheRow;
+#endif /* WOLFSSL_CERT_VERIFY_CACHE */
+
 /* wolfSSL Certificate Manager */
 struct WOLFSSL_CERT_MANAGER {
-    Signer*         caTable[CA_TABLE_SIZE]; /* the CA signer table */
+    SignerTable*    caTable;             /* the CA signer table */
+#ifndef NO_SKID
+    SignerTable*    caNameTable;         /* CA signers by subject name hash */
+#endif
+#ifdef PERSIST_CERT_CACHE
+    CertCacheStore* caStore;             /* restored cert cache images */
+#endif
+#ifdef WOLFSSL_CA_HASH_DIR
+    CAHashDir*      caHashDirs;          /* CAs loaded on lookup */
+#endif
+#ifdef WOLFSSL_CA_HASH_DIR_MISS
+    CAHashDirMiss   caHashDirMiss[CA_HASH_DIR_MISS_SZ]; /* under caLock */
+    word32          caHashDirMissIdx;    /* next slot to replace */
+#endif
     void*           heap;                /* heap helper */
 #ifdef WOLFSSL_TRUST_PEER_CERT
     TrustedPeerCert* tpTable[TP_TABLE_SIZE]; /* table of trusted peer certs */
     wolfSSL_Mutex   tpLock;                  /* trusted peer list lock */
+#endif
+#ifdef WOLFSSL_CERT_VERIFY_CACHE
+    CertVerifyCacheRow* verifyCache;     /* verified certs, allocated on use */
+    wolfSSL_Mutex   verifyCacheLock;     /* verified cert cache lock */
 #endif
     WOLFSSL_CRL*    crl;                 /* CRL checker */
     WOLFSSL_OCSP*   ocsp;                /* OCSP checker */
@@ -1211,6 +1409,7 @@ struct WOLFSSL_CERT_MANAGER {
     byte            ocspSendNonce:1;       /* send the OCSP nonce ? */
     byte            ocspUseOverrideURL:1;  /* ignore cert responder, override */
     byte            ocspStaplingEnabled:1; /* is OCSP Stapling on ? */
+    byte            ocspMustStaple:1;      /* server must respond with staple */
 
     short           minRsaKeySz;         /* minimum allowed RSA key size */
     short           minEccKeySz;         /* minimum allowed ECC key size */
@@ -1227,6 +1426,9 @@ WOLFSSL_LOCAL int CM_MemSaveCertCache(WOLFSSL_CERT_MANAGER* cm, void* mem,
                                       int sz, int* used);
 WOLFSSL_LOCAL int CM_MemRestoreCertCache(WOLFSSL_CERT_MANAGER* cm,
                                          const void* mem, int sz);
+WOLFSSL_LOCAL int CM_MapCertCache(WOLFSSL_CERT_MANAGER* cm, const char* fname);
+WOLFSSL_LOCAL int CM_MemMapCertCache(WOLFSSL_CERT_MANAGER* cm,
+                                     const void* mem, int sz);
 WOLFSSL_LOCAL int CM_GetCertCacheMemSize(WOLFSSL_CERT_MANAGER* cm);
 WOLFSSL_LOCAL int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
                                     long sz, int format, int err_val);
@@ -1425,6 +1627,26 @@ WOLFSSL_LOCAL int TLSX_ALPN_SetOptions(TLSX** extensions, byte option);
 /** Truncated HMAC - RFC 6066 (session 7) */
 
 /** Certificate Status Request - RFC 6066 (session 8) */
+#ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+
+typedef struct {
+    byte status_type;
+    byte options;
+    WOLFSSL* ssl;
+    union {
+        OcspRequest ocsp;
+    } request;
+} CertificateStatusRequest;
+
+WOLFSSL_LOCAL int   TLSX_UseCertificateStatusRequest(TLSX** extensions,
+                                    byte status_type, byte options,
+                                    WOLFSSL* ssl, void* heap);
+WOLFSSL_LOCAL int   TLSX_CSR_InitRequest(TLSX* extensions, DecodedCert* cert,
+                                                                   void* heap);
+WOLFSSL_LOCAL void* TLSX_CSR_GetRequest(TLSX* extensions);
+WOLFSSL_LOCAL int   TLSX_CSR_ForceRequest(WOLFSSL* ssl);
+
+#endif /* HAVE_CERTIFICATE_STATUS_REQUEST */
 
 /** Certificate Status Request v2 - RFC 6961 */
 
@@ -1581,6 +1803,12 @@ struct WOLFSSL_CTX {
     CallbackSniRecv sniRecvCb;
     void*           sniRecvCbArg;
     int             devId;              /* async device id to use */
+#ifdef WC_ECC_NONBLOCK
+    word32          eccNbSteps;         /* ECC ladder steps per call, 0 off */
+#endif
+#ifdef WOLFSSL_EPH_KEY_POOL
+    EphKeyPool*     ephKeyPool;         /* pre-generated ECDHE keys */
+#endif
     TLSX* extensions;                  /* RFC 6066 TLS Extensions data */
         byte userCurves;                  /* indicates user called wolfSSL_CTX_UseSupportedCurve */
 #ifdef HAVE_EXT_CACHE
@@ -2305,6 +2533,23 @@ typedef struct BuildMsgArgs {
     ALIGN16 byte staticIvBuffer[MAX_IV_SZ];
 } BuildMsgArgs;
 
+#ifdef WC_ECC_NONBLOCK
+    #define MAX_NONBLOCK_ARGS 18
+    /* fails to compile when the message arguments don't fit in args */
+    #define WOLFSSL_ASSERT_SIZEOF_GE(x, y) do {                           \
+        typedef char _args_test_[sizeof(x) >= sizeof(y) ? 1 : -1];         \
+        (void)sizeof(_args_test_);                                          \
+    } while(0)
+    typedef void (*FreeArgsCb)(struct WOLFSSL* ssl, void* pArgs);
+
+    /* Handshake state kept while a time-sliced ECC operation is pending */
+    struct WOLFSSL_NONBLOCK {
+        void*        args[MAX_NONBLOCK_ARGS]; /* saved message arguments */
+        FreeArgsCb   freeArgs;      /* frees args, set while args are saved */
+        ecc_nb_ctx_t eccNb;         /* ECC non-blocking context */
+    };
+#endif
+
 
 
 
@@ -2372,6 +2617,14 @@ struct WOLFSSL {
     word16          eccTempKeySz;            /* in octets 20 - 66 */
     byte            peerEccDsaKeyPresent;
     word32          pkCurveOID;              /* curve Ecc_Sum     */
+#ifdef HAVE_CURVE25519
+    curve25519_key* peerX25519Key;           /* peer's X25519 key */
+    byte            peerX25519KeyPresent;
+#endif
+#ifdef HAVE_CURVE448
+    curve448_key*   peerX448Key;             /* peer's X448 key */
+    byte            peerX448KeyPresent;
+#endif
 #ifdef WOLFSSL_LOCAL_X509_STORE
     WOLFSSL_X509_STORE* x509_store_pt; /* take ownership of external store */
 #endif
@@ -2385,8 +2638,15 @@ struct WOLFSSL {
     WOLFSSL_CRYPTO_EX_DATA ex_data; /* external data, for Fortress */
 #endif
     int              devId;             /* async device id to use */
+#ifdef WC_ECC_NONBLOCK
+    word32           eccNbSteps;        /* ECC ladder steps per call, 0 off */
+    struct WOLFSSL_NONBLOCK* nonblock;  /* pending ECC operation state */
+#endif
     OneTimeAuth     auth;
     TLSX* extensions;                  /* RFC 6066 TLS Extensions data */
+    #ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+        byte status_request;           /* server acked status_request */
+    #endif
         int                  secure_rene_count;    /* how many times */
         SecureRenegotiation* secure_renegotiation; /* valid pointer indicates */
     #ifdef HAVE_ALPN
@@ -2596,13 +2856,23 @@ WOLFSSL_LOCAL WC_RNG* WOLFSSL_RSA_GetRNG(WOLFSSL_RSA *rsa, WC_RNG **tmpRNG,
         WOLFSSL_LOCAL int RsaEnc(WOLFSSL* ssl, const byte* in, word32 inSz, byte* out,
             word32* outSz, RsaKey* key, buffer* keyBufInfo);
 
-        WOLFSSL_LOCAL int EccSign(WOLFSSL* ssl, const byte* in, word32 inSz,
-            byte* out, word32* outSz, ecc_key* key, DerBuffer* keyBufInfo);
         WOLFSSL_LOCAL int EccVerify(WOLFSSL* ssl, const byte* in, word32 inSz,
             const byte* out, word32 outSz, ecc_key* key, buffer* keyBufInfo);
         WOLFSSL_LOCAL int EccSharedSecret(WOLFSSL* ssl, ecc_key* priv_key,
             ecc_key* pub_key, byte* pubKeyDer, word32* pubKeySz, byte* out,
             word32* outlen, int side);
+    #ifdef HAVE_CURVE25519
+        WOLFSSL_LOCAL int X25519SharedSecret(WOLFSSL* ssl,
+            curve25519_key* priv_key, curve25519_key* pub_key,
+            byte* pubKeyDer, word32* pubKeySz, byte* out, word32* outlen,
+            int side);
+    #endif
+    #ifdef HAVE_CURVE448
+        WOLFSSL_LOCAL int X448SharedSecret(WOLFSSL* ssl,
+            curve448_key* priv_key, curve448_key* pub_key,
+            byte* pubKeyDer, word32* pubKeySz, byte* out, word32* outlen,
+            int side);
+    #endif
 
 
     #ifdef WOLFSSL_TRUST_PEER_CERT
@@ -2618,7 +2888,14 @@ WOLFSSL_LOCAL WC_RNG* WOLFSSL_RSA_GetRNG(WOLFSSL_RSA *rsa, WC_RNG **tmpRNG,
 
     WOLFSSL_LOCAL Signer* GetCA(void* cm, byte* hash);
     #ifndef NO_SKID
-        WOLFSSL_LOCAL Signer* GetCAByName(void* cm, byte* hash);
+        WOLFSSL_ASN_API Signer* GetCAByName(void* cm, byte* hash);
+    #endif
+    #ifdef WOLFSSL_CERT_VERIFY_CACHE
+        WOLFSSL_LOCAL int  CheckCertVerifyCache(void* cm, const byte* certId,
+                                                const byte* issuerId);
+        WOLFSSL_LOCAL void AddCertVerifyCache(void* cm, const byte* certId,
+                                              const byte* issuerId);
+        WOLFSSL_LOCAL void FlushCertVerifyCache(WOLFSSL_CERT_MANAGER* cm);
     #endif
 WOLFSSL_LOCAL int  BuildTlsHandshakeHash(WOLFSSL* ssl, byte* hash,
                                    word32* hashLen);
@@ -2723,6 +3000,14 @@ WOLFSSL_LOCAL int SetDhExternal(WOLFSSL_DH *dh);
         const byte* prime, word32 primeSz);
 
     WOLFSSL_LOCAL int EccMakeKey(WOLFSSL* ssl, ecc_key* key, ecc_key* peer);
+#ifdef HAVE_CURVE25519
+    WOLFSSL_LOCAL int X25519MakeKey(WOLFSSL* ssl, curve25519_key* key,
+                                    curve25519_key* peer);
+#endif
+#ifdef HAVE_CURVE448
+    WOLFSSL_LOCAL int X448MakeKey(WOLFSSL* ssl, curve448_key* key,
+                                  curve448_key* peer);
+#endif
     WOLFSSL_LOCAL word16 GetCurveByOID(int oidSum);
 
 WOLFSSL_LOCAL int InitHandshakeHashes(WOLFSSL* ssl);
@@ -724,6 +724,8 @@ WOLFSSL_ABI WOLFSSL_API int wolfSSL_CTX_use_PrivateKey_file(
 #define WOLFSSL_LOAD_FLAG_IGNORE_ERR    0x00000001
 #define WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY 0x00000002
 #define WOLFSSL_LOAD_FLAG_PEM_CA_ONLY   0x00000004
+#define WOLFSSL_LOAD_FLAG_HASH_DIR      0x00000008 /* load path CAs on use */
+#define WOLFSSL_LOAD_FLAG_PARALLEL      0x00000010 /* parse file on threads */
 
 #ifndef WOLFSSL_LOAD_VERIFY_DEFAULT_FLAGS
 #define WOLFSSL_LOAD_VERIFY_DEFAULT_FLAGS WOLFSSL_LOAD_FLAG_NONE
@@ -920,6 +922,8 @@ WOLFSSL_API int  wolfSSL_CTX_save_cert_cache(WOLFSSL_CTX* ctx, const char* fname
 WOLFSSL_API int  wolfSSL_CTX_restore_cert_cache(WOLFSSL_CTX* ctx, const char* fname);
 WOLFSSL_API int  wolfSSL_CTX_memsave_cert_cache(WOLFSSL_CTX* ctx, void* mem, int sz, int* used);
 WOLFSSL_API int  wolfSSL_CTX_memrestore_cert_cache(WOLFSSL_CTX* ctx, const void* mem, int sz);
+WOLFSSL_API int  wolfSSL_CTX_map_cert_cache(WOLFSSL_CTX* ctx, const char* fname);
+WOLFSSL_API int  wolfSSL_CTX_memmap_cert_cache(WOLFSSL_CTX* ctx, const void* mem, int sz);
 WOLFSSL_API int  wolfSSL_CTX_get_cert_cache_memsize(WOLFSSL_CTX* ctx);
 
 /* only supports full name from cipher_name[] delimited by : */
@@ -2112,6 +2116,15 @@ WOLFSSL_API int wolfSSL_SetMinEccKey_Sz(WOLFSSL* ssl, short keySz);
 
 WOLFSSL_API int  wolfSSL_SetTmpEC_DHE_Sz(WOLFSSL* ssl, word16 sz);
 WOLFSSL_API int  wolfSSL_CTX_SetTmpEC_DHE_Sz(WOLFSSL_CTX* ctx, word16 sz);
+#ifdef WC_ECC_NONBLOCK
+WOLFSSL_API int  wolfSSL_CTX_UseEccNonBlock(WOLFSSL_CTX* ctx, word32 steps);
+WOLFSSL_API int  wolfSSL_UseEccNonBlock(WOLFSSL* ssl, word32 steps);
+#endif
+WOLFSSL_API int  wolfSSL_CTX_UseEphemeralKeyPool(WOLFSSL_CTX* ctx,
+                                                 word32 depth);
+WOLFSSL_API int  wolfSSL_CTX_GetEphemeralKeyPoolStats(WOLFSSL_CTX* ctx,
+                                          word16 group, word32* ready,
+                                          word32* taken);
 
 /* keyblock size in bytes or -1 */
 /* need to call wolfSSL_KeepArrays before handshake to save keys */
@@ -2369,8 +2382,17 @@ enum KDF_MacAlgorithm {
 
     WOLFSSL_API int wolfSSL_CertManagerLoadCA(WOLFSSL_CERT_MANAGER* cm, const char* f,
                                                                  const char* d);
+    WOLFSSL_API int wolfSSL_CertManagerLoadCA_ex(WOLFSSL_CERT_MANAGER* cm,
+                              const char* f, const char* d, unsigned int flags);
     WOLFSSL_API int wolfSSL_CertManagerLoadCABuffer(WOLFSSL_CERT_MANAGER* cm,
                                   const unsigned char* in, long sz, int format);
+#if !defined(NO_FILESYSTEM) && !defined(NO_WOLFSSL_DIR) && \
+    !defined(NO_WOLFSSL_CA_HASH_DIR)
+    WOLFSSL_API int wolfSSL_CertManagerLoadCAHashDir(WOLFSSL_CERT_MANAGER* cm,
+                                  const char* path, unsigned int flags);
+    WOLFSSL_API int wolfSSL_CertHashDirName(const unsigned char* der,
+                                  int derSz, char* name, int nameSz);
+#endif
     WOLFSSL_API int wolfSSL_CertManagerUnloadCAs(WOLFSSL_CERT_MANAGER* cm);
 #ifdef WOLFSSL_TRUST_PEER_CERT
     WOLFSSL_API int wolfSSL_CertManagerUnload_trust_peers(WOLFSSL_CERT_MANAGER* cm);
@@ -2395,6 +2417,7 @@ enum KDF_MacAlgorithm {
     WOLFSSL_API int wolfSSL_CertManagerSetCRL_Cb(WOLFSSL_CERT_MANAGER* cm,
                                                                   CbMissingCRL cb);
     WOLFSSL_API int wolfSSL_CertManagerFreeCRL(WOLFSSL_CERT_MANAGER* cm);
+    WOLFSSL_API int wolfSSL_CertManagerReloadCRL(WOLFSSL_CERT_MANAGER* cm);
 #ifdef HAVE_CRL_IO
     WOLFSSL_API int wolfSSL_CertManagerSetCRL_IOCb(WOLFSSL_CERT_MANAGER* cm,
                                                                        CbCrlIO cb);
@@ -2573,6 +2596,14 @@ enum {
     WOLFSSL_CSR_OCSP_USE_NONCE = 0x01
 };
 
+#ifdef HAVE_CERTIFICATE_STATUS_REQUEST
+WOLFSSL_API int wolfSSL_UseOCSPStapling(WOLFSSL* ssl,
+                              unsigned char status_type, unsigned char options);
+
+WOLFSSL_API int wolfSSL_CTX_UseOCSPStapling(WOLFSSL_CTX* ctx,
+                              unsigned char status_type, unsigned char options);
+#endif
+
 
 /* Certificate Status Request v2 */
 /* Certificate Status Type */
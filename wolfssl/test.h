@@ -1844,6 +1844,15 @@ static WC_INLINE void mySessRemCb(WOLFSSL_CTX* ctx, WOLFSSL_SESSION* session)
 #endif /* HAVE_EXT_CACHE */
 
 
+#ifdef HAVE_CRL
+
+static WC_INLINE void CRL_CallBack(const char* url)
+{
+    printf("CRL callback url = %s\n", url);
+}
+
+#endif
+
 
 static WC_INLINE void SetDH(WOLFSSL* ssl)
 {
@@ -1117,6 +1117,31 @@ struct Base_entry {
 };
 
 
+#if !defined(NO_WOLFSSL_SIGNER_KEY_CACHE) && !defined(NO_ASN_CRYPT) && \
+    !defined(WOLFSSL_NO_ATOMIC_PTR) && !defined(WOLFSSL_ASYNC_CRYPT) && \
+    !defined(WC_RSA_NONBLOCK) && !defined(WC_ECC_NONBLOCK) && \
+    !defined(WOLFSSL_RENESAS_TSIP_TLS) && !defined(WOLFSSL_RENESAS_SCEPROTECT) && \
+    !defined(WOLFSSL_XILINX_CRYPT) && !defined(WOLFSSL_AFALG_XILINX_RSA) && \
+    !defined(WOLFSSL_KCAPI_RSA) && !defined(WOLFSSL_STM32_PKA) && \
+    !defined(WOLFSSL_PSOC6_CRYPTO) && !defined(WOLF_CRYPTO_CB_ONLY_RSA) && \
+    !defined(WOLF_CRYPTO_CB_ONLY_ECC)
+    /* Signer keeps its public key decoded after the first verify with it.
+     * Only software verify paths that don't write to the key qualify, as
+     * the decoded key is used by many threads at once. */
+    #define WOLFSSL_SIGNER_KEY_CACHE
+#endif
+
+#if defined(WOLFSSL_SIGNER_KEY_CACHE) && defined(HAVE_ECC) && \
+    !defined(NO_ECC_VERIFY) && !defined(NO_ECC_VERIFY_TABLE) && \
+    !defined(FREESCALE_LTC_ECC)
+    /* A signer's ECC key gets a verify comb table (WC_ECC_VERIFY_TABLE) on
+     * its WOLFSSL_SIGNER_VERIFY_TABLE_MIN'th verify. */
+    #ifndef WOLFSSL_SIGNER_VERIFY_TABLE_MIN
+        #define WOLFSSL_SIGNER_VERIFY_TABLE_MIN 8
+    #endif
+    #define WOLFSSL_SIGNER_VERIFY_TABLE
+#endif
+
 enum SignatureState {
     SIG_STATE_BEGIN,
     SIG_STATE_HASH,
@@ -1158,6 +1183,10 @@ struct SignatureCtx {
     int typeH;
     int digestSz;
     word32 keyOID;
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+    struct Signer* signer; /* set by caller when key is signer->publicKey */
+    byte    keyShared;     /* key is the signer's decoded key, not owned */
+#endif
 
 #if defined(WOLFSSL_RENESAS_TSIP_TLS) || defined(WOLFSSL_RENESAS_SCEPROTECT)
     CertAttribute  CertAtt;
@@ -1253,6 +1282,24 @@ typedef struct EncodedName {
     #define WOLFSSL_MAX_PATH_LEN 127
 #endif
 
+#ifndef NO_WOLFSSL_LAZY_CERT_DECODE
+    /* DecodedCert.decodeLazy leaves extensions not needed to verify a chain,
+     * and the issuer name string, to be decoded on first use */
+    #define WOLFSSL_LAZY_CERT_DECODE
+#endif
+
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+/* Extensions that a lazy parse records and decodes on demand */
+enum CertLazyExt {
+    CERT_LAZY_ALT_NAMES = 0,
+    CERT_LAZY_CRL_DIST,
+    CERT_LAZY_AUTH_INFO,
+    CERT_LAZY_EXT_KEY_USAGE,
+    CERT_LAZY_CERT_POLICY,
+    CERT_LAZY_EXT_COUNT
+};
+#endif
+
 typedef struct DecodedName DecodedName;
 typedef struct DecodedCert DecodedCert;
 typedef struct Signer      Signer;
@@ -1287,19 +1334,25 @@ struct DecodedCert {
 #endif /* IGNORE_NAME_CONSTRAINTS */
     byte    subjectHash[KEYID_SIZE]; /* hash of all Names                */
     byte    issuerHash[KEYID_SIZE];  /* hash of all Names                */
+#ifdef HAVE_OCSP
+    byte    subjectKeyHash[KEYID_SIZE]; /* hash of the public key        */
+    byte    issuerKeyHash[KEYID_SIZE]; /* hash of the issuer's public key */
+#endif /* HAVE_OCSP */
     const byte* signature;           /* not owned, points into raw cert  */
     char*   subjectCN;               /* CommonName                       */
     int     subjectCNLen;            /* CommonName Length                */
     char    subjectCNEnc;            /* CommonName Encoding              */
-    char    issuer[WC_ASN_NAME_MAX]; /* full name including common name  */
-    char    subject[WC_ASN_NAME_MAX];/* full name including common name  */
-    int     verify;                  /* Default to yes, but could be off */
+    char*   issuer;                  /* full name including common name,
+                                      * NULL until a name string is built */
+    char*   subject;                 /* full name including common name,
+                                      * shares the issuer allocation */
     const byte* source;              /* byte buffer holder cert, NOT owner */
     word32  srcIdx;                  /* current offset into buffer       */
     word32  maxIdx;                  /* max offset based on init size    */
     void*   heap;                    /* for user memory overrides        */
     byte    serial[EXTERNAL_SERIAL_SIZE];  /* raw serial number          */
     int     serialSz;                /* raw serial bytes stored */
+    int     verify;                  /* Default to yes, but could be off */
     const byte* extensions;          /* not owned, points into raw cert  */
     int     extensionsSz;            /* length of cert extensions */
     word32  extensionsIdx;           /* if want to go back and parse later */
@@ -1442,6 +1495,15 @@ struct DecodedCert {
     int badDate;
     int criticalExt;
 
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    word32  lazyExtIdx[CERT_LAZY_EXT_COUNT]; /* offset of deferred ext value */
+    word32  lazyExtSz[CERT_LAZY_EXT_COUNT];
+    word32  lazyIssuerIdx;           /* offset of issuer name not decoded */
+    word32  lazyIssuerEnd;
+    byte    lazyExtPending;          /* bit per CertLazyExt to decode */
+    byte    lazyExtCritical;         /* bit per CertLazyExt marked critical */
+#endif
+
     /* Option Bits */
     byte subjectCNStored : 1;      /* have we saved a copy we own */
     byte extSubjKeyIdSet : 1;      /* Set when the SKID was read from cert */
@@ -1472,6 +1534,10 @@ struct DecodedCert {
 #ifdef WOLFSSL_CERT_REQ
     byte isCSR : 1;                /* Do we intend on parsing a CSR? */
 #endif
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+    byte decodeLazy : 1;           /* defer decoding, set before parsing */
+    byte lazyIssuer : 1;           /* issuer name left to decode */
+#endif
 #if defined(WOLFSSL_CUSTOM_OID) && defined(WOLFSSL_ASN_TEMPLATE) \
     && defined(HAVE_OID_DECODING)
     wc_UnknownExtCallback unknownExtCallback;
@@ -1490,6 +1556,7 @@ struct Signer {
     byte    pathLength;
     byte    pathLengthSet : 1;
     byte    selfSigned : 1;
+    byte    inStore : 1;             /* owned by a cert cache store */
     const byte* publicKey;
     int     nameLen;
     char*   name;                    /* common name */
@@ -1503,11 +1570,24 @@ struct Signer {
         byte    subjectKeyIdHash[SIGNER_DIGEST_SIZE];
                                      /* sha hash of names in certificate */
     #endif
+    #ifdef HAVE_OCSP
+        byte    subjectKeyHash[KEYID_SIZE];
+                                     /* sha hash of public key, OCSP CertID */
+    #endif
 #ifdef WOLFSSL_SIGNER_DER_CERT
     DerBuffer* derCert;
 #endif
 #if defined(WOLFSSL_RENESAS_TSIP_TLS) || defined(WOLFSSL_RENESAS_SCEPROTECT)
     word32 cm_idx;
+#endif
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+    void*   pubKeyDecoded;           /* RsaKey or ecc_key by keyOID, built
+                                      * on first verify, read-only after */
+#endif
+#ifdef WOLFSSL_SIGNER_VERIFY_TABLE
+    void*   pubKeyTable;             /* ecc_key with a verify table, built
+                                      * once verifyCount reaches the min */
+    word32  verifyCount;             /* verifies with the key so far */
 #endif
     Signer* next;
 };
@@ -1579,7 +1659,14 @@ typedef enum MimeStatus
 
 
 WOLFSSL_LOCAL int CalcHashId(const byte* data, word32 len, byte* hash);
+#ifdef HAVE_OCSP
+WOLFSSL_LOCAL int CalcKeyHashId(const byte* key, word32 keySz, word32 keyOID,
+                                byte* hash);
+#endif
 WOLFSSL_LOCAL int GetName(DecodedCert* cert, int nameType, int maxIdx);
+#ifdef WOLFSSL_LAZY_CERT_DECODE
+WOLFSSL_LOCAL int DecodeCertDeferred(DecodedCert* cert, word32 oid);
+#endif
 
 WOLFSSL_ASN_API int wc_BerToDer(const byte* ber, word32 berSz, byte* der,
                                 word32* derSz);
@@ -1626,6 +1713,9 @@ WOLFSSL_LOCAL int wc_GetPubX509(DecodedCert* cert, int verify, int* badDate);
 WOLFSSL_LOCAL const byte* OidFromId(word32 id, word32 type, word32* oidSz);
 WOLFSSL_LOCAL Signer* MakeSigner(void* heap);
 WOLFSSL_LOCAL void    FreeSigner(Signer* signer, void* heap);
+#ifdef WOLFSSL_SIGNER_KEY_CACHE
+WOLFSSL_LOCAL void    FreeSignerPubKey(Signer* signer, void* heap);
+#endif
 WOLFSSL_LOCAL void    FreeSignerTable(Signer** table, int rows, void* heap);
 #ifdef WOLFSSL_TRUST_PEER_CERT
 WOLFSSL_LOCAL void    FreeTrustedPeer(TrustedPeerCert* tp, void* heap);
@@ -1816,11 +1906,166 @@ enum cert_enums {
 /* for pointer use */
 typedef struct CertStatus CertStatus;
 
+#ifdef HAVE_OCSP
+
+enum Ocsp_Response_Status {
+    OCSP_SUCCESSFUL        = 0, /* Response has valid confirmations */
+    OCSP_MALFORMED_REQUEST = 1, /* Illegal confirmation request */
+    OCSP_INTERNAL_ERROR    = 2, /* Internal error in issuer */
+    OCSP_TRY_LATER         = 3, /* Try again later */
+    OCSP_SIG_REQUIRED      = 5, /* Must sign the request (4 is skipped) */
+    OCSP_UNAUTHORIZED      = 6  /* Request unauthorized */
+};
+
+
+enum Ocsp_Cert_Status {
+    CERT_GOOD    = 0,
+    CERT_REVOKED = 1,
+    CERT_UNKNOWN = 2
+};
+
+
+enum Ocsp_Sums {
+    OCSP_BASIC_OID = 117,       /* 1.3.6.1.5.5.7.48.1.1 */
+    OCSP_NONCE_OID = 118        /* 1.3.6.1.5.5.7.48.1.2 */
+};
+
+#define OCSP_DIGEST_SIZE    KEYID_SIZE   /* CertID hashes are SHA-1 */
+#define OCSP_RESP_HASH_SIZE WC_SHA256_DIGEST_SIZE
+
+typedef struct OcspEntry    OcspEntry;
+typedef struct OcspRequest  OcspRequest;
+typedef struct OcspResponse OcspResponse;
+
+/* Status of one certificate from a verified response */
+struct CertStatus {
+    CertStatus* next;
+
+    byte serial[EXTERNAL_SERIAL_SIZE];
+    int  serialSz;
+
+    int  status;
+
+    byte thisDate[MAX_DATE_SIZE];
+    byte nextDate[MAX_DATE_SIZE];
+    byte thisDateFormat;
+    byte nextDateFormat;
+
+    /* SHA-256 of the whole response that gave this status, lets the same
+     * response be accepted again, e.g. stapled on another connection, without
+     * parsing or verifying it */
+    byte respHash[OCSP_RESP_HASH_SIZE];
+    byte respHashSet;
+};
+
+/* Issuer part of a CertID, statuses of the certificates it issued */
+struct OcspEntry {
+    OcspEntry*  next;                       /* next entry                */
+    word32      hashAlgoOID;                /* CertID hash algorithm     */
+    byte        issuerHash[OCSP_DIGEST_SIZE];    /* issuer name hash     */
+    byte        issuerKeyHash[OCSP_DIGEST_SIZE]; /* issuer public key hash */
+    CertStatus* status;                     /* list of statuses, owned   */
+    int         totalStatus;                /* number on list            */
+};
+
+struct OcspResponse {
+    int     responseStatus;  /* return code from Responder */
+
+    const byte* response;    /* tbsResponseData, points into source */
+    word32  responseSz;      /* length of the tbsResponseData */
+
+    byte    producedDate[MAX_DATE_SIZE];
+                             /* Date at which this response was signed */
+    byte    producedDateFormat; /* format of the producedDate */
+
+    word32  sigOID;          /* signature algorithm sum */
+    const byte* sig;         /* signature, points into source */
+    word32  sigSz;           /* length of the signature */
+
+    OcspEntry* single;       /* single responses, one status each, owned */
+
+    const byte* nonce;       /* nonce extension value, points into source */
+    int     nonceSz;         /* length of the nonce */
+
+    const byte* source;      /* DER formatted response, not owned */
+    word32  maxIdx;          /* size of source */
+    void*   heap;
+};
+
+struct OcspRequest {
+    byte   issuerHash[OCSP_DIGEST_SIZE];
+    byte   issuerKeyHash[OCSP_DIGEST_SIZE];
+    byte*  serial;   /* copy of the serial number in source cert */
+    int    serialSz;
+    byte*  url;      /* copy of the extAuthInfo in source cert */
+    int    urlSz;
+
+    byte   nonce[MAX_OCSP_NONCE_SZ];
+    int    nonceSz;
+    void*  heap;
+    void*  ssl;
+};
+
+WOLFSSL_LOCAL int  InitOcspRequest(OcspRequest* req, DecodedCert* cert,
+                                   byte useNonce, void* heap);
+WOLFSSL_LOCAL void FreeOcspRequest(OcspRequest* req);
+WOLFSSL_LOCAL int  EncodeOcspRequest(OcspRequest* req, byte* output,
+                                     word32 size);
+WOLFSSL_LOCAL word32 EncodeOcspRequestExtensions(OcspRequest* req,
+                                                 byte* output, word32 size);
+
+WOLFSSL_LOCAL void InitOcspResponse(OcspResponse* resp, const byte* source,
+                                    word32 inSz, void* heap);
+WOLFSSL_LOCAL int  OcspResponseDecode(OcspResponse* resp, void* cm,
+                                      int noVerify);
+WOLFSSL_LOCAL int  CompareOcspReqResp(OcspRequest* req, OcspResponse* resp);
+WOLFSSL_LOCAL void FreeOcspResponse(OcspResponse* resp);
+
+#endif /* HAVE_OCSP */
+
 
 
 /* for pointer use */
 typedef struct RevokedCert RevokedCert;
 
+#ifdef HAVE_CRL
+
+/* Revoked serial number, kept in a sorted array for binary search.
+ * Leading zero octet removed so serials compare by length then value. */
+struct RevokedCert {
+    byte    serialSz;
+    byte    serialNumber[EXTERNAL_SERIAL_SIZE];
+};
+
+typedef struct DecodedCRL DecodedCRL;
+
+struct DecodedCRL {
+    word32  certBegin;               /* offset to start of tbsCertList   */
+    word32  sigIndex;                /* offset to start of signature alg */
+    word32  sigLength;               /* length of signature              */
+    word32  signatureOID;            /* sum of algorithm object id       */
+    const byte* signature;           /* pointer into raw source, not owned */
+    byte    issuerHash[SIGNER_DIGEST_SIZE]; /* issuer name hash          */
+    byte    lastDate[MAX_DATE_SIZE]; /* last date updated  */
+    byte    nextDate[MAX_DATE_SIZE]; /* next update date   */
+    byte    lastDateFormat;          /* format of last date */
+    byte    nextDateFormat;          /* format of next date */
+    RevokedCert* certs;              /* revoked serials in CRL order, owned */
+    int     totalCerts;              /* number on list     */
+    void*   heap;                    /* heap hint          */
+#ifndef NO_SKID
+    byte    extAuthKeyIdSet;
+    byte    extAuthKeyId[SIGNER_DIGEST_SIZE]; /* Authority Key ID        */
+#endif
+};
+
+WOLFSSL_LOCAL void InitDecodedCRL(DecodedCRL* dcrl, void* heap);
+WOLFSSL_LOCAL int  ParseCRL(DecodedCRL* dcrl, const byte* buff, word32 sz,
+                            int verify, void* cm);
+WOLFSSL_LOCAL void FreeDecodedCRL(DecodedCRL* dcrl);
+
+#endif /* HAVE_CRL */
+
 
 
 #ifdef __cplusplus
@@ -638,13 +638,90 @@ WOLFSSL_API int wc_DhPrivKeyToDer(DhKey* key, byte* out, word32* outSz);
     WOLFSSL_API int wc_EccPublicKeyDerSize(ecc_key* key, int with_AlgCurve);
 
 /* RFC 5958 (Asymmetric Key Packages) */
-
-
-
-
-
-
-
+#if !defined(WC_ENABLE_ASYM_KEY_EXPORT) && \
+    ((defined(HAVE_ED25519)    && defined(HAVE_ED25519_KEY_EXPORT)) || \
+     (defined(HAVE_CURVE25519) && defined(HAVE_CURVE25519_KEY_EXPORT)) || \
+     (defined(HAVE_ED448)      && defined(HAVE_ED448_KEY_EXPORT)) || \
+     (defined(HAVE_CURVE448)   && defined(HAVE_CURVE448_KEY_EXPORT)))
+    #define WC_ENABLE_ASYM_KEY_EXPORT
+#endif
+#if !defined(WC_ENABLE_ASYM_KEY_IMPORT) && \
+    ((defined(HAVE_ED25519)    && defined(HAVE_ED25519_KEY_IMPORT)) || \
+     (defined(HAVE_CURVE25519) && defined(HAVE_CURVE25519_KEY_IMPORT)) || \
+     (defined(HAVE_ED448)      && defined(HAVE_ED448_KEY_IMPORT)) || \
+     (defined(HAVE_CURVE448)   && defined(HAVE_CURVE448_KEY_IMPORT)))
+    #define WC_ENABLE_ASYM_KEY_IMPORT
+#endif
+
+#ifdef HAVE_ED25519
+#ifdef HAVE_ED25519_KEY_IMPORT
+WOLFSSL_API int wc_Ed25519PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                                           ed25519_key* key, word32 inSz);
+WOLFSSL_API int wc_Ed25519PublicKeyDecode(const byte* input, word32* inOutIdx,
+                                          ed25519_key* key, word32 inSz);
+#endif
+#ifdef HAVE_ED25519_KEY_EXPORT
+WOLFSSL_API int wc_Ed25519KeyToDer(ed25519_key* key, byte* output,
+                                   word32 inLen);
+WOLFSSL_API int wc_Ed25519PrivateKeyToDer(ed25519_key* key, byte* output,
+                                          word32 inLen);
+WOLFSSL_API int wc_Ed25519PublicKeyToDer(ed25519_key* key, byte* output,
+                                         word32 inLen, int withAlg);
+#endif
+#endif /* HAVE_ED25519 */
+
+#ifdef HAVE_CURVE25519
+#ifdef HAVE_CURVE25519_KEY_IMPORT
+WOLFSSL_API int wc_Curve25519PrivateKeyDecode(const byte* input,
+                                    word32* inOutIdx, curve25519_key* key,
+                                    word32 inSz);
+WOLFSSL_API int wc_Curve25519PublicKeyDecode(const byte* input,
+                                    word32* inOutIdx, curve25519_key* key,
+                                    word32 inSz);
+#endif
+#ifdef HAVE_CURVE25519_KEY_EXPORT
+WOLFSSL_API int wc_Curve25519PrivateKeyToDer(curve25519_key* key,
+                                             byte* output, word32 inLen);
+WOLFSSL_API int wc_Curve25519PublicKeyToDer(curve25519_key* key,
+                                            byte* output, word32 inLen,
+                                            int withAlg);
+#endif
+#endif /* HAVE_CURVE25519 */
+
+#ifdef HAVE_ED448
+#ifdef HAVE_ED448_KEY_IMPORT
+WOLFSSL_API int wc_Ed448PrivateKeyDecode(const byte* input, word32* inOutIdx,
+                                         ed448_key* key, word32 inSz);
+WOLFSSL_API int wc_Ed448PublicKeyDecode(const byte* input, word32* inOutIdx,
+                                        ed448_key* key, word32 inSz);
+#endif
+#ifdef HAVE_ED448_KEY_EXPORT
+WOLFSSL_API int wc_Ed448KeyToDer(ed448_key* key, byte* output,
+                                 word32 inLen);
+WOLFSSL_API int wc_Ed448PrivateKeyToDer(ed448_key* key, byte* output,
+                                        word32 inLen);
+WOLFSSL_API int wc_Ed448PublicKeyToDer(ed448_key* key, byte* output,
+                                       word32 inLen, int withAlg);
+#endif
+#endif /* HAVE_ED448 */
+
+#ifdef HAVE_CURVE448
+#ifdef HAVE_CURVE448_KEY_IMPORT
+WOLFSSL_API int wc_Curve448PrivateKeyDecode(const byte* input,
+                                    word32* inOutIdx, curve448_key* key,
+                                    word32 inSz);
+WOLFSSL_API int wc_Curve448PublicKeyDecode(const byte* input,
+                                    word32* inOutIdx, curve448_key* key,
+                                    word32 inSz);
+#endif
+#ifdef HAVE_CURVE448_KEY_EXPORT
+WOLFSSL_API int wc_Curve448PrivateKeyToDer(curve448_key* key,
+                                           byte* output, word32 inLen);
+WOLFSSL_API int wc_Curve448PublicKeyToDer(curve448_key* key,
+                                          byte* output, word32 inLen,
+                                          int withAlg);
+#endif
+#endif /* HAVE_CURVE448 */
 
 /* DER encode signature */
 WOLFSSL_API word32 wc_EncodeSignature(byte* out, const byte* digest,
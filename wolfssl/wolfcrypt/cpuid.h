@@ -61,7 +61,7 @@
 
 #ifdef HAVE_CPUID
     void cpuid_set_flags(void);
-    word32 cpuid_get_flags(void);
+    WOLFSSL_API word32 cpuid_get_flags(void);
 
     /* Public APIs to modify flags. */
     WOLFSSL_API void cpuid_select_flags(word32 flags);
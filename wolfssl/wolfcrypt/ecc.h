@@ -254,12 +254,109 @@ enum {
 
 /* ECC non-blocking */
 #ifdef WC_ECC_NONBLOCK
+    /* Number of ladder steps (one double and one add) done per call when
+     * maxSteps is not set */
+    #ifndef WC_ECC_NB_STEPS
+        #define WC_ECC_NB_STEPS 16
+    #endif
+
     typedef struct ecc_nb_ctx {
-        /* build configuration not supported */
-        #error ECC non-blocking only supports SP (--enable-sp=nonblock)
+        int         state;      /* sub-state of the current operation */
+        int         bit;        /* next scalar bit for the ladder */
+        int         swap;       /* registers are swapped for the last bit */
+        word32      maxSteps;   /* ladder steps per call, 0 for default */
+        mp_digit    mp;         /* montgomery setup for the prime */
+        mp_int      k;          /* scalar plus order, fixed bit length */
+        ecc_point*  R[2];       /* ladder registers, NULL when idle */
+        ecc_point*  T;          /* first product of a two point multiply */
     } ecc_nb_ctx_t;
 #endif /* WC_ECC_NONBLOCK */
 
+/* P-256, P-384 and P-521 on the x86_64 assembly in sp_x86_64.c */
+#if defined(WOLFSSL_HAVE_SP_ECC) && defined(WOLFSSL_SP_X86_64_ASM)
+    #ifndef WOLFSSL_SP_NO_256
+        #define WOLFSSL_SP_ECC_256
+    #endif
+    #ifdef WOLFSSL_SP_384
+        #define WOLFSSL_SP_ECC_384
+    #endif
+    #ifdef WOLFSSL_SP_521
+        #define WOLFSSL_SP_ECC_521
+    #endif
+#endif
+
+/* ECC fixed base and verify tables */
+#if !defined(NO_ECC_FIXED_BASE) && !defined(FREESCALE_LTC_ECC) && \
+    !defined(WOLFSSL_STM32_PKA) && !defined(WOLFSSL_PSOC6_CRYPTO)
+    #define WC_ECC_FIXED_BASE
+#endif
+#if !defined(NO_ECC_VERIFY) && !defined(NO_ECC_VERIFY_TABLE) && \
+    !defined(WC_ECC_NONBLOCK) && !defined(FREESCALE_LTC_ECC) && \
+    !defined(WOLFSSL_STM32_PKA) && !defined(WOLFSSL_PSOC6_CRYPTO)
+    #define WC_ECC_VERIFY_TABLE
+#endif
+
+#ifdef WC_ECC_VERIFY_TABLE
+    /* Signed comb tables for verifying with one public key Q, see ecc.c */
+    typedef struct ecc_verify_table {
+        word32      spacing;    /* scalar bits between comb teeth */
+        word32      coordSz;    /* bytes in one coordinate */
+        byte*       qx;         /* affine x and y of Q the table was built for */
+        const byte* G;          /* comb of the base point, maybe static */
+        byte*       Q;          /* comb of the public key */
+    } ecc_verify_table;
+#endif /* WC_ECC_VERIFY_TABLE */
+
+/* ECDSA presignature pool */
+#if defined(HAVE_ECC_SIGN) && !defined(NO_ECC_PRESIGN) && \
+    !defined(WC_NO_RNG) && !defined(WC_ECC_NONBLOCK) && \
+    !defined(PLUTON_CRYPTO_ECC) && !defined(FREESCALE_LTC_ECC) && \
+    !defined(WOLFSSL_STM32_PKA) && !defined(WOLFSSL_PSOC6_CRYPTO)
+    #define WC_ECC_PRESIGN
+#endif
+
+#ifdef WC_ECC_PRESIGN
+    /* Entries in a pool set up with a depth of 0 */
+    #ifndef WC_ECC_PRESIGN_DEPTH
+        #define WC_ECC_PRESIGN_DEPTH     8
+    #endif
+    /* Refill is requested once fewer than this many entries are left */
+    #ifndef WC_ECC_PRESIGN_LOW_WATER
+        #define WC_ECC_PRESIGN_LOW_WATER (WC_ECC_PRESIGN_DEPTH / 2)
+    #endif
+    /* Entries made before a fork() are dropped by the child */
+    #if defined(WOLFSSL_PTHREADS) && !defined(USE_WINDOWS_API) && \
+        !defined(NO_ECC_PRESIGN_PID)
+        #define WC_ECC_PRESIGN_PID
+        #include <unistd.h>     /* getpid() */
+    #endif
+
+    /* One nonce prepared ahead of signing: k^-1 mod n and r = (k.G).x mod n,
+     * big-endian and zero padded to the order size */
+    typedef struct ecc_presign {
+        byte kinv[MAX_ECC_BYTES];
+        byte r[MAX_ECC_BYTES];
+    } ecc_presign;
+
+    /* Called by the signer when the pool drops below its low watermark */
+    typedef void (*wc_EccPresignCb)(ecc_key* key, void* ctx);
+
+    /* Presignatures for a long-lived signing key, see ecc.c */
+    typedef struct ecc_presign_pool {
+        ecc_presign*        entries;
+        word32              depth;      /* number of entries allocated */
+        word32              count;      /* number of entries ready to use */
+        word32              lowWater;   /* refill wanted below this count */
+        const ecc_set_type* dp;         /* curve the entries were made for */
+        wc_EccPresignCb     cb;
+        void*               cbCtx;
+    #ifdef WC_ECC_PRESIGN_PID
+        pid_t               pid;        /* process the entries were made in */
+    #endif
+        wolfSSL_Mutex       lock;
+    } ecc_presign_pool;
+#endif /* WC_ECC_PRESIGN */
+
 
 /* An ECC Key */
 struct ecc_key {
@@ -306,6 +403,12 @@ struct ecc_key {
 #ifdef WC_ECC_NONBLOCK
     ecc_nb_ctx_t* nb_ctx;
 #endif
+#ifdef WC_ECC_VERIFY_TABLE
+    ecc_verify_table* verifyTable;
+#endif
+#ifdef WC_ECC_PRESIGN
+    ecc_presign_pool* presign;
+#endif
 };
 
 
@@ -332,6 +435,8 @@ ECC_API int ecc_mul2add(ecc_point* A, mp_int* kA,
 
 ECC_API int ecc_map(ecc_point* P, mp_int* modulus, mp_digit mp);
 ECC_API int ecc_map_ex(ecc_point* P, mp_int* modulus, mp_digit mp, int ct);
+ECC_API int ecc_map_batch(ecc_point** P, int n, mp_int* modulus, mp_digit mp,
+                          int mont, void* heap);
 ECC_API int ecc_projective_add_point(ecc_point* P, ecc_point* Q, ecc_point* R,
                                      mp_int* a, mp_int* modulus, mp_digit mp);
 ECC_API int ecc_projective_dbl_point(ecc_point* P, ecc_point* R, mp_int* a,
@@ -660,6 +765,20 @@ int sp_dsp_ecc_verify_256(remote_handle64 handle, const byte* hash, word32 hashL
     WOLFSSL_API int wc_ecc_set_nonblock(ecc_key *key, ecc_nb_ctx_t* ctx);
 #endif
 
+#ifdef WC_ECC_VERIFY_TABLE
+    WOLFSSL_API int wc_ecc_make_verify_table(ecc_key* key);
+#endif
+
+#ifdef WC_ECC_PRESIGN
+    WOLFSSL_API int wc_ecc_presign_init(ecc_key* key, word32 depth,
+                                        word32 lowWater);
+    WOLFSSL_API int wc_ecc_presign_set_cb(ecc_key* key, wc_EccPresignCb cb,
+                                          void* ctx);
+    WOLFSSL_API int wc_ecc_presign_fill(ecc_key* key, WC_RNG* rng, word32 max);
+    WOLFSSL_API int wc_ecc_presign_count(ecc_key* key);
+    WOLFSSL_API void wc_ecc_presign_free(ecc_key* key);
+#endif
+
 #ifdef __cplusplus
     }    /* extern "C" */
 #endif
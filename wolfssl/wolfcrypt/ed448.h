@@ -29,4 +29,145 @@
 
 #include <wolfssl/wolfcrypt/types.h>
 
+#ifdef HAVE_ED448
+
+#include <wolfssl/wolfcrypt/fe_448.h>
+#include <wolfssl/wolfcrypt/ge_448.h>
+#include <wolfssl/wolfcrypt/random.h>
+#include <wolfssl/wolfcrypt/sha3.h>
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+
+/* info about EdDSA curve specifically ed448, defined as an elliptic curve
+   over GF(p) */
+/*
+    56,                key size
+    "ED448",           curve name
+    "2^448-2^224-1",   prime number
+    "SHAKE256",        hash function
+    "-39081",          value of d
+*/
+
+#define ED448_KEY_SIZE     57 /* private key only */
+#define ED448_SIG_SIZE     114
+
+#define ED448_PUB_KEY_SIZE 57 /* compressed */
+/* both private and public key */
+#define ED448_PRV_KEY_SIZE (ED448_PUB_KEY_SIZE+ED448_KEY_SIZE)
+
+#define ED448_PREHASH_SIZE 64
+
+enum {
+    Ed448    = 0,
+    Ed448ph  = 1
+};
+
+#ifndef WC_ED448KEY_TYPE_DEFINED
+    typedef struct ed448_key ed448_key;
+    #define WC_ED448KEY_TYPE_DEFINED
+#endif
+
+/* An ED448 Key */
+struct ed448_key {
+    byte    p[ED448_PUB_KEY_SIZE]; /* compressed public key */
+    byte    k[ED448_PRV_KEY_SIZE]; /* private key : 57 secret -- 57 public */
+    word16  privKeySet:1;
+    word16  pubKeySet:1;
+    void   *heap;
+};
+
+
+WOLFSSL_API
+int wc_ed448_make_public(ed448_key* key, unsigned char* pubKey,
+                         word32 pubKeySz);
+WOLFSSL_API
+int wc_ed448_make_key(WC_RNG* rng, int keysize, ed448_key* key);
+#ifdef HAVE_ED448_SIGN
+WOLFSSL_API
+int wc_ed448_sign_msg(const byte* in, word32 inLen, byte* out, word32 *outLen,
+                      ed448_key* key, const byte* context, byte contextLen);
+WOLFSSL_API
+int wc_ed448ph_sign_hash(const byte* hash, word32 hashLen, byte* out,
+                         word32 *outLen, ed448_key* key,
+                         const byte* context, byte contextLen);
+WOLFSSL_API
+int wc_ed448ph_sign_msg(const byte* in, word32 inLen, byte* out,
+                        word32 *outLen, ed448_key* key, const byte* context,
+                        byte contextLen);
+WOLFSSL_API
+int wc_ed448_sign_msg_ex(const byte* in, word32 inLen, byte* out,
+                         word32 *outLen, ed448_key* key, byte type,
+                         const byte* context, byte contextLen);
+#endif /* HAVE_ED448_SIGN */
+#ifdef HAVE_ED448_VERIFY
+WOLFSSL_API
+int wc_ed448_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                        word32 msgLen, int* res, ed448_key* key,
+                        const byte* context, byte contextLen);
+WOLFSSL_API
+int wc_ed448ph_verify_hash(const byte* sig, word32 sigLen, const byte* hash,
+                           word32 hashLen, int* res, ed448_key* key,
+                           const byte* context, byte contextLen);
+WOLFSSL_API
+int wc_ed448ph_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
+                          word32 msgLen, int* res, ed448_key* key,
+                          const byte* context, byte contextLen);
+WOLFSSL_API
+int wc_ed448_verify_msg_ex(const byte* sig, word32 sigLen, const byte* msg,
+                           word32 msgLen, int* res, ed448_key* key,
+                           byte type, const byte* context, byte contextLen);
+#endif /* HAVE_ED448_VERIFY */
+
+
+WOLFSSL_API
+int wc_ed448_init(ed448_key* key);
+WOLFSSL_API
+int wc_ed448_init_ex(ed448_key* key, void* heap, int devId);
+WOLFSSL_API
+void wc_ed448_free(ed448_key* key);
+#ifdef HAVE_ED448_KEY_IMPORT
+WOLFSSL_API
+int wc_ed448_import_public(const byte* in, word32 inLen, ed448_key* key);
+WOLFSSL_API
+int wc_ed448_import_private_only(const byte* priv, word32 privSz,
+                                 ed448_key* key);
+WOLFSSL_API
+int wc_ed448_import_private_key(const byte* priv, word32 privSz,
+                                const byte* pub, word32 pubSz, ed448_key* key);
+#endif /* HAVE_ED448_KEY_IMPORT */
+
+#ifdef HAVE_ED448_KEY_EXPORT
+WOLFSSL_API
+int wc_ed448_export_public(ed448_key* key, byte* out, word32* outLen);
+WOLFSSL_API
+int wc_ed448_export_private_only(ed448_key* key, byte* out, word32* outLen);
+WOLFSSL_API
+int wc_ed448_export_private(ed448_key* key, byte* out, word32* outLen);
+WOLFSSL_API
+int wc_ed448_export_key(ed448_key* key,
+                        byte* priv, word32 *privSz,
+                        byte* pub, word32 *pubSz);
+#endif /* HAVE_ED448_KEY_EXPORT */
+
+WOLFSSL_API
+int wc_ed448_check_key(ed448_key* key);
+
+/* size helper */
+WOLFSSL_API
+int wc_ed448_size(ed448_key* key);
+WOLFSSL_API
+int wc_ed448_priv_size(ed448_key* key);
+WOLFSSL_API
+int wc_ed448_pub_size(ed448_key* key);
+WOLFSSL_API
+int wc_ed448_sig_size(ed448_key* key);
+
+#ifdef __cplusplus
+    }    /* extern "C" */
+#endif
+
+#endif /* HAVE_ED448 */
 #endif /* WOLF_CRYPT_ED448_H */
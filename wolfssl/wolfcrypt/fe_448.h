@@ -20,10 +20,65 @@
  */
 
 
+
 #ifndef WOLF_CRYPT_FE_448_H
 #define WOLF_CRYPT_FE_448_H
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#if defined(HAVE_CURVE448) || defined(HAVE_ED448)
+
+#include <wolfssl/wolfcrypt/types.h>
+
+#if (defined(HAVE___UINT128_T) || defined(__SIZEOF_INT128__)) && \
+    !defined(NO_CURVED448_128BIT)
+    #define CURVED448_128BIT
+#endif
+
+#ifndef CURVED448_128BIT
+    #error Curve448 field math requires __uint128_t
+#endif
+
+/*
+fe448 means field element.
+Here the field is \Z/(2^448 - 2^224 - 1).
+An element t, entries t[0]...t[7], represents the integer
+t[0]+2^56 t[1]+2^112 t[2]+...+2^392 t[7].
+Each t[i] is kept a little over 56 bits between operations; values are only
+fully reduced when converted to bytes.
+*/
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+typedef word64 fe448[8];
+
+WOLFSSL_LOCAL void fe448_init(void);
+
+WOLFSSL_LOCAL int  curve448(byte* r, const byte* n, const byte* a);
+
+WOLFSSL_LOCAL void fe448_0(fe448 r);
+WOLFSSL_LOCAL void fe448_1(fe448 r);
+WOLFSSL_LOCAL void fe448_copy(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_from_bytes(fe448 r, const unsigned char* b);
+WOLFSSL_LOCAL void fe448_to_bytes(unsigned char* b, const fe448 a);
+WOLFSSL_LOCAL int  fe448_isnonzero(const fe448 a);
+WOLFSSL_LOCAL int  fe448_isnegative(const fe448 a);
+WOLFSSL_LOCAL void fe448_neg(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_add(fe448 r, const fe448 a, const fe448 b);
+WOLFSSL_LOCAL void fe448_sub(fe448 r, const fe448 a, const fe448 b);
+WOLFSSL_LOCAL void fe448_mul(fe448 r, const fe448 a, const fe448 b);
+WOLFSSL_LOCAL void fe448_sqr(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_mul39081(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_invert(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_pow_2_446_222_1(fe448 r, const fe448 a);
+WOLFSSL_LOCAL void fe448_cmov(fe448 r, const fe448 a, int c);
+
+#ifdef __cplusplus
+    } /* extern "C" */
+#endif
+
+#endif /* HAVE_CURVE448 || HAVE_ED448 */
 
 #endif /* WOLF_CRYPT_FE_448_H */
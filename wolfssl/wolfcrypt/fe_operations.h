@@ -25,5 +25,107 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#if defined(HAVE_CURVE25519) || defined(HAVE_ED25519)
+
+#include <wolfssl/wolfcrypt/types.h>
+
+#if defined(USE_INTEL_SPEEDUP) && !defined(NO_CURVED25519_X64)
+    #define CURVED25519_X64
+#elif (defined(HAVE___UINT128_T) || defined(__SIZEOF_INT128__)) && \
+      !defined(NO_CURVED25519_128BIT)
+    #define CURVED25519_128BIT
+#endif
+
+#if defined(CURVED25519_X64)
+    #define CURVED25519_ASM_64BIT
+    #define CURVED25519_ASM
+#endif
+
+#if !defined(CURVED25519_ASM_64BIT) && !defined(CURVED25519_128BIT)
+    #error Curve25519 field math requires USE_INTEL_SPEEDUP or __uint128_t
+#endif
+
+/*
+fe means field element.
+Here the field is \Z/(2^255-19).
+With CURVED25519_128BIT an element t, entries t[0]...t[4], represents the
+integer t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+With CURVED25519_ASM_64BIT an element is four 64-bit words, little endian.
+Bounds on each t[i] vary depending on context.
+*/
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#ifdef CURVED25519_ASM_64BIT
+    typedef sword64  fe[4];
+#else
+    typedef sword64  fe[5];
+#endif
+
+WOLFSSL_LOCAL void fe_init(void);
+
+WOLFSSL_LOCAL int  curve25519(byte * q, const byte * n, const byte * p);
+
+WOLFSSL_LOCAL void fe_copy(fe h,const fe f);
+WOLFSSL_LOCAL void fe_add(fe h,const fe f,const fe g);
+WOLFSSL_LOCAL void fe_neg(fe h,const fe f);
+WOLFSSL_LOCAL void fe_sub(fe h,const fe f,const fe g);
+WOLFSSL_LOCAL void fe_invert(fe out,const fe z);
+WOLFSSL_LOCAL void fe_mul(fe h,const fe f,const fe g);
+
+/* Based On Daniel J Bernstein's curve25519 and ed25519 Public Domain ref10
+   work. */
+
+WOLFSSL_LOCAL void fe_0(fe h);
+WOLFSSL_LOCAL void fe_1(fe h);
+WOLFSSL_LOCAL int  fe_isnonzero(const fe f);
+WOLFSSL_LOCAL int  fe_isnegative(const fe f);
+WOLFSSL_LOCAL void fe_tobytes(unsigned char *s,const fe h);
+WOLFSSL_LOCAL void fe_sq(fe h,const fe f);
+WOLFSSL_LOCAL void fe_sq2(fe h,const fe f);
+WOLFSSL_LOCAL void fe_frombytes(fe h,const unsigned char *s);
+WOLFSSL_LOCAL void fe_mul121666(fe h,fe f);
+WOLFSSL_LOCAL void fe_cmov(fe f, const fe g, int b);
+WOLFSSL_LOCAL void fe_pow22523(fe out,const fe z);
+
+#ifdef CURVED25519_ASM
+WOLFSSL_LOCAL void fe_ge_to_p2(fe rx, fe ry, fe rz, const fe px, const fe py,
+                               const fe pz, const fe pt);
+WOLFSSL_LOCAL void fe_ge_to_p3(fe rx, fe ry, fe rz, fe rt, const fe px,
+                               const fe py, const fe pz, const fe pt);
+WOLFSSL_LOCAL void fe_ge_dbl(fe rx, fe ry, fe rz, fe rt, const fe px,
+                             const fe py, const fe pz);
+WOLFSSL_LOCAL void fe_ge_madd(fe rx, fe ry, fe rz, fe rt, const fe px,
+                              const fe py, const fe pz, const fe pt,
+                              const fe qxy2d, const fe qyplusx,
+                              const fe qyminusx);
+WOLFSSL_LOCAL void fe_ge_msub(fe rx, fe ry, fe rz, fe rt, const fe px,
+                              const fe py, const fe pz, const fe pt,
+                              const fe qxy2d, const fe qyplusx,
+                              const fe qyminusx);
+WOLFSSL_LOCAL void fe_ge_add(fe rx, fe ry, fe rz, fe rt, const fe px,
+                             const fe py, const fe pz, const fe pt,
+                             const fe qz, const fe qt2d, const fe qyplusx,
+                             const fe qyminusx);
+WOLFSSL_LOCAL void fe_ge_sub(fe rx, fe ry, fe rz, fe rt, const fe px,
+                             const fe py, const fe pz, const fe pt,
+                             const fe qz, const fe qt2d, const fe qyplusx,
+                             const fe qyminusx);
+WOLFSSL_LOCAL void fe_cmov_table(fe* r, fe* base, signed char b);
+#else
+WOLFSSL_LOCAL void fe_cswap(fe f, fe g, int b);
+
+/* 64 type needed for SHA512 */
+WOLFSSL_LOCAL word64 load_3(const unsigned char *in);
+WOLFSSL_LOCAL word64 load_4(const unsigned char *in);
+#endif /* CURVED25519_ASM */
+
+#ifdef __cplusplus
+    } /* extern "C" */
+#endif
+
+#endif /* HAVE_CURVE25519 || HAVE_ED25519 */
 
 #endif /* WOLF_CRYPT_FE_OPERATIONS_H */
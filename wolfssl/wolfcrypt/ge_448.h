@@ -25,5 +25,54 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#ifdef HAVE_ED448
+
+#include <wolfssl/wolfcrypt/fe_448.h>
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+/*
+ge448 means group element.
+
+Here the group is the set of pairs (x,y) of field elements (see fe_448.h)
+satisfying x^2 + y^2 = 1 + d x^2y^2
+where d = -39081.
+
+Representations:
+  ge448_p2 (projective): (X:Y:Z) satisfying x=X/Z, y=Y/Z
+  ge448_precomp (affine): (x,y)
+*/
+
+typedef struct {
+    fe448 X;
+    fe448 Y;
+    fe448 Z;
+} ge448_p2;
+
+typedef struct {
+    fe448 x;
+    fe448 y;
+} ge448_precomp;
+
+WOLFSSL_LOCAL int  ge448_compress_key(byte* out, const byte* xIn,
+                                      const byte* yIn, word32 keySz);
+WOLFSSL_LOCAL int  ge448_from_bytes_negate_vartime(ge448_p2* r, const byte* b);
+
+WOLFSSL_LOCAL int  ge448_double_scalarmult_vartime(ge448_p2* r, const byte* a,
+                                                   const ge448_p2* A,
+                                                   const byte* b);
+WOLFSSL_LOCAL int  ge448_scalarmult_base(ge448_p2* r, const byte* a);
+WOLFSSL_LOCAL void sc448_reduce(byte* b);
+WOLFSSL_LOCAL void sc448_muladd(byte* r, const byte* a, const byte* b,
+                                const byte* d);
+WOLFSSL_LOCAL void ge448_to_bytes(byte* b, const ge448_p2* p);
+
+#ifdef __cplusplus
+    }    /* extern "C" */
+#endif
+
+#endif /* HAVE_ED448 */
 
 #endif /* WOLF_CRYPT_GE_448_H */
@@ -27,5 +27,85 @@
 
 #include <wolfssl/wolfcrypt/settings.h>
 
+#ifdef HAVE_ED25519
+
+#include <wolfssl/wolfcrypt/fe_operations.h>
+
+/*
+ge means group element.
+
+Here the group is the set of pairs (x,y) of field elements (see fe_operations.h)
+satisfying -x^2 + y^2 = 1 + d x^2y^2
+where d = -121665/121666.
+
+Representations:
+  ge_p2 (projective): (X:Y:Z) satisfying x=X/Z, y=Y/Z
+  ge_p3 (extended): (X:Y:Z:T) satisfying x=X/Z, y=Y/Z, XY=ZT
+  ge_p1p1 (completed): ((X:Z),(Y:T)) satisfying x=X/Z, y=Y/T
+  ge_precomp (Duif): (y+x,y-x,2dxy)
+*/
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+typedef fe ge;
+
+typedef struct {
+  ge X;
+  ge Y;
+  ge Z;
+} ge_p2;
+
+typedef struct {
+  ge X;
+  ge Y;
+  ge Z;
+  ge T;
+} ge_p3;
+
+typedef struct {
+  ge X;
+  ge Y;
+  ge Z;
+  ge T;
+} ge_p1p1;
+
+typedef struct {
+  ge yplusx;
+  ge yminusx;
+  ge xy2d;
+} ge_precomp;
+
+typedef struct {
+  ge YplusX;
+  ge YminusX;
+  ge Z;
+  ge T2d;
+} ge_cached;
+
+WOLFSSL_LOCAL int  ge_compress_key(byte* out, const byte* xIn, const byte* yIn,
+                                   word32 keySz);
+WOLFSSL_LOCAL int  ge_frombytes_negate_vartime(ge_p3 *h,const unsigned char *s);
+
+WOLFSSL_LOCAL int  ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a,
+                                         const ge_p3 *A, const unsigned char *b);
+WOLFSSL_LOCAL void ge_scalarmult_base(ge_p3 *h,const unsigned char *a);
+#ifdef HAVE_ED25519_VERIFY
+WOLFSSL_LOCAL int  ge_multi_scalarmult_vartime(ge_p3 *r, const unsigned char *s,
+                                               const ge_p3 *P, int n,
+                                               void* heap);
+#endif
+WOLFSSL_LOCAL void sc_reduce(byte* s);
+WOLFSSL_LOCAL void sc_muladd(byte* s, const byte* a, const byte* b,
+                             const byte* c);
+WOLFSSL_LOCAL void ge_tobytes(unsigned char *s,const ge_p2 *h);
+WOLFSSL_LOCAL void ge_p3_tobytes(unsigned char *s,const ge_p3 *h);
+
+#ifdef __cplusplus
+    } /* extern "C" */
+#endif
+
+#endif /* HAVE_ED25519 */
 
 #endif /* WOLF_CRYPT_GE_OPERATIONS_H */
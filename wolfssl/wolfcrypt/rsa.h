@@ -332,6 +332,10 @@ WOLFSSL_LOCAL int wc_RsaUnPad_ex(byte* pkcsBlock, word32 pkcsBlockLen, byte** ou
                                    int mgf, byte* optLabel, word32 labelLen, int saltLen,
                                    int bits, void* heap);
 
+#ifndef WOLF_CRYPTO_CB_ONLY_RSA
+WOLFSSL_LOCAL int wc_RsaSSL_VerifyInlineShared(byte* in, word32 inLen,
+                                               byte** out, RsaKey* key);
+#endif
 WOLFSSL_LOCAL int wc_hash2mgf(enum wc_HashType hType);
 
 #endif /* HAVE_USER_RSA */
@@ -25,7 +25,8 @@
 
 #include <wolfssl/wolfcrypt/types.h>
 
-#if defined(WOLFSSL_HAVE_SP_RSA) || defined(WOLFSSL_HAVE_SP_DH)
+#if defined(WOLFSSL_HAVE_SP_RSA) || defined(WOLFSSL_HAVE_SP_DH) || \
+    defined(WOLFSSL_HAVE_SP_ECC)
 #ifdef _WIN32_WCE
     typedef __int8           int8_t;
     typedef __int32          int32_t;
@@ -117,6 +118,50 @@ WOLFSSL_LOCAL int sp_DhExp_4096(const mp_int* base, const byte* exp,
 
 #endif /* WOLFSSL_HAVE_SP_DH */
 
+#ifdef WOLFSSL_SP_ECC_256
+
+WOLFSSL_LOCAL int sp_ecc_mulmod_base_256(const mp_int* km, ecc_point* r,
+    int map, void* heap);
+WOLFSSL_LOCAL int sp_ecc_secret_gen_256(const mp_int* priv,
+    const ecc_point* pub, byte* out, word32* outLen, void* heap);
+WOLFSSL_LOCAL int sp_ecc_sign_256(const byte* hash, word32 hashLen,
+    WC_RNG* rng, const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+    void* heap);
+WOLFSSL_LOCAL int sp_ecc_verify_256(const byte* hash, word32 hashLen,
+    const mp_int* pX, const mp_int* pY, const mp_int* pZ, const mp_int* rm,
+    const mp_int* sm, int* res, void* heap);
+
+#endif /* WOLFSSL_SP_ECC_256 */
+
+#ifdef WOLFSSL_SP_ECC_384
+
+WOLFSSL_LOCAL int sp_ecc_mulmod_base_384(const mp_int* km, ecc_point* r,
+    int map, void* heap);
+WOLFSSL_LOCAL int sp_ecc_secret_gen_384(const mp_int* priv,
+    const ecc_point* pub, byte* out, word32* outLen, void* heap);
+WOLFSSL_LOCAL int sp_ecc_sign_384(const byte* hash, word32 hashLen,
+    WC_RNG* rng, const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+    void* heap);
+WOLFSSL_LOCAL int sp_ecc_verify_384(const byte* hash, word32 hashLen,
+    const mp_int* pX, const mp_int* pY, const mp_int* pZ, const mp_int* rm,
+    const mp_int* sm, int* res, void* heap);
+
+#endif /* WOLFSSL_SP_ECC_384 */
+
+#ifdef WOLFSSL_SP_ECC_521
+
+WOLFSSL_LOCAL int sp_ecc_mulmod_base_521(const mp_int* km, ecc_point* r,
+    int map, void* heap);
+WOLFSSL_LOCAL int sp_ecc_secret_gen_521(const mp_int* priv,
+    const ecc_point* pub, byte* out, word32* outLen, void* heap);
+WOLFSSL_LOCAL int sp_ecc_sign_521(const byte* hash, word32 hashLen,
+    WC_RNG* rng, const mp_int* priv, mp_int* rm, mp_int* sm, mp_int* km,
+    void* heap);
+WOLFSSL_LOCAL int sp_ecc_verify_521(const byte* hash, word32 hashLen,
+    const mp_int* pX, const mp_int* pY, const mp_int* pZ, const mp_int* rm,
+    const mp_int* sm, int* res, void* heap);
+
+#endif /* WOLFSSL_SP_ECC_521 */
 
 
 #ifdef __cplusplus
@@ -627,6 +627,42 @@ extern "C" {
 #define MP_INT_NEXT(t, cnt) \
         (sp_int*)(((byte*)(t)) + MP_INT_SIZEOF(cnt))
 
+/* The number of digits needed for a number of 'bits' bits and the product of
+ * two of them, plus one for Montgomery reduction. Limited to SP_INT_DIGITS.
+ */
+#define MP_BITS_CNT(bits) \
+    ((int)(MP_BITS_CNT_NO_LIMIT(bits) < SP_INT_DIGITS ? \
+           MP_BITS_CNT_NO_LIMIT(bits) : SP_INT_DIGITS))
+#define MP_BITS_CNT_NO_LIMIT(bits) \
+    ((((bits) + SP_WORD_SIZE - 1) / SP_WORD_SIZE) * 2 + 1)
+/* The number of bytes to a sp_int that holds numbers of 'bits' bits. */
+#define MP_INT_SIZEOF_BITS(bits)    MP_INT_SIZEOF(MP_BITS_CNT(bits))
+/* The number of digits that cover a sp_int with 'cnt' digits. */
+#define MP_INT_SIZEOF_DIGITS(cnt) \
+    ((MP_INT_SIZEOF(cnt) + sizeof(sp_int_digit) - 1) / sizeof(sp_int_digit))
+
+/* DECL_MP_INT_SIZE: Declare a sp_int, on the stack, only big enough for
+ * numbers of 'bits' bits. Initialize with INIT_MP_INT_SIZE().
+ */
+#define DECL_MP_INT_SIZE(name, bits)                                     \
+    sp_int_digit name##d[MP_INT_SIZEOF_DIGITS(MP_BITS_CNT(bits))];       \
+    sp_int* (name) = (sp_int*)name##d
+
+/* DECL_MP_INT_SIZE_DYN: Declare a sp_int for numbers of 'bits' bits where
+ * 'bits' is only known at runtime. Uses the maximum, 'max', when variable
+ * length arrays are not available.
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L) && \
+    !defined(WOLFSSL_SP_NO_DYN_STACK)
+    #define DECL_MP_INT_SIZE_DYN(name, bits, max)  DECL_MP_INT_SIZE(name, bits)
+#else
+    #define DECL_MP_INT_SIZE_DYN(name, bits, max)  DECL_MP_INT_SIZE(name, max)
+#endif
+
+/* INIT_MP_INT_SIZE: Initialize a sp_int declared for numbers of 'bits' bits.
+ */
+#define INIT_MP_INT_SIZE(name, bits)    mp_init_size(name, MP_BITS_CNT(bits))
+
 /**
  * A reuslt of NO.
  * e.g. Is prime? NO.
@@ -749,7 +785,7 @@ MP_API int sp_init_copy (sp_int* r, sp_int* a);
 
 MP_API int sp_copy(const sp_int* a, sp_int* r);
 MP_API int sp_exch(sp_int* a, sp_int* b);
-MP_API int sp_cond_swap_ct(mp_int * a, mp_int * b, int c, int m);
+MP_API int sp_cond_swap_ct(sp_int* a, sp_int* b, int c, int m);
 
 #ifdef WOLFSSL_SP_INT_NEGATIVE
 MP_API int sp_abs(sp_int* a, sp_int* b);
@@ -810,6 +846,7 @@ MP_API int sp_mulmod(sp_int* a, sp_int* b, sp_int* m, sp_int* r);
 MP_API int sp_invmod(sp_int* a, sp_int* m, sp_int* r);
 #if defined(WOLFSSL_SP_MATH_ALL)
 MP_API int sp_invmod_mont_ct(sp_int* a, sp_int* m, sp_int* r, sp_int_digit mp);
+MP_API int sp_invmod_ct(sp_int* a, sp_int* m, sp_int* r);
 #endif
 
 MP_API int sp_exptmod_ex(sp_int* b, sp_int* e, int digits, sp_int* m,
@@ -925,6 +962,7 @@ WOLFSSL_API word32 CheckRunTimeFastMath(void);
 #define mp_mulmod                           sp_mulmod
 #define mp_invmod                           sp_invmod
 #define mp_invmod_mont_ct                   sp_invmod_mont_ct
+#define mp_invmod_ct                        sp_invmod_ct
 #define mp_exptmod_ex                       sp_exptmod_ex
 #define mp_exptmod                          sp_exptmod
 #define mp_exptmod_nct                      sp_exptmod_nct
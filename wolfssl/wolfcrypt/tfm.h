@@ -557,6 +557,8 @@ int fp_sqrmod(fp_int *a, fp_int *b, fp_int *c);
 /* c = 1/a (mod b) */
 int fp_invmod(fp_int *a, fp_int *b, fp_int *c);
 int fp_invmod_mont_ct(fp_int *a, fp_int *b, fp_int *c, fp_digit mp);
+/* c = 1/a (mod b) - constant time, b an odd prime */
+int fp_invmod_ct(fp_int *a, fp_int *b, fp_int *c);
 
 /* c = (a, b) */
 /*int fp_gcd(fp_int *a, fp_int *b, fp_int *c);*/
@@ -753,6 +755,12 @@ MP_API void mp_forcezero (mp_int * a);
 MP_API int  mp_init_multi(mp_int* a, mp_int* b, mp_int* c, mp_int* d, mp_int* e,
                          mp_int* f);
 
+/* fp_ints are always FP_SIZE digits - size hints are ignored. */
+#define MP_INT_SIZEOF_BITS(bits)                sizeof(mp_int)
+#define DECL_MP_INT_SIZE(name, bits)            mp_int name[1]
+#define DECL_MP_INT_SIZE_DYN(name, bits, max)   mp_int name[1]
+#define INIT_MP_INT_SIZE(name, bits)            mp_init(name)
+
 MP_API int  mp_add (mp_int * a, mp_int * b, mp_int * c);
 MP_API int  mp_sub (mp_int * a, mp_int * b, mp_int * c);
 MP_API int  mp_add_d (mp_int * a, mp_digit b, mp_int * c);
@@ -767,6 +775,7 @@ MP_API int  mp_addmod_ct (mp_int* a, mp_int* b, mp_int* c, mp_int* d);
 MP_API int  mp_mod(mp_int *a, mp_int *b, mp_int *c);
 MP_API int  mp_invmod(mp_int *a, mp_int *b, mp_int *c);
 MP_API int  mp_invmod_mont_ct(mp_int *a, mp_int *b, mp_int *c, fp_digit mp);
+MP_API int  mp_invmod_ct(mp_int *a, mp_int *b, mp_int *c);
 MP_API int  mp_exptmod (mp_int * g, mp_int * x, mp_int * p, mp_int * y);
 MP_API int  mp_exptmod_ex (mp_int * g, mp_int * x, int minDigits, mp_int * p,
                            mp_int * y);
@@ -751,6 +751,9 @@ decouple library dependencies with standard string, memory and so on.
         DYNAMIC_TYPE_CMAC         = 94,
         DYNAMIC_TYPE_FALCON       = 95,
         DYNAMIC_TYPE_SESSION      = 96,
+        DYNAMIC_TYPE_CERT_VERIFY_CACHE = 97,
+        DYNAMIC_TYPE_CERT_CACHE   = 98,
+        DYNAMIC_TYPE_EPH_KEY_POOL = 99,
         DYNAMIC_TYPE_SNIFFER_SERVER     = 1000,
         DYNAMIC_TYPE_SNIFFER_SESSION    = 1001,
         DYNAMIC_TYPE_SNIFFER_PB         = 1002,
@@ -182,6 +182,40 @@
     #define wolfSSL_CryptHwMutexUnLock()    (void)0 /* Success */
 #endif /* WOLFSSL_CRYPT_HW_MUTEX */
 
+/* Atomic pointer read and publish for data read without a lock. A store
+ * releases all prior writes to readers that load the pointer. When not
+ * available WOLFSSL_NO_ATOMIC_PTR is defined and readers must lock.
+ * WOLFSSL_ATOMIC_CAS_PTR stores val when ptr is still NULL and returns 1,
+ * otherwise it returns 0 and ptr is left alone. WOLFSSL_ATOMIC_INC adds one
+ * to a counter and returns the new value, with no ordering. */
+#if defined(SINGLE_THREADED)
+    #define WOLFSSL_ATOMIC_LOAD_PTR(ptr)        (ptr)
+    #define WOLFSSL_ATOMIC_STORE_PTR(ptr, val)  ((ptr) = (val))
+    #define WOLFSSL_ATOMIC_CAS_PTR(ptr, val) \
+        (((ptr) == NULL) ? ((ptr) = (val), 1) : 0)
+    #define WOLFSSL_ATOMIC_INC(var)             (++(var))
+#elif defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+    #define WOLFSSL_ATOMIC_LOAD_PTR(ptr) \
+        __atomic_load_n(&(ptr), __ATOMIC_ACQUIRE)
+    #define WOLFSSL_ATOMIC_STORE_PTR(ptr, val) \
+        __atomic_store_n(&(ptr), (val), __ATOMIC_RELEASE)
+    #define WOLFSSL_ATOMIC_CAS_PTR(ptr, val) __extension__ ({ \
+        __typeof__(ptr) wc_cas_expected = NULL; \
+        __atomic_compare_exchange_n(&(ptr), &wc_cas_expected, (val), 0, \
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); })
+    #define WOLFSSL_ATOMIC_INC(var) \
+        __atomic_add_fetch(&(var), 1, __ATOMIC_RELAXED)
+#else
+    #ifndef WOLFSSL_NO_ATOMIC_PTR
+        #define WOLFSSL_NO_ATOMIC_PTR
+    #endif
+    #define WOLFSSL_ATOMIC_LOAD_PTR(ptr)        (ptr)
+    #define WOLFSSL_ATOMIC_STORE_PTR(ptr, val)  ((ptr) = (val))
+    #define WOLFSSL_ATOMIC_CAS_PTR(ptr, val) \
+        (((ptr) == NULL) ? ((ptr) = (val), 1) : 0)
+    #define WOLFSSL_ATOMIC_INC(var)             (++(var))
+#endif
+
 /* Mutex functions */
 WOLFSSL_API int wc_InitMutex(wolfSSL_Mutex* m);
 WOLFSSL_API wolfSSL_Mutex* wc_InitAndAllocMutex(void);